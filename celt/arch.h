@@ -280,11 +280,13 @@ static OPUS_INLINE int celt_isnan(float x)
 
 #endif /* !FIXED_POINT */
 
+/* The arena the pseudostack allocates for itself must be at least as large as
+   opus_encoder_get_scratch_size(2). */
 #ifndef GLOBAL_STACK_SIZE
 #ifdef FIXED_POINT
 #define GLOBAL_STACK_SIZE 120000
 #else
-#define GLOBAL_STACK_SIZE 120000
+#define GLOBAL_STACK_SIZE 160000
 #endif
 #endif
 
@@ -300,6 +300,39 @@ const char *opus_strerror(int error)
       return error_strings[-error];
 }
 
+#if defined(NONTHREADSAFE_PSEUDOSTACK)
+void opus_scratch_overflow(void)
+{
+   if (scratch_jmp != NULL)
+      longjmp(*scratch_jmp, 1);
+#if defined(ENABLE_ASSERTIONS) || defined(ENABLE_HARDENING)
+   CELT_FATAL("scratch arena overflow");
+#else
+   abort();
+#endif
+}
+#endif
+
+int opus_set_scratch_buffer(void *buf, opus_int32 size)
+{
+#if defined(NONTHREADSAFE_PSEUDOSTACK)
+   if (buf != NULL && size <= 0)
+      return OPUS_BAD_ARG;
+   /* Release the arena the library allocated for this thread, if any. */
+   if (!scratch_is_user && scratch_ptr != NULL)
+      opus_free(scratch_ptr);
+   scratch_ptr = (char*)buf;
+   global_stack = (char*)buf;
+   global_stack_top = buf != NULL ? (char*)buf + size : NULL;
+   scratch_is_user = buf != NULL;
+   return OPUS_OK;
+#else
+   (void)buf;
+   (void)size;
+   return OPUS_UNIMPLEMENTED;
+#endif
+}
+
 const char *opus_get_version_string(void)
 {
     return "libopus " PACKAGE_VERSION
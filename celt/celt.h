@@ -41,6 +41,7 @@
 #include "entenc.h"
 #include "entdec.h"
 #include "arch.h"
+#include "profile_stats.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -79,6 +80,10 @@ typedef struct {
 
 #define __celt_check_silkinfo_ptr(ptr) ((ptr) + ((ptr) - (const SILKInfo*)(ptr)))
 
+#define __celt_check_profile_ptr(ptr) ((ptr) + ((ptr) - (OpusProfile*)(ptr)))
+
+#define __celt_check_pitch_share_ptr(ptr) ((ptr) + ((ptr) - (CELTPitchShare*)(ptr)))
+
 /* Encoder/decoder Requests */
 
 
@@ -131,6 +136,12 @@ typedef struct {
 #define CELT_SET_SILK_INFO_REQUEST    10028
 #define CELT_SET_SILK_INFO(x) CELT_SET_SILK_INFO_REQUEST, __celt_check_silkinfo_ptr(x)
 
+#define CELT_SET_PROFILE_REQUEST    10030
+#define CELT_SET_PROFILE(x) CELT_SET_PROFILE_REQUEST, __celt_check_profile_ptr(x)
+
+#define CELT_SET_PITCH_SHARE_REQUEST    10032
+#define CELT_SET_PITCH_SHARE(x) CELT_SET_PITCH_SHARE_REQUEST, __celt_check_pitch_share_ptr(x)
+
 /* Encoder stuff */
 
 int celt_encoder_get_size(int channels);
@@ -140,6 +151,11 @@ int celt_encode_with_ec(OpusCustomEncoder * OPUS_RESTRICT st, const opus_val16 *
 int celt_encoder_init(CELTEncoder *st, opus_int32 sampling_rate, int channels,
                       int arch);
 
+/* Codes the per-band TF change flags in tf_res (0 or 1) and tf_select, then
+   replaces the flags with the resulting TF resolution of each band. */
+void tf_encode(int start, int end, int isTransient, int *tf_res, int LM,
+      int tf_select, ec_enc *enc);
+
 
 
 /* Decoder stuff */
@@ -152,6 +168,73 @@ int celt_decoder_init(CELTDecoder *st, opus_int32 sampling_rate, int channels);
 int celt_decode_with_ec(OpusCustomDecoder * OPUS_RESTRICT st, const unsigned char *data,
       int len, opus_val16 * OPUS_RESTRICT pcm, int frame_size, ec_dec *dec, int accum);
 
+int celt_decode_energies(const CELTMode *mode, const unsigned char *data,
+      int len, int LM, int C, int end, opus_val16 *oldBandE, int *transient);
+
+/* Reverse of tf_encode(): the flags go in tf_raw and the TF resolutions in
+   tf_res, which may be the same array. Returns tf_select. */
+int tf_decode(int start, int end, int isTransient, int *tf_raw, int *tf_res,
+      int LM, ec_dec *dec);
+
+/* Side information of a CELT frame, as coded before the band energies and
+   shapes. */
+typedef struct {
+   int silence;
+   int postfilter_on;
+   int postfilter_pitch;
+   int postfilter_qg;
+   int postfilter_tapset;
+   int isTransient;
+   int intra_ener;
+   int tf_select;
+   int spread_decision;
+   int alloc_trim;
+   int intensity;
+   int dual_stereo;
+   int anti_collapse_rsv;
+   int codedBands;
+   opus_int32 balance;
+} CELTSideInfo;
+
+/* Reads a frame of len bytes from dec up to and including the fine energy,
+   the way celt_decode_with_ec() does: the side information goes in info,
+   the energies are decoded into oldBandE (2*nbEBands values), and the
+   nbEBands-value arrays receive the TF flags and resolutions (see
+   tf_decode()), the caps, the dynalloc boosts and the allocation. The band
+   shapes and the final energy bits are left in dec. */
+void celt_decode_side_info(const CELTMode *mode, int start, int end, int len,
+      int LM, int C, ec_dec *dec, opus_val16 *oldBandE, CELTSideInfo *info,
+      int *tf_raw, int *tf_res, int *cap, int *offsets, int *fine_quant,
+      int *pulses, int *fine_priority);
+
+/* A frame between the decoding of its spectrum and its synthesis. */
+typedef struct {
+   celt_sig *freq;   /* Spectrum of each output channel, N apart */
+   int LM;
+   int isTransient;
+   int postfilter_pitch;
+   opus_val16 postfilter_gain;
+   int postfilter_tapset;
+   int ret;          /* What celt_decode_with_ec() would return */
+} CELTSynthesis;
+
+/* Decodes a frame as celt_decode_with_ec() does, but stops before the
+   IMDCT: the spectrum of each output channel is left in freq, which must
+   hold 2*frame_size*downsample values. data must hold a coded frame (len >
+   1) and custom mode signalling is not supported. Returns OPUS_OK, in which
+   case celt_decode_synthesis() must be called before the next frame, or an
+   error code if nothing was decoded. */
+int celt_decode_spectrum(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data,
+      int len, int frame_size, ec_dec *dec, celt_sig *freq, CELTSynthesis *syn);
+
+/* Finishes the frames of count different decoders started with
+   celt_decode_spectrum(), writing the output of st[i] to pcm[i]. The IMDCTs
+   and the de-emphasis of all the frames run together, so that the SIMD lanes
+   can be spread across decoders. All the spectra are consumed before any
+   output is written, so pcm[i] may point into syn[i].freq. */
+void celt_decode_synthesis(CELTDecoder * const *st, CELTSynthesis *syn,
+      opus_val16 * const *pcm, int count, int accum);
+
 #define celt_encoder_ctl opus_custom_encoder_ctl
 #define celt_decoder_ctl opus_custom_decoder_ctl
 
@@ -207,6 +290,27 @@ static OPUS_INLINE int fromOpus(unsigned char c)
 #define COMBFILTER_MAXPERIOD 1024
 #define COMBFILTER_MINPERIOD 15
 
+/* Frames of a multi-frame packet each get their own slot. */
+#define CELT_PITCH_SHARE_FRAMES 6
+
+/* Coarse pitch search of one frame: the prefilter history it was run on
+   and its result. */
+typedef struct {
+   int N;
+   int CC;
+   int pitch_index;
+   celt_sig pre[2*(COMBFILTER_MAXPERIOD+960)];
+   opus_val16 pitch_buf[(COMBFILTER_MAXPERIOD+960)>>1];
+} CELTPitchShareFrame;
+
+/* Lets encoders fed the same input reuse each other's coarse pitch search.
+   remove_doubling() depends on the previous period and gain of the
+   encoder, so it is not shared. */
+typedef struct {
+   int count;
+   CELTPitchShareFrame frame[CELT_PITCH_SHARE_FRAMES];
+} CELTPitchShare;
+
 extern const signed char tf_select_table[4][8];
 
 #if defined(ENABLE_HARDENING) || defined(ENABLE_ASSERTIONS)
@@ -235,13 +339,23 @@ void comb_filter_const_c(opus_val32 *y, opus_val32 *x, int T, int N,
     ((void)(arch),comb_filter_const_c(y, x, T, N, g10, g11, g12))
 #endif
 
+void deemphasis_multi_c(celt_sig * const *in, opus_val16 * const *pcm,
+      const int *stride, int N, int count, opus_val16 coef0,
+      celt_sig * const *mem);
+
+#ifndef OVERRIDE_DEEMPHASIS_MULTI
+# define deemphasis_multi(in, pcm, stride, N, count, coef0, mem, arch) \
+    ((void)(arch),deemphasis_multi_c(in, pcm, stride, N, count, coef0, mem))
+#endif
+
 void init_caps(const CELTMode *m,int *cap,int LM,int C);
 
 #ifdef RESYNTH
 void deemphasis(celt_sig *in[], opus_val16 *pcm, int N, int C, int downsample, const opus_val16 *coef, celt_sig *mem);
-void celt_synthesis(const CELTMode *mode, celt_norm *X, celt_sig * out_syn[],
+void celt_synthesis(const CELTMode *mode, const mdct_lookup *mdct,
+      const opus_val16 *window, int overlap, celt_norm *X, celt_sig * out_syn[],
       opus_val16 *oldBandE, int start, int effEnd, int C, int CC, int isTransient,
-      int LM, int downsample, int silence);
+      int LM, int downsample, int silence, int arch);
 #endif
 
 #ifdef __cplusplus
@@ -68,6 +68,17 @@
 /*                                                                    */
 /**********************************************************************/
 #define DECODE_BUFFER_SIZE 2048
+/* Each channel's history is followed by this much slack so that the window
+   can slide forward by one frame without moving any samples. The history is
+   only moved back to the start of the buffer once the slack is used up. */
+#ifndef DECODE_BUFFER_SLACK
+# ifdef SMALL_FOOTPRINT
+#  define DECODE_BUFFER_SLACK 0
+# else
+#  define DECODE_BUFFER_SLACK DECODE_BUFFER_SIZE
+# endif
+#endif
+#define DECODE_MEM_STRIDE(overlap) (DECODE_BUFFER_SIZE+DECODE_BUFFER_SLACK+(overlap))
 
 /** Decoder state
  @brief Decoder state
@@ -83,6 +94,21 @@ struct OpusCustomDecoder {
    int signalling;
    int disable_inv;
    int arch;
+#ifdef ENABLE_PROFILE_STATS
+   OpusProfile *profile;
+#endif
+
+   /* The synthesis runs at 48 kHz/synth_downsample. When it is reduced, the
+      histories shrink by the same factor and the tables for the smaller IMDCT
+      are kept in the space this frees in _decode_mem. */
+   int reduced_synthesis; /* As set with OPUS_SET_REDUCED_SYNTHESIS */
+   int synth_downsample;
+   int synth_overlap;
+   int buffer_size; /* History length of each channel */
+   int buffer_slack;
+   const opus_val16 *synth_window;
+   mdct_lookup synth_mdct;
+   kiss_fft_state synth_kfft[4];
 
    /* Everything beyond this point gets cleared on a reset */
 #define DECODER_RESET_START rng
@@ -98,10 +124,11 @@ struct OpusCustomDecoder {
    opus_val16 postfilter_gain_old;
    int postfilter_tapset;
    int postfilter_tapset_old;
+   int decode_mem_pos; /* Start of the history window in each channel */
 
    celt_sig preemph_memD[2];
 
-   celt_sig _decode_mem[1]; /* Size = channels*(DECODE_BUFFER_SIZE+mode->overlap) */
+   celt_sig _decode_mem[1]; /* Size = channels*DECODE_MEM_STRIDE(mode->overlap) */
    /* opus_val16 lpc[],  Size = channels*LPC_ORDER */
    /* opus_val16 oldEBands[], Size = 2*mode->nbEBands */
    /* opus_val16 oldLogE[], Size = 2*mode->nbEBands */
@@ -134,8 +161,9 @@ void validate_celt_decoder(CELTDecoder *st)
    celt_assert(st->arch >= 0);
    celt_assert(st->arch <= OPUS_ARCHMASK);
 #endif
-   celt_assert(st->last_pitch_index <= PLC_PITCH_LAG_MAX);
-   celt_assert(st->last_pitch_index >= PLC_PITCH_LAG_MIN || st->last_pitch_index == 0);
+   celt_assert(st->synth_downsample == 1 || st->synth_downsample == st->downsample);
+   celt_assert(st->last_pitch_index <= PLC_PITCH_LAG_MAX/st->synth_downsample);
+   celt_assert(st->last_pitch_index >= PLC_PITCH_LAG_MIN/st->synth_downsample || st->last_pitch_index == 0);
    celt_assert(st->postfilter_period < MAX_PERIOD);
    celt_assert(st->postfilter_period >= COMBFILTER_MINPERIOD || st->postfilter_period == 0);
    celt_assert(st->postfilter_period_old < MAX_PERIOD);
@@ -144,6 +172,8 @@ void validate_celt_decoder(CELTDecoder *st)
    celt_assert(st->postfilter_tapset >= 0);
    celt_assert(st->postfilter_tapset_old <= 2);
    celt_assert(st->postfilter_tapset_old >= 0);
+   celt_assert(st->decode_mem_pos >= 0);
+   celt_assert(st->decode_mem_pos <= st->buffer_slack);
 }
 #endif
 
@@ -156,7 +186,7 @@ int celt_decoder_get_size(int channels)
 OPUS_CUSTOM_NOSTATIC int opus_custom_decoder_get_size(const CELTMode *mode, int channels)
 {
    int size = sizeof(struct CELTDecoder)
-            + (channels*(DECODE_BUFFER_SIZE+mode->overlap)-1)*sizeof(celt_sig)
+            + (channels*DECODE_MEM_STRIDE(mode->overlap)-1)*sizeof(celt_sig)
             + channels*LPC_ORDER*sizeof(opus_val16)
             + 4*2*mode->nbEBands*sizeof(opus_val16);
    return size;
@@ -207,6 +237,7 @@ OPUS_CUSTOM_NOSTATIC int opus_custom_decoder_init(CELTDecoder *st, const CELTMod
    st->stream_channels = st->channels = channels;
 
    st->downsample = 1;
+   st->synth_downsample = 1;
    st->start = 0;
    st->end = st->mode->effEBands;
    st->signalling = 1;
@@ -229,6 +260,88 @@ void opus_custom_decoder_destroy(CELTDecoder *st)
 }
 #endif /* CUSTOM_MODES */
 
+static int decode_mem_stride(const CELTDecoder *st)
+{
+   return st->buffer_size+st->buffer_slack+st->synth_overlap;
+}
+
+/* Sets up the history geometry and the IMDCT for the synthesis rate. With a
+   reduced rate, the tables go after the shortened channel histories: the
+   trig table, the FFT twiddles, the window and the bit-reverse tables. When
+   compute is 0 the tables are assumed to be there already and only the
+   pointers to them are updated, so that a copied state still works. Returns
+   0 if the tables don't fit or the FFT sizes can't be factored. */
+static int reduced_synthesis_init(CELTDecoder *st, int compute)
+{
+   const OpusCustomMode *mode;
+   int downsample;
+   int n, maxshift;
+   int i;
+   char *ptr;
+   kiss_twiddle_scalar *trig;
+   kiss_twiddle_cpx *twiddles;
+   opus_val16 *window;
+   opus_int16 *bitrev;
+   mode = st->mode;
+   downsample = st->synth_downsample;
+   if (downsample == 1)
+   {
+      st->buffer_size = DECODE_BUFFER_SIZE;
+      st->buffer_slack = DECODE_BUFFER_SLACK;
+      st->synth_overlap = st->overlap;
+      st->synth_window = mode->window;
+      return 1;
+   }
+   /* Keep the lengths even for the PLC pitch search. */
+   st->buffer_size = (DECODE_BUFFER_SIZE/downsample)&~1;
+   st->buffer_slack = DECODE_BUFFER_SLACK/downsample;
+   st->synth_overlap = st->overlap/downsample;
+   n = mode->mdct.n/downsample;
+   maxshift = mode->mdct.maxshift;
+   ptr = (char*)(st->_decode_mem + st->channels*decode_mem_stride(st));
+   trig = (kiss_twiddle_scalar*)(void*)ptr;
+   ptr += (n-(n>>1>>maxshift))*sizeof(*trig);
+   twiddles = (kiss_twiddle_cpx*)(void*)ptr;
+   ptr += (n>>2)*sizeof(*twiddles);
+   window = (opus_val16*)(void*)ptr;
+   ptr += st->synth_overlap*sizeof(*window);
+   bitrev = (opus_int16*)(void*)ptr;
+   for (i=0;i<=maxshift;i++)
+      ptr += (n>>2>>i)*sizeof(*bitrev);
+   if (ptr > (char*)(st->_decode_mem + st->channels*DECODE_MEM_STRIDE(st->overlap)))
+      return 0;
+   st->synth_window = window;
+   if (!compute)
+   {
+      st->synth_mdct.trig = trig;
+      for (i=0;i<=maxshift;i++)
+      {
+         st->synth_mdct.kfft[i] = &st->synth_kfft[i];
+         st->synth_kfft[i].twiddles = twiddles;
+         st->synth_kfft[i].bitrev = bitrev;
+         bitrev += n>>2>>i;
+      }
+      return 1;
+   }
+   if (!clt_mdct_init_tables(&st->synth_mdct, n, maxshift, st->synth_kfft,
+         twiddles, bitrev, trig))
+      return 0;
+   /* The same power-complementary window as the mode's, over the shorter
+      overlap. */
+   for (i=0;i<st->synth_overlap;i++)
+   {
+      opus_val16 x;
+#ifdef FIXED_POINT
+      x = celt_cos_norm(32768-((2*i+1)<<14)/st->synth_overlap);
+      window[i] = celt_cos_norm(32768-SHR32(MULT16_16(x, x), 15));
+#else
+      x = celt_cos_norm(1.f-(i+.5f)/st->synth_overlap);
+      window[i] = celt_cos_norm(1.f-x*x);
+#endif
+   }
+   return 1;
+}
+
 #ifndef CUSTOM_MODES
 /* Special case for stereo with no downsampling and no accumulation. This is
    quite common and we can make it faster by processing both channels in the
@@ -363,88 +476,261 @@ void deemphasis(celt_sig *in[], opus_val16 *pcm, int N, int C, int downsample, c
    RESTORE_STACK;
 }
 
-#ifndef RESYNTH
-static
+/* De-emphasis without downsampling of count independent channels, each with
+   its own output stride and filter memory. */
+void deemphasis_multi_c(celt_sig * const *in, opus_val16 * const *pcm,
+      const int *stride, int N, int count, opus_val16 coef0,
+      celt_sig * const *mem)
+{
+   int k, j;
+   for (k=0;k<count;k++)
+   {
+      const celt_sig * OPUS_RESTRICT x;
+      opus_val16 * OPUS_RESTRICT y;
+      celt_sig m = *mem[k];
+      int s = stride[k];
+      x = in[k];
+      y = pcm[k];
+      for (j=0;j<N;j++)
+      {
+         celt_sig tmp = x[j] + VERY_SMALL + m;
+         m = MULT16_32_Q15(coef0, tmp);
+         y[j*s] = SCALEOUT(SIG2WORD16(tmp));
+      }
+      *mem[k] = m;
+   }
+}
+
+/* Pole, zero and gain (Q13) of the de-emphasis for a synthesis rate reduced
+   by 2, 3, 4 and 6. The pole is that of the 48 kHz filter for the same decay
+   time, and the zero and gain match its response at DC and at the output
+   Nyquist frequency. The response is within 1 dB in between. */
+static const opus_val16 reduced_deemph_coef[4][3] = {
+   {QCONST16(0.7225000f, 15), QCONST16(0.1699825f, 15), QCONST16(1.5812202f, 13)},
+   {QCONST16(0.6141250f, 15), QCONST16(0.1963607f, 15), QCONST16(2.1502713f, 13)},
+   {QCONST16(0.5220063f, 15), QCONST16(0.2033130f, 15), QCONST16(2.6482096f, 13)},
+   {QCONST16(0.3771495f, 15), QCONST16(0.2026656f, 15), QCONST16(3.4526110f, 13)}
+};
+
+static void deemphasis_reduced(celt_sig *in[], opus_val16 *pcm, int N, int C,
+      int downsample, celt_sig *mem, int accum)
+{
+   int c;
+   const opus_val16 *coef;
+   coef = reduced_deemph_coef[downsample==6 ? 3 : downsample-2];
+#ifndef FIXED_POINT
+   (void)accum;
+   celt_assert(accum==0);
 #endif
-void celt_synthesis(const CELTMode *mode, celt_norm *X, celt_sig * out_syn[],
-                    opus_val16 *oldBandE, int start, int effEnd, int C, int CC,
-                    int isTransient, int LM, int downsample,
-                    int silence, int arch)
+   c=0; do {
+      int j;
+      celt_sig * OPUS_RESTRICT x;
+      opus_val16  * OPUS_RESTRICT y;
+      celt_sig m = mem[c];
+      x =in[c];
+      y = pcm+c;
+      for (j=0;j<N;j++)
+      {
+         celt_sig tmp = x[j] + VERY_SMALL + m;
+         m = MULT16_32_Q15(coef[0], tmp) + MULT16_32_Q15(coef[1], x[j]);
+         tmp = SHL32(MULT16_32_Q15(coef[2], tmp), 2);
+#ifdef FIXED_POINT
+         if (accum)
+            y[j*C] = SAT16(ADD32(y[j*C], SCALEOUT(SIG2WORD16(tmp))));
+         else
+#endif
+            y[j*C] = SCALEOUT(SIG2WORD16(tmp));
+      }
+      mem[c] = m;
+   } while (++c<C);
+}
+
+/* Pitch post-filter for the reduced-rate synthesis, with the periods given
+   at 48 kHz. Since nothing is left above the output Nyquist frequency, the
+   taps of comb_filter() (which add up to one for every tapset) collapse into
+   a single tap at the fractional period T/downsample, which is interpolated
+   linearly. */
+static void comb_filter_reduced(opus_val32 *y, opus_val32 *x, int T0, int T1,
+      int N, opus_val16 g0, opus_val16 g1, const opus_val16 *window,
+      int overlap, int downsample)
+{
+   int i;
+   int q0, q1;
+   opus_val16 f0, f1;
+   if (g0==0 && g1==0)
+   {
+      if (x!=y)
+         OPUS_MOVE(y, x, N);
+      return;
+   }
+   T0 = IMAX(T0, COMBFILTER_MINPERIOD);
+   T1 = IMAX(T1, COMBFILTER_MINPERIOD);
+   q0 = T0/downsample;
+   q1 = T1/downsample;
+#ifdef FIXED_POINT
+   f0 = ((T0-q0*downsample)<<15)/downsample;
+   f1 = ((T1-q1*downsample)<<15)/downsample;
+#else
+   f0 = (T0-q0*downsample)/(float)downsample;
+   f1 = (T1-q1*downsample)/(float)downsample;
+#endif
+   if (g0==g1 && T0==T1)
+      overlap=0;
+   for (i=0;i<overlap;i++)
+   {
+      opus_val16 f;
+      opus_val32 x0, x1;
+      x0 = ADD32(x[i-q0], MULT16_32_Q15(f0, SUB32(x[i-q0-1], x[i-q0])));
+      x1 = ADD32(x[i-q1], MULT16_32_Q15(f1, SUB32(x[i-q1-1], x[i-q1])));
+      f = MULT16_16_Q15(window[i],window[i]);
+      y[i] = x[i]
+               + MULT16_32_Q15(MULT16_16_Q15((Q15ONE-f),g0),x0)
+               + MULT16_32_Q15(MULT16_16_Q15(f,g1),x1);
+      y[i] = SATURATE(y[i], SIG_SAT);
+   }
+   if (g1==0)
+   {
+      if (x!=y)
+         OPUS_MOVE(y+overlap, x+overlap, N-overlap);
+      return;
+   }
+   for (;i<N;i++)
+   {
+      opus_val32 x1;
+      x1 = ADD32(x[i-q1], MULT16_32_Q15(f1, SUB32(x[i-q1-1], x[i-q1])));
+      y[i] = SATURATE(x[i] + MULT16_32_Q15(g1, x1), SIG_SAT);
+   }
+}
+
+/* Runs the IMDCT of the B interleaved blocks of each channel, whose spectra
+   are N apart in freq. The reduced-rate lookup has no architecture-specific
+   state, so it always uses the C version. */
+static void synthesis_imdct(const mdct_lookup *mdct, int reduced,
+      celt_sig *freq, int N, celt_sig * const *out_syn, int C,
+      const opus_val16 *window, int overlap, int shift, int B, int NB, int arch)
+{
+   int b, c;
+   if (reduced)
+   {
+      c=0; do {
+         for (b=0;b<B;b++)
+            clt_mdct_backward_c(mdct, &freq[c*N+b], out_syn[c]+NB*b, window,
+                                overlap, shift, B, arch);
+      } while (++c<C);
+   } else {
+      celt_sig *in[2];
+      in[0] = freq;
+      in[1] = freq+N;
+      clt_mdct_backward_multi(mdct, in, out_syn, C, B, window, overlap, shift,
+                              arch);
+   }
+}
+
+/* Block layout of the IMDCT of a frame: B blocks of NB output samples each,
+   transformed with the given shift of the mdct lookup. */
+static void synthesis_blocks(const CELTMode *mode, int reduce, int isTransient,
+      int LM, int *B, int *NB, int *shift)
+{
+   if (isTransient)
+   {
+      *B = 1<<LM;
+      *NB = mode->shortMdctSize/reduce;
+      *shift = mode->maxLM;
+   } else {
+      *B = 1;
+      *NB = (mode->shortMdctSize<<LM)/reduce;
+      *shift = mode->maxLM-LM;
+   }
+}
+
+/* Denormalises the decoded bands into the spectra of the CC output channels,
+   N apart in freq, upmixing or downmixing the C coded channels as needed.
+   Only the bins below the synthesis Nyquist frequency (N/reduce of them) are
+   kept when the channels are mixed. */
+static void synthesis_spectrum(const CELTMode *mode, int reduce, celt_norm *X,
+      celt_sig *freq, opus_val16 *oldBandE, int start, int effEnd, int C,
+      int CC, int LM, int downsample, int silence)
 {
    int c, i;
    int M;
-   int b;
-   int B;
-   int N, NB;
-   int shift;
+   int N, Nd;
    int nbEBands;
-   int overlap;
-   VARDECL(celt_sig, freq);
-   SAVE_STACK;
 
-   overlap = mode->overlap;
    nbEBands = mode->nbEBands;
    N = mode->shortMdctSize<<LM;
-   ALLOC(freq, N, celt_sig); /**< Interleaved signal MDCTs */
+   Nd = N/reduce;
    M = 1<<LM;
 
-   if (isTransient)
-   {
-      B = M;
-      NB = mode->shortMdctSize;
-      shift = mode->maxLM;
-   } else {
-      B = 1;
-      NB = mode->shortMdctSize<<LM;
-      shift = mode->maxLM-LM;
-   }
-
    if (CC==2&&C==1)
    {
       /* Copying a mono streams to two channels */
-      celt_sig *freq2;
       denormalise_bands(mode, X, freq, oldBandE, start, effEnd, M,
             downsample, silence);
-      /* Store a temporary copy in the output buffer because the IMDCT destroys its input. */
-      freq2 = out_syn[1]+overlap/2;
-      OPUS_COPY(freq2, freq, N);
-      for (b=0;b<B;b++)
-         clt_mdct_backward(&mode->mdct, &freq2[b], out_syn[0]+NB*b, mode->window, overlap, shift, B, arch);
-      for (b=0;b<B;b++)
-         clt_mdct_backward(&mode->mdct, &freq[b], out_syn[1]+NB*b, mode->window, overlap, shift, B, arch);
+      /* Keep a copy because the IMDCT destroys its input. */
+      OPUS_COPY(freq+N, freq, Nd);
    } else if (CC==1&&C==2)
    {
       /* Downmixing a stereo stream to mono */
-      celt_sig *freq2;
-      freq2 = out_syn[0]+overlap/2;
       denormalise_bands(mode, X, freq, oldBandE, start, effEnd, M,
             downsample, silence);
-      /* Use the output buffer as temp array before downmixing. */
-      denormalise_bands(mode, X+N, freq2, oldBandE+nbEBands, start, effEnd, M,
+      denormalise_bands(mode, X+N, freq+N, oldBandE+nbEBands, start, effEnd, M,
             downsample, silence);
-      for (i=0;i<N;i++)
-         freq[i] = ADD32(HALF32(freq[i]), HALF32(freq2[i]));
-      for (b=0;b<B;b++)
-         clt_mdct_backward(&mode->mdct, &freq[b], out_syn[0]+NB*b, mode->window, overlap, shift, B, arch);
+      for (i=0;i<Nd;i++)
+         freq[i] = ADD32(HALF32(freq[i]), HALF32(freq[N+i]));
    } else {
       /* Normal case (mono or stereo) */
       c=0; do {
-         denormalise_bands(mode, X+c*N, freq, oldBandE+c*nbEBands, start, effEnd, M,
+         denormalise_bands(mode, X+c*N, freq+c*N, oldBandE+c*nbEBands, start, effEnd, M,
                downsample, silence);
-         for (b=0;b<B;b++)
-            clt_mdct_backward(&mode->mdct, &freq[b], out_syn[c]+NB*b, mode->window, overlap, shift, B, arch);
       } while (++c<CC);
    }
-   /* Saturate IMDCT output so that we can't overflow in the pitch postfilter
-      or in the */
+}
+
+/* Saturate IMDCT output so that we can't overflow in the pitch postfilter
+   or in the */
+static void synthesis_saturate(celt_sig * const *out_syn, int CC, int Nd)
+{
+   int c, i;
    c=0; do {
-      for (i=0;i<N;i++)
+      for (i=0;i<Nd;i++)
          out_syn[c][i] = SATURATE(out_syn[c][i], SIG_SAT);
    } while (++c<CC);
+}
+
+/* Synthesizes the N/(mode->mdct.n/mdct->n) output samples of each channel.
+   With a reduced-rate mdct, only the bins below the output Nyquist frequency
+   are transformed. */
+#ifndef RESYNTH
+static
+#endif
+void celt_synthesis(const CELTMode *mode, const mdct_lookup *mdct,
+                    const opus_val16 *window, int overlap,
+                    celt_norm *X, celt_sig * out_syn[],
+                    opus_val16 *oldBandE, int start, int effEnd, int C, int CC,
+                    int isTransient, int LM, int downsample,
+                    int silence, int arch)
+{
+   int B, NB, N;
+   int shift;
+   int reduce;
+   VARDECL(celt_sig, freq);
+   SAVE_STACK;
+
+   N = mode->shortMdctSize<<LM;
+   reduce = mode->mdct.n/mdct->n;
+   /* Each channel's spectrum gets its own space so that all the IMDCTs can
+      run in a single call. */
+   ALLOC(freq, IMAX(C, CC)*N, celt_sig); /**< Interleaved signal MDCTs */
+   synthesis_blocks(mode, reduce, isTransient, LM, &B, &NB, &shift);
+   synthesis_spectrum(mode, reduce, X, freq, oldBandE, start, effEnd, C, CC,
+         LM, downsample, silence);
+   synthesis_imdct(mdct, reduce>1, freq, N, out_syn, CC, window, overlap, shift, B, NB, arch);
+   synthesis_saturate(out_syn, CC, N/reduce);
    RESTORE_STACK;
 }
 
-static void tf_decode(int start, int end, int isTransient, int *tf_res, int LM, ec_dec *dec)
+int tf_decode(int start, int end, int isTransient, int *tf_raw, int *tf_res,
+      int LM, ec_dec *dec)
 {
    int i, curr, tf_select;
    int tf_select_rsv;
@@ -467,7 +753,7 @@ static void tf_decode(int start, int end, int isTransient, int *tf_res, int LM,
          tell = ec_tell(dec);
          tf_changed |= curr;
       }
-      tf_res[i] = curr;
+      tf_raw[i] = curr;
       logp = isTransient ? 4 : 5;
    }
    tf_select = 0;
@@ -479,22 +765,183 @@ static void tf_decode(int start, int end, int isTransient, int *tf_res, int LM,
    }
    for (i=start;i<end;i++)
    {
-      tf_res[i] = tf_select_table[LM][4*isTransient+2*tf_select+tf_res[i]];
+      tf_res[i] = tf_select_table[LM][4*isTransient+2*tf_select+tf_raw[i]];
+   }
+   return tf_select;
+}
+
+void celt_decode_side_info(const CELTMode *mode, int start, int end, int len,
+      int LM, int C, ec_dec *dec, opus_val16 *oldBandE, CELTSideInfo *info,
+      int *tf_raw, int *tf_res, int *cap, int *offsets, int *fine_quant,
+      int *pulses, int *fine_priority)
+{
+   int i;
+   opus_int32 total_bits;
+   opus_int32 tell;
+   opus_int32 bits;
+   int dynalloc_logp;
+   int nbEBands = mode->nbEBands;
+   const opus_int16 *eBands = mode->eBands;
+
+   if (C==1)
+   {
+      for (i=0;i<nbEBands;i++)
+         oldBandE[i]=MAX16(oldBandE[i],oldBandE[nbEBands+i]);
+   }
+
+   total_bits = len*8;
+   tell = ec_tell(dec);
+
+   if (tell >= total_bits)
+      info->silence = 1;
+   else if (tell==1)
+      info->silence = ec_dec_bit_logp(dec, 15);
+   else
+      info->silence = 0;
+   if (info->silence)
+   {
+      /* Pretend we've read all the remaining bits */
+      tell = len*8;
+      dec->nbits_total+=tell-ec_tell(dec);
+   }
+
+   info->postfilter_on = 0;
+   info->postfilter_pitch = 0;
+   info->postfilter_qg = 0;
+   info->postfilter_tapset = 0;
+   if (start==0 && tell+16 <= total_bits)
+   {
+      info->postfilter_on = ec_dec_bit_logp(dec, 1);
+      if (info->postfilter_on)
+      {
+         int octave;
+         octave = ec_dec_uint(dec, 6);
+         info->postfilter_pitch = (16<<octave)+ec_dec_bits(dec, 4+octave)-1;
+         info->postfilter_qg = ec_dec_bits(dec, 3);
+         if (ec_tell(dec)+2<=total_bits)
+            info->postfilter_tapset = ec_dec_icdf(dec, tapset_icdf, 2);
+      }
+      tell = ec_tell(dec);
+   }
+
+   if (LM > 0 && tell+3 <= total_bits)
+   {
+      info->isTransient = ec_dec_bit_logp(dec, 3);
+      tell = ec_tell(dec);
+   }
+   else
+      info->isTransient = 0;
+
+   /* Decode the global flags (first symbols in the stream) */
+   info->intra_ener = tell+3<=total_bits ? ec_dec_bit_logp(dec, 3) : 0;
+   /* Get band energies */
+   unquant_coarse_energy(mode, start, end, oldBandE,
+         info->intra_ener, dec, C, LM);
+
+   info->tf_select = tf_decode(start, end, info->isTransient, tf_raw, tf_res,
+         LM, dec);
+
+   tell = ec_tell(dec);
+   info->spread_decision = SPREAD_NORMAL;
+   if (tell+4 <= total_bits)
+      info->spread_decision = ec_dec_icdf(dec, spread_icdf, 5);
+
+   init_caps(mode,cap,LM,C);
+
+   dynalloc_logp = 6;
+   total_bits<<=BITRES;
+   tell = ec_tell_frac(dec);
+   for (i=start;i<end;i++)
+   {
+      int width, quanta;
+      int dynalloc_loop_logp;
+      int boost;
+      width = C*(eBands[i+1]-eBands[i])<<LM;
+      /* quanta is 6 bits, but no more than 1 bit/sample
+         and no less than 1/8 bit/sample */
+      quanta = IMIN(width<<BITRES, IMAX(6<<BITRES, width));
+      dynalloc_loop_logp = dynalloc_logp;
+      boost = 0;
+      while (tell+(dynalloc_loop_logp<<BITRES) < total_bits && boost < cap[i])
+      {
+         int flag;
+         flag = ec_dec_bit_logp(dec, dynalloc_loop_logp);
+         tell = ec_tell_frac(dec);
+         if (!flag)
+            break;
+         boost += quanta;
+         total_bits -= quanta;
+         dynalloc_loop_logp = 1;
+      }
+      offsets[i] = boost;
+      /* Making dynalloc more likely */
+      if (boost>0)
+         dynalloc_logp = IMAX(2, dynalloc_logp-1);
    }
+
+   info->alloc_trim = tell+(6<<BITRES) <= total_bits ?
+         ec_dec_icdf(dec, trim_icdf, 7) : 5;
+
+   bits = (((opus_int32)len*8)<<BITRES) - ec_tell_frac(dec) - 1;
+   info->anti_collapse_rsv = info->isTransient&&LM>=2&&bits>=((LM+2)<<BITRES) ? (1<<BITRES) : 0;
+   bits -= info->anti_collapse_rsv;
+
+   info->intensity = 0;
+   info->dual_stereo = 0;
+   info->codedBands = clt_compute_allocation(mode, start, end, offsets, cap,
+         info->alloc_trim, &info->intensity, &info->dual_stereo, bits,
+         &info->balance, pulses, fine_quant, fine_priority, C, LM, dec, 0, 0, 0);
+
+   unquant_fine_energy(mode, start, end, oldBandE, fine_quant, dec, C);
+}
+
+/* Returns the start of the history window of channel c. */
+static celt_sig *decode_mem_window(CELTDecoder *st, int c)
+{
+   return st->_decode_mem + c*decode_mem_stride(st) + st->decode_mem_pos;
+}
+
+/* Slides the history window of channel c forward by N samples and returns its
+   new start. Only the first len samples of the new window are guaranteed to
+   hold the old history. The caller must call commit_decode_mem() once all the
+   channels have been slid. */
+static celt_sig *slide_decode_mem(CELTDecoder *st, int c, int N, int len)
+{
+   celt_sig *buf;
+   int pos;
+   buf = st->_decode_mem + c*decode_mem_stride(st);
+   pos = st->decode_mem_pos+N;
+   if (pos <= st->buffer_slack)
+      return buf+pos;
+   OPUS_MOVE(buf, buf+pos, len);
+   return buf;
+}
+
+static void commit_decode_mem(CELTDecoder *st, int N)
+{
+   st->decode_mem_pos += N;
+   if (st->decode_mem_pos > st->buffer_slack)
+      st->decode_mem_pos = 0;
 }
 
-static int celt_plc_pitch_search(celt_sig *decode_mem[2], int C, int arch)
+/* Returns the pitch in samples at the synthesis rate, which is 48 kHz
+   divided by downsample. */
+static int celt_plc_pitch_search(celt_sig *decode_mem[2], int C,
+      int buffer_size, int downsample, int arch)
 {
    int pitch_index;
+   int lag_max, lag_min;
    VARDECL( opus_val16, lp_pitch_buf );
    SAVE_STACK;
-   ALLOC( lp_pitch_buf, DECODE_BUFFER_SIZE>>1, opus_val16 );
+   lag_max = PLC_PITCH_LAG_MAX/downsample;
+   lag_min = PLC_PITCH_LAG_MIN/downsample;
+   ALLOC( lp_pitch_buf, buffer_size>>1, opus_val16 );
    pitch_downsample(decode_mem, lp_pitch_buf,
-         DECODE_BUFFER_SIZE, C, arch);
-   pitch_search(lp_pitch_buf+(PLC_PITCH_LAG_MAX>>1), lp_pitch_buf,
-         DECODE_BUFFER_SIZE-PLC_PITCH_LAG_MAX,
-         PLC_PITCH_LAG_MAX-PLC_PITCH_LAG_MIN, &pitch_index, arch);
-   pitch_index = PLC_PITCH_LAG_MAX-pitch_index;
+         buffer_size, C, arch);
+   pitch_search(lp_pitch_buf+(lag_max>>1), lp_pitch_buf,
+         buffer_size-lag_max,
+         lag_max-lag_min, &pitch_index, arch);
+   pitch_index = lag_max-pitch_index;
    RESTORE_STACK;
    return pitch_index;
 }
@@ -515,18 +962,28 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
    int loss_count;
    int noise_based;
    const opus_int16 *eBands;
+   int reduce;
+   int Nd;
+   int buffer_size;
+   int max_period;
+   const mdct_lookup *mdct;
    SAVE_STACK;
 
    mode = st->mode;
    nbEBands = mode->nbEBands;
-   overlap = mode->overlap;
    eBands = mode->eBands;
+   /* Everything in the time domain runs at the synthesis rate. */
+   reduce = st->synth_downsample;
+   overlap = st->synth_overlap;
+   Nd = N/reduce;
+   buffer_size = st->buffer_size;
+   max_period = MAX_PERIOD/reduce;
+   mdct = reduce>1 ? &st->synth_mdct : &mode->mdct;
 
    c=0; do {
-      decode_mem[c] = st->_decode_mem + c*(DECODE_BUFFER_SIZE+overlap);
-      out_syn[c] = decode_mem[c]+DECODE_BUFFER_SIZE-N;
+      decode_mem[c] = decode_mem_window(st, c);
    } while (++c<C);
-   lpc = (opus_val16*)(st->_decode_mem+(DECODE_BUFFER_SIZE+overlap)*C);
+   lpc = (opus_val16*)(st->_decode_mem+DECODE_MEM_STRIDE(mode->overlap)*C);
    oldBandE = lpc+C*LPC_ORDER;
    oldLogE = oldBandE + 2*nbEBands;
    oldLogE2 = oldLogE + 2*nbEBands;
@@ -550,6 +1007,13 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
       end = st->end;
       effEnd = IMAX(start, IMIN(end, mode->effEBands));
 
+      c=0; do {
+         decode_mem[c] = slide_decode_mem(st, c, Nd,
+               buffer_size-Nd+(overlap>>1));
+         out_syn[c] = decode_mem[c]+buffer_size-Nd;
+      } while (++c<C);
+      commit_decode_mem(st, Nd);
+
 #ifdef NORM_ALIASING_HACK
       /* This is an ugly hack that breaks aliasing rules and would be easily broken,
          but it saves almost 4kB of stack. */
@@ -585,12 +1049,10 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
       }
       st->rng = seed;
 
-      c=0; do {
-         OPUS_MOVE(decode_mem[c], decode_mem[c]+N,
-               DECODE_BUFFER_SIZE-N+(overlap>>1));
-      } while (++c<C);
-
-      celt_synthesis(mode, X, out_syn, oldBandE, start, effEnd, C, C, 0, LM, st->downsample, 0, st->arch);
+      PROFILE_START(st->profile, OPUS_PROFILE_CELT_MDCT);
+      celt_synthesis(mode, mdct, st->synth_window, overlap, X, out_syn,
+            oldBandE, start, effEnd, C, C, 0, LM, st->downsample, 0, st->arch);
+      PROFILE_END(st->profile, OPUS_PROFILE_CELT_MDCT);
    } else {
       int exc_length;
       /* Pitch-based PLC */
@@ -604,21 +1066,22 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
 
       if (loss_count == 0)
       {
-         st->last_pitch_index = pitch_index = celt_plc_pitch_search(decode_mem, C, st->arch);
+         st->last_pitch_index = pitch_index = celt_plc_pitch_search(decode_mem,
+               C, buffer_size, reduce, st->arch);
       } else {
          pitch_index = st->last_pitch_index;
          fade = QCONST16(.8f,15);
       }
 
       /* We want the excitation for 2 pitch periods in order to look for a
-         decaying signal, but we can't get more than MAX_PERIOD. */
-      exc_length = IMIN(2*pitch_index, MAX_PERIOD);
+         decaying signal, but we can't get more than max_period. */
+      exc_length = IMIN(2*pitch_index, max_period);
 
       ALLOC(etmp, overlap, opus_val32);
-      ALLOC(_exc, MAX_PERIOD+LPC_ORDER, opus_val16);
+      ALLOC(_exc, max_period+LPC_ORDER, opus_val16);
       ALLOC(fir_tmp, exc_length, opus_val16);
       exc = _exc+LPC_ORDER;
-      window = mode->window;
+      window = st->synth_window;
       c=0; do {
          opus_val16 decay;
          opus_val16 attenuation;
@@ -629,16 +1092,16 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
          int j;
 
          buf = decode_mem[c];
-         for (i=0;i<MAX_PERIOD+LPC_ORDER;i++)
-            exc[i-LPC_ORDER] = ROUND16(buf[DECODE_BUFFER_SIZE-MAX_PERIOD-LPC_ORDER+i], SIG_SHIFT);
+         for (i=0;i<max_period+LPC_ORDER;i++)
+            exc[i-LPC_ORDER] = ROUND16(buf[buffer_size-max_period-LPC_ORDER+i], SIG_SHIFT);
 
          if (loss_count == 0)
          {
             opus_val32 ac[LPC_ORDER+1];
-            /* Compute LPC coefficients for the last MAX_PERIOD samples before
+            /* Compute LPC coefficients for the last max_period samples before
                the first loss so we can work in the excitation-filter domain. */
             _celt_autocorr(exc, ac, window, overlap,
-                   LPC_ORDER, MAX_PERIOD, st->arch);
+                   LPC_ORDER, max_period, st->arch);
             /* Add a noise floor of -40 dB. */
 #ifdef FIXED_POINT
             ac[0] += SHR32(ac[0],13);
@@ -679,9 +1142,9 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
          {
             /* Compute the excitation for exc_length samples before the loss. We need the copy
                because celt_fir() cannot filter in-place. */
-            celt_fir(exc+MAX_PERIOD-exc_length, lpc+c*LPC_ORDER,
+            celt_fir(exc+max_period-exc_length, lpc+c*LPC_ORDER,
                   fir_tmp, exc_length, LPC_ORDER, st->arch);
-            OPUS_COPY(exc+MAX_PERIOD-exc_length, fir_tmp, exc_length);
+            OPUS_COPY(exc+max_period-exc_length, fir_tmp, exc_length);
          }
 
          /* Check if the waveform is decaying, and if so how fast.
@@ -691,15 +1154,15 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
             opus_val32 E1=1, E2=1;
             int decay_length;
 #ifdef FIXED_POINT
-            int shift = IMAX(0,2*celt_zlog2(celt_maxabs16(&exc[MAX_PERIOD-exc_length], exc_length))-20);
+            int shift = IMAX(0,2*celt_zlog2(celt_maxabs16(&exc[max_period-exc_length], exc_length))-20);
 #endif
             decay_length = exc_length>>1;
             for (i=0;i<decay_length;i++)
             {
                opus_val16 e;
-               e = exc[MAX_PERIOD-decay_length+i];
+               e = exc[max_period-decay_length+i];
                E1 += SHR32(MULT16_16(e, e), shift);
-               e = exc[MAX_PERIOD-2*decay_length+i];
+               e = exc[max_period-2*decay_length+i];
                E2 += SHR32(MULT16_16(e, e), shift);
             }
             E1 = MIN32(E1, E2);
@@ -709,15 +1172,15 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
          /* Move the decoder memory one frame to the left to give us room to
             add the data for the new frame. We ignore the overlap that extends
             past the end of the buffer, because we aren't going to use it. */
-         OPUS_MOVE(buf, buf+N, DECODE_BUFFER_SIZE-N);
+         buf = slide_decode_mem(st, c, Nd, buffer_size-Nd);
 
          /* Extrapolate from the end of the excitation with a period of
             "pitch_index", scaling down each period by an additional factor of
             "decay". */
-         extrapolation_offset = MAX_PERIOD-pitch_index;
+         extrapolation_offset = max_period-pitch_index;
          /* We need to extrapolate enough samples to cover a complete MDCT
             window (including overlap/2 samples on both sides). */
-         extrapolation_len = N+overlap;
+         extrapolation_len = Nd+overlap;
          /* We also apply fading if this is not the first loss. */
          attenuation = MULT16_16_Q15(fade, decay);
          for (i=j=0;i<extrapolation_len;i++,j++)
@@ -727,13 +1190,13 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
                j -= pitch_index;
                attenuation = MULT16_16_Q15(attenuation, decay);
             }
-            buf[DECODE_BUFFER_SIZE-N+i] =
+            buf[buffer_size-Nd+i] =
                   SHL32(EXTEND32(MULT16_16_Q15(attenuation,
                         exc[extrapolation_offset+j])), SIG_SHIFT);
             /* Compute the energy of the previously decoded signal whose
                excitation we're copying. */
             tmp = ROUND16(
-                  buf[DECODE_BUFFER_SIZE-MAX_PERIOD-N+extrapolation_offset+j],
+                  buf[buffer_size-max_period-Nd+extrapolation_offset+j],
                   SIG_SHIFT);
             S1 += SHR32(MULT16_16(tmp, tmp), 10);
          }
@@ -742,15 +1205,15 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
             /* Copy the last decoded samples (prior to the overlap region) to
                synthesis filter memory so we can have a continuous signal. */
             for (i=0;i<LPC_ORDER;i++)
-               lpc_mem[i] = ROUND16(buf[DECODE_BUFFER_SIZE-N-1-i], SIG_SHIFT);
+               lpc_mem[i] = ROUND16(buf[buffer_size-Nd-1-i], SIG_SHIFT);
             /* Apply the synthesis filter to convert the excitation back into
                the signal domain. */
-            celt_iir(buf+DECODE_BUFFER_SIZE-N, lpc+c*LPC_ORDER,
-                  buf+DECODE_BUFFER_SIZE-N, extrapolation_len, LPC_ORDER,
+            celt_iir(buf+buffer_size-Nd, lpc+c*LPC_ORDER,
+                  buf+buffer_size-Nd, extrapolation_len, LPC_ORDER,
                   lpc_mem, st->arch);
 #ifdef FIXED_POINT
             for (i=0; i < extrapolation_len; i++)
-               buf[DECODE_BUFFER_SIZE-N+i] = SATURATE(buf[DECODE_BUFFER_SIZE-N+i], SIG_SAT);
+               buf[buffer_size-Nd+i] = SATURATE(buf[buffer_size-Nd+i], SIG_SAT);
 #endif
          }
 
@@ -761,7 +1224,7 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
             opus_val32 S2=0;
             for (i=0;i<extrapolation_len;i++)
             {
-               opus_val16 tmp = ROUND16(buf[DECODE_BUFFER_SIZE-N+i], SIG_SHIFT);
+               opus_val16 tmp = ROUND16(buf[buffer_size-Nd+i], SIG_SHIFT);
                S2 += SHR32(MULT16_16(tmp, tmp), 10);
             }
             /* This checks for an "explosion" in the synthesis. */
@@ -774,7 +1237,7 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
 #endif
             {
                for (i=0;i<extrapolation_len;i++)
-                  buf[DECODE_BUFFER_SIZE-N+i] = 0;
+                  buf[buffer_size-Nd+i] = 0;
             } else if (S1 < S2)
             {
                opus_val16 ratio = celt_sqrt(frac_div32(SHR32(S1,1)+1,S2+1));
@@ -782,13 +1245,13 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
                {
                   opus_val16 tmp_g = Q15ONE
                         - MULT16_16_Q15(window[i], Q15ONE-ratio);
-                  buf[DECODE_BUFFER_SIZE-N+i] =
-                        MULT16_32_Q15(tmp_g, buf[DECODE_BUFFER_SIZE-N+i]);
+                  buf[buffer_size-Nd+i] =
+                        MULT16_32_Q15(tmp_g, buf[buffer_size-Nd+i]);
                }
                for (i=overlap;i<extrapolation_len;i++)
                {
-                  buf[DECODE_BUFFER_SIZE-N+i] =
-                        MULT16_32_Q15(ratio, buf[DECODE_BUFFER_SIZE-N+i]);
+                  buf[buffer_size-Nd+i] =
+                        MULT16_32_Q15(ratio, buf[buffer_size-Nd+i]);
                }
             }
          }
@@ -796,20 +1259,26 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
          /* Apply the pre-filter to the MDCT overlap for the next frame because
             the post-filter will be re-applied in the decoder after the MDCT
             overlap. */
-         comb_filter(etmp, buf+DECODE_BUFFER_SIZE,
-              st->postfilter_period, st->postfilter_period, overlap,
-              -st->postfilter_gain, -st->postfilter_gain,
-              st->postfilter_tapset, st->postfilter_tapset, NULL, 0, st->arch);
+         if (reduce>1)
+            comb_filter_reduced(etmp, buf+buffer_size,
+                 st->postfilter_period, st->postfilter_period, overlap,
+                 -st->postfilter_gain, -st->postfilter_gain, NULL, 0, reduce);
+         else
+            comb_filter(etmp, buf+buffer_size,
+                 st->postfilter_period, st->postfilter_period, overlap,
+                 -st->postfilter_gain, -st->postfilter_gain,
+                 st->postfilter_tapset, st->postfilter_tapset, NULL, 0, st->arch);
 
          /* Simulate TDAC on the concealed audio so that it blends with the
             MDCT of the next frame. */
          for (i=0;i<overlap/2;i++)
          {
-            buf[DECODE_BUFFER_SIZE+i] =
+            buf[buffer_size+i] =
                MULT16_32_Q15(window[i], etmp[overlap-1-i])
                + MULT16_32_Q15(window[overlap-i-1], etmp[i]);
          }
       } while (++c<C);
+      commit_decode_mem(st, Nd);
    }
 
    st->loss_count = loss_count+1;
@@ -817,13 +1286,14 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st, int N, int LM)
    RESTORE_STACK;
 }
 
-int celt_decode_with_ec(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data,
-      int len, opus_val16 * OPUS_RESTRICT pcm, int frame_size, ec_dec *dec, int accum)
+/* Decodes the frame up to and including the denormalised spectrum of each
+   output channel, which goes in freq (IMAX(C,CC)*N values), and updates all
+   the state that does not depend on the synthesis. The history window is
+   slid forward, so that celt_decode_synthesis() only has to fill it. */
+static void decode_spectrum(CELTDecoder * OPUS_RESTRICT st,
+      int len, int LM, int C, ec_dec *dec, celt_sig *freq, CELTSynthesis *syn)
 {
    int c, i, N;
-   int spread_decision;
-   opus_int32 bits;
-   ec_dec _dec;
 #ifdef NORM_ALIASING_HACK
    celt_norm *X;
 #else
@@ -836,244 +1306,61 @@ int celt_decode_with_ec(CELTDecoder * OPUS_RESTRICT st, const unsigned char *dat
    VARDECL(int, fine_priority);
    VARDECL(int, tf_res);
    VARDECL(unsigned char, collapse_masks);
-   celt_sig *decode_mem[2];
-   celt_sig *out_syn[2];
    opus_val16 *lpc;
    opus_val16 *oldBandE, *oldLogE, *oldLogE2, *backgroundLogE;
-
-   int shortBlocks;
-   int isTransient;
-   int intra_ener;
+   CELTSideInfo info;
    const int CC = st->channels;
-   int LM, M;
+   int M;
    int start;
    int end;
    int effEnd;
-   int codedBands;
-   int alloc_trim;
-   int postfilter_pitch;
-   opus_val16 postfilter_gain;
-   int intensity=0;
-   int dual_stereo=0;
-   opus_int32 total_bits;
-   opus_int32 balance;
-   opus_int32 tell;
-   int dynalloc_logp;
-   int postfilter_tapset;
-   int anti_collapse_rsv;
    int anti_collapse_on=0;
-   int silence;
-   int C = st->stream_channels;
    const OpusCustomMode *mode;
    int nbEBands;
    int overlap;
-   const opus_int16 *eBands;
-   ALLOC_STACK;
+   int reduce;
+   int Nd;
+   int buffer_size;
+   SAVE_STACK;
 
-   VALIDATE_CELT_DECODER(st);
    mode = st->mode;
    nbEBands = mode->nbEBands;
-   overlap = mode->overlap;
-   eBands = mode->eBands;
+   reduce = st->synth_downsample;
+   overlap = st->synth_overlap;
+   buffer_size = st->buffer_size;
    start = st->start;
    end = st->end;
-   frame_size *= st->downsample;
+   M=1<<LM;
+   N = M*mode->shortMdctSize;
+   Nd = N/reduce;
 
-   lpc = (opus_val16*)(st->_decode_mem+(DECODE_BUFFER_SIZE+overlap)*CC);
+   lpc = (opus_val16*)(st->_decode_mem+DECODE_MEM_STRIDE(mode->overlap)*CC);
    oldBandE = lpc+CC*LPC_ORDER;
    oldLogE = oldBandE + 2*nbEBands;
    oldLogE2 = oldLogE + 2*nbEBands;
    backgroundLogE = oldLogE2  + 2*nbEBands;
 
-#ifdef CUSTOM_MODES
-   if (st->signalling && data!=NULL)
-   {
-      int data0=data[0];
-      /* Convert "standard mode" to Opus header */
-      if (mode->Fs==48000 && mode->shortMdctSize==120)
-      {
-         data0 = fromOpus(data0);
-         if (data0<0)
-            return OPUS_INVALID_PACKET;
-      }
-      st->end = end = IMAX(1, mode->effEBands-2*(data0>>5));
-      LM = (data0>>3)&0x3;
-      C = 1 + ((data0>>2)&0x1);
-      data++;
-      len--;
-      if (LM>mode->maxLM)
-         return OPUS_INVALID_PACKET;
-      if (frame_size < mode->shortMdctSize<<LM)
-         return OPUS_BUFFER_TOO_SMALL;
-      else
-         frame_size = mode->shortMdctSize<<LM;
-   } else {
-#else
-   {
-#endif
-      for (LM=0;LM<=mode->maxLM;LM++)
-         if (mode->shortMdctSize<<LM==frame_size)
-            break;
-      if (LM>mode->maxLM)
-         return OPUS_BAD_ARG;
-   }
-   M=1<<LM;
-
-   if (len<0 || len>1275 || pcm==NULL)
-      return OPUS_BAD_ARG;
-
-   N = M*mode->shortMdctSize;
-   c=0; do {
-      decode_mem[c] = st->_decode_mem + c*(DECODE_BUFFER_SIZE+overlap);
-      out_syn[c] = decode_mem[c]+DECODE_BUFFER_SIZE-N;
-   } while (++c<CC);
-
    effEnd = end;
    if (effEnd > mode->effEBands)
       effEnd = mode->effEBands;
 
-   if (data == NULL || len<=1)
-   {
-      celt_decode_lost(st, N, LM);
-      deemphasis(out_syn, pcm, N, CC, st->downsample, mode->preemph, st->preemph_memD, accum);
-      RESTORE_STACK;
-      return frame_size/st->downsample;
-   }
-
    /* Check if there are at least two packets received consecutively before
     * turning on the pitch-based PLC */
    st->skip_plc = st->loss_count != 0;
 
-   if (dec == NULL)
-   {
-      ec_dec_init(&_dec,(unsigned char*)data,len);
-      dec = &_dec;
-   }
-
-   if (C==1)
-   {
-      for (i=0;i<nbEBands;i++)
-         oldBandE[i]=MAX16(oldBandE[i],oldBandE[nbEBands+i]);
-   }
-
-   total_bits = len*8;
-   tell = ec_tell(dec);
-
-   if (tell >= total_bits)
-      silence = 1;
-   else if (tell==1)
-      silence = ec_dec_bit_logp(dec, 15);
-   else
-      silence = 0;
-   if (silence)
-   {
-      /* Pretend we've read all the remaining bits */
-      tell = len*8;
-      dec->nbits_total+=tell-ec_tell(dec);
-   }
-
-   postfilter_gain = 0;
-   postfilter_pitch = 0;
-   postfilter_tapset = 0;
-   if (start==0 && tell+16 <= total_bits)
-   {
-      if(ec_dec_bit_logp(dec, 1))
-      {
-         int qg, octave;
-         octave = ec_dec_uint(dec, 6);
-         postfilter_pitch = (16<<octave)+ec_dec_bits(dec, 4+octave)-1;
-         qg = ec_dec_bits(dec, 3);
-         if (ec_tell(dec)+2<=total_bits)
-            postfilter_tapset = ec_dec_icdf(dec, tapset_icdf, 2);
-         postfilter_gain = QCONST16(.09375f,15)*(qg+1);
-      }
-      tell = ec_tell(dec);
-   }
-
-   if (LM > 0 && tell+3 <= total_bits)
-   {
-      isTransient = ec_dec_bit_logp(dec, 3);
-      tell = ec_tell(dec);
-   }
-   else
-      isTransient = 0;
-
-   if (isTransient)
-      shortBlocks = M;
-   else
-      shortBlocks = 0;
-
-   /* Decode the global flags (first symbols in the stream) */
-   intra_ener = tell+3<=total_bits ? ec_dec_bit_logp(dec, 3) : 0;
-   /* Get band energies */
-   unquant_coarse_energy(mode, start, end, oldBandE,
-         intra_ener, dec, C, LM);
-
    ALLOC(tf_res, nbEBands, int);
-   tf_decode(start, end, isTransient, tf_res, LM, dec);
-
-   tell = ec_tell(dec);
-   spread_decision = SPREAD_NORMAL;
-   if (tell+4 <= total_bits)
-      spread_decision = ec_dec_icdf(dec, spread_icdf, 5);
-
    ALLOC(cap, nbEBands, int);
-
-   init_caps(mode,cap,LM,C);
-
    ALLOC(offsets, nbEBands, int);
-
-   dynalloc_logp = 6;
-   total_bits<<=BITRES;
-   tell = ec_tell_frac(dec);
-   for (i=start;i<end;i++)
-   {
-      int width, quanta;
-      int dynalloc_loop_logp;
-      int boost;
-      width = C*(eBands[i+1]-eBands[i])<<LM;
-      /* quanta is 6 bits, but no more than 1 bit/sample
-         and no less than 1/8 bit/sample */
-      quanta = IMIN(width<<BITRES, IMAX(6<<BITRES, width));
-      dynalloc_loop_logp = dynalloc_logp;
-      boost = 0;
-      while (tell+(dynalloc_loop_logp<<BITRES) < total_bits && boost < cap[i])
-      {
-         int flag;
-         flag = ec_dec_bit_logp(dec, dynalloc_loop_logp);
-         tell = ec_tell_frac(dec);
-         if (!flag)
-            break;
-         boost += quanta;
-         total_bits -= quanta;
-         dynalloc_loop_logp = 1;
-      }
-      offsets[i] = boost;
-      /* Making dynalloc more likely */
-      if (boost>0)
-         dynalloc_logp = IMAX(2, dynalloc_logp-1);
-   }
-
    ALLOC(fine_quant, nbEBands, int);
-   alloc_trim = tell+(6<<BITRES) <= total_bits ?
-         ec_dec_icdf(dec, trim_icdf, 7) : 5;
-
-   bits = (((opus_int32)len*8)<<BITRES) - ec_tell_frac(dec) - 1;
-   anti_collapse_rsv = isTransient&&LM>=2&&bits>=((LM+2)<<BITRES) ? (1<<BITRES) : 0;
-   bits -= anti_collapse_rsv;
-
    ALLOC(pulses, nbEBands, int);
    ALLOC(fine_priority, nbEBands, int);
-
-   codedBands = clt_compute_allocation(mode, start, end, offsets, cap,
-         alloc_trim, &intensity, &dual_stereo, bits, &balance, pulses,
-         fine_quant, fine_priority, C, LM, dec, 0, 0, 0);
-
-   unquant_fine_energy(mode, start, end, oldBandE, fine_quant, dec, C);
+   celt_decode_side_info(mode, start, end, len, LM, C, dec, oldBandE, &info,
+         tf_res, tf_res, cap, offsets, fine_quant, pulses, fine_priority);
 
    c=0; do {
-      OPUS_MOVE(decode_mem[c], decode_mem[c]+N, DECODE_BUFFER_SIZE-N+overlap/2);
+      slide_decode_mem(st, c, Nd, buffer_size-Nd+overlap/2);
    } while (++c<CC);
+   commit_decode_mem(st, Nd);
 
    /* Decode fixed codebook */
    ALLOC(collapse_masks, C*nbEBands, unsigned char);
@@ -1081,17 +1368,21 @@ int celt_decode_with_ec(CELTDecoder * OPUS_RESTRICT st, const unsigned char *dat
 #ifdef NORM_ALIASING_HACK
    /* This is an ugly hack that breaks aliasing rules and would be easily broken,
       but it saves almost 4kB of stack. */
-   X = (celt_norm*)(out_syn[CC-1]+overlap/2);
+   X = (celt_norm*)(decode_mem_window(st, CC-1)+buffer_size-Nd+overlap/2);
 #else
    ALLOC(X, C*N, celt_norm);   /**< Interleaved normalised MDCTs */
 #endif
 
+   PROFILE_START(st->profile, OPUS_PROFILE_CELT_BANDS);
    quant_all_bands(0, mode, start, end, X, C==2 ? X+N : NULL, collapse_masks,
-         NULL, pulses, shortBlocks, spread_decision, dual_stereo, intensity, tf_res,
-         len*(8<<BITRES)-anti_collapse_rsv, balance, dec, LM, codedBands, &st->rng, 0,
+         NULL, pulses, info.isTransient ? M : 0, info.spread_decision,
+         info.dual_stereo, info.intensity, tf_res,
+         len*(8<<BITRES)-info.anti_collapse_rsv, info.balance, dec, LM,
+         info.codedBands, &st->rng, 0,
          st->arch, st->disable_inv);
+   PROFILE_END(st->profile, OPUS_PROFILE_CELT_BANDS);
 
-   if (anti_collapse_rsv > 0)
+   if (info.anti_collapse_rsv > 0)
    {
       anti_collapse_on = ec_dec_bits(dec, 1);
    }
@@ -1103,45 +1394,27 @@ int celt_decode_with_ec(CELTDecoder * OPUS_RESTRICT st, const unsigned char *dat
       anti_collapse(mode, X, collapse_masks, LM, C, N,
             start, end, oldBandE, oldLogE, oldLogE2, pulses, st->rng, st->arch);
 
-   if (silence)
+   if (info.silence)
    {
       for (i=0;i<C*nbEBands;i++)
          oldBandE[i] = -QCONST16(28.f,DB_SHIFT);
    }
 
-   celt_synthesis(mode, X, out_syn, oldBandE, start, effEnd,
-                  C, CC, isTransient, LM, st->downsample, silence, st->arch);
-
-   c=0; do {
-      st->postfilter_period=IMAX(st->postfilter_period, COMBFILTER_MINPERIOD);
-      st->postfilter_period_old=IMAX(st->postfilter_period_old, COMBFILTER_MINPERIOD);
-      comb_filter(out_syn[c], out_syn[c], st->postfilter_period_old, st->postfilter_period, mode->shortMdctSize,
-            st->postfilter_gain_old, st->postfilter_gain, st->postfilter_tapset_old, st->postfilter_tapset,
-            mode->window, overlap, st->arch);
-      if (LM!=0)
-         comb_filter(out_syn[c]+mode->shortMdctSize, out_syn[c]+mode->shortMdctSize, st->postfilter_period, postfilter_pitch, N-mode->shortMdctSize,
-               st->postfilter_gain, postfilter_gain, st->postfilter_tapset, postfilter_tapset,
-               mode->window, overlap, st->arch);
-
-   } while (++c<CC);
-   st->postfilter_period_old = st->postfilter_period;
-   st->postfilter_gain_old = st->postfilter_gain;
-   st->postfilter_tapset_old = st->postfilter_tapset;
-   st->postfilter_period = postfilter_pitch;
-   st->postfilter_gain = postfilter_gain;
-   st->postfilter_tapset = postfilter_tapset;
-   if (LM!=0)
-   {
-      st->postfilter_period_old = st->postfilter_period;
-      st->postfilter_gain_old = st->postfilter_gain;
-      st->postfilter_tapset_old = st->postfilter_tapset;
-   }
+   synthesis_spectrum(mode, reduce, X, freq, oldBandE, start, effEnd, C, CC,
+         LM, st->downsample, info.silence);
+   syn->freq = freq;
+   syn->LM = LM;
+   syn->isTransient = info.isTransient;
+   syn->postfilter_pitch = info.postfilter_pitch;
+   syn->postfilter_gain = info.postfilter_on ?
+         QCONST16(.09375f,15)*(info.postfilter_qg+1) : 0;
+   syn->postfilter_tapset = info.postfilter_tapset;
 
    if (C==1)
       OPUS_COPY(&oldBandE[nbEBands], oldBandE, nbEBands);
 
    /* In case start or end were to change */
-   if (!isTransient)
+   if (!info.isTransient)
    {
       opus_val16 max_background_increase;
       OPUS_COPY(oldLogE2, oldLogE, 2*nbEBands);
@@ -1173,28 +1446,436 @@ int celt_decode_with_ec(CELTDecoder * OPUS_RESTRICT st, const unsigned char *dat
       }
    } while (++c<2);
    st->rng = dec->rng;
-
-   deemphasis(out_syn, pcm, N, CC, st->downsample, mode->preemph, st->preemph_memD, accum);
    st->loss_count = 0;
-   RESTORE_STACK;
+
    if (ec_tell(dec) > 8*len)
-      return OPUS_INTERNAL_ERROR;
-   if(ec_get_error(dec))
-      st->error = 1;
-   return frame_size/st->downsample;
+      syn->ret = OPUS_INTERNAL_ERROR;
+   else {
+      syn->ret = N/st->downsample;
+      if(ec_get_error(dec))
+         st->error = 1;
+   }
+   RESTORE_STACK;
 }
 
+int celt_decode_spectrum(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data,
+      int len, int frame_size, ec_dec *dec, celt_sig *freq, CELTSynthesis *syn)
+{
+   int LM;
+   VALIDATE_CELT_DECODER(st);
+   celt_assert(!st->signalling);
+   frame_size *= st->downsample;
+   for (LM=0;LM<=st->mode->maxLM;LM++)
+      if (st->mode->shortMdctSize<<LM==frame_size)
+         break;
+   if (LM>st->mode->maxLM)
+      return OPUS_BAD_ARG;
+   if (len<=1 || len>1275 || data==NULL)
+      return OPUS_BAD_ARG;
+   if (st->synth_downsample>1)
+      reduced_synthesis_init(st, 0);
+   /* The synthesis runs for the whole batch; celt_decode_synthesis() charges
+      each frame its part of it. */
+   PROFILE_START(st->profile, OPUS_PROFILE_CELT_DECODE);
+   decode_spectrum(st, len, LM, st->stream_channels, dec, freq, syn);
+   PROFILE_PAUSE(st->profile, OPUS_PROFILE_CELT_DECODE);
+   return OPUS_OK;
+}
+
+/* Runs the pitch post-filter of a decoded frame over its synthesis and moves
+   the filter parameters of the frame into the state. */
+static void decode_postfilter(CELTDecoder *st, const CELTSynthesis *syn,
+      celt_sig * const *out_syn)
+{
+   int c;
+   int LM, N, Nd;
+   int reduce;
+   int overlap;
+   const OpusCustomMode *mode;
+   mode = st->mode;
+   reduce = st->synth_downsample;
+   overlap = st->synth_overlap;
+   LM = syn->LM;
+   N = mode->shortMdctSize<<LM;
+   Nd = N/reduce;
+   c=0; do {
+      st->postfilter_period=IMAX(st->postfilter_period, COMBFILTER_MINPERIOD);
+      st->postfilter_period_old=IMAX(st->postfilter_period_old, COMBFILTER_MINPERIOD);
+      if (reduce>1)
+      {
+         int short_size = mode->shortMdctSize/reduce;
+         comb_filter_reduced(out_syn[c], out_syn[c], st->postfilter_period_old, st->postfilter_period, short_size,
+               st->postfilter_gain_old, st->postfilter_gain, st->synth_window, overlap, reduce);
+         if (LM!=0)
+            comb_filter_reduced(out_syn[c]+short_size, out_syn[c]+short_size, st->postfilter_period, syn->postfilter_pitch, Nd-short_size,
+                  st->postfilter_gain, syn->postfilter_gain, st->synth_window, overlap, reduce);
+      } else {
+         comb_filter(out_syn[c], out_syn[c], st->postfilter_period_old, st->postfilter_period, mode->shortMdctSize,
+               st->postfilter_gain_old, st->postfilter_gain, st->postfilter_tapset_old, st->postfilter_tapset,
+               mode->window, overlap, st->arch);
+         if (LM!=0)
+            comb_filter(out_syn[c]+mode->shortMdctSize, out_syn[c]+mode->shortMdctSize, st->postfilter_period, syn->postfilter_pitch, N-mode->shortMdctSize,
+                  st->postfilter_gain, syn->postfilter_gain, st->postfilter_tapset, syn->postfilter_tapset,
+                  mode->window, overlap, st->arch);
+      }
+   } while (++c<st->channels);
+   st->postfilter_period_old = st->postfilter_period;
+   st->postfilter_gain_old = st->postfilter_gain;
+   st->postfilter_tapset_old = st->postfilter_tapset;
+   st->postfilter_period = syn->postfilter_pitch;
+   st->postfilter_gain = syn->postfilter_gain;
+   st->postfilter_tapset = syn->postfilter_tapset;
+   if (LM!=0)
+   {
+      st->postfilter_period_old = st->postfilter_period;
+      st->postfilter_gain_old = st->postfilter_gain;
+      st->postfilter_tapset_old = st->postfilter_tapset;
+   }
+}
+
+void celt_decode_synthesis(CELTDecoder * const *st, CELTSynthesis *syn,
+      opus_val16 * const *pcm, int count, int accum)
+{
+   int i, j, c;
+   int nb_lanes;
+   VARDECL(celt_sig *, out_syn);
+   VARDECL(celt_sig *, in);
+   VARDECL(celt_sig *, out);
+   VARDECL(opus_val16 *, lane_pcm);
+   VARDECL(int, lane_stride);
+   VARDECL(celt_sig *, lane_mem);
+   VARDECL(unsigned char, done);
+#ifdef ENABLE_PROFILE_STATS
+   VARDECL(int, lane_st);
+   VARDECL(opus_uint64, mdct_ticks);
+   opus_uint64 t0, t;
+   int total;
+#endif
+   SAVE_STACK;
+
+#ifdef ENABLE_PROFILE_STATS
+   t0 = opus_profile_timestamp();
+   ALLOC(lane_st, 2*count, int);
+   ALLOC(mdct_ticks, count, opus_uint64);
+   for (i=0;i<count;i++)
+      mdct_ticks[i] = 0;
+#endif
+   ALLOC(out_syn, 2*count, celt_sig *);
+   ALLOC(in, 2*count, celt_sig *);
+   ALLOC(out, 2*count, celt_sig *);
+   ALLOC(done, count, unsigned char);
+   for (i=0;i<count;i++)
+   {
+      int Nd = (st[i]->mode->shortMdctSize<<syn[i].LM)/st[i]->synth_downsample;
+      c=0; do {
+         out_syn[2*i+c] = decode_mem_window(st[i], c)+st[i]->buffer_size-Nd;
+      } while (++c<st[i]->channels);
+      done[i] = 0;
+   }
+
+   /* The IMDCTs of all the frames that use the same block layout run in one
+      call, with the blocks of every channel of every frame spread across the
+      SIMD lanes. The reduced-rate lookups belong to each decoder, so those
+      frames are transformed on their own. Each frame is charged for the
+      lanes it takes in its call. */
+   for (i=0;i<count;i++)
+   {
+      const CELTMode *mode;
+      int B, NB, shift, N, reduce;
+      if (done[i])
+         continue;
+      mode = st[i]->mode;
+      reduce = st[i]->synth_downsample;
+      N = mode->shortMdctSize<<syn[i].LM;
+      synthesis_blocks(mode, reduce, syn[i].isTransient, syn[i].LM, &B, &NB, &shift);
+#ifdef ENABLE_PROFILE_STATS
+      t = opus_profile_timestamp();
+#endif
+      if (reduce>1)
+      {
+         synthesis_imdct(&st[i]->synth_mdct, 1, syn[i].freq, N, out_syn+2*i,
+               st[i]->channels, st[i]->synth_window, st[i]->synth_overlap,
+               shift, B, NB, st[i]->arch);
+         done[i] = 1;
+#ifdef ENABLE_PROFILE_STATS
+         mdct_ticks[i] = opus_profile_timestamp() - t;
+#endif
+         continue;
+      }
+      nb_lanes = 0;
+      for (j=i;j<count;j++)
+      {
+         if (done[j] || st[j]->synth_downsample>1 || st[j]->mode != mode
+               || syn[j].LM != syn[i].LM || syn[j].isTransient != syn[i].isTransient)
+            continue;
+         c=0; do {
+            in[nb_lanes] = syn[j].freq+c*N;
+            out[nb_lanes] = out_syn[2*j+c];
+#ifdef ENABLE_PROFILE_STATS
+            lane_st[nb_lanes] = j;
+#endif
+            nb_lanes++;
+         } while (++c<st[j]->channels);
+         done[j] = 1;
+      }
+      clt_mdct_backward_multi(&mode->mdct, in, out, nb_lanes, B, mode->window,
+            mode->overlap, shift, st[i]->arch);
+#ifdef ENABLE_PROFILE_STATS
+      t = opus_profile_timestamp() - t;
+      for (j=0;j<nb_lanes;j++)
+         mdct_ticks[lane_st[j]] += t/nb_lanes;
+#endif
+   }
+#ifdef ENABLE_PROFILE_STATS
+   for (i=0;i<count;i++)
+      opus_profile_add(st[i]->profile, OPUS_PROFILE_CELT_MDCT, mdct_ticks[i], 1);
+#endif
+
+   for (i=0;i<count;i++)
+   {
+      int Nd = (st[i]->mode->shortMdctSize<<syn[i].LM)/st[i]->synth_downsample;
+      synthesis_saturate(out_syn+2*i, st[i]->channels, Nd);
+      decode_postfilter(st[i], &syn[i], out_syn+2*i);
+   }
+
+   /* The de-emphasis is a first-order recursion along each channel, so the
+      channels of all the frames at the full rate run side by side, one per
+      lane. */
+   ALLOC(lane_pcm, 2*count, opus_val16 *);
+   ALLOC(lane_stride, 2*count, int);
+   ALLOC(lane_mem, 2*count, celt_sig *);
+   for (i=0;i<count;i++)
+   {
+      const CELTMode *mode = st[i]->mode;
+      int N = mode->shortMdctSize<<syn[i].LM;
+      done[i] = 0;
+      if (st[i]->synth_downsample>1)
+      {
+         deemphasis_reduced(out_syn+2*i, pcm[i], N/st[i]->synth_downsample,
+               st[i]->channels, st[i]->synth_downsample, st[i]->preemph_memD, accum);
+         done[i] = 1;
+      } else if (count==1 || accum || st[i]->downsample>1
+#ifdef CUSTOM_MODES
+            || mode->preemph[1] != 0
+#endif
+            )
+      {
+         deemphasis(out_syn+2*i, pcm[i], N, st[i]->channels, st[i]->downsample,
+               mode->preemph, st[i]->preemph_memD, accum);
+         done[i] = 1;
+      }
+   }
+   for (i=0;i<count;i++)
+   {
+      int N;
+      if (done[i])
+         continue;
+      N = st[i]->mode->shortMdctSize<<syn[i].LM;
+      nb_lanes = 0;
+      for (j=i;j<count;j++)
+      {
+         if (done[j] || (st[j]->mode->shortMdctSize<<syn[j].LM) != N
+               || st[j]->mode->preemph[0] != st[i]->mode->preemph[0])
+            continue;
+         c=0; do {
+            in[nb_lanes] = out_syn[2*j+c];
+            lane_pcm[nb_lanes] = pcm[j]+c;
+            lane_stride[nb_lanes] = st[j]->channels;
+            lane_mem[nb_lanes] = &st[j]->preemph_memD[c];
+            nb_lanes++;
+         } while (++c<st[j]->channels);
+         done[j] = 1;
+      }
+      deemphasis_multi(in, lane_pcm, lane_stride, N, nb_lanes,
+            st[i]->mode->preemph[0], lane_mem, st[i]->arch);
+   }
+#ifdef ENABLE_PROFILE_STATS
+   /* Each frame is charged its IMDCT time and, by number of samples, its
+      part of the rest of the synthesis. A frame from celt_decode_with_ec()
+      still has the stage running, which measures all of it. */
+   t = opus_profile_timestamp() - t0;
+   total = 0;
+   for (i=0;i<count;i++)
+   {
+      t -= mdct_ticks[i];
+      total += st[i]->channels*(st[i]->mode->shortMdctSize<<syn[i].LM);
+   }
+   for (i=0;i<count;i++)
+      opus_profile_add(st[i]->profile, OPUS_PROFILE_CELT_DECODE, mdct_ticks[i]
+            + t*(st[i]->channels*(st[i]->mode->shortMdctSize<<syn[i].LM))/total, 1);
+#endif
+   RESTORE_STACK;
+}
+
+int celt_decode_with_ec(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data,
+      int len, opus_val16 * OPUS_RESTRICT pcm, int frame_size, ec_dec *dec, int accum)
+{
+   int c, N;
+   ec_dec _dec;
+   VARDECL(celt_sig, freq);
+   celt_sig *out_syn[2];
+   CELTSynthesis syn;
+   CELTDecoder *sts[1];
+   opus_val16 *pcms[1];
+   const int CC = st->channels;
+   int LM, M;
+   int C = st->stream_channels;
+   const OpusCustomMode *mode;
+   int reduce;
+   int Nd;
+   int buffer_size;
+   ALLOC_STACK;
+
+   VALIDATE_CELT_DECODER(st);
+   mode = st->mode;
+   /* The time-domain processing runs at the synthesis rate. */
+   reduce = st->synth_downsample;
+   buffer_size = st->buffer_size;
+   if (reduce>1)
+      reduced_synthesis_init(st, 0);
+   frame_size *= st->downsample;
+
+#ifdef CUSTOM_MODES
+   if (st->signalling && data!=NULL)
+   {
+      int data0=data[0];
+      /* Convert "standard mode" to Opus header */
+      if (mode->Fs==48000 && mode->shortMdctSize==120)
+      {
+         data0 = fromOpus(data0);
+         if (data0<0)
+            return OPUS_INVALID_PACKET;
+      }
+      st->end = IMAX(1, mode->effEBands-2*(data0>>5));
+      LM = (data0>>3)&0x3;
+      C = 1 + ((data0>>2)&0x1);
+      data++;
+      len--;
+      if (LM>mode->maxLM)
+         return OPUS_INVALID_PACKET;
+      if (frame_size < mode->shortMdctSize<<LM)
+         return OPUS_BUFFER_TOO_SMALL;
+      else
+         frame_size = mode->shortMdctSize<<LM;
+   } else {
+#else
+   {
+#endif
+      for (LM=0;LM<=mode->maxLM;LM++)
+         if (mode->shortMdctSize<<LM==frame_size)
+            break;
+      if (LM>mode->maxLM)
+         return OPUS_BAD_ARG;
+   }
+   M=1<<LM;
+
+   if (len<0 || len>1275 || pcm==NULL)
+      return OPUS_BAD_ARG;
+
+   PROFILE_START(st->profile, OPUS_PROFILE_CELT_DECODE);
+   N = M*mode->shortMdctSize;
+   Nd = N/reduce;
+
+   if (data == NULL || len<=1)
+   {
+      PROFILE_START(st->profile, OPUS_PROFILE_CELT_PLC);
+      celt_decode_lost(st, N, LM);
+      PROFILE_END(st->profile, OPUS_PROFILE_CELT_PLC);
+      c=0; do {
+         out_syn[c] = decode_mem_window(st, c)+buffer_size-Nd;
+      } while (++c<CC);
+      if (reduce>1)
+         deemphasis_reduced(out_syn, pcm, Nd, CC, reduce, st->preemph_memD, accum);
+      else
+         deemphasis(out_syn, pcm, N, CC, st->downsample, mode->preemph, st->preemph_memD, accum);
+      PROFILE_END(st->profile, OPUS_PROFILE_CELT_DECODE);
+      RESTORE_STACK;
+      return frame_size/st->downsample;
+   }
+
+   if (dec == NULL)
+   {
+      ec_dec_init(&_dec,(unsigned char*)data,len);
+      dec = &_dec;
+   }
+
+   ALLOC(freq, IMAX(C, CC)*N, celt_sig);
+   decode_spectrum(st, len, LM, C, dec, freq, &syn);
+   sts[0] = st;
+   pcms[0] = pcm;
+   celt_decode_synthesis(sts, &syn, pcms, 1, accum);
+   PROFILE_END(st->profile, OPUS_PROFILE_CELT_DECODE);
+   RESTORE_STACK;
+   return syn.ret;
+}
+
+
+/* Reads the band energies of a frame without decoding the band shapes or
+   running the synthesis. The parsing follows celt_decode_with_ec() up to
+   the fine energy; the final energy bits, which come after the shapes, are
+   not read. oldBandE holds 2*nbEBands energies and is updated the way the
+   decoder updates its own, so that it can predict the next frame, and
+   transient is set when the energies are those of 1<<LM short blocks.
+   Returns 1 for a silent frame, 0 otherwise, or a negative error code. */
+int celt_decode_energies(const CELTMode *mode, const unsigned char *data,
+      int len, int LM, int C, int end, opus_val16 *oldBandE, int *transient)
+{
+   int c, i;
+   ec_dec dec;
+   CELTSideInfo info;
+   int nbEBands = mode->nbEBands;
+   VARDECL(int, tf_res);
+   VARDECL(int, cap);
+   VARDECL(int, offsets);
+   VARDECL(int, fine_quant);
+   VARDECL(int, pulses);
+   VARDECL(int, fine_priority);
+   ALLOC_STACK;
+
+   if (len<=1 || len>1275 || LM>mode->maxLM || end>nbEBands)
+   {
+      RESTORE_STACK;
+      return OPUS_BAD_ARG;
+   }
+   ec_dec_init(&dec, (unsigned char*)data, len);
+   ALLOC(tf_res, nbEBands, int);
+   ALLOC(cap, nbEBands, int);
+   ALLOC(offsets, nbEBands, int);
+   ALLOC(fine_quant, nbEBands, int);
+   ALLOC(pulses, nbEBands, int);
+   ALLOC(fine_priority, nbEBands, int);
+   celt_decode_side_info(mode, 0, end, len, LM, C, &dec, oldBandE, &info,
+         tf_res, tf_res, cap, offsets, fine_quant, pulses, fine_priority);
+   if (info.silence)
+   {
+      for (i=0;i<C*nbEBands;i++)
+         oldBandE[i] = -QCONST16(28.f,DB_SHIFT);
+   }
+
+   if (C==1)
+      OPUS_COPY(&oldBandE[nbEBands], oldBandE, nbEBands);
+   c=0; do
+   {
+      for (i=end;i<nbEBands;i++)
+         oldBandE[c*nbEBands+i]=0;
+   } while (++c<2);
+   *transient = info.isTransient;
+   RESTORE_STACK;
+   if (ec_tell(&dec) > 8*len)
+      return OPUS_INTERNAL_ERROR;
+   return info.silence;
+}
 
 #ifdef CUSTOM_MODES
 
 #ifdef FIXED_POINT
-int opus_custom_decode(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data, int len, opus_int16 * OPUS_RESTRICT pcm, int frame_size)
+static int custom_decode_impl(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data, int len, opus_int16 * OPUS_RESTRICT pcm, int frame_size)
 {
    return celt_decode_with_ec(st, data, len, pcm, frame_size, NULL, 0);
 }
 
 #ifndef DISABLE_FLOAT_API
-int opus_custom_decode_float(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data, int len, float * OPUS_RESTRICT pcm, int frame_size)
+static int custom_decode_float_impl(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data, int len, float * OPUS_RESTRICT pcm, int frame_size)
 {
    int j, ret, C, N;
    VARDECL(opus_int16, out);
@@ -1219,12 +1900,12 @@ int opus_custom_decode_float(CELTDecoder * OPUS_RESTRICT st, const unsigned char
 
 #else
 
-int opus_custom_decode_float(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data, int len, float * OPUS_RESTRICT pcm, int frame_size)
+static int custom_decode_float_impl(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data, int len, float * OPUS_RESTRICT pcm, int frame_size)
 {
    return celt_decode_with_ec(st, data, len, pcm, frame_size, NULL, 0);
 }
 
-int opus_custom_decode(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data, int len, opus_int16 * OPUS_RESTRICT pcm, int frame_size)
+static int custom_decode_impl(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data, int len, opus_int16 * OPUS_RESTRICT pcm, int frame_size)
 {
    int j, ret, C, N;
    VARDECL(celt_sig, out);
@@ -1248,6 +1929,24 @@ int opus_custom_decode(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data
 }
 
 #endif
+
+/* Running out of scratch space returns OPUS_ALLOC_FAIL instead of aborting. */
+int opus_custom_decode(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data, int len, opus_int16 * OPUS_RESTRICT pcm, int frame_size)
+{
+   int ret;
+   SCRATCH_GUARD(ret, ret = custom_decode_impl(st, data, len, pcm, frame_size));
+   return ret;
+}
+
+#if !defined(FIXED_POINT) || !defined(DISABLE_FLOAT_API)
+int opus_custom_decode_float(CELTDecoder * OPUS_RESTRICT st, const unsigned char *data, int len, float * OPUS_RESTRICT pcm, int frame_size)
+{
+   int ret;
+   SCRATCH_GUARD(ret, ret = custom_decode_float_impl(st, data, len, pcm, frame_size));
+   return ret;
+}
+#endif
+
 #endif /* CUSTOM_MODES */
 
 int opus_custom_decoder_ctl(CELTDecoder * OPUS_RESTRICT st, int request, ...)
@@ -1302,7 +2001,7 @@ int opus_custom_decoder_ctl(CELTDecoder * OPUS_RESTRICT st, int request, ...)
       {
          int i;
          opus_val16 *lpc, *oldBandE, *oldLogE, *oldLogE2;
-         lpc = (opus_val16*)(st->_decode_mem+(DECODE_BUFFER_SIZE+st->overlap)*st->channels);
+         lpc = (opus_val16*)(st->_decode_mem+DECODE_MEM_STRIDE(st->overlap)*st->channels);
          oldBandE = lpc+st->channels*LPC_ORDER;
          oldLogE = oldBandE + 2*st->mode->nbEBands;
          oldLogE2 = oldLogE + 2*st->mode->nbEBands;
@@ -1312,6 +2011,9 @@ int opus_custom_decoder_ctl(CELTDecoder * OPUS_RESTRICT st, int request, ...)
          for (i=0;i<2*st->mode->nbEBands;i++)
             oldLogE[i]=oldLogE2[i]=-QCONST16(28.f,DB_SHIFT);
          st->skip_plc = 1;
+         /* The reduced-rate tables were cleared along with the history.
+            Their layout was checked when the synthesis rate was set. */
+         reduced_synthesis_init(st, 1);
       }
       break;
       case OPUS_GET_PITCH_REQUEST:
@@ -1336,6 +2038,13 @@ int opus_custom_decoder_ctl(CELTDecoder * OPUS_RESTRICT st, int request, ...)
          st->signalling = value;
       }
       break;
+#ifdef ENABLE_PROFILE_STATS
+      case CELT_SET_PROFILE_REQUEST:
+      {
+         st->profile = va_arg(ap, OpusProfile *);
+      }
+      break;
+#endif
       case OPUS_GET_FINAL_RANGE_REQUEST:
       {
          opus_uint32 * value = va_arg(ap, opus_uint32 *);
@@ -1364,6 +2073,44 @@ int opus_custom_decoder_ctl(CELTDecoder * OPUS_RESTRICT st, int request, ...)
           *value = st->disable_inv;
       }
       break;
+      case OPUS_SET_REDUCED_SYNTHESIS_REQUEST:
+      {
+          int synth_downsample;
+          opus_int32 value = va_arg(ap, opus_int32);
+          if(value<0 || value>1)
+          {
+             goto bad_arg;
+          }
+          synth_downsample = value ? st->downsample : 1;
+          if (synth_downsample != st->synth_downsample)
+          {
+#ifdef NORM_ALIASING_HACK
+             /* The spectrum would not fit in the shortened history. */
+             if (synth_downsample > 1)
+                goto bad_request;
+#endif
+             st->synth_downsample = synth_downsample;
+             if (!reduced_synthesis_init(st, 0))
+             {
+                st->synth_downsample = 1;
+                reduced_synthesis_init(st, 0);
+                goto bad_request;
+             }
+             opus_custom_decoder_ctl(st, OPUS_RESET_STATE);
+          }
+          st->reduced_synthesis = value;
+      }
+      break;
+      case OPUS_GET_REDUCED_SYNTHESIS_REQUEST:
+      {
+          opus_int32 *value = va_arg(ap, opus_int32*);
+          if (!value)
+          {
+             goto bad_arg;
+          }
+          *value = st->reduced_synthesis;
+      }
+      break;
       default:
          goto bad_request;
    }
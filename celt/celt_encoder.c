@@ -76,6 +76,10 @@ struct OpusCustomEncoder {
    int lfe;
    int disable_inv;
    int arch;
+#ifdef ENABLE_PROFILE_STATS
+   OpusProfile *profile;
+#endif
+   CELTPitchShare *pitch_share; /* Set by OpusGroupEncoder while it encodes */
 
    /* Everything beyond this point gets cleared on a reset */
 #define ENCODER_RESET_START rng
@@ -91,6 +95,7 @@ struct OpusCustomEncoder {
    int prefilter_period;
    opus_val16 prefilter_gain;
    int prefilter_tapset;
+   int prefilter_mem_pos; /* Start of the history window in prefilter_mem */
 #ifdef RESYNTH
    int prefilter_period_old;
    opus_val16 prefilter_gain_old;
@@ -120,13 +125,25 @@ struct OpusCustomEncoder {
 #endif
 
    celt_sig in_mem[1]; /* Size = channels*mode->overlap */
-   /* celt_sig prefilter_mem[],  Size = channels*COMBFILTER_MAXPERIOD */
+   /* celt_sig prefilter_mem[],  Size = channels*PREFILTER_MEM_STRIDE */
    /* opus_val16 oldBandE[],     Size = channels*mode->nbEBands */
    /* opus_val16 oldLogE[],      Size = channels*mode->nbEBands */
    /* opus_val16 oldLogE2[],     Size = channels*mode->nbEBands */
    /* opus_val16 energyError[],  Size = channels*mode->nbEBands */
 };
 
+/* Each channel's comb filter history is followed by this much slack so that
+   the window can slide forward by one frame without moving any samples. The
+   slack must hold at least one full frame. */
+#ifndef PREFILTER_MEM_SLACK
+# ifdef SMALL_FOOTPRINT
+#  define PREFILTER_MEM_SLACK MAX_PERIOD
+# else
+#  define PREFILTER_MEM_SLACK (2*MAX_PERIOD)
+# endif
+#endif
+#define PREFILTER_MEM_STRIDE (COMBFILTER_MAXPERIOD+PREFILTER_MEM_SLACK)
+
 int celt_encoder_get_size(int channels)
 {
    CELTMode *mode = opus_custom_mode_create(48000, 960, NULL);
@@ -137,7 +154,7 @@ OPUS_CUSTOM_NOSTATIC int opus_custom_encoder_get_size(const CELTMode *mode, int
 {
    int size = sizeof(struct CELTEncoder)
          + (channels*mode->overlap-1)*sizeof(celt_sig)    /* celt_sig in_mem[channels*mode->overlap]; */
-         + channels*COMBFILTER_MAXPERIOD*sizeof(celt_sig) /* celt_sig prefilter_mem[channels*COMBFILTER_MAXPERIOD]; */
+         + channels*PREFILTER_MEM_STRIDE*sizeof(celt_sig) /* celt_sig prefilter_mem[channels*PREFILTER_MEM_STRIDE]; */
          + 4*channels*mode->nbEBands*sizeof(opus_val16);  /* opus_val16 oldBandE[channels*mode->nbEBands]; */
                                                           /* opus_val16 oldLogE[channels*mode->nbEBands]; */
                                                           /* opus_val16 oldLogE2[channels*mode->nbEBands]; */
@@ -455,7 +472,8 @@ static void compute_mdcts(const CELTMode *mode, int shortBlocks, celt_sig * OPUS
    int N;
    int B;
    int shift;
-   int i, b, c;
+   int i, c;
+   celt_sig *x[2], *y[2];
    if (shortBlocks)
    {
       B = shortBlocks;
@@ -467,14 +485,12 @@ static void compute_mdcts(const CELTMode *mode, int shortBlocks, celt_sig * OPUS
       shift = mode->maxLM-LM;
    }
    c=0; do {
-      for (b=0;b<B;b++)
-      {
-         /* Interleaving the sub-frames while doing the MDCTs */
-         clt_mdct_forward(&mode->mdct, in+c*(B*N+overlap)+b*N,
-                          &out[b+c*N*B], mode->window, overlap, shift, B,
-                          arch);
-      }
+      x[c] = in+c*(B*N+overlap);
+      y[c] = out+c*N*B;
    } while (++c<CC);
+   /* Interleaving the sub-frames while doing the MDCTs */
+   clt_mdct_forward_multi(&mode->mdct, x, y, CC, B, mode->window, overlap,
+                          shift, arch);
    if (CC==2&&C==1)
    {
       for (i=0;i<B*N;i++)
@@ -742,7 +758,7 @@ static int tf_analysis(const CELTMode *m, int len, int isTransient,
    return tf_select;
 }
 
-static void tf_encode(int start, int end, int isTransient, int *tf_res, int LM, int tf_select, ec_enc *enc)
+void tf_encode(int start, int end, int isTransient, int *tf_res, int LM, int tf_select, ec_enc *enc)
 {
    int curr, i;
    int tf_select_rsv;
@@ -1166,7 +1182,6 @@ static int run_prefilter(CELTEncoder *st, celt_sig *in, celt_sig *prefilter_mem,
       int prefilter_tapset, int *pitch, opus_val16 *gain, int *qgain, int enabled, int nbAvailableBytes, AnalysisInfo *analysis)
 {
    int c;
-   VARDECL(celt_sig, _pre);
    celt_sig *pre[2];
    const CELTMode *mode;
    int pitch_index;
@@ -1175,33 +1190,81 @@ static int run_prefilter(CELTEncoder *st, celt_sig *in, celt_sig *prefilter_mem,
    int pf_on;
    int qg;
    int overlap;
+   int pos;
    SAVE_STACK;
 
    mode = st->mode;
    overlap = mode->overlap;
-   ALLOC(_pre, CC*(N+COMBFILTER_MAXPERIOD), celt_sig);
-
-   pre[0] = _pre;
-   pre[1] = _pre + (N+COMBFILTER_MAXPERIOD);
-
 
+   /* The new samples are appended right after the history, so the history
+      only has to be moved back when the frame doesn't fit in the slack. */
+   pos = st->prefilter_mem_pos;
+   if (pos+COMBFILTER_MAXPERIOD+N > PREFILTER_MEM_STRIDE)
+   {
+      c=0; do {
+         OPUS_MOVE(prefilter_mem+c*PREFILTER_MEM_STRIDE,
+               prefilter_mem+c*PREFILTER_MEM_STRIDE+pos, COMBFILTER_MAXPERIOD);
+      } while (++c<CC);
+      pos = 0;
+   }
    c=0; do {
-      OPUS_COPY(pre[c], prefilter_mem+c*COMBFILTER_MAXPERIOD, COMBFILTER_MAXPERIOD);
+      pre[c] = prefilter_mem+c*PREFILTER_MEM_STRIDE+pos;
       OPUS_COPY(pre[c]+COMBFILTER_MAXPERIOD, in+c*(N+overlap)+overlap, N);
    } while (++c<CC);
 
    if (enabled)
    {
+      int i;
+      CELTPitchShareFrame *shared = NULL;
       VARDECL(opus_val16, pitch_buf);
       ALLOC(pitch_buf, (COMBFILTER_MAXPERIOD+N)>>1, opus_val16);
 
-      pitch_downsample(pre, pitch_buf, COMBFILTER_MAXPERIOD+N, CC, st->arch);
-      /* Don't search for the fir last 1.5 octave of the range because
-         there's too many false-positives due to short-term correlation */
-      pitch_search(pitch_buf+(COMBFILTER_MAXPERIOD>>1), pitch_buf, N,
-            COMBFILTER_MAXPERIOD-3*COMBFILTER_MINPERIOD, &pitch_index,
-            st->arch);
-      pitch_index = COMBFILTER_MAXPERIOD-pitch_index;
+      /* Another encoder of the group may already have searched the same
+         history, in which case only remove_doubling() is left to do. */
+      if (st->pitch_share)
+      {
+         for (i=0;i<st->pitch_share->count;i++)
+         {
+            CELTPitchShareFrame *f = &st->pitch_share->frame[i];
+            if (f->N != N || f->CC != CC)
+               continue;
+            c=0; do {
+               if (memcmp(f->pre+c*(COMBFILTER_MAXPERIOD+N), pre[c],
+                     (COMBFILTER_MAXPERIOD+N)*sizeof(*pre[c])) != 0)
+                  break;
+            } while (++c<CC);
+            if (c==CC)
+            {
+               shared = f;
+               break;
+            }
+         }
+      }
+      if (shared)
+      {
+         OPUS_COPY(pitch_buf, shared->pitch_buf, (COMBFILTER_MAXPERIOD+N)>>1);
+         pitch_index = shared->pitch_index;
+      } else {
+         pitch_downsample(pre, pitch_buf, COMBFILTER_MAXPERIOD+N, CC, st->arch);
+         /* Don't search for the fir last 1.5 octave of the range because
+            there's too many false-positives due to short-term correlation */
+         pitch_search(pitch_buf+(COMBFILTER_MAXPERIOD>>1), pitch_buf, N,
+               COMBFILTER_MAXPERIOD-3*COMBFILTER_MINPERIOD, &pitch_index,
+               st->arch);
+         pitch_index = COMBFILTER_MAXPERIOD-pitch_index;
+         if (st->pitch_share && st->pitch_share->count < CELT_PITCH_SHARE_FRAMES
+               && N <= 960)
+         {
+            CELTPitchShareFrame *f = &st->pitch_share->frame[st->pitch_share->count++];
+            f->N = N;
+            f->CC = CC;
+            f->pitch_index = pitch_index;
+            c=0; do {
+               OPUS_COPY(f->pre+c*(COMBFILTER_MAXPERIOD+N), pre[c], COMBFILTER_MAXPERIOD+N);
+            } while (++c<CC);
+            OPUS_COPY(f->pitch_buf, pitch_buf, (COMBFILTER_MAXPERIOD+N)>>1);
+         }
+      }
 
       gain1 = remove_doubling(pitch_buf, COMBFILTER_MAXPERIOD, COMBFILTER_MINPERIOD,
             N, &pitch_index, st->prefilter_period, st->prefilter_gain, st->arch);
@@ -1277,15 +1340,8 @@ static int run_prefilter(CELTEncoder *st, celt_sig *in, celt_sig *prefilter_mem,
             st->prefilter_period, pitch_index, N-offset, -st->prefilter_gain, -gain1,
             st->prefilter_tapset, prefilter_tapset, mode->window, overlap, st->arch);
       OPUS_COPY(st->in_mem+c*(overlap), in+c*(N+overlap)+N, overlap);
-
-      if (N>COMBFILTER_MAXPERIOD)
-      {
-         OPUS_COPY(prefilter_mem+c*COMBFILTER_MAXPERIOD, pre[c]+N, COMBFILTER_MAXPERIOD);
-      } else {
-         OPUS_MOVE(prefilter_mem+c*COMBFILTER_MAXPERIOD, prefilter_mem+c*COMBFILTER_MAXPERIOD+N, COMBFILTER_MAXPERIOD-N);
-         OPUS_COPY(prefilter_mem+c*COMBFILTER_MAXPERIOD+COMBFILTER_MAXPERIOD-N, pre[c]+COMBFILTER_MAXPERIOD, N);
-      }
    } while (++c<CC);
+   st->prefilter_mem_pos = pos+N;
 
    RESTORE_STACK;
    *gain = gain1;
@@ -1506,7 +1562,7 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_val16 * pcm,
    N = M*mode->shortMdctSize;
 
    prefilter_mem = st->in_mem+CC*(overlap);
-   oldBandE = (opus_val16*)(st->in_mem+CC*(overlap+COMBFILTER_MAXPERIOD));
+   oldBandE = (opus_val16*)(st->in_mem+CC*(overlap+PREFILTER_MEM_STRIDE));
    oldLogE = oldBandE + CC*nbEBands;
    oldLogE2 = oldLogE + CC*nbEBands;
    energyError = oldLogE2 + CC*nbEBands;
@@ -1547,6 +1603,7 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_val16 * pcm,
    celt_assert(st->signalling==0);
 #endif
 
+   PROFILE_START(st->profile, OPUS_PROFILE_CELT_ENCODE);
    /* Can't produce more than 1275 output bytes */
    nbCompressedBytes = IMIN(nbCompressedBytes,1275);
    nbAvailableBytes = nbCompressedBytes - nbFilledBytes;
@@ -1665,7 +1722,9 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_val16 * pcm,
             && st->complexity >= 5;
 
       prefilter_tapset = st->tapset_decision;
+      PROFILE_START(st->profile, OPUS_PROFILE_CELT_PREFILTER);
       pf_on = run_prefilter(st, in, prefilter_mem, CC, N, prefilter_tapset, &pitch_index, &gain1, &qg, enabled, nbAvailableBytes, &st->analysis);
+      PROFILE_END(st->profile, OPUS_PROFILE_CELT_PREFILTER);
       if ((gain1 > QCONST16(.4f,15) || st->prefilter_gain > QCONST16(.4f,15)) && (!st->analysis.valid || st->analysis.tonality > .3)
             && (pitch_index > 1.26*st->prefilter_period || pitch_index < .79*st->prefilter_period))
          pitch_change = 1;
@@ -1716,14 +1775,18 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_val16 * pcm,
    ALLOC(bandLogE2, C*nbEBands, opus_val16);
    if (secondMdct)
    {
+      PROFILE_START(st->profile, OPUS_PROFILE_CELT_MDCT);
       compute_mdcts(mode, 0, in, freq, C, CC, LM, st->upsample, st->arch);
+      PROFILE_END(st->profile, OPUS_PROFILE_CELT_MDCT);
       compute_band_energies(mode, freq, bandE, effEnd, C, LM, st->arch);
       amp2Log2(mode, effEnd, end, bandE, bandLogE2, C);
       for (i=0;i<C*nbEBands;i++)
          bandLogE2[i] += HALF16(SHL16(LM, DB_SHIFT));
    }
 
+   PROFILE_START(st->profile, OPUS_PROFILE_CELT_MDCT);
    compute_mdcts(mode, shortBlocks, in, freq, C, CC, LM, st->upsample, st->arch);
+   PROFILE_END(st->profile, OPUS_PROFILE_CELT_MDCT);
    /* This should catch any NaN in the CELT input. Since we're not supposed to see any (they're filtered
       at the Opus layer), just abort. */
    celt_assert(!celt_isnan(freq[0]) && (C==1 || !celt_isnan(freq[N])));
@@ -1852,7 +1915,9 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_val16 * pcm,
       {
          isTransient = 1;
          shortBlocks = M;
+         PROFILE_START(st->profile, OPUS_PROFILE_CELT_MDCT);
          compute_mdcts(mode, shortBlocks, in, freq, C, CC, LM, st->upsample, st->arch);
+         PROFILE_END(st->profile, OPUS_PROFILE_CELT_MDCT);
          compute_band_energies(mode, freq, bandE, effEnd, C, LM, st->arch);
          amp2Log2(mode, effEnd, end, bandE, bandLogE, C);
          /* Compensate for the scaling of short vs long mdcts */
@@ -2203,10 +2268,12 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_val16 * pcm,
 
    /* Residual quantisation */
    ALLOC(collapse_masks, C*nbEBands, unsigned char);
+   PROFILE_START(st->profile, OPUS_PROFILE_CELT_BANDS);
    quant_all_bands(1, mode, start, end, X, C==2 ? X+N : NULL, collapse_masks,
          bandE, pulses, shortBlocks, st->spread_decision,
          dual_stereo, st->intensity, tf_res, nbCompressedBytes*(8<<BITRES)-anti_collapse_rsv,
          balance, enc, LM, codedBands, &st->rng, st->complexity, st->arch, st->disable_inv);
+   PROFILE_END(st->profile, OPUS_PROFILE_CELT_BANDS);
 
    if (anti_collapse_rsv > 0)
    {
@@ -2251,8 +2318,9 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_val16 * pcm,
          out_mem[c] = st->syn_mem[c]+2*MAX_PERIOD-N;
       } while (++c<CC);
 
-      celt_synthesis(mode, X, out_mem, oldBandE, start, effEnd,
-                     C, CC, isTransient, LM, st->upsample, silence, st->arch);
+      celt_synthesis(mode, &mode->mdct, mode->window, overlap, X, out_mem,
+                     oldBandE, start, effEnd, C, CC, isTransient, LM,
+                     st->upsample, silence, st->arch);
 
       c=0; do {
          st->prefilter_period=IMAX(st->prefilter_period, COMBFILTER_MINPERIOD);
@@ -2328,6 +2396,7 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_val16 * pcm,
       nbCompressedBytes++;
 #endif
 
+   PROFILE_END(st->profile, OPUS_PROFILE_CELT_ENCODE);
    RESTORE_STACK;
    if (ec_get_error(enc))
       return OPUS_INTERNAL_ERROR;
@@ -2339,13 +2408,13 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_val16 * pcm,
 #ifdef CUSTOM_MODES
 
 #ifdef FIXED_POINT
-int opus_custom_encode(CELTEncoder * OPUS_RESTRICT st, const opus_int16 * pcm, int frame_size, unsigned char *compressed, int nbCompressedBytes)
+static int custom_encode_impl(CELTEncoder * OPUS_RESTRICT st, const opus_int16 * pcm, int frame_size, unsigned char *compressed, int nbCompressedBytes)
 {
    return celt_encode_with_ec(st, pcm, frame_size, compressed, nbCompressedBytes, NULL);
 }
 
 #ifndef DISABLE_FLOAT_API
-int opus_custom_encode_float(CELTEncoder * OPUS_RESTRICT st, const float * pcm, int frame_size, unsigned char *compressed, int nbCompressedBytes)
+static int custom_encode_float_impl(CELTEncoder * OPUS_RESTRICT st, const float * pcm, int frame_size, unsigned char *compressed, int nbCompressedBytes)
 {
    int j, ret, C, N;
    VARDECL(opus_int16, in);
@@ -2372,7 +2441,7 @@ int opus_custom_encode_float(CELTEncoder * OPUS_RESTRICT st, const float * pcm,
 #endif /* DISABLE_FLOAT_API */
 #else
 
-int opus_custom_encode(CELTEncoder * OPUS_RESTRICT st, const opus_int16 * pcm, int frame_size, unsigned char *compressed, int nbCompressedBytes)
+static int custom_encode_impl(CELTEncoder * OPUS_RESTRICT st, const opus_int16 * pcm, int frame_size, unsigned char *compressed, int nbCompressedBytes)
 {
    int j, ret, C, N;
    VARDECL(celt_sig, in);
@@ -2397,13 +2466,30 @@ int opus_custom_encode(CELTEncoder * OPUS_RESTRICT st, const opus_int16 * pcm, i
    return ret;
 }
 
-int opus_custom_encode_float(CELTEncoder * OPUS_RESTRICT st, const float * pcm, int frame_size, unsigned char *compressed, int nbCompressedBytes)
+static int custom_encode_float_impl(CELTEncoder * OPUS_RESTRICT st, const float * pcm, int frame_size, unsigned char *compressed, int nbCompressedBytes)
 {
    return celt_encode_with_ec(st, pcm, frame_size, compressed, nbCompressedBytes, NULL);
 }
 
 #endif
 
+/* Running out of scratch space returns OPUS_ALLOC_FAIL instead of aborting. */
+int opus_custom_encode(CELTEncoder * OPUS_RESTRICT st, const opus_int16 * pcm, int frame_size, unsigned char *compressed, int nbCompressedBytes)
+{
+   int ret;
+   SCRATCH_GUARD(ret, ret = custom_encode_impl(st, pcm, frame_size, compressed, nbCompressedBytes));
+   return ret;
+}
+
+#if !defined(FIXED_POINT) || !defined(DISABLE_FLOAT_API)
+int opus_custom_encode_float(CELTEncoder * OPUS_RESTRICT st, const float * pcm, int frame_size, unsigned char *compressed, int nbCompressedBytes)
+{
+   int ret;
+   SCRATCH_GUARD(ret, ret = custom_encode_float_impl(st, pcm, frame_size, compressed, nbCompressedBytes));
+   return ret;
+}
+#endif
+
 #endif /* CUSTOM_MODES */
 
 int opus_custom_encoder_ctl(CELTEncoder * OPUS_RESTRICT st, int request, ...)
@@ -2521,7 +2607,7 @@ int opus_custom_encoder_ctl(CELTEncoder * OPUS_RESTRICT st, int request, ...)
       {
          int i;
          opus_val16 *oldBandE, *oldLogE, *oldLogE2;
-         oldBandE = (opus_val16*)(st->in_mem+st->channels*(st->mode->overlap+COMBFILTER_MAXPERIOD));
+         oldBandE = (opus_val16*)(st->in_mem+st->channels*(st->mode->overlap+PREFILTER_MEM_STRIDE));
          oldLogE = oldBandE + st->channels*st->mode->nbEBands;
          oldLogE2 = oldLogE + st->channels*st->mode->nbEBands;
          OPUS_CLEAR((char*)&st->ENCODER_RESET_START,
@@ -2565,6 +2651,18 @@ int opus_custom_encoder_ctl(CELTEncoder * OPUS_RESTRICT st, int request, ...)
             OPUS_COPY(&st->silk_info, info, 1);
       }
       break;
+      case CELT_SET_PITCH_SHARE_REQUEST:
+      {
+         st->pitch_share = va_arg(ap, CELTPitchShare *);
+      }
+      break;
+#ifdef ENABLE_PROFILE_STATS
+      case CELT_SET_PROFILE_REQUEST:
+      {
+         st->profile = va_arg(ap, OpusProfile *);
+      }
+      break;
+#endif
       case CELT_GET_MODE_REQUEST:
       {
          const CELTMode ** value = va_arg(ap, const CELTMode**);
@@ -54,10 +54,10 @@ static void kf_bfly2(
    kiss_fft_cpx * Fout2;
    int i;
    (void)m;
-#ifdef CUSTOM_MODES
    if (m==1)
    {
-      celt_assert(m==1);
+      /* Only used by custom modes and by the reduced-rate synthesis, whose
+         FFT sizes can end with a single radix-2 stage. */
       for (i=0;i<N;i++)
       {
          kiss_fft_cpx t;
@@ -68,11 +68,10 @@ static void kf_bfly2(
          Fout += 2;
       }
    } else
-#endif
    {
       opus_val16 tw;
       tw = QCONST16(0.7071067812f, 15);
-      /* We know that m==4 here because the radix-2 is just after a radix-4 */
+      /* Otherwise m==4 because the radix-2 is just after a radix-4 */
       celt_assert(m==4);
       for (i=0;i<N;i++)
       {
@@ -312,8 +311,6 @@ static void kf_bfly5(
 #endif
 
 
-#ifdef CUSTOM_MODES
-
 static
 void compute_bitrev_table(
          int Fout,
@@ -423,6 +420,42 @@ static void compute_twiddles(kiss_twiddle_cpx *twiddles, int nfft)
 #endif
 }
 
+int opus_fft_init(kiss_fft_state *st, int nfft, kiss_twiddle_cpx *twiddles,
+      opus_int16 *bitrev, const kiss_fft_state *base)
+{
+   st->nfft=nfft;
+#ifdef FIXED_POINT
+   st->scale_shift = celt_ilog2(st->nfft);
+   if (st->nfft == 1<<st->scale_shift)
+      st->scale = Q15ONE;
+   else
+      st->scale = (1073741824+st->nfft/2)/st->nfft>>(15-st->scale_shift);
+#else
+   st->scale = 1.f/nfft;
+#endif
+   st->bitrev = bitrev;
+   st->arch_fft = NULL;
+   if (base != NULL)
+   {
+      st->twiddles = base->twiddles;
+      st->shift = 0;
+      while (st->shift < 32 && nfft<<st->shift != base->nfft)
+         st->shift++;
+      if (st->shift>=32)
+         return 0;
+   } else {
+      st->twiddles = twiddles;
+      compute_twiddles(twiddles, nfft);
+      st->shift = -1;
+   }
+   if (!kf_factor(nfft,st->factors))
+      return 0;
+   compute_bitrev_table(0, bitrev, 1,1, st->factors,st);
+   return 1;
+}
+
+#ifdef CUSTOM_MODES
+
 int opus_fft_alloc_arch_c(kiss_fft_state *st) {
    (void)st;
    return 0;
@@ -449,41 +482,24 @@ kiss_fft_state *opus_fft_alloc_twiddles(int nfft,void * mem,size_t * lenmem,
     }
     if (st) {
         opus_int16 *bitrev;
-        kiss_twiddle_cpx *twiddles;
+        kiss_twiddle_cpx *twiddles=NULL;
 
-        st->nfft=nfft;
-#ifdef FIXED_POINT
-        st->scale_shift = celt_ilog2(st->nfft);
-        if (st->nfft == 1<<st->scale_shift)
-           st->scale = Q15ONE;
-        else
-           st->scale = (1073741824+st->nfft/2)/st->nfft>>(15-st->scale_shift);
-#else
-        st->scale = 1.f/nfft;
-#endif
-        if (base != NULL)
+        /* Set the pointers first so that opus_fft_free() only releases
+           what was allocated here. */
+        st->twiddles = NULL;
+        st->shift = base != NULL ? 0 : -1;
+        st->arch_fft = NULL;
+        st->bitrev = bitrev = (opus_int16*)KISS_FFT_MALLOC(sizeof(opus_int16)*nfft);
+        if (st->bitrev==NULL)
+            goto fail;
+        if (base == NULL)
         {
-           st->twiddles = base->twiddles;
-           st->shift = 0;
-           while (st->shift < 32 && nfft<<st->shift != base->nfft)
-              st->shift++;
-           if (st->shift>=32)
-              goto fail;
-        } else {
            st->twiddles = twiddles = (kiss_twiddle_cpx*)KISS_FFT_MALLOC(sizeof(kiss_twiddle_cpx)*nfft);
-           compute_twiddles(twiddles, nfft);
-           st->shift = -1;
-        }
-        if (!kf_factor(nfft,st->factors))
-        {
-           goto fail;
+           if (twiddles==NULL)
+              goto fail;
         }
-
-        /* bitrev */
-        st->bitrev = bitrev = (opus_int16*)KISS_FFT_MALLOC(sizeof(opus_int16)*nfft);
-        if (st->bitrev==NULL)
+        if (!opus_fft_init(st, nfft, twiddles, bitrev, base))
             goto fail;
-        compute_bitrev_table(0, bitrev, 1,1, st->factors,st);
 
         /* Initialize architecture specific fft parameters */
         if (opus_fft_alloc_arch(st, arch))
@@ -518,7 +534,7 @@ void opus_fft_free(const kiss_fft_state *cfg, int arch)
 
 #endif /* CUSTOM_MODES */
 
-void opus_fft_impl(const kiss_fft_state *st,kiss_fft_cpx *fout)
+void opus_fft_impl_c(const kiss_fft_state *st,kiss_fft_cpx *fout)
 {
     int m2, m;
     int p;
@@ -585,7 +601,7 @@ void opus_fft_c(const kiss_fft_state *st,const kiss_fft_cpx *fin,kiss_fft_cpx *f
       fout[st->bitrev[i]].r = SHR32(MULT16_32_Q16(scale, x.r), scale_shift);
       fout[st->bitrev[i]].i = SHR32(MULT16_32_Q16(scale, x.i), scale_shift);
    }
-   opus_fft_impl(st, fout);
+   opus_fft_impl_c(st, fout);
 }
 
 
@@ -598,7 +614,7 @@ void opus_ifft_c(const kiss_fft_state *st,const kiss_fft_cpx *fin,kiss_fft_cpx *
       fout[st->bitrev[i]] = fin[i];
    for (i=0;i<st->nfft;i++)
       fout[i].i = -fout[i].i;
-   opus_fft_impl(st, fout);
+   opus_fft_impl_c(st, fout);
    for (i=0;i<st->nfft;i++)
       fout[i].i = -fout[i].i;
 }
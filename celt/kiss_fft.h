@@ -100,6 +100,10 @@ typedef struct kiss_fft_state{
 #include "arm/fft_arm.h"
 #endif
 
+#if defined(OPUS_X86_MAY_HAVE_SSE) && !defined(FIXED_POINT)
+#include "x86/kiss_fft_sse.h"
+#endif
+
 /*typedef struct kiss_fft_state* kiss_fft_cfg;*/
 
 /**
@@ -129,6 +133,18 @@ kiss_fft_state *opus_fft_alloc_twiddles(int nfft,void * mem,size_t * lenmem, con
 
 kiss_fft_state *opus_fft_alloc(int nfft,void * mem,size_t * lenmem, int arch);
 
+/**
+ * opus_fft_init
+ *
+ * Initializes an FFT state whose tables live in caller-supplied storage:
+ * bitrev must hold nfft entries, and twiddles nfft entries unless they are
+ * shared with base. No architecture-specific state is set up, so the FFT
+ * must be run with opus_fft_impl() or the C functions.
+ * Returns 0 if nfft cannot be factored.
+ * */
+int opus_fft_init(kiss_fft_state *st, int nfft, kiss_twiddle_cpx *twiddles,
+      opus_int16 *bitrev, const kiss_fft_state *base);
+
 /**
  * opus_fft(cfg,in_out_buf)
  *
@@ -142,9 +158,14 @@ kiss_fft_state *opus_fft_alloc(int nfft,void * mem,size_t * lenmem, int arch);
 void opus_fft_c(const kiss_fft_state *cfg,const kiss_fft_cpx *fin,kiss_fft_cpx *fout);
 void opus_ifft_c(const kiss_fft_state *cfg,const kiss_fft_cpx *fin,kiss_fft_cpx *fout);
 
-void opus_fft_impl(const kiss_fft_state *st,kiss_fft_cpx *fout);
+void opus_fft_impl_c(const kiss_fft_state *st,kiss_fft_cpx *fout);
 void opus_ifft_impl(const kiss_fft_state *st,kiss_fft_cpx *fout);
 
+#if !defined(OVERRIDE_OPUS_FFT_IMPL)
+#define opus_fft_impl(_st, _fout, arch) \
+         ((void)(arch), opus_fft_impl_c(_st, _fout))
+#endif
+
 void opus_fft_free(const kiss_fft_state *cfg, int arch);
 
 
@@ -58,30 +58,11 @@
 #endif
 
 
-#ifdef CUSTOM_MODES
-
-int clt_mdct_init(mdct_lookup *l,int N, int maxshift, int arch)
+static void compute_mdct_trig(kiss_twiddle_scalar *trig, int N, int maxshift)
 {
    int i;
-   kiss_twiddle_scalar *trig;
    int shift;
    int N2=N>>1;
-   l->n = N;
-   l->maxshift = maxshift;
-   for (i=0;i<=maxshift;i++)
-   {
-      if (i==0)
-         l->kfft[i] = opus_fft_alloc(N>>2>>i, 0, 0, arch);
-      else
-         l->kfft[i] = opus_fft_alloc_twiddles(N>>2>>i, 0, 0, l->kfft[0], arch);
-#ifndef ENABLE_TI_DSPLIB55
-      if (l->kfft[i]==NULL)
-         return 0;
-#endif
-   }
-   l->trig = trig = (kiss_twiddle_scalar*)opus_alloc((N-(N2>>maxshift))*sizeof(kiss_twiddle_scalar));
-   if (l->trig==NULL)
-     return 0;
    for (shift=0;shift<=maxshift;shift++)
    {
       /* We have enough points that sine isn't necessary */
@@ -101,6 +82,52 @@ int clt_mdct_init(mdct_lookup *l,int N, int maxshift, int arch)
       N2 >>= 1;
       N >>= 1;
    }
+}
+
+int clt_mdct_init_tables(mdct_lookup *l, int N, int maxshift,
+      kiss_fft_state *kfft, kiss_twiddle_cpx *twiddles, opus_int16 *bitrev,
+      kiss_twiddle_scalar *trig)
+{
+   int i;
+   l->n = N;
+   l->maxshift = maxshift;
+   for (i=0;i<=maxshift;i++)
+   {
+      if (!opus_fft_init(&kfft[i], N>>2>>i, twiddles, bitrev,
+            i==0 ? NULL : &kfft[0]))
+         return 0;
+      l->kfft[i] = &kfft[i];
+      bitrev += N>>2>>i;
+   }
+   compute_mdct_trig(trig, N, maxshift);
+   l->trig = trig;
+   return 1;
+}
+
+#ifdef CUSTOM_MODES
+
+int clt_mdct_init(mdct_lookup *l,int N, int maxshift, int arch)
+{
+   int i;
+   kiss_twiddle_scalar *trig;
+   int N2=N>>1;
+   l->n = N;
+   l->maxshift = maxshift;
+   for (i=0;i<=maxshift;i++)
+   {
+      if (i==0)
+         l->kfft[i] = opus_fft_alloc(N>>2>>i, 0, 0, arch);
+      else
+         l->kfft[i] = opus_fft_alloc_twiddles(N>>2>>i, 0, 0, l->kfft[0], arch);
+#ifndef ENABLE_TI_DSPLIB55
+      if (l->kfft[i]==NULL)
+         return 0;
+#endif
+   }
+   l->trig = trig = (kiss_twiddle_scalar*)opus_alloc((N-(N2>>maxshift))*sizeof(kiss_twiddle_scalar));
+   if (l->trig==NULL)
+     return 0;
+   compute_mdct_trig(trig, N, maxshift);
    return 1;
 }
 
@@ -132,7 +159,6 @@ void clt_mdct_forward_c(const mdct_lookup *l, kiss_fft_scalar *in, kiss_fft_scal
    int scale_shift = st->scale_shift-1;
 #endif
    SAVE_STACK;
-   (void)arch;
    scale = st->scale;
 
    N = l->n;
@@ -212,7 +238,7 @@ void clt_mdct_forward_c(const mdct_lookup *l, kiss_fft_scalar *in, kiss_fft_scal
    }
 
    /* N/4 complex FFT, does not downscale anymore */
-   opus_fft_impl(st, f2);
+   opus_fft_impl(st, f2, arch);
 
    /* Post-rotate */
    {
@@ -245,7 +271,6 @@ void clt_mdct_backward_c(const mdct_lookup *l, kiss_fft_scalar *in, kiss_fft_sca
    int i;
    int N, N2, N4;
    const kiss_twiddle_scalar *trig;
-   (void) arch;
 
    N = l->n;
    trig = l->trig;
@@ -281,7 +306,7 @@ void clt_mdct_backward_c(const mdct_lookup *l, kiss_fft_scalar *in, kiss_fft_sca
       }
    }
 
-   opus_fft_impl(l->kfft[shift], (kiss_fft_cpx*)(out+(overlap>>1)));
+   opus_fft_impl(l->kfft[shift], (kiss_fft_cpx*)(out+(overlap>>1)), arch);
 
    /* Post-rotate and de-shuffle from both ends of the buffer at once to make
       it in-place. */
@@ -341,3 +366,31 @@ void clt_mdct_backward_c(const mdct_lookup *l, kiss_fft_scalar *in, kiss_fft_sca
    }
 }
 #endif /* OVERRIDE_clt_mdct_backward */
+
+void clt_mdct_forward_multi_c(const mdct_lookup *l, kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out, int C, int B, const opus_val16 *window,
+      int overlap, int shift, int arch)
+{
+   int b, c;
+   int N2;
+   N2 = (l->n>>shift)>>1;
+   for (c=0;c<C;c++)
+   {
+      for (b=0;b<B;b++)
+         clt_mdct_forward(l, in[c]+b*N2, out[c]+b, window, overlap, shift, B, arch);
+   }
+}
+
+void clt_mdct_backward_multi_c(const mdct_lookup *l, kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out, int C, int B,
+      const opus_val16 * OPUS_RESTRICT window, int overlap, int shift, int arch)
+{
+   int b, c;
+   int N2;
+   N2 = (l->n>>shift)>>1;
+   for (c=0;c<C;c++)
+   {
+      for (b=0;b<B;b++)
+         clt_mdct_backward(l, in[c]+b, out[c]+N2*b, window, overlap, shift, B, arch);
+   }
+}
@@ -57,8 +57,21 @@ typedef struct {
 #include "arm/mdct_arm.h"
 #endif
 
+#if defined(OPUS_X86_MAY_HAVE_SSE) && !defined(FIXED_POINT)
+#include "x86/mdct_sse.h"
+#endif
+
 
 int clt_mdct_init(mdct_lookup *l,int N, int maxshift, int arch);
+
+/** Initializes an MDCT whose FFT states and tables live in caller-supplied
+    storage: kfft holds maxshift+1 states, twiddles N/4 entries, bitrev the
+    sum of N/4>>i over all the shifts and trig N-(N/2>>maxshift) entries.
+    The result can only be used with the C implementations. Returns 0 if
+    one of the FFT sizes cannot be factored. */
+int clt_mdct_init_tables(mdct_lookup *l, int N, int maxshift,
+      kiss_fft_state *kfft, kiss_twiddle_cpx *twiddles, opus_int16 *bitrev,
+      kiss_twiddle_scalar *trig);
 void clt_mdct_clear(mdct_lookup *l, int arch);
 
 /** Compute a forward MDCT and scale by 4/N, trashes the input array */
@@ -74,6 +87,20 @@ void clt_mdct_backward_c(const mdct_lookup *l, kiss_fft_scalar *in,
       const opus_val16 * OPUS_RESTRICT window,
       int overlap, int shift, int stride, int arch);
 
+/** Computes the forward MDCTs of B blocks in each of C channels, as
+    clt_mdct_forward() would with stride B: block b of channel c reads
+    in[c]+b*N/2 and writes the interleaved out[c]+b. */
+void clt_mdct_forward_multi_c(const mdct_lookup *l, kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out, int C, int B, const opus_val16 *window,
+      int overlap, int shift, int arch);
+
+/** Computes the backward MDCTs of B blocks in each of C channels, as
+    clt_mdct_backward() would with stride B: block b of channel c reads the
+    interleaved in[c]+b and overlap-adds at out[c]+b*N/2, in that order. */
+void clt_mdct_backward_multi_c(const mdct_lookup *l, kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out, int C, int B,
+      const opus_val16 * OPUS_RESTRICT window, int overlap, int shift, int arch);
+
 #if !defined(OVERRIDE_OPUS_MDCT)
 /* Is run-time CPU detection enabled on this platform? */
 #if defined(OPUS_HAVE_RTCD) && defined(HAVE_ARM_NE10)
@@ -109,4 +136,12 @@ extern void (*const CLT_MDCT_BACKWARD_IMPL[OPUS_ARCHMASK+1])(
 #endif /* end if defined(OPUS_HAVE_RTCD) && defined(HAVE_ARM_NE10) && !defined(FIXED_POINT) */
 #endif /* end if !defined(OVERRIDE_OPUS_MDCT) */
 
+#if !defined(OVERRIDE_OPUS_MDCT_MULTI)
+#define clt_mdct_forward_multi(_l, _in, _out, _C, _B, _window, _overlap, _shift, _arch) \
+   clt_mdct_forward_multi_c(_l, _in, _out, _C, _B, _window, _overlap, _shift, _arch)
+
+#define clt_mdct_backward_multi(_l, _in, _out, _C, _B, _window, _overlap, _shift, _arch) \
+   clt_mdct_backward_multi_c(_l, _in, _out, _C, _B, _window, _overlap, _shift, _arch)
+#endif
+
 #endif
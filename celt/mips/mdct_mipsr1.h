@@ -73,8 +73,6 @@ void clt_mdct_forward(const mdct_lookup *l, kiss_fft_scalar *in, kiss_fft_scalar
    int scale_shift = st->scale_shift-1;
 #endif
 
-    (void)arch;
-
    SAVE_STACK;
    scale = st->scale;
 
@@ -157,7 +155,7 @@ void clt_mdct_forward(const mdct_lookup *l, kiss_fft_scalar *in, kiss_fft_scalar
    }
 
    /* N/4 complex FFT, does not downscale anymore */
-   opus_fft_impl(st, f2);
+   opus_fft_impl(st, f2, arch);
 
    /* Post-rotate */
    {
@@ -190,8 +188,6 @@ void clt_mdct_backward(const mdct_lookup *l, kiss_fft_scalar *in, kiss_fft_scala
    int N, N2, N4;
    const kiss_twiddle_scalar *trig;
 
-    (void)arch;
-
    N = l->n;
    trig = l->trig;
    for (i=0;i<shift;i++)
@@ -226,7 +222,7 @@ void clt_mdct_backward(const mdct_lookup *l, kiss_fft_scalar *in, kiss_fft_scala
       }
    }
 
-   opus_fft_impl(l->kfft[shift], (kiss_fft_cpx*)(out+(overlap>>1)));
+   opus_fft_impl(l->kfft[shift], (kiss_fft_cpx*)(out+(overlap>>1)), arch);
 
    /* Post-rotate and de-shuffle from both ends of the buffer at once to make
       it in-place. */
@@ -0,0 +1,90 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "profile_stats.h"
+
+#if defined(_WIN32)
+# define WIN32_LEAN_AND_MEAN
+# include <windows.h>
+#else
+# include <time.h>
+#endif
+
+opus_int64 opus_cpu_time_us(void)
+{
+#if defined(_WIN32)
+   /* GetThreadTimes() only advances at the scheduler tick, which is too
+      coarse for a single frame, so use elapsed time instead. */
+   LARGE_INTEGER count, freq;
+   QueryPerformanceCounter(&count);
+   QueryPerformanceFrequency(&freq);
+   return (opus_int64)((double)count.QuadPart*1e6/(double)freq.QuadPart);
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+   struct timespec ts;
+   clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+   return (opus_int64)ts.tv_sec*1000000 + ts.tv_nsec/1000;
+#elif defined(CLOCK_MONOTONIC)
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (opus_int64)ts.tv_sec*1000000 + ts.tv_nsec/1000;
+#else
+   return (opus_int64)((double)clock()*1e6/CLOCKS_PER_SEC);
+#endif
+}
+
+#ifdef ENABLE_PROFILE_STATS
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+# include <intrin.h>
+# define OPUS_PROFILE_RDTSC
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+# include <x86intrin.h>
+# define OPUS_PROFILE_RDTSC
+#endif
+
+opus_uint64 opus_profile_timestamp(void)
+{
+#if defined(OPUS_PROFILE_RDTSC)
+   return (opus_uint64)__rdtsc();
+#elif defined(_WIN32)
+   LARGE_INTEGER count, freq;
+   QueryPerformanceCounter(&count);
+   QueryPerformanceFrequency(&freq);
+   return (opus_uint64)((double)count.QuadPart*1e9/(double)freq.QuadPart);
+#elif defined(CLOCK_MONOTONIC)
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (opus_uint64)ts.tv_sec*1000000000 + (opus_uint64)ts.tv_nsec;
+#else
+   return (opus_uint64)clock()*(1000000000/CLOCKS_PER_SEC);
+#endif
+}
+
+#endif /* ENABLE_PROFILE_STATS */
@@ -0,0 +1,103 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef PROFILE_STATS_H
+#define PROFILE_STATS_H
+
+#include "opus_types.h"
+#include "opus_defines.h"
+
+/* Per-instance stage counters behind OPUS_GET_PROFILE_STATS. The state is
+   owned by the top-level encoder or decoder, and the CELT and SILK states
+   only keep a pointer to it, which is NULL when nothing is being
+   profiled. */
+typedef struct OpusProfile {
+   OpusProfileStats stats;
+   opus_uint64 start[OPUS_PROFILE_NB_STAGES];
+   int depth[OPUS_PROFILE_NB_STAGES];
+} OpusProfile;
+
+/* CPU time of the calling thread in microseconds, or elapsed time where
+   the platform does not provide a precise per-thread clock. Used by the
+   encoder's complexity governor. */
+opus_int64 opus_cpu_time_us(void);
+
+#ifdef ENABLE_PROFILE_STATS
+
+opus_uint64 opus_profile_timestamp(void);
+
+/* A stage may be re-entered (e.g. opus_encode_native() encoding the frames
+   of a multi-frame packet); only the outermost call is counted. */
+static OPUS_INLINE void opus_profile_start(OpusProfile *p, int stage)
+{
+   if (p && p->depth[stage]++ == 0)
+      p->start[stage] = opus_profile_timestamp();
+}
+
+static OPUS_INLINE void opus_profile_end(OpusProfile *p, int stage)
+{
+   if (p && --p->depth[stage] == 0)
+   {
+      p->stats.ticks[stage] += opus_profile_timestamp() - p->start[stage];
+      p->stats.calls[stage]++;
+   }
+}
+
+/* Stops the clock of a stage without counting a call. A batched decoder
+   pauses its stages while the other streams of the batch are decoded, and
+   resumes them with opus_profile_start(). */
+static OPUS_INLINE void opus_profile_pause(OpusProfile *p, int stage)
+{
+   if (p && --p->depth[stage] == 0)
+      p->stats.ticks[stage] += opus_profile_timestamp() - p->start[stage];
+}
+
+/* Charges an instance with ticks measured around work it shares with other
+   instances, such as one IMDCT call for the frames of several streams. A
+   stage that is running already measures that time itself. */
+static OPUS_INLINE void opus_profile_add(OpusProfile *p, int stage,
+      opus_uint64 ticks, int calls)
+{
+   if (p && p->depth[stage] == 0)
+   {
+      p->stats.ticks[stage] += ticks;
+      p->stats.calls[stage] += calls;
+   }
+}
+
+# define PROFILE_START(p, stage) opus_profile_start(p, stage)
+# define PROFILE_END(p, stage) opus_profile_end(p, stage)
+# define PROFILE_PAUSE(p, stage) opus_profile_pause(p, stage)
+
+#else
+
+# define PROFILE_START(p, stage) do {} while (0)
+# define PROFILE_END(p, stage) do {} while (0)
+# define PROFILE_PAUSE(p, stage) do {} while (0)
+
+#endif /* ENABLE_PROFILE_STATS */
+
+#endif /* PROFILE_STATS_H */
@@ -97,6 +97,7 @@
 #define ALLOC_STACK
 /* C99 does not allow VLAs of size zero */
 #define ALLOC_NONE 1
+#define SCRATCH_GUARD(ret, call) do { call; } while (0)
 
 #elif defined(USE_ALLOCA)
 
@@ -112,42 +113,90 @@
 #define RESTORE_STACK
 #define ALLOC_STACK
 #define ALLOC_NONE 0
+#define SCRATCH_GUARD(ret, call) do { call; } while (0)
 
 #else
 
+#include <setjmp.h>
+
+/* The pseudostack is kept per thread when the compiler supports thread-local
+   storage, so that separate states can still be used from separate threads.
+   A thread can also hand in its own arena with opus_set_scratch_buffer(). */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+# define OPUS_SCRATCH_TLS _Thread_local
+#elif defined(__GNUC__)
+# define OPUS_SCRATCH_TLS __thread
+#elif defined(_MSC_VER)
+# define OPUS_SCRATCH_TLS __declspec(thread)
+#else
+# define OPUS_SCRATCH_TLS
+#endif
+
 #ifdef CELT_C
-char *scratch_ptr=0;
-char *global_stack=0;
+OPUS_SCRATCH_TLS char *scratch_ptr=0;
+OPUS_SCRATCH_TLS char *global_stack=0;
+OPUS_SCRATCH_TLS char *global_stack_top=0;
+OPUS_SCRATCH_TLS int scratch_is_user=0;
+OPUS_SCRATCH_TLS jmp_buf *scratch_jmp=0;
 #else
-extern char *global_stack;
-extern char *scratch_ptr;
+extern OPUS_SCRATCH_TLS char *global_stack;
+extern OPUS_SCRATCH_TLS char *global_stack_top;
+extern OPUS_SCRATCH_TLS char *scratch_ptr;
+extern OPUS_SCRATCH_TLS int scratch_is_user;
+extern OPUS_SCRATCH_TLS jmp_buf *scratch_jmp;
 #endif /* CELT_C */
 
+/* Every allocation is checked against the end of the arena, whether the
+   library allocated it or the application supplied it. ALLOC() cannot
+   return an error, so running past the end jumps back to the SCRATCH_GUARD
+   of the API call, which returns OPUS_ALLOC_FAIL. Without a guard it
+   aborts. */
+#ifdef __GNUC__
+__attribute__((noreturn))
+#endif
+void opus_scratch_overflow(void);
+
+/* Runs call, a statement that assigns ret, and sets ret to OPUS_ALLOC_FAIL
+   instead if the arena overflows anywhere below it, releasing everything
+   allocated inside. Guards nest: an overflow returns from the innermost
+   one, so a caller sees the failure as an ordinary error code. */
+#define SCRATCH_GUARD(ret, call) do { \
+   jmp_buf _scratch_env; \
+   jmp_buf * volatile _scratch_prev = scratch_jmp; \
+   char * volatile _scratch_saved = global_stack; \
+   if (setjmp(_scratch_env) == 0) { \
+      scratch_jmp = &_scratch_env; \
+      call; \
+   } else { \
+      global_stack = _scratch_saved != NULL ? _scratch_saved : scratch_ptr; \
+      ret = OPUS_ALLOC_FAIL; \
+   } \
+   scratch_jmp = _scratch_prev; \
+} while (0)
+
+#define CHECK_STACK(stack) ((stack) > global_stack_top ? opus_scratch_overflow() : (void)0)
+
 #ifdef ENABLE_VALGRIND
 
 #include <valgrind/memcheck.h>
 
-#ifdef CELT_C
-char *global_stack_top=0;
-#else
-extern char *global_stack_top;
-#endif /* CELT_C */
-
+/* Each allocation is followed by a red zone of the same size, so a buffer
+   passed to opus_set_scratch_buffer() needs twice the usual size. */
 #define ALIGN(stack, size) ((stack) += ((size) - (long)(stack)) & ((size) - 1))
-#define PUSH(stack, size, type) (VALGRIND_MAKE_MEM_NOACCESS(stack, global_stack_top-stack),ALIGN((stack),sizeof(type)/sizeof(char)),VALGRIND_MAKE_MEM_UNDEFINED(stack, ((size)*sizeof(type)/sizeof(char))),(stack)+=(2*(size)*sizeof(type)/sizeof(char)),(type*)((stack)-(2*(size)*sizeof(type)/sizeof(char))))
+#define PUSH(stack, size, type) (VALGRIND_MAKE_MEM_NOACCESS(stack, global_stack_top-stack),ALIGN((stack),sizeof(type)/sizeof(char)),VALGRIND_MAKE_MEM_UNDEFINED(stack, ((size)*sizeof(type)/sizeof(char))),(stack)+=(2*(size)*sizeof(type)/sizeof(char)),CHECK_STACK(stack),(type*)((stack)-(2*(size)*sizeof(type)/sizeof(char))))
 #define RESTORE_STACK ((global_stack = _saved_stack),VALGRIND_MAKE_MEM_NOACCESS(global_stack, global_stack_top-global_stack))
-#define ALLOC_STACK char *_saved_stack; ((global_stack = (global_stack==0) ? ((global_stack_top=opus_alloc_scratch(GLOBAL_STACK_SIZE*2)+(GLOBAL_STACK_SIZE*2))-(GLOBAL_STACK_SIZE*2)) : global_stack),VALGRIND_MAKE_MEM_NOACCESS(global_stack, global_stack_top-global_stack)); _saved_stack = global_stack;
+#define ALLOC_STACK char *_saved_stack; ((global_stack = (global_stack==0) ? ((global_stack_top=(scratch_ptr=opus_alloc_scratch(GLOBAL_STACK_SIZE*2))+(GLOBAL_STACK_SIZE*2))-(GLOBAL_STACK_SIZE*2)) : global_stack),VALGRIND_MAKE_MEM_NOACCESS(global_stack, global_stack_top-global_stack)); _saved_stack = global_stack;
 
 #else
 
 #define ALIGN(stack, size) ((stack) += ((size) - (long)(stack)) & ((size) - 1))
-#define PUSH(stack, size, type) (ALIGN((stack),sizeof(type)/sizeof(char)),(stack)+=(size)*(sizeof(type)/sizeof(char)),(type*)((stack)-(size)*(sizeof(type)/sizeof(char))))
+#define PUSH(stack, size, type) (ALIGN((stack),sizeof(type)/sizeof(char)),(stack)+=(size)*(sizeof(type)/sizeof(char)),CHECK_STACK(stack),(type*)((stack)-(size)*(sizeof(type)/sizeof(char))))
 #if 0 /* Set this to 1 to instrument pseudostack usage */
 #define RESTORE_STACK (printf("%ld %s:%d\n", global_stack-scratch_ptr, __FILE__, __LINE__),global_stack = _saved_stack)
 #else
 #define RESTORE_STACK (global_stack = _saved_stack)
 #endif
-#define ALLOC_STACK char *_saved_stack; (global_stack = (global_stack==0) ? (scratch_ptr=opus_alloc_scratch(GLOBAL_STACK_SIZE)) : global_stack); _saved_stack = global_stack;
+#define ALLOC_STACK char *_saved_stack; (global_stack = (global_stack==0) ? ((global_stack_top=(scratch_ptr=opus_alloc_scratch(GLOBAL_STACK_SIZE))+GLOBAL_STACK_SIZE)-GLOBAL_STACK_SIZE) : global_stack); _saved_stack = global_stack;
 
 #endif /* ENABLE_VALGRIND */
 
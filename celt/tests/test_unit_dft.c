@@ -145,35 +145,40 @@ void test1d(int nfft,int isinverse,int arch)
 int main(int argc,char ** argv)
 {
     ALLOC_STACK;
-    int arch = opus_select_arch();
+    int arch;
+    int max_arch = opus_select_arch();
 
-    if (argc>1) {
-        int k;
-        for (k=1;k<argc;++k) {
-            test1d(atoi(argv[k]),0,arch);
-            test1d(atoi(argv[k]),1,arch);
-        }
-    }else{
-        test1d(32,0,arch);
-        test1d(32,1,arch);
-        test1d(128,0,arch);
-        test1d(128,1,arch);
-        test1d(256,0,arch);
-        test1d(256,1,arch);
+    /* Run the C version and each of the optimized ones this CPU supports. */
+    for (arch=0;arch<=max_arch;arch++)
+    {
+        if (argc>1) {
+            int k;
+            for (k=1;k<argc;++k) {
+                test1d(atoi(argv[k]),0,arch);
+                test1d(atoi(argv[k]),1,arch);
+            }
+        }else{
+            test1d(32,0,arch);
+            test1d(32,1,arch);
+            test1d(128,0,arch);
+            test1d(128,1,arch);
+            test1d(256,0,arch);
+            test1d(256,1,arch);
 #ifndef RADIX_TWO_ONLY
-        test1d(36,0,arch);
-        test1d(36,1,arch);
-        test1d(50,0,arch);
-        test1d(50,1,arch);
-        test1d(60,0,arch);
-        test1d(60,1,arch);
-        test1d(120,0,arch);
-        test1d(120,1,arch);
-        test1d(240,0,arch);
-        test1d(240,1,arch);
-        test1d(480,0,arch);
-        test1d(480,1,arch);
+            test1d(36,0,arch);
+            test1d(36,1,arch);
+            test1d(50,0,arch);
+            test1d(50,1,arch);
+            test1d(60,0,arch);
+            test1d(60,1,arch);
+            test1d(120,0,arch);
+            test1d(120,1,arch);
+            test1d(240,0,arch);
+            test1d(240,1,arch);
+            test1d(480,0,arch);
+            test1d(480,1,arch);
 #endif
+        }
     }
     return ret;
 }
@@ -182,46 +182,154 @@ void test1d(int nfft,int isinverse,int arch)
 #endif
 }
 
+/* Checks that the multi-transform entry points match one C transform per
+   block, for the interleaved block layout used by the encoder and decoder. */
+void test_multi(int nfft,int isinverse,int arch)
+{
+    int N2 = nfft/2;
+    int overlap = nfft/2;
+    int inlen, outlen;
+    kiss_fft_scalar *in, *in_copy, *out, *ref;
+    kiss_fft_scalar *x[2], *y[2];
+    opus_val16 *window;
+    int B, C, b, c, k;
+
+#ifdef CUSTOM_MODES
+    int shift = 0;
+    const mdct_lookup *cfg;
+    mdct_lookup _cfg;
+    clt_mdct_init(&_cfg, nfft, 0, arch);
+    cfg = &_cfg;
+#else
+    int shift;
+    const mdct_lookup *cfg;
+    CELTMode *mode = opus_custom_mode_create(48000, 960, NULL);
+    if (nfft == 1920) shift = 0;
+    else if (nfft == 960) shift = 1;
+    else if (nfft == 480) shift = 2;
+    else if (nfft == 240) shift = 3;
+    else return;
+    cfg = &mode->mdct;
+#endif
+
+    inlen = 2*(8*N2+overlap);
+    outlen = 2*(8*N2+overlap);
+    in = (kiss_fft_scalar*)malloc(sizeof(kiss_fft_scalar)*inlen);
+    in_copy = (kiss_fft_scalar*)malloc(sizeof(kiss_fft_scalar)*inlen);
+    out = (kiss_fft_scalar*)malloc(sizeof(kiss_fft_scalar)*outlen);
+    ref = (kiss_fft_scalar*)malloc(sizeof(kiss_fft_scalar)*outlen);
+    window = (opus_val16*)malloc(sizeof(opus_val16)*overlap);
+
+    for (k=0;k<overlap;++k)
+       window[k] = (opus_val16)(Q15ONE*sin(.5*M_PI*(k+.5)/overlap));
+
+    for (C=1;C<=2;C++)
+    {
+       for (B=1;B<=8;B*=2)
+       {
+          int len = isinverse ? B*N2 : B*N2+overlap;
+          double errpow=0, sigpow=0;
+          for (k=0;k<inlen;++k)
+             in[k] = ((rand() % 32768) - 16384)*32768/(isinverse ? nfft : 1);
+          for (k=0;k<inlen;++k)
+             in_copy[k] = in[k];
+          for (k=0;k<outlen;++k)
+             out[k] = ref[k] = k%37;
+          for (c=0;c<C;c++)
+          {
+             for (b=0;b<B;b++)
+             {
+                if (isinverse)
+                   clt_mdct_backward_c(cfg, in_copy+c*len+b, ref+c*(B*N2+overlap)+b*N2,
+                         window, overlap, shift, B, 0);
+                else
+                   clt_mdct_forward_c(cfg, in_copy+c*len+b*N2, ref+c*B*N2+b,
+                         window, overlap, shift, B, 0);
+             }
+             x[c] = in+c*len;
+             y[c] = isinverse ? out+c*(B*N2+overlap) : out+c*B*N2;
+          }
+          if (isinverse)
+             clt_mdct_backward_multi(cfg, x, y, C, B, window, overlap, shift, arch);
+          else
+             clt_mdct_forward_multi(cfg, x, y, C, B, window, overlap, shift, arch);
+          for (k=0;k<outlen;++k)
+          {
+             double d = (double)out[k] - ref[k];
+             errpow += d*d;
+             sigpow += (double)ref[k]*ref[k];
+          }
+          printf("nfft=%d inverse=%d C=%d B=%d multi, err/sig = %g\n",nfft,isinverse,C,B,errpow/sigpow);
+          if (errpow > 1e-10*sigpow) {
+             printf( "** multi-transform mismatch **\n");
+             ret = 1;
+          }
+       }
+    }
+
+    free(in);
+    free(in_copy);
+    free(out);
+    free(ref);
+    free(window);
+#ifdef CUSTOM_MODES
+    clt_mdct_clear(&_cfg, arch);
+#endif
+}
+
 int main(int argc,char ** argv)
 {
     ALLOC_STACK;
-    int arch = opus_select_arch();
+    int arch;
+    int max_arch = opus_select_arch();
 
-    if (argc>1) {
-        int k;
-        for (k=1;k<argc;++k) {
-            test1d(atoi(argv[k]),0,arch);
-            test1d(atoi(argv[k]),1,arch);
-        }
-    }else{
-        test1d(32,0,arch);
-        test1d(32,1,arch);
-        test1d(256,0,arch);
-        test1d(256,1,arch);
-        test1d(512,0,arch);
-        test1d(512,1,arch);
-        test1d(1024,0,arch);
-        test1d(1024,1,arch);
-        test1d(2048,0,arch);
-        test1d(2048,1,arch);
+    /* Run the C version and each of the optimized ones this CPU supports. */
+    for (arch=0;arch<=max_arch;arch++)
+    {
+        if (argc>1) {
+            int k;
+            for (k=1;k<argc;++k) {
+                test1d(atoi(argv[k]),0,arch);
+                test1d(atoi(argv[k]),1,arch);
+            }
+        }else{
+            test1d(32,0,arch);
+            test1d(32,1,arch);
+            test1d(256,0,arch);
+            test1d(256,1,arch);
+            test1d(512,0,arch);
+            test1d(512,1,arch);
+            test1d(1024,0,arch);
+            test1d(1024,1,arch);
+            test1d(2048,0,arch);
+            test1d(2048,1,arch);
 #ifndef RADIX_TWO_ONLY
-        test1d(36,0,arch);
-        test1d(36,1,arch);
-        test1d(40,0,arch);
-        test1d(40,1,arch);
-        test1d(60,0,arch);
-        test1d(60,1,arch);
-        test1d(120,0,arch);
-        test1d(120,1,arch);
-        test1d(240,0,arch);
-        test1d(240,1,arch);
-        test1d(480,0,arch);
-        test1d(480,1,arch);
-        test1d(960,0,arch);
-        test1d(960,1,arch);
-        test1d(1920,0,arch);
-        test1d(1920,1,arch);
+            test1d(36,0,arch);
+            test1d(36,1,arch);
+            test1d(40,0,arch);
+            test1d(40,1,arch);
+            test1d(60,0,arch);
+            test1d(60,1,arch);
+            test1d(120,0,arch);
+            test1d(120,1,arch);
+            test1d(240,0,arch);
+            test1d(240,1,arch);
+            test1d(480,0,arch);
+            test1d(480,1,arch);
+            test1d(960,0,arch);
+            test1d(960,1,arch);
+            test1d(1920,0,arch);
+            test1d(1920,1,arch);
 #endif
+            test_multi(256,0,arch);
+            test_multi(256,1,arch);
+#ifndef RADIX_TWO_ONLY
+            test_multi(240,0,arch);
+            test_multi(240,1,arch);
+            test_multi(1920,0,arch);
+            test_multi(1920,1,arch);
+#endif
+        }
     }
     return ret;
 }
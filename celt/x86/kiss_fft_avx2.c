@@ -0,0 +1,479 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "kiss_fft.h"
+#include "_kiss_fft_guts.h"
+#include "arch.h"
+#include "x86cpu.h"
+
+#if defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(FIXED_POINT)
+
+#include <immintrin.h>
+
+/* Four complex values per register. The twiddle products use FMA, so unlike
+   the SSE version the results are not bit-exact with opus_fft_impl_c(). */
+
+static OPUS_INLINE __m128 cpx_load1(const void *x)
+{
+   return _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)x);
+}
+
+/* Twiddles tw[0], tw[stride], tw[2*stride] and tw[3*stride]. */
+static OPUS_INLINE __m256 tw_load4(const kiss_twiddle_cpx *tw, size_t stride)
+{
+   __m128 lo, hi;
+   lo = _mm_loadh_pi(cpx_load1(tw), (const __m64*)(tw+stride));
+   hi = _mm_loadh_pi(cpx_load1(tw+2*stride), (const __m64*)(tw+3*stride));
+   return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+}
+
+/* The first n<4 twiddles, zero-padded. */
+static OPUS_INLINE __m256 tw_load_n(const kiss_twiddle_cpx *tw, size_t stride, int n)
+{
+   int k;
+   kiss_twiddle_cpx t[4] = {{0, 0}, {0, 0}, {0, 0}, {0, 0}};
+   for (k=0;k<n;k++)
+      t[k] = tw[k*stride];
+   return _mm256_loadu_ps(&t[0].r);
+}
+
+static OPUS_INLINE __m256 cpx_load_n(const kiss_fft_cpx *x, int n)
+{
+   int k;
+   kiss_fft_cpx t[4] = {{0, 0}, {0, 0}, {0, 0}, {0, 0}};
+   for (k=0;k<n;k++)
+      t[k] = x[k];
+   return _mm256_loadu_ps(&t[0].r);
+}
+
+static OPUS_INLINE void cpx_store_n(kiss_fft_cpx *x, __m256 v, int n)
+{
+   int k;
+   kiss_fft_cpx t[4];
+   _mm256_storeu_ps(&t[0].r, v);
+   for (k=0;k<n;k++)
+      x[k] = t[k];
+}
+
+static OPUS_INLINE __m256 cmul_avx2(__m256 a, __m256 t)
+{
+   return _mm256_fmaddsub_ps(a, _mm256_moveldup_ps(t),
+         _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1)),
+         _mm256_movehdup_ps(t)));
+}
+
+/* Multiplies by -i, (r, i) -> (i, -r). */
+static OPUS_INLINE __m256 mul_mj_avx2(__m256 x)
+{
+   return _mm256_xor_ps(_mm256_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1)),
+         _mm256_set_ps(-0.f, 0.f, -0.f, 0.f, -0.f, 0.f, -0.f, 0.f));
+}
+
+static void kf_bfly2_avx2(kiss_fft_cpx *Fout, int m, int N)
+{
+   int i;
+   if (m==1)
+   {
+      const __m256 sign = _mm256_set_ps(-0.f, -0.f, 0.f, 0.f, -0.f, -0.f, 0.f, 0.f);
+      for (i=0;i<N-1;i+=2)
+      {
+         __m256 x = _mm256_loadu_ps(&Fout->r);
+         x = _mm256_add_ps(_mm256_shuffle_ps(x, x, _MM_SHUFFLE(1, 0, 1, 0)),
+               _mm256_xor_ps(_mm256_shuffle_ps(x, x, _MM_SHUFFLE(3, 2, 3, 2)), sign));
+         _mm256_storeu_ps(&Fout->r, x);
+         Fout += 4;
+      }
+      if (i<N)
+      {
+         kiss_fft_cpx t = Fout[1];
+         C_SUB(Fout[1], Fout[0], t);
+         C_ADDTO(Fout[0], t);
+      }
+   } else {
+      const __m256 tw = _mm256_set1_ps(0.7071067812f);
+      const __m256 sign3 = _mm256_set_ps(0.f, 0.f, 0.f, 0.f, -0.f, 0.f, 0.f, 0.f);
+      celt_assert(m==4);
+      for (i=0;i<N;i++)
+      {
+         __m256 f, g, u, w, t;
+         f = _mm256_loadu_ps(&Fout[0].r);
+         g = _mm256_loadu_ps(&Fout[4].r);
+         /* t1 = ((g1.r+g1.i)*tw, (g1.i-g1.r)*tw), t2 = (g2.i, -g2.r),
+            t3 = ((g3.i-g3.r)*tw, -(g3.i+g3.r)*tw) */
+         w = mul_mj_avx2(g);
+         u = _mm256_add_ps(g, _mm256_xor_ps(_mm256_permute_ps(g, _MM_SHUFFLE(2, 3, 0, 1)), sign3));
+         u = _mm256_blend_ps(u, _mm256_sub_ps(w, g), 0xF0);
+         t = _mm256_blend_ps(_mm256_blend_ps(g, w, 0xF0), _mm256_mul_ps(u, tw), 0xCC);
+         _mm256_storeu_ps(&Fout[4].r, _mm256_sub_ps(f, t));
+         _mm256_storeu_ps(&Fout[0].r, _mm256_add_ps(f, t));
+         Fout += 8;
+      }
+   }
+}
+
+static OPUS_INLINE void bfly4_avx2(__m256 *x0, __m256 *x1, __m256 *x2, __m256 *x3,
+      __m256 tw1, __m256 tw2, __m256 tw3)
+{
+   __m256 s0, s1, s2, s3, s4, s5;
+   s0 = cmul_avx2(*x1, tw1);
+   s1 = cmul_avx2(*x2, tw2);
+   s2 = cmul_avx2(*x3, tw3);
+   s5 = _mm256_sub_ps(*x0, s1);
+   *x0 = _mm256_add_ps(*x0, s1);
+   s3 = _mm256_add_ps(s0, s2);
+   s4 = mul_mj_avx2(_mm256_sub_ps(s0, s2));
+   *x2 = _mm256_sub_ps(*x0, s3);
+   *x0 = _mm256_add_ps(*x0, s3);
+   *x1 = _mm256_add_ps(s5, s4);
+   *x3 = _mm256_sub_ps(s5, s4);
+}
+
+static void kf_bfly4_avx2(kiss_fft_cpx *Fout, const size_t fstride,
+      const kiss_fft_state *st, int m, int N, int mm)
+{
+   int i, j;
+   if (m==1)
+   {
+      /* Degenerate case where all the twiddles are 1, two butterflies at a
+         time. */
+      const __m256 sign3 = _mm256_set_ps(-0.f, 0.f, 0.f, 0.f, -0.f, 0.f, 0.f, 0.f);
+      for (i=0;i<N-1;i+=2)
+      {
+         __m256 a, b, x01, x23, sum, dif, lo, hi;
+         a = _mm256_loadu_ps(&Fout[0].r);
+         b = _mm256_loadu_ps(&Fout[4].r);
+         x01 = _mm256_permute2f128_ps(a, b, 0x20);
+         x23 = _mm256_permute2f128_ps(a, b, 0x31);
+         sum = _mm256_add_ps(x01, x23);
+         dif = _mm256_sub_ps(x01, x23);
+         /* lo = (x0+x2, x0-x2), hi = (x1+x3, -i*(x1-x3)) */
+         lo = _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(sum), _mm256_castps_pd(dif)));
+         hi = _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(sum), _mm256_castps_pd(dif)));
+         hi = _mm256_xor_ps(_mm256_permute_ps(hi, _MM_SHUFFLE(2, 3, 1, 0)), sign3);
+         a = _mm256_add_ps(lo, hi);
+         b = _mm256_sub_ps(lo, hi);
+         _mm256_storeu_ps(&Fout[0].r, _mm256_permute2f128_ps(a, b, 0x20));
+         _mm256_storeu_ps(&Fout[4].r, _mm256_permute2f128_ps(a, b, 0x31));
+         Fout += 8;
+      }
+      if (i<N)
+      {
+         const __m128 sign = _mm_set_ps(-0.f, 0.f, 0.f, 0.f);
+         __m128 x01, x23, sum, dif, lo, hi;
+         x01 = _mm_loadu_ps(&Fout[0].r);
+         x23 = _mm_loadu_ps(&Fout[2].r);
+         sum = _mm_add_ps(x01, x23);
+         dif = _mm_sub_ps(x01, x23);
+         lo = _mm_movelh_ps(sum, dif);
+         hi = _mm_movehl_ps(dif, sum);
+         hi = _mm_xor_ps(_mm_shuffle_ps(hi, hi, _MM_SHUFFLE(2, 3, 1, 0)), sign);
+         _mm_storeu_ps(&Fout[0].r, _mm_add_ps(lo, hi));
+         _mm_storeu_ps(&Fout[2].r, _mm_sub_ps(lo, hi));
+      }
+   } else {
+      const int m2=2*m;
+      const int m3=3*m;
+      const kiss_twiddle_cpx *tw = st->twiddles;
+      for (i=0;i<N;i++)
+      {
+         kiss_fft_cpx *F = Fout + i*mm;
+         for (j=0;j<m-3;j+=4)
+         {
+            __m256 x0, x1, x2, x3;
+            x0 = _mm256_loadu_ps(&F[j].r);
+            x1 = _mm256_loadu_ps(&F[j+m].r);
+            x2 = _mm256_loadu_ps(&F[j+m2].r);
+            x3 = _mm256_loadu_ps(&F[j+m3].r);
+            bfly4_avx2(&x0, &x1, &x2, &x3, tw_load4(tw+j*fstride, fstride),
+                  tw_load4(tw+2*j*fstride, 2*fstride), tw_load4(tw+3*j*fstride, 3*fstride));
+            _mm256_storeu_ps(&F[j].r, x0);
+            _mm256_storeu_ps(&F[j+m].r, x1);
+            _mm256_storeu_ps(&F[j+m2].r, x2);
+            _mm256_storeu_ps(&F[j+m3].r, x3);
+         }
+         if (j<m)
+         {
+            __m256 x0, x1, x2, x3;
+            int n = m-j;
+            x0 = cpx_load_n(&F[j], n);
+            x1 = cpx_load_n(&F[j+m], n);
+            x2 = cpx_load_n(&F[j+m2], n);
+            x3 = cpx_load_n(&F[j+m3], n);
+            bfly4_avx2(&x0, &x1, &x2, &x3, tw_load_n(tw+j*fstride, fstride, n),
+                  tw_load_n(tw+2*j*fstride, 2*fstride, n), tw_load_n(tw+3*j*fstride, 3*fstride, n));
+            cpx_store_n(&F[j], x0, n);
+            cpx_store_n(&F[j+m], x1, n);
+            cpx_store_n(&F[j+m2], x2, n);
+            cpx_store_n(&F[j+m3], x3, n);
+         }
+      }
+   }
+}
+
+static OPUS_INLINE void bfly3_avx2(__m256 *x0, __m256 *x1, __m256 *x2,
+      __m256 tw1, __m256 tw2, __m256 epi3)
+{
+   __m256 s0, s1, s2, s3, f1;
+   s1 = cmul_avx2(*x1, tw1);
+   s2 = cmul_avx2(*x2, tw2);
+   s3 = _mm256_add_ps(s1, s2);
+   s0 = _mm256_sub_ps(s1, s2);
+   f1 = _mm256_fnmadd_ps(s3, _mm256_set1_ps(.5f), *x0);
+   s0 = mul_mj_avx2(_mm256_mul_ps(s0, epi3));
+   *x0 = _mm256_add_ps(*x0, s3);
+   *x2 = _mm256_add_ps(f1, s0);
+   *x1 = _mm256_sub_ps(f1, s0);
+}
+
+static void kf_bfly3_avx2(kiss_fft_cpx *Fout, const size_t fstride,
+      const kiss_fft_state *st, int m, int N, int mm)
+{
+   int i, j;
+   const int m2=2*m;
+   const kiss_twiddle_cpx *tw = st->twiddles;
+   __m256 epi3;
+   epi3 = _mm256_set1_ps(st->twiddles[fstride*m].i);
+   for (i=0;i<N;i++)
+   {
+      kiss_fft_cpx *F = Fout + i*mm;
+      for (j=0;j<m-3;j+=4)
+      {
+         __m256 x0, x1, x2;
+         x0 = _mm256_loadu_ps(&F[j].r);
+         x1 = _mm256_loadu_ps(&F[j+m].r);
+         x2 = _mm256_loadu_ps(&F[j+m2].r);
+         bfly3_avx2(&x0, &x1, &x2, tw_load4(tw+j*fstride, fstride),
+               tw_load4(tw+2*j*fstride, 2*fstride), epi3);
+         _mm256_storeu_ps(&F[j].r, x0);
+         _mm256_storeu_ps(&F[j+m].r, x1);
+         _mm256_storeu_ps(&F[j+m2].r, x2);
+      }
+      if (j<m)
+      {
+         __m256 x0, x1, x2;
+         int n = m-j;
+         x0 = cpx_load_n(&F[j], n);
+         x1 = cpx_load_n(&F[j+m], n);
+         x2 = cpx_load_n(&F[j+m2], n);
+         bfly3_avx2(&x0, &x1, &x2, tw_load_n(tw+j*fstride, fstride, n),
+               tw_load_n(tw+2*j*fstride, 2*fstride, n), epi3);
+         cpx_store_n(&F[j], x0, n);
+         cpx_store_n(&F[j+m], x1, n);
+         cpx_store_n(&F[j+m2], x2, n);
+      }
+   }
+}
+
+static OPUS_INLINE void bfly5_avx2(__m256 *x0, __m256 *x1, __m256 *x2, __m256 *x3,
+      __m256 *x4, __m256 tw1, __m256 tw2, __m256 tw3, __m256 tw4,
+      __m256 yar, __m256 yai, __m256 ybr, __m256 ybi)
+{
+   __m256 s1, s2, s3, s4, s5, s6, s7, s8, s9, s10, s11, s12;
+   s1 = cmul_avx2(*x1, tw1);
+   s2 = cmul_avx2(*x2, tw2);
+   s3 = cmul_avx2(*x3, tw3);
+   s4 = cmul_avx2(*x4, tw4);
+   s7 = _mm256_add_ps(s1, s4);
+   s10 = _mm256_sub_ps(s1, s4);
+   s8 = _mm256_add_ps(s2, s3);
+   s9 = _mm256_sub_ps(s2, s3);
+   s5 = _mm256_add_ps(*x0, _mm256_fmadd_ps(s7, yar, _mm256_mul_ps(s8, ybr)));
+   s6 = mul_mj_avx2(_mm256_fmadd_ps(s10, yai, _mm256_mul_ps(s9, ybi)));
+   s11 = _mm256_add_ps(*x0, _mm256_fmadd_ps(s7, ybr, _mm256_mul_ps(s8, yar)));
+   s12 = mul_mj_avx2(_mm256_fmsub_ps(s9, yai, _mm256_mul_ps(s10, ybi)));
+   *x0 = _mm256_add_ps(*x0, _mm256_add_ps(s7, s8));
+   *x1 = _mm256_sub_ps(s5, s6);
+   *x4 = _mm256_add_ps(s5, s6);
+   *x2 = _mm256_add_ps(s11, s12);
+   *x3 = _mm256_sub_ps(s11, s12);
+}
+
+static void kf_bfly5_avx2(kiss_fft_cpx *Fout, const size_t fstride,
+      const kiss_fft_state *st, int m, int N, int mm)
+{
+   int i, u;
+   const kiss_twiddle_cpx *tw = st->twiddles;
+   __m256 yar, yai, ybr, ybi;
+   yar = _mm256_set1_ps(tw[fstride*m].r);
+   yai = _mm256_set1_ps(tw[fstride*m].i);
+   ybr = _mm256_set1_ps(tw[fstride*2*m].r);
+   ybi = _mm256_set1_ps(tw[fstride*2*m].i);
+   for (i=0;i<N;i++)
+   {
+      kiss_fft_cpx *F0 = Fout + i*mm;
+      kiss_fft_cpx *F1 = F0 + m;
+      kiss_fft_cpx *F2 = F0 + 2*m;
+      kiss_fft_cpx *F3 = F0 + 3*m;
+      kiss_fft_cpx *F4 = F0 + 4*m;
+      for (u=0;u<m-3;u+=4)
+      {
+         __m256 x0, x1, x2, x3, x4;
+         x0 = _mm256_loadu_ps(&F0[u].r);
+         x1 = _mm256_loadu_ps(&F1[u].r);
+         x2 = _mm256_loadu_ps(&F2[u].r);
+         x3 = _mm256_loadu_ps(&F3[u].r);
+         x4 = _mm256_loadu_ps(&F4[u].r);
+         bfly5_avx2(&x0, &x1, &x2, &x3, &x4, tw_load4(tw+u*fstride, fstride),
+               tw_load4(tw+2*u*fstride, 2*fstride), tw_load4(tw+3*u*fstride, 3*fstride),
+               tw_load4(tw+4*u*fstride, 4*fstride), yar, yai, ybr, ybi);
+         _mm256_storeu_ps(&F0[u].r, x0);
+         _mm256_storeu_ps(&F1[u].r, x1);
+         _mm256_storeu_ps(&F2[u].r, x2);
+         _mm256_storeu_ps(&F3[u].r, x3);
+         _mm256_storeu_ps(&F4[u].r, x4);
+      }
+      if (u<m)
+      {
+         __m256 x0, x1, x2, x3, x4;
+         int n = m-u;
+         x0 = cpx_load_n(&F0[u], n);
+         x1 = cpx_load_n(&F1[u], n);
+         x2 = cpx_load_n(&F2[u], n);
+         x3 = cpx_load_n(&F3[u], n);
+         x4 = cpx_load_n(&F4[u], n);
+         bfly5_avx2(&x0, &x1, &x2, &x3, &x4, tw_load_n(tw+u*fstride, fstride, n),
+               tw_load_n(tw+2*u*fstride, 2*fstride, n), tw_load_n(tw+3*u*fstride, 3*fstride, n),
+               tw_load_n(tw+4*u*fstride, 4*fstride, n), yar, yai, ybr, ybi);
+         cpx_store_n(&F0[u], x0, n);
+         cpx_store_n(&F1[u], x1, n);
+         cpx_store_n(&F2[u], x2, n);
+         cpx_store_n(&F3[u], x3, n);
+         cpx_store_n(&F4[u], x4, n);
+      }
+   }
+}
+
+void opus_fft_impl_avx2(const kiss_fft_state *st, kiss_fft_cpx *fout)
+{
+   int m2, m;
+   int p;
+   int L;
+   int fstride[MAXFACTORS];
+   int i;
+   int shift;
+
+   /* st->shift can be -1 */
+   shift = st->shift>0 ? st->shift : 0;
+
+   fstride[0] = 1;
+   L=0;
+   do {
+      p = st->factors[2*L];
+      m = st->factors[2*L+1];
+      fstride[L+1] = fstride[L]*p;
+      L++;
+   } while(m!=1);
+   m = st->factors[2*L-1];
+   for (i=L-1;i>=0;i--)
+   {
+      if (i!=0)
+         m2 = st->factors[2*i-1];
+      else
+         m2 = 1;
+      switch (st->factors[2*i])
+      {
+      case 2:
+         kf_bfly2_avx2(fout, m, fstride[i]);
+         break;
+      case 4:
+         kf_bfly4_avx2(fout, fstride[i]<<shift, st, m, fstride[i], m2);
+         break;
+      case 3:
+         kf_bfly3_avx2(fout, fstride[i]<<shift, st, m, fstride[i], m2);
+         break;
+      case 5:
+         kf_bfly5_avx2(fout, fstride[i]<<shift, st, m, fstride[i], m2);
+         break;
+      }
+      m = m2;
+   }
+}
+
+void opus_fft_avx2(const kiss_fft_state *st, const kiss_fft_cpx *fin,
+      kiss_fft_cpx *fout)
+{
+   int i;
+   __m256 scale;
+   celt_assert2(fin != fout, "In-place FFT not supported");
+   scale = _mm256_set1_ps(st->scale);
+   /* Bit-reverse the input */
+   for (i=0;i<st->nfft-3;i+=4)
+   {
+      __m256 x;
+      __m128 lo, hi;
+      x = _mm256_mul_ps(_mm256_loadu_ps(&fin[i].r), scale);
+      lo = _mm256_castps256_ps128(x);
+      hi = _mm256_extractf128_ps(x, 1);
+      _mm_storel_pi((__m64*)&fout[st->bitrev[i]], lo);
+      _mm_storeh_pi((__m64*)&fout[st->bitrev[i+1]], lo);
+      _mm_storel_pi((__m64*)&fout[st->bitrev[i+2]], hi);
+      _mm_storeh_pi((__m64*)&fout[st->bitrev[i+3]], hi);
+   }
+   for (;i<st->nfft;i++)
+   {
+      fout[st->bitrev[i]].r = st->scale*fin[i].r;
+      fout[st->bitrev[i]].i = st->scale*fin[i].i;
+   }
+   opus_fft_impl_avx2(st, fout);
+}
+
+void opus_ifft_avx2(const kiss_fft_state *st, const kiss_fft_cpx *fin,
+      kiss_fft_cpx *fout)
+{
+   int i;
+   const __m256 sign = _mm256_set_ps(-0.f, 0.f, -0.f, 0.f, -0.f, 0.f, -0.f, 0.f);
+   celt_assert2(fin != fout, "In-place FFT not supported");
+   /* Bit-reverse and conjugate the input */
+   for (i=0;i<st->nfft-3;i+=4)
+   {
+      __m256 x;
+      __m128 lo, hi;
+      x = _mm256_xor_ps(_mm256_loadu_ps(&fin[i].r), sign);
+      lo = _mm256_castps256_ps128(x);
+      hi = _mm256_extractf128_ps(x, 1);
+      _mm_storel_pi((__m64*)&fout[st->bitrev[i]], lo);
+      _mm_storeh_pi((__m64*)&fout[st->bitrev[i+1]], lo);
+      _mm_storel_pi((__m64*)&fout[st->bitrev[i+2]], hi);
+      _mm_storeh_pi((__m64*)&fout[st->bitrev[i+3]], hi);
+   }
+   for (;i<st->nfft;i++)
+   {
+      fout[st->bitrev[i]].r = fin[i].r;
+      fout[st->bitrev[i]].i = -fin[i].i;
+   }
+   opus_fft_impl_avx2(st, fout);
+   for (i=0;i<st->nfft-3;i+=4)
+      _mm256_storeu_ps(&fout[i].r, _mm256_xor_ps(_mm256_loadu_ps(&fout[i].r), sign));
+   for (;i<st->nfft;i++)
+      fout[i].i = -fout[i].i;
+}
+
+#endif
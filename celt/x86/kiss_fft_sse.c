@@ -0,0 +1,408 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "kiss_fft.h"
+#include "arch.h"
+#include "x86cpu.h"
+
+#if defined(OPUS_X86_MAY_HAVE_SSE) && !defined(FIXED_POINT)
+
+#include <xmmintrin.h>
+
+/* Two complex values per register. The products and sums are the same as in
+   kiss_fft.c, so the results are bit-exact with opus_fft_impl_c(). */
+
+static OPUS_INLINE __m128 cpx_load1(const void *x)
+{
+   return _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)x);
+}
+
+/* Twiddles tw[0] and tw[stride]. */
+static OPUS_INLINE __m128 tw_load2(const kiss_twiddle_cpx *tw, size_t stride)
+{
+   return _mm_loadh_pi(cpx_load1(tw), (const __m64*)(tw+stride));
+}
+
+static OPUS_INLINE __m128 cmul_sse(__m128 a, __m128 t)
+{
+   __m128 tr, ti, as;
+   tr = _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 0, 0));
+   ti = _mm_shuffle_ps(t, t, _MM_SHUFFLE(3, 3, 1, 1));
+   as = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+   return _mm_add_ps(_mm_mul_ps(a, tr),
+         _mm_xor_ps(_mm_mul_ps(as, ti), _mm_set_ps(0.f, -0.f, 0.f, -0.f)));
+}
+
+/* Multiplies by -i, (r, i) -> (i, -r). */
+static OPUS_INLINE __m128 mul_mj_sse(__m128 x)
+{
+   return _mm_xor_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1)),
+         _mm_set_ps(-0.f, 0.f, -0.f, 0.f));
+}
+
+static void kf_bfly2_sse(kiss_fft_cpx *Fout, int m, int N)
+{
+   int i;
+   if (m==1)
+   {
+      const __m128 sign = _mm_set_ps(-0.f, -0.f, 0.f, 0.f);
+      for (i=0;i<N;i++)
+      {
+         __m128 x = _mm_loadu_ps(&Fout->r);
+         x = _mm_add_ps(_mm_movelh_ps(x, x), _mm_xor_ps(_mm_movehl_ps(x, x), sign));
+         _mm_storeu_ps(&Fout->r, x);
+         Fout += 2;
+      }
+   } else {
+      const __m128 tw = _mm_set1_ps(0.7071067812f);
+      const __m128 sign3 = _mm_set_ps(-0.f, 0.f, 0.f, 0.f);
+      celt_assert(m==4);
+      for (i=0;i<N;i++)
+      {
+         __m128 f01, f23, g01, g23, t01, t23, u, w;
+         f01 = _mm_loadu_ps(&Fout[0].r);
+         f23 = _mm_loadu_ps(&Fout[2].r);
+         g01 = _mm_loadu_ps(&Fout[4].r);
+         g23 = _mm_loadu_ps(&Fout[6].r);
+         /* t1 = ((g1.r+g1.i)*tw, (g1.i-g1.r)*tw) */
+         u = _mm_add_ps(g01, _mm_xor_ps(_mm_shuffle_ps(g01, g01, _MM_SHUFFLE(2, 3, 0, 1)), sign3));
+         t01 = _mm_shuffle_ps(g01, _mm_mul_ps(u, tw), _MM_SHUFFLE(3, 2, 1, 0));
+         /* t2 = (g2.i, -g2.r), t3 = ((g3.i-g3.r)*tw, -(g3.i+g3.r)*tw) */
+         w = mul_mj_sse(g23);
+         u = _mm_sub_ps(w, g23);
+         t23 = _mm_shuffle_ps(w, _mm_mul_ps(u, tw), _MM_SHUFFLE(3, 2, 1, 0));
+         _mm_storeu_ps(&Fout[4].r, _mm_sub_ps(f01, t01));
+         _mm_storeu_ps(&Fout[6].r, _mm_sub_ps(f23, t23));
+         _mm_storeu_ps(&Fout[0].r, _mm_add_ps(f01, t01));
+         _mm_storeu_ps(&Fout[2].r, _mm_add_ps(f23, t23));
+         Fout += 8;
+      }
+   }
+}
+
+static OPUS_INLINE void bfly4_sse(__m128 *x0, __m128 *x1, __m128 *x2, __m128 *x3,
+      __m128 tw1, __m128 tw2, __m128 tw3)
+{
+   __m128 s0, s1, s2, s3, s4, s5;
+   s0 = cmul_sse(*x1, tw1);
+   s1 = cmul_sse(*x2, tw2);
+   s2 = cmul_sse(*x3, tw3);
+   s5 = _mm_sub_ps(*x0, s1);
+   *x0 = _mm_add_ps(*x0, s1);
+   s3 = _mm_add_ps(s0, s2);
+   s4 = mul_mj_sse(_mm_sub_ps(s0, s2));
+   *x2 = _mm_sub_ps(*x0, s3);
+   *x0 = _mm_add_ps(*x0, s3);
+   *x1 = _mm_add_ps(s5, s4);
+   *x3 = _mm_sub_ps(s5, s4);
+}
+
+static void kf_bfly4_sse(kiss_fft_cpx *Fout, const size_t fstride,
+      const kiss_fft_state *st, int m, int N, int mm)
+{
+   int i, j;
+   if (m==1)
+   {
+      /* Degenerate case where all the twiddles are 1. */
+      const __m128 sign3 = _mm_set_ps(-0.f, 0.f, 0.f, 0.f);
+      for (i=0;i<N;i++)
+      {
+         __m128 x01, x23, sum, dif, lo, hi;
+         x01 = _mm_loadu_ps(&Fout[0].r);
+         x23 = _mm_loadu_ps(&Fout[2].r);
+         sum = _mm_add_ps(x01, x23);
+         dif = _mm_sub_ps(x01, x23);
+         /* lo = (x0+x2, x0-x2), hi = (x1+x3, -i*(x1-x3)) */
+         lo = _mm_movelh_ps(sum, dif);
+         hi = _mm_movehl_ps(dif, sum);
+         hi = _mm_xor_ps(_mm_shuffle_ps(hi, hi, _MM_SHUFFLE(2, 3, 1, 0)), sign3);
+         _mm_storeu_ps(&Fout[0].r, _mm_add_ps(lo, hi));
+         _mm_storeu_ps(&Fout[2].r, _mm_sub_ps(lo, hi));
+         Fout += 4;
+      }
+   } else {
+      const int m2=2*m;
+      const int m3=3*m;
+      const kiss_twiddle_cpx *tw = st->twiddles;
+      for (i=0;i<N;i++)
+      {
+         kiss_fft_cpx *F = Fout + i*mm;
+         for (j=0;j<m-1;j+=2)
+         {
+            __m128 x0, x1, x2, x3;
+            x0 = _mm_loadu_ps(&F[j].r);
+            x1 = _mm_loadu_ps(&F[j+m].r);
+            x2 = _mm_loadu_ps(&F[j+m2].r);
+            x3 = _mm_loadu_ps(&F[j+m3].r);
+            bfly4_sse(&x0, &x1, &x2, &x3, tw_load2(tw+j*fstride, fstride),
+                  tw_load2(tw+2*j*fstride, 2*fstride), tw_load2(tw+3*j*fstride, 3*fstride));
+            _mm_storeu_ps(&F[j].r, x0);
+            _mm_storeu_ps(&F[j+m].r, x1);
+            _mm_storeu_ps(&F[j+m2].r, x2);
+            _mm_storeu_ps(&F[j+m3].r, x3);
+         }
+         if (j<m)
+         {
+            __m128 x0, x1, x2, x3;
+            x0 = cpx_load1(&F[j]);
+            x1 = cpx_load1(&F[j+m]);
+            x2 = cpx_load1(&F[j+m2]);
+            x3 = cpx_load1(&F[j+m3]);
+            bfly4_sse(&x0, &x1, &x2, &x3, cpx_load1(tw+j*fstride),
+                  cpx_load1(tw+2*j*fstride), cpx_load1(tw+3*j*fstride));
+            _mm_storel_pi((__m64*)&F[j], x0);
+            _mm_storel_pi((__m64*)&F[j+m], x1);
+            _mm_storel_pi((__m64*)&F[j+m2], x2);
+            _mm_storel_pi((__m64*)&F[j+m3], x3);
+         }
+      }
+   }
+}
+
+static OPUS_INLINE void bfly3_sse(__m128 *x0, __m128 *x1, __m128 *x2,
+      __m128 tw1, __m128 tw2, __m128 epi3)
+{
+   __m128 s0, s1, s2, s3, f1;
+   s1 = cmul_sse(*x1, tw1);
+   s2 = cmul_sse(*x2, tw2);
+   s3 = _mm_add_ps(s1, s2);
+   s0 = _mm_sub_ps(s1, s2);
+   f1 = _mm_sub_ps(*x0, _mm_mul_ps(s3, _mm_set1_ps(.5f)));
+   s0 = mul_mj_sse(_mm_mul_ps(s0, epi3));
+   *x0 = _mm_add_ps(*x0, s3);
+   *x2 = _mm_add_ps(f1, s0);
+   *x1 = _mm_sub_ps(f1, s0);
+}
+
+static void kf_bfly3_sse(kiss_fft_cpx *Fout, const size_t fstride,
+      const kiss_fft_state *st, int m, int N, int mm)
+{
+   int i, j;
+   const int m2=2*m;
+   const kiss_twiddle_cpx *tw = st->twiddles;
+   __m128 epi3;
+   epi3 = _mm_set1_ps(st->twiddles[fstride*m].i);
+   for (i=0;i<N;i++)
+   {
+      kiss_fft_cpx *F = Fout + i*mm;
+      for (j=0;j<m-1;j+=2)
+      {
+         __m128 x0, x1, x2;
+         x0 = _mm_loadu_ps(&F[j].r);
+         x1 = _mm_loadu_ps(&F[j+m].r);
+         x2 = _mm_loadu_ps(&F[j+m2].r);
+         bfly3_sse(&x0, &x1, &x2, tw_load2(tw+j*fstride, fstride),
+               tw_load2(tw+2*j*fstride, 2*fstride), epi3);
+         _mm_storeu_ps(&F[j].r, x0);
+         _mm_storeu_ps(&F[j+m].r, x1);
+         _mm_storeu_ps(&F[j+m2].r, x2);
+      }
+      if (j<m)
+      {
+         __m128 x0, x1, x2;
+         x0 = cpx_load1(&F[j]);
+         x1 = cpx_load1(&F[j+m]);
+         x2 = cpx_load1(&F[j+m2]);
+         bfly3_sse(&x0, &x1, &x2, cpx_load1(tw+j*fstride),
+               cpx_load1(tw+2*j*fstride), epi3);
+         _mm_storel_pi((__m64*)&F[j], x0);
+         _mm_storel_pi((__m64*)&F[j+m], x1);
+         _mm_storel_pi((__m64*)&F[j+m2], x2);
+      }
+   }
+}
+
+static OPUS_INLINE void bfly5_sse(__m128 *x0, __m128 *x1, __m128 *x2, __m128 *x3,
+      __m128 *x4, __m128 tw1, __m128 tw2, __m128 tw3, __m128 tw4,
+      __m128 yar, __m128 yai, __m128 ybr, __m128 ybi)
+{
+   __m128 s1, s2, s3, s4, s5, s6, s7, s8, s9, s10, s11, s12;
+   s1 = cmul_sse(*x1, tw1);
+   s2 = cmul_sse(*x2, tw2);
+   s3 = cmul_sse(*x3, tw3);
+   s4 = cmul_sse(*x4, tw4);
+   s7 = _mm_add_ps(s1, s4);
+   s10 = _mm_sub_ps(s1, s4);
+   s8 = _mm_add_ps(s2, s3);
+   s9 = _mm_sub_ps(s2, s3);
+   s5 = _mm_add_ps(*x0, _mm_add_ps(_mm_mul_ps(s7, yar), _mm_mul_ps(s8, ybr)));
+   s6 = mul_mj_sse(_mm_add_ps(_mm_mul_ps(s10, yai), _mm_mul_ps(s9, ybi)));
+   s11 = _mm_add_ps(*x0, _mm_add_ps(_mm_mul_ps(s7, ybr), _mm_mul_ps(s8, yar)));
+   s12 = mul_mj_sse(_mm_sub_ps(_mm_mul_ps(s9, yai), _mm_mul_ps(s10, ybi)));
+   *x0 = _mm_add_ps(*x0, _mm_add_ps(s7, s8));
+   *x1 = _mm_sub_ps(s5, s6);
+   *x4 = _mm_add_ps(s5, s6);
+   *x2 = _mm_add_ps(s11, s12);
+   *x3 = _mm_sub_ps(s11, s12);
+}
+
+static void kf_bfly5_sse(kiss_fft_cpx *Fout, const size_t fstride,
+      const kiss_fft_state *st, int m, int N, int mm)
+{
+   int i, u;
+   const kiss_twiddle_cpx *tw = st->twiddles;
+   __m128 yar, yai, ybr, ybi;
+   yar = _mm_set1_ps(tw[fstride*m].r);
+   yai = _mm_set1_ps(tw[fstride*m].i);
+   ybr = _mm_set1_ps(tw[fstride*2*m].r);
+   ybi = _mm_set1_ps(tw[fstride*2*m].i);
+   for (i=0;i<N;i++)
+   {
+      kiss_fft_cpx *F0 = Fout + i*mm;
+      kiss_fft_cpx *F1 = F0 + m;
+      kiss_fft_cpx *F2 = F0 + 2*m;
+      kiss_fft_cpx *F3 = F0 + 3*m;
+      kiss_fft_cpx *F4 = F0 + 4*m;
+      for (u=0;u<m-1;u+=2)
+      {
+         __m128 x0, x1, x2, x3, x4;
+         x0 = _mm_loadu_ps(&F0[u].r);
+         x1 = _mm_loadu_ps(&F1[u].r);
+         x2 = _mm_loadu_ps(&F2[u].r);
+         x3 = _mm_loadu_ps(&F3[u].r);
+         x4 = _mm_loadu_ps(&F4[u].r);
+         bfly5_sse(&x0, &x1, &x2, &x3, &x4, tw_load2(tw+u*fstride, fstride),
+               tw_load2(tw+2*u*fstride, 2*fstride), tw_load2(tw+3*u*fstride, 3*fstride),
+               tw_load2(tw+4*u*fstride, 4*fstride), yar, yai, ybr, ybi);
+         _mm_storeu_ps(&F0[u].r, x0);
+         _mm_storeu_ps(&F1[u].r, x1);
+         _mm_storeu_ps(&F2[u].r, x2);
+         _mm_storeu_ps(&F3[u].r, x3);
+         _mm_storeu_ps(&F4[u].r, x4);
+      }
+      if (u<m)
+      {
+         __m128 x0, x1, x2, x3, x4;
+         x0 = cpx_load1(&F0[u]);
+         x1 = cpx_load1(&F1[u]);
+         x2 = cpx_load1(&F2[u]);
+         x3 = cpx_load1(&F3[u]);
+         x4 = cpx_load1(&F4[u]);
+         bfly5_sse(&x0, &x1, &x2, &x3, &x4, cpx_load1(tw+u*fstride),
+               cpx_load1(tw+2*u*fstride), cpx_load1(tw+3*u*fstride),
+               cpx_load1(tw+4*u*fstride), yar, yai, ybr, ybi);
+         _mm_storel_pi((__m64*)&F0[u], x0);
+         _mm_storel_pi((__m64*)&F1[u], x1);
+         _mm_storel_pi((__m64*)&F2[u], x2);
+         _mm_storel_pi((__m64*)&F3[u], x3);
+         _mm_storel_pi((__m64*)&F4[u], x4);
+      }
+   }
+}
+
+void opus_fft_impl_sse(const kiss_fft_state *st, kiss_fft_cpx *fout)
+{
+   int m2, m;
+   int p;
+   int L;
+   int fstride[MAXFACTORS];
+   int i;
+   int shift;
+
+   /* st->shift can be -1 */
+   shift = st->shift>0 ? st->shift : 0;
+
+   fstride[0] = 1;
+   L=0;
+   do {
+      p = st->factors[2*L];
+      m = st->factors[2*L+1];
+      fstride[L+1] = fstride[L]*p;
+      L++;
+   } while(m!=1);
+   m = st->factors[2*L-1];
+   for (i=L-1;i>=0;i--)
+   {
+      if (i!=0)
+         m2 = st->factors[2*i-1];
+      else
+         m2 = 1;
+      switch (st->factors[2*i])
+      {
+      case 2:
+         kf_bfly2_sse(fout, m, fstride[i]);
+         break;
+      case 4:
+         kf_bfly4_sse(fout, fstride[i]<<shift, st, m, fstride[i], m2);
+         break;
+      case 3:
+         kf_bfly3_sse(fout, fstride[i]<<shift, st, m, fstride[i], m2);
+         break;
+      case 5:
+         kf_bfly5_sse(fout, fstride[i]<<shift, st, m, fstride[i], m2);
+         break;
+      }
+      m = m2;
+   }
+}
+
+void opus_fft_sse(const kiss_fft_state *st, const kiss_fft_cpx *fin,
+      kiss_fft_cpx *fout)
+{
+   int i;
+   __m128 scale;
+   celt_assert2(fin != fout, "In-place FFT not supported");
+   scale = _mm_set1_ps(st->scale);
+   /* Bit-reverse the input */
+   for (i=0;i<st->nfft-1;i+=2)
+   {
+      __m128 x = _mm_mul_ps(_mm_loadu_ps(&fin[i].r), scale);
+      _mm_storel_pi((__m64*)&fout[st->bitrev[i]], x);
+      _mm_storeh_pi((__m64*)&fout[st->bitrev[i+1]], x);
+   }
+   if (i<st->nfft)
+      _mm_storel_pi((__m64*)&fout[st->bitrev[i]], _mm_mul_ps(cpx_load1(&fin[i]), scale));
+   opus_fft_impl_sse(st, fout);
+}
+
+void opus_ifft_sse(const kiss_fft_state *st, const kiss_fft_cpx *fin,
+      kiss_fft_cpx *fout)
+{
+   int i;
+   const __m128 sign = _mm_set_ps(-0.f, 0.f, -0.f, 0.f);
+   celt_assert2(fin != fout, "In-place FFT not supported");
+   /* Bit-reverse and conjugate the input */
+   for (i=0;i<st->nfft-1;i+=2)
+   {
+      __m128 x = _mm_xor_ps(_mm_loadu_ps(&fin[i].r), sign);
+      _mm_storel_pi((__m64*)&fout[st->bitrev[i]], x);
+      _mm_storeh_pi((__m64*)&fout[st->bitrev[i+1]], x);
+   }
+   if (i<st->nfft)
+      _mm_storel_pi((__m64*)&fout[st->bitrev[i]], _mm_xor_ps(cpx_load1(&fin[i]), sign));
+   opus_fft_impl_sse(st, fout);
+   for (i=0;i<st->nfft-1;i+=2)
+      _mm_storeu_ps(&fout[i].r, _mm_xor_ps(_mm_loadu_ps(&fout[i].r), sign));
+   if (i<st->nfft)
+      fout[i].i = -fout[i].i;
+}
+
+#endif
@@ -0,0 +1,95 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef KISS_FFT_SSE_H
+#define KISS_FFT_SSE_H
+
+#if defined(OPUS_X86_MAY_HAVE_SSE) && !defined(FIXED_POINT)
+#define OVERRIDE_OPUS_FFT
+#define OVERRIDE_OPUS_FFT_IMPL
+
+/* The butterflies read the twiddles of the shared table in place, so there
+   is no architecture-specific state to set up. */
+#define opus_fft_alloc_arch(_st, arch) \
+         ((void)(arch), opus_fft_alloc_arch_c(_st))
+
+#define opus_fft_free_arch(_st, arch) \
+         ((void)(arch), opus_fft_free_arch_c(_st))
+
+void opus_fft_impl_sse(const kiss_fft_state *st, kiss_fft_cpx *fout);
+void opus_fft_sse(const kiss_fft_state *st, const kiss_fft_cpx *fin,
+      kiss_fft_cpx *fout);
+void opus_ifft_sse(const kiss_fft_state *st, const kiss_fft_cpx *fin,
+      kiss_fft_cpx *fout);
+
+#if defined(OPUS_X86_MAY_HAVE_AVX2)
+void opus_fft_impl_avx2(const kiss_fft_state *st, kiss_fft_cpx *fout);
+void opus_fft_avx2(const kiss_fft_state *st, const kiss_fft_cpx *fin,
+      kiss_fft_cpx *fout);
+void opus_ifft_avx2(const kiss_fft_state *st, const kiss_fft_cpx *fin,
+      kiss_fft_cpx *fout);
+#endif
+
+#if defined(OPUS_X86_PRESUME_AVX2)
+
+#define opus_fft_impl(_st, _fout, arch) \
+         ((void)(arch), opus_fft_impl_avx2(_st, _fout))
+#define opus_fft(_cfg, _fin, _fout, arch) \
+         ((void)(arch), opus_fft_avx2(_cfg, _fin, _fout))
+#define opus_ifft(_cfg, _fin, _fout, arch) \
+         ((void)(arch), opus_ifft_avx2(_cfg, _fin, _fout))
+
+#elif defined(OPUS_X86_PRESUME_SSE) && !defined(OPUS_X86_MAY_HAVE_AVX2)
+
+#define opus_fft_impl(_st, _fout, arch) \
+         ((void)(arch), opus_fft_impl_sse(_st, _fout))
+#define opus_fft(_cfg, _fin, _fout, arch) \
+         ((void)(arch), opus_fft_sse(_cfg, _fin, _fout))
+#define opus_ifft(_cfg, _fin, _fout, arch) \
+         ((void)(arch), opus_ifft_sse(_cfg, _fin, _fout))
+
+#else
+
+extern void (*const OPUS_FFT_IMPL[OPUS_ARCHMASK + 1])(
+      const kiss_fft_state *st, kiss_fft_cpx *fout);
+#define opus_fft_impl(_st, _fout, arch) \
+         ((*OPUS_FFT_IMPL[(arch) & OPUS_ARCHMASK])(_st, _fout))
+
+extern void (*const OPUS_FFT[OPUS_ARCHMASK + 1])(const kiss_fft_state *cfg,
+      const kiss_fft_cpx *fin, kiss_fft_cpx *fout);
+#define opus_fft(_cfg, _fin, _fout, arch) \
+         ((*OPUS_FFT[(arch) & OPUS_ARCHMASK])(_cfg, _fin, _fout))
+
+extern void (*const OPUS_IFFT[OPUS_ARCHMASK + 1])(const kiss_fft_state *cfg,
+      const kiss_fft_cpx *fin, kiss_fft_cpx *fout);
+#define opus_ifft(_cfg, _fin, _fout, arch) \
+         ((*OPUS_IFFT[(arch) & OPUS_ARCHMASK])(_cfg, _fin, _fout))
+
+#endif
+#endif
+
+#endif
@@ -0,0 +1,1025 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "mdct.h"
+#include "kiss_fft.h"
+#include "stack_alloc.h"
+#include "x86cpu.h"
+
+#if defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(FIXED_POINT)
+
+#include <immintrin.h>
+
+/* Eight points at a time, laid out as in clt_mdct_forward_sse(). The
+   products use FMA, so the results are not bit-exact with the C code. */
+
+/* p[0], p[2], ..., p[14]. */
+static OPUS_INLINE __m256 load_even8(const float *p)
+{
+   __m256 x;
+   x = _mm256_shuffle_ps(_mm256_loadu_ps(p), _mm256_loadu_ps(p+7), _MM_SHUFFLE(3, 1, 2, 0));
+   return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(x), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+static OPUS_INLINE __m256 reverse8(__m256 x)
+{
+   return _mm256_permutevar8x32_ps(x, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+/* p[0], p[-2], ..., p[-14]. */
+static OPUS_INLINE __m256 load_rev_even8(const float *p)
+{
+   return reverse8(load_even8(p-14));
+}
+
+static OPUS_INLINE __m256 load_strided8(const float *p, int stride)
+{
+   return _mm256_setr_ps(p[0], p[stride], p[2*stride], p[3*stride],
+         p[4*stride], p[5*stride], p[6*stride], p[7*stride]);
+}
+
+/* Splits the complex values x[0..7] into their real and imaginary parts. */
+static OPUS_INLINE void deinterleave8(const kiss_fft_cpx *x, __m256 *re, __m256 *im)
+{
+   __m256 a, b;
+   a = _mm256_loadu_ps(&x[0].r);
+   b = _mm256_loadu_ps(&x[4].r);
+   *re = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(
+         _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0)));
+   *im = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(
+         _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+/* Stores the complex values (re[k], im[k]) at dst[rev[k]]. */
+static OPUS_INLINE void store_bitrev8(kiss_fft_cpx *dst, const opus_int16 *rev,
+      __m256 re, __m256 im)
+{
+   __m256 lo, hi;
+   __m128 x;
+   lo = _mm256_unpacklo_ps(re, im);
+   hi = _mm256_unpackhi_ps(re, im);
+   x = _mm256_castps256_ps128(lo);
+   _mm_storel_pi((__m64*)&dst[rev[0]], x);
+   _mm_storeh_pi((__m64*)&dst[rev[1]], x);
+   x = _mm256_castps256_ps128(hi);
+   _mm_storel_pi((__m64*)&dst[rev[2]], x);
+   _mm_storeh_pi((__m64*)&dst[rev[3]], x);
+   x = _mm256_extractf128_ps(lo, 1);
+   _mm_storel_pi((__m64*)&dst[rev[4]], x);
+   _mm_storeh_pi((__m64*)&dst[rev[5]], x);
+   x = _mm256_extractf128_ps(hi, 1);
+   _mm_storel_pi((__m64*)&dst[rev[6]], x);
+   _mm_storeh_pi((__m64*)&dst[rev[7]], x);
+}
+
+/* Writes y[2*k*stride] = a[k] and y[(N2-1-2*k)*stride] = b[k]. */
+static void interleave_avx2(const float *a, const float *b, float *y, int N4,
+      int stride)
+{
+   int k;
+   if (stride==1)
+   {
+      for (k=0;k<N4-7;k+=8)
+      {
+         __m256 x0, x1, lo, hi;
+         x0 = _mm256_loadu_ps(a+k);
+         x1 = reverse8(_mm256_loadu_ps(b+N4-8-k));
+         lo = _mm256_unpacklo_ps(x0, x1);
+         hi = _mm256_unpackhi_ps(x0, x1);
+         _mm256_storeu_ps(y+2*k, _mm256_permute2f128_ps(lo, hi, 0x20));
+         _mm256_storeu_ps(y+2*k+8, _mm256_permute2f128_ps(lo, hi, 0x31));
+      }
+      for (;k<N4;k++)
+      {
+         y[2*k] = a[k];
+         y[2*k+1] = b[N4-1-k];
+      }
+   } else {
+      float *y2 = y+stride*(2*N4-1);
+      for (k=0;k<N4;k++)
+      {
+         y[2*k*stride] = a[k];
+         y2[-2*k*stride] = b[k];
+      }
+   }
+}
+
+/* Windows, shuffles and folds the input of a forward MDCT, as fold_sse(). */
+static void fold_avx2(const float *in, const opus_val16 *window, int overlap,
+      int N2, int N4, float *fr, float *fi)
+{
+   int i, j;
+   int K;
+   const float *xp1 = in+(overlap>>1);
+   const float *xp2 = in+N2-1+(overlap>>1);
+   const float *wp1 = window+(overlap>>1);
+   const float *wp2 = window+(overlap>>1)-1;
+   K = (overlap+3)>>2;
+   for (i=0;i<K-7;i+=8)
+   {
+      __m256 w1, w2;
+      w1 = load_even8(wp1+2*i);
+      w2 = load_rev_even8(wp2-2*i);
+      _mm256_storeu_ps(fr+i, _mm256_fmadd_ps(w2, load_even8(xp1+N2+2*i),
+            _mm256_mul_ps(w1, load_rev_even8(xp2-2*i))));
+      _mm256_storeu_ps(fi+i, _mm256_fmsub_ps(w1, load_even8(xp1+2*i),
+            _mm256_mul_ps(w2, load_rev_even8(xp2-N2-2*i))));
+   }
+   for (;i<K;i++)
+   {
+      fr[i] = wp2[-2*i]*xp1[N2+2*i] + wp1[2*i]*xp2[-2*i];
+      fi[i] = wp1[2*i]*xp1[2*i] - wp2[-2*i]*xp2[-N2-2*i];
+   }
+   for (;i<N4-K-7;i+=8)
+   {
+      _mm256_storeu_ps(fr+i, load_rev_even8(xp2-2*i));
+      _mm256_storeu_ps(fi+i, load_even8(xp1+2*i));
+   }
+   for (;i<N4-K;i++)
+   {
+      fr[i] = xp2[-2*i];
+      fi[i] = xp1[2*i];
+   }
+   /* The window restarts where this loop does. */
+   wp1 = window;
+   wp2 = window+overlap-1;
+   for (j=0;i<N4-7;i+=8,j+=16)
+   {
+      __m256 w1, w2;
+      w1 = load_even8(wp1+j);
+      w2 = load_rev_even8(wp2-j);
+      _mm256_storeu_ps(fr+i, _mm256_fmsub_ps(w2, load_rev_even8(xp2-2*i),
+            _mm256_mul_ps(w1, load_even8(xp1-N2+2*i))));
+      _mm256_storeu_ps(fi+i, _mm256_fmadd_ps(w2, load_even8(xp1+2*i),
+            _mm256_mul_ps(w1, load_rev_even8(xp2+N2-2*i))));
+   }
+   for (;i<N4;i++,j+=2)
+   {
+      fr[i] = -wp1[j]*xp1[-N2+2*i] + wp2[-j]*xp2[-2*i];
+      fi[i] = wp2[-j]*xp1[2*i] + wp1[j]*xp2[N2-2*i];
+   }
+}
+
+/* Mirrors on both sides of the overlap for TDAC. */
+static void mirror_avx2(float *out, const opus_val16 *window, int overlap)
+{
+   int i;
+   const int ov2 = overlap/2;
+   for (i=0;i<ov2-7;i+=8)
+   {
+      __m256 x1, x2, w1, w2;
+      x1 = reverse8(_mm256_loadu_ps(out+overlap-8-i));
+      x2 = _mm256_loadu_ps(out+i);
+      w1 = _mm256_loadu_ps(window+i);
+      w2 = reverse8(_mm256_loadu_ps(window+overlap-8-i));
+      _mm256_storeu_ps(out+i, _mm256_fmsub_ps(w2, x2, _mm256_mul_ps(w1, x1)));
+      _mm256_storeu_ps(out+overlap-8-i, reverse8(
+            _mm256_fmadd_ps(w1, x2, _mm256_mul_ps(w2, x1))));
+   }
+   for (;i<ov2;i++)
+   {
+      float x1, x2;
+      x1 = out[overlap-1-i];
+      x2 = out[i];
+      out[i] = window[overlap-1-i]*x2 - window[i]*x1;
+      out[overlap-1-i] = window[i]*x2 + window[overlap-1-i]*x1;
+   }
+}
+
+void clt_mdct_forward_avx2(const mdct_lookup *l, kiss_fft_scalar *in,
+      kiss_fft_scalar * OPUS_RESTRICT out, const opus_val16 *window,
+      int overlap, int shift, int stride, int arch)
+{
+   int i;
+   int N, N2, N4;
+   VARDECL(kiss_fft_scalar, f);
+   VARDECL(kiss_fft_cpx, f2);
+   kiss_fft_scalar *fr, *fi;
+   const kiss_fft_state *st = l->kfft[shift];
+   const kiss_twiddle_scalar *trig;
+   SAVE_STACK;
+   (void)arch;
+
+   N = l->n;
+   trig = l->trig;
+   for (i=0;i<shift;i++)
+   {
+      N >>= 1;
+      trig += N;
+   }
+   N2 = N>>1;
+   N4 = N>>2;
+
+   ALLOC(f, N2, kiss_fft_scalar);
+   ALLOC(f2, N4, kiss_fft_cpx);
+   fr = f;
+   fi = f+N4;
+
+   /* Window, shuffle, fold */
+   fold_avx2(in, window, overlap, N2, N4, fr, fi);
+
+   /* Pre-rotation */
+   {
+      const kiss_twiddle_scalar *t = trig;
+      const __m256 scale = _mm256_set1_ps(st->scale);
+      for (i=0;i<N4-7;i+=8)
+      {
+         __m256 re, im, t0, t1, yr, yi;
+         re = _mm256_loadu_ps(fr+i);
+         im = _mm256_loadu_ps(fi+i);
+         t0 = _mm256_loadu_ps(t+i);
+         t1 = _mm256_loadu_ps(t+N4+i);
+         yr = _mm256_fmsub_ps(re, t0, _mm256_mul_ps(im, t1));
+         yi = _mm256_fmadd_ps(im, t0, _mm256_mul_ps(re, t1));
+         store_bitrev8(f2, st->bitrev+i, _mm256_mul_ps(scale, yr), _mm256_mul_ps(scale, yi));
+      }
+      for (;i<N4;i++)
+      {
+         kiss_fft_cpx yc;
+         yc.r = st->scale*(fr[i]*t[i] - fi[i]*t[N4+i]);
+         yc.i = st->scale*(fi[i]*t[i] + fr[i]*t[N4+i]);
+         f2[st->bitrev[i]] = yc;
+      }
+   }
+
+   /* N/4 complex FFT, does not downscale anymore */
+   opus_fft_impl_avx2(st, f2);
+
+   /* Post-rotate */
+   {
+      const kiss_twiddle_scalar *t = trig;
+      for (i=0;i<N4-7;i+=8)
+      {
+         __m256 re, im, t0, t1;
+         deinterleave8(f2+i, &re, &im);
+         t0 = _mm256_loadu_ps(t+i);
+         t1 = _mm256_loadu_ps(t+N4+i);
+         _mm256_storeu_ps(fr+i, _mm256_fmsub_ps(im, t1, _mm256_mul_ps(re, t0)));
+         _mm256_storeu_ps(fi+i, _mm256_fmadd_ps(re, t1, _mm256_mul_ps(im, t0)));
+      }
+      for (;i<N4;i++)
+      {
+         fr[i] = f2[i].i*t[N4+i] - f2[i].r*t[i];
+         fi[i] = f2[i].r*t[N4+i] + f2[i].i*t[i];
+      }
+      interleave_avx2(fr, fi, out, N4, stride);
+   }
+   RESTORE_STACK;
+}
+
+void clt_mdct_backward_avx2(const mdct_lookup *l, kiss_fft_scalar *in,
+      kiss_fft_scalar * OPUS_RESTRICT out, const opus_val16 * OPUS_RESTRICT window,
+      int overlap, int shift, int stride, int arch)
+{
+   int i;
+   int N, N2, N4;
+   VARDECL(kiss_fft_scalar, f);
+   kiss_fft_scalar *fr, *fi;
+   kiss_fft_cpx *fp;
+   const kiss_fft_state *st = l->kfft[shift];
+   const kiss_twiddle_scalar *trig;
+   SAVE_STACK;
+   (void)arch;
+
+   N = l->n;
+   trig = l->trig;
+   for (i=0;i<shift;i++)
+   {
+      N >>= 1;
+      trig += N;
+   }
+   N2 = N>>1;
+   N4 = N>>2;
+
+   ALLOC(f, N2, kiss_fft_scalar);
+   fr = f;
+   fi = f+N4;
+   fp = (kiss_fft_cpx*)(out+(overlap>>1));
+
+   /* Pre-rotate */
+   {
+      const float *xp1 = in;
+      const float *xp2 = in+stride*(N2-1);
+      const kiss_twiddle_scalar *t = trig;
+      for (i=0;i<N4-7;i+=8)
+      {
+         __m256 x1, x2, t0, t1, yr, yi;
+         if (stride==1)
+         {
+            x1 = load_even8(xp1+2*i);
+            x2 = load_rev_even8(xp2-2*i);
+         } else {
+            x1 = load_strided8(xp1+2*stride*i, 2*stride);
+            x2 = load_strided8(xp2-2*stride*i, -2*stride);
+         }
+         t0 = _mm256_loadu_ps(t+i);
+         t1 = _mm256_loadu_ps(t+N4+i);
+         yr = _mm256_fmadd_ps(x2, t0, _mm256_mul_ps(x1, t1));
+         yi = _mm256_fmsub_ps(x1, t0, _mm256_mul_ps(x2, t1));
+         /* We swap real and imag because we use an FFT instead of an IFFT. */
+         store_bitrev8(fp, st->bitrev+i, yi, yr);
+      }
+      for (;i<N4;i++)
+      {
+         float x1, x2;
+         x1 = xp1[2*stride*i];
+         x2 = xp2[-2*stride*i];
+         fp[st->bitrev[i]].i = x2*t[i] + x1*t[N4+i];
+         fp[st->bitrev[i]].r = x1*t[i] - x2*t[N4+i];
+      }
+   }
+
+   opus_fft_impl_avx2(st, fp);
+
+   /* Post-rotate, through fr[] and fi[] as in clt_mdct_backward_sse(). */
+   {
+      const kiss_twiddle_scalar *t = trig;
+      for (i=0;i<N4-7;i+=8)
+      {
+         __m256 re, im, t0, t1;
+         /* We swap real and imag because we're using an FFT instead of an IFFT. */
+         deinterleave8(fp+i, &im, &re);
+         t0 = _mm256_loadu_ps(t+i);
+         t1 = _mm256_loadu_ps(t+N4+i);
+         _mm256_storeu_ps(fr+i, _mm256_fmadd_ps(re, t0, _mm256_mul_ps(im, t1)));
+         _mm256_storeu_ps(fi+i, _mm256_fmsub_ps(re, t1, _mm256_mul_ps(im, t0)));
+      }
+      for (;i<N4;i++)
+      {
+         fr[i] = fp[i].i*t[i] + fp[i].r*t[N4+i];
+         fi[i] = fp[i].i*t[N4+i] - fp[i].r*t[i];
+      }
+      interleave_avx2(fr, fi, (float*)fp, N4, 1);
+   }
+
+   /* Mirror on both sides for TDAC */
+   mirror_avx2(out, window, overlap);
+   RESTORE_STACK;
+}
+
+/* The batched MDCTs run eight transforms at once, one per lane, with the
+   data laid out as in the SSE version. */
+
+typedef struct {
+   __m256 r;
+   __m256 i;
+} cpx8;
+
+static OPUS_INLINE cpx8 cpx8_load(const float *F, int k)
+{
+   cpx8 x;
+   x.r = _mm256_loadu_ps(F+16*k);
+   x.i = _mm256_loadu_ps(F+16*k+8);
+   return x;
+}
+
+static OPUS_INLINE void cpx8_store(float *F, int k, cpx8 x)
+{
+   _mm256_storeu_ps(F+16*k, x.r);
+   _mm256_storeu_ps(F+16*k+8, x.i);
+}
+
+static OPUS_INLINE cpx8 cpx8_set1(kiss_twiddle_cpx tw)
+{
+   cpx8 x;
+   x.r = _mm256_set1_ps(tw.r);
+   x.i = _mm256_set1_ps(tw.i);
+   return x;
+}
+
+static OPUS_INLINE cpx8 cpx8_add(cpx8 a, cpx8 b)
+{
+   cpx8 x;
+   x.r = _mm256_add_ps(a.r, b.r);
+   x.i = _mm256_add_ps(a.i, b.i);
+   return x;
+}
+
+static OPUS_INLINE cpx8 cpx8_sub(cpx8 a, cpx8 b)
+{
+   cpx8 x;
+   x.r = _mm256_sub_ps(a.r, b.r);
+   x.i = _mm256_sub_ps(a.i, b.i);
+   return x;
+}
+
+static OPUS_INLINE cpx8 cpx8_mul(cpx8 a, cpx8 tw)
+{
+   cpx8 x;
+   x.r = _mm256_fmsub_ps(a.r, tw.r, _mm256_mul_ps(a.i, tw.i));
+   x.i = _mm256_fmadd_ps(a.r, tw.i, _mm256_mul_ps(a.i, tw.r));
+   return x;
+}
+
+static void kf_bfly2_x8(float *F, int m, int N)
+{
+   int i;
+   if (m==1)
+   {
+      for (i=0;i<N;i++)
+      {
+         cpx8 a, b;
+         a = cpx8_load(F, 2*i);
+         b = cpx8_load(F, 2*i+1);
+         cpx8_store(F, 2*i+1, cpx8_sub(a, b));
+         cpx8_store(F, 2*i, cpx8_add(a, b));
+      }
+   } else {
+      const __m256 tw = _mm256_set1_ps(0.7071067812f);
+      /* Otherwise m==4 because the radix-2 is just after a radix-4 */
+      celt_assert(m==4);
+      for (i=0;i<N;i++)
+      {
+         float *Fi = F+128*i;
+         cpx8 a, b, t, x;
+         __m256 u;
+         a = cpx8_load(Fi, 0);
+         b = cpx8_load(Fi, 4);
+         cpx8_store(Fi, 4, cpx8_sub(a, b));
+         cpx8_store(Fi, 0, cpx8_add(a, b));
+
+         a = cpx8_load(Fi, 1);
+         b = cpx8_load(Fi, 5);
+         t.r = _mm256_mul_ps(_mm256_add_ps(b.r, b.i), tw);
+         t.i = _mm256_mul_ps(_mm256_sub_ps(b.i, b.r), tw);
+         cpx8_store(Fi, 5, cpx8_sub(a, t));
+         cpx8_store(Fi, 1, cpx8_add(a, t));
+
+         /* Multiplying by -i. */
+         a = cpx8_load(Fi, 2);
+         b = cpx8_load(Fi, 6);
+         x.r = _mm256_sub_ps(a.r, b.i);
+         x.i = _mm256_add_ps(a.i, b.r);
+         cpx8_store(Fi, 6, x);
+         x.r = _mm256_add_ps(a.r, b.i);
+         x.i = _mm256_sub_ps(a.i, b.r);
+         cpx8_store(Fi, 2, x);
+
+         /* The imaginary part of the product is -u. */
+         a = cpx8_load(Fi, 3);
+         b = cpx8_load(Fi, 7);
+         t.r = _mm256_mul_ps(_mm256_sub_ps(b.i, b.r), tw);
+         u = _mm256_mul_ps(_mm256_add_ps(b.i, b.r), tw);
+         x.r = _mm256_sub_ps(a.r, t.r);
+         x.i = _mm256_add_ps(a.i, u);
+         cpx8_store(Fi, 7, x);
+         x.r = _mm256_add_ps(a.r, t.r);
+         x.i = _mm256_sub_ps(a.i, u);
+         cpx8_store(Fi, 3, x);
+      }
+   }
+}
+
+static void kf_bfly4_x8(float *F, const size_t fstride,
+      const kiss_fft_state *st, int m, int N, int mm)
+{
+   int i, j;
+   if (m==1)
+   {
+      /* Degenerate case where all the twiddles are 1. */
+      for (i=0;i<N;i++)
+      {
+         cpx8 f0, f1, f2, f3, s0, s1, x;
+         f0 = cpx8_load(F, 4*i);
+         f1 = cpx8_load(F, 4*i+1);
+         f2 = cpx8_load(F, 4*i+2);
+         f3 = cpx8_load(F, 4*i+3);
+         s0 = cpx8_sub(f0, f2);
+         f0 = cpx8_add(f0, f2);
+         s1 = cpx8_add(f1, f3);
+         cpx8_store(F, 4*i+2, cpx8_sub(f0, s1));
+         cpx8_store(F, 4*i, cpx8_add(f0, s1));
+         s1 = cpx8_sub(f1, f3);
+         x.r = _mm256_add_ps(s0.r, s1.i);
+         x.i = _mm256_sub_ps(s0.i, s1.r);
+         cpx8_store(F, 4*i+1, x);
+         x.r = _mm256_sub_ps(s0.r, s1.i);
+         x.i = _mm256_add_ps(s0.i, s1.r);
+         cpx8_store(F, 4*i+3, x);
+      }
+   } else {
+      for (j=0;j<m;j++)
+      {
+         cpx8 tw1, tw2, tw3;
+         tw1 = cpx8_set1(st->twiddles[j*fstride]);
+         tw2 = cpx8_set1(st->twiddles[2*j*fstride]);
+         tw3 = cpx8_set1(st->twiddles[3*j*fstride]);
+         for (i=0;i<N;i++)
+         {
+            float *Fi = F+16*(i*mm+j);
+            cpx8 f0, s0, s1, s2, s3, s4, s5, x;
+            s0 = cpx8_mul(cpx8_load(Fi, m), tw1);
+            s1 = cpx8_mul(cpx8_load(Fi, 2*m), tw2);
+            s2 = cpx8_mul(cpx8_load(Fi, 3*m), tw3);
+            f0 = cpx8_load(Fi, 0);
+            s5 = cpx8_sub(f0, s1);
+            f0 = cpx8_add(f0, s1);
+            s3 = cpx8_add(s0, s2);
+            s4 = cpx8_sub(s0, s2);
+            cpx8_store(Fi, 2*m, cpx8_sub(f0, s3));
+            cpx8_store(Fi, 0, cpx8_add(f0, s3));
+            x.r = _mm256_add_ps(s5.r, s4.i);
+            x.i = _mm256_sub_ps(s5.i, s4.r);
+            cpx8_store(Fi, m, x);
+            x.r = _mm256_sub_ps(s5.r, s4.i);
+            x.i = _mm256_add_ps(s5.i, s4.r);
+            cpx8_store(Fi, 3*m, x);
+         }
+      }
+   }
+}
+
+static void kf_bfly3_x8(float *F, const size_t fstride,
+      const kiss_fft_state *st, int m, int N, int mm)
+{
+   int i, k;
+   const __m256 half = _mm256_set1_ps(.5f);
+   const __m256 epi3 = _mm256_set1_ps(st->twiddles[fstride*m].i);
+   for (k=0;k<m;k++)
+   {
+      cpx8 tw1, tw2;
+      tw1 = cpx8_set1(st->twiddles[k*fstride]);
+      tw2 = cpx8_set1(st->twiddles[2*k*fstride]);
+      for (i=0;i<N;i++)
+      {
+         float *Fi = F+16*(i*mm+k);
+         cpx8 f0, fm, s0, s1, s2, s3, x;
+         s1 = cpx8_mul(cpx8_load(Fi, m), tw1);
+         s2 = cpx8_mul(cpx8_load(Fi, 2*m), tw2);
+         s3 = cpx8_add(s1, s2);
+         s0 = cpx8_sub(s1, s2);
+         f0 = cpx8_load(Fi, 0);
+         fm.r = _mm256_fnmadd_ps(s3.r, half, f0.r);
+         fm.i = _mm256_fnmadd_ps(s3.i, half, f0.i);
+         s0.r = _mm256_mul_ps(s0.r, epi3);
+         s0.i = _mm256_mul_ps(s0.i, epi3);
+         cpx8_store(Fi, 0, cpx8_add(f0, s3));
+         x.r = _mm256_add_ps(fm.r, s0.i);
+         x.i = _mm256_sub_ps(fm.i, s0.r);
+         cpx8_store(Fi, 2*m, x);
+         x.r = _mm256_sub_ps(fm.r, s0.i);
+         x.i = _mm256_add_ps(fm.i, s0.r);
+         cpx8_store(Fi, m, x);
+      }
+   }
+}
+
+static void kf_bfly5_x8(float *F, const size_t fstride,
+      const kiss_fft_state *st, int m, int N, int mm)
+{
+   int i, u;
+   __m256 yar, yai, ybr, ybi;
+   yar = _mm256_set1_ps(st->twiddles[fstride*m].r);
+   yai = _mm256_set1_ps(st->twiddles[fstride*m].i);
+   ybr = _mm256_set1_ps(st->twiddles[fstride*2*m].r);
+   ybi = _mm256_set1_ps(st->twiddles[fstride*2*m].i);
+   for (u=0;u<m;u++)
+   {
+      cpx8 tw1, tw2, tw3, tw4;
+      tw1 = cpx8_set1(st->twiddles[u*fstride]);
+      tw2 = cpx8_set1(st->twiddles[2*u*fstride]);
+      tw3 = cpx8_set1(st->twiddles[3*u*fstride]);
+      tw4 = cpx8_set1(st->twiddles[4*u*fstride]);
+      for (i=0;i<N;i++)
+      {
+         float *Fi = F+16*(i*mm+u);
+         cpx8 s0, s1, s2, s3, s4, s5, s7, s8, s9, s10, s11, s12, x;
+         __m256 s6r, s6i;
+         s0 = cpx8_load(Fi, 0);
+         s1 = cpx8_mul(cpx8_load(Fi, m), tw1);
+         s2 = cpx8_mul(cpx8_load(Fi, 2*m), tw2);
+         s3 = cpx8_mul(cpx8_load(Fi, 3*m), tw3);
+         s4 = cpx8_mul(cpx8_load(Fi, 4*m), tw4);
+
+         s7 = cpx8_add(s1, s4);
+         s10 = cpx8_sub(s1, s4);
+         s8 = cpx8_add(s2, s3);
+         s9 = cpx8_sub(s2, s3);
+
+         x.r = _mm256_add_ps(s0.r, _mm256_add_ps(s7.r, s8.r));
+         x.i = _mm256_add_ps(s0.i, _mm256_add_ps(s7.i, s8.i));
+         cpx8_store(Fi, 0, x);
+
+         s5.r = _mm256_fmadd_ps(s7.r, yar, _mm256_fmadd_ps(s8.r, ybr, s0.r));
+         s5.i = _mm256_fmadd_ps(s7.i, yar, _mm256_fmadd_ps(s8.i, ybr, s0.i));
+         /* s6i is the negated imaginary part. */
+         s6r = _mm256_fmadd_ps(s10.i, yai, _mm256_mul_ps(s9.i, ybi));
+         s6i = _mm256_fmadd_ps(s10.r, yai, _mm256_mul_ps(s9.r, ybi));
+         x.r = _mm256_sub_ps(s5.r, s6r);
+         x.i = _mm256_add_ps(s5.i, s6i);
+         cpx8_store(Fi, m, x);
+         x.r = _mm256_add_ps(s5.r, s6r);
+         x.i = _mm256_sub_ps(s5.i, s6i);
+         cpx8_store(Fi, 4*m, x);
+
+         s11.r = _mm256_fmadd_ps(s7.r, ybr, _mm256_fmadd_ps(s8.r, yar, s0.r));
+         s11.i = _mm256_fmadd_ps(s7.i, ybr, _mm256_fmadd_ps(s8.i, yar, s0.i));
+         s12.r = _mm256_fmsub_ps(s9.i, yai, _mm256_mul_ps(s10.i, ybi));
+         s12.i = _mm256_fmsub_ps(s10.r, ybi, _mm256_mul_ps(s9.r, yai));
+         cpx8_store(Fi, 2*m, cpx8_add(s11, s12));
+         cpx8_store(Fi, 3*m, cpx8_sub(s11, s12));
+      }
+   }
+}
+
+/* opus_fft_impl() of the eight transforms in F. */
+static void fft_x8(const kiss_fft_state *st, float *F)
+{
+   int m2, m;
+   int p;
+   int L;
+   int fstride[MAXFACTORS];
+   int i;
+   int shift;
+
+   /* st->shift can be -1 */
+   shift = st->shift>0 ? st->shift : 0;
+
+   fstride[0] = 1;
+   L=0;
+   do {
+      p = st->factors[2*L];
+      m = st->factors[2*L+1];
+      fstride[L+1] = fstride[L]*p;
+      L++;
+   } while(m!=1);
+   m = st->factors[2*L-1];
+   for (i=L-1;i>=0;i--)
+   {
+      if (i!=0)
+         m2 = st->factors[2*i-1];
+      else
+         m2 = 1;
+      switch (st->factors[2*i])
+      {
+      case 2:
+         kf_bfly2_x8(F, m, fstride[i]);
+         break;
+      case 4:
+         kf_bfly4_x8(F, fstride[i]<<shift, st, m, fstride[i], m2);
+         break;
+      case 3:
+         kf_bfly3_x8(F, fstride[i]<<shift, st, m, fstride[i], m2);
+         break;
+      case 5:
+         kf_bfly5_x8(F, fstride[i]<<shift, st, m, fstride[i], m2);
+         break;
+      }
+      m = m2;
+   }
+}
+
+static OPUS_INLINE void transpose8(__m256 *x)
+{
+   __m256 t0, t1, t2, t3, t4, t5, t6, t7;
+   __m256 s0, s1, s2, s3, s4, s5, s6, s7;
+   t0 = _mm256_unpacklo_ps(x[0], x[1]);
+   t1 = _mm256_unpackhi_ps(x[0], x[1]);
+   t2 = _mm256_unpacklo_ps(x[2], x[3]);
+   t3 = _mm256_unpackhi_ps(x[2], x[3]);
+   t4 = _mm256_unpacklo_ps(x[4], x[5]);
+   t5 = _mm256_unpackhi_ps(x[4], x[5]);
+   t6 = _mm256_unpacklo_ps(x[6], x[7]);
+   t7 = _mm256_unpackhi_ps(x[6], x[7]);
+   s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+   s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+   s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+   s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+   s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+   s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+   s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+   s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+   x[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+   x[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+   x[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+   x[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+   x[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+   x[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+   x[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+   x[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+
+static OPUS_INLINE __m256 lanes8(float * const *p, int j)
+{
+   return _mm256_setr_ps(p[0][j], p[1][j], p[2][j], p[3][j],
+         p[4][j], p[5][j], p[6][j], p[7][j]);
+}
+
+static OPUS_INLINE void pre_rotate_x8(float *F, int k, __m256 re, __m256 im,
+      float t0, float t1, __m256 scale)
+{
+   cpx8 y;
+   __m256 c, s;
+   c = _mm256_set1_ps(t0);
+   s = _mm256_set1_ps(t1);
+   y.r = _mm256_mul_ps(scale, _mm256_fmsub_ps(re, c, _mm256_mul_ps(im, s)));
+   y.i = _mm256_mul_ps(scale, _mm256_fmadd_ps(im, c, _mm256_mul_ps(re, s)));
+   cpx8_store(F, k, y);
+}
+
+/* Forward MDCTs of the eight transforms in[k] -> out[k], one per lane. */
+static void mdct_forward_x8(const mdct_lookup *l, kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out, const opus_val16 *window,
+      int overlap, int shift, int stride)
+{
+   int i, k;
+   int N, N2, N4;
+   int contiguous;
+   VARDECL(kiss_fft_scalar, f);
+   VARDECL(float, F);
+   float *fr[8], *fi[8];
+   const kiss_fft_state *st = l->kfft[shift];
+   const kiss_twiddle_scalar *trig;
+   SAVE_STACK;
+
+   N = l->n;
+   trig = l->trig;
+   for (i=0;i<shift;i++)
+   {
+      N >>= 1;
+      trig += N;
+   }
+   N2 = N>>1;
+   N4 = N>>2;
+
+   ALLOC(f, 8*N2, kiss_fft_scalar);
+   ALLOC(F, 16*N4, float);
+   for (k=0;k<8;k++)
+   {
+      fr[k] = f+k*N2;
+      fi[k] = fr[k]+N4;
+   }
+
+   /* Window, shuffle, fold */
+   for (k=0;k<8;k++)
+      fold_avx2(in[k], window, overlap, N2, N4, fr[k], fi[k]);
+
+   /* Pre-rotation, transposing eight points at a time into the lanes */
+   {
+      const kiss_twiddle_scalar *t = trig;
+      const __m256 scale = _mm256_set1_ps(st->scale);
+      for (i=0;i<N4-7;i+=8)
+      {
+         __m256 re[8], im[8];
+         for (k=0;k<8;k++)
+         {
+            re[k] = _mm256_loadu_ps(fr[k]+i);
+            im[k] = _mm256_loadu_ps(fi[k]+i);
+         }
+         transpose8(re);
+         transpose8(im);
+         for (k=0;k<8;k++)
+            pre_rotate_x8(F, st->bitrev[i+k], re[k], im[k], t[i+k], t[N4+i+k], scale);
+      }
+      for (;i<N4;i++)
+         pre_rotate_x8(F, st->bitrev[i], lanes8(fr, i), lanes8(fi, i), t[i], t[N4+i], scale);
+   }
+
+   /* N/4 complex FFT, does not downscale anymore */
+   fft_x8(st, F);
+
+   /* Post-rotate. Consecutive blocks of a channel are next to each other in
+      the interleaved output. */
+   contiguous = 1;
+   for (k=1;k<8;k++)
+      contiguous = contiguous && out[k]==out[0]+k;
+   {
+      const kiss_twiddle_scalar *t = trig;
+      for (i=0;i<N4;i++)
+      {
+         cpx8 z;
+         __m256 c, s, yr, yi;
+         z = cpx8_load(F, i);
+         c = _mm256_set1_ps(t[i]);
+         s = _mm256_set1_ps(t[N4+i]);
+         yr = _mm256_fmsub_ps(z.i, s, _mm256_mul_ps(z.r, c));
+         yi = _mm256_fmadd_ps(z.r, s, _mm256_mul_ps(z.i, c));
+         if (contiguous)
+         {
+            _mm256_storeu_ps(out[0]+2*i*stride, yr);
+            _mm256_storeu_ps(out[0]+(N2-1-2*i)*stride, yi);
+         } else {
+            float a[8], b[8];
+            _mm256_storeu_ps(a, yr);
+            _mm256_storeu_ps(b, yi);
+            for (k=0;k<8;k++)
+            {
+               out[k][2*i*stride] = a[k];
+               out[k][(N2-1-2*i)*stride] = b[k];
+            }
+         }
+      }
+   }
+   RESTORE_STACK;
+}
+
+/* Backward MDCTs of the eight transforms in[k] -> out[k], one per lane, as
+   for mdct_forward_x8(). The outputs are overlap-added in order. */
+static void mdct_backward_x8(const mdct_lookup *l, kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out, const opus_val16 * OPUS_RESTRICT window,
+      int overlap, int shift, int stride)
+{
+   int i, k;
+   int N, N2, N4;
+   int contiguous;
+   VARDECL(kiss_fft_scalar, f);
+   VARDECL(float, F);
+   float *x[8];
+   float *fr[8], *fi[8];
+   const kiss_fft_state *st = l->kfft[shift];
+   const kiss_twiddle_scalar *trig;
+   SAVE_STACK;
+
+   N = l->n;
+   trig = l->trig;
+   for (i=0;i<shift;i++)
+   {
+      N >>= 1;
+      trig += N;
+   }
+   N2 = N>>1;
+   N4 = N>>2;
+
+   ALLOC(f, 8*N2, kiss_fft_scalar);
+   ALLOC(F, 16*N4, float);
+   for (k=0;k<8;k++)
+   {
+      x[k] = in[k];
+      fr[k] = f+k*N2;
+      fi[k] = fr[k]+N4;
+   }
+   contiguous = 1;
+   for (k=1;k<8;k++)
+      contiguous = contiguous && in[k]==in[0]+k;
+
+   /* Pre-rotate */
+   {
+      const kiss_twiddle_scalar *t = trig;
+      for (i=0;i<N4;i++)
+      {
+         int j1, j2;
+         __m256 x1, x2, c, s;
+         cpx8 y;
+         j1 = 2*i*stride;
+         j2 = (N2-1-2*i)*stride;
+         if (contiguous)
+         {
+            x1 = _mm256_loadu_ps(x[0]+j1);
+            x2 = _mm256_loadu_ps(x[0]+j2);
+         } else {
+            x1 = lanes8(x, j1);
+            x2 = lanes8(x, j2);
+         }
+         c = _mm256_set1_ps(t[i]);
+         s = _mm256_set1_ps(t[N4+i]);
+         /* We swap real and imag because we use an FFT instead of an IFFT. */
+         y.i = _mm256_fmadd_ps(x2, c, _mm256_mul_ps(x1, s));
+         y.r = _mm256_fmsub_ps(x1, c, _mm256_mul_ps(x2, s));
+         cpx8_store(F, st->bitrev[i], y);
+      }
+   }
+
+   fft_x8(st, F);
+
+   /* Post-rotate, transposing eight points at a time out of the lanes */
+   {
+      const kiss_twiddle_scalar *t = trig;
+      for (i=0;i<N4;i+=8)
+      {
+         int len;
+         __m256 a[8], b[8];
+         len = IMIN(8, N4-i);
+         for (k=0;k<len;k++)
+         {
+            cpx8 z;
+            __m256 re, im, c, s;
+            /* We swap real and imag because we're using an FFT instead of an IFFT. */
+            z = cpx8_load(F, i+k);
+            re = z.i;
+            im = z.r;
+            c = _mm256_set1_ps(t[i+k]);
+            s = _mm256_set1_ps(t[N4+i+k]);
+            a[k] = _mm256_fmadd_ps(re, c, _mm256_mul_ps(im, s));
+            b[k] = _mm256_fmsub_ps(re, s, _mm256_mul_ps(im, c));
+         }
+         for (;k<8;k++)
+            a[k] = b[k] = _mm256_setzero_ps();
+         transpose8(a);
+         transpose8(b);
+         for (k=0;k<8;k++)
+         {
+            if (len==8)
+            {
+               _mm256_storeu_ps(fr[k]+i, a[k]);
+               _mm256_storeu_ps(fi[k]+i, b[k]);
+            } else {
+               int j;
+               float ta[8], tb[8];
+               _mm256_storeu_ps(ta, a[k]);
+               _mm256_storeu_ps(tb, b[k]);
+               for (j=0;j<len;j++)
+               {
+                  fr[k][i+j] = ta[j];
+                  fi[k][i+j] = tb[j];
+               }
+            }
+         }
+      }
+   }
+
+   for (k=0;k<8;k++)
+   {
+      interleave_avx2(fr[k], fi[k], out[k]+(overlap>>1), N4, 1);
+      /* Mirror on both sides for TDAC */
+      mirror_avx2(out[k], window, overlap);
+   }
+   RESTORE_STACK;
+}
+
+/* A long MDCT already fills the lanes within the transform, so only short
+   blocks are batched, eight at a time. Any left over use the single
+   transform. */
+void clt_mdct_forward_multi_avx2(const mdct_lookup *l, kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out, int C, int B, const opus_val16 *window,
+      int overlap, int shift, int arch)
+{
+   int t, k;
+   int T, N2;
+   N2 = (l->n>>shift)>>1;
+   T = C*B;
+   t = 0;
+   if (B>1)
+   {
+      for (;t+8<=T;t+=8)
+      {
+         kiss_fft_scalar *x[8], *y[8];
+         for (k=0;k<8;k++)
+         {
+            x[k] = in[(t+k)/B]+(t+k)%B*N2;
+            y[k] = out[(t+k)/B]+(t+k)%B;
+         }
+         mdct_forward_x8(l, x, y, window, overlap, shift, B);
+      }
+   }
+   for (;t<T;t++)
+      clt_mdct_forward_avx2(l, in[t/B]+t%B*N2, out[t/B]+t%B, window, overlap,
+            shift, B, arch);
+}
+
+/* Unlike the forward transforms, the backward ones are batched eight at a
+   time whatever their size. When the frames of several decoders are
+   synthesized together there are enough long blocks to fill the groups, and
+   running them in lanes is still faster than one at a time. Any left over
+   use the single transform. */
+void clt_mdct_backward_multi_avx2(const mdct_lookup *l, kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out, int C, int B,
+      const opus_val16 * OPUS_RESTRICT window, int overlap, int shift, int arch)
+{
+   int t, k;
+   int T, N2;
+   N2 = (l->n>>shift)>>1;
+   T = C*B;
+   t = 0;
+   for (;t+8<=T;t+=8)
+   {
+      kiss_fft_scalar *x[8], *y[8];
+      for (k=0;k<8;k++)
+      {
+         x[k] = in[(t+k)/B]+(t+k)%B;
+         y[k] = out[(t+k)/B]+(t+k)%B*N2;
+      }
+      mdct_backward_x8(l, x, y, window, overlap, shift, B);
+   }
+   for (;t<T;t++)
+      clt_mdct_backward_avx2(l, in[t/B]+t%B, out[t/B]+t%B*N2, window, overlap,
+            shift, B, arch);
+}
+
+#endif
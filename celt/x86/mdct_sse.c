@@ -0,0 +1,978 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "mdct.h"
+#include "kiss_fft.h"
+#include "stack_alloc.h"
+#include "x86cpu.h"
+
+#if defined(OPUS_X86_MAY_HAVE_SSE) && !defined(FIXED_POINT)
+
+#include <xmmintrin.h>
+
+/* Same steps as clt_mdct_forward_c() and clt_mdct_backward_c(), four points
+   at a time. The real and imaginary parts are kept in separate arrays
+   between the steps, and the products and sums are the same as in the C
+   code, so the results are bit-exact with it. */
+
+/* p[0], p[2], p[4] and p[6]. */
+static OPUS_INLINE __m128 load_even4(const float *p)
+{
+   return _mm_shuffle_ps(_mm_loadu_ps(p), _mm_loadu_ps(p+3), _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+/* p[0], p[-2], p[-4] and p[-6]. */
+static OPUS_INLINE __m128 load_rev_even4(const float *p)
+{
+   return _mm_shuffle_ps(_mm_loadu_ps(p-3), _mm_loadu_ps(p-6), _MM_SHUFFLE(0, 2, 1, 3));
+}
+
+static OPUS_INLINE __m128 load_strided4(const float *p, int stride)
+{
+   return _mm_setr_ps(p[0], p[stride], p[2*stride], p[3*stride]);
+}
+
+static OPUS_INLINE __m128 reverse4(__m128 x)
+{
+   return _mm_shuffle_ps(x, x, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+/* Stores the complex values (re[k], im[k]) at dst[rev[k]]. */
+static OPUS_INLINE void store_bitrev4(kiss_fft_cpx *dst, const opus_int16 *rev,
+      __m128 re, __m128 im)
+{
+   __m128 lo, hi;
+   lo = _mm_unpacklo_ps(re, im);
+   hi = _mm_unpackhi_ps(re, im);
+   _mm_storel_pi((__m64*)&dst[rev[0]], lo);
+   _mm_storeh_pi((__m64*)&dst[rev[1]], lo);
+   _mm_storel_pi((__m64*)&dst[rev[2]], hi);
+   _mm_storeh_pi((__m64*)&dst[rev[3]], hi);
+}
+
+/* Writes y[2*k*stride] = a[k] and y[(N2-1-2*k)*stride] = b[k]. */
+static void interleave_sse(const float *a, const float *b, float *y, int N4,
+      int stride)
+{
+   int k;
+   if (stride==1)
+   {
+      for (k=0;k<N4-3;k+=4)
+      {
+         __m128 x0, x1;
+         x0 = _mm_loadu_ps(a+k);
+         x1 = reverse4(_mm_loadu_ps(b+N4-4-k));
+         _mm_storeu_ps(y+2*k, _mm_unpacklo_ps(x0, x1));
+         _mm_storeu_ps(y+2*k+4, _mm_unpackhi_ps(x0, x1));
+      }
+      for (;k<N4;k++)
+      {
+         y[2*k] = a[k];
+         y[2*k+1] = b[N4-1-k];
+      }
+   } else {
+      float *y2 = y+stride*(2*N4-1);
+      for (k=0;k<N4;k++)
+      {
+         y[2*k*stride] = a[k];
+         y2[-2*k*stride] = b[k];
+      }
+   }
+}
+
+/* Windows, shuffles and folds the input of a forward MDCT into the real
+   and imaginary parts fr[] and fi[] of the N4 points to rotate. */
+static void fold_sse(const float *in, const opus_val16 *window, int overlap,
+      int N2, int N4, float *fr, float *fi)
+{
+   int i, j;
+   int K;
+   const float *xp1 = in+(overlap>>1);
+   const float *xp2 = in+N2-1+(overlap>>1);
+   const float *wp1 = window+(overlap>>1);
+   const float *wp2 = window+(overlap>>1)-1;
+   K = (overlap+3)>>2;
+   for (i=0;i<K-3;i+=4)
+   {
+      __m128 w1, w2;
+      w1 = load_even4(wp1+2*i);
+      w2 = load_rev_even4(wp2-2*i);
+      _mm_storeu_ps(fr+i, _mm_add_ps(_mm_mul_ps(w2, load_even4(xp1+N2+2*i)),
+            _mm_mul_ps(w1, load_rev_even4(xp2-2*i))));
+      _mm_storeu_ps(fi+i, _mm_sub_ps(_mm_mul_ps(w1, load_even4(xp1+2*i)),
+            _mm_mul_ps(w2, load_rev_even4(xp2-N2-2*i))));
+   }
+   for (;i<K;i++)
+   {
+      fr[i] = wp2[-2*i]*xp1[N2+2*i] + wp1[2*i]*xp2[-2*i];
+      fi[i] = wp1[2*i]*xp1[2*i] - wp2[-2*i]*xp2[-N2-2*i];
+   }
+   for (;i<N4-K-3;i+=4)
+   {
+      _mm_storeu_ps(fr+i, load_rev_even4(xp2-2*i));
+      _mm_storeu_ps(fi+i, load_even4(xp1+2*i));
+   }
+   for (;i<N4-K;i++)
+   {
+      fr[i] = xp2[-2*i];
+      fi[i] = xp1[2*i];
+   }
+   /* The window restarts where this loop does. */
+   wp1 = window;
+   wp2 = window+overlap-1;
+   for (j=0;i<N4-3;i+=4,j+=8)
+   {
+      __m128 w1, w2;
+      w1 = load_even4(wp1+j);
+      w2 = load_rev_even4(wp2-j);
+      _mm_storeu_ps(fr+i, _mm_sub_ps(_mm_mul_ps(w2, load_rev_even4(xp2-2*i)),
+            _mm_mul_ps(w1, load_even4(xp1-N2+2*i))));
+      _mm_storeu_ps(fi+i, _mm_add_ps(_mm_mul_ps(w2, load_even4(xp1+2*i)),
+            _mm_mul_ps(w1, load_rev_even4(xp2+N2-2*i))));
+   }
+   for (;i<N4;i++,j+=2)
+   {
+      fr[i] = -wp1[j]*xp1[-N2+2*i] + wp2[-j]*xp2[-2*i];
+      fi[i] = wp2[-j]*xp1[2*i] + wp1[j]*xp2[N2-2*i];
+   }
+}
+
+/* Mirrors on both sides of the overlap for TDAC. */
+static void mirror_sse(float *out, const opus_val16 *window, int overlap)
+{
+   int i;
+   const int ov2 = overlap/2;
+   for (i=0;i<ov2-3;i+=4)
+   {
+      __m128 x1, x2, w1, w2;
+      x1 = reverse4(_mm_loadu_ps(out+overlap-4-i));
+      x2 = _mm_loadu_ps(out+i);
+      w1 = _mm_loadu_ps(window+i);
+      w2 = reverse4(_mm_loadu_ps(window+overlap-4-i));
+      _mm_storeu_ps(out+i, _mm_sub_ps(_mm_mul_ps(w2, x2), _mm_mul_ps(w1, x1)));
+      _mm_storeu_ps(out+overlap-4-i, reverse4(
+            _mm_add_ps(_mm_mul_ps(w1, x2), _mm_mul_ps(w2, x1))));
+   }
+   for (;i<ov2;i++)
+   {
+      float x1, x2;
+      x1 = out[overlap-1-i];
+      x2 = out[i];
+      out[i] = window[overlap-1-i]*x2 - window[i]*x1;
+      out[overlap-1-i] = window[i]*x2 + window[overlap-1-i]*x1;
+   }
+}
+
+void clt_mdct_forward_sse(const mdct_lookup *l, kiss_fft_scalar *in,
+      kiss_fft_scalar * OPUS_RESTRICT out, const opus_val16 *window,
+      int overlap, int shift, int stride, int arch)
+{
+   int i;
+   int N, N2, N4;
+   VARDECL(kiss_fft_scalar, f);
+   VARDECL(kiss_fft_cpx, f2);
+   kiss_fft_scalar *fr, *fi;
+   const kiss_fft_state *st = l->kfft[shift];
+   const kiss_twiddle_scalar *trig;
+   SAVE_STACK;
+   (void)arch;
+
+   N = l->n;
+   trig = l->trig;
+   for (i=0;i<shift;i++)
+   {
+      N >>= 1;
+      trig += N;
+   }
+   N2 = N>>1;
+   N4 = N>>2;
+
+   ALLOC(f, N2, kiss_fft_scalar);
+   ALLOC(f2, N4, kiss_fft_cpx);
+   fr = f;
+   fi = f+N4;
+
+   /* Window, shuffle, fold */
+   fold_sse(in, window, overlap, N2, N4, fr, fi);
+
+   /* Pre-rotation */
+   {
+      const kiss_twiddle_scalar *t = trig;
+      const __m128 scale = _mm_set1_ps(st->scale);
+      for (i=0;i<N4-3;i+=4)
+      {
+         __m128 re, im, t0, t1, yr, yi;
+         re = _mm_loadu_ps(fr+i);
+         im = _mm_loadu_ps(fi+i);
+         t0 = _mm_loadu_ps(t+i);
+         t1 = _mm_loadu_ps(t+N4+i);
+         yr = _mm_sub_ps(_mm_mul_ps(re, t0), _mm_mul_ps(im, t1));
+         yi = _mm_add_ps(_mm_mul_ps(im, t0), _mm_mul_ps(re, t1));
+         store_bitrev4(f2, st->bitrev+i, _mm_mul_ps(scale, yr), _mm_mul_ps(scale, yi));
+      }
+      for (;i<N4;i++)
+      {
+         kiss_fft_cpx yc;
+         yc.r = st->scale*(fr[i]*t[i] - fi[i]*t[N4+i]);
+         yc.i = st->scale*(fi[i]*t[i] + fr[i]*t[N4+i]);
+         f2[st->bitrev[i]] = yc;
+      }
+   }
+
+   /* N/4 complex FFT, does not downscale anymore */
+   opus_fft_impl_sse(st, f2);
+
+   /* Post-rotate */
+   {
+      const kiss_twiddle_scalar *t = trig;
+      for (i=0;i<N4-3;i+=4)
+      {
+         __m128 a, b, re, im, t0, t1;
+         a = _mm_loadu_ps(&f2[i].r);
+         b = _mm_loadu_ps(&f2[i+2].r);
+         re = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+         im = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+         t0 = _mm_loadu_ps(t+i);
+         t1 = _mm_loadu_ps(t+N4+i);
+         _mm_storeu_ps(fr+i, _mm_sub_ps(_mm_mul_ps(im, t1), _mm_mul_ps(re, t0)));
+         _mm_storeu_ps(fi+i, _mm_add_ps(_mm_mul_ps(re, t1), _mm_mul_ps(im, t0)));
+      }
+      for (;i<N4;i++)
+      {
+         fr[i] = f2[i].i*t[N4+i] - f2[i].r*t[i];
+         fi[i] = f2[i].r*t[N4+i] + f2[i].i*t[i];
+      }
+      interleave_sse(fr, fi, out, N4, stride);
+   }
+   RESTORE_STACK;
+}
+
+void clt_mdct_backward_sse(const mdct_lookup *l, kiss_fft_scalar *in,
+      kiss_fft_scalar * OPUS_RESTRICT out, const opus_val16 * OPUS_RESTRICT window,
+      int overlap, int shift, int stride, int arch)
+{
+   int i;
+   int N, N2, N4;
+   VARDECL(kiss_fft_scalar, f);
+   kiss_fft_scalar *fr, *fi;
+   kiss_fft_cpx *fp;
+   const kiss_fft_state *st = l->kfft[shift];
+   const kiss_twiddle_scalar *trig;
+   SAVE_STACK;
+   (void)arch;
+
+   N = l->n;
+   trig = l->trig;
+   for (i=0;i<shift;i++)
+   {
+      N >>= 1;
+      trig += N;
+   }
+   N2 = N>>1;
+   N4 = N>>2;
+
+   ALLOC(f, N2, kiss_fft_scalar);
+   fr = f;
+   fi = f+N4;
+   fp = (kiss_fft_cpx*)(out+(overlap>>1));
+
+   /* Pre-rotate */
+   {
+      const float *xp1 = in;
+      const float *xp2 = in+stride*(N2-1);
+      const kiss_twiddle_scalar *t = trig;
+      for (i=0;i<N4-3;i+=4)
+      {
+         __m128 x1, x2, t0, t1, yr, yi;
+         if (stride==1)
+         {
+            x1 = load_even4(xp1+2*i);
+            x2 = load_rev_even4(xp2-2*i);
+         } else {
+            x1 = load_strided4(xp1+2*stride*i, 2*stride);
+            x2 = load_strided4(xp2-2*stride*i, -2*stride);
+         }
+         t0 = _mm_loadu_ps(t+i);
+         t1 = _mm_loadu_ps(t+N4+i);
+         yr = _mm_add_ps(_mm_mul_ps(x2, t0), _mm_mul_ps(x1, t1));
+         yi = _mm_sub_ps(_mm_mul_ps(x1, t0), _mm_mul_ps(x2, t1));
+         /* We swap real and imag because we use an FFT instead of an IFFT. */
+         store_bitrev4(fp, st->bitrev+i, yi, yr);
+      }
+      for (;i<N4;i++)
+      {
+         float x1, x2;
+         x1 = xp1[2*stride*i];
+         x2 = xp2[-2*stride*i];
+         fp[st->bitrev[i]].i = x2*t[i] + x1*t[N4+i];
+         fp[st->bitrev[i]].r = x1*t[i] - x2*t[N4+i];
+      }
+   }
+
+   opus_fft_impl_sse(st, fp);
+
+   /* Post-rotate. The results go through fr[] and fi[], so the
+      de-shuffle does not need to run from both ends at once. */
+   {
+      const kiss_twiddle_scalar *t = trig;
+      for (i=0;i<N4-3;i+=4)
+      {
+         __m128 a, b, re, im, t0, t1;
+         /* We swap real and imag because we're using an FFT instead of an IFFT. */
+         a = _mm_loadu_ps(&fp[i].r);
+         b = _mm_loadu_ps(&fp[i+2].r);
+         im = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+         re = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+         t0 = _mm_loadu_ps(t+i);
+         t1 = _mm_loadu_ps(t+N4+i);
+         _mm_storeu_ps(fr+i, _mm_add_ps(_mm_mul_ps(re, t0), _mm_mul_ps(im, t1)));
+         _mm_storeu_ps(fi+i, _mm_sub_ps(_mm_mul_ps(re, t1), _mm_mul_ps(im, t0)));
+      }
+      for (;i<N4;i++)
+      {
+         fr[i] = fp[i].i*t[i] + fp[i].r*t[N4+i];
+         fi[i] = fp[i].i*t[N4+i] - fp[i].r*t[i];
+      }
+      interleave_sse(fr, fi, (float*)fp, N4, 1);
+   }
+
+   /* Mirror on both sides for TDAC */
+   mirror_sse(out, window, overlap);
+   RESTORE_STACK;
+}
+
+/* The batched MDCTs run four transforms at once, one per lane. Point k of
+   the FFT data holds the real parts of the four lanes followed by their
+   imaginary parts, so the butterflies need no shuffles and the twiddles are
+   broadcast. The operations are those of the C FFT, so the results stay
+   bit-exact with it. */
+
+typedef struct {
+   __m128 r;
+   __m128 i;
+} cpx4;
+
+static OPUS_INLINE cpx4 cpx4_load(const float *F, int k)
+{
+   cpx4 x;
+   x.r = _mm_loadu_ps(F+8*k);
+   x.i = _mm_loadu_ps(F+8*k+4);
+   return x;
+}
+
+static OPUS_INLINE void cpx4_store(float *F, int k, cpx4 x)
+{
+   _mm_storeu_ps(F+8*k, x.r);
+   _mm_storeu_ps(F+8*k+4, x.i);
+}
+
+static OPUS_INLINE cpx4 cpx4_set1(kiss_twiddle_cpx tw)
+{
+   cpx4 x;
+   x.r = _mm_set1_ps(tw.r);
+   x.i = _mm_set1_ps(tw.i);
+   return x;
+}
+
+static OPUS_INLINE cpx4 cpx4_add(cpx4 a, cpx4 b)
+{
+   cpx4 x;
+   x.r = _mm_add_ps(a.r, b.r);
+   x.i = _mm_add_ps(a.i, b.i);
+   return x;
+}
+
+static OPUS_INLINE cpx4 cpx4_sub(cpx4 a, cpx4 b)
+{
+   cpx4 x;
+   x.r = _mm_sub_ps(a.r, b.r);
+   x.i = _mm_sub_ps(a.i, b.i);
+   return x;
+}
+
+/* Same products as C_MUL(). */
+static OPUS_INLINE cpx4 cpx4_mul(cpx4 a, cpx4 tw)
+{
+   cpx4 x;
+   x.r = _mm_sub_ps(_mm_mul_ps(a.r, tw.r), _mm_mul_ps(a.i, tw.i));
+   x.i = _mm_add_ps(_mm_mul_ps(a.r, tw.i), _mm_mul_ps(a.i, tw.r));
+   return x;
+}
+
+static void kf_bfly2_x4(float *F, int m, int N)
+{
+   int i;
+   if (m==1)
+   {
+      for (i=0;i<N;i++)
+      {
+         cpx4 a, b;
+         a = cpx4_load(F, 2*i);
+         b = cpx4_load(F, 2*i+1);
+         cpx4_store(F, 2*i+1, cpx4_sub(a, b));
+         cpx4_store(F, 2*i, cpx4_add(a, b));
+      }
+   } else {
+      const __m128 tw = _mm_set1_ps(0.7071067812f);
+      /* Otherwise m==4 because the radix-2 is just after a radix-4 */
+      celt_assert(m==4);
+      for (i=0;i<N;i++)
+      {
+         float *Fi = F+64*i;
+         cpx4 a, b, t, x;
+         __m128 u;
+         a = cpx4_load(Fi, 0);
+         b = cpx4_load(Fi, 4);
+         cpx4_store(Fi, 4, cpx4_sub(a, b));
+         cpx4_store(Fi, 0, cpx4_add(a, b));
+
+         a = cpx4_load(Fi, 1);
+         b = cpx4_load(Fi, 5);
+         t.r = _mm_mul_ps(_mm_add_ps(b.r, b.i), tw);
+         t.i = _mm_mul_ps(_mm_sub_ps(b.i, b.r), tw);
+         cpx4_store(Fi, 5, cpx4_sub(a, t));
+         cpx4_store(Fi, 1, cpx4_add(a, t));
+
+         /* Multiplying by -i. */
+         a = cpx4_load(Fi, 2);
+         b = cpx4_load(Fi, 6);
+         x.r = _mm_sub_ps(a.r, b.i);
+         x.i = _mm_add_ps(a.i, b.r);
+         cpx4_store(Fi, 6, x);
+         x.r = _mm_add_ps(a.r, b.i);
+         x.i = _mm_sub_ps(a.i, b.r);
+         cpx4_store(Fi, 2, x);
+
+         /* The imaginary part of the product is -u. */
+         a = cpx4_load(Fi, 3);
+         b = cpx4_load(Fi, 7);
+         t.r = _mm_mul_ps(_mm_sub_ps(b.i, b.r), tw);
+         u = _mm_mul_ps(_mm_add_ps(b.i, b.r), tw);
+         x.r = _mm_sub_ps(a.r, t.r);
+         x.i = _mm_add_ps(a.i, u);
+         cpx4_store(Fi, 7, x);
+         x.r = _mm_add_ps(a.r, t.r);
+         x.i = _mm_sub_ps(a.i, u);
+         cpx4_store(Fi, 3, x);
+      }
+   }
+}
+
+static void kf_bfly4_x4(float *F, const size_t fstride,
+      const kiss_fft_state *st, int m, int N, int mm)
+{
+   int i, j;
+   if (m==1)
+   {
+      /* Degenerate case where all the twiddles are 1. */
+      for (i=0;i<N;i++)
+      {
+         cpx4 f0, f1, f2, f3, s0, s1, x;
+         f0 = cpx4_load(F, 4*i);
+         f1 = cpx4_load(F, 4*i+1);
+         f2 = cpx4_load(F, 4*i+2);
+         f3 = cpx4_load(F, 4*i+3);
+         s0 = cpx4_sub(f0, f2);
+         f0 = cpx4_add(f0, f2);
+         s1 = cpx4_add(f1, f3);
+         cpx4_store(F, 4*i+2, cpx4_sub(f0, s1));
+         cpx4_store(F, 4*i, cpx4_add(f0, s1));
+         s1 = cpx4_sub(f1, f3);
+         x.r = _mm_add_ps(s0.r, s1.i);
+         x.i = _mm_sub_ps(s0.i, s1.r);
+         cpx4_store(F, 4*i+1, x);
+         x.r = _mm_sub_ps(s0.r, s1.i);
+         x.i = _mm_add_ps(s0.i, s1.r);
+         cpx4_store(F, 4*i+3, x);
+      }
+   } else {
+      for (j=0;j<m;j++)
+      {
+         cpx4 tw1, tw2, tw3;
+         tw1 = cpx4_set1(st->twiddles[j*fstride]);
+         tw2 = cpx4_set1(st->twiddles[2*j*fstride]);
+         tw3 = cpx4_set1(st->twiddles[3*j*fstride]);
+         for (i=0;i<N;i++)
+         {
+            float *Fi = F+8*(i*mm+j);
+            cpx4 f0, s0, s1, s2, s3, s4, s5, x;
+            s0 = cpx4_mul(cpx4_load(Fi, m), tw1);
+            s1 = cpx4_mul(cpx4_load(Fi, 2*m), tw2);
+            s2 = cpx4_mul(cpx4_load(Fi, 3*m), tw3);
+            f0 = cpx4_load(Fi, 0);
+            s5 = cpx4_sub(f0, s1);
+            f0 = cpx4_add(f0, s1);
+            s3 = cpx4_add(s0, s2);
+            s4 = cpx4_sub(s0, s2);
+            cpx4_store(Fi, 2*m, cpx4_sub(f0, s3));
+            cpx4_store(Fi, 0, cpx4_add(f0, s3));
+            x.r = _mm_add_ps(s5.r, s4.i);
+            x.i = _mm_sub_ps(s5.i, s4.r);
+            cpx4_store(Fi, m, x);
+            x.r = _mm_sub_ps(s5.r, s4.i);
+            x.i = _mm_add_ps(s5.i, s4.r);
+            cpx4_store(Fi, 3*m, x);
+         }
+      }
+   }
+}
+
+static void kf_bfly3_x4(float *F, const size_t fstride,
+      const kiss_fft_state *st, int m, int N, int mm)
+{
+   int i, k;
+   const __m128 half = _mm_set1_ps(.5f);
+   const __m128 epi3 = _mm_set1_ps(st->twiddles[fstride*m].i);
+   for (k=0;k<m;k++)
+   {
+      cpx4 tw1, tw2;
+      tw1 = cpx4_set1(st->twiddles[k*fstride]);
+      tw2 = cpx4_set1(st->twiddles[2*k*fstride]);
+      for (i=0;i<N;i++)
+      {
+         float *Fi = F+8*(i*mm+k);
+         cpx4 f0, fm, s0, s1, s2, s3, x;
+         s1 = cpx4_mul(cpx4_load(Fi, m), tw1);
+         s2 = cpx4_mul(cpx4_load(Fi, 2*m), tw2);
+         s3 = cpx4_add(s1, s2);
+         s0 = cpx4_sub(s1, s2);
+         f0 = cpx4_load(Fi, 0);
+         fm.r = _mm_sub_ps(f0.r, _mm_mul_ps(s3.r, half));
+         fm.i = _mm_sub_ps(f0.i, _mm_mul_ps(s3.i, half));
+         s0.r = _mm_mul_ps(s0.r, epi3);
+         s0.i = _mm_mul_ps(s0.i, epi3);
+         cpx4_store(Fi, 0, cpx4_add(f0, s3));
+         x.r = _mm_add_ps(fm.r, s0.i);
+         x.i = _mm_sub_ps(fm.i, s0.r);
+         cpx4_store(Fi, 2*m, x);
+         x.r = _mm_sub_ps(fm.r, s0.i);
+         x.i = _mm_add_ps(fm.i, s0.r);
+         cpx4_store(Fi, m, x);
+      }
+   }
+}
+
+static void kf_bfly5_x4(float *F, const size_t fstride,
+      const kiss_fft_state *st, int m, int N, int mm)
+{
+   int i, u;
+   __m128 yar, yai, ybr, ybi;
+   yar = _mm_set1_ps(st->twiddles[fstride*m].r);
+   yai = _mm_set1_ps(st->twiddles[fstride*m].i);
+   ybr = _mm_set1_ps(st->twiddles[fstride*2*m].r);
+   ybi = _mm_set1_ps(st->twiddles[fstride*2*m].i);
+   for (u=0;u<m;u++)
+   {
+      cpx4 tw1, tw2, tw3, tw4;
+      tw1 = cpx4_set1(st->twiddles[u*fstride]);
+      tw2 = cpx4_set1(st->twiddles[2*u*fstride]);
+      tw3 = cpx4_set1(st->twiddles[3*u*fstride]);
+      tw4 = cpx4_set1(st->twiddles[4*u*fstride]);
+      for (i=0;i<N;i++)
+      {
+         float *Fi = F+8*(i*mm+u);
+         cpx4 s0, s1, s2, s3, s4, s5, s7, s8, s9, s10, s11, s12, x;
+         __m128 s6r, s6i;
+         s0 = cpx4_load(Fi, 0);
+         s1 = cpx4_mul(cpx4_load(Fi, m), tw1);
+         s2 = cpx4_mul(cpx4_load(Fi, 2*m), tw2);
+         s3 = cpx4_mul(cpx4_load(Fi, 3*m), tw3);
+         s4 = cpx4_mul(cpx4_load(Fi, 4*m), tw4);
+
+         s7 = cpx4_add(s1, s4);
+         s10 = cpx4_sub(s1, s4);
+         s8 = cpx4_add(s2, s3);
+         s9 = cpx4_sub(s2, s3);
+
+         x.r = _mm_add_ps(s0.r, _mm_add_ps(s7.r, s8.r));
+         x.i = _mm_add_ps(s0.i, _mm_add_ps(s7.i, s8.i));
+         cpx4_store(Fi, 0, x);
+
+         s5.r = _mm_add_ps(s0.r, _mm_add_ps(_mm_mul_ps(s7.r, yar), _mm_mul_ps(s8.r, ybr)));
+         s5.i = _mm_add_ps(s0.i, _mm_add_ps(_mm_mul_ps(s7.i, yar), _mm_mul_ps(s8.i, ybr)));
+         /* s6i is the negated imaginary part. */
+         s6r = _mm_add_ps(_mm_mul_ps(s10.i, yai), _mm_mul_ps(s9.i, ybi));
+         s6i = _mm_add_ps(_mm_mul_ps(s10.r, yai), _mm_mul_ps(s9.r, ybi));
+         x.r = _mm_sub_ps(s5.r, s6r);
+         x.i = _mm_add_ps(s5.i, s6i);
+         cpx4_store(Fi, m, x);
+         x.r = _mm_add_ps(s5.r, s6r);
+         x.i = _mm_sub_ps(s5.i, s6i);
+         cpx4_store(Fi, 4*m, x);
+
+         s11.r = _mm_add_ps(s0.r, _mm_add_ps(_mm_mul_ps(s7.r, ybr), _mm_mul_ps(s8.r, yar)));
+         s11.i = _mm_add_ps(s0.i, _mm_add_ps(_mm_mul_ps(s7.i, ybr), _mm_mul_ps(s8.i, yar)));
+         s12.r = _mm_sub_ps(_mm_mul_ps(s9.i, yai), _mm_mul_ps(s10.i, ybi));
+         s12.i = _mm_sub_ps(_mm_mul_ps(s10.r, ybi), _mm_mul_ps(s9.r, yai));
+         cpx4_store(Fi, 2*m, cpx4_add(s11, s12));
+         cpx4_store(Fi, 3*m, cpx4_sub(s11, s12));
+      }
+   }
+}
+
+/* opus_fft_impl() of the four transforms in F. */
+static void fft_x4(const kiss_fft_state *st, float *F)
+{
+   int m2, m;
+   int p;
+   int L;
+   int fstride[MAXFACTORS];
+   int i;
+   int shift;
+
+   /* st->shift can be -1 */
+   shift = st->shift>0 ? st->shift : 0;
+
+   fstride[0] = 1;
+   L=0;
+   do {
+      p = st->factors[2*L];
+      m = st->factors[2*L+1];
+      fstride[L+1] = fstride[L]*p;
+      L++;
+   } while(m!=1);
+   m = st->factors[2*L-1];
+   for (i=L-1;i>=0;i--)
+   {
+      if (i!=0)
+         m2 = st->factors[2*i-1];
+      else
+         m2 = 1;
+      switch (st->factors[2*i])
+      {
+      case 2:
+         kf_bfly2_x4(F, m, fstride[i]);
+         break;
+      case 4:
+         kf_bfly4_x4(F, fstride[i]<<shift, st, m, fstride[i], m2);
+         break;
+      case 3:
+         kf_bfly3_x4(F, fstride[i]<<shift, st, m, fstride[i], m2);
+         break;
+      case 5:
+         kf_bfly5_x4(F, fstride[i]<<shift, st, m, fstride[i], m2);
+         break;
+      }
+      m = m2;
+   }
+}
+
+static OPUS_INLINE void pre_rotate_x4(float *F, int k, __m128 re, __m128 im,
+      float t0, float t1, __m128 scale)
+{
+   cpx4 y;
+   __m128 c, s;
+   c = _mm_set1_ps(t0);
+   s = _mm_set1_ps(t1);
+   y.r = _mm_mul_ps(scale, _mm_sub_ps(_mm_mul_ps(re, c), _mm_mul_ps(im, s)));
+   y.i = _mm_mul_ps(scale, _mm_add_ps(_mm_mul_ps(im, c), _mm_mul_ps(re, s)));
+   cpx4_store(F, k, y);
+}
+
+/* Forward MDCTs of the four transforms in[k] -> out[k], one per lane. */
+static void mdct_forward_x4(const mdct_lookup *l, kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out, const opus_val16 *window,
+      int overlap, int shift, int stride)
+{
+   int i, k;
+   int N, N2, N4;
+   int contiguous;
+   VARDECL(kiss_fft_scalar, f);
+   VARDECL(float, F);
+   float *fr[4], *fi[4];
+   const kiss_fft_state *st = l->kfft[shift];
+   const kiss_twiddle_scalar *trig;
+   SAVE_STACK;
+
+   N = l->n;
+   trig = l->trig;
+   for (i=0;i<shift;i++)
+   {
+      N >>= 1;
+      trig += N;
+   }
+   N2 = N>>1;
+   N4 = N>>2;
+
+   ALLOC(f, 4*N2, kiss_fft_scalar);
+   ALLOC(F, 8*N4, float);
+   for (k=0;k<4;k++)
+   {
+      fr[k] = f+k*N2;
+      fi[k] = fr[k]+N4;
+   }
+
+   /* Window, shuffle, fold */
+   for (k=0;k<4;k++)
+      fold_sse(in[k], window, overlap, N2, N4, fr[k], fi[k]);
+
+   /* Pre-rotation, transposing four points at a time into the lanes */
+   {
+      const kiss_twiddle_scalar *t = trig;
+      const __m128 scale = _mm_set1_ps(st->scale);
+      for (i=0;i<N4-3;i+=4)
+      {
+         __m128 re[4], im[4];
+         for (k=0;k<4;k++)
+         {
+            re[k] = _mm_loadu_ps(fr[k]+i);
+            im[k] = _mm_loadu_ps(fi[k]+i);
+         }
+         _MM_TRANSPOSE4_PS(re[0], re[1], re[2], re[3]);
+         _MM_TRANSPOSE4_PS(im[0], im[1], im[2], im[3]);
+         for (k=0;k<4;k++)
+            pre_rotate_x4(F, st->bitrev[i+k], re[k], im[k], t[i+k], t[N4+i+k], scale);
+      }
+      for (;i<N4;i++)
+      {
+         pre_rotate_x4(F, st->bitrev[i],
+               _mm_setr_ps(fr[0][i], fr[1][i], fr[2][i], fr[3][i]),
+               _mm_setr_ps(fi[0][i], fi[1][i], fi[2][i], fi[3][i]),
+               t[i], t[N4+i], scale);
+      }
+   }
+
+   /* N/4 complex FFT, does not downscale anymore */
+   fft_x4(st, F);
+
+   /* Post-rotate. Consecutive blocks of a channel are next to each other in
+      the interleaved output. */
+   contiguous = out[1]==out[0]+1 && out[2]==out[0]+2 && out[3]==out[0]+3;
+   {
+      const kiss_twiddle_scalar *t = trig;
+      for (i=0;i<N4;i++)
+      {
+         cpx4 z;
+         __m128 c, s, yr, yi;
+         z = cpx4_load(F, i);
+         c = _mm_set1_ps(t[i]);
+         s = _mm_set1_ps(t[N4+i]);
+         yr = _mm_sub_ps(_mm_mul_ps(z.i, s), _mm_mul_ps(z.r, c));
+         yi = _mm_add_ps(_mm_mul_ps(z.r, s), _mm_mul_ps(z.i, c));
+         if (contiguous)
+         {
+            _mm_storeu_ps(out[0]+2*i*stride, yr);
+            _mm_storeu_ps(out[0]+(N2-1-2*i)*stride, yi);
+         } else {
+            float a[4], b[4];
+            _mm_storeu_ps(a, yr);
+            _mm_storeu_ps(b, yi);
+            for (k=0;k<4;k++)
+            {
+               out[k][2*i*stride] = a[k];
+               out[k][(N2-1-2*i)*stride] = b[k];
+            }
+         }
+      }
+   }
+   RESTORE_STACK;
+}
+
+/* Backward MDCTs of the four transforms in[k] -> out[k], one per lane, as
+   for mdct_forward_x4(). The outputs are overlap-added in order. */
+static void mdct_backward_x4(const mdct_lookup *l, kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out, const opus_val16 * OPUS_RESTRICT window,
+      int overlap, int shift, int stride)
+{
+   int i, k;
+   int N, N2, N4;
+   int contiguous;
+   VARDECL(kiss_fft_scalar, f);
+   VARDECL(float, F);
+   const float *x[4];
+   float *fr[4], *fi[4];
+   const kiss_fft_state *st = l->kfft[shift];
+   const kiss_twiddle_scalar *trig;
+   SAVE_STACK;
+
+   N = l->n;
+   trig = l->trig;
+   for (i=0;i<shift;i++)
+   {
+      N >>= 1;
+      trig += N;
+   }
+   N2 = N>>1;
+   N4 = N>>2;
+
+   ALLOC(f, 4*N2, kiss_fft_scalar);
+   ALLOC(F, 8*N4, float);
+   for (k=0;k<4;k++)
+   {
+      x[k] = in[k];
+      fr[k] = f+k*N2;
+      fi[k] = fr[k]+N4;
+   }
+   contiguous = in[1]==in[0]+1 && in[2]==in[0]+2 && in[3]==in[0]+3;
+
+   /* Pre-rotate */
+   {
+      const kiss_twiddle_scalar *t = trig;
+      for (i=0;i<N4;i++)
+      {
+         int j1, j2;
+         __m128 x1, x2, c, s;
+         cpx4 y;
+         j1 = 2*i*stride;
+         j2 = (N2-1-2*i)*stride;
+         if (contiguous)
+         {
+            x1 = _mm_loadu_ps(x[0]+j1);
+            x2 = _mm_loadu_ps(x[0]+j2);
+         } else {
+            x1 = _mm_setr_ps(x[0][j1], x[1][j1], x[2][j1], x[3][j1]);
+            x2 = _mm_setr_ps(x[0][j2], x[1][j2], x[2][j2], x[3][j2]);
+         }
+         c = _mm_set1_ps(t[i]);
+         s = _mm_set1_ps(t[N4+i]);
+         /* We swap real and imag because we use an FFT instead of an IFFT. */
+         y.i = _mm_add_ps(_mm_mul_ps(x2, c), _mm_mul_ps(x1, s));
+         y.r = _mm_sub_ps(_mm_mul_ps(x1, c), _mm_mul_ps(x2, s));
+         cpx4_store(F, st->bitrev[i], y);
+      }
+   }
+
+   fft_x4(st, F);
+
+   /* Post-rotate, transposing four points at a time out of the lanes */
+   {
+      const kiss_twiddle_scalar *t = trig;
+      for (i=0;i<N4;i+=4)
+      {
+         int len;
+         __m128 a[4], b[4];
+         len = IMIN(4, N4-i);
+         for (k=0;k<len;k++)
+         {
+            cpx4 z;
+            __m128 re, im, c, s;
+            /* We swap real and imag because we're using an FFT instead of an IFFT. */
+            z = cpx4_load(F, i+k);
+            re = z.i;
+            im = z.r;
+            c = _mm_set1_ps(t[i+k]);
+            s = _mm_set1_ps(t[N4+i+k]);
+            a[k] = _mm_add_ps(_mm_mul_ps(re, c), _mm_mul_ps(im, s));
+            b[k] = _mm_sub_ps(_mm_mul_ps(re, s), _mm_mul_ps(im, c));
+         }
+         for (;k<4;k++)
+            a[k] = b[k] = _mm_setzero_ps();
+         _MM_TRANSPOSE4_PS(a[0], a[1], a[2], a[3]);
+         _MM_TRANSPOSE4_PS(b[0], b[1], b[2], b[3]);
+         for (k=0;k<4;k++)
+         {
+            if (len==4)
+            {
+               _mm_storeu_ps(fr[k]+i, a[k]);
+               _mm_storeu_ps(fi[k]+i, b[k]);
+            } else {
+               int j;
+               float ta[4], tb[4];
+               _mm_storeu_ps(ta, a[k]);
+               _mm_storeu_ps(tb, b[k]);
+               for (j=0;j<len;j++)
+               {
+                  fr[k][i+j] = ta[j];
+                  fi[k][i+j] = tb[j];
+               }
+            }
+         }
+      }
+   }
+
+   for (k=0;k<4;k++)
+   {
+      interleave_sse(fr[k], fi[k], out[k]+(overlap>>1), N4, 1);
+      /* Mirror on both sides for TDAC */
+      mirror_sse(out[k], window, overlap);
+   }
+   RESTORE_STACK;
+}
+
+/* A long MDCT already fills the lanes within the transform, so only short
+   blocks are batched, four at a time. Any left over use the single
+   transform. */
+void clt_mdct_forward_multi_sse(const mdct_lookup *l, kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out, int C, int B, const opus_val16 *window,
+      int overlap, int shift, int arch)
+{
+   int t, k;
+   int T, N2;
+   N2 = (l->n>>shift)>>1;
+   T = C*B;
+   t = 0;
+   if (B>1)
+   {
+      for (;t+4<=T;t+=4)
+      {
+         kiss_fft_scalar *x[4], *y[4];
+         for (k=0;k<4;k++)
+         {
+            x[k] = in[(t+k)/B]+(t+k)%B*N2;
+            y[k] = out[(t+k)/B]+(t+k)%B;
+         }
+         mdct_forward_x4(l, x, y, window, overlap, shift, B);
+      }
+   }
+   for (;t<T;t++)
+      clt_mdct_forward_sse(l, in[t/B]+t%B*N2, out[t/B]+t%B, window, overlap,
+            shift, B, arch);
+}
+
+/* Unlike the forward transforms, the backward ones are batched four at a
+   time whatever their size. When the frames of several decoders are
+   synthesized together there are enough long blocks to fill the groups, and
+   running them in lanes is still faster than one at a time. Any left over
+   use the single transform. */
+void clt_mdct_backward_multi_sse(const mdct_lookup *l, kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out, int C, int B,
+      const opus_val16 * OPUS_RESTRICT window, int overlap, int shift, int arch)
+{
+   int t, k;
+   int T, N2;
+   N2 = (l->n>>shift)>>1;
+   T = C*B;
+   t = 0;
+   for (;t+4<=T;t+=4)
+   {
+      kiss_fft_scalar *x[4], *y[4];
+      for (k=0;k<4;k++)
+      {
+         x[k] = in[(t+k)/B]+(t+k)%B;
+         y[k] = out[(t+k)/B]+(t+k)%B*N2;
+      }
+      mdct_backward_x4(l, x, y, window, overlap, shift, B);
+   }
+   for (;t<T;t++)
+      clt_mdct_backward_sse(l, in[t/B]+t%B, out[t/B]+t%B*N2, window, overlap,
+            shift, B, arch);
+}
+
+#endif
@@ -0,0 +1,211 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "macros.h"
+#include "celt_lpc.h"
+#include "stack_alloc.h"
+#include "mathops.h"
+#include "pitch.h"
+
+#if defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(FIXED_POINT)
+
+#include <immintrin.h>
+#include "arch.h"
+
+static OPUS_INLINE float horizontal_sum_avx2(__m256 x)
+{
+   __m128 sum;
+   sum = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+   sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+   sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+   return _mm_cvtss_f32(sum);
+}
+
+void xcorr_kernel_avx2(const opus_val16 *x, const opus_val16 *y, opus_val32 sum[4], int len)
+{
+   int j;
+   __m256 xsum1, xsum2;
+   __m256i even, odd;
+   __m128 xsum;
+   /* The low lane computes the four lags for x[j] and the high lane the four
+      lags for x[j+1], so each FMA covers two taps. */
+   even = _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1);
+   odd = _mm256_setr_epi32(2, 2, 2, 2, 3, 3, 3, 3);
+   xsum1 = _mm256_setzero_ps();
+   xsum2 = _mm256_setzero_ps();
+   for (j=0;j<len-3;j+=4)
+   {
+      __m256 x0, y01, y23;
+      x0 = _mm256_castps128_ps256(_mm_loadu_ps(x+j));
+      y01 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(y+j)),
+                                 _mm_loadu_ps(y+j+1), 1);
+      y23 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(y+j+2)),
+                                 _mm_loadu_ps(y+j+3), 1);
+      xsum1 = _mm256_fmadd_ps(_mm256_permutevar8x32_ps(x0, even), y01, xsum1);
+      xsum2 = _mm256_fmadd_ps(_mm256_permutevar8x32_ps(x0, odd), y23, xsum2);
+   }
+   xsum1 = _mm256_add_ps(xsum1, xsum2);
+   xsum = _mm_add_ps(_mm256_castps256_ps128(xsum1), _mm256_extractf128_ps(xsum1, 1));
+   xsum = _mm_add_ps(xsum, _mm_loadu_ps(sum));
+   for (;j<len;j++)
+   {
+      xsum = _mm_fmadd_ps(_mm_set1_ps(x[j]), _mm_loadu_ps(y+j), xsum);
+   }
+   _mm_storeu_ps(sum, xsum);
+}
+
+void celt_pitch_xcorr_avx2(const opus_val16 *_x, const opus_val16 *_y,
+      opus_val32 *xcorr, int len, int max_pitch, int arch)
+{
+   int i, j;
+   (void)arch;
+   celt_assert(max_pitch>0);
+   /* Eight lags at a time: one broadcast of x[j] against eight consecutive
+      y values. Four accumulators hide the FMA latency. */
+   for (i=0;i<max_pitch-7;i+=8)
+   {
+      __m256 sum0, sum1, sum2, sum3;
+      const opus_val16 *y = _y+i;
+      sum0 = _mm256_setzero_ps();
+      sum1 = _mm256_setzero_ps();
+      sum2 = _mm256_setzero_ps();
+      sum3 = _mm256_setzero_ps();
+      for (j=0;j<len-3;j+=4)
+      {
+         sum0 = _mm256_fmadd_ps(_mm256_broadcast_ss(_x+j), _mm256_loadu_ps(y+j), sum0);
+         sum1 = _mm256_fmadd_ps(_mm256_broadcast_ss(_x+j+1), _mm256_loadu_ps(y+j+1), sum1);
+         sum2 = _mm256_fmadd_ps(_mm256_broadcast_ss(_x+j+2), _mm256_loadu_ps(y+j+2), sum2);
+         sum3 = _mm256_fmadd_ps(_mm256_broadcast_ss(_x+j+3), _mm256_loadu_ps(y+j+3), sum3);
+      }
+      for (;j<len;j++)
+      {
+         sum0 = _mm256_fmadd_ps(_mm256_broadcast_ss(_x+j), _mm256_loadu_ps(y+j), sum0);
+      }
+      sum0 = _mm256_add_ps(_mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3));
+      _mm256_storeu_ps(xcorr+i, sum0);
+   }
+   for (;i<max_pitch-3;i+=4)
+   {
+      opus_val32 sum[4]={0,0,0,0};
+      xcorr_kernel_avx2(_x, _y+i, sum, len);
+      xcorr[i]=sum[0];
+      xcorr[i+1]=sum[1];
+      xcorr[i+2]=sum[2];
+      xcorr[i+3]=sum[3];
+   }
+   for (;i<max_pitch;i++)
+   {
+      xcorr[i] = celt_inner_prod_avx2(_x, _y+i, len);
+   }
+}
+
+void dual_inner_prod_avx2(const opus_val16 *x, const opus_val16 *y01, const opus_val16 *y02,
+      int N, opus_val32 *xy1, opus_val32 *xy2)
+{
+   int i;
+   __m256 xsum1, xsum2;
+   xsum1 = _mm256_setzero_ps();
+   xsum2 = _mm256_setzero_ps();
+   for (i=0;i<N-7;i+=8)
+   {
+      __m256 xi = _mm256_loadu_ps(x+i);
+      xsum1 = _mm256_fmadd_ps(xi, _mm256_loadu_ps(y01+i), xsum1);
+      xsum2 = _mm256_fmadd_ps(xi, _mm256_loadu_ps(y02+i), xsum2);
+   }
+   *xy1 = horizontal_sum_avx2(xsum1);
+   *xy2 = horizontal_sum_avx2(xsum2);
+   for (;i<N;i++)
+   {
+      *xy1 = MAC16_16(*xy1, x[i], y01[i]);
+      *xy2 = MAC16_16(*xy2, x[i], y02[i]);
+   }
+}
+
+opus_val32 celt_inner_prod_avx2(const opus_val16 *x, const opus_val16 *y,
+      int N)
+{
+   int i;
+   float xy;
+   __m256 sum1, sum2;
+   sum1 = _mm256_setzero_ps();
+   sum2 = _mm256_setzero_ps();
+   for (i=0;i<N-15;i+=16)
+   {
+      sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(x+i), _mm256_loadu_ps(y+i), sum1);
+      sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(x+i+8), _mm256_loadu_ps(y+i+8), sum2);
+   }
+   if (i<N-7)
+   {
+      sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(x+i), _mm256_loadu_ps(y+i), sum1);
+      i += 8;
+   }
+   xy = horizontal_sum_avx2(_mm256_add_ps(sum1, sum2));
+   for (;i<N;i++)
+   {
+      xy = MAC16_16(xy, x[i], y[i]);
+   }
+   return xy;
+}
+
+void comb_filter_const_avx2(opus_val32 *y, opus_val32 *x, int T, int N,
+      opus_val16 g10, opus_val16 g11, opus_val16 g12)
+{
+   int i;
+   __m256 g10v, g11v, g12v;
+   g10v = _mm256_set1_ps(g10);
+   g11v = _mm256_set1_ps(g11);
+   g12v = _mm256_set1_ps(g12);
+   /* T >= COMBFILTER_MINPERIOD, so all the x[i-T+k] loads of an iteration
+      are behind the y[i..i+7] store even when filtering in place. */
+   for (i=0;i<N-7;i+=8)
+   {
+      __m256 yi, yi2, x0v, x1v, x2v, x3v, x4v;
+      const opus_val32 *xp = &x[i-T-2];
+      x0v = _mm256_loadu_ps(xp);
+      x1v = _mm256_loadu_ps(xp+1);
+      x2v = _mm256_loadu_ps(xp+2);
+      x3v = _mm256_loadu_ps(xp+3);
+      x4v = _mm256_loadu_ps(xp+4);
+      yi = _mm256_fmadd_ps(g10v, x2v, _mm256_loadu_ps(x+i));
+      /* Use partial sums, as in the SSE version */
+      yi2 = _mm256_fmadd_ps(g12v, _mm256_add_ps(x4v, x0v),
+                            _mm256_mul_ps(g11v, _mm256_add_ps(x3v, x1v)));
+      _mm256_storeu_ps(y+i, _mm256_add_ps(yi, yi2));
+   }
+   for (;i<N;i++)
+   {
+      y[i] = x[i]
+               + MULT16_32_Q15(g10,x[i-T])
+               + MULT16_32_Q15(g11,ADD32(x[i-T+1],x[i-T-1]))
+               + MULT16_32_Q15(g12,ADD32(x[i-T+2],x[i-T-2]));
+   }
+}
+
+#endif
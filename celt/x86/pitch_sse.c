@@ -34,6 +34,7 @@
 #include "stack_alloc.h"
 #include "mathops.h"
 #include "pitch.h"
+#include "celt.h"
 
 #if defined(OPUS_X86_MAY_HAVE_SSE) && !defined(FIXED_POINT)
 
@@ -182,4 +183,79 @@ void comb_filter_const_sse(opus_val32 *y, opus_val32 *x, int T, int N,
 }
 
 
+/* Runs four channels at a time, one per lane. Each block of four samples is
+   transposed so that the recursion steps through time with all four lanes
+   in parallel. The arithmetic is that of deemphasis_multi_c(), so the output
+   is bit-exact. */
+void deemphasis_multi_sse(celt_sig * const *in, opus_val16 * const *pcm,
+      const int *stride, int N, int count, opus_val16 coef0,
+      celt_sig * const *mem)
+{
+   int k, j, l;
+   __m128 coef, scale, small;
+   coef = _mm_set1_ps(coef0);
+   scale = _mm_set1_ps(1/CELT_SIG_SCALE);
+   small = _mm_set1_ps(VERY_SMALL);
+   for (k=0;k+4<=count;k+=4)
+   {
+      __m128 m;
+      float mv[4];
+      m = _mm_setr_ps(*mem[k], *mem[k+1], *mem[k+2], *mem[k+3]);
+      for (j=0;j+4<=N;j+=4)
+      {
+         __m128 x0, x1, x2, x3;
+         float y[4][4];
+         x0 = _mm_loadu_ps(in[k]+j);
+         x1 = _mm_loadu_ps(in[k+1]+j);
+         x2 = _mm_loadu_ps(in[k+2]+j);
+         x3 = _mm_loadu_ps(in[k+3]+j);
+         _MM_TRANSPOSE4_PS(x0, x1, x2, x3);
+         x0 = _mm_add_ps(_mm_add_ps(x0, small), m);
+         m = _mm_mul_ps(coef, x0);
+         x1 = _mm_add_ps(_mm_add_ps(x1, small), m);
+         m = _mm_mul_ps(coef, x1);
+         x2 = _mm_add_ps(_mm_add_ps(x2, small), m);
+         m = _mm_mul_ps(coef, x2);
+         x3 = _mm_add_ps(_mm_add_ps(x3, small), m);
+         m = _mm_mul_ps(coef, x3);
+         x0 = _mm_mul_ps(x0, scale);
+         x1 = _mm_mul_ps(x1, scale);
+         x2 = _mm_mul_ps(x2, scale);
+         x3 = _mm_mul_ps(x3, scale);
+         _MM_TRANSPOSE4_PS(x0, x1, x2, x3);
+         _mm_storeu_ps(y[0], x0);
+         _mm_storeu_ps(y[1], x1);
+         _mm_storeu_ps(y[2], x2);
+         _mm_storeu_ps(y[3], x3);
+         for (l=0;l<4;l++)
+         {
+            opus_val16 *out = pcm[k+l]+j*stride[k+l];
+            int s = stride[k+l];
+            out[0] = y[l][0];
+            out[s] = y[l][1];
+            out[2*s] = y[l][2];
+            out[3*s] = y[l][3];
+         }
+      }
+      _mm_storeu_ps(mv, m);
+      for (l=0;l<4;l++)
+      {
+         int i;
+         const celt_sig *x = in[k+l];
+         opus_val16 *y = pcm[k+l];
+         int s = stride[k+l];
+         float ml = mv[l];
+         for (i=j;i<N;i++)
+         {
+            celt_sig tmp = x[i] + VERY_SMALL + ml;
+            ml = MULT16_32_Q15(coef0, tmp);
+            y[i*s] = SCALEOUT(SIG2WORD16(tmp));
+         }
+         *mem[k+l] = ml;
+      }
+   }
+   if (k<count)
+      deemphasis_multi_c(in+k, pcm+k, stride+k, N, count-k, coef0, mem+k);
+}
+
 #endif
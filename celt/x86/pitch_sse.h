@@ -53,12 +53,25 @@ void xcorr_kernel_sse(
                     int              len);
 #endif
 
+#if defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(FIXED_POINT)
+void xcorr_kernel_avx2(
+                    const opus_val16 *x,
+                    const opus_val16 *y,
+                    opus_val32       sum[4],
+                    int              len);
+#endif
+
 #if defined(OPUS_X86_PRESUME_SSE4_1) && defined(FIXED_POINT)
 #define OVERRIDE_XCORR_KERNEL
 #define xcorr_kernel(x, y, sum, len, arch) \
     ((void)arch, xcorr_kernel_sse4_1(x, y, sum, len))
 
-#elif defined(OPUS_X86_PRESUME_SSE) && !defined(FIXED_POINT)
+#elif defined(OPUS_X86_PRESUME_AVX2) && !defined(FIXED_POINT)
+#define OVERRIDE_XCORR_KERNEL
+#define xcorr_kernel(x, y, sum, len, arch) \
+    ((void)arch, xcorr_kernel_avx2(x, y, sum, len))
+
+#elif defined(OPUS_X86_PRESUME_SSE) && !defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(FIXED_POINT)
 #define OVERRIDE_XCORR_KERNEL
 #define xcorr_kernel(x, y, sum, len, arch) \
     ((void)arch, xcorr_kernel_sse(x, y, sum, len))
@@ -98,6 +111,13 @@ opus_val32 celt_inner_prod_sse(
     int               N);
 #endif
 
+#if defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(FIXED_POINT)
+opus_val32 celt_inner_prod_avx2(
+    const opus_val16 *x,
+    const opus_val16 *y,
+    int               N);
+#endif
+
 
 #if defined(OPUS_X86_PRESUME_SSE4_1) && defined(FIXED_POINT)
 #define OVERRIDE_CELT_INNER_PROD
@@ -109,7 +129,12 @@ opus_val32 celt_inner_prod_sse(
 #define celt_inner_prod(x, y, N, arch) \
     ((void)arch, celt_inner_prod_sse2(x, y, N))
 
-#elif defined(OPUS_X86_PRESUME_SSE) && !defined(FIXED_POINT)
+#elif defined(OPUS_X86_PRESUME_AVX2) && !defined(FIXED_POINT)
+#define OVERRIDE_CELT_INNER_PROD
+#define celt_inner_prod(x, y, N, arch) \
+    ((void)arch, celt_inner_prod_avx2(x, y, N))
+
+#elif defined(OPUS_X86_PRESUME_SSE) && !defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(FIXED_POINT)
 #define OVERRIDE_CELT_INNER_PROD
 #define celt_inner_prod(x, y, N, arch) \
     ((void)arch, celt_inner_prod_sse(x, y, N))
@@ -152,8 +177,31 @@ void comb_filter_const_sse(opus_val32 *y,
     opus_val16  g11,
     opus_val16  g12);
 
+#if defined(OPUS_X86_MAY_HAVE_AVX2)
+void dual_inner_prod_avx2(const opus_val16 *x,
+    const opus_val16 *y01,
+    const opus_val16 *y02,
+    int               N,
+    opus_val32       *xy1,
+    opus_val32       *xy2);
 
-#if defined(OPUS_X86_PRESUME_SSE)
+void comb_filter_const_avx2(opus_val32 *y,
+    opus_val32 *x,
+    int         T,
+    int         N,
+    opus_val16  g10,
+    opus_val16  g11,
+    opus_val16  g12);
+#endif
+
+
+#if defined(OPUS_X86_PRESUME_AVX2)
+# define dual_inner_prod(x, y01, y02, N, xy1, xy2, arch) \
+    ((void)(arch),dual_inner_prod_avx2(x, y01, y02, N, xy1, xy2))
+
+# define comb_filter_const(y, x, T, N, g10, g11, g12, arch) \
+    ((void)(arch),comb_filter_const_avx2(y, x, T, N, g10, g11, g12))
+#elif defined(OPUS_X86_PRESUME_SSE) && !defined(OPUS_X86_MAY_HAVE_AVX2)
 # define dual_inner_prod(x, y01, y02, N, xy1, xy2, arch) \
     ((void)(arch),dual_inner_prod_sse(x, y01, y02, N, xy1, xy2))
 
@@ -189,4 +237,69 @@ extern void (*const COMB_FILTER_CONST_IMPL[OPUS_ARCHMASK + 1])(
 #endif
 #endif
 
+#if defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(FIXED_POINT)
+
+#define OVERRIDE_PITCH_XCORR
+
+void celt_pitch_xcorr_avx2(const opus_val16 *_x,
+    const opus_val16 *_y,
+    opus_val32       *xcorr,
+    int               len,
+    int               max_pitch,
+    int               arch);
+
+#if defined(OPUS_X86_PRESUME_AVX2)
+# define celt_pitch_xcorr celt_pitch_xcorr_avx2
+
+#else
+
+extern void (*const CELT_PITCH_XCORR_IMPL[OPUS_ARCHMASK + 1])(
+              const opus_val16 *_x,
+              const opus_val16 *_y,
+              opus_val32       *xcorr,
+              int               len,
+              int               max_pitch,
+              int               arch);
+
+# define celt_pitch_xcorr(_x, _y, xcorr, len, max_pitch, arch) \
+    ((*CELT_PITCH_XCORR_IMPL[(arch) & OPUS_ARCHMASK])(_x, _y, \
+      xcorr, len, max_pitch, arch))
+
+#endif
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_SSE) && !defined(FIXED_POINT)
+
+#define OVERRIDE_DEEMPHASIS_MULTI
+
+#undef deemphasis_multi
+
+void deemphasis_multi_sse(celt_sig * const *in,
+    opus_val16 * const *pcm,
+    const int  *stride,
+    int         N,
+    int         count,
+    opus_val16  coef0,
+    celt_sig * const *mem);
+
+#if defined(OPUS_X86_PRESUME_SSE)
+# define deemphasis_multi(in, pcm, stride, N, count, coef0, mem, arch) \
+    ((void)(arch),deemphasis_multi_sse(in, pcm, stride, N, count, coef0, mem))
+#else
+
+extern void (*const DEEMPHASIS_MULTI_IMPL[OPUS_ARCHMASK + 1])(
+              celt_sig * const *in,
+              opus_val16 * const *pcm,
+              const int  *stride,
+              int         N,
+              int         count,
+              opus_val16  coef0,
+              celt_sig * const *mem);
+
+#define deemphasis_multi(in, pcm, stride, N, count, coef0, mem, arch) \
+    ((*DEEMPHASIS_MULTI_IMPL[(arch) & OPUS_ARCHMASK])(in, pcm, stride, N, count, coef0, mem))
+
+#endif
+#endif
+
 #endif
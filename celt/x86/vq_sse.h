@@ -32,7 +32,15 @@
 
 opus_val16 op_pvq_search_sse2(celt_norm *_X, int *iy, int K, int N, int arch);
 
-#if defined(OPUS_X86_PRESUME_SSE2)
+#if defined(OPUS_X86_MAY_HAVE_AVX2)
+opus_val16 op_pvq_search_avx2(celt_norm *_X, int *iy, int K, int N, int arch);
+#endif
+
+#if defined(OPUS_X86_PRESUME_AVX2)
+#define op_pvq_search(x, iy, K, N, arch) \
+    (op_pvq_search_avx2(x, iy, K, N, arch))
+
+#elif defined(OPUS_X86_PRESUME_SSE2) && !defined(OPUS_X86_MAY_HAVE_AVX2)
 #define op_pvq_search(x, iy, K, N, arch) \
     (op_pvq_search_sse2(x, iy, K, N, arch))
 
@@ -30,10 +30,13 @@
 #endif
 
 #include "x86/x86cpu.h"
+#include "celt.h"
 #include "celt_lpc.h"
 #include "pitch.h"
 #include "pitch_sse.h"
 #include "vq.h"
+#include "kiss_fft.h"
+#include "mdct.h"
 
 #if defined(OPUS_HAVE_RTCD)
 
@@ -53,7 +56,8 @@ void (*const CELT_FIR_IMPL[OPUS_ARCHMASK + 1])(
   celt_fir_c,
   celt_fir_c,
   MAY_HAVE_SSE4_1(celt_fir), /* sse4.1  */
-  MAY_HAVE_SSE4_1(celt_fir)  /* avx  */
+  MAY_HAVE_SSE4_1(celt_fir), /* avx  */
+  MAY_HAVE_SSE4_1(celt_fir)  /* avx2 */
 };
 
 void (*const XCORR_KERNEL_IMPL[OPUS_ARCHMASK + 1])(
@@ -66,7 +70,8 @@ void (*const XCORR_KERNEL_IMPL[OPUS_ARCHMASK + 1])(
   xcorr_kernel_c,
   xcorr_kernel_c,
   MAY_HAVE_SSE4_1(xcorr_kernel), /* sse4.1  */
-  MAY_HAVE_SSE4_1(xcorr_kernel)  /* avx  */
+  MAY_HAVE_SSE4_1(xcorr_kernel), /* avx  */
+  MAY_HAVE_SSE4_1(xcorr_kernel)  /* avx2 */
 };
 
 #endif
@@ -83,14 +88,16 @@ opus_val32 (*const CELT_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
   celt_inner_prod_c,
   MAY_HAVE_SSE2(celt_inner_prod),
   MAY_HAVE_SSE4_1(celt_inner_prod), /* sse4.1  */
-  MAY_HAVE_SSE4_1(celt_inner_prod)  /* avx  */
+  MAY_HAVE_SSE4_1(celt_inner_prod), /* avx  */
+  MAY_HAVE_SSE4_1(celt_inner_prod)  /* avx2 */
 };
 
 #endif
 
 # else
 
-#if defined(OPUS_X86_MAY_HAVE_SSE) && !defined(OPUS_X86_PRESUME_SSE)
+#if (defined(OPUS_X86_MAY_HAVE_SSE) && !defined(OPUS_X86_PRESUME_SSE)) || \
+ (defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2))
 
 void (*const XCORR_KERNEL_IMPL[OPUS_ARCHMASK + 1])(
          const opus_val16 *x,
@@ -102,7 +109,8 @@ void (*const XCORR_KERNEL_IMPL[OPUS_ARCHMASK + 1])(
   MAY_HAVE_SSE(xcorr_kernel),
   MAY_HAVE_SSE(xcorr_kernel),
   MAY_HAVE_SSE(xcorr_kernel),
-  MAY_HAVE_SSE(xcorr_kernel)
+  MAY_HAVE_SSE(xcorr_kernel),
+  MAY_HAVE_AVX2(xcorr_kernel)
 };
 
 opus_val32 (*const CELT_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
@@ -114,7 +122,8 @@ opus_val32 (*const CELT_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
   MAY_HAVE_SSE(celt_inner_prod),
   MAY_HAVE_SSE(celt_inner_prod),
   MAY_HAVE_SSE(celt_inner_prod),
-  MAY_HAVE_SSE(celt_inner_prod)
+  MAY_HAVE_SSE(celt_inner_prod),
+  MAY_HAVE_AVX2(celt_inner_prod)
 };
 
 void (*const DUAL_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
@@ -129,7 +138,8 @@ void (*const DUAL_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
   MAY_HAVE_SSE(dual_inner_prod),
   MAY_HAVE_SSE(dual_inner_prod),
   MAY_HAVE_SSE(dual_inner_prod),
-  MAY_HAVE_SSE(dual_inner_prod)
+  MAY_HAVE_SSE(dual_inner_prod),
+  MAY_HAVE_AVX2(dual_inner_prod)
 };
 
 void (*const COMB_FILTER_CONST_IMPL[OPUS_ARCHMASK + 1])(
@@ -145,13 +155,148 @@ void (*const COMB_FILTER_CONST_IMPL[OPUS_ARCHMASK + 1])(
   MAY_HAVE_SSE(comb_filter_const),
   MAY_HAVE_SSE(comb_filter_const),
   MAY_HAVE_SSE(comb_filter_const),
-  MAY_HAVE_SSE(comb_filter_const)
+  MAY_HAVE_SSE(comb_filter_const),
+  MAY_HAVE_AVX2(comb_filter_const)
+};
+
+void (*const OPUS_FFT_IMPL[OPUS_ARCHMASK + 1])(
+      const kiss_fft_state *st,
+      kiss_fft_cpx         *fout
+) = {
+  opus_fft_impl_c,                /* non-sse */
+  MAY_HAVE_SSE(opus_fft_impl),
+  MAY_HAVE_SSE(opus_fft_impl),
+  MAY_HAVE_SSE(opus_fft_impl),
+  MAY_HAVE_SSE(opus_fft_impl),
+  MAY_HAVE_AVX2(opus_fft_impl)
+};
+
+void (*const OPUS_FFT[OPUS_ARCHMASK + 1])(
+      const kiss_fft_state *cfg,
+      const kiss_fft_cpx   *fin,
+      kiss_fft_cpx         *fout
+) = {
+  opus_fft_c,                /* non-sse */
+  MAY_HAVE_SSE(opus_fft),
+  MAY_HAVE_SSE(opus_fft),
+  MAY_HAVE_SSE(opus_fft),
+  MAY_HAVE_SSE(opus_fft),
+  MAY_HAVE_AVX2(opus_fft)
+};
+
+void (*const OPUS_IFFT[OPUS_ARCHMASK + 1])(
+      const kiss_fft_state *cfg,
+      const kiss_fft_cpx   *fin,
+      kiss_fft_cpx         *fout
+) = {
+  opus_ifft_c,                /* non-sse */
+  MAY_HAVE_SSE(opus_ifft),
+  MAY_HAVE_SSE(opus_ifft),
+  MAY_HAVE_SSE(opus_ifft),
+  MAY_HAVE_SSE(opus_ifft),
+  MAY_HAVE_AVX2(opus_ifft)
+};
+
+void (*const CLT_MDCT_FORWARD_IMPL[OPUS_ARCHMASK + 1])(
+      const mdct_lookup *l,
+      kiss_fft_scalar   *in,
+      kiss_fft_scalar   *OPUS_RESTRICT out,
+      const opus_val16  *window,
+      int                overlap,
+      int                shift,
+      int                stride,
+      int                arch
+) = {
+  clt_mdct_forward_c,                /* non-sse */
+  MAY_HAVE_SSE(clt_mdct_forward),
+  MAY_HAVE_SSE(clt_mdct_forward),
+  MAY_HAVE_SSE(clt_mdct_forward),
+  MAY_HAVE_SSE(clt_mdct_forward),
+  MAY_HAVE_AVX2(clt_mdct_forward)
+};
+
+void (*const CLT_MDCT_BACKWARD_IMPL[OPUS_ARCHMASK + 1])(
+      const mdct_lookup *l,
+      kiss_fft_scalar   *in,
+      kiss_fft_scalar   *OPUS_RESTRICT out,
+      const opus_val16  *window,
+      int                overlap,
+      int                shift,
+      int                stride,
+      int                arch
+) = {
+  clt_mdct_backward_c,                /* non-sse */
+  MAY_HAVE_SSE(clt_mdct_backward),
+  MAY_HAVE_SSE(clt_mdct_backward),
+  MAY_HAVE_SSE(clt_mdct_backward),
+  MAY_HAVE_SSE(clt_mdct_backward),
+  MAY_HAVE_AVX2(clt_mdct_backward)
+};
+
+void (*const CLT_MDCT_FORWARD_MULTI_IMPL[OPUS_ARCHMASK + 1])(
+      const mdct_lookup      *l,
+      kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out,
+      int                     C,
+      int                     B,
+      const opus_val16       *window,
+      int                     overlap,
+      int                     shift,
+      int                     arch
+) = {
+  clt_mdct_forward_multi_c,                /* non-sse */
+  MAY_HAVE_SSE(clt_mdct_forward_multi),
+  MAY_HAVE_SSE(clt_mdct_forward_multi),
+  MAY_HAVE_SSE(clt_mdct_forward_multi),
+  MAY_HAVE_SSE(clt_mdct_forward_multi),
+  MAY_HAVE_AVX2(clt_mdct_forward_multi)
+};
+
+void (*const CLT_MDCT_BACKWARD_MULTI_IMPL[OPUS_ARCHMASK + 1])(
+      const mdct_lookup      *l,
+      kiss_fft_scalar * const *in,
+      kiss_fft_scalar * const *out,
+      int                     C,
+      int                     B,
+      const opus_val16       *window,
+      int                     overlap,
+      int                     shift,
+      int                     arch
+) = {
+  clt_mdct_backward_multi_c,                /* non-sse */
+  MAY_HAVE_SSE(clt_mdct_backward_multi),
+  MAY_HAVE_SSE(clt_mdct_backward_multi),
+  MAY_HAVE_SSE(clt_mdct_backward_multi),
+  MAY_HAVE_SSE(clt_mdct_backward_multi),
+  MAY_HAVE_AVX2(clt_mdct_backward_multi)
 };
 
 
 #endif
 
-#if defined(OPUS_X86_MAY_HAVE_SSE2) && !defined(OPUS_X86_PRESUME_SSE2)
+#if defined(OPUS_X86_MAY_HAVE_SSE) && !defined(OPUS_X86_PRESUME_SSE)
+
+void (*const DEEMPHASIS_MULTI_IMPL[OPUS_ARCHMASK + 1])(
+              celt_sig * const *in,
+              opus_val16 * const *pcm,
+              const int  *stride,
+              int         N,
+              int         count,
+              opus_val16  coef0,
+              celt_sig * const *mem
+) = {
+  deemphasis_multi_c,                /* non-sse */
+  MAY_HAVE_SSE(deemphasis_multi),
+  MAY_HAVE_SSE(deemphasis_multi),
+  MAY_HAVE_SSE(deemphasis_multi),
+  MAY_HAVE_SSE(deemphasis_multi),
+  MAY_HAVE_SSE(deemphasis_multi)
+};
+
+#endif
+
+#if (defined(OPUS_X86_MAY_HAVE_SSE2) && !defined(OPUS_X86_PRESUME_SSE2)) || \
+ (defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2))
 opus_val16 (*const OP_PVQ_SEARCH_IMPL[OPUS_ARCHMASK + 1])(
       celt_norm *_X, int *iy, int K, int N, int arch
 ) = {
@@ -159,7 +304,26 @@ opus_val16 (*const OP_PVQ_SEARCH_IMPL[OPUS_ARCHMASK + 1])(
   op_pvq_search_c,
   MAY_HAVE_SSE2(op_pvq_search),
   MAY_HAVE_SSE2(op_pvq_search),
-  MAY_HAVE_SSE2(op_pvq_search)
+  MAY_HAVE_SSE2(op_pvq_search),
+  MAY_HAVE_AVX2(op_pvq_search)
+};
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2)
+void (*const CELT_PITCH_XCORR_IMPL[OPUS_ARCHMASK + 1])(
+      const opus_val16 *_x,
+      const opus_val16 *_y,
+      opus_val32       *xcorr,
+      int               len,
+      int               max_pitch,
+      int               arch
+) = {
+  celt_pitch_xcorr_c,                /* non-sse */
+  celt_pitch_xcorr_c,
+  celt_pitch_xcorr_c,
+  celt_pitch_xcorr_c,
+  celt_pitch_xcorr_c,
+  MAY_HAVE_AVX2(celt_pitch_xcorr)
 };
 #endif
 
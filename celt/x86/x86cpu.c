@@ -38,15 +38,22 @@
 #if (defined(OPUS_X86_MAY_HAVE_SSE) && !defined(OPUS_X86_PRESUME_SSE)) || \
   (defined(OPUS_X86_MAY_HAVE_SSE2) && !defined(OPUS_X86_PRESUME_SSE2)) || \
   (defined(OPUS_X86_MAY_HAVE_SSE4_1) && !defined(OPUS_X86_PRESUME_SSE4_1)) || \
-  (defined(OPUS_X86_MAY_HAVE_AVX) && !defined(OPUS_X86_PRESUME_AVX))
+  (defined(OPUS_X86_MAY_HAVE_AVX) && !defined(OPUS_X86_PRESUME_AVX)) || \
+  (defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2))
 
 
 #if defined(_MSC_VER)
 
 #include <intrin.h>
+#include <immintrin.h>
 static _inline void cpuid(unsigned int CPUInfo[4], unsigned int InfoType)
 {
-    __cpuid((int*)CPUInfo, InfoType);
+    __cpuidex((int*)CPUInfo, InfoType, 0);
+}
+
+static _inline unsigned int xgetbv0(void)
+{
+    return (unsigned int)_xgetbv(0);
 }
 
 #else
@@ -68,7 +75,7 @@ static void cpuid(unsigned int CPUInfo[4], unsigned int InfoType)
         "=r" (CPUInfo[1]),
         "=c" (CPUInfo[2]),
         "=d" (CPUInfo[3]) :
-        "0" (InfoType)
+        "0" (InfoType), "2" (0)
     );
 #else
     __asm__ __volatile__ (
@@ -77,11 +84,30 @@ static void cpuid(unsigned int CPUInfo[4], unsigned int InfoType)
         "=b" (CPUInfo[1]),
         "=c" (CPUInfo[2]),
         "=d" (CPUInfo[3]) :
-        "0" (InfoType)
+        "0" (InfoType), "2" (0)
     );
 #endif
 #elif defined(CPU_INFO_BY_C)
-    __get_cpuid(InfoType, &(CPUInfo[0]), &(CPUInfo[1]), &(CPUInfo[2]), &(CPUInfo[3]));
+    __cpuid_count(InfoType, 0, CPUInfo[0], CPUInfo[1], CPUInfo[2], CPUInfo[3]);
+#endif
+}
+
+/* Reads XCR0 so we can check that the OS saves the YMM registers on context
+   switches. The opcode is spelled out for assemblers that predate XGETBV. */
+static unsigned int xgetbv0(void)
+{
+#if defined(CPU_INFO_BY_ASM) || defined(CPU_INFO_BY_C)
+    unsigned int eax, edx;
+    __asm__ __volatile__ (
+        ".byte 0x0f, 0x01, 0xd0":
+        "=a" (eax),
+        "=d" (edx) :
+        "c" (0)
+    );
+    (void)edx;
+    return eax;
+#else
+    return 0;
 #endif
 }
 
@@ -94,6 +120,7 @@ typedef struct CPU_Feature{
     int HW_SSE41;
     /*  SIMD: 256-bit */
     int HW_AVX;
+    int HW_AVX2;
 } CPU_Feature;
 
 static void opus_cpu_feature_check(CPU_Feature *cpu_feature)
@@ -110,12 +137,26 @@ static void opus_cpu_feature_check(CPU_Feature *cpu_feature)
         cpu_feature->HW_SSE2 = (info[3] & (1 << 26)) != 0;
         cpu_feature->HW_SSE41 = (info[2] & (1 << 19)) != 0;
         cpu_feature->HW_AVX = (info[2] & (1 << 28)) != 0;
+        /* AVX2 kernels also use FMA, and need the OS to save the YMM state
+           (OSXSAVE set and XCR0 bits 1 and 2 enabled). */
+        cpu_feature->HW_AVX2 = cpu_feature->HW_AVX
+              && (info[2] & (1 << 12)) != 0
+              && (info[2] & (1 << 27)) != 0
+              && (xgetbv0() & 0x6) == 0x6;
+        if (cpu_feature->HW_AVX2 && nIds >= 7) {
+            cpuid(info, 7);
+            cpu_feature->HW_AVX2 = (info[1] & (1 << 5)) != 0;
+        }
+        else {
+            cpu_feature->HW_AVX2 = 0;
+        }
     }
     else {
         cpu_feature->HW_SSE = 0;
         cpu_feature->HW_SSE2 = 0;
         cpu_feature->HW_SSE41 = 0;
         cpu_feature->HW_AVX = 0;
+        cpu_feature->HW_AVX2 = 0;
     }
 }
 
@@ -151,6 +192,12 @@ int opus_select_arch(void)
     }
     arch++;
 
+    if (!cpu_feature.HW_AVX2)
+    {
+        return arch;
+    }
+    arch++;
+
     return arch;
 }
 
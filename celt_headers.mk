@@ -23,6 +23,7 @@ celt/mfrngcod.h \
 celt/modes.h \
 celt/os_support.h \
 celt/pitch.h \
+celt/profile_stats.h \
 celt/celt_lpc.h \
 celt/x86/celt_lpc_sse.h \
 celt/quant_bands.h \
@@ -13,6 +13,7 @@ celt/mathops.c \
 celt/mdct.c \
 celt/modes.c \
 celt/pitch.c \
+celt/profile_stats.c \
 celt/celt_lpc.c \
 celt/quant_bands.c \
 celt/rate.c \
@@ -21,7 +22,9 @@ celt/vq.c
 CELT_SOURCES_SSE = \
 celt/x86/x86cpu.c \
 celt/x86/x86_celt_map.c \
-celt/x86/pitch_sse.c
+celt/x86/pitch_sse.c \
+celt/x86/kiss_fft_sse.c \
+celt/x86/mdct_sse.c
 
 CELT_SOURCES_SSE2 = \
 celt/x86/pitch_sse2.c \
@@ -31,6 +34,12 @@ CELT_SOURCES_SSE4_1 = \
 celt/x86/celt_lpc_sse4_1.c \
 celt/x86/pitch_sse4_1.c
 
+CELT_SOURCES_AVX2 = \
+celt/x86/pitch_avx2.c \
+celt/x86/vq_avx2.c \
+celt/x86/kiss_fft_avx2.c \
+celt/x86/mdct_avx2.c
+
 CELT_SOURCES_ARM = \
 celt/arm/armcpu.c \
 celt/arm/arm_celt_map.c
@@ -47,7 +47,7 @@ function(check_flag NAME FLAG)
 endfunction()
 
 include(CheckIncludeFile)
-# function to check if compiler supports SSE, SSE2, SSE4.1 and AVX if target
+# function to check if compiler supports SSE, SSE2, SSE4.1, AVX and AVX2 if target
 # systems may not have SSE support then use OPUS_MAY_HAVE_SSE option if target
 # system is guaranteed to have SSE support then OPUS_PRESUME_SSE can be used to
 # skip SSE runtime check
@@ -124,7 +124,19 @@ function(opus_detect_sse COMPILER_SUPPORT_SIMD)
         PARENT_SCOPE)
   endif()
 
-  if(SSE1_SUPPORTED OR SSE2_SUPPORTED OR SSE4_1_SUPPORTED OR AVX_SUPPORTED)
+  if(HAVE_IMMINTRIN_H) # AVX2 + FMA
+    if(MSVC)
+      check_flag(AVX2 /arch:AVX2)
+    else()
+      check_flag(AVX2 "-mavx2 -mfma")
+    endif()
+  else()
+    set(AVX2_SUPPORTED
+        0
+        PARENT_SCOPE)
+  endif()
+
+  if(SSE1_SUPPORTED OR SSE2_SUPPORTED OR SSE4_1_SUPPORTED OR AVX_SUPPORTED OR AVX2_SUPPORTED)
     set(COMPILER_SUPPORT_SIMD 1 PARENT_SCOPE)
   else()
     message(STATUS "No SIMD support in compiler")
@@ -8,10 +8,15 @@ include(OpusFunctions)
 get_opus_sources(SILK_HEAD silk_headers.mk silk_headers)
 get_opus_sources(SILK_SOURCES silk_sources.mk silk_sources)
 get_opus_sources(SILK_SOURCES_FLOAT silk_sources.mk silk_sources_float)
+get_opus_sources(SILK_SOURCES_FLOAT_SSE2 silk_sources.mk
+                 silk_sources_float_sse2)
+get_opus_sources(SILK_SOURCES_FLOAT_AVX2 silk_sources.mk
+                 silk_sources_float_avx2)
 get_opus_sources(SILK_SOURCES_FIXED silk_sources.mk silk_sources_fixed)
 get_opus_sources(SILK_SOURCES_SSE4_1 silk_sources.mk silk_sources_sse4_1)
 get_opus_sources(SILK_SOURCES_FIXED_SSE4_1 silk_sources.mk
                  silk_sources_fixed_sse4_1)
+get_opus_sources(SILK_SOURCES_AVX2 silk_sources.mk silk_sources_avx2)
 get_opus_sources(SILK_SOURCES_ARM_NEON_INTR silk_sources.mk
                  silk_sources_arm_neon_intr)
 get_opus_sources(SILK_SOURCES_FIXED_ARM_NEON_INTR silk_sources.mk
@@ -20,12 +25,19 @@ get_opus_sources(SILK_SOURCES_FIXED_ARM_NEON_INTR silk_sources.mk
 get_opus_sources(OPUS_HEAD opus_headers.mk opus_headers)
 get_opus_sources(OPUS_SOURCES opus_sources.mk opus_sources)
 get_opus_sources(OPUS_SOURCES_FLOAT opus_sources.mk opus_sources_float)
+get_opus_sources(OPUS_SOURCES_FLOAT_SSE4_1 opus_sources.mk
+                 opus_sources_float_sse4_1)
+get_opus_sources(OPUS_SOURCES_FLOAT_AVX2 opus_sources.mk
+                 opus_sources_float_avx2)
+get_opus_sources(OPUS_SOURCES_FLOAT_ARM_NEON_INTR opus_sources.mk
+                 opus_sources_float_arm_neon_intr)
 
 get_opus_sources(CELT_HEAD celt_headers.mk celt_headers)
 get_opus_sources(CELT_SOURCES celt_sources.mk celt_sources)
 get_opus_sources(CELT_SOURCES_SSE celt_sources.mk celt_sources_sse)
 get_opus_sources(CELT_SOURCES_SSE2 celt_sources.mk celt_sources_sse2)
 get_opus_sources(CELT_SOURCES_SSE4_1 celt_sources.mk celt_sources_sse4_1)
+get_opus_sources(CELT_SOURCES_AVX2 celt_sources.mk celt_sources_avx2)
 get_opus_sources(CELT_SOURCES_ARM celt_sources.mk celt_sources_arm)
 get_opus_sources(CELT_SOURCES_ARM_ASM celt_sources.mk celt_sources_arm_asm)
 get_opus_sources(CELT_AM_SOURCES_ARM_ASM celt_sources.mk
@@ -44,3 +56,6 @@ get_opus_sources(tests_test_opus_decode_SOURCES Makefile.am
                  test_opus_decode_sources)
 get_opus_sources(tests_test_opus_padding_SOURCES Makefile.am
                  test_opus_padding_sources)
+get_opus_sources(tests_opus_bench_SOURCES Makefile.am opus_bench_sources)
+get_opus_sources(tests_test_unit_mlp_SOURCES Makefile.am
+                 test_unit_mlp_sources)
@@ -170,6 +170,19 @@ typedef struct OpusEncoder OpusEncoder;
   */
 OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_encoder_get_size(int channels);
 
+/** Gets the amount of temporary memory one call to opus_encode() or
+  * opus_encode_float() may use.
+  * This is the worst case over all sampling rates, applications, coding
+  * modes, frame durations and complexities for the given channel count.
+  * It is the minimum size for a buffer passed to opus_set_scratch_buffer(),
+  * and also a guide to the stack space the encoder needs in builds that
+  * place temporary arrays on the stack.
+  * @param[in] channels <tt>int</tt>: Number of channels.
+  *                                   This must be 1 or 2.
+  * @returns The size in bytes, or 0 for an invalid channel count.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_encoder_get_scratch_size(int channels);
+
 /**
  */
 
@@ -196,7 +209,7 @@ OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_encoder_get_size(int channels);
  * This is useful when the caller knows that the speech-optimized modes will not be needed (use with caution).
  * @param [in] Fs <tt>opus_int32</tt>: Sampling rate of input signal (Hz)
  *                                     This must be one of 8000, 12000, 16000,
- *                                     24000, or 48000.
+ *                                     24000, 44100, or 48000.
  * @param [in] channels <tt>int</tt>: Number of channels (1 or 2) in input signal
  * @param [in] application <tt>int</tt>: Coding mode (@ref OPUS_APPLICATION_VOIP/@ref OPUS_APPLICATION_AUDIO/@ref OPUS_APPLICATION_RESTRICTED_LOWDELAY)
  * @param [out] error <tt>int*</tt>: @ref opus_errorcodes
@@ -204,6 +217,10 @@ OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_encoder_get_size(int channels);
  * can switch to a lower audio bandwidth or number of channels if the bitrate
  * selected is too low. This also means that it is safe to always use 48 kHz stereo input
  * and let the encoder optimize the encoding.
+ * @note At 44100 Hz, the input is converted to 48 kHz before encoding, and
+ * frame sizes must be a multiple of 10 ms (441 samples). The conversion adds
+ * about 0.36 ms (16 samples) of delay, which is included in
+ * #OPUS_GET_LOOKAHEAD. The multistream and projection APIs do not accept 44100 Hz.
  */
 OPUS_EXPORT OPUS_WARN_UNUSED_RESULT OpusEncoder *opus_encoder_create(
     opus_int32 Fs,
@@ -220,7 +237,7 @@ OPUS_EXPORT OPUS_WARN_UNUSED_RESULT OpusEncoder *opus_encoder_create(
   * @param [in] st <tt>OpusEncoder*</tt>: Encoder state
   * @param [in] Fs <tt>opus_int32</tt>: Sampling rate of input signal (Hz)
  *                                      This must be one of 8000, 12000, 16000,
- *                                      24000, or 48000.
+ *                                      24000, 44100, or 48000.
   * @param [in] channels <tt>int</tt>: Number of channels (1 or 2) in input signal
   * @param [in] application <tt>int</tt>: Coding mode (OPUS_APPLICATION_VOIP/OPUS_APPLICATION_AUDIO/OPUS_APPLICATION_RESTRICTED_LOWDELAY)
   * @retval #OPUS_OK Success or @ref opus_errorcodes
@@ -309,6 +326,54 @@ OPUS_EXPORT OPUS_WARN_UNUSED_RESULT opus_int32 opus_encode_float(
     opus_int32 max_data_bytes
 ) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4);
 
+/** Encodes an Opus frame from planar (non-interleaved) input.
+  * This is bit-exact with opus_encode() on the same samples interleaved,
+  * without the caller having to interleave them first.
+  * @param [in] st <tt>OpusEncoder*</tt>: Encoder state
+  * @param [in] pcm <tt>opus_int16**</tt>: Array of one input buffer per
+  *                                        channel, each holding
+  *                                        \a frame_size samples.
+  * @param [in] frame_size <tt>int</tt>: Number of samples per channel in the
+  *                                      input signal, as for opus_encode().
+  * @param [out] data <tt>unsigned char*</tt>: Output payload.
+  * @param [in] max_data_bytes <tt>opus_int32</tt>: Size of the allocated
+  *                                                 memory for the output
+  *                                                 payload.
+  * @returns The length of the encoded packet (in bytes) on success or a
+  *          negative error code (see @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT opus_int32 opus_encode_planar(
+    OpusEncoder *st,
+    const opus_int16 * const *pcm,
+    int frame_size,
+    unsigned char *data,
+    opus_int32 max_data_bytes
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4);
+
+/** Encodes an Opus frame from planar (non-interleaved) floating point input.
+  * This is bit-exact with opus_encode_float() on the same samples
+  * interleaved.
+  * @param [in] st <tt>OpusEncoder*</tt>: Encoder state
+  * @param [in] pcm <tt>float**</tt>: Array of one input buffer per channel,
+  *                                   each holding \a frame_size samples,
+  *                                   with a nominal range of +/-1.0.
+  * @param [in] frame_size <tt>int</tt>: Number of samples per channel in the
+  *                                      input signal, as for opus_encode().
+  * @param [out] data <tt>unsigned char*</tt>: Output payload.
+  * @param [in] max_data_bytes <tt>opus_int32</tt>: Size of the allocated
+  *                                                 memory for the output
+  *                                                 payload.
+  * @returns The length of the encoded packet (in bytes) on success or a
+  *          negative error code (see @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT opus_int32 opus_encode_planar_float(
+    OpusEncoder *st,
+    const float * const *pcm,
+    int frame_size,
+    unsigned char *data,
+    opus_int32 max_data_bytes
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4);
+
 /** Frees an <code>OpusEncoder</code> allocated by opus_encoder_create().
   * @param[in] st <tt>OpusEncoder*</tt>: State to be freed.
   */
@@ -341,7 +406,7 @@ OPUS_EXPORT int opus_encoder_ctl(OpusEncoder *st, int request, ...) OPUS_ARG_NON
   * dec = opus_decoder_create(Fs, channels, &error);
   * @endcode
   * where
-  * @li Fs is the sampling rate and must be 8000, 12000, 16000, 24000, or 48000
+  * @li Fs is the sampling rate and must be 8000, 12000, 16000, 24000, 44100, or 48000
   * @li channels is the number of channels (1 or 2)
   * @li error will hold the error code in case of failure (or #OPUS_OK on success)
   * @li the return value is a newly created decoder state to be used for decoding
@@ -386,8 +451,8 @@ OPUS_EXPORT int opus_encoder_ctl(OpusEncoder *st, int request, ...) OPUS_ARG_NON
   * A single codec state may only be accessed from a single thread at
   * a time and any required locking must be performed by the caller. Separate
   * streams must be decoded with separate decoder states and can be decoded
-  * in parallel unless the library was compiled with NONTHREADSAFE_PSEUDOSTACK
-  * defined.
+  * in parallel, including in builds configured with NONTHREADSAFE_PSEUDOSTACK
+  * as long as the compiler supports thread-local storage.
   *
   */
 
@@ -405,10 +470,23 @@ typedef struct OpusDecoder OpusDecoder;
   */
 OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_decoder_get_size(int channels);
 
+/** Gets the amount of temporary memory one call to opus_decode() or
+  * opus_decode_float() may use.
+  * This is the worst case over all sampling rates and packet types for the
+  * given channel count, with an output buffer of up to 120 ms.
+  * It is the minimum size for a buffer passed to opus_set_scratch_buffer(),
+  * and also a guide to the stack space the decoder needs in builds that
+  * place temporary arrays on the stack.
+  * @param [in] channels <tt>int</tt>: Number of channels.
+  *                                    This must be 1 or 2.
+  * @returns The size in bytes, or 0 for an invalid channel count.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_decoder_get_scratch_size(int channels);
+
 /** Allocates and initializes a decoder state.
   * @param [in] Fs <tt>opus_int32</tt>: Sample rate to decode at (Hz).
   *                                     This must be one of 8000, 12000, 16000,
-  *                                     24000, or 48000.
+  *                                     24000, 44100, or 48000.
   * @param [in] channels <tt>int</tt>: Number of channels (1 or 2) to decode
   * @param [out] error <tt>int*</tt>: #OPUS_OK Success or @ref opus_errorcodes
   *
@@ -419,6 +497,12 @@ OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_decoder_get_size(int channels);
   * use the full frequency range, it can request decoding at a reduced
   * rate. Likewise, the decoder is capable of filling in either mono or
   * interleaved stereo pcm buffers, at the caller's request.
+  *
+  * At 44100 Hz, the decoder output is converted from 48 kHz, adding about
+  * 0.37 ms (16 samples) of delay. A packet that is a multiple of 10 ms long
+  * decodes to exactly 441 samples per 10 ms. Shorter packets decode to one
+  * sample more or less than their nominal length, depending on the
+  * previous packets; opus_decoder_get_nb_samples() returns the exact count.
   */
 OPUS_EXPORT OPUS_WARN_UNUSED_RESULT OpusDecoder *opus_decoder_create(
     opus_int32 Fs,
@@ -433,7 +517,7 @@ OPUS_EXPORT OPUS_WARN_UNUSED_RESULT OpusDecoder *opus_decoder_create(
   * @param [in] st <tt>OpusDecoder*</tt>: Decoder state.
   * @param [in] Fs <tt>opus_int32</tt>: Sampling rate to decode to (Hz).
   *                                     This must be one of 8000, 12000, 16000,
-  *                                     24000, or 48000.
+  *                                     24000, 44100, or 48000.
   * @param [in] channels <tt>int</tt>: Number of channels (1 or 2) to decode
   * @retval #OPUS_OK Success or @ref opus_errorcodes
   */
@@ -454,7 +538,7 @@ OPUS_EXPORT int opus_decoder_init(
   *  not be capable of decoding some packets. In the case of PLC (data==NULL) or FEC (decode_fec=1),
   *  then frame_size needs to be exactly the duration of audio that is missing, otherwise the
   *  decoder will not be in the optimal state to decode the next incoming packet. For the PLC and
-  *  FEC cases, frame_size <b>must</b> be a multiple of 2.5 ms.
+  *  FEC cases, frame_size <b>must</b> be a multiple of 2.5 ms, or of 10 ms at 44100 Hz.
   * @param [in] decode_fec <tt>int</tt>: Flag (0 or 1) to request that any in-band forward error correction data be
   *  decoded. If no such data is available, the frame is decoded as if it were lost.
   * @returns Number of decoded samples or @ref opus_errorcodes
@@ -479,7 +563,7 @@ OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_decode(
   *  not be capable of decoding some packets. In the case of PLC (data==NULL) or FEC (decode_fec=1),
   *  then frame_size needs to be exactly the duration of audio that is missing, otherwise the
   *  decoder will not be in the optimal state to decode the next incoming packet. For the PLC and
-  *  FEC cases, frame_size <b>must</b> be a multiple of 2.5 ms.
+  *  FEC cases, frame_size <b>must</b> be a multiple of 2.5 ms, or of 10 ms at 44100 Hz.
   * @param [in] decode_fec <tt>int</tt>: Flag (0 or 1) to request that any in-band forward error correction data be
   *  decoded. If no such data is available the frame is decoded as if it were lost.
   * @returns Number of decoded samples or @ref opus_errorcodes
@@ -493,6 +577,134 @@ OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_decode_float(
     int decode_fec
 ) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(4);
 
+/** Decode one Opus packet for each of several independent decoders.
+  * This is equivalent to calling opus_decode() once per decoder. Packets
+  * holding a single CELT-only frame at the decoder's native rate, following
+  * another CELT-only frame, are decoded up to their spectrum one stream at a
+  * time, and their synthesis then runs across streams: the inverse MDCTs of
+  * frames of the same size are computed together in SIMD lanes, as is the
+  * de-emphasis. The other packets (SILK, hybrid, mode transitions,
+  * resampled output, lost packets and FEC) are decoded with opus_decode().
+  * The output matches opus_decode() exactly, except on CPUs with FMA (the
+  * AVX2 code path), where the batched transforms may round slightly
+  * differently.
+  * @param [in] st <tt>OpusDecoder**</tt>: Array of \a count decoder states.
+  *                                        The same state must not appear
+  *                                        twice.
+  * @param [in] data <tt>char**</tt>: Array of \a count input payloads.
+  *                                   An entry may be NULL to indicate
+  *                                   packet loss on that stream.
+  * @param [in] len <tt>opus_int32*</tt>: Number of bytes in each payload.
+  * @param [out] pcm <tt>opus_int16**</tt>: Array of \a count output
+  *                                         buffers, each as for opus_decode().
+  * @param [in] frame_size Number of samples per channel of available space
+  *  in each output buffer, with the same constraints as for opus_decode().
+  * @param [in] decode_fec <tt>int</tt>: Flag (0 or 1) to request that any
+  *  in-band forward error correction data be decoded, for every stream.
+  * @param [out] ret <tt>int*</tt>: For each decoder, the number of decoded
+  *  samples or a negative error code, exactly as opus_decode() would have
+  *  returned.
+  * @param [in] count <tt>int</tt>: Number of decoders in the batch.
+  * @returns #OPUS_OK if the batch was processed (check \a ret for the
+  *          per-stream results), #OPUS_BAD_ARG if \a count is negative, or
+  *          #OPUS_ALLOC_FAIL if the scratch arena given to
+  *          opus_set_scratch_buffer() ran out, in which case every state
+  *          of the batch must be reset with #OPUS_RESET_STATE.
+  */
+OPUS_EXPORT int opus_decode_batch(
+    OpusDecoder * const *st,
+    const unsigned char * const *data,
+    const opus_int32 *len,
+    opus_int16 * const *pcm,
+    int frame_size,
+    int decode_fec,
+    int *ret,
+    int count
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(3) OPUS_ARG_NONNULL(4) OPUS_ARG_NONNULL(7);
+
+/** Decode one Opus packet for each of several independent decoders, with
+  * floating point output.
+  * This is the floating point counterpart of opus_decode_batch(), and is
+  * equivalent to calling opus_decode_float() once per decoder, with the same
+  * cross-stream CELT synthesis.
+  * @param [in] st <tt>OpusDecoder**</tt>: Array of \a count decoder states.
+  * @param [in] data <tt>char**</tt>: Array of \a count input payloads
+  *                                   (NULL entries indicate packet loss).
+  * @param [in] len <tt>opus_int32*</tt>: Number of bytes in each payload.
+  * @param [out] pcm <tt>float**</tt>: Array of \a count output buffers.
+  * @param [in] frame_size Number of samples per channel of available space
+  *  in each output buffer.
+  * @param [in] decode_fec <tt>int</tt>: Flag (0 or 1) to request in-band FEC
+  *  decoding for every stream.
+  * @param [out] ret <tt>int*</tt>: Per-decoder sample count or negative
+  *  error code.
+  * @param [in] count <tt>int</tt>: Number of decoders in the batch.
+  * @returns #OPUS_OK if the batch was processed, #OPUS_BAD_ARG if
+  *          \a count is negative, or #OPUS_ALLOC_FAIL as for
+  *          opus_decode_batch().
+  */
+OPUS_EXPORT int opus_decode_batch_float(
+    OpusDecoder * const *st,
+    const unsigned char * const *data,
+    const opus_int32 *len,
+    float * const *pcm,
+    int frame_size,
+    int decode_fec,
+    int *ret,
+    int count
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(3) OPUS_ARG_NONNULL(4) OPUS_ARG_NONNULL(7);
+
+/** Decode an Opus packet into planar (non-interleaved) output.
+  * This is bit-exact with opus_decode(), with each channel written to its
+  * own buffer instead of interleaved.
+  * @param [in] st <tt>OpusDecoder*</tt>: Decoder state
+  * @param [in] data <tt>char*</tt>: Input payload. Use a NULL pointer to
+  *                                  indicate packet loss
+  * @param [in] len <tt>opus_int32</tt>: Number of bytes in payload*
+  * @param [out] pcm <tt>opus_int16**</tt>: Array of one output buffer per
+  *                                         channel, each with room for
+  *                                         \a frame_size samples.
+  * @param [in] frame_size Number of samples per channel of available space
+  *  in each output buffer, with the same constraints as for opus_decode().
+  * @param [in] decode_fec <tt>int</tt>: Flag (0 or 1) to request that any
+  *  in-band forward error correction data be decoded.
+  * @returns Number of decoded samples or @ref opus_errorcodes
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_decode_planar(
+    OpusDecoder *st,
+    const unsigned char *data,
+    opus_int32 len,
+    opus_int16 * const *pcm,
+    int frame_size,
+    int decode_fec
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(4);
+
+/** Decode an Opus packet into planar (non-interleaved) floating point
+  * output.
+  * This is bit-exact with opus_decode_float(), with each channel written to
+  * its own buffer instead of interleaved.
+  * @param [in] st <tt>OpusDecoder*</tt>: Decoder state
+  * @param [in] data <tt>char*</tt>: Input payload. Use a NULL pointer to
+  *                                  indicate packet loss
+  * @param [in] len <tt>opus_int32</tt>: Number of bytes in payload
+  * @param [out] pcm <tt>float**</tt>: Array of one output buffer per
+  *                                    channel, each with room for
+  *                                    \a frame_size samples.
+  * @param [in] frame_size Number of samples per channel of available space
+  *  in each output buffer, with the same constraints as for opus_decode().
+  * @param [in] decode_fec <tt>int</tt>: Flag (0 or 1) to request that any
+  *  in-band forward error correction data be decoded.
+  * @returns Number of decoded samples or @ref opus_errorcodes
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_decode_planar_float(
+    OpusDecoder *st,
+    const unsigned char *data,
+    opus_int32 len,
+    float * const *pcm,
+    int frame_size,
+    int decode_fec
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(4);
+
 /** Perform a CTL function on an Opus decoder.
   *
   * Generally the request and subsequent arguments are generated
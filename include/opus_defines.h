@@ -169,6 +169,13 @@ extern "C" {
 #define OPUS_SET_PHASE_INVERSION_DISABLED_REQUEST 4046
 #define OPUS_GET_PHASE_INVERSION_DISABLED_REQUEST 4047
 #define OPUS_GET_IN_DTX_REQUEST              4049
+#define OPUS_GET_PROFILE_STATS_REQUEST       4061
+/* #define OPUS_RESET_PROFILE_STATS 4062 */
+#define OPUS_SET_COMPLEXITY_BUDGET_REQUEST   4064
+#define OPUS_GET_COMPLEXITY_BUDGET_REQUEST   4065
+#define OPUS_GET_EFFECTIVE_COMPLEXITY_REQUEST 4067
+#define OPUS_SET_REDUCED_SYNTHESIS_REQUEST   4068
+#define OPUS_GET_REDUCED_SYNTHESIS_REQUEST   4069
 
 /** Defines for the presence of extended APIs. */
 #define OPUS_HAVE_OPUS_PROJECTION_H
@@ -178,6 +185,7 @@ extern "C" {
 #define __opus_check_int_ptr(ptr) ((ptr) + ((ptr) - (opus_int32*)(ptr)))
 #define __opus_check_uint_ptr(ptr) ((ptr) + ((ptr) - (opus_uint32*)(ptr)))
 #define __opus_check_val16_ptr(ptr) ((ptr) + ((ptr) - (opus_val16*)(ptr)))
+#define __opus_check_profile_stats_ptr(ptr) ((ptr) + ((ptr) - (OpusProfileStats*)(ptr)))
 /** @endcond */
 
 /** @defgroup opus_ctlvalues Pre-defined values for CTL interface
@@ -217,6 +225,35 @@ extern "C" {
 #define OPUS_FRAMESIZE_100_MS                5008 /**< Use 100 ms frames */
 #define OPUS_FRAMESIZE_120_MS                5009 /**< Use 120 ms frames */
 
+/* Stages reported by OPUS_GET_PROFILE_STATS. Nested stages are also
+   counted in the stage that contains them. */
+#define OPUS_PROFILE_ENCODE                     0 /**< Whole encoder call */
+#define OPUS_PROFILE_ANALYSIS                   1 /**< Tonality and bandwidth analysis */
+#define OPUS_PROFILE_SILK_ENCODE                2 /**< SILK encoder, including the stages below */
+#define OPUS_PROFILE_SILK_PITCH                 3 /**< SILK pitch analysis */
+#define OPUS_PROFILE_SILK_NSQ                   4 /**< SILK noise shaping quantizer, including delayed decision */
+#define OPUS_PROFILE_CELT_ENCODE                5 /**< CELT encoder, including the stages below */
+#define OPUS_PROFILE_CELT_PREFILTER             6 /**< CELT pitch pre-filter */
+#define OPUS_PROFILE_CELT_MDCT                  7 /**< CELT forward MDCTs, or the decoder's inverse MDCTs */
+#define OPUS_PROFILE_CELT_BANDS                 8 /**< CELT PVQ band coding (quant_all_bands) */
+#define OPUS_PROFILE_DECODE                     9 /**< Whole decoder call */
+#define OPUS_PROFILE_SILK_DECODE               10 /**< SILK decoder */
+#define OPUS_PROFILE_CELT_DECODE               11 /**< CELT decoder, including the stages below */
+#define OPUS_PROFILE_CELT_PLC                  12 /**< CELT packet loss concealment */
+#define OPUS_PROFILE_RESAMPLE                  13 /**< 44.1 kHz conversion of the encoder input or the decoder output */
+#define OPUS_PROFILE_NB_STAGES                 14 /**< Number of profiled stages */
+
+/** Accumulated per-stage cost, as returned by #OPUS_GET_PROFILE_STATS.
+  * Both arrays are indexed by the OPUS_PROFILE_* stage values.
+  */
+typedef struct OpusProfileStats {
+   /** Time spent in each stage, in ticks of the fastest clock available:
+       the time-stamp counter on x86, otherwise nanoseconds. */
+   opus_uint64 ticks[OPUS_PROFILE_NB_STAGES];
+   /** Number of times each stage was entered. */
+   opus_uint32 calls[OPUS_PROFILE_NB_STAGES];
+} OpusProfileStats;
+
 /**@}*/
 
 
@@ -258,6 +295,36 @@ extern "C" {
   * @hideinitializer */
 #define OPUS_GET_COMPLEXITY(x) OPUS_GET_COMPLEXITY_REQUEST, __opus_check_int_ptr(x)
 
+/** Configures a CPU time budget for each encoder call.
+  * When a budget is set, the encoder measures the time spent in each call
+  * and adjusts the complexity used for the following calls to stay within
+  * it. The complexity is lowered as soon as the budget is exceeded, and
+  * raised again, one step at a time, while there is enough headroom. It
+  * never exceeds the value set with #OPUS_SET_COMPLEXITY. The time is
+  * measured as the CPU time of the calling thread where the platform
+  * provides it, and as elapsed time otherwise. On a multistream encoder the
+  * budget applies to each stream.
+  * @see OPUS_GET_COMPLEXITY_BUDGET
+  * @see OPUS_GET_EFFECTIVE_COMPLEXITY
+  * @param[in] x <tt>opus_int32</tt>: Budget in microseconds per call, or 0
+  *                                   to always use the configured complexity
+  *                                   (default).
+  * @hideinitializer */
+#define OPUS_SET_COMPLEXITY_BUDGET(x) OPUS_SET_COMPLEXITY_BUDGET_REQUEST, __opus_check_int(x)
+/** Gets the encoder's CPU time budget.
+  * @see OPUS_SET_COMPLEXITY_BUDGET
+  * @param[out] x <tt>opus_int32 *</tt>: Budget in microseconds per call, or 0
+  *                                      if none is set.
+  * @hideinitializer */
+#define OPUS_GET_COMPLEXITY_BUDGET(x) OPUS_GET_COMPLEXITY_BUDGET_REQUEST, __opus_check_int_ptr(x)
+/** Gets the complexity the encoder will use for the next call.
+  * This is the value set with #OPUS_SET_COMPLEXITY, or a lower one chosen to
+  * meet the budget set with #OPUS_SET_COMPLEXITY_BUDGET.
+  * @param[out] x <tt>opus_int32 *</tt>: Returns a value in the range 0-10,
+  *                                      inclusive.
+  * @hideinitializer */
+#define OPUS_GET_EFFECTIVE_COMPLEXITY(x) OPUS_GET_EFFECTIVE_COMPLEXITY_REQUEST, __opus_check_int_ptr(x)
+
 /** Configures the bitrate in the encoder.
   * Rates from 500 to 512000 bits per second are meaningful, as well as the
   * special values #OPUS_AUTO and #OPUS_BITRATE_MAX.
@@ -727,6 +794,24 @@ extern "C" {
   * @hideinitializer */
 #define OPUS_GET_IN_DTX(x) OPUS_GET_IN_DTX_REQUEST, __opus_check_int_ptr(x)
 
+/** Gets the time spent and the number of calls in each major stage of the
+  * encoder or decoder since it was created or since the last
+  * #OPUS_RESET_PROFILE_STATS. #OPUS_RESET_STATE does not clear them.
+  * The counters are only kept when the library was built with profiling
+  * enabled (ENABLE_PROFILE_STATS); otherwise this returns
+  * #OPUS_UNIMPLEMENTED. On a multistream encoder or decoder the counts are
+  * summed over all streams.
+  * @param[out] x <tt>OpusProfileStats *</tt>: Accumulated counters, indexed
+  *                                           by the OPUS_PROFILE_* stages.
+  * @hideinitializer */
+#define OPUS_GET_PROFILE_STATS(x) OPUS_GET_PROFILE_STATS_REQUEST, __opus_check_profile_stats_ptr(x)
+
+/** Clears the counters returned by #OPUS_GET_PROFILE_STATS.
+  * Returns #OPUS_UNIMPLEMENTED when the library was built without
+  * profiling.
+  * @hideinitializer */
+#define OPUS_RESET_PROFILE_STATS 4062
+
 /**@}*/
 
 /** @defgroup opus_decoderctls Decoder related CTLs
@@ -751,6 +836,40 @@ extern "C" {
   * @hideinitializer */
 #define OPUS_GET_GAIN(x) OPUS_GET_GAIN_REQUEST, __opus_check_int_ptr(x)
 
+/** Configures the decoder to run the CELT synthesis at the output sampling rate.
+  * By default, the CELT layer is synthesized at 48 kHz and then decimated to
+  * the decoder's sampling rate. When this is enabled on a decoder running
+  * below 48 kHz, only the part of the spectrum below the output Nyquist
+  * frequency goes through a correspondingly smaller inverse MDCT, and the
+  * post-filter, de-emphasis and packet loss concealment run at the output
+  * rate. This makes the CELT synthesis cost roughly proportional to the
+  * output rate.
+  *
+  * The output is not bit-exact with the default synthesis: it is advanced by
+  * a fraction of a sample, the de-emphasis response differs by up to 1 dB,
+  * and the post-filter and the concealment are approximated at the lower
+  * rate. Changing this setting resets the decoder state. It has no effect
+  * at 48 kHz, and survives decoder reset. It returns #OPUS_UNIMPLEMENTED in
+  * builds that cannot provide it (fixed-point small-footprint builds, and
+  * mono at 24 kHz in other small-footprint builds).
+  * @see OPUS_GET_REDUCED_SYNTHESIS
+  * @param[in] x <tt>opus_int32</tt>: Allowed values:
+  * <dl>
+  * <dt>0</dt><dd>Synthesize at 48 kHz (default).</dd>
+  * <dt>1</dt><dd>Synthesize at the output sampling rate.</dd>
+  * </dl>
+  * @hideinitializer */
+#define OPUS_SET_REDUCED_SYNTHESIS(x) OPUS_SET_REDUCED_SYNTHESIS_REQUEST, __opus_check_int(x)
+/** Gets whether the decoder synthesizes CELT frames at the output sampling rate.
+  * @see OPUS_SET_REDUCED_SYNTHESIS
+  * @param[out] x <tt>opus_int32 *</tt>: Returns one of the following values:
+  * <dl>
+  * <dt>0</dt><dd>Synthesis at 48 kHz (default).</dd>
+  * <dt>1</dt><dd>Synthesis at the output sampling rate.</dd>
+  * </dl>
+  * @hideinitializer */
+#define OPUS_GET_REDUCED_SYNTHESIS(x) OPUS_GET_REDUCED_SYNTHESIS_REQUEST, __opus_check_int_ptr(x)
+
 /** Gets the duration (in samples) of the last packet successfully decoded or concealed.
   * @param[out] x <tt>opus_int32 *</tt>: Number of samples (at current sampling rate).
   * @hideinitializer */
@@ -790,6 +909,39 @@ OPUS_EXPORT const char *opus_strerror(int error);
   * @returns Version string
   */
 OPUS_EXPORT const char *opus_get_version_string(void);
+
+/** Supplies the scratch arena used for temporary buffers by the calling
+  * thread.
+  *
+  * Builds configured with a pseudostack (NONTHREADSAFE_PSEUDOSTACK) take
+  * all temporary arrays from a per-thread arena instead of the C stack,
+  * which keeps the stack usage of the codec small and bounded. By default
+  * the library allocates that arena itself the first time a thread uses it.
+  * This call lets the application provide the memory instead, for example
+  * from a pool owned by a coroutine scheduler. The buffer must stay valid,
+  * and must not be shared with another thread, until it is replaced or
+  * released by another call to this function. Its size should be at least
+  * the largest value returned by opus_encoder_get_scratch_size() or
+  * opus_decoder_get_scratch_size() for the states used on this thread. The
+  * multistream, projection and batch calls need no more than the values for
+  * two channels, whatever the number of streams. Every allocation is
+  * checked against the end of the arena. A call that runs past it stops
+  * and returns #OPUS_ALLOC_FAIL, leaving the state it was given half
+  * updated: reset that state with #OPUS_RESET_STATE before using it again.
+  *
+  * Passing a NULL buffer detaches the current arena, freeing it if it was
+  * allocated by the library; a new one is allocated on next use. An arena
+  * the library allocated is not freed when its thread exits, so threads
+  * that come and go should call opus_set_scratch_buffer(NULL, 0) before
+  * exiting.
+  *
+  * @param[in] buf <tt>void*</tt>: Scratch memory, or NULL.
+  * @param[in] size <tt>opus_int32</tt>: Size of \a buf in bytes.
+  * @returns #OPUS_OK on success, #OPUS_BAD_ARG for an invalid size, or
+  *          #OPUS_UNIMPLEMENTED if the library places temporary arrays on
+  *          the C stack (variable length arrays or alloca()).
+  */
+OPUS_EXPORT int opus_set_scratch_buffer(void *buf, opus_int32 size);
 /**@}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,261 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file opus_group.h
+ * @brief Opus reference implementation group encoder API
+ */
+
+#ifndef OPUS_GROUP_H
+#define OPUS_GROUP_H
+
+#include "opus_multistream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @cond OPUS_INTERNAL_DOC */
+
+/** These are the actual group encoder CTL ID numbers.
+  * They should not be used directly by applications.
+  * In general, SETs should be even and GETs should be odd.*/
+/**@{*/
+#define OPUS_GROUP_GET_ENCODER_STATE_REQUEST 7001
+/**@}*/
+
+/** @endcond */
+
+/** @defgroup opus_group_ctls Group specific encoder CTLs
+  *
+  * These are convenience macros that are specific to the
+  * opus_group_encoder_ctl() interface.
+  * The CTLs from @ref opus_genericctls and @ref opus_encoderctls may be
+  * applied to a group encoder as well. Setting one applies it to every
+  * rendition, and getting one returns the value of the first rendition,
+  * except for #OPUS_GET_BITRATE, which returns the sum over all renditions.
+  * #OPUS_SET_BITRATE is not supported on the group; use
+  * #OPUS_GROUP_GET_ENCODER_STATE to change the bitrate of one rendition.
+  */
+/**@{*/
+
+/** Gets the encoder state for an individual rendition of a group encoder.
+  * @param[in] x <tt>opus_int32</tt>: The index of the rendition whose encoder
+  *                                   you wish to retrieve.
+  *                                   This must be non-negative and less than
+  *                                   the <code>renditions</code> parameter
+  *                                   used to initialize the encoder.
+  * @param[out] y <tt>OpusEncoder**</tt>: Returns a pointer to the given
+  *                                       encoder state.
+  * @retval OPUS_BAD_ARG The index of the rendition was out of range.
+  * @hideinitializer
+  */
+#define OPUS_GROUP_GET_ENCODER_STATE(x,y) OPUS_GROUP_GET_ENCODER_STATE_REQUEST, __opus_check_int(x), __opus_check_encstate_ptr(y)
+
+/**@}*/
+
+/** @defgroup opus_group Opus Group Encoder API
+  * @{
+  *
+  * The group encoder encodes the same input into several independent Opus
+  * streams ("renditions"), typically at different bitrates for adaptive
+  * streaming. Each rendition is a complete OpusEncoder and produces the
+  * packets it would produce on its own; the group only avoids repeating
+  * work that does not depend on the rendition's settings: the tonality and
+  * music/speech analysis, which is run once per frame and shared by all the
+  * renditions that use it, and the coarse pitch search of the CELT
+  * prefilter, which is shared by the renditions that see the same
+  * prefilter history (the final pitch refinement remains per rendition).
+  *
+  * The renditions share the sampling rate, the channel count and the frame
+  * size of each call. Their other settings are independent and can be
+  * changed through #OPUS_GROUP_GET_ENCODER_STATE.
+  */
+
+/** Opus group encoder state.
+  * This contains the complete state of a group Opus encoder.
+  * It is position independent and can be freely copied.
+  * @see opus_group_encoder_create
+  * @see opus_group_encoder_init
+  */
+typedef struct OpusGroupEncoder OpusGroupEncoder;
+
+/** Gets the size of an OpusGroupEncoder structure.
+  * @param channels <tt>int</tt>: Number of channels (1 or 2) in the input
+  *                               signal.
+  * @param renditions <tt>int</tt>: Number of renditions to encode. This must
+  *                                 be between 1 and 255.
+  * @returns The size in bytes on success, or 0 on error.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT opus_int32 opus_group_encoder_get_size(
+      int channels,
+      int renditions
+);
+
+/** Allocates and initializes a group encoder state.
+  * Call opus_group_encoder_destroy() to release this object when finished.
+  * @param Fs <tt>opus_int32</tt>: Sampling rate of the input signal (in Hz).
+  *                                This must be one of 8000, 12000, 16000,
+  *                                24000, or 48000.
+  * @param channels <tt>int</tt>: Number of channels (1 or 2) in the input
+  *                               signal.
+  * @param renditions <tt>int</tt>: Number of renditions to encode. This must
+  *                                 be between 1 and 255.
+  * @param[in] bitrates <tt>const opus_int32*</tt>: The target bitrate of each
+  *                                     rendition, as for #OPUS_SET_BITRATE.
+  *                                     This may be NULL to use #OPUS_AUTO for
+  *                                     all of them.
+  * @param application <tt>int</tt>: The target encoder application, as for
+  *                                  opus_encoder_create().
+  * @param[out] error <tt>int *</tt>: Returns #OPUS_OK on success, or an error
+  *                                   code (see @ref opus_errorcodes) on
+  *                                   failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT OpusGroupEncoder *opus_group_encoder_create(
+      opus_int32 Fs,
+      int channels,
+      int renditions,
+      const opus_int32 *bitrates,
+      int application,
+      int *error
+);
+
+/** Initialize a previously allocated group encoder state.
+  * The memory pointed to by \a st must be at least the size returned by
+  * opus_group_encoder_get_size().
+  * This is intended for applications which use their own allocator instead of
+  * malloc.
+  * To reset a previously initialized state, use the #OPUS_RESET_STATE CTL.
+  * @see opus_group_encoder_create
+  * @see opus_group_encoder_get_size
+  * @param st <tt>OpusGroupEncoder*</tt>: Group encoder state to initialize.
+  * @param Fs <tt>opus_int32</tt>: Sampling rate of the input signal (in Hz).
+  *                                This must be one of 8000, 12000, 16000,
+  *                                24000, or 48000.
+  * @param channels <tt>int</tt>: Number of channels (1 or 2) in the input
+  *                               signal.
+  * @param renditions <tt>int</tt>: Number of renditions to encode. This must
+  *                                 be between 1 and 255.
+  * @param[in] bitrates <tt>const opus_int32*</tt>: The target bitrate of each
+  *                                     rendition, or NULL.
+  * @param application <tt>int</tt>: The target encoder application.
+  * @returns #OPUS_OK on success, or an error code (see @ref opus_errorcodes)
+  *          on failure.
+  */
+OPUS_EXPORT int opus_group_encoder_init(
+      OpusGroupEncoder *st,
+      opus_int32 Fs,
+      int channels,
+      int renditions,
+      const opus_int32 *bitrates,
+      int application
+) OPUS_ARG_NONNULL(1);
+
+/** Encodes one frame of audio into a packet for each rendition.
+  * @param st <tt>OpusGroupEncoder*</tt>: Group encoder state.
+  * @param[in] pcm <tt>const opus_int16*</tt>: The input signal as interleaved
+  *                                            samples.
+  *                                            This must contain
+  *                                            <code>frame_size*channels</code>
+  *                                            samples.
+  * @param frame_size <tt>int</tt>: Number of samples per channel in the input
+  *                                 signal, as for opus_encode().
+  * @param[out] data <tt>unsigned char*</tt>: Output buffer of
+  *                                          <code>renditions*max_data_bytes</code>
+  *                                          bytes. The packet of rendition
+  *                                          <code>i</code> is written at
+  *                                          <code>data + i*max_data_bytes</code>.
+  * @param max_data_bytes <tt>opus_int32</tt>: Size of the space reserved for
+  *                                            each packet.
+  * @param[out] len <tt>opus_int32*</tt>: Returns the length in bytes of the
+  *                                       packet of each rendition.
+  * @returns #OPUS_OK on success, or a negative error code (see
+  *          @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_group_encode(
+    OpusGroupEncoder *st,
+    const opus_int16 *pcm,
+    int frame_size,
+    unsigned char *data,
+    opus_int32 max_data_bytes,
+    opus_int32 *len
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4) OPUS_ARG_NONNULL(6);
+
+/** Encodes one frame of floating point audio into a packet for each
+  * rendition.
+  * @param st <tt>OpusGroupEncoder*</tt>: Group encoder state.
+  * @param[in] pcm <tt>const float*</tt>: The input signal as interleaved
+  *                                       samples with a normal range of
+  *                                       +/-1.0, as for opus_encode_float().
+  * @param frame_size <tt>int</tt>: Number of samples per channel in the input
+  *                                 signal, as for opus_encode().
+  * @param[out] data <tt>unsigned char*</tt>: Output buffer of
+  *                                          <code>renditions*max_data_bytes</code>
+  *                                          bytes, laid out as for
+  *                                          opus_group_encode().
+  * @param max_data_bytes <tt>opus_int32</tt>: Size of the space reserved for
+  *                                            each packet.
+  * @param[out] len <tt>opus_int32*</tt>: Returns the length in bytes of the
+  *                                       packet of each rendition.
+  * @returns #OPUS_OK on success, or a negative error code (see
+  *          @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_group_encode_float(
+    OpusGroupEncoder *st,
+    const float *pcm,
+    int frame_size,
+    unsigned char *data,
+    opus_int32 max_data_bytes,
+    opus_int32 *len
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4) OPUS_ARG_NONNULL(6);
+
+/** Frees an <code>OpusGroupEncoder</code> allocated by
+  * opus_group_encoder_create().
+  * @param st <tt>OpusGroupEncoder*</tt>: Group encoder state to be freed.
+  */
+OPUS_EXPORT void opus_group_encoder_destroy(OpusGroupEncoder *st);
+
+/** Perform a CTL function on a group Opus encoder.
+  *
+  * Generally the request and subsequent arguments are generated by a
+  * convenience macro.
+  * @param st <tt>OpusGroupEncoder*</tt>: Group encoder state.
+  * @param request This and all remaining parameters should be replaced by one
+  *                of the convenience macros in @ref opus_genericctls,
+  *                @ref opus_encoderctls, or @ref opus_group_ctls.
+  * @see opus_genericctls
+  * @see opus_encoderctls
+  * @see opus_group_ctls
+  */
+OPUS_EXPORT int opus_group_encoder_ctl(OpusGroupEncoder *st, int request, ...) OPUS_ARG_NONNULL(1);
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OPUS_GROUP_H */
@@ -46,6 +46,7 @@ extern "C" {
 /**@{*/
 #define __opus_check_encstate_ptr(ptr) ((ptr) + ((ptr) - (OpusEncoder**)(ptr)))
 #define __opus_check_decstate_ptr(ptr) ((ptr) + ((ptr) - (OpusDecoder**)(ptr)))
+#define __opus_check_executor(f) (((void)((f) == (opus_executor_func)0)), (opus_executor_func)(f))
 /**@}*/
 
 /** These are the actual encoder and decoder CTL ID numbers.
@@ -54,6 +55,7 @@ extern "C" {
 /**@{*/
 #define OPUS_MULTISTREAM_GET_ENCODER_STATE_REQUEST 5120
 #define OPUS_MULTISTREAM_GET_DECODER_STATE_REQUEST 5122
+#define OPUS_MULTISTREAM_SET_EXECUTOR_REQUEST 5124
 /**@}*/
 
 /** @endcond */
@@ -98,6 +100,37 @@ extern "C" {
   */
 #define OPUS_MULTISTREAM_GET_DECODER_STATE(x,y) OPUS_MULTISTREAM_GET_DECODER_STATE_REQUEST, __opus_check_int(x), __opus_check_decstate_ptr(y)
 
+/** Configures an executor that runs the per-stream work of a multistream
+  * encoder or decoder concurrently.
+  * The executor is called once per frame with up to one job per stream. It may run
+  * the jobs on any threads, in any order, but must not return before all of
+  * them have completed. The output is bit-exact with the serial path.
+  *
+  * An encoder calls the executor after the bitrate allocation between
+  * streams has been decided. Each job encodes into its own slot of a buffer
+  * of <code>streams*(6*1275+12)</code> bytes that the encoder allocates when
+  * the executor is set and frees when it is reset to NULL or the encoder is
+  * destroyed. An encoder initialized in caller-allocated memory must reset
+  * the executor to NULL before that memory is released. In CBR, the last
+  * stream is sized to fill the bytes the others left, so it is encoded on
+  * the calling thread after the others. The encoder encodes serially when
+  * the output buffer is smaller than the largest packets all the streams
+  * could produce together (in VBR, about 1277 bytes per stream and per
+  * 20 ms), since a stream's packet could then depend on the size of the
+  * streams before it.
+  *
+  * A decoder's jobs each decode one stream and write its channels directly
+  * into the interleaved output. If a stream fails to decode, the first error
+  * in stream order is returned, but the other streams will still have been
+  * decoded. Projection decoders, whose demixing combines every stream into
+  * every output channel, always decode serially.
+  * @param[in] f <tt>#opus_executor_func</tt>: The executor, or NULL to
+  *                                            run serially (the default).
+  * @param[in] d <tt>void*</tt>: Opaque data passed back to the executor.
+  * @hideinitializer
+  */
+#define OPUS_MULTISTREAM_SET_EXECUTOR(f,d) OPUS_MULTISTREAM_SET_EXECUTOR_REQUEST, __opus_check_executor(f), (void*)(d)
+
 /**@}*/
 
 /** @defgroup opus_multistream Opus Multistream API
@@ -182,6 +215,25 @@ typedef struct OpusMSEncoder OpusMSEncoder;
   */
 typedef struct OpusMSDecoder OpusMSDecoder;
 
+/** A unit of work handed to an #opus_executor_func.
+  * @param arg <tt>void*</tt>: Opaque argument supplied by the library.
+  * @param index <tt>int</tt>: Index of the job, from 0 to <code>count-1</code>.
+  */
+typedef void (*opus_job_func)(void *arg, int index);
+
+/** Application-supplied executor for independent jobs.
+  * This must call <code>job(arg, i)</code> exactly once for each
+  * <code>i</code> in <code>[0, count)</code>, possibly concurrently, and
+  * return only after all the calls have returned.
+  * @param executor_data <tt>void*</tt>: The data pointer registered with
+  *                                      #OPUS_MULTISTREAM_SET_EXECUTOR.
+  * @param job <tt>opus_job_func</tt>: The job to run.
+  * @param arg <tt>void*</tt>: Argument to pass to \a job.
+  * @param count <tt>int</tt>: Number of jobs.
+  */
+typedef void (*opus_executor_func)(void *executor_data, opus_job_func job,
+      void *arg, int count);
+
 /**\name Multistream encoder functions */
 /**@{*/
 
@@ -427,6 +479,52 @@ OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_multistream_encode_float(
       opus_int32 max_data_bytes
 ) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4);
 
+/** Encodes a multistream Opus frame from planar (non-interleaved) input.
+  * Each channel is read straight from its own buffer, so this costs no more
+  * than opus_multistream_encode() and is bit-exact with it.
+  * @param st <tt>OpusMSEncoder*</tt>: Multistream encoder state.
+  * @param[in] pcm <tt>const opus_int16**</tt>: Array of one input buffer per
+  *                                             channel, each holding
+  *                                             \a frame_size samples.
+  * @param frame_size <tt>int</tt>: Number of samples per channel in the input
+  *                                 signal, as for opus_multistream_encode().
+  * @param[out] data <tt>unsigned char*</tt>: Output payload.
+  * @param max_data_bytes <tt>opus_int32</tt>: Size of the allocated memory
+  *                                            for the output payload.
+  * @returns The length of the encoded packet (in bytes) on success or a
+  *          negative error code (see @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_multistream_encode_planar(
+      OpusMSEncoder *st,
+      const opus_int16 * const *pcm,
+      int frame_size,
+      unsigned char *data,
+      opus_int32 max_data_bytes
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4);
+
+/** Encodes a multistream Opus frame from planar (non-interleaved) floating
+  * point input.
+  * This is bit-exact with opus_multistream_encode_float().
+  * @param st <tt>OpusMSEncoder*</tt>: Multistream encoder state.
+  * @param[in] pcm <tt>const float**</tt>: Array of one input buffer per
+  *                                        channel, each holding
+  *                                        \a frame_size samples.
+  * @param frame_size <tt>int</tt>: Number of samples per channel in the input
+  *                                 signal.
+  * @param[out] data <tt>unsigned char*</tt>: Output payload.
+  * @param max_data_bytes <tt>opus_int32</tt>: Size of the allocated memory
+  *                                            for the output payload.
+  * @returns The length of the encoded packet (in bytes) on success or a
+  *          negative error code (see @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_multistream_encode_planar_float(
+      OpusMSEncoder *st,
+      const float * const *pcm,
+      int frame_size,
+      unsigned char *data,
+      opus_int32 max_data_bytes
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4);
+
 /** Frees an <code>OpusMSEncoder</code> allocated by
   * opus_multistream_encoder_create().
   * @param st <tt>OpusMSEncoder*</tt>: Multistream encoder state to be freed.
@@ -629,6 +727,63 @@ OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_multistream_decode_float(
     int decode_fec
 ) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(4);
 
+/** Decode a multistream Opus packet into planar (non-interleaved) output.
+  * Each decoded channel is written straight to its own buffer, so this
+  * costs no more than opus_multistream_decode() and is bit-exact with it.
+  * @param st <tt>OpusMSDecoder*</tt>: Multistream decoder state.
+  * @param[in] data <tt>const unsigned char*</tt>: Input payload.
+  *                                                Use a <code>NULL</code>
+  *                                                pointer to indicate packet
+  *                                                loss.
+  * @param len <tt>opus_int32</tt>: Number of bytes in payload.
+  * @param[out] pcm <tt>opus_int16**</tt>: Array of one output buffer per
+  *                                        channel, each with room for
+  *                                        \a frame_size samples.
+  * @param frame_size <tt>int</tt>: The number of samples per channel of
+  *                                 available space in each buffer, with the
+  *                                 same constraints as for
+  *                                 opus_multistream_decode().
+  * @param decode_fec <tt>int</tt>: Flag (0 or 1) to request that any in-band
+  *                                 forward error correction data be decoded.
+  * @returns Number of samples decoded on success or a negative error code
+  *          (see @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_multistream_decode_planar(
+    OpusMSDecoder *st,
+    const unsigned char *data,
+    opus_int32 len,
+    opus_int16 * const *pcm,
+    int frame_size,
+    int decode_fec
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(4);
+
+/** Decode a multistream Opus packet into planar (non-interleaved) floating
+  * point output.
+  * This is bit-exact with opus_multistream_decode_float().
+  * @param st <tt>OpusMSDecoder*</tt>: Multistream decoder state.
+  * @param[in] data <tt>const unsigned char*</tt>: Input payload, or
+  *                                                <code>NULL</code> to
+  *                                                indicate packet loss.
+  * @param len <tt>opus_int32</tt>: Number of bytes in payload.
+  * @param[out] pcm <tt>float**</tt>: Array of one output buffer per channel,
+  *                                   each with room for \a frame_size
+  *                                   samples.
+  * @param frame_size <tt>int</tt>: The number of samples per channel of
+  *                                 available space in each buffer.
+  * @param decode_fec <tt>int</tt>: Flag (0 or 1) to request that any in-band
+  *                                 forward error correction data be decoded.
+  * @returns Number of samples decoded on success or a negative error code
+  *          (see @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_multistream_decode_planar_float(
+    OpusMSDecoder *st,
+    const unsigned char *data,
+    opus_int32 len,
+    float * const *pcm,
+    int frame_size,
+    int decode_fec
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(4);
+
 /** Perform a CTL function on a multistream Opus decoder.
   *
   * Generally the request and subsequent arguments are generated by a
@@ -0,0 +1,145 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file opus_probe.h
+ * @brief Opus reference implementation packet probe API
+ */
+
+#ifndef OPUS_PROBE_H
+#define OPUS_PROBE_H
+
+#include "opus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup opus_probe Opus Probe API
+  * @{
+  *
+  * The probe gives an approximate level and a voice-activity flag for each
+  * frame of an Opus stream, for things like active-speaker detection or
+  * loudness monitoring in a mixer, at a small fraction of the cost of
+  * opus_decode(). Only the side information of each frame is read:
+  *
+  * - for SILK and hybrid frames, the VAD flags sent by the encoder, and a
+  *   level estimated from the gains, pulse counts, pitch predictor and LPC
+  *   filter of the first 20 ms (or 10 ms) of the frame, without decoding
+  *   the excitation;
+  * - for CELT frames, the silence flag and the band energies, from which
+  *   the level is computed. CELT carries no VAD flag, so a frame is marked
+  *   active when it is not silent and its level is above -60 dB.
+  *
+  * The level is the mean power of the frame in dB relative to a full-scale
+  * square wave (an RMS of 32768 in 16-bit samples), and is only accurate
+  * to a few dB. Hybrid frames report the level of the SILK layer alone,
+  * that is, of the content below 8 kHz. Empty (DTX or lost) frames are
+  * reported as inactive, at the lowest level.
+  *
+  * Like a decoder, a probe instance follows a single stream and the
+  * packets must be passed in order, since gains and energies are coded
+  * relative to the previous frame.
+  */
+
+/** Lowest level reported by opus_probe_packet(), in Q8 dB. */
+#define OPUS_PROBE_MIN_LEVEL (-127*256)
+
+/** Opus probe state.
+  * This contains the complete state of a probe.
+  * @see opus_probe_create
+  * @see opus_probe_init
+  */
+typedef struct OpusProbe OpusProbe;
+
+/** Gets the size of an OpusProbe structure.
+  * @returns The size in bytes.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_probe_get_size(void);
+
+/** Allocates and initializes a probe state.
+  * Call opus_probe_destroy() to release this object when finished.
+  * @param[out] error <tt>int *</tt>: Returns #OPUS_OK on success, or an error
+  *                                   code (see @ref opus_errorcodes) on
+  *                                   failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT OpusProbe *opus_probe_create(
+      int *error
+);
+
+/** Initialize a previously allocated probe state, or reset it to follow a
+  * new stream.
+  * The memory pointed to by \a st must be at least the size returned by
+  * opus_probe_get_size().
+  * This is intended for applications which use their own allocator instead of
+  * malloc.
+  * @see opus_probe_create
+  * @see opus_probe_get_size
+  * @param st <tt>OpusProbe*</tt>: Probe state to initialize.
+  * @returns #OPUS_OK on success, or an error code (see @ref opus_errorcodes)
+  *          on failure.
+  */
+OPUS_EXPORT int opus_probe_init(
+      OpusProbe *st
+) OPUS_ARG_NONNULL(1);
+
+/** Probes one Opus packet.
+  * @param st <tt>OpusProbe*</tt>: Probe state.
+  * @param[in] data <tt>const unsigned char*</tt>: Input packet.
+  * @param len <tt>opus_int32</tt>: Number of bytes in the input packet.
+  * @param[out] level <tt>opus_int16*</tt>: Level of each frame, in dB
+  *                                        relative to full scale (Q8),
+  *                                        between #OPUS_PROBE_MIN_LEVEL
+  *                                        and 0. This must have room for
+  *                                        48 entries, the largest number
+  *                                        of frames in a packet.
+  * @param[out] active <tt>unsigned char*</tt>: Voice-activity flag of each
+  *                                            frame (1 or 0). This must
+  *                                            have room for 48 entries.
+  * @returns The number of frames in the packet on success, or a negative
+  *          error code (see @ref opus_errorcodes) on failure.
+  * @retval OPUS_INVALID_PACKET The input is not a valid Opus packet.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_probe_packet(
+    OpusProbe *st,
+    const unsigned char *data,
+    opus_int32 len,
+    opus_int16 *level,
+    unsigned char *active
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4) OPUS_ARG_NONNULL(5);
+
+/** Frees an <code>OpusProbe</code> allocated by opus_probe_create().
+  * @param st <tt>OpusProbe*</tt>: Probe state to be freed.
+  */
+OPUS_EXPORT void opus_probe_destroy(OpusProbe *st);
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OPUS_PROBE_H */
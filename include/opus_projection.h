@@ -306,6 +306,54 @@ OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_projection_encode_float(
     opus_int32 max_data_bytes
 ) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4);
 
+/** Encodes a projection Opus frame from planar (non-interleaved) input.
+  * The mixing matrix reads each channel straight from its own buffer; the
+  * result is bit-exact with opus_projection_encode().
+  * @param st <tt>OpusProjectionEncoder*</tt>: Projection encoder state.
+  * @param[in] pcm <tt>const opus_int16**</tt>: Array of one input buffer per
+  *                                             channel, each holding
+  *                                             \a frame_size samples.
+  * @param frame_size <tt>int</tt>: Number of samples per channel in the input
+  *                                 signal, as for opus_projection_encode().
+  * @param[out] data <tt>unsigned char*</tt>: Output payload.
+  * @param [in] max_data_bytes <tt>opus_int32</tt>: Size of the allocated
+  *                                                 memory for the output
+  *                                                 payload.
+  * @returns The length of the encoded packet (in bytes) on success or a
+  *          negative error code (see @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_projection_encode_planar(
+    OpusProjectionEncoder *st,
+    const opus_int16 * const *pcm,
+    int frame_size,
+    unsigned char *data,
+    opus_int32 max_data_bytes
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4);
+
+/** Encodes a projection Opus frame from planar (non-interleaved) floating
+  * point input.
+  * This is bit-exact with opus_projection_encode_float().
+  * @param st <tt>OpusProjectionEncoder*</tt>: Projection encoder state.
+  * @param[in] pcm <tt>const float**</tt>: Array of one input buffer per
+  *                                        channel, each holding
+  *                                        \a frame_size samples.
+  * @param frame_size <tt>int</tt>: Number of samples per channel in the input
+  *                                 signal.
+  * @param[out] data <tt>unsigned char*</tt>: Output payload.
+  * @param [in] max_data_bytes <tt>opus_int32</tt>: Size of the allocated
+  *                                                 memory for the output
+  *                                                 payload.
+  * @returns The length of the encoded packet (in bytes) on success or a
+  *          negative error code (see @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_projection_encode_planar_float(
+    OpusProjectionEncoder *st,
+    const float * const *pcm,
+    int frame_size,
+    unsigned char *data,
+    opus_int32 max_data_bytes
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4);
+
 
 /** Frees an <code>OpusProjectionEncoder</code> allocated by
   * opus_projection_ambisonics_encoder_create().
@@ -532,6 +580,62 @@ OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_projection_decode_float(
     int decode_fec
 ) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(4);
 
+/** Decode a projection Opus packet into planar (non-interleaved) output.
+  * The demixing matrix writes each output channel straight to its own
+  * buffer; the result is bit-exact with opus_projection_decode().
+  * @param st <tt>OpusProjectionDecoder*</tt>: Projection decoder state.
+  * @param[in] data <tt>const unsigned char*</tt>: Input payload, or
+  *                                                <code>NULL</code> to
+  *                                                indicate packet loss.
+  * @param len <tt>opus_int32</tt>: Number of bytes in payload.
+  * @param[out] pcm <tt>opus_int16**</tt>: Array of one output buffer per
+  *                                        channel, each with room for
+  *                                        \a frame_size samples.
+  * @param frame_size <tt>int</tt>: The number of samples per channel of
+  *                                 available space in each buffer, with the
+  *                                 same constraints as for
+  *                                 opus_projection_decode().
+  * @param decode_fec <tt>int</tt>: Flag (0 or 1) to request that any in-band
+  *                                 forward error correction data be decoded.
+  * @returns Number of samples decoded on success or a negative error code
+  *          (see @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_projection_decode_planar(
+    OpusProjectionDecoder *st,
+    const unsigned char *data,
+    opus_int32 len,
+    opus_int16 * const *pcm,
+    int frame_size,
+    int decode_fec
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(4);
+
+/** Decode a projection Opus packet into planar (non-interleaved) floating
+  * point output.
+  * This is bit-exact with opus_projection_decode_float().
+  * @param st <tt>OpusProjectionDecoder*</tt>: Projection decoder state.
+  * @param[in] data <tt>const unsigned char*</tt>: Input payload, or
+  *                                                <code>NULL</code> to
+  *                                                indicate packet loss.
+  * @param len <tt>opus_int32</tt>: Number of bytes in payload.
+  * @param[out] pcm <tt>float**</tt>: Array of one output buffer per channel,
+  *                                   each with room for \a frame_size
+  *                                   samples.
+  * @param frame_size <tt>int</tt>: The number of samples per channel of
+  *                                 available space in each buffer.
+  * @param decode_fec <tt>int</tt>: Flag (0 or 1) to request that any in-band
+  *                                 forward error correction data be decoded.
+  * @returns Number of samples decoded on success or a negative error code
+  *          (see @ref opus_errorcodes) on failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_projection_decode_planar_float(
+    OpusProjectionDecoder *st,
+    const unsigned char *data,
+    opus_int32 len,
+    float * const *pcm,
+    int frame_size,
+    int decode_fec
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(4);
+
 
 /** Perform a CTL function on a projection Opus decoder.
   *
@@ -0,0 +1,164 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+ * @file opus_transrater.h
+ * @brief Opus reference implementation CELT transrater API
+ */
+
+#ifndef OPUS_TRANSRATER_H
+#define OPUS_TRANSRATER_H
+
+#include "opus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup opus_transrater Opus Transrater API
+  * @{
+  *
+  * The transrater lowers the bitrate of an existing CELT-only Opus stream
+  * without decoding it to PCM. Each frame is parsed down to its band
+  * energies and normalised band shapes, which are then quantised again
+  * with a smaller bit budget. The MDCTs, the pitch pre-filter, the
+  * transient and tonality analysis of a normal encode are all skipped,
+  * and the side information of the input (post-filter, transient and tf
+  * decisions, spreading, allocation trim) is carried over to the output.
+  *
+  * A transrater instance follows a single stream: the packets must be
+  * passed in order, starting with the first packet of the stream, since
+  * the energies of a frame are predicted from the previous one. Packets
+  * that use the SILK layer, or that contain empty (DTX or lost) frames,
+  * are rejected with #OPUS_UNIMPLEMENTED.
+  *
+  * The target bitrate is given at creation and can be changed with
+  * #OPUS_SET_BITRATE. Frames that already fit in the target are passed
+  * through unchanged for as long as the output has not diverged from the
+  * input. #OPUS_SET_COMPLEXITY, #OPUS_GET_FINAL_RANGE and
+  * #OPUS_RESET_STATE are also supported by opus_transrater_ctl().
+  */
+
+/** Opus transrater state.
+  * This contains the complete state of a transrater.
+  * @see opus_transrater_create
+  * @see opus_transrater_init
+  */
+typedef struct OpusTransrater OpusTransrater;
+
+/** Gets the size of an OpusTransrater structure.
+  * @returns The size in bytes.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_transrater_get_size(void);
+
+/** Allocates and initializes a transrater state.
+  * Call opus_transrater_destroy() to release this object when finished.
+  * @param bitrate <tt>opus_int32</tt>: Target bitrate of the output (in
+  *                                     bits per second), as for
+  *                                     #OPUS_SET_BITRATE.
+  * @param[out] error <tt>int *</tt>: Returns #OPUS_OK on success, or an error
+  *                                   code (see @ref opus_errorcodes) on
+  *                                   failure.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT OpusTransrater *opus_transrater_create(
+      opus_int32 bitrate,
+      int *error
+);
+
+/** Initialize a previously allocated transrater state.
+  * The memory pointed to by \a st must be at least the size returned by
+  * opus_transrater_get_size().
+  * This is intended for applications which use their own allocator instead of
+  * malloc.
+  * To reset a previously initialized state, use the #OPUS_RESET_STATE CTL.
+  * @see opus_transrater_create
+  * @see opus_transrater_get_size
+  * @param st <tt>OpusTransrater*</tt>: Transrater state to initialize.
+  * @param bitrate <tt>opus_int32</tt>: Target bitrate of the output (in
+  *                                     bits per second).
+  * @returns #OPUS_OK on success, or an error code (see @ref opus_errorcodes)
+  *          on failure.
+  */
+OPUS_EXPORT int opus_transrater_init(
+      OpusTransrater *st,
+      opus_int32 bitrate
+) OPUS_ARG_NONNULL(1);
+
+/** Transrates one Opus packet.
+  * @param st <tt>OpusTransrater*</tt>: Transrater state.
+  * @param[in] data <tt>const unsigned char*</tt>: Input packet.
+  * @param len <tt>opus_int32</tt>: Number of bytes in the input packet.
+  * @param[out] out <tt>unsigned char*</tt>: Output packet. This must not
+  *                                         overlap the input.
+  * @param max_out_bytes <tt>opus_int32</tt>: Size of the output buffer. No
+  *                                           frame grows, but the framing can
+  *                                           take up to 2 more bytes per
+  *                                           frame, so <code>len+96</code>
+  *                                           bytes are always enough.
+  * @returns The length of the output packet (in bytes) on success, or a
+  *          negative error code (see @ref opus_errorcodes) on failure. The
+  *          state is left unchanged on failure, so the same packet can be
+  *          submitted again with a larger buffer.
+  * @retval OPUS_INVALID_PACKET The input is not a valid Opus packet.
+  * @retval OPUS_UNIMPLEMENTED The input is not a CELT-only packet, or it
+  *                            contains an empty frame.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT opus_int32 opus_transrate(
+    OpusTransrater *st,
+    const unsigned char *data,
+    opus_int32 len,
+    unsigned char *out,
+    opus_int32 max_out_bytes
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(4);
+
+/** Frees an <code>OpusTransrater</code> allocated by
+  * opus_transrater_create().
+  * @param st <tt>OpusTransrater*</tt>: Transrater state to be freed.
+  */
+OPUS_EXPORT void opus_transrater_destroy(OpusTransrater *st);
+
+/** Perform a CTL function on an Opus transrater.
+  *
+  * Generally the request and subsequent arguments are generated by a
+  * convenience macro. The supported requests are #OPUS_SET_BITRATE,
+  * #OPUS_GET_BITRATE, #OPUS_SET_COMPLEXITY, #OPUS_GET_COMPLEXITY,
+  * #OPUS_GET_FINAL_RANGE and #OPUS_RESET_STATE.
+  * @param st <tt>OpusTransrater*</tt>: Transrater state.
+  * @param request This and all remaining parameters should be replaced by one
+  *                of the convenience macros in @ref opus_genericctls or
+  *                @ref opus_encoderctls.
+  * @see opus_genericctls
+  * @see opus_encoderctls
+  */
+OPUS_EXPORT int opus_transrater_ctl(OpusTransrater *st, int request, ...) OPUS_ARG_NONNULL(1);
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OPUS_TRANSRATER_H */
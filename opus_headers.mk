@@ -2,8 +2,15 @@ OPUS_HEAD = \
 include/opus.h \
 include/opus_multistream.h \
 include/opus_projection.h \
+include/opus_group.h \
+include/opus_transrater.h \
+include/opus_probe.h \
 src/opus_private.h \
 src/analysis.h \
 src/mapping_matrix.h \
 src/mlp.h \
-src/tansig_table.h
+src/resample_44k1.h \
+src/resample_44k1_tables.h \
+src/tansig_table.h \
+src/x86/mlp_sse.h \
+src/arm/mlp_arm.h
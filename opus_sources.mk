@@ -8,9 +8,24 @@ src/opus_multistream_decoder.c \
 src/repacketizer.c \
 src/opus_projection_encoder.c \
 src/opus_projection_decoder.c \
+src/opus_group_encoder.c \
+src/opus_transrater.c \
+src/opus_probe.c \
+src/resample_44k1.c \
 src/mapping_matrix.c
 
 OPUS_SOURCES_FLOAT = \
 src/analysis.c \
 src/mlp.c \
 src/mlp_data.c
+
+OPUS_SOURCES_FLOAT_SSE4_1 = \
+src/x86/x86_mlp_map.c \
+src/x86/mlp_sse4_1.c
+
+OPUS_SOURCES_FLOAT_AVX2 = \
+src/x86/mlp_avx2.c
+
+OPUS_SOURCES_FLOAT_ARM_NEON_INTR = \
+src/arm/arm_mlp_map.c \
+src/arm/mlp_neon.c
@@ -116,6 +116,20 @@ opus_int silk_Decode(                                   /* O    Returns error co
     int                             arch                /* I    Run-time architecture                           */
 );
 
+/*****************************************************/
+/* Read the VAD flags and level of a payload cheaply */
+/*****************************************************/
+opus_int silk_Probe(                                    /* O    Returns error code                              */
+    void                            *probeState,        /* I/O  State (silk_probe_state), zeroed to reset       */
+    ec_dec                          *psRangeDec,        /* I/O  Compressor data structure                       */
+    opus_int                        nChannelsInternal,  /* I    Number of internal channels (1/2)               */
+    opus_int                        payloadSize_ms,     /* I    Payload duration (10/20/40/60 ms)               */
+    opus_int32                      internalSampleRate, /* I    Internal sampling rate (Hz)                     */
+    opus_int                        *VAD,               /* O    1 if any frame of the mid channel is active     */
+    opus_int32                      *level_Q7,          /* O    log2 of the mean square of the first frame, Q7  */
+    int                             arch                /* I    Run-time architecture                           */
+);
+
 #if 0
 /**************************************/
 /* Get table of contents for a packet */
@@ -31,6 +31,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "main_FIX.h"
 #include "NSQ.h"
 #include "SigProc_FIX.h"
+#include "resampler_private.h"
 
 #if defined(OPUS_HAVE_RTCD)
 
@@ -99,6 +100,33 @@ opus_int32
   silk_NSQ_noise_shape_feedback_loop_neon, /* NEON */
 };
 
+opus_int16 *(*const SILK_RESAMPLER_PRIVATE_IIR_FIR_INTERPOL_IMPL[OPUS_ARCHMASK+1])(
+        opus_int16                  *out,               /* O    Output signal                   */
+        const opus_int16            *buf,               /* I    Upsampled input signal          */
+        opus_int32                  max_index_Q16,      /* I    End of the input, Q16           */
+        opus_int32                  index_increment_Q16 /* I    Input step per output, Q16      */
+) = {
+      silk_resampler_private_IIR_FIR_INTERPOL_c,    /* ARMv4 */
+      silk_resampler_private_IIR_FIR_INTERPOL_c,    /* EDSP */
+      silk_resampler_private_IIR_FIR_INTERPOL_c,    /* Media */
+      silk_resampler_private_IIR_FIR_INTERPOL_neon, /* Neon */
+};
+
+opus_int16 *(*const SILK_RESAMPLER_PRIVATE_DOWN_FIR_INTERPOL_IMPL[OPUS_ARCHMASK+1])(
+        opus_int16                  *out,               /* O    Output signal                   */
+        const opus_int32            *buf,               /* I    Filtered input signal, Q8       */
+        const opus_int16            *FIR_Coefs,         /* I    FIR coefficients                */
+        opus_int                    FIR_Order,          /* I    FIR order                       */
+        opus_int                    FIR_Fracs,          /* I    Number of FIR phases            */
+        opus_int32                  max_index_Q16,      /* I    End of the input, Q16           */
+        opus_int32                  index_increment_Q16 /* I    Input step per output, Q16      */
+) = {
+      silk_resampler_private_down_FIR_INTERPOL_c,    /* ARMv4 */
+      silk_resampler_private_down_FIR_INTERPOL_c,    /* EDSP */
+      silk_resampler_private_down_FIR_INTERPOL_c,    /* Media */
+      silk_resampler_private_down_FIR_INTERPOL_neon, /* Neon */
+};
+
 # endif
 
 # if defined(FIXED_POINT) && \
@@ -0,0 +1,72 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef SILK_RESAMPLER_ARM_H
+# define SILK_RESAMPLER_ARM_H
+
+# include "celt/arm/armcpu.h"
+
+# if defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+opus_int16 *silk_resampler_private_IIR_FIR_INTERPOL_neon(
+    opus_int16                      *out,           /* O    Output signal               */
+    const opus_int16                *buf,           /* I    Upsampled input signal      */
+    opus_int32                      max_index_Q16,  /* I    End of the input, Q16       */
+    opus_int32                      index_increment_Q16 /* I Input step per output, Q16 */
+);
+
+opus_int16 *silk_resampler_private_down_FIR_INTERPOL_neon(
+    opus_int16                      *out,           /* O    Output signal               */
+    const opus_int32                *buf,           /* I    Filtered input signal, Q8   */
+    const opus_int16                *FIR_Coefs,     /* I    FIR coefficients            */
+    opus_int                        FIR_Order,      /* I    FIR order                   */
+    opus_int                        FIR_Fracs,      /* I    Number of FIR phases        */
+    opus_int32                      max_index_Q16,  /* I    End of the input, Q16       */
+    opus_int32                      index_increment_Q16 /* I Input step per output, Q16 */
+);
+
+#  if defined(OPUS_HAVE_RTCD) && !defined(OPUS_ARM_PRESUME_NEON_INTR)
+extern opus_int16 *(*const SILK_RESAMPLER_PRIVATE_IIR_FIR_INTERPOL_IMPL[OPUS_ARCHMASK+1])(
+    opus_int16 *out, const opus_int16 *buf, opus_int32 max_index_Q16, opus_int32 index_increment_Q16);
+extern opus_int16 *(*const SILK_RESAMPLER_PRIVATE_DOWN_FIR_INTERPOL_IMPL[OPUS_ARCHMASK+1])(
+    opus_int16 *out, const opus_int32 *buf, const opus_int16 *FIR_Coefs, opus_int FIR_Order,
+    opus_int FIR_Fracs, opus_int32 max_index_Q16, opus_int32 index_increment_Q16);
+#   define OVERRIDE_silk_resampler_private_IIR_FIR_INTERPOL  (1)
+#   define OVERRIDE_silk_resampler_private_down_FIR_INTERPOL (1)
+#   define silk_resampler_private_IIR_FIR_INTERPOL(out, buf, max_index_Q16, index_increment_Q16, arch) \
+    ((*SILK_RESAMPLER_PRIVATE_IIR_FIR_INTERPOL_IMPL[(arch)&OPUS_ARCHMASK])(out, buf, max_index_Q16, index_increment_Q16))
+#   define silk_resampler_private_down_FIR_INTERPOL(out, buf, FIR_Coefs, FIR_Order, FIR_Fracs, max_index_Q16, index_increment_Q16, arch) \
+    ((*SILK_RESAMPLER_PRIVATE_DOWN_FIR_INTERPOL_IMPL[(arch)&OPUS_ARCHMASK])(out, buf, FIR_Coefs, FIR_Order, FIR_Fracs, max_index_Q16, index_increment_Q16))
+#  elif defined(OPUS_ARM_PRESUME_NEON_INTR)
+#   define OVERRIDE_silk_resampler_private_IIR_FIR_INTERPOL  (1)
+#   define OVERRIDE_silk_resampler_private_down_FIR_INTERPOL (1)
+#   define silk_resampler_private_IIR_FIR_INTERPOL(out, buf, max_index_Q16, index_increment_Q16, arch) \
+    ((void)(arch), silk_resampler_private_IIR_FIR_INTERPOL_neon(out, buf, max_index_Q16, index_increment_Q16))
+#   define silk_resampler_private_down_FIR_INTERPOL(out, buf, FIR_Coefs, FIR_Order, FIR_Fracs, max_index_Q16, index_increment_Q16, arch) \
+    ((void)(arch), silk_resampler_private_down_FIR_INTERPOL_neon(out, buf, FIR_Coefs, FIR_Order, FIR_Fracs, max_index_Q16, index_increment_Q16))
+#  endif
+# endif
+
+#endif /* end SILK_RESAMPLER_ARM_H */
@@ -0,0 +1,223 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <arm_neon.h>
+#include "SigProc_FIX.h"
+#include "resampler_private.h"
+
+/* Sums the lanes of each of the four accumulators: { sum( x0 ), sum( x1 ), sum( x2 ), sum( x3 ) } */
+static OPUS_INLINE int32x4_t silk_hsum4_s32( int32x2_t x0, int32x2_t x1, int32x2_t x2, int32x2_t x3 )
+{
+    return vcombine_s32( vpadd_s32( x0, x1 ), vpadd_s32( x2, x3 ) );
+}
+
+static OPUS_INLINE int32x2_t silk_fold_s32( int32x4_t x )
+{
+    return vadd_s32( vget_low_s32( x ), vget_high_s32( x ) );
+}
+
+static OPUS_INLINE int32x4_t silk_reverse_s32( int32x4_t x )
+{
+    x = vrev64q_s32( x );
+    return vcombine_s32( vget_high_s32( x ), vget_low_s32( x ) );
+}
+
+static OPUS_INLINE int32x2_t silk_IIR_FIR_mac( const opus_int16 *buf, opus_int32 index_Q16, const int16x8_t *coefs )
+{
+    int16x8_t x, c;
+    int32x4_t acc;
+    x = vld1q_s16( &buf[ index_Q16 >> 16 ] );
+    c = coefs[ silk_SMULWB( index_Q16 & 0xFFFF, 12 ) ];
+    acc = vmull_s16( vget_low_s16( x ), vget_low_s16( c ) );
+    acc = vmlal_s16( acc, vget_high_s16( x ), vget_high_s16( c ) );
+    return vpadd_s32( vget_low_s32( acc ), vget_high_s32( acc ) );
+}
+
+opus_int16 *silk_resampler_private_IIR_FIR_INTERPOL_neon(
+    opus_int16          *out,
+    const opus_int16    *buf,
+    opus_int32          max_index_Q16,
+    opus_int32          index_increment_Q16
+)
+{
+    opus_int32 index_Q16;
+    opus_int   t;
+    int16x8_t  coefs[ 12 ];
+    int32x2_t  x0, x1, x2, x3;
+
+    /* All eight taps of each phase, the second half being the mirrored phase */
+    for( t = 0; t < 12; t++ ) {
+        coefs[ t ] = vcombine_s16( vld1_s16( silk_resampler_frac_FIR_12[ t ] ),
+                                   vrev64_s16( vld1_s16( silk_resampler_frac_FIR_12[ 11 - t ] ) ) );
+    }
+
+    /* Four output samples at a time */
+    for( index_Q16 = 0; index_Q16 + 3 * index_increment_Q16 < max_index_Q16; index_Q16 += 4 * index_increment_Q16 ) {
+        x0 = silk_IIR_FIR_mac( buf, index_Q16,                           coefs );
+        x1 = silk_IIR_FIR_mac( buf, index_Q16 +     index_increment_Q16, coefs );
+        x2 = silk_IIR_FIR_mac( buf, index_Q16 + 2 * index_increment_Q16, coefs );
+        x3 = silk_IIR_FIR_mac( buf, index_Q16 + 3 * index_increment_Q16, coefs );
+        /* silk_SAT16( silk_RSHIFT_ROUND( res_Q15, 15 ) ) */
+        vst1_s16( out, vqrshrn_n_s32( silk_hsum4_s32( x0, x1, x2, x3 ), 15 ) );
+        out += 4;
+    }
+    for( ; index_Q16 < max_index_Q16; index_Q16 += index_increment_Q16 ) {
+        x0 = silk_IIR_FIR_mac( buf, index_Q16, coefs );
+        *out++ = (opus_int16)silk_SAT16( silk_RSHIFT_ROUND( vget_lane_s32( vpadd_s32( x0, x0 ), 0 ), 15 ) );
+    }
+    return out;
+}
+
+/* The coefficients are stored shifted left by 15, so that vqdmulh gives silk_SMULWB() */
+static OPUS_INLINE int32x2_t silk_down_FIR0_acc( const opus_int32 *buf_ptr, const int32x4_t *coefs, int32x2_t coefs2 )
+{
+    int32x4_t acc;
+    acc = vqdmulhq_s32( vld1q_s32( &buf_ptr[  0 ] ), coefs[ 0 ] );
+    acc = vaddq_s32( acc, vqdmulhq_s32( vld1q_s32( &buf_ptr[  4 ] ), coefs[ 1 ] ) );
+    acc = vaddq_s32( acc, vqdmulhq_s32( vld1q_s32( &buf_ptr[  8 ] ), coefs[ 2 ] ) );
+    acc = vaddq_s32( acc, vqdmulhq_s32( vld1q_s32( &buf_ptr[ 12 ] ), coefs[ 3 ] ) );
+    return vadd_s32( silk_fold_s32( acc ), vqdmulh_s32( vld1_s32( &buf_ptr[ 16 ] ), coefs2 ) );
+}
+
+/* Adds buf_ptr[ k ] to buf_ptr[ N - 1 - k ] for the four k starting at k0 */
+static OPUS_INLINE int32x4_t silk_down_FIR_sym_sum( const opus_int32 *buf_ptr, opus_int k0, opus_int N )
+{
+    return vaddq_s32( vld1q_s32( &buf_ptr[ k0 ] ), silk_reverse_s32( vld1q_s32( &buf_ptr[ N - 4 - k0 ] ) ) );
+}
+
+static OPUS_INLINE int32x2_t silk_down_FIR1_acc( const opus_int32 *buf_ptr, const int32x4_t *coefs )
+{
+    int32x4_t acc;
+    acc = vqdmulhq_s32( silk_down_FIR_sym_sum( buf_ptr, 0, RESAMPLER_DOWN_ORDER_FIR1 ), coefs[ 0 ] );
+    acc = vaddq_s32( acc, vqdmulhq_s32( silk_down_FIR_sym_sum( buf_ptr, 4, RESAMPLER_DOWN_ORDER_FIR1 ), coefs[ 1 ] ) );
+    acc = vaddq_s32( acc, vqdmulhq_s32( silk_down_FIR_sym_sum( buf_ptr, 8, RESAMPLER_DOWN_ORDER_FIR1 ), coefs[ 2 ] ) );
+    return silk_fold_s32( acc );
+}
+
+static OPUS_INLINE int32x2_t silk_down_FIR2_acc( const opus_int32 *buf_ptr, const int32x4_t *coefs, int32x2_t coefs2 )
+{
+    int32x4_t acc;
+    int32x2_t sum2;
+    acc = vqdmulhq_s32( silk_down_FIR_sym_sum( buf_ptr, 0, RESAMPLER_DOWN_ORDER_FIR2 ), coefs[ 0 ] );
+    acc = vaddq_s32( acc, vqdmulhq_s32( silk_down_FIR_sym_sum( buf_ptr,  4, RESAMPLER_DOWN_ORDER_FIR2 ), coefs[ 1 ] ) );
+    acc = vaddq_s32( acc, vqdmulhq_s32( silk_down_FIR_sym_sum( buf_ptr,  8, RESAMPLER_DOWN_ORDER_FIR2 ), coefs[ 2 ] ) );
+    acc = vaddq_s32( acc, vqdmulhq_s32( silk_down_FIR_sym_sum( buf_ptr, 12, RESAMPLER_DOWN_ORDER_FIR2 ), coefs[ 3 ] ) );
+    /* Taps 16 and 17 pair with 19 and 18 */
+    sum2 = vadd_s32( vld1_s32( &buf_ptr[ 16 ] ), vrev64_s32( vld1_s32( &buf_ptr[ 18 ] ) ) );
+    return vadd_s32( silk_fold_s32( acc ), vqdmulh_s32( sum2, coefs2 ) );
+}
+
+opus_int16 *silk_resampler_private_down_FIR_INTERPOL_neon(
+    opus_int16          *out,
+    const opus_int32    *buf,
+    const opus_int16    *FIR_Coefs,
+    opus_int            FIR_Order,
+    opus_int            FIR_Fracs,
+    opus_int32          max_index_Q16,
+    opus_int32          index_increment_Q16
+)
+{
+    opus_int32 index_Q16, interpol_ind;
+    opus_int   i, k;
+    opus_int32 taps[ RESAMPLER_DOWN_ORDER_FIR0 ];
+    int32x4_t  coefs[ 3 ][ 4 ];
+    int32x2_t  coefs2[ 3 ], x[ 4 ];
+
+    switch( FIR_Order ) {
+        case RESAMPLER_DOWN_ORDER_FIR0:
+            celt_assert( FIR_Fracs <= 3 );
+            /* Unfold each phase to 18 taps, the second half being the mirrored phase */
+            for( i = 0; i < FIR_Fracs; i++ ) {
+                for( k = 0; k < RESAMPLER_DOWN_ORDER_FIR0 / 2; k++ ) {
+                    taps[ k ] = silk_LSHIFT( (opus_int32)FIR_Coefs[ RESAMPLER_DOWN_ORDER_FIR0 / 2 * i + k ], 15 );
+                    taps[ RESAMPLER_DOWN_ORDER_FIR0 - 1 - k ] =
+                        silk_LSHIFT( (opus_int32)FIR_Coefs[ RESAMPLER_DOWN_ORDER_FIR0 / 2 * ( FIR_Fracs - 1 - i ) + k ], 15 );
+                }
+                for( k = 0; k < 4; k++ ) {
+                    coefs[ i ][ k ] = vld1q_s32( &taps[ 4 * k ] );
+                }
+                coefs2[ i ] = vld1_s32( &taps[ 16 ] );
+            }
+            for( index_Q16 = 0; index_Q16 + 3 * index_increment_Q16 < max_index_Q16; index_Q16 += 4 * index_increment_Q16 ) {
+                for( k = 0; k < 4; k++ ) {
+                    interpol_ind = silk_SMULWB( ( index_Q16 + k * index_increment_Q16 ) & 0xFFFF, FIR_Fracs );
+                    x[ k ] = silk_down_FIR0_acc( buf + silk_RSHIFT( index_Q16 + k * index_increment_Q16, 16 ),
+                                                 coefs[ interpol_ind ], coefs2[ interpol_ind ] );
+                }
+                /* silk_SAT16( silk_RSHIFT_ROUND( res_Q6, 6 ) ) */
+                vst1_s16( out, vqrshrn_n_s32( silk_hsum4_s32( x[ 0 ], x[ 1 ], x[ 2 ], x[ 3 ] ), 6 ) );
+                out += 4;
+            }
+            for( ; index_Q16 < max_index_Q16; index_Q16 += index_increment_Q16 ) {
+                interpol_ind = silk_SMULWB( index_Q16 & 0xFFFF, FIR_Fracs );
+                x[ 0 ] = silk_down_FIR0_acc( buf + silk_RSHIFT( index_Q16, 16 ), coefs[ interpol_ind ], coefs2[ interpol_ind ] );
+                *out++ = (opus_int16)silk_SAT16( silk_RSHIFT_ROUND( vget_lane_s32( vpadd_s32( x[ 0 ], x[ 0 ] ), 0 ), 6 ) );
+            }
+            break;
+        case RESAMPLER_DOWN_ORDER_FIR1:
+            for( k = 0; k < 3; k++ ) {
+                coefs[ 0 ][ k ] = vshll_n_s16( vld1_s16( &FIR_Coefs[ 4 * k ] ), 15 );
+            }
+            for( index_Q16 = 0; index_Q16 + 3 * index_increment_Q16 < max_index_Q16; index_Q16 += 4 * index_increment_Q16 ) {
+                for( k = 0; k < 4; k++ ) {
+                    x[ k ] = silk_down_FIR1_acc( buf + silk_RSHIFT( index_Q16 + k * index_increment_Q16, 16 ), coefs[ 0 ] );
+                }
+                vst1_s16( out, vqrshrn_n_s32( silk_hsum4_s32( x[ 0 ], x[ 1 ], x[ 2 ], x[ 3 ] ), 6 ) );
+                out += 4;
+            }
+            for( ; index_Q16 < max_index_Q16; index_Q16 += index_increment_Q16 ) {
+                x[ 0 ] = silk_down_FIR1_acc( buf + silk_RSHIFT( index_Q16, 16 ), coefs[ 0 ] );
+                *out++ = (opus_int16)silk_SAT16( silk_RSHIFT_ROUND( vget_lane_s32( vpadd_s32( x[ 0 ], x[ 0 ] ), 0 ), 6 ) );
+            }
+            break;
+        case RESAMPLER_DOWN_ORDER_FIR2:
+            for( k = 0; k < 4; k++ ) {
+                coefs[ 0 ][ k ] = vshll_n_s16( vld1_s16( &FIR_Coefs[ 4 * k ] ), 15 );
+            }
+            taps[ 0 ] = silk_LSHIFT( (opus_int32)FIR_Coefs[ 16 ], 15 );
+            taps[ 1 ] = silk_LSHIFT( (opus_int32)FIR_Coefs[ 17 ], 15 );
+            coefs2[ 0 ] = vld1_s32( taps );
+            for( index_Q16 = 0; index_Q16 + 3 * index_increment_Q16 < max_index_Q16; index_Q16 += 4 * index_increment_Q16 ) {
+                for( k = 0; k < 4; k++ ) {
+                    x[ k ] = silk_down_FIR2_acc( buf + silk_RSHIFT( index_Q16 + k * index_increment_Q16, 16 ), coefs[ 0 ], coefs2[ 0 ] );
+                }
+                vst1_s16( out, vqrshrn_n_s32( silk_hsum4_s32( x[ 0 ], x[ 1 ], x[ 2 ], x[ 3 ] ), 6 ) );
+                out += 4;
+            }
+            for( ; index_Q16 < max_index_Q16; index_Q16 += index_increment_Q16 ) {
+                x[ 0 ] = silk_down_FIR2_acc( buf + silk_RSHIFT( index_Q16, 16 ), coefs[ 0 ], coefs2[ 0 ] );
+                *out++ = (opus_int16)silk_SAT16( silk_RSHIFT_ROUND( vget_lane_s32( vpadd_s32( x[ 0 ], x[ 0 ] ), 0 ), 6 ) );
+            }
+            break;
+        default:
+            celt_assert( 0 );
+    }
+    return out;
+}
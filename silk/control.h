@@ -29,6 +29,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #define SILK_CONTROL_H
 
 #include "typedef.h"
+#include "profile_stats.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -118,6 +119,11 @@ typedef struct {
 
     /* O: SILK offset (dithering) */
     opus_int offset;
+
+#ifdef ENABLE_PROFILE_STATS
+    /* I:   Stage counters of the Opus encoder, or NULL                                     */
+    OpusProfile *profile;
+#endif
 } silk_EncControlStruct;
 
 /**************************************************************************/
@@ -337,7 +337,7 @@ opus_int silk_Decode(                                   /* O    Returns error co
     for( n = 0; n < silk_min( decControl->nChannelsAPI, decControl->nChannelsInternal ); n++ ) {
 
         /* Resample decoded signal to API_sampleRate */
-        ret += silk_resampler( &channel_state[ n ].resampler_state, resample_out_ptr, &samplesOut1_tmp[ n ][ 1 ], nSamplesOutDec );
+        ret += silk_resampler( &channel_state[ n ].resampler_state, resample_out_ptr, &samplesOut1_tmp[ n ][ 1 ], nSamplesOutDec, arch );
 
         /* Interleave if stereo output and stereo stream */
         if( decControl->nChannelsAPI == 2 ) {
@@ -352,7 +352,7 @@ opus_int silk_Decode(                                   /* O    Returns error co
         if ( stereo_to_mono ){
             /* Resample right channel for newly collapsed stereo just in case
                we weren't doing collapsing when switching to mono */
-            ret += silk_resampler( &channel_state[ 1 ].resampler_state, resample_out_ptr, &samplesOut1_tmp[ 0 ][ 1 ], nSamplesOutDec );
+            ret += silk_resampler( &channel_state[ 1 ].resampler_state, resample_out_ptr, &samplesOut1_tmp[ 0 ][ 1 ], nSamplesOutDec, arch );
 
             for( i = 0; i < *nSamplesOut; i++ ) {
                 samplesOut[ 1 + 2 * i ] = resample_out_ptr[ i ];
@@ -384,6 +384,251 @@ opus_int silk_Decode(                                   /* O    Returns error co
     return ret;
 }
 
+/* Length of the LPC impulse response used for the gain of the synthesis filter */
+#define PROBE_IMPULSE_LENGTH        64
+
+/* Correction of the voiced frames, whose LTP and LPC gains are underestimated */
+/* by the models (5 dB in log2, Q7)                                            */
+#define PROBE_VOICED_GAIN_Q7        213
+
+/* log2 of a + b, from log2 a and log2 b in Q7 */
+static OPUS_INLINE opus_int32 silk_probe_log_add(
+    opus_int32                      a_Q7,
+    opus_int32                      b_Q7
+)
+{
+    opus_int32 diff_Q7 = silk_abs( a_Q7 - b_Q7 );
+    if( diff_Q7 >= ( 16 << 7 ) ) {
+        return silk_max_32( a_Q7, b_Q7 );
+    }
+    return silk_max_32( a_Q7, b_Q7 ) + silk_lin2log( ( 1 << 16 ) + silk_log2lin( ( 16 << 7 ) - diff_Q7 ) ) - ( 16 << 7 );
+}
+
+/* log2 of a positive 64-bit value, Q7 */
+static OPUS_INLINE opus_int32 silk_probe_log2_64(
+    opus_int64                      x
+)
+{
+    opus_int shift = silk_max_int( 33 - silk_CLZ64( x ), 0 );
+    return silk_lin2log( silk_max_32( (opus_int32)silk_RSHIFT64( x, shift ), 1 ) ) + silk_LSHIFT( shift, 7 );
+}
+
+/* Expected energy of the excitation of a shell block, in Q4, given its number */
+/* of pulses above the LSBs. The pulses are assumed to land at random, or to be */
+/* spread out when the quantization offset is high, and the LSBs to be uniform. */
+static OPUS_INLINE opus_int32 silk_probe_block_energy(
+    opus_int                        sum_pulses,
+    opus_int                        nLS,
+    opus_int                        quantOffsetType,
+    opus_int                        offset_Q10
+)
+{
+    opus_int32 n = silk_LSHIFT( 1, nLS );
+    opus_int32 nrg_Q4;
+
+    /* Upper bits: E[ sum( p^2 ) ] = K + K * ( K - 1 ) / 16 for random positions */
+    nrg_Q4 = silk_SMULBB( sum_pulses, SHELL_CODEC_FRAME_LENGTH );
+    if( quantOffsetType == 0 ) {
+        nrg_Q4 += silk_SMULBB( sum_pulses, sum_pulses - 1 );
+    }
+    nrg_Q4 = silk_LSHIFT( nrg_Q4, 2 * nLS );
+    /* Cross terms and LSBs */
+    nrg_Q4 += silk_LSHIFT( sum_pulses * n * ( n - 1 ), 4 );
+    nrg_Q4 += silk_DIV32_16( silk_LSHIFT( ( n - 1 ) * ( 2 * n - 1 ), 8 ), 6 );
+    /* Level adjustment of the non-zero pulses, and quantization offset */
+    nrg_Q4 -= silk_RSHIFT( silk_SMULBB( silk_LSHIFT( sum_pulses, nLS ), QUANT_LEVEL_ADJUST_Q10 ), 5 );
+    nrg_Q4 += silk_RSHIFT( silk_SMULBB( offset_Q10, offset_Q10 ), 12 );
+    return silk_max_32( nrg_Q4, 1 );
+}
+
+/* Reads the VAD flags of a payload and estimates the level of its first frame  */
+/* from the mid channel side information, without decoding the excitation: the */
+/* energy of the excitation is predicted from the number of pulses of each      */
+/* shell block and the gains, the LTP synthesis is modelled with one power per  */
+/* pitch period, and the LPC synthesis by the energy of its impulse response.   */
+opus_int silk_Probe(                                    /* O    Returns error code                              */
+    void                            *probeState,        /* I/O  State (silk_probe_state), zeroed to reset       */
+    ec_dec                          *psRangeDec,        /* I/O  Compressor data structure                       */
+    opus_int                        nChannelsInternal,  /* I    Number of internal channels (1/2)               */
+    opus_int                        payloadSize_ms,     /* I    Payload duration (10/20/40/60 ms)               */
+    opus_int32                      internalSampleRate, /* I    Internal sampling rate (Hz)                     */
+    opus_int                        *VAD,               /* O    1 if any frame of the mid channel is active     */
+    opus_int32                      *level_Q7,          /* O    log2 of the mean square of the first frame, Q7  */
+    int                             arch                /* I    Run-time architecture                           */
+)
+{
+    opus_int   i, n, k, b, pos, len, lag, nFramesPerPacket, nb_subfr, nb_blocks, fs_kHz, condCoding;
+    opus_int   decode_only_middle = 0;
+    opus_int32 LBRR_symbol, offset_Q10, B_Q7, B2_Q7, exc_Q7, pred_Q7, nrg_Q7, pred_Q10;
+    opus_int32 MS_pred_Q13[ 2 ];
+    opus_int   pitchL[ MAX_NB_SUBFR ];
+    opus_int   sum_pulses[ MAX_NB_SHELL_BLOCKS ], nLshifts[ MAX_NB_SHELL_BLOCKS ];
+    opus_int32 Gains_Q16[ MAX_NB_SUBFR ];
+    opus_int32 exc_nrg_Q4[ MAX_NB_SUBFR ];
+    opus_int   exc_len[ MAX_NB_SUBFR ];
+    opus_int16 NLSF_Q15[ MAX_LPC_ORDER ];
+    opus_int16 A_Q12[ MAX_LPC_ORDER ];
+    opus_int32 h_Q14[ PROBE_IMPULSE_LENGTH ];
+    opus_int64 h_nrg_Q28;
+    opus_int16 pulses[ MAX_FRAME_LENGTH ];
+    const opus_int8 *cbk_ptr_Q7 = NULL;
+    silk_decoder_state channel_state[ DECODER_NUM_CHANNELS ];
+    silk_decoder_state *psDec;
+    silk_probe_state *psProbe = (silk_probe_state *)probeState;
+
+    if( nChannelsInternal < 1 || nChannelsInternal > 2 ) {
+        return SILK_DEC_INVALID_SAMPLING_FREQUENCY;
+    }
+    if( payloadSize_ms == 10 ) {
+        nFramesPerPacket = 1;
+        nb_subfr = MAX_NB_SUBFR/2;
+    } else if( payloadSize_ms == 20 || payloadSize_ms == 40 || payloadSize_ms == 60 ) {
+        nFramesPerPacket = payloadSize_ms / 20;
+        nb_subfr = MAX_NB_SUBFR;
+    } else {
+        return SILK_DEC_INVALID_FRAME_SIZE;
+    }
+    fs_kHz = ( internalSampleRate >> 10 ) + 1;
+    if( fs_kHz != 8 && fs_kHz != 12 && fs_kHz != 16 ) {
+        return SILK_DEC_INVALID_SAMPLING_FREQUENCY;
+    }
+    /* Same reset as silk_decoder_set_fs() */
+    if( psProbe->fs_kHz != fs_kHz ) {
+        silk_memset( psProbe, 0, sizeof( silk_probe_state ) );
+        psProbe->fs_kHz = fs_kHz;
+        psProbe->LastGainIndex = 10;
+    }
+    for( n = 0; n < nChannelsInternal; n++ ) {
+        silk_memset( &channel_state[ n ], 0, sizeof( channel_state[ n ] ) );
+        channel_state[ n ].nFramesPerPacket = nFramesPerPacket;
+        channel_state[ n ].nb_subfr = nb_subfr;
+        silk_decoder_set_fs( &channel_state[ n ], fs_kHz, internalSampleRate );
+    }
+    psDec = &channel_state[ 0 ];
+
+    /* Same parsing as silk_Decode(), up to the pulse counts of the first mid frame */
+    for( n = 0; n < nChannelsInternal; n++ ) {
+        for( i = 0; i < nFramesPerPacket; i++ ) {
+            channel_state[ n ].VAD_flags[ i ] = ec_dec_bit_logp(psRangeDec, 1);
+        }
+        channel_state[ n ].LBRR_flag = ec_dec_bit_logp(psRangeDec, 1);
+    }
+    for( n = 0; n < nChannelsInternal; n++ ) {
+        if( channel_state[ n ].LBRR_flag ) {
+            if( nFramesPerPacket == 1 ) {
+                channel_state[ n ].LBRR_flags[ 0 ] = 1;
+            } else {
+                LBRR_symbol = ec_dec_icdf( psRangeDec, silk_LBRR_flags_iCDF_ptr[ nFramesPerPacket - 2 ], 8 ) + 1;
+                for( i = 0; i < nFramesPerPacket; i++ ) {
+                    channel_state[ n ].LBRR_flags[ i ] = silk_RSHIFT( LBRR_symbol, i ) & 1;
+                }
+            }
+        }
+    }
+    for( i = 0; i < nFramesPerPacket; i++ ) {
+        for( n = 0; n < nChannelsInternal; n++ ) {
+            if( channel_state[ n ].LBRR_flags[ i ] ) {
+                if( nChannelsInternal == 2 && n == 0 ) {
+                    silk_stereo_decode_pred( psRangeDec, MS_pred_Q13 );
+                    if( channel_state[ 1 ].LBRR_flags[ i ] == 0 ) {
+                        silk_stereo_decode_mid_only( psRangeDec, &decode_only_middle );
+                    }
+                }
+                if( i > 0 && channel_state[ n ].LBRR_flags[ i - 1 ] ) {
+                    condCoding = CODE_CONDITIONALLY;
+                } else {
+                    condCoding = CODE_INDEPENDENTLY;
+                }
+                silk_decode_indices( &channel_state[ n ], psRangeDec, i, 1, condCoding );
+                silk_decode_pulses( psRangeDec, pulses, channel_state[ n ].indices.signalType,
+                    channel_state[ n ].indices.quantOffsetType, channel_state[ n ].frame_length );
+            }
+        }
+    }
+    if( nChannelsInternal == 2 ) {
+        silk_stereo_decode_pred( psRangeDec, MS_pred_Q13 );
+        if( channel_state[ 1 ].VAD_flags[ 0 ] == 0 ) {
+            silk_stereo_decode_mid_only( psRangeDec, &decode_only_middle );
+        }
+    }
+    silk_decode_indices( psDec, psRangeDec, 0, 0, CODE_INDEPENDENTLY );
+    nb_blocks = silk_decode_pulse_counts( psRangeDec, sum_pulses, nLshifts, psDec->indices.signalType,
+        psDec->frame_length );
+    silk_gains_dequant( Gains_Q16, psDec->indices.GainsIndices, &psProbe->LastGainIndex, 0, nb_subfr );
+    *VAD = 0;
+    for( i = 0; i < nFramesPerPacket; i++ ) {
+        *VAD |= psDec->VAD_flags[ i ];
+    }
+
+    /* Expected energy of the excitation of each subframe */
+    offset_Q10 = silk_Quantization_Offsets_Q10[ psDec->indices.signalType >> 1 ][ psDec->indices.quantOffsetType ];
+    silk_memset( exc_nrg_Q4, 0, sizeof( exc_nrg_Q4 ) );
+    silk_memset( exc_len, 0, sizeof( exc_len ) );
+    for( b = 0; b < nb_blocks; b++ ) {
+        k = silk_min_int( silk_DIV32_16( b * SHELL_CODEC_FRAME_LENGTH, psDec->subfr_length ), nb_subfr - 1 );
+        exc_nrg_Q4[ k ] = silk_ADD_POS_SAT32( exc_nrg_Q4[ k ], silk_probe_block_energy( sum_pulses[ b ], nLshifts[ b ],
+            psDec->indices.quantOffsetType, offset_Q10 ) );
+        exc_len[ k ] += SHELL_CODEC_FRAME_LENGTH;
+    }
+
+    /* Energy of the LTP synthesis output, with the powers in log2 of squared samples */
+    if( psDec->indices.signalType == TYPE_VOICED ) {
+        silk_decode_pitch( psDec->indices.lagIndex, psDec->indices.contourIndex, pitchL, fs_kHz, nb_subfr );
+        cbk_ptr_Q7 = silk_LTP_vq_ptrs_Q7[ psDec->indices.PERIndex ];
+        /* Downscaling of the history done by the decoder when re-whitening it */
+        psProbe->LTP_power_Q7 += silk_LSHIFT( silk_lin2log( silk_LTPScales_table_Q14[ psDec->indices.LTP_scaleIndex ] ) - ( 14 << 7 ), 1 );
+    }
+    nrg_Q7 = silk_int16_MIN;
+    for( k = 0; k < nb_subfr; k++ ) {
+        exc_Q7 = silk_lin2log( silk_max_32( exc_nrg_Q4[ k ], 1 ) ) - ( 4 << 7 ) - silk_lin2log( silk_max_int( exc_len[ k ], 1 ) )
+               + silk_LSHIFT( silk_lin2log( Gains_Q16[ k ] ) - ( 16 << 7 ), 1 );
+        if( psDec->indices.signalType == TYPE_VOICED ) {
+            /* The LTP adds the power of the previous pitch period, scaled by the */
+            /* square of the sum of the filter taps                               */
+            B_Q7 = 0;
+            for( i = 0; i < LTP_ORDER; i++ ) {
+                B_Q7 += cbk_ptr_Q7[ psDec->indices.LTPIndex[ k ] * LTP_ORDER + i ];
+            }
+            B2_Q7 = B_Q7 > 0 ? silk_LSHIFT( silk_lin2log( B_Q7 ) - ( 7 << 7 ), 1 ) : silk_int16_MIN;
+            lag = pitchL[ k ];
+            for( pos = 0; pos < psDec->subfr_length; pos += len ) {
+                len = silk_min_int( lag, psDec->subfr_length - pos );
+                pred_Q7 = silk_min_32( silk_probe_log_add( exc_Q7, B2_Q7 + psProbe->LTP_power_Q7 ), 30 << 7 );
+                nrg_Q7 = silk_probe_log_add( nrg_Q7, pred_Q7 + silk_lin2log( len ) );
+                if( len < lag ) {
+                    pred_Q7 = silk_probe_log_add( pred_Q7 + silk_lin2log( len ),
+                        psProbe->LTP_power_Q7 + silk_lin2log( lag - len ) ) - silk_lin2log( lag );
+                }
+                psProbe->LTP_power_Q7 = pred_Q7;
+            }
+        } else {
+            nrg_Q7 = silk_probe_log_add( nrg_Q7, exc_Q7 + silk_lin2log( psDec->subfr_length ) );
+            psProbe->LTP_power_Q7 = exc_Q7;
+        }
+    }
+
+    /* Gain of the LPC synthesis filter, from the energy of its impulse response */
+    silk_NLSF_decode( NLSF_Q15, psDec->indices.NLSFIndices, psDec->psNLSF_CB );
+    silk_NLSF2A( A_Q12, NLSF_Q15, psDec->LPC_order, arch );
+    h_Q14[ 0 ] = 1 << 14;
+    h_nrg_Q28 = (opus_int64)1 << 28;
+    for( n = 1; n < PROBE_IMPULSE_LENGTH; n++ ) {
+        pred_Q10 = 0;
+        for( i = 0; i < silk_min_int( n, psDec->LPC_order ); i++ ) {
+            pred_Q10 = silk_SMLAWB( pred_Q10, h_Q14[ n - i - 1 ], A_Q12[ i ] );
+        }
+        h_Q14[ n ] = silk_LSHIFT( silk_LIMIT_32( pred_Q10, -( 1 << 20 ), 1 << 20 ), 4 );
+        h_nrg_Q28 += silk_SMULL( h_Q14[ n ], h_Q14[ n ] );
+    }
+
+    *level_Q7 = nrg_Q7 + silk_probe_log2_64( h_nrg_Q28 ) - ( 28 << 7 ) - silk_lin2log( psDec->frame_length );
+    if( psDec->indices.signalType == TYPE_VOICED ) {
+        *level_Q7 += PROBE_VOICED_GAIN_Q7;
+    }
+
+    return SILK_NO_ERROR;
+}
+
 #if 0
 /* Getting table of contents for a packet */
 opus_int silk_get_TOC(
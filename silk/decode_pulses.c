@@ -31,20 +31,18 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #include "main.h"
 
-/*********************************************/
-/* Decode quantization indices of excitation */
-/*********************************************/
-void silk_decode_pulses(
+/**************************************************/
+/* Decode the number of pulses of each shell block */
+/**************************************************/
+opus_int silk_decode_pulse_counts(                              /* O    Number of shell blocks                      */
     ec_dec                      *psRangeDec,                    /* I/O  Compressor data structure                   */
-    opus_int16                  pulses[],                       /* O    Excitation signal                           */
+    opus_int                    sum_pulses[],                   /* O    Pulses per shell block, above the LSBs      */
+    opus_int                    nLshifts[],                     /* O    Number of LSBs per shell block              */
     const opus_int              signalType,                     /* I    Sigtype                                     */
-    const opus_int              quantOffsetType,                /* I    quantOffsetType                             */
     const opus_int              frame_length                    /* I    Frame length                                */
 )
 {
-    opus_int   i, j, k, iter, abs_q, nLS, RateLevelIndex;
-    opus_int   sum_pulses[ MAX_NB_SHELL_BLOCKS ], nLshifts[ MAX_NB_SHELL_BLOCKS ];
-    opus_int16 *pulses_ptr;
+    opus_int   i, iter, RateLevelIndex;
     const opus_uint8 *cdf_ptr;
 
     /*********************/
@@ -76,6 +74,25 @@ void silk_decode_pulses(
                     silk_pulses_per_block_iCDF[ N_RATE_LEVELS - 1] + ( nLshifts[ i ] == 10 ), 8 );
         }
     }
+    return iter;
+}
+
+/*********************************************/
+/* Decode quantization indices of excitation */
+/*********************************************/
+void silk_decode_pulses(
+    ec_dec                      *psRangeDec,                    /* I/O  Compressor data structure                   */
+    opus_int16                  pulses[],                       /* O    Excitation signal                           */
+    const opus_int              signalType,                     /* I    Sigtype                                     */
+    const opus_int              quantOffsetType,                /* I    quantOffsetType                             */
+    const opus_int              frame_length                    /* I    Frame length                                */
+)
+{
+    opus_int   i, j, k, iter, abs_q, nLS;
+    opus_int   sum_pulses[ MAX_NB_SHELL_BLOCKS ], nLshifts[ MAX_NB_SHELL_BLOCKS ];
+    opus_int16 *pulses_ptr;
+
+    iter = silk_decode_pulse_counts( psRangeDec, sum_pulses, nLshifts, signalType, frame_length );
 
     /***************************************************/
     /* Shell decoding                                  */
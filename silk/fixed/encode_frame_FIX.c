@@ -142,7 +142,9 @@ opus_int silk_encode_frame_FIX(
         /*****************************************/
         /* Find pitch lags, initial LPC analysis */
         /*****************************************/
+        PROFILE_START( psEnc->sCmn.profile, OPUS_PROFILE_SILK_PITCH );
         silk_find_pitch_lags_FIX( psEnc, &sEncCtrl, res_pitch, x_frame - psEnc->sCmn.ltp_mem_length, psEnc->sCmn.arch );
+        PROFILE_END( psEnc->sCmn.profile, OPUS_PROFILE_SILK_PITCH );
 
         /************************/
         /* Noise shape analysis */
@@ -197,6 +199,7 @@ opus_int silk_encode_frame_FIX(
                 /*****************************************/
                 /* Noise shaping quantization            */
                 /*****************************************/
+                PROFILE_START( psEnc->sCmn.profile, OPUS_PROFILE_SILK_NSQ );
                 if( psEnc->sCmn.nStatesDelayedDecision > 1 || psEnc->sCmn.warping_Q16 > 0 ) {
                     silk_NSQ_del_dec( &psEnc->sCmn, &psEnc->sCmn.sNSQ, &psEnc->sCmn.indices, x_frame, psEnc->sCmn.pulses,
                            sEncCtrl.PredCoef_Q12[ 0 ], sEncCtrl.LTPCoef_Q14, sEncCtrl.AR_Q13, sEncCtrl.HarmShapeGain_Q14,
@@ -208,6 +211,7 @@ opus_int silk_encode_frame_FIX(
                             sEncCtrl.Tilt_Q14, sEncCtrl.LF_shp_Q14, sEncCtrl.Gains_Q16, sEncCtrl.pitchL, sEncCtrl.Lambda_Q10, sEncCtrl.LTP_scale_Q14,
                             psEnc->sCmn.arch);
                 }
+                PROFILE_END( psEnc->sCmn.profile, OPUS_PROFILE_SILK_NSQ );
 
                 if ( iter == maxIter && !found_lower ) {
                     silk_memcpy( &sRangeEnc_copy2, psRangeEnc, sizeof( ec_enc ) );
@@ -430,6 +434,7 @@ static OPUS_INLINE void silk_LBRR_encode_FIX(
         /*****************************************/
         /* Noise shaping quantization            */
         /*****************************************/
+        PROFILE_START( psEnc->sCmn.profile, OPUS_PROFILE_SILK_NSQ );
         if( psEnc->sCmn.nStatesDelayedDecision > 1 || psEnc->sCmn.warping_Q16 > 0 ) {
             silk_NSQ_del_dec( &psEnc->sCmn, &sNSQ_LBRR, psIndices_LBRR, x16,
                 psEnc->sCmn.pulses_LBRR[ psEnc->sCmn.nFramesEncoded ], psEncCtrl->PredCoef_Q12[ 0 ], psEncCtrl->LTPCoef_Q14,
@@ -441,6 +446,7 @@ static OPUS_INLINE void silk_LBRR_encode_FIX(
                 psEncCtrl->AR_Q13, psEncCtrl->HarmShapeGain_Q14, psEncCtrl->Tilt_Q14, psEncCtrl->LF_shp_Q14,
                 psEncCtrl->Gains_Q16, psEncCtrl->pitchL, psEncCtrl->Lambda_Q10, psEncCtrl->LTP_scale_Q14, psEnc->sCmn.arch );
         }
+        PROFILE_END( psEnc->sCmn.profile, OPUS_PROFILE_SILK_NSQ );
 
         /* Restore original gains */
         silk_memcpy( psEncCtrl->Gains_Q16, TempGains_Q16, psEnc->sCmn.nb_subfr * sizeof( opus_int32 ) );
@@ -207,7 +207,7 @@ static OPUS_INLINE void silk_LPC_analysis_filter6_FLP(
 /* filter always starts with zero state         */
 /* first Order output samples are set to zero   */
 /************************************************/
-void silk_LPC_analysis_filter_FLP(
+void silk_LPC_analysis_filter_FLP_c(
     silk_float                      r_LPC[],                            /* O    LPC residual signal                         */
     const silk_float                PredCoef[],                         /* I    LPC coefficients                            */
     const silk_float                s[],                                /* I    Input signal                                */
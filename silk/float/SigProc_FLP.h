@@ -29,6 +29,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #define SILK_SIGPROC_FLP_H
 
 #include "SigProc_FIX.h"
+#include "pitch_est_defines.h"
 #include "float_cast.h"
 #include <math.h>
 
@@ -73,7 +74,8 @@ void silk_autocorrelation_FLP(
     silk_float          *results,           /* O    result (length correlationCount)                            */
     const silk_float    *inputData,         /* I    input data to correlate                                     */
     opus_int            inputDataSize,      /* I    length of input                                             */
-    opus_int            correlationCount    /* I    number of correlation taps to compute                       */
+    opus_int            correlationCount,   /* I    number of correlation taps to compute                       */
+    int                 arch                /* I    Run-time architecture                                       */
 );
 
 opus_int silk_pitch_analysis_core_FLP(      /* O    Voicing estimate: 0 voiced, 1 unvoiced                      */
@@ -105,7 +107,8 @@ silk_float silk_burg_modified_FLP(          /* O    returns residual energy
     const silk_float    minInvGain,         /* I    minimum inverse prediction gain                             */
     const opus_int      subfr_length,       /* I    input signal subframe length (incl. D preceding samples)    */
     const opus_int      nb_subfr,           /* I    number of subframes stacked in x                            */
-    const opus_int      D                   /* I    order                                                       */
+    const opus_int      D,                  /* I    order                                                       */
+    int                 arch                /* I    Run-time architecture                                       */
 );
 
 /* multiply a vector by a constant */
@@ -124,18 +127,48 @@ void silk_scale_copy_vector_FLP(
 );
 
 /* inner product of two silk_float arrays, with result as double */
-double silk_inner_product_FLP(
+double silk_inner_product_FLP_c(
     const silk_float    *data1,
     const silk_float    *data2,
     opus_int            dataSize
 );
 
 /* sum of squares of a silk_float array, with result as double */
-double silk_energy_FLP(
+double silk_energy_FLP_c(
     const silk_float    *data,
     opus_int            dataSize
 );
 
+/* normalized stage-3 pitch correlations of each lag contour, 0 where the correlation is not positive */
+void silk_P_Ana_norm_corr_st3_FLP_c(
+    silk_float          CC[][ PE_NB_STAGE3_LAGS ],          /* O    Correlation per contour and lag [nb_cbk_search]     */
+    const silk_float    cross_corr[][ PE_NB_STAGE3_CORRS ], /* I    Correlations from the lowest lag [nb_subfr]         */
+    const silk_float    energies[][ PE_NB_STAGE3_CORRS ],   /* I    Energies from the lowest lag [nb_subfr]             */
+    const opus_int8     *Lag_CB_ptr,        /* I    Lag contour codebook [nb_subfr][cbk_size]                   */
+    const opus_int8     *Lag_range_ptr,     /* I    Lowest and highest lag [nb_subfr][2]                        */
+    opus_int            cbk_size,           /* I    Size of the codebook                                        */
+    opus_int            nb_cbk_search,      /* I    Number of contours to search                                */
+    opus_int            nb_subfr,           /* I    Number of subframes                                         */
+    double              energy_tgt          /* I    Energy of the target signal plus one                        */
+);
+
+#if defined(OPUS_X86_MAY_HAVE_SSE2) || defined(OPUS_X86_MAY_HAVE_AVX2)
+#include "x86/SigProc_FLP_sse.h"
+#endif
+
+#if !defined(OVERRIDE_silk_inner_product_FLP)
+#define silk_inner_product_FLP(data1, data2, dataSize, arch) ((void)(arch),silk_inner_product_FLP_c(data1, data2, dataSize))
+#endif
+
+#if !defined(OVERRIDE_silk_energy_FLP)
+#define silk_energy_FLP(data, dataSize, arch) ((void)(arch),silk_energy_FLP_c(data, dataSize))
+#endif
+
+#if !defined(OVERRIDE_silk_P_Ana_norm_corr_st3_FLP)
+#define silk_P_Ana_norm_corr_st3_FLP(CC, cross_corr, energies, Lag_CB_ptr, Lag_range_ptr, cbk_size, nb_cbk_search, nb_subfr, energy_tgt, arch) \
+    ((void)(arch),silk_P_Ana_norm_corr_st3_FLP_c(CC, cross_corr, energies, Lag_CB_ptr, Lag_range_ptr, cbk_size, nb_cbk_search, nb_subfr, energy_tgt))
+#endif
+
 /********************************************************************/
 /*                                MACROS                            */
 /********************************************************************/
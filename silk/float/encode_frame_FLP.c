@@ -139,7 +139,9 @@ opus_int silk_encode_frame_FLP(
         /*****************************************/
         /* Find pitch lags, initial LPC analysis */
         /*****************************************/
+        PROFILE_START( psEnc->sCmn.profile, OPUS_PROFILE_SILK_PITCH );
         silk_find_pitch_lags_FLP( psEnc, &sEncCtrl, res_pitch, x_frame, psEnc->sCmn.arch );
+        PROFILE_END( psEnc->sCmn.profile, OPUS_PROFILE_SILK_PITCH );
 
         /************************/
         /* Noise shape analysis */
@@ -97,7 +97,7 @@ void silk_noise_shape_analysis_FLP(
 );
 
 /* Autocorrelations for a warped frequency axis */
-void silk_warped_autocorrelation_FLP(
+void silk_warped_autocorrelation_FLP_c(
     silk_float                      *corr,                              /* O    Result [order + 1]                          */
     const silk_float                *input,                             /* I    Input data to correlate                     */
     const silk_float                warping,                            /* I    Warping coefficient                         */
@@ -105,6 +105,11 @@ void silk_warped_autocorrelation_FLP(
     const opus_int                  order                               /* I    Correlation order (even)                    */
 );
 
+#if !defined(OVERRIDE_silk_warped_autocorrelation_FLP)
+#define silk_warped_autocorrelation_FLP(corr, input, warping, length, order, arch) \
+    ((void)(arch), silk_warped_autocorrelation_FLP_c(corr, input, warping, length, order))
+#endif
+
 /* Calculation of LTP state scaling */
 void silk_LTP_scale_ctrl_FLP(
     silk_encoder_state_FLP          *psEnc,                             /* I/O  Encoder state FLP                           */
@@ -148,7 +153,8 @@ void silk_find_LTP_FLP(
     const silk_float                r_ptr[],                            /* I    LPC residual                                */
     const opus_int                  lag[  MAX_NB_SUBFR ],               /* I    LTP lags                                    */
     const opus_int                  subfr_length,                       /* I    Subframe length                             */
-    const opus_int                  nb_subfr                            /* I    number of subframes                         */
+    const opus_int                  nb_subfr,                           /* I    number of subframes                         */
+    int                             arch                                /* I    Run-time architecture                       */
 );
 
 void silk_LTP_analysis_filter_FLP(
@@ -171,11 +177,12 @@ void silk_residual_energy_FLP(
     const silk_float                gains[],                            /* I    Quantization gains                          */
     const opus_int                  subfr_length,                       /* I    Subframe length                             */
     const opus_int                  nb_subfr,                           /* I    number of subframes                         */
-    const opus_int                  LPC_order                           /* I    LPC order                                   */
+    const opus_int                  LPC_order,                          /* I    LPC order                                   */
+    int                             arch                                /* I    Run-time architecture                       */
 );
 
 /* 16th order LPC analysis filter */
-void silk_LPC_analysis_filter_FLP(
+void silk_LPC_analysis_filter_FLP_c(
     silk_float                      r_LPC[],                            /* O    LPC residual signal                         */
     const silk_float                PredCoef[],                         /* I    LPC coefficients                            */
     const silk_float                s[],                                /* I    Input signal                                */
@@ -183,6 +190,11 @@ void silk_LPC_analysis_filter_FLP(
     const opus_int                  Order                               /* I    LPC order                                   */
 );
 
+#if !defined(OVERRIDE_silk_LPC_analysis_filter_FLP)
+#define silk_LPC_analysis_filter_FLP(r_LPC, PredCoef, s, length, Order, arch) \
+    ((void)(arch), silk_LPC_analysis_filter_FLP_c(r_LPC, PredCoef, s, length, Order))
+#endif
+
 /* LTP tap quantizer */
 void silk_quant_LTP_gains_FLP(
     silk_float                      B[ MAX_NB_SUBFR * LTP_ORDER ],      /* O    Quantized LTP gains                         */
@@ -221,7 +233,8 @@ void silk_corrMatrix_FLP(
     const silk_float                *x,                                 /* I    x vector [ L+order-1 ] used to create X     */
     const opus_int                  L,                                  /* I    Length of vectors                           */
     const opus_int                  Order,                              /* I    Max lag for correlation                     */
-    silk_float                      *XX                                 /* O    X'*X correlation matrix [order x order]     */
+    silk_float                      *XX,                                /* O    X'*X correlation matrix [order x order]     */
+    int                             arch                                /* I    Run-time architecture                       */
 );
 
 /* Calculates correlation vector X'*t */
@@ -230,7 +243,8 @@ void silk_corrVector_FLP(
     const silk_float                *t,                                 /* I    Target vector [L]                           */
     const opus_int                  L,                                  /* I    Length of vecors                            */
     const opus_int                  Order,                              /* I    Max lag for correlation                     */
-    silk_float                      *Xt                                 /* O    X'*t correlation vector [order]             */
+    silk_float                      *Xt,                                /* O    X'*t correlation vector [order]             */
+    int                             arch                                /* I    Run-time architecture                       */
 );
 
 /* Apply sine window to signal vector.  */
@@ -37,28 +37,27 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "pitch_est_defines.h"
 #include "pitch.h"
 
-#define SCRATCH_SIZE        22
-
 /************************************************************/
 /* Internally used functions                                */
 /************************************************************/
 static void silk_P_Ana_calc_corr_st3(
-    silk_float cross_corr_st3[ PE_MAX_NB_SUBFR ][ PE_NB_CBKS_STAGE3_MAX ][ PE_NB_STAGE3_LAGS ], /* O 3 DIM correlation array */
+    silk_float cross_corr_st3[ PE_MAX_NB_SUBFR ][ PE_NB_STAGE3_CORRS ], /* O 2 DIM correlation array */
     const silk_float    frame[],            /* I vector to correlate                                            */
     opus_int            start_lag,          /* I start lag                                                      */
     opus_int            sf_length,          /* I sub frame length                                               */
     opus_int            nb_subfr,           /* I number of subframes                                            */
-    opus_int            complexity,         /* I Complexity setting                                             */
+    const opus_int8     *Lag_range_ptr,     /* I lowest and highest lag per subframe                            */
     int                 arch                /* I Run-time architecture                                          */
 );
 
 static void silk_P_Ana_calc_energy_st3(
-    silk_float energies_st3[ PE_MAX_NB_SUBFR ][ PE_NB_CBKS_STAGE3_MAX ][ PE_NB_STAGE3_LAGS ], /* O 3 DIM correlation array */
+    silk_float energies_st3[ PE_MAX_NB_SUBFR ][ PE_NB_STAGE3_CORRS ], /* O 2 DIM energy array */
     const silk_float    frame[],            /* I vector to correlate                                            */
     opus_int            start_lag,          /* I start lag                                                      */
     opus_int            sf_length,          /* I sub frame length                                               */
     opus_int            nb_subfr,           /* I number of subframes                                            */
-    opus_int            complexity          /* I Complexity setting                                             */
+    const opus_int8     *Lag_range_ptr,     /* I lowest and highest lag per subframe                            */
+    int                 arch                /* I Run-time architecture                                          */
 );
 
 /************************************************************/
@@ -98,15 +97,16 @@ opus_int silk_pitch_analysis_core_FLP(      /* O    Voicing estimate: 0 voiced,
     opus_int   CBimax, CBimax_new, lag, start_lag, end_lag, lag_new;
     opus_int   cbk_size;
     silk_float lag_log2, prevLag_log2, delta_lag_log2_sqr;
-    silk_float energies_st3[ PE_MAX_NB_SUBFR ][ PE_NB_CBKS_STAGE3_MAX ][ PE_NB_STAGE3_LAGS ];
-    silk_float cross_corr_st3[ PE_MAX_NB_SUBFR ][ PE_NB_CBKS_STAGE3_MAX ][ PE_NB_STAGE3_LAGS ];
+    silk_float energies_st3[ PE_MAX_NB_SUBFR ][ PE_NB_STAGE3_CORRS ];
+    silk_float cross_corr_st3[ PE_MAX_NB_SUBFR ][ PE_NB_STAGE3_CORRS ];
+    silk_float CC_st3[ PE_NB_CBKS_STAGE3_MAX ][ PE_NB_STAGE3_LAGS ];
     opus_int   lag_counter;
     opus_int   frame_length, frame_length_8kHz, frame_length_4kHz;
     opus_int   sf_length, sf_length_8kHz, sf_length_4kHz;
     opus_int   min_lag, min_lag_8kHz, min_lag_4kHz;
     opus_int   max_lag, max_lag_8kHz, max_lag_4kHz;
     opus_int   nb_cbk_search;
-    const opus_int8 *Lag_CB_ptr;
+    const opus_int8 *Lag_CB_ptr, *Lag_range_ptr;
 
     /* Check for valid sampling frequency */
     celt_assert( Fs_kHz == 8 || Fs_kHz == 12 || Fs_kHz == 16 );
@@ -182,8 +182,8 @@ opus_int silk_pitch_analysis_core_FLP(      /* O    Voicing estimate: 0 voiced,
 
         /* Calculate first vector products before loop */
         cross_corr = xcorr[ max_lag_4kHz - min_lag_4kHz ];
-        normalizer = silk_energy_FLP( target_ptr, sf_length_8kHz ) +
-                     silk_energy_FLP( basis_ptr,  sf_length_8kHz ) +
+        normalizer = silk_energy_FLP( target_ptr, sf_length_8kHz, arch ) +
+                     silk_energy_FLP( basis_ptr,  sf_length_8kHz, arch ) +
                      sf_length_8kHz * 4000.0f;
 
         C[ 0 ][ min_lag_4kHz ] += (silk_float)( 2 * cross_corr / normalizer );
@@ -287,13 +287,13 @@ opus_int silk_pitch_analysis_core_FLP(      /* O    Voicing estimate: 0 voiced,
         target_ptr = &frame_8kHz[ PE_LTP_MEM_LENGTH_MS * 8 ];
     }
     for( k = 0; k < nb_subfr; k++ ) {
-        energy_tmp = silk_energy_FLP( target_ptr, sf_length_8kHz ) + 1.0;
+        energy_tmp = silk_energy_FLP( target_ptr, sf_length_8kHz, arch ) + 1.0;
         for( j = 0; j < length_d_comp; j++ ) {
             d = d_comp[ j ];
             basis_ptr = target_ptr - d;
-            cross_corr = silk_inner_product_FLP( basis_ptr, target_ptr, sf_length_8kHz );
+            cross_corr = silk_inner_product_FLP( basis_ptr, target_ptr, sf_length_8kHz, arch );
             if( cross_corr > 0.0f ) {
-                energy = silk_energy_FLP( basis_ptr, sf_length_8kHz );
+                energy = silk_energy_FLP( basis_ptr, sf_length_8kHz, arch );
                 C[ k ][ d ] = (silk_float)( 2 * cross_corr / ( energy + energy_tmp ) );
             } else {
                 C[ k ][ d ] = 0.0f;
@@ -410,42 +410,37 @@ opus_int silk_pitch_analysis_core_FLP(      /* O    Voicing estimate: 0 voiced,
 
         CCmax = -1000.0f;
 
-        /* Calculate the correlations and energies needed in stage 3 */
-        silk_P_Ana_calc_corr_st3( cross_corr_st3, frame, start_lag, sf_length, nb_subfr, complexity, arch );
-        silk_P_Ana_calc_energy_st3( energies_st3, frame, start_lag, sf_length, nb_subfr, complexity );
-
-        lag_counter = 0;
-        silk_assert( lag == silk_SAT16( lag ) );
-        contour_bias = PE_FLATCONTOUR_BIAS / lag;
-
         /* Set up cbk parameters according to complexity setting and frame length */
         if( nb_subfr == PE_MAX_NB_SUBFR ) {
             nb_cbk_search = (opus_int)silk_nb_cbk_searchs_stage3[ complexity ];
             cbk_size      = PE_NB_CBKS_STAGE3_MAX;
             Lag_CB_ptr    = &silk_CB_lags_stage3[ 0 ][ 0 ];
+            Lag_range_ptr = &silk_Lag_range_stage3[ complexity ][ 0 ][ 0 ];
         } else {
+            celt_assert( nb_subfr == PE_MAX_NB_SUBFR >> 1 );
             nb_cbk_search = PE_NB_CBKS_STAGE3_10MS;
             cbk_size      = PE_NB_CBKS_STAGE3_10MS;
             Lag_CB_ptr    = &silk_CB_lags_stage3_10_ms[ 0 ][ 0 ];
+            Lag_range_ptr = &silk_Lag_range_stage3_10_ms[ 0 ][ 0 ];
         }
 
+        /* Calculate the correlations and energies needed in stage 3 */
+        silk_P_Ana_calc_corr_st3( cross_corr_st3, frame, start_lag, sf_length, nb_subfr, Lag_range_ptr, arch );
+        silk_P_Ana_calc_energy_st3( energies_st3, frame, start_lag, sf_length, nb_subfr, Lag_range_ptr, arch );
+
         target_ptr = &frame[ PE_LTP_MEM_LENGTH_MS * Fs_kHz ];
-        energy_tmp = silk_energy_FLP( target_ptr, nb_subfr * sf_length ) + 1.0;
+        energy_tmp = silk_energy_FLP( target_ptr, nb_subfr * sf_length, arch ) + 1.0;
+        silk_P_Ana_norm_corr_st3_FLP( CC_st3, cross_corr_st3, energies_st3, Lag_CB_ptr, Lag_range_ptr,
+            cbk_size, nb_cbk_search, nb_subfr, energy_tmp, arch );
+
+        lag_counter = 0;
+        silk_assert( lag == silk_SAT16( lag ) );
+        contour_bias = PE_FLATCONTOUR_BIAS / lag;
+
         for( d = start_lag; d <= end_lag; d++ ) {
             for( j = 0; j < nb_cbk_search; j++ ) {
-                cross_corr = 0.0;
-                energy = energy_tmp;
-                for( k = 0; k < nb_subfr; k++ ) {
-                    cross_corr += cross_corr_st3[ k ][ j ][ lag_counter ];
-                    energy     +=   energies_st3[ k ][ j ][ lag_counter ];
-                }
-                if( cross_corr > 0.0 ) {
-                    CCmax_new = (silk_float)( 2 * cross_corr / energy );
-                    /* Reduce depending on flatness of contour */
-                    CCmax_new *= 1.0f - contour_bias * j;
-                } else {
-                    CCmax_new = 0.0f;
-                }
+                /* Reduce depending on flatness of contour */
+                CCmax_new = CC_st3[ j ][ lag_counter ] * ( 1.0f - contour_bias * j );
 
                 if( CCmax_new > CCmax && ( d + (opus_int)silk_CB_lags_stage3[ 0 ][ j ] ) <= max_lag ) {
                     CCmax   = CCmax_new;
@@ -490,37 +485,18 @@ opus_int silk_pitch_analysis_core_FLP(      /* O    Voicing estimate: 0 voiced,
  * case 4*12*5 = 240 correlations, but more likely around 120.
  ***********************************************************************/
 static void silk_P_Ana_calc_corr_st3(
-    silk_float cross_corr_st3[ PE_MAX_NB_SUBFR ][ PE_NB_CBKS_STAGE3_MAX ][ PE_NB_STAGE3_LAGS ], /* O 3 DIM correlation array */
+    silk_float cross_corr_st3[ PE_MAX_NB_SUBFR ][ PE_NB_STAGE3_CORRS ], /* O 2 DIM correlation array */
     const silk_float    frame[],            /* I vector to correlate                                            */
     opus_int            start_lag,          /* I start lag                                                      */
     opus_int            sf_length,          /* I sub frame length                                               */
     opus_int            nb_subfr,           /* I number of subframes                                            */
-    opus_int            complexity,         /* I Complexity setting                                             */
+    const opus_int8     *Lag_range_ptr,     /* I lowest and highest lag per subframe                            */
     int                 arch                /* I Run-time architecture                                          */
 )
 {
     const silk_float *target_ptr;
-    opus_int   i, j, k, lag_counter, lag_low, lag_high;
-    opus_int   nb_cbk_search, delta, idx, cbk_size;
-    silk_float scratch_mem[ SCRATCH_SIZE ];
-    opus_val32 xcorr[ SCRATCH_SIZE ];
-    const opus_int8 *Lag_range_ptr, *Lag_CB_ptr;
-
-    celt_assert( complexity >= SILK_PE_MIN_COMPLEX );
-    celt_assert( complexity <= SILK_PE_MAX_COMPLEX );
-
-    if( nb_subfr == PE_MAX_NB_SUBFR ) {
-        Lag_range_ptr = &silk_Lag_range_stage3[ complexity ][ 0 ][ 0 ];
-        Lag_CB_ptr    = &silk_CB_lags_stage3[ 0 ][ 0 ];
-        nb_cbk_search = silk_nb_cbk_searchs_stage3[ complexity ];
-        cbk_size      = PE_NB_CBKS_STAGE3_MAX;
-    } else {
-        celt_assert( nb_subfr == PE_MAX_NB_SUBFR >> 1);
-        Lag_range_ptr = &silk_Lag_range_stage3_10_ms[ 0 ][ 0 ];
-        Lag_CB_ptr    = &silk_CB_lags_stage3_10_ms[ 0 ][ 0 ];
-        nb_cbk_search = PE_NB_CBKS_STAGE3_10MS;
-        cbk_size      = PE_NB_CBKS_STAGE3_10MS;
-    }
+    opus_int   j, k, lag_counter, lag_low, lag_high;
+    opus_val32 xcorr[ PE_NB_STAGE3_CORRS ];
 
     target_ptr = &frame[ silk_LSHIFT( sf_length, 2 ) ]; /* Pointer to middle of frame */
     for( k = 0; k < nb_subfr; k++ ) {
@@ -529,25 +505,13 @@ static void silk_P_Ana_calc_corr_st3(
         /* Calculate the correlations for each subframe */
         lag_low  = matrix_ptr( Lag_range_ptr, k, 0, 2 );
         lag_high = matrix_ptr( Lag_range_ptr, k, 1, 2 );
-        silk_assert(lag_high-lag_low+1 <= SCRATCH_SIZE);
+        silk_assert(lag_high-lag_low+1 <= PE_NB_STAGE3_CORRS);
         celt_pitch_xcorr( target_ptr, target_ptr - start_lag - lag_high, xcorr, sf_length, lag_high - lag_low + 1, arch );
         for( j = lag_low; j <= lag_high; j++ ) {
-            silk_assert( lag_counter < SCRATCH_SIZE );
-            scratch_mem[ lag_counter ] = xcorr[ lag_high - j ];
+            silk_assert( lag_counter < PE_NB_STAGE3_CORRS );
+            cross_corr_st3[ k ][ lag_counter ] = xcorr[ lag_high - j ];
             lag_counter++;
         }
-
-        delta = matrix_ptr( Lag_range_ptr, k, 0, 2 );
-        for( i = 0; i < nb_cbk_search; i++ ) {
-            /* Fill out the 3 dim array that stores the correlations for */
-            /* each code_book vector for each start lag */
-            idx = matrix_ptr( Lag_CB_ptr, k, i, cbk_size ) - delta;
-            for( j = 0; j < PE_NB_STAGE3_LAGS; j++ ) {
-                silk_assert( idx + j < SCRATCH_SIZE );
-                silk_assert( idx + j < lag_counter );
-                cross_corr_st3[ k ][ i ][ j ] = scratch_mem[ idx + j ];
-            }
-        }
         target_ptr += sf_length;
     }
 }
@@ -557,36 +521,18 @@ static void silk_P_Ana_calc_corr_st3(
 /* calculated recursively.                                          */
 /********************************************************************/
 static void silk_P_Ana_calc_energy_st3(
-    silk_float energies_st3[ PE_MAX_NB_SUBFR ][ PE_NB_CBKS_STAGE3_MAX ][ PE_NB_STAGE3_LAGS ], /* O 3 DIM correlation array */
+    silk_float energies_st3[ PE_MAX_NB_SUBFR ][ PE_NB_STAGE3_CORRS ], /* O 2 DIM energy array */
     const silk_float    frame[],            /* I vector to correlate                                            */
     opus_int            start_lag,          /* I start lag                                                      */
     opus_int            sf_length,          /* I sub frame length                                               */
     opus_int            nb_subfr,           /* I number of subframes                                            */
-    opus_int            complexity          /* I Complexity setting                                             */
+    const opus_int8     *Lag_range_ptr,     /* I lowest and highest lag per subframe                            */
+    int                 arch                /* I Run-time architecture                                          */
 )
 {
     const silk_float *target_ptr, *basis_ptr;
     double    energy;
-    opus_int   k, i, j, lag_counter;
-    opus_int   nb_cbk_search, delta, idx, cbk_size, lag_diff;
-    silk_float scratch_mem[ SCRATCH_SIZE ];
-    const opus_int8 *Lag_range_ptr, *Lag_CB_ptr;
-
-    celt_assert( complexity >= SILK_PE_MIN_COMPLEX );
-    celt_assert( complexity <= SILK_PE_MAX_COMPLEX );
-
-    if( nb_subfr == PE_MAX_NB_SUBFR ) {
-        Lag_range_ptr = &silk_Lag_range_stage3[ complexity ][ 0 ][ 0 ];
-        Lag_CB_ptr    = &silk_CB_lags_stage3[ 0 ][ 0 ];
-        nb_cbk_search = silk_nb_cbk_searchs_stage3[ complexity ];
-        cbk_size      = PE_NB_CBKS_STAGE3_MAX;
-    } else {
-        celt_assert( nb_subfr == PE_MAX_NB_SUBFR >> 1);
-        Lag_range_ptr = &silk_Lag_range_stage3_10_ms[ 0 ][ 0 ];
-        Lag_CB_ptr    = &silk_CB_lags_stage3_10_ms[ 0 ][ 0 ];
-        nb_cbk_search = PE_NB_CBKS_STAGE3_10MS;
-        cbk_size      = PE_NB_CBKS_STAGE3_10MS;
-    }
+    opus_int   k, i, lag_counter, lag_diff;
 
     target_ptr = &frame[ silk_LSHIFT( sf_length, 2 ) ];
     for( k = 0; k < nb_subfr; k++ ) {
@@ -594,9 +540,9 @@ static void silk_P_Ana_calc_energy_st3(
 
         /* Calculate the energy for first lag */
         basis_ptr = target_ptr - ( start_lag + matrix_ptr( Lag_range_ptr, k, 0, 2 ) );
-        energy = silk_energy_FLP( basis_ptr, sf_length ) + 1e-3;
+        energy = silk_energy_FLP( basis_ptr, sf_length, arch ) + 1e-3;
         silk_assert( energy >= 0.0 );
-        scratch_mem[lag_counter] = (silk_float)energy;
+        energies_st3[ k ][ lag_counter ] = (silk_float)energy;
         lag_counter++;
 
         lag_diff = ( matrix_ptr( Lag_range_ptr, k, 1, 2 ) -  matrix_ptr( Lag_range_ptr, k, 0, 2 ) + 1 );
@@ -608,23 +554,54 @@ static void silk_P_Ana_calc_energy_st3(
             /* add part that comes into window */
             energy += basis_ptr[ -i ] * (double)basis_ptr[ -i ];
             silk_assert( energy >= 0.0 );
-            silk_assert( lag_counter < SCRATCH_SIZE );
-            scratch_mem[lag_counter] = (silk_float)energy;
+            silk_assert( lag_counter < PE_NB_STAGE3_CORRS );
+            energies_st3[ k ][ lag_counter ] = (silk_float)energy;
             lag_counter++;
         }
+        target_ptr += sf_length;
+    }
+}
 
-        delta = matrix_ptr( Lag_range_ptr, k, 0, 2 );
-        for( i = 0; i < nb_cbk_search; i++ ) {
-            /* Fill out the 3 dim array that stores the correlations for    */
-            /* each code_book vector for each start lag                     */
-            idx = matrix_ptr( Lag_CB_ptr, k, i, cbk_size ) - delta;
+/***********************************************************************
+ * Sums the correlations and energies of each lag contour over the
+ * subframes and normalizes. The values of a contour at the searched
+ * offset lags are adjacent in the per-subframe arrays, which lets the
+ * SIMD versions compute them together.
+ ***********************************************************************/
+void silk_P_Ana_norm_corr_st3_FLP_c(
+    silk_float          CC[][ PE_NB_STAGE3_LAGS ],          /* O    Correlation per contour and lag [nb_cbk_search]     */
+    const silk_float    cross_corr[][ PE_NB_STAGE3_CORRS ], /* I    Correlations from the lowest lag [nb_subfr]         */
+    const silk_float    energies[][ PE_NB_STAGE3_CORRS ],   /* I    Energies from the lowest lag [nb_subfr]             */
+    const opus_int8     *Lag_CB_ptr,        /* I    Lag contour codebook [nb_subfr][cbk_size]                   */
+    const opus_int8     *Lag_range_ptr,     /* I    Lowest and highest lag [nb_subfr][2]                        */
+    opus_int            cbk_size,           /* I    Size of the codebook                                        */
+    opus_int            nb_cbk_search,      /* I    Number of contours to search                                */
+    opus_int            nb_subfr,           /* I    Number of subframes                                         */
+    double              energy_tgt          /* I    Energy of the target signal plus one                        */
+)
+{
+    opus_int   i, j, k, idx;
+    double     cross_corr_sum[ PE_NB_STAGE3_LAGS ], energy_sum[ PE_NB_STAGE3_LAGS ];
+
+    for( i = 0; i < nb_cbk_search; i++ ) {
+        for( j = 0; j < PE_NB_STAGE3_LAGS; j++ ) {
+            cross_corr_sum[ j ] = 0.0;
+            energy_sum[ j ] = energy_tgt;
+        }
+        for( k = 0; k < nb_subfr; k++ ) {
+            idx = matrix_ptr( Lag_CB_ptr, k, i, cbk_size ) - matrix_ptr( Lag_range_ptr, k, 0, 2 );
+            silk_assert( idx + PE_NB_STAGE3_LAGS <= PE_NB_STAGE3_CORRS );
             for( j = 0; j < PE_NB_STAGE3_LAGS; j++ ) {
-                silk_assert( idx + j < SCRATCH_SIZE );
-                silk_assert( idx + j < lag_counter );
-                energies_st3[ k ][ i ][ j ] = scratch_mem[ idx + j ];
-                silk_assert( energies_st3[ k ][ i ][ j ] >= 0.0f );
+                cross_corr_sum[ j ] += cross_corr[ k ][ idx + j ];
+                energy_sum[ j ]     +=   energies[ k ][ idx + j ];
+            }
+        }
+        for( j = 0; j < PE_NB_STAGE3_LAGS; j++ ) {
+            if( cross_corr_sum[ j ] > 0.0 ) {
+                CC[ i ][ j ] = (silk_float)( 2 * cross_corr_sum[ j ] / energy_sum[ j ] );
+            } else {
+                CC[ i ][ j ] = 0.0f;
             }
         }
-        target_ptr += sf_length;
     }
 }
@@ -160,6 +160,7 @@ void silk_NSQ_wrapper_FLP(
     }
 
     /* Call NSQ */
+    PROFILE_START( psEnc->sCmn.profile, OPUS_PROFILE_SILK_NSQ );
     if( psEnc->sCmn.nStatesDelayedDecision > 1 || psEnc->sCmn.warping_Q16 > 0 ) {
         silk_NSQ_del_dec( &psEnc->sCmn, psNSQ, psIndices, x16, pulses, PredCoef_Q12[ 0 ], LTPCoef_Q14,
             AR_Q13, HarmShapeGain_Q14, Tilt_Q14, LF_shp_Q14, Gains_Q16, psEncCtrl->pitchL, Lambda_Q10, LTP_scale_Q14, psEnc->sCmn.arch );
@@ -167,6 +168,7 @@ void silk_NSQ_wrapper_FLP(
         silk_NSQ( &psEnc->sCmn, psNSQ, psIndices, x16, pulses, PredCoef_Q12[ 0 ], LTPCoef_Q14,
             AR_Q13, HarmShapeGain_Q14, Tilt_Q14, LF_shp_Q14, Gains_Q16, psEncCtrl->pitchL, Lambda_Q10, LTP_scale_Q14, psEnc->sCmn.arch );
     }
+    PROFILE_END( psEnc->sCmn.profile, OPUS_PROFILE_SILK_NSQ );
 }
 
 /***********************************************/
@@ -187,8 +189,9 @@ void silk_quant_LTP_gains_FLP(
 {
     opus_int   i, pred_gain_dB_Q7;
     opus_int16 B_Q14[ MAX_NB_SUBFR * LTP_ORDER ];
-    opus_int32 XX_Q17[ MAX_NB_SUBFR * LTP_ORDER * LTP_ORDER ];
-    opus_int32 xX_Q17[ MAX_NB_SUBFR * LTP_ORDER ];
+    /* Zeroed so that the compiler does not flag the entries past nb_subfr */
+    opus_int32 XX_Q17[ MAX_NB_SUBFR * LTP_ORDER * LTP_ORDER ] = { 0 };
+    opus_int32 xX_Q17[ MAX_NB_SUBFR * LTP_ORDER ] = { 0 };
 
     for( i = 0; i < nb_subfr * LTP_ORDER * LTP_ORDER; i++ ) {
         XX_Q17[ i ] = (opus_int32)silk_float2int( XX[ i ] * 131072.0f );
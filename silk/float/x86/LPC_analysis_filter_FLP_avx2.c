@@ -0,0 +1,117 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+
+#include "main_FLP.h"
+
+/* LPC analysis filter of order Order over eight outputs at a time. The products */
+/* are accumulated in the same order as in silk_LPC_analysis_filter_FLP_c(),     */
+/* but with fused multiply-adds.                                                 */
+static OPUS_INLINE void silk_LPC_analysis_filter_order_FLP_avx2(
+          silk_float                 r_LPC[],            /* O    LPC residual signal                     */
+    const silk_float                 PredCoef[],         /* I    LPC coefficients                        */
+    const silk_float                 s[],                /* I    Input signal                            */
+    const opus_int                   length,             /* I    Length of input signal                  */
+    const opus_int                   Order               /* I    LPC order                               */
+)
+{
+    opus_int   ix, k;
+    silk_float LPC_pred;
+    const silk_float *s_ptr;
+    __m256     coef[ MAX_LPC_ORDER ];
+    __m256     pred;
+
+    for( k = 0; k < Order; k++ ) {
+        coef[ k ] = _mm256_set1_ps( PredCoef[ k ] );
+    }
+
+    for( ix = Order; ix < length - 7; ix += 8 ) {
+        s_ptr = &s[ ix - 1 ];
+        /* short-term prediction */
+        pred = _mm256_mul_ps( _mm256_loadu_ps( s_ptr ), coef[ 0 ] );
+        for( k = 1; k < Order; k++ ) {
+            pred = _mm256_fmadd_ps( _mm256_loadu_ps( s_ptr - k ), coef[ k ], pred );
+        }
+        /* prediction error */
+        _mm256_storeu_ps( &r_LPC[ ix ], _mm256_sub_ps( _mm256_loadu_ps( s_ptr + 1 ), pred ) );
+    }
+
+    for( ; ix < length; ix++ ) {
+        s_ptr = &s[ ix - 1 ];
+        LPC_pred = s_ptr[ 0 ] * PredCoef[ 0 ];
+        for( k = 1; k < Order; k++ ) {
+            LPC_pred += s_ptr[ -k ] * PredCoef[ k ];
+        }
+        r_LPC[ ix ] = s_ptr[ 1 ] - LPC_pred;
+    }
+}
+
+void silk_LPC_analysis_filter_FLP_avx2(
+    silk_float                      r_LPC[],                            /* O    LPC residual signal                         */
+    const silk_float                PredCoef[],                         /* I    LPC coefficients                            */
+    const silk_float                s[],                                /* I    Input signal                                */
+    const opus_int                  length,                             /* I    Length of input signal                      */
+    const opus_int                  Order                               /* I    LPC order                                   */
+)
+{
+    celt_assert( Order <= length );
+
+    /* Constant orders let the coefficient loop unroll */
+    switch( Order ) {
+        case 6:
+            silk_LPC_analysis_filter_order_FLP_avx2( r_LPC, PredCoef, s, length, 6 );
+        break;
+
+        case 8:
+            silk_LPC_analysis_filter_order_FLP_avx2( r_LPC, PredCoef, s, length, 8 );
+        break;
+
+        case 10:
+            silk_LPC_analysis_filter_order_FLP_avx2( r_LPC, PredCoef, s, length, 10 );
+        break;
+
+        case 12:
+            silk_LPC_analysis_filter_order_FLP_avx2( r_LPC, PredCoef, s, length, 12 );
+        break;
+
+        case 16:
+            silk_LPC_analysis_filter_order_FLP_avx2( r_LPC, PredCoef, s, length, 16 );
+        break;
+
+        default:
+            celt_assert( 0 );
+        break;
+    }
+
+    /* Set first Order output samples to zero */
+    silk_memset( r_LPC, 0, Order * sizeof( silk_float ) );
+}
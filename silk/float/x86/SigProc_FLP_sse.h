@@ -0,0 +1,176 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef SIGPROC_FLP_SSE_H
+#define SIGPROC_FLP_SSE_H
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#if !defined(FIXED_POINT)
+#define OVERRIDE_silk_inner_product_FLP
+#define OVERRIDE_silk_energy_FLP
+#define OVERRIDE_silk_LPC_analysis_filter_FLP
+#define OVERRIDE_silk_P_Ana_norm_corr_st3_FLP
+
+#if defined(OPUS_X86_MAY_HAVE_SSE2)
+double silk_inner_product_FLP_sse2(
+    const silk_float    *data1,
+    const silk_float    *data2,
+    opus_int            dataSize
+);
+
+double silk_energy_FLP_sse2(
+    const silk_float    *data,
+    opus_int            dataSize
+);
+
+void silk_LPC_analysis_filter_FLP_sse2(
+    silk_float          r_LPC[],            /* O    LPC residual signal                                         */
+    const silk_float    PredCoef[],         /* I    LPC coefficients                                            */
+    const silk_float    s[],                /* I    Input signal                                                */
+    const opus_int      length,             /* I    Length of input signal                                      */
+    const opus_int      Order               /* I    LPC order                                                   */
+);
+
+void silk_P_Ana_norm_corr_st3_FLP_sse2(
+    silk_float          CC[][ PE_NB_STAGE3_LAGS ],          /* O    Correlation per contour and lag [nb_cbk_search]     */
+    const silk_float    cross_corr[][ PE_NB_STAGE3_CORRS ], /* I    Correlations from the lowest lag [nb_subfr]         */
+    const silk_float    energies[][ PE_NB_STAGE3_CORRS ],   /* I    Energies from the lowest lag [nb_subfr]             */
+    const opus_int8     *Lag_CB_ptr,        /* I    Lag contour codebook [nb_subfr][cbk_size]                   */
+    const opus_int8     *Lag_range_ptr,     /* I    Lowest and highest lag [nb_subfr][2]                        */
+    opus_int            cbk_size,           /* I    Size of the codebook                                        */
+    opus_int            nb_cbk_search,      /* I    Number of contours to search                                */
+    opus_int            nb_subfr,           /* I    Number of subframes                                         */
+    double              energy_tgt          /* I    Energy of the target signal plus one                        */
+);
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_AVX2)
+#define OVERRIDE_silk_warped_autocorrelation_FLP
+
+double silk_inner_product_FLP_avx2(
+    const silk_float    *data1,
+    const silk_float    *data2,
+    opus_int            dataSize
+);
+
+double silk_energy_FLP_avx2(
+    const silk_float    *data,
+    opus_int            dataSize
+);
+
+void silk_LPC_analysis_filter_FLP_avx2(
+    silk_float          r_LPC[],            /* O    LPC residual signal                                         */
+    const silk_float    PredCoef[],         /* I    LPC coefficients                                            */
+    const silk_float    s[],                /* I    Input signal                                                */
+    const opus_int      length,             /* I    Length of input signal                                      */
+    const opus_int      Order               /* I    LPC order                                                   */
+);
+
+void silk_warped_autocorrelation_FLP_avx2(
+    silk_float          *corr,              /* O    Result [order + 1]                                          */
+    const silk_float    *input,             /* I    Input data to correlate                                     */
+    const silk_float    warping,            /* I    Warping coefficient                                         */
+    const opus_int      length,             /* I    Length of input                                             */
+    const opus_int      order               /* I    Correlation order (even)                                    */
+);
+
+void silk_P_Ana_norm_corr_st3_FLP_avx2(
+    silk_float          CC[][ PE_NB_STAGE3_LAGS ],          /* O    Correlation per contour and lag [nb_cbk_search]     */
+    const silk_float    cross_corr[][ PE_NB_STAGE3_CORRS ], /* I    Correlations from the lowest lag [nb_subfr]         */
+    const silk_float    energies[][ PE_NB_STAGE3_CORRS ],   /* I    Energies from the lowest lag [nb_subfr]             */
+    const opus_int8     *Lag_CB_ptr,        /* I    Lag contour codebook [nb_subfr][cbk_size]                   */
+    const opus_int8     *Lag_range_ptr,     /* I    Lowest and highest lag [nb_subfr][2]                        */
+    opus_int            cbk_size,           /* I    Size of the codebook                                        */
+    opus_int            nb_cbk_search,      /* I    Number of contours to search                                */
+    opus_int            nb_subfr,           /* I    Number of subframes                                         */
+    double              energy_tgt          /* I    Energy of the target signal plus one                        */
+);
+#endif
+
+#if defined(OPUS_X86_PRESUME_AVX2)
+
+#define silk_inner_product_FLP(data1, data2, dataSize, arch) \
+    ((void)(arch), silk_inner_product_FLP_avx2(data1, data2, dataSize))
+#define silk_energy_FLP(data, dataSize, arch) \
+    ((void)(arch), silk_energy_FLP_avx2(data, dataSize))
+#define silk_LPC_analysis_filter_FLP(r_LPC, PredCoef, s, length, Order, arch) \
+    ((void)(arch), silk_LPC_analysis_filter_FLP_avx2(r_LPC, PredCoef, s, length, Order))
+#define silk_warped_autocorrelation_FLP(corr, input, warping, length, order, arch) \
+    ((void)(arch), silk_warped_autocorrelation_FLP_avx2(corr, input, warping, length, order))
+#define silk_P_Ana_norm_corr_st3_FLP(CC, cross_corr, energies, Lag_CB_ptr, Lag_range_ptr, cbk_size, nb_cbk_search, nb_subfr, energy_tgt, arch) \
+    ((void)(arch), silk_P_Ana_norm_corr_st3_FLP_avx2(CC, cross_corr, energies, Lag_CB_ptr, Lag_range_ptr, cbk_size, nb_cbk_search, nb_subfr, energy_tgt))
+
+#elif defined(OPUS_X86_PRESUME_SSE2) && !defined(OPUS_X86_MAY_HAVE_AVX2)
+
+#define silk_inner_product_FLP(data1, data2, dataSize, arch) \
+    ((void)(arch), silk_inner_product_FLP_sse2(data1, data2, dataSize))
+#define silk_energy_FLP(data, dataSize, arch) \
+    ((void)(arch), silk_energy_FLP_sse2(data, dataSize))
+#define silk_LPC_analysis_filter_FLP(r_LPC, PredCoef, s, length, Order, arch) \
+    ((void)(arch), silk_LPC_analysis_filter_FLP_sse2(r_LPC, PredCoef, s, length, Order))
+#define silk_P_Ana_norm_corr_st3_FLP(CC, cross_corr, energies, Lag_CB_ptr, Lag_range_ptr, cbk_size, nb_cbk_search, nb_subfr, energy_tgt, arch) \
+    ((void)(arch), silk_P_Ana_norm_corr_st3_FLP_sse2(CC, cross_corr, energies, Lag_CB_ptr, Lag_range_ptr, cbk_size, nb_cbk_search, nb_subfr, energy_tgt))
+
+#else
+
+extern double (*const SILK_INNER_PRODUCT_FLP_IMPL[OPUS_ARCHMASK + 1])(
+    const silk_float *data1, const silk_float *data2, opus_int dataSize);
+extern double (*const SILK_ENERGY_FLP_IMPL[OPUS_ARCHMASK + 1])(
+    const silk_float *data, opus_int dataSize);
+extern void (*const SILK_LPC_ANALYSIS_FILTER_FLP_IMPL[OPUS_ARCHMASK + 1])(
+    silk_float r_LPC[], const silk_float PredCoef[], const silk_float s[],
+    const opus_int length, const opus_int Order);
+extern void (*const SILK_P_ANA_NORM_CORR_ST3_FLP_IMPL[OPUS_ARCHMASK + 1])(
+    silk_float CC[][ PE_NB_STAGE3_LAGS ], const silk_float cross_corr[][ PE_NB_STAGE3_CORRS ],
+    const silk_float energies[][ PE_NB_STAGE3_CORRS ], const opus_int8 *Lag_CB_ptr,
+    const opus_int8 *Lag_range_ptr, opus_int cbk_size, opus_int nb_cbk_search, opus_int nb_subfr,
+    double energy_tgt);
+
+#define silk_inner_product_FLP(data1, data2, dataSize, arch) \
+    ((*SILK_INNER_PRODUCT_FLP_IMPL[(arch) & OPUS_ARCHMASK])(data1, data2, dataSize))
+#define silk_energy_FLP(data, dataSize, arch) \
+    ((*SILK_ENERGY_FLP_IMPL[(arch) & OPUS_ARCHMASK])(data, dataSize))
+#define silk_LPC_analysis_filter_FLP(r_LPC, PredCoef, s, length, Order, arch) \
+    ((*SILK_LPC_ANALYSIS_FILTER_FLP_IMPL[(arch) & OPUS_ARCHMASK])(r_LPC, PredCoef, s, length, Order))
+#define silk_P_Ana_norm_corr_st3_FLP(CC, cross_corr, energies, Lag_CB_ptr, Lag_range_ptr, cbk_size, nb_cbk_search, nb_subfr, energy_tgt, arch) \
+    ((*SILK_P_ANA_NORM_CORR_ST3_FLP_IMPL[(arch) & OPUS_ARCHMASK])(CC, cross_corr, energies, Lag_CB_ptr, Lag_range_ptr, cbk_size, nb_cbk_search, nb_subfr, energy_tgt))
+
+#if defined(OPUS_X86_MAY_HAVE_AVX2)
+extern void (*const SILK_WARPED_AUTOCORRELATION_FLP_IMPL[OPUS_ARCHMASK + 1])(
+    silk_float *corr, const silk_float *input, const silk_float warping,
+    const opus_int length, const opus_int order);
+
+#define silk_warped_autocorrelation_FLP(corr, input, warping, length, order, arch) \
+    ((*SILK_WARPED_AUTOCORRELATION_FLP_IMPL[(arch) & OPUS_ARCHMASK])(corr, input, warping, length, order))
+#endif
+
+#endif
+#endif
+
+#endif
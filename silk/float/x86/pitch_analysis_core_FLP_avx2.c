@@ -0,0 +1,78 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+
+#include "SigProc_FLP.h"
+
+/* Sums and normalizes the first four lags of a contour in one vector and the fifth
+   in a scalar. Every lag is summed over the subframes in the same order as in C,
+   so the output is bit-exact. */
+void silk_P_Ana_norm_corr_st3_FLP_avx2(
+    silk_float          CC[][ PE_NB_STAGE3_LAGS ],          /* O    Correlation per contour and lag [nb_cbk_search]     */
+    const silk_float    cross_corr[][ PE_NB_STAGE3_CORRS ], /* I    Correlations from the lowest lag [nb_subfr]         */
+    const silk_float    energies[][ PE_NB_STAGE3_CORRS ],   /* I    Energies from the lowest lag [nb_subfr]             */
+    const opus_int8     *Lag_CB_ptr,        /* I    Lag contour codebook [nb_subfr][cbk_size]                   */
+    const opus_int8     *Lag_range_ptr,     /* I    Lowest and highest lag [nb_subfr][2]                        */
+    opus_int            cbk_size,           /* I    Size of the codebook                                        */
+    opus_int            nb_cbk_search,      /* I    Number of contours to search                                */
+    opus_int            nb_subfr,           /* I    Number of subframes                                         */
+    double              energy_tgt          /* I    Energy of the target signal plus one                        */
+)
+{
+    opus_int i, k, idx;
+    double   cross_corr_sum, energy_sum;
+    __m256d  xc, en, norm;
+
+    silk_assert( PE_NB_STAGE3_LAGS == 5 );
+    for( i = 0; i < nb_cbk_search; i++ ) {
+        xc = _mm256_setzero_pd();
+        en = _mm256_set1_pd( energy_tgt );
+        cross_corr_sum = 0.0;
+        energy_sum = energy_tgt;
+        for( k = 0; k < nb_subfr; k++ ) {
+            idx = matrix_ptr( Lag_CB_ptr, k, i, cbk_size ) - matrix_ptr( Lag_range_ptr, k, 0, 2 );
+            silk_assert( idx + 4 < PE_NB_STAGE3_CORRS );
+            xc = _mm256_add_pd( xc, _mm256_cvtps_pd( _mm_loadu_ps( &cross_corr[ k ][ idx ] ) ) );
+            en = _mm256_add_pd( en, _mm256_cvtps_pd( _mm_loadu_ps( &energies[ k ][ idx ] ) ) );
+            cross_corr_sum += cross_corr[ k ][ idx + 4 ];
+            energy_sum     +=   energies[ k ][ idx + 4 ];
+        }
+        norm = _mm256_div_pd( _mm256_add_pd( xc, xc ), en );
+        norm = _mm256_and_pd( norm, _mm256_cmp_pd( xc, _mm256_setzero_pd(), _CMP_GT_OQ ) );
+        _mm_storeu_ps( &CC[ i ][ 0 ], _mm256_cvtpd_ps( norm ) );
+        if( cross_corr_sum > 0.0 ) {
+            CC[ i ][ 4 ] = (silk_float)( 2 * cross_corr_sum / energy_sum );
+        } else {
+            CC[ i ][ 4 ] = 0.0f;
+        }
+    }
+}
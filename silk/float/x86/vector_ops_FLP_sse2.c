@@ -0,0 +1,111 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <emmintrin.h>
+
+#include "SigProc_FLP.h"
+
+/* Widens four floats to two pairs of doubles */
+#define SILK_CVT_PD_LO( x ) _mm_cvtps_pd( x )
+#define SILK_CVT_PD_HI( x ) _mm_cvtps_pd( _mm_movehl_ps( x, x ) )
+
+static OPUS_INLINE double silk_hsum_pd( __m128d x )
+{
+    return _mm_cvtsd_f64( _mm_add_sd( x, _mm_unpackhi_pd( x, x ) ) );
+}
+
+/* inner product of two silk_float arrays, with result as double */
+double silk_inner_product_FLP_sse2(
+    const silk_float    *data1,
+    const silk_float    *data2,
+    opus_int            dataSize
+)
+{
+    opus_int i;
+    double   result;
+    __m128d  acc0, acc1, acc2, acc3;
+    __m128   x, y;
+
+    acc0 = acc1 = acc2 = acc3 = _mm_setzero_pd();
+    for( i = 0; i < dataSize - 7; i += 8 ) {
+        x = _mm_loadu_ps( &data1[ i ] );
+        y = _mm_loadu_ps( &data2[ i ] );
+        acc0 = _mm_add_pd( acc0, _mm_mul_pd( SILK_CVT_PD_LO( x ), SILK_CVT_PD_LO( y ) ) );
+        acc1 = _mm_add_pd( acc1, _mm_mul_pd( SILK_CVT_PD_HI( x ), SILK_CVT_PD_HI( y ) ) );
+        x = _mm_loadu_ps( &data1[ i + 4 ] );
+        y = _mm_loadu_ps( &data2[ i + 4 ] );
+        acc2 = _mm_add_pd( acc2, _mm_mul_pd( SILK_CVT_PD_LO( x ), SILK_CVT_PD_LO( y ) ) );
+        acc3 = _mm_add_pd( acc3, _mm_mul_pd( SILK_CVT_PD_HI( x ), SILK_CVT_PD_HI( y ) ) );
+    }
+    result = silk_hsum_pd( _mm_add_pd( _mm_add_pd( acc0, acc1 ), _mm_add_pd( acc2, acc3 ) ) );
+
+    /* add any remaining products */
+    for( ; i < dataSize; i++ ) {
+        result += data1[ i ] * (double)data2[ i ];
+    }
+
+    return result;
+}
+
+/* sum of squares of a silk_float array, with result as double */
+double silk_energy_FLP_sse2(
+    const silk_float    *data,
+    opus_int            dataSize
+)
+{
+    opus_int i;
+    double   result;
+    __m128d  acc0, acc1, acc2, acc3, d;
+    __m128   x;
+
+    acc0 = acc1 = acc2 = acc3 = _mm_setzero_pd();
+    for( i = 0; i < dataSize - 7; i += 8 ) {
+        x = _mm_loadu_ps( &data[ i ] );
+        d = SILK_CVT_PD_LO( x );
+        acc0 = _mm_add_pd( acc0, _mm_mul_pd( d, d ) );
+        d = SILK_CVT_PD_HI( x );
+        acc1 = _mm_add_pd( acc1, _mm_mul_pd( d, d ) );
+        x = _mm_loadu_ps( &data[ i + 4 ] );
+        d = SILK_CVT_PD_LO( x );
+        acc2 = _mm_add_pd( acc2, _mm_mul_pd( d, d ) );
+        d = SILK_CVT_PD_HI( x );
+        acc3 = _mm_add_pd( acc3, _mm_mul_pd( d, d ) );
+    }
+    result = silk_hsum_pd( _mm_add_pd( _mm_add_pd( acc0, acc1 ), _mm_add_pd( acc2, acc3 ) ) );
+
+    /* add any remaining products */
+    for( ; i < dataSize; i++ ) {
+        result += data[ i ] * (double)data[ i ];
+    }
+
+    silk_assert( result >= 0.0 );
+    return result;
+}
@@ -0,0 +1,148 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+
+#include "main_FLP.h"
+
+#define WARPED_MAX_BLOCKS   ( ( MAX_SHAPE_LPC_ORDER + 3 ) / 4 )
+
+/* Runs the allpass sections of silk_warped_autocorrelation_FLP_c() as a wavefront.   */
+/* Lane j of block b holds section k = j * B + b + 1, which is k - 1 samples behind   */
+/* the input. Each section then reads the previous output of the section before it,  */
+/* which is the same lane of block b - 1, except for block 0, whose input is block    */
+/* B - 1 moved up one lane with the new sample in lane 0. Row m of xq holds the input */
+/* samples { x[ m ], x[ m - B ], x[ m - 2 * B ], x[ m - 3 * B ] }, zero outside the   */
+/* input, so block b correlates with row t - b at step t.                             */
+static OPUS_INLINE void silk_warped_autocorrelation_blocks_FLP_avx2(
+    double                          *C,                                 /* O    Correlations of sections 1 to 4 * B         */
+    const double                    *xq,                                /* I    Input rows, starting at row 0               */
+    const double                    warping,                            /* I    Warping coefficient                         */
+    const opus_int                  steps,                              /* I    Number of steps to run                      */
+    const opus_int                  B                                   /* I    Number of blocks                            */
+)
+{
+    opus_int t, b, j;
+    __m256d  w, in0, tmp;
+    __m256d  y[ WARPED_MAX_BLOCKS ], y_in[ WARPED_MAX_BLOCKS ], acc[ WARPED_MAX_BLOCKS ];
+    double   acc_buf[ 4 ];
+
+    w = _mm256_set1_pd( warping );
+    for( b = 0; b < B; b++ ) {
+        y[ b ] = y_in[ b ] = acc[ b ] = _mm256_setzero_pd();
+    }
+
+    for( t = 0; t < steps; t++ ) {
+        in0 = _mm256_blend_pd( _mm256_permute4x64_pd( y[ B - 1 ], _MM_SHUFFLE( 2, 1, 0, 3 ) ),
+                               _mm256_loadu_pd( &xq[ 4 * t ] ), 0x1 );
+        /* Blocks are updated last to first, so that y[ b - 1 ] still holds the previous step */
+        for( b = B - 1; b > 0; b-- ) {
+            tmp = _mm256_fmadd_pd( w, _mm256_sub_pd( y[ b ], y[ b - 1 ] ), y_in[ b ] );
+            y_in[ b ] = y[ b - 1 ];
+            y[ b ] = tmp;
+            acc[ b ] = _mm256_fmadd_pd( _mm256_loadu_pd( &xq[ 4 * ( t - b ) ] ), tmp, acc[ b ] );
+        }
+        tmp = _mm256_fmadd_pd( w, _mm256_sub_pd( y[ 0 ], in0 ), y_in[ 0 ] );
+        y_in[ 0 ] = in0;
+        y[ 0 ] = tmp;
+        acc[ 0 ] = _mm256_fmadd_pd( _mm256_loadu_pd( &xq[ 4 * t ] ), tmp, acc[ 0 ] );
+    }
+
+    for( b = 0; b < B; b++ ) {
+        _mm256_storeu_pd( acc_buf, acc[ b ] );
+        for( j = 0; j < 4; j++ ) {
+            C[ j * B + b ] = acc_buf[ j ];
+        }
+    }
+}
+
+/* Autocorrelations for a warped frequency axis */
+void silk_warped_autocorrelation_FLP_avx2(
+    silk_float                      *corr,                              /* O    Result [order + 1]                          */
+    const silk_float                *input,                             /* I    Input data to correlate                     */
+    const silk_float                warping,                            /* I    Warping coefficient                         */
+    const opus_int                  length,                             /* I    Length of input                             */
+    const opus_int                  order                               /* I    Correlation order (even)                    */
+)
+{
+    opus_int    n, i, j, B, steps;
+    double      C[ 4 * WARPED_MAX_BLOCKS + 1 ];
+    double      xq[ 4 * ( SHAPE_LPC_WIN_MAX + 5 * WARPED_MAX_BLOCKS ) ];
+    double      *xq_ptr;
+
+    /* Order must be even */
+    celt_assert( ( order & 1 ) == 0 );
+    celt_assert( order <= MAX_SHAPE_LPC_ORDER );
+
+    if( length > SHAPE_LPC_WIN_MAX ) {
+        silk_warped_autocorrelation_FLP_c( corr, input, warping, length, order );
+        return;
+    }
+
+    B = ( order + 3 ) >> 2;
+    /* The last section sees the last sample after length + 4 * B - 1 steps, and block */
+    /* b reads back to row -b                                                          */
+    steps = length + 4 * B - 1;
+    xq_ptr = xq + 4 * B;
+    silk_memset( xq, 0, 4 * ( steps + B ) * sizeof( double ) );
+    for( j = 0; j < 4; j++ ) {
+        for( n = 0; n < length && n + j * B < steps; n++ ) {
+            xq_ptr[ 4 * ( n + j * B ) + j ] = input[ n ];
+        }
+    }
+
+    switch( B ) {
+        case 1:
+            silk_warped_autocorrelation_blocks_FLP_avx2( &C[ 1 ], xq_ptr, warping, steps, 1 );
+        break;
+        case 2:
+            silk_warped_autocorrelation_blocks_FLP_avx2( &C[ 1 ], xq_ptr, warping, steps, 2 );
+        break;
+        case 3:
+            silk_warped_autocorrelation_blocks_FLP_avx2( &C[ 1 ], xq_ptr, warping, steps, 3 );
+        break;
+        case 4:
+            silk_warped_autocorrelation_blocks_FLP_avx2( &C[ 1 ], xq_ptr, warping, steps, 4 );
+        break;
+        case 5:
+            silk_warped_autocorrelation_blocks_FLP_avx2( &C[ 1 ], xq_ptr, warping, steps, 5 );
+        break;
+        default:
+            silk_warped_autocorrelation_blocks_FLP_avx2( &C[ 1 ], xq_ptr, warping, steps, 6 );
+        break;
+    }
+    C[ 0 ] = silk_energy_FLP_avx2( input, length );
+
+    /* Copy correlations in silk_float output format */
+    for( i = 0; i < order + 1; i++ ) {
+        corr[ i ] = ( silk_float )C[ i ];
+    }
+}
@@ -38,7 +38,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "entenc.h"
 #include "entdec.h"
 
-#if defined(OPUS_X86_MAY_HAVE_SSE4_1)
+#if defined(OPUS_X86_MAY_HAVE_SSE4_1) || defined(OPUS_X86_MAY_HAVE_AVX2)
 #include "x86/main_sse.h"
 #endif
 
@@ -447,6 +447,15 @@ void silk_decode_pulses(
     const opus_int              frame_length                    /* I    Frame length                                */
 );
 
+/* Decode the number of pulses of each shell block, the first part of silk_decode_pulses() */
+opus_int silk_decode_pulse_counts(                              /* O    Number of shell blocks                      */
+    ec_dec                      *psRangeDec,                    /* I/O  Compressor data structure                   */
+    opus_int                    sum_pulses[],                   /* O    Pulses per shell block, above the LSBs      */
+    opus_int                    nLshifts[],                     /* O    Number of LSBs per shell block              */
+    const opus_int              signalType,                     /* I    Sigtype                                     */
+    const opus_int              frame_length                    /* I    Frame length                                */
+);
+
 /******************/
 /* CNG */
 /******************/
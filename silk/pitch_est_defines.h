@@ -54,6 +54,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #define PE_D_SRCH_LENGTH            24
 
 #define PE_NB_STAGE3_LAGS           5
+#define PE_NB_STAGE3_CORRS          22  /* Widest lag range of a subframe in stage 3 */
 
 #define PE_NB_CBKS_STAGE2           3
 #define PE_NB_CBKS_STAGE2_EXT       11
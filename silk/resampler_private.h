@@ -46,7 +46,8 @@ void silk_resampler_private_IIR_FIR(
     void                            *SS,            /* I/O  Resampler state             */
     opus_int16                      out[],          /* O    Output signal               */
     const opus_int16                in[],           /* I    Input signal                */
-    opus_int32                      inLen           /* I    Number of input samples     */
+    opus_int32                      inLen,          /* I    Number of input samples     */
+    int                             arch            /* I    Run-time architecture       */
 );
 
 /* Description: Hybrid IIR/FIR polyphase implementation of resampling */
@@ -54,9 +55,49 @@ void silk_resampler_private_down_FIR(
     void                            *SS,            /* I/O  Resampler state             */
     opus_int16                      out[],          /* O    Output signal               */
     const opus_int16                in[],           /* I    Input signal                */
-    opus_int32                      inLen           /* I    Number of input samples     */
+    opus_int32                      inLen,          /* I    Number of input samples     */
+    int                             arch            /* I    Run-time architecture       */
 );
 
+/* Interpolates the 2x upsampled signal with the 12-phase FIR, for all the   */
+/* output samples up to max_index_Q16. Returns the end of the output.       */
+opus_int16 *silk_resampler_private_IIR_FIR_INTERPOL_c(
+    opus_int16                      *out,           /* O    Output signal               */
+    const opus_int16                *buf,           /* I    Upsampled input signal      */
+    opus_int32                      max_index_Q16,  /* I    End of the input, Q16       */
+    opus_int32                      index_increment_Q16 /* I Input step per output, Q16 */
+);
+
+/* Interpolates the AR2-filtered signal with the FIR_Fracs-phase FIR, for   */
+/* all the output samples up to max_index_Q16. Returns the end of the output. */
+opus_int16 *silk_resampler_private_down_FIR_INTERPOL_c(
+    opus_int16                      *out,           /* O    Output signal               */
+    const opus_int32                *buf,           /* I    Filtered input signal, Q8   */
+    const opus_int16                *FIR_Coefs,     /* I    FIR coefficients            */
+    opus_int                        FIR_Order,      /* I    FIR order                   */
+    opus_int                        FIR_Fracs,      /* I    Number of FIR phases        */
+    opus_int32                      max_index_Q16,  /* I    End of the input, Q16       */
+    opus_int32                      index_increment_Q16 /* I Input step per output, Q16 */
+);
+
+#if defined(OPUS_X86_MAY_HAVE_SSE4_1) || defined(OPUS_X86_MAY_HAVE_AVX2)
+#include "x86/resampler_sse.h"
+#endif
+
+#if defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+#include "arm/resampler_arm.h"
+#endif
+
+#if !defined(OVERRIDE_silk_resampler_private_IIR_FIR_INTERPOL)
+#define silk_resampler_private_IIR_FIR_INTERPOL(out, buf, max_index_Q16, index_increment_Q16, arch) \
+    ((void)(arch), silk_resampler_private_IIR_FIR_INTERPOL_c(out, buf, max_index_Q16, index_increment_Q16))
+#endif
+
+#if !defined(OVERRIDE_silk_resampler_private_down_FIR_INTERPOL)
+#define silk_resampler_private_down_FIR_INTERPOL(out, buf, FIR_Coefs, FIR_Order, FIR_Fracs, max_index_Q16, index_increment_Q16, arch) \
+    ((void)(arch), silk_resampler_private_down_FIR_INTERPOL_c(out, buf, FIR_Coefs, FIR_Order, FIR_Fracs, max_index_Q16, index_increment_Q16))
+#endif
+
 /* Upsample by a factor 2, high quality */
 void silk_resampler_private_up2_HQ_wrapper(
     void                            *SS,            /* I/O  Resampler state (unused)    */
@@ -33,15 +33,15 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "resampler_private.h"
 #include "stack_alloc.h"
 
-static OPUS_INLINE opus_int16 *silk_resampler_private_IIR_FIR_INTERPOL(
-    opus_int16  *out,
-    opus_int16  *buf,
-    opus_int32  max_index_Q16,
-    opus_int32  index_increment_Q16
+opus_int16 *silk_resampler_private_IIR_FIR_INTERPOL_c(
+    opus_int16          *out,
+    const opus_int16    *buf,
+    opus_int32          max_index_Q16,
+    opus_int32          index_increment_Q16
 )
 {
     opus_int32 index_Q16, res_Q15;
-    opus_int16 *buf_ptr;
+    const opus_int16 *buf_ptr;
     opus_int32 table_index;
 
     /* Interpolate upsampled signal and store in output array */
@@ -66,7 +66,8 @@ void silk_resampler_private_IIR_FIR(
     void                            *SS,            /* I/O  Resampler state             */
     opus_int16                      out[],          /* O    Output signal               */
     const opus_int16                in[],           /* I    Input signal                */
-    opus_int32                      inLen           /* I    Number of input samples     */
+    opus_int32                      inLen,          /* I    Number of input samples     */
+    int                             arch            /* I    Run-time architecture       */
 )
 {
     silk_resampler_state_struct *S = (silk_resampler_state_struct *)SS;
@@ -89,7 +90,7 @@ void silk_resampler_private_IIR_FIR(
         silk_resampler_private_up2_HQ( S->sIIR, &buf[ RESAMPLER_ORDER_FIR_12 ], in, nSamplesIn );
 
         max_index_Q16 = silk_LSHIFT32( nSamplesIn, 16 + 1 );         /* + 1 because 2x upsampling */
-        out = silk_resampler_private_IIR_FIR_INTERPOL( out, buf, max_index_Q16, index_increment_Q16 );
+        out = silk_resampler_private_IIR_FIR_INTERPOL( out, buf, max_index_Q16, index_increment_Q16, arch );
         in += nSamplesIn;
         inLen -= nSamplesIn;
 
@@ -33,9 +33,9 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "resampler_private.h"
 #include "stack_alloc.h"
 
-static OPUS_INLINE opus_int16 *silk_resampler_private_down_FIR_INTERPOL(
+opus_int16 *silk_resampler_private_down_FIR_INTERPOL_c(
     opus_int16          *out,
-    opus_int32          *buf,
+    const opus_int32    *buf,
     const opus_int16    *FIR_Coefs,
     opus_int            FIR_Order,
     opus_int            FIR_Fracs,
@@ -44,7 +44,7 @@ static OPUS_INLINE opus_int16 *silk_resampler_private_down_FIR_INTERPOL(
 )
 {
     opus_int32 index_Q16, res_Q6;
-    opus_int32 *buf_ptr;
+    const opus_int32 *buf_ptr;
     opus_int32 interpol_ind;
     const opus_int16 *interpol_ptr;
 
@@ -146,7 +146,8 @@ void silk_resampler_private_down_FIR(
     void                            *SS,            /* I/O  Resampler state             */
     opus_int16                      out[],          /* O    Output signal               */
     const opus_int16                in[],           /* I    Input signal                */
-    opus_int32                      inLen           /* I    Number of input samples     */
+    opus_int32                      inLen,          /* I    Number of input samples     */
+    int                             arch            /* I    Run-time architecture       */
 )
 {
     silk_resampler_state_struct *S = (silk_resampler_state_struct *)SS;
@@ -175,7 +176,7 @@ void silk_resampler_private_down_FIR(
 
         /* Interpolate filtered signal */
         out = silk_resampler_private_down_FIR_INTERPOL( out, buf, FIR_Coefs, S->FIR_Order,
-            S->FIR_Fracs, max_index_Q16, index_increment_Q16 );
+            S->FIR_Fracs, max_index_Q16, index_increment_Q16, arch );
 
         in += nSamplesIn;
         inLen -= nSamplesIn;
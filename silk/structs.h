@@ -33,6 +33,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "define.h"
 #include "entenc.h"
 #include "entdec.h"
+#include "profile_stats.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -225,6 +226,10 @@ typedef struct {
     opus_int                     LBRR_GainIncreases;                /* Gains increment for coding LBRR frames                           */
     SideInfoIndices              indices_LBRR[ MAX_FRAMES_PER_PACKET ];
     opus_int8                    pulses_LBRR[ MAX_FRAMES_PER_PACKET ][ MAX_FRAME_LENGTH ];
+
+#ifdef ENABLE_PROFILE_STATS
+    OpusProfile                  *profile;                          /* Stage counters of the Opus encoder, or NULL                      */
+#endif
 } silk_encoder_state;
 
 
@@ -321,6 +326,16 @@ typedef struct {
     opus_int                    LTP_scale_Q14;
 } silk_decoder_control;
 
+/************************/
+/* Probe state          */
+/************************/
+typedef struct {
+    opus_int                    fs_kHz;
+    opus_int8                   LastGainIndex;
+    /* log2 of the power of the LTP synthesis output over the last pitch period, Q7 */
+    opus_int32                  LTP_power_Q7;
+} silk_probe_state;
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,138 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "cpu_support.h"
+#include "SigProc_FIX.h"
+
+#define MAX_FRAME_MS   40
+#define MAX_IN_LEN     ( MAX_FRAME_MS * 48 + 48 )
+#define MAX_OUT_LEN    ( ( MAX_IN_LEN + 1 ) * 6 )
+#define NB_FRAMES      40
+#define NB_SIGNALS     5
+
+static const opus_int32 rates[ 5 ] = { 8000, 12000, 16000, 24000, 48000 };
+
+static opus_uint32 seed = 1;
+
+static opus_int32 fast_rand( void )
+{
+    seed = 1664525 * seed + 1013904223;
+    return (opus_int32)( seed >> 8 );
+}
+
+/* Fills in[] with one of the test signals, including full-scale and */
+/* alternating-sign inputs that drive the filters into saturation.   */
+static void gen_signal( opus_int16 *in, int len, int type, int *phase )
+{
+    int i;
+    for( i = 0; i < len; i++, (*phase)++ ) {
+        switch( type ) {
+            case 0:
+                in[ i ] = (opus_int16)fast_rand();
+                break;
+            case 1:
+                in[ i ] = ( fast_rand() & 1 ) ? 32767 : -32768;
+                break;
+            case 2:
+                in[ i ] = ( *phase & 1 ) ? 32767 : -32768;
+                break;
+            case 3:
+                in[ i ] = (opus_int16)( (opus_int16)fast_rand() >> 8 );
+                break;
+            default:
+                in[ i ] = (opus_int16)floor( .5 + 32767. * sin( 1e-5 * (double)*phase * *phase ) );
+        }
+    }
+}
+
+/* Runs the same input through the resampler at arch 0 and at every other */
+/* supported arch, and checks that outputs and states are identical.     */
+static int test_pair( opus_int32 Fs_in, opus_int32 Fs_out, int forEnc, int max_arch )
+{
+    silk_resampler_state_struct ref, opt;
+    opus_int16 in[ MAX_IN_LEN ], out_ref[ MAX_OUT_LEN ], out_opt[ MAX_OUT_LEN ];
+    int arch, type, frame, len, phase;
+
+    for( arch = 1; arch <= max_arch; arch++ ) {
+        for( type = 0; type < NB_SIGNALS; type++ ) {
+            silk_resampler_init( &ref, Fs_in, Fs_out, forEnc );
+            silk_resampler_init( &opt, Fs_in, Fs_out, forEnc );
+            phase = 0;
+            for( frame = 0; frame < NB_FRAMES; frame++ ) {
+                /* Whole frames of 1 to 40 ms, then arbitrary lengths of at least 1 ms */
+                if( frame < NB_FRAMES / 2 ) {
+                    len = Fs_in / 1000 * ( 1 + fast_rand() % MAX_FRAME_MS );
+                } else {
+                    len = Fs_in / 1000 + fast_rand() % ( MAX_FRAME_MS * Fs_in / 1000 );
+                }
+                gen_signal( in, len, type, &phase );
+                memset( out_ref, 0x55, sizeof( out_ref ) );
+                memset( out_opt, 0x55, sizeof( out_opt ) );
+                silk_resampler( &ref, out_ref, in, len, 0 );
+                silk_resampler( &opt, out_opt, in, len, arch );
+                if( memcmp( out_ref, out_opt, sizeof( out_ref ) ) != 0 ||
+                    memcmp( &ref, &opt, sizeof( ref ) ) != 0 ) {
+                    fprintf( stderr, "**%s resampler %d -> %d Hz differs at arch %d (signal %d, frame %d, length %d)**\n",
+                        forEnc ? "Encoder" : "Decoder", (int)Fs_in, (int)Fs_out, arch, type, frame, len );
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+int main( void )
+{
+    const int arch = opus_select_arch();
+    int i, j, forEnc, nb_pairs = 0;
+
+    printf( "Testing silk_resampler() optimizations up to arch %d ...\n", arch );
+    for( forEnc = 0; forEnc <= 1; forEnc++ ) {
+        for( i = 0; i < 5; i++ ) {
+            for( j = 0; j < 5; j++ ) {
+                /* The encoder resamples to, and the decoder from, the SILK internal rates */
+                if( forEnc ? rates[ j ] > 16000 : rates[ i ] > 16000 ) {
+                    continue;
+                }
+                if( test_pair( rates[ i ], rates[ j ], forEnc, arch ) ) {
+                    return 1;
+                }
+                nb_pairs++;
+            }
+        }
+    }
+    printf( "silk_resampler() optimizations passed on %d rate pairs\n", nb_pairs );
+    return 0;
+}
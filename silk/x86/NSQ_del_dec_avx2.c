@@ -0,0 +1,788 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+#ifdef OPUS_CHECK_ASM
+# include <string.h>
+#endif
+#include "main.h"
+#include "stack_alloc.h"
+
+/* The delayed decision states are processed in parallel, one per 32-bit lane of an    */
+/* __m128i, so up to 4 states are handled. With more states the C function is called.  */
+#define AVX2_MAX_DEL_DEC_STATES 4
+
+/* Same content as NSQ_del_dec_struct, transposed so that the states of a sample are a row */
+typedef struct {
+    opus_int32 sLPC_Q14[ MAX_SUB_FRAME_LENGTH + NSQ_LPC_BUF_LENGTH ][ AVX2_MAX_DEL_DEC_STATES ];
+    opus_int32 RandState[ DECISION_DELAY ][     AVX2_MAX_DEL_DEC_STATES ];
+    opus_int32 Q_Q10[     DECISION_DELAY ][     AVX2_MAX_DEL_DEC_STATES ];
+    opus_int32 Xq_Q14[    DECISION_DELAY ][     AVX2_MAX_DEL_DEC_STATES ];
+    opus_int32 Pred_Q15[  DECISION_DELAY ][     AVX2_MAX_DEL_DEC_STATES ];
+    opus_int32 Shape_Q14[ DECISION_DELAY ][     AVX2_MAX_DEL_DEC_STATES ];
+    opus_int32 sAR2_Q14[ MAX_SHAPE_LPC_ORDER ][ AVX2_MAX_DEL_DEC_STATES ];
+    opus_int32 LF_AR_Q14[ AVX2_MAX_DEL_DEC_STATES ];
+    opus_int32 Diff_Q14[  AVX2_MAX_DEL_DEC_STATES ];
+    opus_int32 Seed[      AVX2_MAX_DEL_DEC_STATES ];
+    opus_int32 SeedInit[  AVX2_MAX_DEL_DEC_STATES ];
+    opus_int32 RD_Q10[    AVX2_MAX_DEL_DEC_STATES ];
+} NSQ_del_decs_struct;
+
+/* silk_SMULWW() on eight lanes: ( a * b ) >> 16 with a 64-bit product. b holds the same */
+/* value in all lanes.                                                                   */
+static OPUS_INLINE __m256i silk_SMULWW_epi32x8( __m256i a, __m256i b )
+{
+    __m256i even, odd;
+    even = _mm256_mul_epi32( a, b );
+    odd  = _mm256_mul_epi32( _mm256_srli_epi64( a, 32 ), b );
+    return _mm256_blend_epi32( _mm256_srli_epi64( even, 16 ), _mm256_slli_epi64( odd, 16 ), 0xAA );
+}
+
+/* silk_SMULWB() on four values held in the low halves of the 64-bit lanes, with b     */
+/* holding a 16-bit value in all lanes. Only the low halves of the result are valid.   */
+static OPUS_INLINE __m256i silk_SMULWB_epi64x4( __m256i a, __m256i b )
+{
+    return _mm256_srli_epi64( _mm256_mul_epi32( a, b ), 16 );
+}
+
+/* Gathers the low halves of the 64-bit lanes */
+static OPUS_INLINE __m128i silk_pack_epi64x4( __m256i x )
+{
+    return _mm256_castsi256_si128( _mm256_permutevar8x32_epi32( x, _mm256_setr_epi32( 0, 2, 4, 6, 0, 2, 4, 6 ) ) );
+}
+
+static OPUS_INLINE __m128i silk_ADD_SAT32_epi32( __m128i a, __m128i b )
+{
+    __m128i sum, sat, ovf;
+    sum = _mm_add_epi32( a, b );
+    ovf = _mm_and_si128( _mm_xor_si128( a, sum ), _mm_xor_si128( b, sum ) );
+    sat = _mm_xor_si128( _mm_srai_epi32( a, 31 ), _mm_set1_epi32( silk_int32_MAX ) );
+    return _mm_castps_si128( _mm_blendv_ps( _mm_castsi128_ps( sum ), _mm_castsi128_ps( sat ), _mm_castsi128_ps( ovf ) ) );
+}
+
+static OPUS_INLINE __m256i silk_SUB_SAT32_epi32x8( __m256i a, __m256i b )
+{
+    __m256i diff, sat, ovf;
+    diff = _mm256_sub_epi32( a, b );
+    ovf  = _mm256_and_si256( _mm256_xor_si256( a, b ), _mm256_xor_si256( a, diff ) );
+    sat  = _mm256_xor_si256( _mm256_srai_epi32( a, 31 ), _mm256_set1_epi32( silk_int32_MAX ) );
+    return _mm256_castps_si256( _mm256_blendv_ps( _mm256_castsi256_ps( diff ), _mm256_castsi256_ps( sat ), _mm256_castsi256_ps( ovf ) ) );
+}
+
+static OPUS_INLINE __m128i silk_SUB_SAT32_epi32( __m128i a, __m128i b )
+{
+    __m128i diff, sat, ovf;
+    diff = _mm_sub_epi32( a, b );
+    ovf  = _mm_and_si128( _mm_xor_si128( a, b ), _mm_xor_si128( a, diff ) );
+    sat  = _mm_xor_si128( _mm_srai_epi32( a, 31 ), _mm_set1_epi32( silk_int32_MAX ) );
+    return _mm_castps_si128( _mm_blendv_ps( _mm_castsi128_ps( diff ), _mm_castsi128_ps( sat ), _mm_castsi128_ps( ovf ) ) );
+}
+
+/* silk_SMULBB() on eight lanes */
+static OPUS_INLINE __m256i silk_SMULBB_epi32x8( __m256i a, __m256i b )
+{
+    return _mm256_madd_epi16( a, _mm256_and_si256( b, _mm256_set1_epi32( 0x0000FFFF ) ) );
+}
+
+/* Lowest set bit of a 4-bit mask */
+static const opus_int8 silk_first_lane[ 16 ] = { 0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0 };
+
+/* Lowest lane holding the minimum of x, which has the unused lanes set to silk_int32_MAX */
+static OPUS_INLINE opus_int silk_argmin_epi32( __m128i x )
+{
+    __m128i m;
+    m = _mm_min_epi32( x, _mm_shuffle_epi32( x, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+    m = _mm_min_epi32( m, _mm_shuffle_epi32( m, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    return silk_first_lane[ _mm_movemask_ps( _mm_castsi128_ps( _mm_cmpeq_epi32( x, m ) ) ) ];
+}
+
+/* Lowest lane holding the maximum of x, which has the unused lanes set to silk_int32_MIN */
+static OPUS_INLINE opus_int silk_argmax_epi32( __m128i x )
+{
+    __m128i m;
+    m = _mm_max_epi32( x, _mm_shuffle_epi32( x, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+    m = _mm_max_epi32( m, _mm_shuffle_epi32( m, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    return silk_first_lane[ _mm_movemask_ps( _mm_castsi128_ps( _mm_cmpeq_epi32( x, m ) ) ) ];
+}
+
+/* Applies the lane permutation perm to n rows, two rows at a time */
+static OPUS_INLINE void silk_permute_rows_avx2( opus_int32 ( *rows )[ AVX2_MAX_DEL_DEC_STATES ], opus_int n, __m256i perm )
+{
+    opus_int j;
+    for( j = 0; j < n; j += 2 ) {
+        _mm256_storeu_si256( (__m256i *)rows[ j ],
+            _mm256_permutevar8x32_epi32( _mm256_loadu_si256( (const __m256i *)rows[ j ] ), perm ) );
+    }
+}
+
+/* x[ i ] = silk_SMULWW( x[ i ], b ) */
+static OPUS_INLINE void silk_SMULWW_loop_avx2( opus_int32 *x, opus_int32 b, opus_int n )
+{
+    opus_int i;
+    const __m256i b_v = _mm256_set1_epi32( b );
+    for( i = 0; i < n - 7; i += 8 ) {
+        _mm256_storeu_si256( (__m256i *)&x[ i ], silk_SMULWW_epi32x8( _mm256_loadu_si256( (const __m256i *)&x[ i ] ), b_v ) );
+    }
+    for( ; i < n; i++ ) {
+        x[ i ] = silk_SMULWW( b, x[ i ] );
+    }
+}
+
+/* out[ i ] = silk_SMULWW( in[ i ], b ), which is also silk_SMULWB( b, in[ i ] ) */
+static OPUS_INLINE void silk_SMULWW_int16_loop_avx2( opus_int32 *out, const opus_int16 *in, opus_int32 b, opus_int n )
+{
+    opus_int i;
+    const __m256i b_v = _mm256_set1_epi32( b );
+    for( i = 0; i < n - 7; i += 8 ) {
+        _mm256_storeu_si256( (__m256i *)&out[ i ],
+            silk_SMULWW_epi32x8( _mm256_cvtepi16_epi32( _mm_loadu_si128( (const __m128i *)&in[ i ] ) ), b_v ) );
+    }
+    for( ; i < n; i++ ) {
+        out[ i ] = silk_SMULWW( in[ i ], b );
+    }
+}
+
+static OPUS_INLINE void silk_nsq_del_dec_scale_states_avx2(
+    const silk_encoder_state *psEncC,               /* I    Encoder State                       */
+    silk_nsq_state      *NSQ,                       /* I/O  NSQ state                           */
+    NSQ_del_decs_struct *psDelDec,                  /* I/O  Delayed decision states             */
+    const opus_int16    x16[],                      /* I    Input                               */
+    opus_int32          x_sc_Q10[],                 /* O    Input scaled with 1/Gain in Q10     */
+    const opus_int16    sLTP[],                     /* I    Re-whitened LTP state in Q0         */
+    opus_int32          sLTP_Q15[],                 /* O    LTP state matching scaled input     */
+    opus_int            subfr,                      /* I    Subframe number                     */
+    const opus_int      LTP_scale_Q14,              /* I    LTP state scaling                   */
+    const opus_int32    Gains_Q16[ MAX_NB_SUBFR ],  /* I                                        */
+    const opus_int      pitchL[ MAX_NB_SUBFR ],     /* I    Pitch lag                           */
+    const opus_int      signal_type,                /* I    Signal type                         */
+    const opus_int      decisionDelay               /* I    Decision delay                      */
+)
+{
+    opus_int            lag, start;
+    opus_int32          gain_adj_Q16, inv_gain_Q31, inv_gain_Q26;
+
+    lag          = pitchL[ subfr ];
+    inv_gain_Q31 = silk_INVERSE32_varQ( silk_max( Gains_Q16[ subfr ], 1 ), 47 );
+    silk_assert( inv_gain_Q31 != 0 );
+
+    /* Scale input */
+    inv_gain_Q26 = silk_RSHIFT_ROUND( inv_gain_Q31, 5 );
+    silk_SMULWW_int16_loop_avx2( x_sc_Q10, x16, inv_gain_Q26, psEncC->subfr_length );
+
+    /* After rewhitening the LTP state is un-scaled, so scale with inv_gain_Q16 */
+    start = NSQ->sLTP_buf_idx - lag - LTP_ORDER / 2;
+    if( NSQ->rewhite_flag ) {
+        if( subfr == 0 ) {
+            /* Do LTP downscaling */
+            inv_gain_Q31 = silk_LSHIFT( silk_SMULWB( inv_gain_Q31, LTP_scale_Q14 ), 2 );
+        }
+        silk_SMULWW_int16_loop_avx2( &sLTP_Q15[ start ], &sLTP[ start ], inv_gain_Q31, NSQ->sLTP_buf_idx - start );
+    }
+
+    /* Adjust for changing gain */
+    if( Gains_Q16[ subfr ] != NSQ->prev_gain_Q16 ) {
+        gain_adj_Q16 =  silk_DIV32_varQ( NSQ->prev_gain_Q16, Gains_Q16[ subfr ], 16 );
+
+        /* Scale long-term shaping state */
+        silk_SMULWW_loop_avx2( &NSQ->sLTP_shp_Q14[ NSQ->sLTP_shp_buf_idx - psEncC->ltp_mem_length ], gain_adj_Q16,
+            psEncC->ltp_mem_length );
+
+        /* Scale long-term prediction state */
+        if( signal_type == TYPE_VOICED && NSQ->rewhite_flag == 0 ) {
+            silk_SMULWW_loop_avx2( &sLTP_Q15[ start ], gain_adj_Q16, NSQ->sLTP_buf_idx - decisionDelay - start );
+        }
+
+        /* Scale scalar states */
+        silk_SMULWW_loop_avx2( psDelDec->LF_AR_Q14, gain_adj_Q16, AVX2_MAX_DEL_DEC_STATES );
+        silk_SMULWW_loop_avx2( psDelDec->Diff_Q14, gain_adj_Q16, AVX2_MAX_DEL_DEC_STATES );
+
+        /* Scale short-term prediction and shaping states */
+        silk_SMULWW_loop_avx2( psDelDec->sLPC_Q14[ 0 ], gain_adj_Q16, NSQ_LPC_BUF_LENGTH * AVX2_MAX_DEL_DEC_STATES );
+        silk_SMULWW_loop_avx2( psDelDec->sAR2_Q14[ 0 ], gain_adj_Q16, MAX_SHAPE_LPC_ORDER * AVX2_MAX_DEL_DEC_STATES );
+        silk_SMULWW_loop_avx2( psDelDec->Pred_Q15[ 0 ], gain_adj_Q16, DECISION_DELAY * AVX2_MAX_DEL_DEC_STATES );
+        silk_SMULWW_loop_avx2( psDelDec->Shape_Q14[ 0 ], gain_adj_Q16, DECISION_DELAY * AVX2_MAX_DEL_DEC_STATES );
+
+        /* Save inverse gain */
+        NSQ->prev_gain_Q16 = Gains_Q16[ subfr ];
+    }
+}
+
+/******************************************/
+/* Noise shape quantizer for one subframe */
+/******************************************/
+/* The states of the delayed decision tree sit in the 32-bit lanes of an __m128i and  */
+/* the per-state scalars stay in registers for the whole subframe. The short-term     */
+/* prediction reads two rows of sLPC_Q14 per __m256i, i.e. two taps of all states,    */
+/* and the two quantization candidates of all states are updated together.            */
+static OPUS_INLINE void silk_noise_shape_quantizer_del_dec_avx2(
+    silk_nsq_state      *NSQ,                   /* I/O  NSQ state                           */
+    NSQ_del_decs_struct *psDelDec,              /* I/O  Delayed decision states             */
+    opus_int            signalType,             /* I    Signal type                         */
+    const opus_int32    x_Q10[],                /* I                                        */
+    opus_int8           pulses[],               /* O                                        */
+    opus_int16          xq[],                   /* O                                        */
+    opus_int32          sLTP_Q15[],             /* I/O  LTP filter state                    */
+    opus_int32          delayedGain_Q10[],      /* I/O  Gain delay buffer                   */
+    const opus_int16    a_Q12[],                /* I    Short term prediction coefs         */
+    const opus_int16    b_Q14[],                /* I    Long term prediction coefs          */
+    const opus_int16    AR_shp_Q13[],           /* I    Noise shaping coefs                 */
+    opus_int            lag,                    /* I    Pitch lag                           */
+    opus_int32          HarmShapeFIRPacked_Q14, /* I                                        */
+    opus_int            Tilt_Q14,               /* I    Spectral tilt                       */
+    opus_int32          LF_shp_Q14,             /* I                                        */
+    opus_int32          Gain_Q16,               /* I                                        */
+    opus_int            Lambda_Q10,             /* I                                        */
+    opus_int            offset_Q10,             /* I                                        */
+    opus_int            length,                 /* I    Input length                        */
+    opus_int            subfr,                  /* I    Subframe number                     */
+    opus_int            shapingLPCOrder,        /* I    Shaping LPC filter order            */
+    opus_int            predictLPCOrder,        /* I    Prediction filter order             */
+    opus_int            warping_Q16,            /* I                                        */
+    opus_int            nStatesDelayedDecision, /* I    Number of states in decision tree   */
+    opus_int            *smpl_buf_idx,          /* I/O  Index to newest samples in buffers  */
+    opus_int            decisionDelay           /* I                                        */
+)
+{
+    opus_int     i, j, Winner_ind, RDmin_ind, RDmax_ind, last_smple_idx;
+    opus_int32   Winner_rand_state;
+    opus_int32   LTP_pred_Q14, n_LTP_Q14;
+    opus_int32   Gain_Q10;
+    opus_int32   *pred_lag_ptr, *shp_lag_ptr;
+    opus_int32   AR_shp_Q13_32[ MAX_SHAPE_LPC_ORDER ];
+    opus_int32   perm[ 8 ], RD_buf[ 8 ];
+    __m256i      a_Q12_pairs[ MAX_LPC_ORDER / 2 ];
+    __m128i      Seed, RD_Q10, LF_AR_Q14, Diff_Q14, unused;
+    const __m256i warping = _mm256_set1_epi32( (opus_int16)warping_Q16 );
+    const __m256i Tilt = _mm256_set1_epi32( (opus_int16)Tilt_Q14 );
+    const __m256i LF_shp_lo = _mm256_set1_epi32( (opus_int16)LF_shp_Q14 );
+    const __m256i LF_shp_hi = _mm256_set1_epi32( silk_RSHIFT( LF_shp_Q14, 16 ) );
+    const __m256i Lambda = _mm256_set1_epi32( Lambda_Q10 );
+    const __m256i identity = _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 );
+
+    silk_assert( nStatesDelayedDecision > 2 && nStatesDelayedDecision <= AVX2_MAX_DEL_DEC_STATES );
+    celt_assert( ( shapingLPCOrder & 1 ) == 0 );   /* check that order is even */
+    celt_assert( ( predictLPCOrder & 1 ) == 0 );
+
+    shp_lag_ptr  = &NSQ->sLTP_shp_Q14[ NSQ->sLTP_shp_buf_idx - lag + HARM_SHAPE_FIR_TAPS / 2 ];
+    pred_lag_ptr = &sLTP_Q15[ NSQ->sLTP_buf_idx - lag + LTP_ORDER / 2 ];
+    Gain_Q10     = silk_RSHIFT( Gain_Q16, 6 );
+
+    /* Row t of a 256-bit load from sLPC_Q14[ t ] meets a_Q12[ j + 1 ], row t + 1 meets a_Q12[ j ] */
+    for( j = 0; j < predictLPCOrder; j += 2 ) {
+        a_Q12_pairs[ j >> 1 ] = _mm256_setr_epi32( a_Q12[ j + 1 ], a_Q12[ j + 1 ], a_Q12[ j + 1 ], a_Q12[ j + 1 ],
+                                                    a_Q12[ j ], a_Q12[ j ], a_Q12[ j ], a_Q12[ j ] );
+    }
+    for( j = 0; j < shapingLPCOrder; j++ ) {
+        AR_shp_Q13_32[ j ] = AR_shp_Q13[ j ];
+    }
+
+    /* Lanes past the last state never win a comparison */
+    unused = _mm_cmpgt_epi32( _mm_setr_epi32( 0, 1, 2, 3 ), _mm_set1_epi32( nStatesDelayedDecision - 1 ) );
+
+    Seed      = _mm_loadu_si128( (const __m128i *)psDelDec->Seed );
+    RD_Q10    = _mm_loadu_si128( (const __m128i *)psDelDec->RD_Q10 );
+    LF_AR_Q14 = _mm_loadu_si128( (const __m128i *)psDelDec->LF_AR_Q14 );
+    Diff_Q14  = _mm_loadu_si128( (const __m128i *)psDelDec->Diff_Q14 );
+
+    for( i = 0; i < length; i++ ) {
+        __m256i acc_even, acc_odd, tmp1, tmp2, prev, n_AR, n_LF, t;
+        __m128i LPC_pred_Q14, n_AR_Q14, n_LF_Q14, r_Q10, sign, q1_Q10, q1_Q0, q2_Q10, mask;
+        __m128i lt0, eq0, eqm1, ltm1, rd1_Q10, rd2_Q10, first;
+        __m256i Q_Q10, RD_pair, xq_Q14, LPC_exc_Q14, Diff_pair, LF_AR_pair, sLTP_shp_Q14, sign_pair, sel;
+        opus_int32 (*psLPC_Q14)[ AVX2_MAX_DEL_DEC_STATES ];
+
+        /* Perform common calculations used in all states */
+
+        /* Long-term prediction */
+        if( signalType == TYPE_VOICED ) {
+            /* Unrolled loop */
+            /* Avoids introducing a bias because silk_SMLAWB() always rounds to -inf */
+            LTP_pred_Q14 = 2;
+            LTP_pred_Q14 = silk_SMLAWB( LTP_pred_Q14, pred_lag_ptr[  0 ], b_Q14[ 0 ] );
+            LTP_pred_Q14 = silk_SMLAWB( LTP_pred_Q14, pred_lag_ptr[ -1 ], b_Q14[ 1 ] );
+            LTP_pred_Q14 = silk_SMLAWB( LTP_pred_Q14, pred_lag_ptr[ -2 ], b_Q14[ 2 ] );
+            LTP_pred_Q14 = silk_SMLAWB( LTP_pred_Q14, pred_lag_ptr[ -3 ], b_Q14[ 3 ] );
+            LTP_pred_Q14 = silk_SMLAWB( LTP_pred_Q14, pred_lag_ptr[ -4 ], b_Q14[ 4 ] );
+            LTP_pred_Q14 = silk_LSHIFT( LTP_pred_Q14, 1 );                          /* Q13 -> Q14 */
+            pred_lag_ptr++;
+        } else {
+            LTP_pred_Q14 = 0;
+        }
+
+        /* Long-term shaping */
+        if( lag > 0 ) {
+            /* Symmetric, packed FIR coefficients */
+            n_LTP_Q14 = silk_SMULWB( silk_ADD_SAT32( shp_lag_ptr[ 0 ], shp_lag_ptr[ -2 ] ), HarmShapeFIRPacked_Q14 );
+            n_LTP_Q14 = silk_SMLAWT( n_LTP_Q14, shp_lag_ptr[ -1 ], HarmShapeFIRPacked_Q14 );
+            n_LTP_Q14 = silk_SUB_LSHIFT32( LTP_pred_Q14, n_LTP_Q14, 2 );            /* Q12 -> Q14 */
+            shp_lag_ptr++;
+        } else {
+            n_LTP_Q14 = 0;
+        }
+
+        /* Generate dither */
+        Seed = _mm_add_epi32( _mm_mullo_epi32( Seed, _mm_set1_epi32( RAND_MULTIPLIER ) ), _mm_set1_epi32( RAND_INCREMENT ) );
+
+        /* Short-term prediction, two taps per iteration. Each silk_SMULWB() keeps its 64-bit */
+        /* product, so the even and odd lanes are accumulated separately.                     */
+        psLPC_Q14 = &psDelDec->sLPC_Q14[ NSQ_LPC_BUF_LENGTH - 2 + i ];
+        acc_even = acc_odd = _mm256_setzero_si256();
+        for( j = 0; j < predictLPCOrder; j += 2 ) {
+            t = _mm256_loadu_si256( (const __m256i *)psLPC_Q14[ -j ] );
+            acc_even = _mm256_add_epi32( acc_even, _mm256_srli_epi64( _mm256_mul_epi32( t, a_Q12_pairs[ j >> 1 ] ), 16 ) );
+            acc_odd  = _mm256_add_epi32( acc_odd, _mm256_slli_epi64(
+                _mm256_mul_epi32( _mm256_srli_epi64( t, 32 ), a_Q12_pairs[ j >> 1 ] ), 16 ) );
+        }
+        t = _mm256_blend_epi32( acc_even, acc_odd, 0xAA );
+        LPC_pred_Q14 = _mm_add_epi32( _mm256_castsi256_si128( t ), _mm256_extracti128_si256( t, 1 ) );
+        /* Avoids introducing a bias because silk_SMLAWB() always rounds to -inf */
+        LPC_pred_Q14 = _mm_add_epi32( LPC_pred_Q14, _mm_set1_epi32( silk_RSHIFT( predictLPCOrder, 1 ) ) );
+        LPC_pred_Q14 = _mm_slli_epi32( LPC_pred_Q14, 4 );                               /* Q10 -> Q14 */
+
+        /* Noise shape feedback. The allpass chain is serial, so it runs with one state per */
+        /* 64-bit lane where a single _mm256_mul_epi32() does silk_SMULWB() for all states. */
+        /* Output of lowpass section */
+        prev = _mm256_cvtepi32_epi64( _mm_loadu_si128( (const __m128i *)psDelDec->sAR2_Q14[ 0 ] ) );
+        tmp2 = _mm256_add_epi32( _mm256_cvtepi32_epi64( Diff_Q14 ), silk_SMULWB_epi64x4( prev, warping ) );
+        /* Output of allpass section */
+        t    = _mm256_cvtepi32_epi64( _mm_loadu_si128( (const __m128i *)psDelDec->sAR2_Q14[ 1 ] ) );
+        tmp1 = _mm256_add_epi32( prev, silk_SMULWB_epi64x4( _mm256_sub_epi32( t, tmp2 ), warping ) );
+        prev = t;
+        _mm_storeu_si128( (__m128i *)psDelDec->sAR2_Q14[ 0 ], silk_pack_epi64x4( tmp2 ) );
+        n_AR = silk_SMULWB_epi64x4( tmp2, _mm256_set1_epi32( AR_shp_Q13_32[ 0 ] ) );
+        /* Loop over allpass sections */
+        for( j = 2; j < shapingLPCOrder; j += 2 ) {
+            /* Output of allpass section */
+            t    = _mm256_cvtepi32_epi64( _mm_loadu_si128( (const __m128i *)psDelDec->sAR2_Q14[ j ] ) );
+            tmp2 = _mm256_add_epi32( prev, silk_SMULWB_epi64x4( _mm256_sub_epi32( t, tmp1 ), warping ) );
+            prev = t;
+            _mm_storeu_si128( (__m128i *)psDelDec->sAR2_Q14[ j - 1 ], silk_pack_epi64x4( tmp1 ) );
+            n_AR = _mm256_add_epi32( n_AR, silk_SMULWB_epi64x4( tmp1, _mm256_set1_epi32( AR_shp_Q13_32[ j - 1 ] ) ) );
+            /* Output of allpass section */
+            t    = _mm256_cvtepi32_epi64( _mm_loadu_si128( (const __m128i *)psDelDec->sAR2_Q14[ j + 1 ] ) );
+            tmp1 = _mm256_add_epi32( prev, silk_SMULWB_epi64x4( _mm256_sub_epi32( t, tmp2 ), warping ) );
+            prev = t;
+            _mm_storeu_si128( (__m128i *)psDelDec->sAR2_Q14[ j ], silk_pack_epi64x4( tmp2 ) );
+            n_AR = _mm256_add_epi32( n_AR, silk_SMULWB_epi64x4( tmp2, _mm256_set1_epi32( AR_shp_Q13_32[ j ] ) ) );
+        }
+        _mm_storeu_si128( (__m128i *)psDelDec->sAR2_Q14[ shapingLPCOrder - 1 ], silk_pack_epi64x4( tmp1 ) );
+        n_AR = _mm256_add_epi32( n_AR, silk_SMULWB_epi64x4( tmp1, _mm256_set1_epi32( AR_shp_Q13_32[ shapingLPCOrder - 1 ] ) ) );
+
+        t    = _mm256_cvtepi32_epi64( LF_AR_Q14 );
+        n_AR = _mm256_add_epi32( n_AR, _mm256_set1_epi32( silk_RSHIFT( shapingLPCOrder, 1 ) ) );
+        n_AR = _mm256_slli_epi32( n_AR, 1 );                                            /* Q11 -> Q12 */
+        n_AR = _mm256_add_epi32( n_AR, silk_SMULWB_epi64x4( t, Tilt ) );                /* Q12 */
+        n_AR_Q14 = _mm_slli_epi32( silk_pack_epi64x4( n_AR ), 2 );                      /* Q12 -> Q14 */
+
+        n_LF = silk_SMULWB_epi64x4( _mm256_cvtepi32_epi64(
+            _mm_loadu_si128( (const __m128i *)psDelDec->Shape_Q14[ *smpl_buf_idx ] ) ), LF_shp_lo );     /* Q12 */
+        n_LF = _mm256_add_epi32( n_LF, silk_SMULWB_epi64x4( t, LF_shp_hi ) );          /* Q12 */
+        n_LF_Q14 = _mm_slli_epi32( silk_pack_epi64x4( n_LF ), 2 );                      /* Q12 -> Q14 */
+
+        /* Input minus prediction plus noise feedback                       */
+        /* r = x[ i ] - LTP_pred - LPC_pred + n_AR + n_Tilt + n_LF + n_LTP  */
+        r_Q10 = silk_ADD_SAT32_epi32( n_AR_Q14, n_LF_Q14 );                             /* Q14 */
+        r_Q10 = silk_SUB_SAT32_epi32( _mm_add_epi32( _mm_set1_epi32( n_LTP_Q14 ), LPC_pred_Q14 ), r_Q10 ); /* Q13 */
+        r_Q10 = _mm_srai_epi32( _mm_add_epi32( _mm_srai_epi32( r_Q10, 3 ), _mm_set1_epi32( 1 ) ), 1 );     /* Q10 */
+        r_Q10 = _mm_sub_epi32( _mm_set1_epi32( x_Q10[ i ] ), r_Q10 );                   /* residual error Q10 */
+
+        /* Flip sign depending on dither */
+        sign  = _mm_srai_epi32( Seed, 31 );
+        r_Q10 = _mm_sub_epi32( _mm_xor_si128( r_Q10, sign ), sign );
+        r_Q10 = _mm_max_epi32( _mm_min_epi32( r_Q10, _mm_set1_epi32( 30 << 10 ) ), _mm_set1_epi32( -( 31 << 10 ) ) );
+
+        /* Find two quantization level candidates and measure their rate-distortion */
+        q1_Q10 = _mm_sub_epi32( r_Q10, _mm_set1_epi32( offset_Q10 ) );
+        q1_Q0  = _mm_srai_epi32( q1_Q10, 10 );
+        if( Lambda_Q10 > 2048 ) {
+            /* For aggressive RDO, the bias becomes more than one pulse. */
+            const opus_int32 rdo_offset = Lambda_Q10/2 - 512;
+            q1_Q0 = _mm_srai_epi32( q1_Q10, 31 );
+            mask  = _mm_cmpgt_epi32( q1_Q10, _mm_set1_epi32( rdo_offset ) );
+            q1_Q0 = _mm_blendv_epi8( q1_Q0, _mm_srai_epi32( _mm_sub_epi32( q1_Q10, _mm_set1_epi32( rdo_offset ) ), 10 ), mask );
+            mask  = _mm_cmplt_epi32( q1_Q10, _mm_set1_epi32( -rdo_offset ) );
+            q1_Q0 = _mm_blendv_epi8( q1_Q0, _mm_srai_epi32( _mm_add_epi32( q1_Q10, _mm_set1_epi32( rdo_offset ) ), 10 ), mask );
+        }
+        lt0  = _mm_srai_epi32( q1_Q0, 31 );
+        eq0  = _mm_cmpeq_epi32( q1_Q0, _mm_setzero_si128() );
+        eqm1 = _mm_cmpeq_epi32( q1_Q0, _mm_set1_epi32( -1 ) );
+        ltm1 = _mm_cmplt_epi32( q1_Q0, _mm_set1_epi32( -1 ) );
+        /* q1_Q0 << 10 + offset_Q10 -/+ QUANT_LEVEL_ADJUST_Q10, which is the q1_Q0 == -1 level too */
+        q1_Q10 = _mm_sub_epi32( _mm_xor_si128( _mm_set1_epi32( -QUANT_LEVEL_ADJUST_Q10 ), lt0 ), lt0 );
+        q1_Q10 = _mm_add_epi32( q1_Q10, _mm_add_epi32( _mm_slli_epi32( q1_Q0, 10 ), _mm_set1_epi32( offset_Q10 ) ) );
+        q2_Q10 = _mm_add_epi32( q1_Q10, _mm_set1_epi32( 1024 ) );
+        q1_Q10 = _mm_blendv_epi8( q1_Q10, _mm_set1_epi32( offset_Q10 ), eq0 );
+        q2_Q10 = _mm_blendv_epi8( q2_Q10, _mm_set1_epi32( offset_Q10 ), eqm1 );
+
+        /* Both candidates side by side: rate of -q for negative levels, plus squared error */
+        Q_Q10 = _mm256_set_m128i( q2_Q10, q1_Q10 );
+        t     = _mm256_set_m128i( ltm1, lt0 );
+        RD_pair = silk_SMULBB_epi32x8( _mm256_sub_epi32( _mm256_xor_si256( Q_Q10, t ), t ), Lambda );
+        t     = _mm256_sub_epi32( _mm256_set_m128i( r_Q10, r_Q10 ), Q_Q10 );
+        RD_pair = _mm256_srai_epi32( _mm256_add_epi32( RD_pair, silk_SMULBB_epi32x8( t, t ) ), 10 );
+        rd1_Q10 = _mm256_castsi256_si128( RD_pair );
+        rd2_Q10 = _mm256_extracti128_si256( RD_pair, 1 );
+
+        /* The better candidate goes to the low half */
+        first   = _mm_cmplt_epi32( rd1_Q10, rd2_Q10 );
+        RD_pair = _mm256_add_epi32( _mm256_set_m128i( RD_Q10, RD_Q10 ),
+            _mm256_set_m128i( _mm_max_epi32( rd1_Q10, rd2_Q10 ), _mm_min_epi32( rd1_Q10, rd2_Q10 ) ) );
+        Q_Q10   = _mm256_set_m128i( _mm_blendv_epi8( q1_Q10, q2_Q10, first ), _mm_blendv_epi8( q2_Q10, q1_Q10, first ) );
+
+        /* Update states for both quantizations */
+
+        /* Quantized excitation */
+        sign_pair   = _mm256_set_m128i( sign, sign );
+        t           = _mm256_slli_epi32( Q_Q10, 4 );
+        t           = _mm256_sub_epi32( _mm256_xor_si256( t, sign_pair ), sign_pair );
+
+        /* Add predictions */
+        LPC_exc_Q14 = _mm256_add_epi32( t, _mm256_set1_epi32( LTP_pred_Q14 ) );
+        xq_Q14      = _mm256_add_epi32( LPC_exc_Q14, _mm256_set_m128i( LPC_pred_Q14, LPC_pred_Q14 ) );
+
+        /* Update states */
+        Diff_pair    = _mm256_sub_epi32( xq_Q14, _mm256_set1_epi32( silk_LSHIFT32( x_Q10[ i ], 4 ) ) );
+        LF_AR_pair   = _mm256_sub_epi32( Diff_pair, _mm256_set_m128i( n_AR_Q14, n_AR_Q14 ) );
+        sLTP_shp_Q14 = silk_SUB_SAT32_epi32x8( LF_AR_pair, _mm256_set_m128i( n_LF_Q14, n_LF_Q14 ) );
+
+        *smpl_buf_idx  = *smpl_buf_idx ? ( *smpl_buf_idx - 1 ) : ( DECISION_DELAY - 1 );
+        last_smple_idx = *smpl_buf_idx + decisionDelay;
+        if( last_smple_idx >= DECISION_DELAY ) last_smple_idx -= DECISION_DELAY;
+
+        /* Find winner */
+        Winner_ind = silk_argmin_epi32( _mm_blendv_epi8( _mm256_castsi256_si128( RD_pair ), _mm_set1_epi32( silk_int32_MAX ), unused ) );
+
+        /* Increase RD values of expired states */
+        Winner_rand_state = psDelDec->RandState[ last_smple_idx ][ Winner_ind ];
+        mask = _mm_cmpeq_epi32( _mm_loadu_si128( (const __m128i *)psDelDec->RandState[ last_smple_idx ] ),
+                                _mm_set1_epi32( Winner_rand_state ) );
+        mask = _mm_andnot_si128( mask, _mm_set1_epi32( silk_int32_MAX >> 4 ) );
+        RD_pair = _mm256_add_epi32( RD_pair, _mm256_set_m128i( mask, mask ) );
+
+        /* Find worst in first set and best in second set */
+        rd1_Q10 = _mm256_castsi256_si128( RD_pair );
+        rd2_Q10 = _mm256_extracti128_si256( RD_pair, 1 );
+        RDmax_ind = silk_argmax_epi32( _mm_blendv_epi8( rd1_Q10, _mm_set1_epi32( silk_int32_MIN ), unused ) );
+        RDmin_ind = silk_argmin_epi32( _mm_blendv_epi8( rd2_Q10, _mm_set1_epi32( silk_int32_MAX ), unused ) );
+
+        /* Replace a state if best from second set outperforms worst in first set */
+        sel = identity;
+        _mm256_storeu_si256( (__m256i *)RD_buf, RD_pair );
+        if( RD_buf[ RDmin_ind + 4 ] < RD_buf[ RDmax_ind ] ) {
+            __m256i row_perm;
+            _mm256_storeu_si256( (__m256i *)perm, identity );
+            perm[ RDmax_ind ] = RDmin_ind;
+            perm[ RDmax_ind + 4 ] = RDmin_ind + 4;
+            row_perm = _mm256_loadu_si256( (const __m256i *)perm );
+            /* Only rows i + 1 to i + NSQ_LPC_BUF_LENGTH - 1 of sLPC_Q14 are read again */
+            silk_permute_rows_avx2( &psDelDec->sLPC_Q14[ i ], NSQ_LPC_BUF_LENGTH, row_perm );
+            silk_permute_rows_avx2( psDelDec->RandState, DECISION_DELAY, row_perm );
+            silk_permute_rows_avx2( psDelDec->Q_Q10,     DECISION_DELAY, row_perm );
+            silk_permute_rows_avx2( psDelDec->Xq_Q14,    DECISION_DELAY, row_perm );
+            silk_permute_rows_avx2( psDelDec->Pred_Q15,  DECISION_DELAY, row_perm );
+            silk_permute_rows_avx2( psDelDec->Shape_Q14, DECISION_DELAY, row_perm );
+            silk_permute_rows_avx2( psDelDec->sAR2_Q14, MAX_SHAPE_LPC_ORDER, row_perm );
+            silk_permute_rows_avx2( (opus_int32 (*)[ AVX2_MAX_DEL_DEC_STATES ])psDelDec->Seed, 2, row_perm );
+            Seed = _mm_castps_si128( _mm_permutevar_ps( _mm_castsi128_ps( Seed ), _mm256_castsi256_si128( row_perm ) ) );
+            /* The replaced state takes the second candidate of the best state */
+            perm[ RDmax_ind ] = RDmin_ind + 4;
+            sel = _mm256_loadu_si256( (const __m256i *)perm );
+        }
+
+        /* Write samples from winner to output and long-term filter states */
+        if( subfr > 0 || i >= decisionDelay ) {
+            pulses[  i - decisionDelay ] = (opus_int8)silk_RSHIFT_ROUND( psDelDec->Q_Q10[ last_smple_idx ][ Winner_ind ], 10 );
+            xq[ i - decisionDelay ] = (opus_int16)silk_SAT16( silk_RSHIFT_ROUND(
+                silk_SMULWW( psDelDec->Xq_Q14[ last_smple_idx ][ Winner_ind ], delayedGain_Q10[ last_smple_idx ] ), 8 ) );
+            NSQ->sLTP_shp_Q14[ NSQ->sLTP_shp_buf_idx - decisionDelay ] = psDelDec->Shape_Q14[ last_smple_idx ][ Winner_ind ];
+            sLTP_Q15[          NSQ->sLTP_buf_idx     - decisionDelay ] = psDelDec->Pred_Q15[  last_smple_idx ][ Winner_ind ];
+        }
+        NSQ->sLTP_shp_buf_idx++;
+        NSQ->sLTP_buf_idx++;
+
+        /* Update states */
+        LF_AR_Q14 = _mm256_castsi256_si128( _mm256_permutevar8x32_epi32( LF_AR_pair, sel ) );
+        Diff_Q14  = _mm256_castsi256_si128( _mm256_permutevar8x32_epi32( Diff_pair, sel ) );
+        RD_Q10    = _mm256_castsi256_si128( _mm256_permutevar8x32_epi32( RD_pair, sel ) );
+        q1_Q10    = _mm256_castsi256_si128( _mm256_permutevar8x32_epi32( Q_Q10, sel ) );
+        t         = _mm256_permutevar8x32_epi32( xq_Q14, sel );
+        _mm_storeu_si128( (__m128i *)psDelDec->sLPC_Q14[ NSQ_LPC_BUF_LENGTH + i ], _mm256_castsi256_si128( t ) );
+        _mm_storeu_si128( (__m128i *)psDelDec->Xq_Q14[ *smpl_buf_idx ], _mm256_castsi256_si128( t ) );
+        _mm_storeu_si128( (__m128i *)psDelDec->Q_Q10[ *smpl_buf_idx ], q1_Q10 );
+        t         = _mm256_permutevar8x32_epi32( LPC_exc_Q14, sel );
+        _mm_storeu_si128( (__m128i *)psDelDec->Pred_Q15[ *smpl_buf_idx ], _mm_slli_epi32( _mm256_castsi256_si128( t ), 1 ) );
+        t         = _mm256_permutevar8x32_epi32( sLTP_shp_Q14, sel );
+        _mm_storeu_si128( (__m128i *)psDelDec->Shape_Q14[ *smpl_buf_idx ], _mm256_castsi256_si128( t ) );
+        Seed      = _mm_add_epi32( Seed, _mm_srai_epi32( _mm_add_epi32( _mm_srai_epi32( q1_Q10, 9 ), _mm_set1_epi32( 1 ) ), 1 ) );
+        _mm_storeu_si128( (__m128i *)psDelDec->RandState[ *smpl_buf_idx ], Seed );
+        delayedGain_Q10[ *smpl_buf_idx ] = Gain_Q10;
+    }
+
+    _mm_storeu_si128( (__m128i *)psDelDec->Seed, Seed );
+    _mm_storeu_si128( (__m128i *)psDelDec->RD_Q10, RD_Q10 );
+    _mm_storeu_si128( (__m128i *)psDelDec->LF_AR_Q14, LF_AR_Q14 );
+    _mm_storeu_si128( (__m128i *)psDelDec->Diff_Q14, Diff_Q14 );
+
+    /* Update LPC states */
+    silk_memcpy( psDelDec->sLPC_Q14[ 0 ], psDelDec->sLPC_Q14[ length ], NSQ_LPC_BUF_LENGTH * sizeof( psDelDec->sLPC_Q14[ 0 ] ) );
+}
+
+/* Copies the last decisionDelay samples of the winning state to the outputs */
+static OPUS_INLINE void silk_copy_winner_state_avx2(
+    const NSQ_del_decs_struct *psDelDec,
+    const opus_int            decisionDelay,
+    const opus_int            smpl_buf_idx,
+    const opus_int            Winner_ind,
+    const opus_int32          gain,
+    const opus_int            shift,
+    opus_int8                 *pulses,
+    opus_int16                *pxq,
+    silk_nsq_state            *NSQ
+)
+{
+    opus_int i, last_smple_idx;
+
+    last_smple_idx = smpl_buf_idx + decisionDelay;
+    if( last_smple_idx >= DECISION_DELAY ) last_smple_idx -= DECISION_DELAY;
+    for( i = 0; i < decisionDelay; i++ ) {
+        last_smple_idx = last_smple_idx ? ( last_smple_idx - 1 ) : ( DECISION_DELAY - 1 );
+        pulses[ i - decisionDelay ] = (opus_int8)silk_RSHIFT_ROUND( psDelDec->Q_Q10[ last_smple_idx ][ Winner_ind ], 10 );
+        pxq[ i - decisionDelay ] = (opus_int16)silk_SAT16( silk_RSHIFT_ROUND(
+            silk_SMULWW( psDelDec->Xq_Q14[ last_smple_idx ][ Winner_ind ], gain ), shift ) );
+        NSQ->sLTP_shp_Q14[ NSQ->sLTP_shp_buf_idx - decisionDelay + i ] = psDelDec->Shape_Q14[ last_smple_idx ][ Winner_ind ];
+    }
+}
+
+void silk_NSQ_del_dec_avx2(
+    const silk_encoder_state    *psEncC,                                    /* I    Encoder State                   */
+    silk_nsq_state              *NSQ,                                       /* I/O  NSQ state                       */
+    SideInfoIndices             *psIndices,                                 /* I/O  Quantization Indices            */
+    const opus_int16            x16[],                                      /* I    Input                           */
+    opus_int8                   pulses[],                                   /* O    Quantized pulse signal          */
+    const opus_int16            PredCoef_Q12[ 2 * MAX_LPC_ORDER ],          /* I    Short term prediction coefs     */
+    const opus_int16            LTPCoef_Q14[ LTP_ORDER * MAX_NB_SUBFR ],    /* I    Long term prediction coefs      */
+    const opus_int16            AR_Q13[ MAX_NB_SUBFR * MAX_SHAPE_LPC_ORDER ], /* I  Noise shaping coefs             */
+    const opus_int              HarmShapeGain_Q14[ MAX_NB_SUBFR ],          /* I    Long term shaping coefs         */
+    const opus_int              Tilt_Q14[ MAX_NB_SUBFR ],                   /* I    Spectral tilt                   */
+    const opus_int32            LF_shp_Q14[ MAX_NB_SUBFR ],                 /* I    Low frequency shaping coefs     */
+    const opus_int32            Gains_Q16[ MAX_NB_SUBFR ],                  /* I    Quantization step sizes         */
+    const opus_int              pitchL[ MAX_NB_SUBFR ],                     /* I    Pitch lags                      */
+    const opus_int              Lambda_Q10,                                 /* I    Rate/distortion tradeoff        */
+    const opus_int              LTP_scale_Q14                               /* I    LTP state scaling               */
+)
+{
+#ifdef OPUS_CHECK_ASM
+    silk_nsq_state NSQ_c;
+    SideInfoIndices psIndices_c;
+    opus_int8 pulses_c[ MAX_FRAME_LENGTH ];
+    const opus_int8 *const pulses_a = pulses;
+
+    silk_memcpy( &NSQ_c, NSQ, sizeof( NSQ_c ) );
+    silk_memcpy( &psIndices_c, psIndices, sizeof( psIndices_c ) );
+    silk_memcpy( pulses_c, pulses, sizeof( pulses_c ) );
+    silk_NSQ_del_dec_c( psEncC, &NSQ_c, &psIndices_c, x16, pulses_c, PredCoef_Q12, LTPCoef_Q14, AR_Q13, HarmShapeGain_Q14, Tilt_Q14, LF_shp_Q14, Gains_Q16,
+                       pitchL, Lambda_Q10, LTP_scale_Q14 );
+#endif
+
+    /* With 2 states or fewer most of the lanes would be idle, and more than 4 states do not fit */
+    if( ( psEncC->nStatesDelayedDecision > AVX2_MAX_DEL_DEC_STATES ) || ( psEncC->nStatesDelayedDecision <= 2 ) ) {
+        silk_NSQ_del_dec_c( psEncC, NSQ, psIndices, x16, pulses, PredCoef_Q12, LTPCoef_Q14, AR_Q13, HarmShapeGain_Q14,
+            Tilt_Q14, LF_shp_Q14, Gains_Q16, pitchL, Lambda_Q10, LTP_scale_Q14 );
+    } else {
+        opus_int            i, k, lag, start_idx, LSF_interpolation_flag, Winner_ind, subfr;
+        opus_int            smpl_buf_idx, decisionDelay;
+        const opus_int16    *A_Q12, *B_Q14, *AR_shp_Q13;
+        opus_int16          *pxq;
+        VARDECL( opus_int32, sLTP_Q15 );
+        VARDECL( opus_int16, sLTP );
+        opus_int32          HarmShapeFIRPacked_Q14;
+        opus_int            offset_Q10;
+        opus_int32          RDmin_Q10, Gain_Q10;
+        VARDECL( opus_int32, x_sc_Q10 );
+        VARDECL( opus_int32, delayedGain_Q10 );
+        VARDECL( NSQ_del_decs_struct, psDelDec );
+        SAVE_STACK;
+
+        /* Set unvoiced lag to the previous one, overwrite later for voiced */
+        lag = NSQ->lagPrev;
+
+        silk_assert( NSQ->prev_gain_Q16 != 0 );
+
+        /* Initialize delayed decision states */
+        ALLOC( psDelDec, 1, NSQ_del_decs_struct );
+        silk_memset( psDelDec, 0, sizeof( NSQ_del_decs_struct ) );
+        for( k = 0; k < psEncC->nStatesDelayedDecision; k++ ) {
+            psDelDec->SeedInit[ k ] = psDelDec->Seed[ k ] = ( k + psIndices->Seed ) & 3;
+        }
+        _mm_storeu_si128( (__m128i *)psDelDec->LF_AR_Q14, _mm_set1_epi32( NSQ->sLF_AR_shp_Q14 ) );
+        _mm_storeu_si128( (__m128i *)psDelDec->Diff_Q14, _mm_set1_epi32( NSQ->sDiff_shp_Q14 ) );
+        _mm_storeu_si128( (__m128i *)psDelDec->Shape_Q14[ 0 ], _mm_set1_epi32( NSQ->sLTP_shp_Q14[ psEncC->ltp_mem_length - 1 ] ) );
+        for( i = 0; i < NSQ_LPC_BUF_LENGTH; i++ ) {
+            _mm_storeu_si128( (__m128i *)psDelDec->sLPC_Q14[ i ], _mm_set1_epi32( NSQ->sLPC_Q14[ i ] ) );
+        }
+        for( i = 0; i < MAX_SHAPE_LPC_ORDER; i++ ) {
+            _mm_storeu_si128( (__m128i *)psDelDec->sAR2_Q14[ i ], _mm_set1_epi32( NSQ->sAR2_Q14[ i ] ) );
+        }
+
+        offset_Q10   = silk_Quantization_Offsets_Q10[ psIndices->signalType >> 1 ][ psIndices->quantOffsetType ];
+        smpl_buf_idx = 0; /* index of oldest samples */
+
+        decisionDelay = silk_min_int( DECISION_DELAY, psEncC->subfr_length );
+
+        /* For voiced frames limit the decision delay to lower than the pitch lag */
+        if( psIndices->signalType == TYPE_VOICED ) {
+            for( k = 0; k < psEncC->nb_subfr; k++ ) {
+                decisionDelay = silk_min_int( decisionDelay, pitchL[ k ] - LTP_ORDER / 2 - 1 );
+            }
+        } else {
+            if( lag > 0 ) {
+                decisionDelay = silk_min_int( decisionDelay, lag - LTP_ORDER / 2 - 1 );
+            }
+        }
+
+        if( psIndices->NLSFInterpCoef_Q2 == 4 ) {
+            LSF_interpolation_flag = 0;
+        } else {
+            LSF_interpolation_flag = 1;
+        }
+
+        ALLOC( sLTP_Q15, psEncC->ltp_mem_length + psEncC->frame_length, opus_int32 );
+        ALLOC( sLTP, psEncC->ltp_mem_length + psEncC->frame_length, opus_int16 );
+        ALLOC( x_sc_Q10, psEncC->subfr_length, opus_int32 );
+        ALLOC( delayedGain_Q10, DECISION_DELAY, opus_int32 );
+        /* Set up pointers to start of sub frame */
+        pxq                   = &NSQ->xq[ psEncC->ltp_mem_length ];
+        NSQ->sLTP_shp_buf_idx = psEncC->ltp_mem_length;
+        NSQ->sLTP_buf_idx     = psEncC->ltp_mem_length;
+        subfr = 0;
+        for( k = 0; k < psEncC->nb_subfr; k++ ) {
+            A_Q12      = &PredCoef_Q12[ ( ( k >> 1 ) | ( 1 - LSF_interpolation_flag ) ) * MAX_LPC_ORDER ];
+            B_Q14      = &LTPCoef_Q14[ k * LTP_ORDER           ];
+            AR_shp_Q13 = &AR_Q13[     k * MAX_SHAPE_LPC_ORDER ];
+
+            /* Noise shape parameters */
+            silk_assert( HarmShapeGain_Q14[ k ] >= 0 );
+            HarmShapeFIRPacked_Q14  =                          silk_RSHIFT( HarmShapeGain_Q14[ k ], 2 );
+            HarmShapeFIRPacked_Q14 |= silk_LSHIFT( (opus_int32)silk_RSHIFT( HarmShapeGain_Q14[ k ], 1 ), 16 );
+
+            NSQ->rewhite_flag = 0;
+            if( psIndices->signalType == TYPE_VOICED ) {
+                /* Voiced */
+                lag = pitchL[ k ];
+
+                /* Re-whitening */
+                if( ( k & ( 3 - silk_LSHIFT( LSF_interpolation_flag, 1 ) ) ) == 0 ) {
+                    if( k == 2 ) {
+                        /* RESET DELAYED DECISIONS */
+                        /* Find winner */
+                        __m128i RD_Q10;
+                        RDmin_Q10 = psDelDec->RD_Q10[ 0 ];
+                        Winner_ind = 0;
+                        for( i = 1; i < psEncC->nStatesDelayedDecision; i++ ) {
+                            if( psDelDec->RD_Q10[ i ] < RDmin_Q10 ) {
+                                RDmin_Q10 = psDelDec->RD_Q10[ i ];
+                                Winner_ind = i;
+                            }
+                        }
+                        psDelDec->RD_Q10[ Winner_ind ] -= ( silk_int32_MAX >> 4 );
+                        RD_Q10 = _mm_loadu_si128( (const __m128i *)psDelDec->RD_Q10 );
+                        RD_Q10 = _mm_add_epi32( RD_Q10, _mm_set1_epi32( silk_int32_MAX >> 4 ) );
+                        _mm_storeu_si128( (__m128i *)psDelDec->RD_Q10, RD_Q10 );
+
+                        /* Copy final part of signals from winner state to output and long-term filter states */
+                        silk_copy_winner_state_avx2( psDelDec, decisionDelay, smpl_buf_idx, Winner_ind, Gains_Q16[ 1 ], 14, pulses, pxq, NSQ );
+
+                        subfr = 0;
+                    }
+
+                    /* Rewhiten with new A coefs */
+                    start_idx = psEncC->ltp_mem_length - lag - psEncC->predictLPCOrder - LTP_ORDER / 2;
+                    celt_assert( start_idx > 0 );
+
+                    silk_LPC_analysis_filter( &sLTP[ start_idx ], &NSQ->xq[ start_idx + k * psEncC->subfr_length ],
+                        A_Q12, psEncC->ltp_mem_length - start_idx, psEncC->predictLPCOrder, psEncC->arch );
+
+                    NSQ->sLTP_buf_idx = psEncC->ltp_mem_length;
+                    NSQ->rewhite_flag = 1;
+                }
+            }
+
+            silk_nsq_del_dec_scale_states_avx2( psEncC, NSQ, psDelDec, x16, x_sc_Q10, sLTP, sLTP_Q15, k,
+                LTP_scale_Q14, Gains_Q16, pitchL, psIndices->signalType, decisionDelay );
+
+            silk_noise_shape_quantizer_del_dec_avx2( NSQ, psDelDec, psIndices->signalType, x_sc_Q10, pulses, pxq, sLTP_Q15,
+                delayedGain_Q10, A_Q12, B_Q14, AR_shp_Q13, lag, HarmShapeFIRPacked_Q14, Tilt_Q14[ k ], LF_shp_Q14[ k ],
+                Gains_Q16[ k ], Lambda_Q10, offset_Q10, psEncC->subfr_length, subfr++, psEncC->shapingLPCOrder,
+                psEncC->predictLPCOrder, psEncC->warping_Q16, psEncC->nStatesDelayedDecision, &smpl_buf_idx, decisionDelay );
+
+            x16    += psEncC->subfr_length;
+            pulses += psEncC->subfr_length;
+            pxq    += psEncC->subfr_length;
+        }
+
+        /* Find winner */
+        RDmin_Q10 = psDelDec->RD_Q10[ 0 ];
+        Winner_ind = 0;
+        for( k = 1; k < psEncC->nStatesDelayedDecision; k++ ) {
+            if( psDelDec->RD_Q10[ k ] < RDmin_Q10 ) {
+                RDmin_Q10 = psDelDec->RD_Q10[ k ];
+                Winner_ind = k;
+            }
+        }
+
+        /* Copy final part of signals from winner state to output and long-term filter states */
+        psIndices->Seed = psDelDec->SeedInit[ Winner_ind ];
+        Gain_Q10 = silk_RSHIFT32( Gains_Q16[ psEncC->nb_subfr - 1 ], 6 );
+        silk_copy_winner_state_avx2( psDelDec, decisionDelay, smpl_buf_idx, Winner_ind, Gain_Q10, 8, pulses, pxq, NSQ );
+
+        for( i = 0; i < NSQ_LPC_BUF_LENGTH; i++ ) {
+            NSQ->sLPC_Q14[ i ] = psDelDec->sLPC_Q14[ i ][ Winner_ind ];
+        }
+        for( i = 0; i < MAX_SHAPE_LPC_ORDER; i++ ) {
+            NSQ->sAR2_Q14[ i ] = psDelDec->sAR2_Q14[ i ][ Winner_ind ];
+        }
+
+        /* Update states */
+        NSQ->sLF_AR_shp_Q14 = psDelDec->LF_AR_Q14[ Winner_ind ];
+        NSQ->sDiff_shp_Q14  = psDelDec->Diff_Q14[ Winner_ind ];
+        NSQ->lagPrev        = pitchL[ psEncC->nb_subfr - 1 ];
+
+        /* Save quantized speech signal */
+        silk_memmove( NSQ->xq,           &NSQ->xq[           psEncC->frame_length ], psEncC->ltp_mem_length * sizeof( opus_int16 ) );
+        silk_memmove( NSQ->sLTP_shp_Q14, &NSQ->sLTP_shp_Q14[ psEncC->frame_length ], psEncC->ltp_mem_length * sizeof( opus_int32 ) );
+        RESTORE_STACK;
+    }
+
+#ifdef OPUS_CHECK_ASM
+    silk_assert( !memcmp( &NSQ_c, NSQ, sizeof( NSQ_c ) ) );
+    silk_assert( !memcmp( &psIndices_c, psIndices, sizeof( psIndices_c ) ) );
+    silk_assert( !memcmp( pulses_c, pulses_a, sizeof( pulses_c ) ) );
+#endif
+}
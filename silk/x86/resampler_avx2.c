@@ -0,0 +1,293 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+
+#include "SigProc_FIX.h"
+#include "resampler_private.h"
+
+/* silk_SMULWB() on eight lanes: floor( a * b / 65536 ), where b holds */
+/* 16-bit values and b_odd = b shuffled by _MM_SHUFFLE( 3, 3, 1, 1 ).   */
+static OPUS_INLINE __m256i silk_SMULWB_epi32x8( __m256i a, __m256i b, __m256i b_odd )
+{
+    __m256i even, odd;
+    even = _mm256_mul_epi32( a, b );
+    odd  = _mm256_mul_epi32( _mm256_shuffle_epi32( a, _MM_SHUFFLE( 3, 3, 1, 1 ) ), b_odd );
+    return _mm256_blend_epi16( _mm256_srli_epi64( even, 16 ), _mm256_slli_epi64( odd, 16 ), 0xCC );
+}
+
+static OPUS_INLINE __m128i silk_SMULWB_epi32( __m128i a, __m128i b, __m128i b_odd )
+{
+    __m128i even, odd;
+    even = _mm_mul_epi32( a, b );
+    odd  = _mm_mul_epi32( _mm_shuffle_epi32( a, _MM_SHUFFLE( 3, 3, 1, 1 ) ), b_odd );
+    return _mm_blend_epi16( _mm_srli_epi64( even, 16 ), _mm_slli_epi64( odd, 16 ), 0xCC );
+}
+
+static OPUS_INLINE __m128i silk_fold_epi32x8( __m256i x )
+{
+    return _mm_add_epi32( _mm256_castsi256_si128( x ), _mm256_extracti128_si256( x, 1 ) );
+}
+
+/* Sums the lanes of each of the four accumulators: { sum( x0 ), sum( x1 ), sum( x2 ), sum( x3 ) } */
+static OPUS_INLINE __m128i silk_hsum4_epi32( __m128i x0, __m128i x1, __m128i x2, __m128i x3 )
+{
+    return _mm_hadd_epi32( _mm_hadd_epi32( x0, x1 ), _mm_hadd_epi32( x2, x3 ) );
+}
+
+static OPUS_INLINE opus_int32 silk_hsum_epi32( __m128i x )
+{
+    x = _mm_hadd_epi32( x, x );
+    return _mm_cvtsi128_si32( _mm_hadd_epi32( x, x ) );
+}
+
+static OPUS_INLINE __m128i silk_IIR_FIR_madd( const opus_int16 *buf, opus_int32 index_Q16, const __m128i *coefs )
+{
+    return _mm_madd_epi16( _mm_loadu_si128( (const __m128i *)&buf[ index_Q16 >> 16 ] ),
+                           coefs[ silk_SMULWB( index_Q16 & 0xFFFF, 12 ) ] );
+}
+
+/* Output samples n and n + 4 of a block of eight, in the two 128-bit lanes */
+static OPUS_INLINE __m256i silk_IIR_FIR_madd_x2( const opus_int16 *buf, opus_int32 index_Q16,
+                                                 opus_int32 index_increment_Q16, const __m128i *coefs )
+{
+    opus_int32 index2_Q16;
+    __m256i    x, c;
+    index2_Q16 = index_Q16 + 4 * index_increment_Q16;
+    x = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( (const __m128i *)&buf[ index_Q16 >> 16 ] ) ),
+                                 _mm_loadu_si128( (const __m128i *)&buf[ index2_Q16 >> 16 ] ), 1 );
+    c = _mm256_inserti128_si256( _mm256_castsi128_si256( coefs[ silk_SMULWB( index_Q16 & 0xFFFF, 12 ) ] ),
+                                 coefs[ silk_SMULWB( index2_Q16 & 0xFFFF, 12 ) ], 1 );
+    return _mm256_madd_epi16( x, c );
+}
+
+opus_int16 *silk_resampler_private_IIR_FIR_INTERPOL_avx2(
+    opus_int16          *out,
+    const opus_int16    *buf,
+    opus_int32          max_index_Q16,
+    opus_int32          index_increment_Q16
+)
+{
+    opus_int32 index_Q16;
+    opus_int   t;
+    __m128i    coefs[ 12 ], c0, c1, res;
+    __m256i    x0, x1, x2, x3, res8;
+
+    /* All eight taps of each phase, the second half being the mirrored phase */
+    for( t = 0; t < 12; t++ ) {
+        c0 = _mm_loadl_epi64( (const __m128i *)silk_resampler_frac_FIR_12[ t ] );
+        c1 = _mm_loadl_epi64( (const __m128i *)silk_resampler_frac_FIR_12[ 11 - t ] );
+        coefs[ t ] = _mm_unpacklo_epi64( c0, _mm_shufflelo_epi16( c1, _MM_SHUFFLE( 0, 1, 2, 3 ) ) );
+    }
+
+    /* Eight output samples at a time */
+    for( index_Q16 = 0; index_Q16 + 7 * index_increment_Q16 < max_index_Q16; index_Q16 += 8 * index_increment_Q16 ) {
+        x0 = silk_IIR_FIR_madd_x2( buf, index_Q16,                           index_increment_Q16, coefs );
+        x1 = silk_IIR_FIR_madd_x2( buf, index_Q16 +     index_increment_Q16, index_increment_Q16, coefs );
+        x2 = silk_IIR_FIR_madd_x2( buf, index_Q16 + 2 * index_increment_Q16, index_increment_Q16, coefs );
+        x3 = silk_IIR_FIR_madd_x2( buf, index_Q16 + 3 * index_increment_Q16, index_increment_Q16, coefs );
+        res8 = _mm256_hadd_epi32( _mm256_hadd_epi32( x0, x1 ), _mm256_hadd_epi32( x2, x3 ) );
+
+        /* silk_SAT16( silk_RSHIFT_ROUND( res_Q15, 15 ) ) */
+        res8 = _mm256_srai_epi32( _mm256_add_epi32( _mm256_srai_epi32( res8, 14 ), _mm256_set1_epi32( 1 ) ), 1 );
+        _mm_storeu_si128( (__m128i *)out, _mm_packs_epi32( _mm256_castsi256_si128( res8 ), _mm256_extracti128_si256( res8, 1 ) ) );
+        out += 8;
+    }
+    if( index_Q16 + 3 * index_increment_Q16 < max_index_Q16 ) {
+        res = silk_hsum4_epi32( silk_IIR_FIR_madd( buf, index_Q16,                           coefs ),
+                                silk_IIR_FIR_madd( buf, index_Q16 +     index_increment_Q16, coefs ),
+                                silk_IIR_FIR_madd( buf, index_Q16 + 2 * index_increment_Q16, coefs ),
+                                silk_IIR_FIR_madd( buf, index_Q16 + 3 * index_increment_Q16, coefs ) );
+        res = _mm_srai_epi32( _mm_add_epi32( _mm_srai_epi32( res, 14 ), _mm_set1_epi32( 1 ) ), 1 );
+        _mm_storel_epi64( (__m128i *)out, _mm_packs_epi32( res, res ) );
+        out += 4;
+        index_Q16 += 4 * index_increment_Q16;
+    }
+    for( ; index_Q16 < max_index_Q16; index_Q16 += index_increment_Q16 ) {
+        *out++ = (opus_int16)silk_SAT16( silk_RSHIFT_ROUND( silk_hsum_epi32( silk_IIR_FIR_madd( buf, index_Q16, coefs ) ), 15 ) );
+    }
+    return out;
+}
+
+/* Coefficients of one FIR phase: taps 0-15 in two 256-bit vectors, taps 16-19 in a 128-bit one */
+typedef struct {
+    __m256i c8[ 2 ], c8_odd[ 2 ];
+    __m128i c4, c4_odd;
+} silk_down_FIR_coefs;
+
+static OPUS_INLINE __m256i silk_reverse_epi32x8( __m256i x )
+{
+    return _mm256_permutevar8x32_epi32( x, _mm256_setr_epi32( 7, 6, 5, 4, 3, 2, 1, 0 ) );
+}
+
+static OPUS_INLINE void silk_down_FIR_coefs_init( silk_down_FIR_coefs *c, const opus_int32 *taps )
+{
+    opus_int k;
+    for( k = 0; k < 2; k++ ) {
+        c->c8[ k ] = _mm256_loadu_si256( (const __m256i *)&taps[ 8 * k ] );
+        c->c8_odd[ k ] = _mm256_shuffle_epi32( c->c8[ k ], _MM_SHUFFLE( 3, 3, 1, 1 ) );
+    }
+    c->c4 = _mm_loadu_si128( (const __m128i *)&taps[ 16 ] );
+    c->c4_odd = _mm_shuffle_epi32( c->c4, _MM_SHUFFLE( 3, 3, 1, 1 ) );
+}
+
+/* Accumulators for one output sample; their lanes sum to res_Q6 */
+static OPUS_INLINE __m128i silk_down_FIR0_acc( const opus_int32 *buf_ptr, const silk_down_FIR_coefs *c )
+{
+    __m256i acc;
+    acc = silk_SMULWB_epi32x8( _mm256_loadu_si256( (const __m256i *)&buf_ptr[ 0 ] ), c->c8[ 0 ], c->c8_odd[ 0 ] );
+    acc = _mm256_add_epi32( acc, silk_SMULWB_epi32x8( _mm256_loadu_si256( (const __m256i *)&buf_ptr[ 8 ] ), c->c8[ 1 ], c->c8_odd[ 1 ] ) );
+    return _mm_add_epi32( silk_fold_epi32x8( acc ),
+                          silk_SMULWB_epi32( _mm_loadl_epi64( (const __m128i *)&buf_ptr[ 16 ] ), c->c4, c->c4_odd ) );
+}
+
+static OPUS_INLINE __m128i silk_down_FIR1_acc( const opus_int32 *buf_ptr, const silk_down_FIR_coefs *c )
+{
+    __m256i sum8;
+    __m128i sum4;
+    sum8 = _mm256_add_epi32( _mm256_loadu_si256( (const __m256i *)&buf_ptr[ 0 ] ),
+                             silk_reverse_epi32x8( _mm256_loadu_si256( (const __m256i *)&buf_ptr[ 16 ] ) ) );
+    sum4 = _mm_add_epi32( _mm_loadu_si128( (const __m128i *)&buf_ptr[ 8 ] ),
+                          _mm_shuffle_epi32( _mm_loadu_si128( (const __m128i *)&buf_ptr[ 12 ] ), _MM_SHUFFLE( 0, 1, 2, 3 ) ) );
+    return _mm_add_epi32( silk_fold_epi32x8( silk_SMULWB_epi32x8( sum8, c->c8[ 0 ], c->c8_odd[ 0 ] ) ),
+                          silk_SMULWB_epi32( sum4, c->c4, c->c4_odd ) );
+}
+
+static OPUS_INLINE __m128i silk_down_FIR2_acc( const opus_int32 *buf_ptr, const silk_down_FIR_coefs *c )
+{
+    __m256i sum8, acc;
+    __m128i sum2;
+    sum8 = _mm256_add_epi32( _mm256_loadu_si256( (const __m256i *)&buf_ptr[ 0 ] ),
+                             silk_reverse_epi32x8( _mm256_loadu_si256( (const __m256i *)&buf_ptr[ 28 ] ) ) );
+    acc = silk_SMULWB_epi32x8( sum8, c->c8[ 0 ], c->c8_odd[ 0 ] );
+    sum8 = _mm256_add_epi32( _mm256_loadu_si256( (const __m256i *)&buf_ptr[ 8 ] ),
+                             silk_reverse_epi32x8( _mm256_loadu_si256( (const __m256i *)&buf_ptr[ 20 ] ) ) );
+    acc = _mm256_add_epi32( acc, silk_SMULWB_epi32x8( sum8, c->c8[ 1 ], c->c8_odd[ 1 ] ) );
+    /* Taps 16 and 17 pair with 19 and 18; the upper lanes are zero */
+    sum2 = _mm_add_epi32( _mm_loadl_epi64( (const __m128i *)&buf_ptr[ 16 ] ),
+                          _mm_shuffle_epi32( _mm_loadl_epi64( (const __m128i *)&buf_ptr[ 18 ] ), _MM_SHUFFLE( 3, 2, 0, 1 ) ) );
+    return _mm_add_epi32( silk_fold_epi32x8( acc ), silk_SMULWB_epi32( sum2, c->c4, c->c4_odd ) );
+}
+
+/* silk_SAT16( silk_RSHIFT_ROUND( res_Q6, 6 ) ) on four lanes, stored as 16 bits */
+static OPUS_INLINE void silk_down_FIR_store4( opus_int16 *out, __m128i res )
+{
+    res = _mm_srai_epi32( _mm_add_epi32( _mm_srai_epi32( res, 5 ), _mm_set1_epi32( 1 ) ), 1 );
+    _mm_storel_epi64( (__m128i *)out, _mm_packs_epi32( res, res ) );
+}
+
+opus_int16 *silk_resampler_private_down_FIR_INTERPOL_avx2(
+    opus_int16          *out,
+    const opus_int32    *buf,
+    const opus_int16    *FIR_Coefs,
+    opus_int            FIR_Order,
+    opus_int            FIR_Fracs,
+    opus_int32          max_index_Q16,
+    opus_int32          index_increment_Q16
+)
+{
+    opus_int32 index_Q16, interpol_ind;
+    opus_int   i, k;
+    opus_int32 taps[ 20 ];
+    silk_down_FIR_coefs coefs[ 3 ];
+    __m128i    x[ 4 ];
+
+    switch( FIR_Order ) {
+        case RESAMPLER_DOWN_ORDER_FIR0:
+            celt_assert( FIR_Fracs <= 3 );
+            /* Unfold each phase to 18 taps, the second half being the mirrored phase */
+            for( i = 0; i < FIR_Fracs; i++ ) {
+                for( k = 0; k < RESAMPLER_DOWN_ORDER_FIR0 / 2; k++ ) {
+                    taps[ k ] = FIR_Coefs[ RESAMPLER_DOWN_ORDER_FIR0 / 2 * i + k ];
+                    taps[ RESAMPLER_DOWN_ORDER_FIR0 - 1 - k ] = FIR_Coefs[ RESAMPLER_DOWN_ORDER_FIR0 / 2 * ( FIR_Fracs - 1 - i ) + k ];
+                }
+                taps[ 18 ] = taps[ 19 ] = 0;
+                silk_down_FIR_coefs_init( &coefs[ i ], taps );
+            }
+            for( index_Q16 = 0; index_Q16 + 3 * index_increment_Q16 < max_index_Q16; index_Q16 += 4 * index_increment_Q16 ) {
+                for( k = 0; k < 4; k++ ) {
+                    interpol_ind = silk_SMULWB( ( index_Q16 + k * index_increment_Q16 ) & 0xFFFF, FIR_Fracs );
+                    x[ k ] = silk_down_FIR0_acc( buf + silk_RSHIFT( index_Q16 + k * index_increment_Q16, 16 ), &coefs[ interpol_ind ] );
+                }
+                silk_down_FIR_store4( out, silk_hsum4_epi32( x[ 0 ], x[ 1 ], x[ 2 ], x[ 3 ] ) );
+                out += 4;
+            }
+            for( ; index_Q16 < max_index_Q16; index_Q16 += index_increment_Q16 ) {
+                interpol_ind = silk_SMULWB( index_Q16 & 0xFFFF, FIR_Fracs );
+                x[ 0 ] = silk_down_FIR0_acc( buf + silk_RSHIFT( index_Q16, 16 ), &coefs[ interpol_ind ] );
+                *out++ = (opus_int16)silk_SAT16( silk_RSHIFT_ROUND( silk_hsum_epi32( x[ 0 ] ), 6 ) );
+            }
+            break;
+        case RESAMPLER_DOWN_ORDER_FIR1:
+            /* Taps 0-7 in the 256-bit vector, 8-11 in the 128-bit one */
+            for( k = 0; k < RESAMPLER_DOWN_ORDER_FIR1 / 2; k++ ) {
+                taps[ k ] = FIR_Coefs[ k ];
+            }
+            for( ; k < 20; k++ ) {
+                taps[ k ] = 0;
+            }
+            silk_down_FIR_coefs_init( &coefs[ 0 ], taps );
+            coefs[ 0 ].c4 = _mm_loadu_si128( (const __m128i *)&taps[ 8 ] );
+            coefs[ 0 ].c4_odd = _mm_shuffle_epi32( coefs[ 0 ].c4, _MM_SHUFFLE( 3, 3, 1, 1 ) );
+            for( index_Q16 = 0; index_Q16 + 3 * index_increment_Q16 < max_index_Q16; index_Q16 += 4 * index_increment_Q16 ) {
+                for( k = 0; k < 4; k++ ) {
+                    x[ k ] = silk_down_FIR1_acc( buf + silk_RSHIFT( index_Q16 + k * index_increment_Q16, 16 ), &coefs[ 0 ] );
+                }
+                silk_down_FIR_store4( out, silk_hsum4_epi32( x[ 0 ], x[ 1 ], x[ 2 ], x[ 3 ] ) );
+                out += 4;
+            }
+            for( ; index_Q16 < max_index_Q16; index_Q16 += index_increment_Q16 ) {
+                x[ 0 ] = silk_down_FIR1_acc( buf + silk_RSHIFT( index_Q16, 16 ), &coefs[ 0 ] );
+                *out++ = (opus_int16)silk_SAT16( silk_RSHIFT_ROUND( silk_hsum_epi32( x[ 0 ] ), 6 ) );
+            }
+            break;
+        case RESAMPLER_DOWN_ORDER_FIR2:
+            for( k = 0; k < RESAMPLER_DOWN_ORDER_FIR2 / 2; k++ ) {
+                taps[ k ] = FIR_Coefs[ k ];
+            }
+            taps[ 18 ] = taps[ 19 ] = 0;
+            silk_down_FIR_coefs_init( &coefs[ 0 ], taps );
+            for( index_Q16 = 0; index_Q16 + 3 * index_increment_Q16 < max_index_Q16; index_Q16 += 4 * index_increment_Q16 ) {
+                for( k = 0; k < 4; k++ ) {
+                    x[ k ] = silk_down_FIR2_acc( buf + silk_RSHIFT( index_Q16 + k * index_increment_Q16, 16 ), &coefs[ 0 ] );
+                }
+                silk_down_FIR_store4( out, silk_hsum4_epi32( x[ 0 ], x[ 1 ], x[ 2 ], x[ 3 ] ) );
+                out += 4;
+            }
+            for( ; index_Q16 < max_index_Q16; index_Q16 += index_increment_Q16 ) {
+                x[ 0 ] = silk_down_FIR2_acc( buf + silk_RSHIFT( index_Q16, 16 ), &coefs[ 0 ] );
+                *out++ = (opus_int16)silk_SAT16( silk_RSHIFT_ROUND( silk_hsum_epi32( x[ 0 ] ), 6 ) );
+            }
+            break;
+        default:
+            celt_assert( 0 );
+    }
+    return out;
+}
@@ -50,7 +50,8 @@ opus_int64 (*const SILK_INNER_PROD16_ALIGNED_64_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_inner_prod16_aligned_64_c,
   silk_inner_prod16_aligned_64_c,
   MAY_HAVE_SSE4_1( silk_inner_prod16_aligned_64 ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_inner_prod16_aligned_64 )  /* avx */
+  MAY_HAVE_SSE4_1( silk_inner_prod16_aligned_64 ), /* avx */
+  MAY_HAVE_SSE4_1( silk_inner_prod16_aligned_64 )  /* avx2 */
 };
 
 #endif
@@ -63,7 +64,8 @@ opus_int (*const SILK_VAD_GETSA_Q8_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_VAD_GetSA_Q8_c,
   silk_VAD_GetSA_Q8_c,
   MAY_HAVE_SSE4_1( silk_VAD_GetSA_Q8 ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_VAD_GetSA_Q8 )  /* avx */
+  MAY_HAVE_SSE4_1( silk_VAD_GetSA_Q8 ), /* avx */
+  MAY_HAVE_SSE4_1( silk_VAD_GetSA_Q8 )  /* avx2 */
 };
 
 #if 0 /* FIXME: SSE disabled until the NSQ code gets updated. */
@@ -88,7 +90,8 @@ void (*const SILK_NSQ_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_NSQ_c,
   silk_NSQ_c,
   MAY_HAVE_SSE4_1( silk_NSQ ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_NSQ )  /* avx */
+  MAY_HAVE_SSE4_1( silk_NSQ ), /* avx */
+  MAY_HAVE_SSE4_1( silk_NSQ )  /* avx2 */
 };
 #endif
 
@@ -110,20 +113,84 @@ void (*const SILK_VQ_WMAT_EC_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_VQ_WMat_EC_c,
   silk_VQ_WMat_EC_c,
   MAY_HAVE_SSE4_1( silk_VQ_WMat_EC ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_VQ_WMat_EC )  /* avx */
+  MAY_HAVE_SSE4_1( silk_VQ_WMat_EC ), /* avx */
+  MAY_HAVE_SSE4_1( silk_VQ_WMat_EC )  /* avx2 */
 };
 #endif
 
-#if 0 /* FIXME: SSE disabled until the NSQ code gets updated. */
+#if defined(FIXED_POINT)
+
+void (*const SILK_BURG_MODIFIED_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    opus_int32                  *res_nrg,           /* O    Residual energy                                             */
+    opus_int                    *res_nrg_Q,         /* O    Residual energy Q value                                     */
+    opus_int32                  A_Q16[],            /* O    Prediction coefficients (length order)                      */
+    const opus_int16            x[],                /* I    Input signal, length: nb_subfr * ( D + subfr_length )       */
+    const opus_int32            minInvGain_Q30,     /* I    Inverse of max prediction gain                              */
+    const opus_int              subfr_length,       /* I    Input signal subframe length (incl. D preceding samples)    */
+    const opus_int              nb_subfr,           /* I    Number of subframes stacked in x                            */
+    const opus_int              D,                  /* I    Order                                                       */
+    int                         arch                /* I    Run-time architecture                                       */
+) = {
+  silk_burg_modified_c,                  /* non-sse */
+  silk_burg_modified_c,
+  silk_burg_modified_c,
+  MAY_HAVE_SSE4_1( silk_burg_modified ), /* sse4.1 */
+  MAY_HAVE_SSE4_1( silk_burg_modified ), /* avx */
+  MAY_HAVE_SSE4_1( silk_burg_modified )  /* avx2 */
+};
+
+#endif
+#endif
+
+#if defined(OPUS_HAVE_RTCD) && !defined(OPUS_X86_PRESUME_AVX2) && \
+ (!defined(OPUS_X86_PRESUME_SSE4_1) || defined(OPUS_X86_MAY_HAVE_AVX2))
+
+#include "resampler_private.h"
+
+opus_int16 *(*const SILK_RESAMPLER_PRIVATE_IIR_FIR_INTERPOL_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    opus_int16                      *out,           /* O    Output signal               */
+    const opus_int16                *buf,           /* I    Upsampled input signal      */
+    opus_int32                      max_index_Q16,  /* I    End of the input, Q16       */
+    opus_int32                      index_increment_Q16 /* I Input step per output, Q16 */
+) = {
+  silk_resampler_private_IIR_FIR_INTERPOL_c,                  /* non-sse */
+  silk_resampler_private_IIR_FIR_INTERPOL_c,
+  silk_resampler_private_IIR_FIR_INTERPOL_c,
+  MAY_HAVE_SSE4_1( silk_resampler_private_IIR_FIR_INTERPOL ), /* sse4.1 */
+  MAY_HAVE_SSE4_1( silk_resampler_private_IIR_FIR_INTERPOL ), /* avx */
+  MAY_HAVE_AVX2( silk_resampler_private_IIR_FIR_INTERPOL )    /* avx2 */
+};
+
+opus_int16 *(*const SILK_RESAMPLER_PRIVATE_DOWN_FIR_INTERPOL_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    opus_int16                      *out,           /* O    Output signal               */
+    const opus_int32                *buf,           /* I    Filtered input signal, Q8   */
+    const opus_int16                *FIR_Coefs,     /* I    FIR coefficients            */
+    opus_int                        FIR_Order,      /* I    FIR order                   */
+    opus_int                        FIR_Fracs,      /* I    Number of FIR phases        */
+    opus_int32                      max_index_Q16,  /* I    End of the input, Q16       */
+    opus_int32                      index_increment_Q16 /* I Input step per output, Q16 */
+) = {
+  silk_resampler_private_down_FIR_INTERPOL_c,                  /* non-sse */
+  silk_resampler_private_down_FIR_INTERPOL_c,
+  silk_resampler_private_down_FIR_INTERPOL_c,
+  MAY_HAVE_SSE4_1( silk_resampler_private_down_FIR_INTERPOL ), /* sse4.1 */
+  MAY_HAVE_SSE4_1( silk_resampler_private_down_FIR_INTERPOL ), /* avx */
+  MAY_HAVE_AVX2( silk_resampler_private_down_FIR_INTERPOL )    /* avx2 */
+};
+
+#endif
+
+#if defined(OPUS_HAVE_RTCD) && defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2)
+
 void (*const SILK_NSQ_DEL_DEC_IMPL[ OPUS_ARCHMASK + 1 ] )(
     const silk_encoder_state    *psEncC,                                    /* I    Encoder State                   */
     silk_nsq_state              *NSQ,                                       /* I/O  NSQ state                       */
     SideInfoIndices             *psIndices,                                 /* I/O  Quantization Indices            */
-    const opus_int32            x_Q3[],                                     /* I    Prefiltered input signal        */
+    const opus_int16            x16[],                                      /* I    Input                           */
     opus_int8                   pulses[],                                   /* O    Quantized pulse signal          */
     const opus_int16            PredCoef_Q12[ 2 * MAX_LPC_ORDER ],          /* I    Short term prediction coefs     */
     const opus_int16            LTPCoef_Q14[ LTP_ORDER * MAX_NB_SUBFR ],    /* I    Long term prediction coefs      */
-    const opus_int16            AR2_Q13[ MAX_NB_SUBFR * MAX_SHAPE_LPC_ORDER ], /* I Noise shaping coefs             */
+    const opus_int16            AR_Q13[ MAX_NB_SUBFR * MAX_SHAPE_LPC_ORDER ], /* I  Noise shaping coefs             */
     const opus_int              HarmShapeGain_Q14[ MAX_NB_SUBFR ],          /* I    Long term shaping coefs         */
     const opus_int              Tilt_Q14[ MAX_NB_SUBFR ],                   /* I    Spectral tilt                   */
     const opus_int32            LF_shp_Q14[ MAX_NB_SUBFR ],                 /* I    Low frequency shaping coefs     */
@@ -132,32 +199,96 @@ void (*const SILK_NSQ_DEL_DEC_IMPL[ OPUS_ARCHMASK + 1 ] )(
     const opus_int              Lambda_Q10,                                 /* I    Rate/distortion tradeoff        */
     const opus_int              LTP_scale_Q14                               /* I    LTP state scaling               */
 ) = {
-  silk_NSQ_del_dec_c,                  /* non-sse */
+  silk_NSQ_del_dec_c,                /* non-sse */
   silk_NSQ_del_dec_c,
   silk_NSQ_del_dec_c,
-  MAY_HAVE_SSE4_1( silk_NSQ_del_dec ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_NSQ_del_dec )  /* avx */
+  silk_NSQ_del_dec_c,                /* sse4.1 */
+  silk_NSQ_del_dec_c,                /* avx */
+  MAY_HAVE_AVX2( silk_NSQ_del_dec )  /* avx2 */
 };
+
 #endif
 
-#if defined(FIXED_POINT)
+#if defined(OPUS_HAVE_RTCD) && !defined(FIXED_POINT) && !defined(OPUS_X86_PRESUME_AVX2) && \
+ (defined(OPUS_X86_MAY_HAVE_SSE2) || defined(OPUS_X86_MAY_HAVE_AVX2)) && \
+ (!defined(OPUS_X86_PRESUME_SSE2) || defined(OPUS_X86_MAY_HAVE_AVX2))
 
-void (*const SILK_BURG_MODIFIED_IMPL[ OPUS_ARCHMASK + 1 ] )(
-    opus_int32                  *res_nrg,           /* O    Residual energy                                             */
-    opus_int                    *res_nrg_Q,         /* O    Residual energy Q value                                     */
-    opus_int32                  A_Q16[],            /* O    Prediction coefficients (length order)                      */
-    const opus_int16            x[],                /* I    Input signal, length: nb_subfr * ( D + subfr_length )       */
-    const opus_int32            minInvGain_Q30,     /* I    Inverse of max prediction gain                              */
-    const opus_int              subfr_length,       /* I    Input signal subframe length (incl. D preceding samples)    */
-    const opus_int              nb_subfr,           /* I    Number of subframes stacked in x                            */
-    const opus_int              D,                  /* I    Order                                                       */
-    int                         arch                /* I    Run-time architecture                                       */
+#include "float/main_FLP.h"
+
+double (*const SILK_INNER_PRODUCT_FLP_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    const silk_float    *data1,
+    const silk_float    *data2,
+    opus_int            dataSize
 ) = {
-  silk_burg_modified_c,                  /* non-sse */
-  silk_burg_modified_c,
-  silk_burg_modified_c,
-  MAY_HAVE_SSE4_1( silk_burg_modified ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_burg_modified )  /* avx */
+  silk_inner_product_FLP_c,                  /* non-sse */
+  silk_inner_product_FLP_c,
+  MAY_HAVE_SSE2( silk_inner_product_FLP ),
+  MAY_HAVE_SSE2( silk_inner_product_FLP ),   /* sse4.1 */
+  MAY_HAVE_SSE2( silk_inner_product_FLP ),   /* avx */
+  MAY_HAVE_AVX2( silk_inner_product_FLP )    /* avx2 */
+};
+
+double (*const SILK_ENERGY_FLP_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    const silk_float    *data,
+    opus_int            dataSize
+) = {
+  silk_energy_FLP_c,                         /* non-sse */
+  silk_energy_FLP_c,
+  MAY_HAVE_SSE2( silk_energy_FLP ),
+  MAY_HAVE_SSE2( silk_energy_FLP ),          /* sse4.1 */
+  MAY_HAVE_SSE2( silk_energy_FLP ),          /* avx */
+  MAY_HAVE_AVX2( silk_energy_FLP )           /* avx2 */
+};
+
+void (*const SILK_LPC_ANALYSIS_FILTER_FLP_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    silk_float          r_LPC[],            /* O    LPC residual signal         */
+    const silk_float    PredCoef[],         /* I    LPC coefficients            */
+    const silk_float    s[],                /* I    Input signal                */
+    const opus_int      length,             /* I    Length of input signal      */
+    const opus_int      Order               /* I    LPC order                   */
+) = {
+  silk_LPC_analysis_filter_FLP_c,                 /* non-sse */
+  silk_LPC_analysis_filter_FLP_c,
+  MAY_HAVE_SSE2( silk_LPC_analysis_filter_FLP ),
+  MAY_HAVE_SSE2( silk_LPC_analysis_filter_FLP ),  /* sse4.1 */
+  MAY_HAVE_SSE2( silk_LPC_analysis_filter_FLP ),  /* avx */
+  MAY_HAVE_AVX2( silk_LPC_analysis_filter_FLP )   /* avx2 */
+};
+
+void (*const SILK_P_ANA_NORM_CORR_ST3_FLP_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    silk_float          CC[][ PE_NB_STAGE3_LAGS ],          /* O    Correlation per contour and lag     */
+    const silk_float    cross_corr[][ PE_NB_STAGE3_CORRS ], /* I    Correlations from the lowest lag    */
+    const silk_float    energies[][ PE_NB_STAGE3_CORRS ],   /* I    Energies from the lowest lag        */
+    const opus_int8     *Lag_CB_ptr,        /* I    Lag contour codebook        */
+    const opus_int8     *Lag_range_ptr,     /* I    Lowest and highest lag      */
+    opus_int            cbk_size,           /* I    Size of the codebook        */
+    opus_int            nb_cbk_search,      /* I    Number of contours          */
+    opus_int            nb_subfr,           /* I    Number of subframes         */
+    double              energy_tgt          /* I    Target energy plus one      */
+) = {
+  silk_P_Ana_norm_corr_st3_FLP_c,                 /* non-sse */
+  silk_P_Ana_norm_corr_st3_FLP_c,
+  MAY_HAVE_SSE2( silk_P_Ana_norm_corr_st3_FLP ),
+  MAY_HAVE_SSE2( silk_P_Ana_norm_corr_st3_FLP ),  /* sse4.1 */
+  MAY_HAVE_SSE2( silk_P_Ana_norm_corr_st3_FLP ),  /* avx */
+  MAY_HAVE_AVX2( silk_P_Ana_norm_corr_st3_FLP )   /* avx2 */
+};
+
+#if defined(OPUS_X86_MAY_HAVE_AVX2)
+
+void (*const SILK_WARPED_AUTOCORRELATION_FLP_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    silk_float          *corr,              /* O    Result [order + 1]          */
+    const silk_float    *input,             /* I    Input data to correlate     */
+    const silk_float    warping,            /* I    Warping coefficient         */
+    const opus_int      length,             /* I    Length of input             */
+    const opus_int      order               /* I    Correlation order (even)    */
+) = {
+  silk_warped_autocorrelation_FLP_c,                  /* non-sse */
+  silk_warped_autocorrelation_FLP_c,
+  silk_warped_autocorrelation_FLP_c,
+  silk_warped_autocorrelation_FLP_c,                  /* sse4.1 */
+  silk_warped_autocorrelation_FLP_c,                  /* avx */
+  MAY_HAVE_AVX2( silk_warped_autocorrelation_FLP )    /* avx2 */
 };
 
 #endif
@@ -82,14 +82,20 @@ silk/x86/NSQ_sse4_1.c \
 silk/x86/NSQ_del_dec_sse4_1.c \
 silk/x86/x86_silk_map.c \
 silk/x86/VAD_sse4_1.c \
-silk/x86/VQ_WMat_EC_sse4_1.c
+silk/x86/VQ_WMat_EC_sse4_1.c \
+silk/x86/resampler_sse4_1.c
+
+SILK_SOURCES_AVX2 = \
+silk/x86/NSQ_del_dec_avx2.c \
+silk/x86/resampler_avx2.c
 
 SILK_SOURCES_ARM_NEON_INTR = \
 silk/arm/arm_silk_map.c \
 silk/arm/biquad_alt_neon_intr.c \
 silk/arm/LPC_inv_pred_gain_neon_intr.c \
 silk/arm/NSQ_del_dec_neon_intr.c \
-silk/arm/NSQ_neon.c
+silk/arm/NSQ_neon.c \
+silk/arm/resampler_neon_intr.c
 
 SILK_SOURCES_FIXED = \
 silk/fixed/LTP_analysis_filter_FIX.c \
@@ -152,3 +158,14 @@ silk/float/scale_copy_vector_FLP.c \
 silk/float/scale_vector_FLP.c \
 silk/float/schur_FLP.c \
 silk/float/sort_FLP.c
+
+SILK_SOURCES_FLOAT_SSE2 = \
+silk/float/x86/LPC_analysis_filter_FLP_sse2.c \
+silk/float/x86/pitch_analysis_core_FLP_sse2.c \
+silk/float/x86/vector_ops_FLP_sse2.c
+
+SILK_SOURCES_FLOAT_AVX2 = \
+silk/float/x86/LPC_analysis_filter_FLP_avx2.c \
+silk/float/x86/pitch_analysis_core_FLP_avx2.c \
+silk/float/x86/vector_ops_FLP_avx2.c \
+silk/float/x86/warped_autocorrelation_FLP_avx2.c
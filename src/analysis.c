@@ -929,9 +929,9 @@ static void tonality_analysis(TonalityAnalysisState *tonal, const CELTMode *celt
     features[23] = info->tonality_slope + 0.069216f;
     features[24] = tonal->lowECount - 0.067930f;
 
-    compute_dense(&layer0, layer_out, features);
-    compute_gru(&layer1, tonal->rnn_state, layer_out);
-    compute_dense(&layer2, frame_probs, tonal->rnn_state);
+    compute_dense(&layer0, layer_out, features, tonal->arch);
+    compute_gru(&layer1, tonal->rnn_state, layer_out, tonal->arch);
+    compute_dense(&layer2, frame_probs, tonal->rnn_state, tonal->arch);
 
     /* Probability of speech or music vs noise */
     info->activity_probability = frame_probs[1];
@@ -980,4 +980,37 @@ void run_analysis(TonalityAnalysisState *analysis, const CELTMode *celt_mode, co
    tonality_get_info(analysis, analysis_info, frame_size);
 }
 
+void run_shared_analysis(TonalityAnalysisState *analysis, TonalityAnalysisShare *share,
+                 const CELTMode *celt_mode, const void *analysis_pcm,
+                 int analysis_frame_size, int frame_size, int c1, int c2, int C, opus_int32 Fs,
+                 int lsb_depth, downmix_func downmix, AnalysisInfo *analysis_info)
+{
+   if (analysis_pcm != NULL)
+   {
+      const TonalityAnalysisState *src = share->source;
+      if (src != NULL && src != analysis && src->Fs == analysis->Fs
+            && share->analysis_frame_size == analysis_frame_size
+            && share->frame_size == frame_size && share->lsb_depth == lsb_depth)
+      {
+         /* Take everything but the read position, which only depends on
+            what this encoder already consumed. */
+         int read_pos = analysis->read_pos;
+         int read_subframe = analysis->read_subframe;
+         char *start = (char*)&analysis->TONALITY_ANALYSIS_RESET_START;
+         OPUS_COPY(start, (const char*)&src->TONALITY_ANALYSIS_RESET_START,
+               sizeof(TonalityAnalysisState) - (start - (char*)analysis));
+         analysis->read_pos = read_pos;
+         analysis->read_subframe = read_subframe;
+         analysis_pcm = NULL;
+      } else {
+         share->source = analysis;
+         share->analysis_frame_size = analysis_frame_size;
+         share->frame_size = frame_size;
+         share->lsb_depth = lsb_depth;
+      }
+   }
+   run_analysis(analysis, celt_mode, analysis_pcm, analysis_frame_size, frame_size,
+         c1, c2, C, Fs, lsb_depth, downmix, analysis_info);
+}
+
 #endif /* DISABLE_FLOAT_API */
@@ -80,6 +80,19 @@ typedef struct {
    AnalysisInfo info[DETECT_SIZE];
 } TonalityAnalysisState;
 
+/** Lets several encoders fed with the same input analyse it only once.
+ *
+ * The first encoder to analyse a frame records its state in source, and the
+ * others copy that state instead of running the analysis themselves. The
+ * owner clears source before each new frame.
+ */
+typedef struct {
+   const TonalityAnalysisState *source;
+   int analysis_frame_size;
+   int frame_size;
+   int lsb_depth;
+} TonalityAnalysisShare;
+
 /** Initialize a TonalityAnalysisState struct.
  *
  * This performs some possibly slow initialization steps which should
@@ -100,4 +113,12 @@ void run_analysis(TonalityAnalysisState *analysis, const CELTMode *celt_mode, co
                  int analysis_frame_size, int frame_size, int c1, int c2, int C, opus_int32 Fs,
                  int lsb_depth, downmix_func downmix, AnalysisInfo *analysis_info);
 
+/** Same as run_analysis(), but reuses the analysis of another encoder that
+ * already processed the same frame with the same parameters.
+ */
+void run_shared_analysis(TonalityAnalysisState *analysis, TonalityAnalysisShare *share,
+                 const CELTMode *celt_mode, const void *analysis_pcm,
+                 int analysis_frame_size, int frame_size, int c1, int c2, int C, opus_int32 Fs,
+                 int lsb_depth, downmix_func downmix, AnalysisInfo *analysis_info);
+
 #endif
@@ -0,0 +1,63 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif
+
+#include "../mlp.h"
+#include "mlp_arm.h"
+
+#if defined(OPUS_HAVE_RTCD)
+
+# if (defined(OPUS_ARM_MAY_HAVE_NEON_INTR) && \
+ !defined(OPUS_ARM_PRESUME_NEON_INTR))
+
+void (*const GEMM_ACCUM_IMPL[OPUS_ARCHMASK+1])(float *out,
+      const opus_int8 *weights, int rows, int cols, int col_stride, const float *x) = {
+      gemm_accum_c,    /* ARMv4 */
+      gemm_accum_c,    /* EDSP */
+      gemm_accum_c,    /* Media */
+      gemm_accum_neon, /* Neon */
+};
+
+void (*const VEC_TANSIG_IMPL[OPUS_ARCHMASK+1])(float *y, const float *x, int N) = {
+      vec_tansig_c,    /* ARMv4 */
+      vec_tansig_c,    /* EDSP */
+      vec_tansig_c,    /* Media */
+      vec_tansig_neon, /* Neon */
+};
+
+void (*const VEC_SIGMOID_IMPL[OPUS_ARCHMASK+1])(float *y, const float *x, int N) = {
+      vec_sigmoid_c,    /* ARMv4 */
+      vec_sigmoid_c,    /* EDSP */
+      vec_sigmoid_c,    /* Media */
+      vec_sigmoid_neon, /* Neon */
+};
+
+# endif
+
+#endif /* OPUS_HAVE_RTCD */
@@ -0,0 +1,145 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <arm_neon.h>
+#include "../mlp.h"
+#include "../tansig_table.h"
+#include "mlp_arm.h"
+
+static OPUS_INLINE float32x4_t cvt_s8_lo(int8x8_t w)
+{
+   return vcvtq_f32_s32(vmovl_s16(vget_low_s16(vmovl_s8(w))));
+}
+
+static OPUS_INLINE float32x4_t cvt_s8_hi(int8x8_t w)
+{
+   return vcvtq_f32_s32(vmovl_s16(vget_high_s16(vmovl_s8(w))));
+}
+
+/* Same operation order as gemm_accum_c(), with a separate multiply and add
+   for each input. */
+void gemm_accum_neon(float *out, const opus_int8 *weights, int rows, int cols, int col_stride, const float *x)
+{
+   int i, j;
+   for (i=0;i<rows-15;i+=16)
+   {
+      float32x4_t y0, y1, y2, y3;
+      y0 = vld1q_f32(&out[i]);
+      y1 = vld1q_f32(&out[i+4]);
+      y2 = vld1q_f32(&out[i+8]);
+      y3 = vld1q_f32(&out[i+12]);
+      for (j=0;j<cols;j++)
+      {
+         int8x16_t w;
+         float32x4_t xj;
+         xj = vdupq_n_f32(x[j]);
+         w = vld1q_s8(&weights[j*col_stride + i]);
+         y0 = vaddq_f32(y0, vmulq_f32(cvt_s8_lo(vget_low_s8(w)), xj));
+         y1 = vaddq_f32(y1, vmulq_f32(cvt_s8_hi(vget_low_s8(w)), xj));
+         y2 = vaddq_f32(y2, vmulq_f32(cvt_s8_lo(vget_high_s8(w)), xj));
+         y3 = vaddq_f32(y3, vmulq_f32(cvt_s8_hi(vget_high_s8(w)), xj));
+      }
+      vst1q_f32(&out[i], y0);
+      vst1q_f32(&out[i+4], y1);
+      vst1q_f32(&out[i+8], y2);
+      vst1q_f32(&out[i+12], y3);
+   }
+   for (;i<rows-7;i+=8)
+   {
+      float32x4_t y0, y1;
+      y0 = vld1q_f32(&out[i]);
+      y1 = vld1q_f32(&out[i+4]);
+      for (j=0;j<cols;j++)
+      {
+         int8x8_t w;
+         float32x4_t xj;
+         xj = vdupq_n_f32(x[j]);
+         w = vld1_s8(&weights[j*col_stride + i]);
+         y0 = vaddq_f32(y0, vmulq_f32(cvt_s8_lo(w), xj));
+         y1 = vaddq_f32(y1, vmulq_f32(cvt_s8_hi(w), xj));
+      }
+      vst1q_f32(&out[i], y0);
+      vst1q_f32(&out[i+4], y1);
+   }
+   if (i<rows)
+      gemm_accum_c(&out[i], &weights[i], rows-i, cols, col_stride, x);
+}
+
+/* Vector version of tansig_approx(), including its handling of the
+   saturated range and of NaNs (which map to 1). */
+static OPUS_INLINE float32x4_t tansig4_neon(float32x4_t x)
+{
+   uint32x4_t sign, inrange;
+   float32x4_t ax, xr, y, dy, one, sat;
+   int32x4_t idx;
+   opus_int32 ibuf[4];
+   one = vdupq_n_f32(1.f);
+   sign = vandq_u32(vcltq_f32(x, vdupq_n_f32(0.f)), vdupq_n_u32(0x80000000));
+   ax = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(x), sign));
+   inrange = vandq_u32(vcltq_f32(x, vdupq_n_f32(8.f)), vcgtq_f32(x, vdupq_n_f32(-8.f)));
+   ax = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(ax), inrange));
+   idx = vcvtq_s32_f32(vaddq_f32(vdupq_n_f32(.5f), vmulq_f32(vdupq_n_f32(25.f), ax)));
+   xr = vsubq_f32(ax, vmulq_f32(vdupq_n_f32(.04f), vcvtq_f32_s32(idx)));
+   vst1q_s32(ibuf, idx);
+   y = vdupq_n_f32(tansig_table[ibuf[0]]);
+   y = vsetq_lane_f32(tansig_table[ibuf[1]], y, 1);
+   y = vsetq_lane_f32(tansig_table[ibuf[2]], y, 2);
+   y = vsetq_lane_f32(tansig_table[ibuf[3]], y, 3);
+   dy = vsubq_f32(one, vmulq_f32(y, y));
+   y = vaddq_f32(y, vmulq_f32(vmulq_f32(xr, dy), vsubq_f32(one, vmulq_f32(y, xr))));
+   y = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(y), sign));
+   /* Out of range: x <= -8 gives -1, anything else (x >= 8 or NaN) gives 1. */
+   sat = vbslq_f32(vcleq_f32(x, vdupq_n_f32(-8.f)), vdupq_n_f32(-1.f), one);
+   return vbslq_f32(inrange, y, sat);
+}
+
+void vec_tansig_neon(float *y, const float *x, int N)
+{
+   int i;
+   for (i=0;i<N-3;i+=4)
+      vst1q_f32(&y[i], tansig4_neon(vld1q_f32(&x[i])));
+   if (i<N)
+      vec_tansig_c(&y[i], &x[i], N-i);
+}
+
+void vec_sigmoid_neon(float *y, const float *x, int N)
+{
+   int i;
+   float32x4_t half;
+   half = vdupq_n_f32(.5f);
+   for (i=0;i<N-3;i+=4)
+   {
+      float32x4_t t;
+      t = tansig4_neon(vmulq_f32(half, vld1q_f32(&x[i])));
+      vst1q_f32(&y[i], vaddq_f32(half, vmulq_f32(half, t)));
+   }
+   if (i<N)
+      vec_sigmoid_c(&y[i], &x[i], N-i);
+}
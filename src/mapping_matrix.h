@@ -81,6 +81,26 @@ void mapping_matrix_multiply_channel_out_float(
     int output_rows,
     int frame_size
 );
+
+void mapping_matrix_multiply_channel_in_planar_float(
+    const MappingMatrix *matrix,
+    const float * const *input,
+    int input_rows,
+    opus_val16 *output,
+    int output_row,
+    int output_rows,
+    int frame_size
+);
+
+void mapping_matrix_multiply_channel_out_planar_float(
+    const MappingMatrix *matrix,
+    const opus_val16 *input,
+    int input_row,
+    int input_rows,
+    float * const *output,
+    int output_rows,
+    int frame_size
+);
 #endif /* DISABLE_FLOAT_API */
 
 void mapping_matrix_multiply_channel_in_short(
@@ -103,6 +123,26 @@ void mapping_matrix_multiply_channel_out_short(
     int frame_size
 );
 
+void mapping_matrix_multiply_channel_in_planar_short(
+    const MappingMatrix *matrix,
+    const opus_int16 * const *input,
+    int input_rows,
+    opus_val16 *output,
+    int output_row,
+    int output_rows,
+    int frame_size
+);
+
+void mapping_matrix_multiply_channel_out_planar_short(
+    const MappingMatrix *matrix,
+    const opus_val16 *input,
+    int input_row,
+    int input_rows,
+    opus_int16 * const *output,
+    int output_rows,
+    int frame_size
+);
+
 /* Pre-computed mixing and demixing matrices for 1st to 3rd-order ambisonics.
  *   foa: first-order ambisonics
  *   soa: second-order ambisonics
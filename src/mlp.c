@@ -35,6 +35,25 @@
 #include "arch.h"
 #include "tansig_table.h"
 #include "mlp.h"
+#include "cpu_support.h"
+
+#if defined(OPUS_X86_MAY_HAVE_SSE4_1) || defined(OPUS_X86_MAY_HAVE_AVX2)
+#include "x86/mlp_sse.h"
+#endif
+
+#if defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+#include "arm/mlp_arm.h"
+#endif
+
+#ifndef OVERRIDE_GEMM_ACCUM
+#define gemm_accum(out, weights, rows, cols, col_stride, x, arch) \
+   ((void)(arch), gemm_accum_c(out, weights, rows, cols, col_stride, x))
+#endif
+
+#ifndef OVERRIDE_VEC_TANSIG
+#define vec_tansig(y, x, N, arch) ((void)(arch), vec_tansig_c(y, x, N))
+#define vec_sigmoid(y, x, N, arch) ((void)(arch), vec_sigmoid_c(y, x, N))
+#endif
 
 static OPUS_INLINE float tansig_approx(float x)
 {
@@ -69,7 +88,21 @@ static OPUS_INLINE float sigmoid_approx(float x)
    return .5f + .5f*tansig_approx(.5f*x);
 }
 
-static void gemm_accum(float *out, const opus_int8 *weights, int rows, int cols, int col_stride, const float *x)
+void vec_tansig_c(float *y, const float *x, int N)
+{
+   int i;
+   for (i=0;i<N;i++)
+      y[i] = tansig_approx(x[i]);
+}
+
+void vec_sigmoid_c(float *y, const float *x, int N)
+{
+   int i;
+   for (i=0;i<N;i++)
+      y[i] = sigmoid_approx(x[i]);
+}
+
+void gemm_accum_c(float *out, const opus_int8 *weights, int rows, int cols, int col_stride, const float *x)
 {
    int i, j;
    for (i=0;i<rows;i++)
@@ -79,7 +112,7 @@ static void gemm_accum(float *out, const opus_int8 *weights, int rows, int cols,
    }
 }
 
-void compute_dense(const DenseLayer *layer, float *output, const float *input)
+void compute_dense(const DenseLayer *layer, float *output, const float *input, int arch)
 {
    int i;
    int N, M;
@@ -89,19 +122,16 @@ void compute_dense(const DenseLayer *layer, float *output, const float *input)
    stride = N;
    for (i=0;i<N;i++)
       output[i] = layer->bias[i];
-   gemm_accum(output, layer->input_weights, N, M, stride, input);
+   gemm_accum(output, layer->input_weights, N, M, stride, input, arch);
    for (i=0;i<N;i++)
       output[i] *= WEIGHTS_SCALE;
-   if (layer->sigmoid) {
-      for (i=0;i<N;i++)
-         output[i] = sigmoid_approx(output[i]);
-   } else {
-      for (i=0;i<N;i++)
-         output[i] = tansig_approx(output[i]);
-   }
+   if (layer->sigmoid)
+      vec_sigmoid(output, output, N, arch);
+   else
+      vec_tansig(output, output, N, arch);
 }
 
-void compute_gru(const GRULayer *gru, float *state, const float *input)
+void compute_gru(const GRULayer *gru, float *state, const float *input, int arch)
 {
    int i;
    int N, M;
@@ -116,28 +146,33 @@ void compute_gru(const GRULayer *gru, float *state, const float *input)
    /* Compute update gate. */
    for (i=0;i<N;i++)
       z[i] = gru->bias[i];
-   gemm_accum(z, gru->input_weights, N, M, stride, input);
-   gemm_accum(z, gru->recurrent_weights, N, N, stride, state);
+   gemm_accum(z, gru->input_weights, N, M, stride, input, arch);
+   gemm_accum(z, gru->recurrent_weights, N, N, stride, state, arch);
    for (i=0;i<N;i++)
-      z[i] = sigmoid_approx(WEIGHTS_SCALE*z[i]);
+      z[i] *= WEIGHTS_SCALE;
+   vec_sigmoid(z, z, N, arch);
 
    /* Compute reset gate. */
    for (i=0;i<N;i++)
       r[i] = gru->bias[N + i];
-   gemm_accum(r, &gru->input_weights[N], N, M, stride, input);
-   gemm_accum(r, &gru->recurrent_weights[N], N, N, stride, state);
+   gemm_accum(r, &gru->input_weights[N], N, M, stride, input, arch);
+   gemm_accum(r, &gru->recurrent_weights[N], N, N, stride, state, arch);
    for (i=0;i<N;i++)
-      r[i] = sigmoid_approx(WEIGHTS_SCALE*r[i]);
+      r[i] *= WEIGHTS_SCALE;
+   vec_sigmoid(r, r, N, arch);
 
    /* Compute output. */
    for (i=0;i<N;i++)
       h[i] = gru->bias[2*N + i];
    for (i=0;i<N;i++)
       tmp[i] = state[i] * r[i];
-   gemm_accum(h, &gru->input_weights[2*N], N, M, stride, input);
-   gemm_accum(h, &gru->recurrent_weights[2*N], N, N, stride, tmp);
+   gemm_accum(h, &gru->input_weights[2*N], N, M, stride, input, arch);
+   gemm_accum(h, &gru->recurrent_weights[2*N], N, N, stride, tmp, arch);
+   for (i=0;i<N;i++)
+      h[i] *= WEIGHTS_SCALE;
+   vec_tansig(h, h, N, arch);
    for (i=0;i<N;i++)
-      h[i] = z[i]*state[i] + (1-z[i])*tansig_approx(WEIGHTS_SCALE*h[i]);
+      h[i] = z[i]*state[i] + (1-z[i])*h[i];
    for (i=0;i<N;i++)
       state[i] = h[i];
 }
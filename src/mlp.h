@@ -53,8 +53,15 @@ extern const DenseLayer layer0;
 extern const GRULayer layer1;
 extern const DenseLayer layer2;
 
-void compute_dense(const DenseLayer *layer, float *output, const float *input);
+/* out[i] += sum_j weights[j*col_stride + i]*x[j] for 0 <= i < rows */
+void gemm_accum_c(float *out, const opus_int8 *weights, int rows, int cols, int col_stride, const float *x);
 
-void compute_gru(const GRULayer *gru, float *state, const float *input);
+void vec_tansig_c(float *y, const float *x, int N);
+
+void vec_sigmoid_c(float *y, const float *x, int N);
+
+void compute_dense(const DenseLayer *layer, float *output, const float *input, int arch);
+
+void compute_gru(const GRULayer *gru, float *state, const float *input, int arch);
 
 #endif /* _MLP_H_ */
@@ -51,15 +51,20 @@
 #include "define.h"
 #include "mathops.h"
 #include "cpu_support.h"
+#include "resample_44k1.h"
 
 struct OpusDecoder {
    int          celt_dec_offset;
    int          silk_dec_offset;
    int          channels;
-   opus_int32   Fs;          /** Sampling rate (at the API level) */
+   opus_int32   Fs;          /** Sampling rate the codec runs at */
+   opus_int32   api_Fs;      /** Sampling rate at the API level, 44100 or Fs */
    silk_DecControlStruct DecControl;
    int          decode_gain;
    int          arch;
+#ifdef ENABLE_PROFILE_STATS
+   OpusProfile  profile;
+#endif
 
    /* Everything beyond this point gets cleared on a reset */
 #define OPUS_DECODER_RESET_START stream_channels
@@ -76,6 +81,7 @@ struct OpusDecoder {
 #endif
 
    opus_uint32  rangeFinal;
+   Resample44k1State resampler; /* 48 -> 44.1 kHz, when api_Fs is 44100 */
 };
 
 #if defined(ENABLE_HARDENING) || defined(ENABLE_ASSERTIONS)
@@ -84,6 +90,8 @@ static void validate_opus_decoder(OpusDecoder *st)
    celt_assert(st->channels == 1 || st->channels == 2);
    celt_assert(st->Fs == 48000 || st->Fs == 24000 || st->Fs == 16000 || st->Fs == 12000 || st->Fs == 8000);
    celt_assert(st->DecControl.API_sampleRate == st->Fs);
+   celt_assert(st->api_Fs == st->Fs || (st->api_Fs == 44100 && st->Fs == 48000));
+   celt_assert(st->resampler.pos >= 0 && st->resampler.pos < 160);
    celt_assert(st->DecControl.internalSampleRate == 0 || st->DecControl.internalSampleRate == 16000 || st->DecControl.internalSampleRate == 12000 || st->DecControl.internalSampleRate == 8000);
    celt_assert(st->DecControl.nChannelsAPI == st->channels);
    celt_assert(st->DecControl.nChannelsInternal == 0 || st->DecControl.nChannelsInternal == 1 || st->DecControl.nChannelsInternal == 2);
@@ -113,13 +121,29 @@ int opus_decoder_get_size(int channels)
    return align(sizeof(OpusDecoder))+silkDecSizeBytes+celtDecSizeBytes;
 }
 
+int opus_decoder_get_scratch_size(int channels)
+{
+   if (channels<1 || channels > 2)
+      return 0;
+   /* Measured peak pseudostack usage over all rates and packet types,
+      including PLC and FEC, with a 120 ms output buffer: 29992/59156 bytes
+      in fixed point and 58660/113220 in floating point, for 120 ms frames
+      at 44.1 kHz. The peak depends on the packets, so 4 kB are added on
+      top of it before rounding up to 1 kB. */
+#ifdef FIXED_POINT
+   return channels == 1 ? 34816 : 63488;
+#else
+   return channels == 1 ? 63488 : 117760;
+#endif
+}
+
 int opus_decoder_init(OpusDecoder *st, opus_int32 Fs, int channels)
 {
    void *silk_dec;
    CELTDecoder *celt_dec;
    int ret, silkDecSizeBytes;
 
-   if ((Fs!=48000&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)
+   if ((Fs!=48000&&Fs!=44100&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)
     || (channels!=1&&channels!=2))
       return OPUS_BAD_ARG;
 
@@ -136,6 +160,10 @@ int opus_decoder_init(OpusDecoder *st, opus_int32 Fs, int channels)
    celt_dec = (CELTDecoder*)((char*)st+st->celt_dec_offset);
    st->stream_channels = st->channels = channels;
 
+   /* A 44.1 kHz output is decoded at 48 kHz and converted as the last step. */
+   st->api_Fs = Fs;
+   if (Fs == 44100)
+      Fs = 48000;
    st->Fs = Fs;
    st->DecControl.API_sampleRate = st->Fs;
    st->DecControl.nChannelsAPI      = st->channels;
@@ -160,7 +188,7 @@ OpusDecoder *opus_decoder_create(opus_int32 Fs, int channels, int *error)
 {
    int ret;
    OpusDecoder *st;
-   if ((Fs!=48000&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)
+   if ((Fs!=48000&&Fs!=44100&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)
     || (channels!=1&&channels!=2))
    {
       if (error)
@@ -217,6 +245,40 @@ static int opus_packet_get_mode(const unsigned char *data)
    return mode;
 }
 
+/* Last CELT band coded at the given audio bandwidth. */
+static int celt_end_band(int bandwidth)
+{
+   switch(bandwidth)
+   {
+   case OPUS_BANDWIDTH_NARROWBAND:
+      return 13;
+   case OPUS_BANDWIDTH_MEDIUMBAND:
+   case OPUS_BANDWIDTH_WIDEBAND:
+      return 17;
+   case OPUS_BANDWIDTH_SUPERWIDEBAND:
+      return 19;
+   case OPUS_BANDWIDTH_FULLBAND:
+      return 21;
+   default:
+      celt_assert(0);
+      return 21;
+   }
+}
+
+static void apply_decode_gain(const OpusDecoder *st, opus_val16 *pcm,
+      int frame_size)
+{
+   int i;
+   opus_val32 gain;
+   gain = celt_exp2(MULT16_16_P15(QCONST16(6.48814081e-4f, 25), st->decode_gain));
+   for (i=0;i<frame_size*st->channels;i++)
+   {
+      opus_val32 x;
+      x = MULT16_32_P16(pcm[i],gain);
+      pcm[i] = SATURATE(x, 32767);
+   }
+}
+
 static int opus_decode_frame(OpusDecoder *st, const unsigned char *data,
       opus_int32 len, opus_val16 *pcm, int frame_size, int decode_fec)
 {
@@ -399,8 +461,10 @@ static int opus_decode_frame(OpusDecoder *st, const unsigned char *data,
      do {
         /* Call SILK decoder */
         int first_frame = decoded_samples == 0;
+        PROFILE_START(&st->profile, OPUS_PROFILE_SILK_DECODE);
         silk_ret = silk_Decode( silk_dec, &st->DecControl,
                                 lost_flag, first_frame, &dec, pcm_ptr, &silk_frame_size, st->arch );
+        PROFILE_END(&st->profile, OPUS_PROFILE_SILK_DECODE);
         if( silk_ret ) {
            if (lost_flag) {
               /* PLC failure should not be fatal */
@@ -466,30 +530,7 @@ static int opus_decode_frame(OpusDecoder *st, const unsigned char *data,
 
 
    if (bandwidth)
-   {
-      int endband=21;
-
-      switch(bandwidth)
-      {
-      case OPUS_BANDWIDTH_NARROWBAND:
-         endband = 13;
-         break;
-      case OPUS_BANDWIDTH_MEDIUMBAND:
-      case OPUS_BANDWIDTH_WIDEBAND:
-         endband = 17;
-         break;
-      case OPUS_BANDWIDTH_SUPERWIDEBAND:
-         endband = 19;
-         break;
-      case OPUS_BANDWIDTH_FULLBAND:
-         endband = 21;
-         break;
-      default:
-         celt_assert(0);
-         break;
-      }
-      MUST_SUCCEED(celt_decoder_ctl(celt_dec, CELT_SET_END_BAND(endband)));
-   }
+      MUST_SUCCEED(celt_decoder_ctl(celt_dec, CELT_SET_END_BAND(celt_end_band(bandwidth))));
    MUST_SUCCEED(celt_decoder_ctl(celt_dec, CELT_SET_CHANNELS(st->stream_channels)));
 
    /* Only allocation memory for redundancy if/when needed */
@@ -593,16 +634,7 @@ static int opus_decode_frame(OpusDecoder *st, const unsigned char *data,
    }
 
    if(st->decode_gain)
-   {
-      opus_val32 gain;
-      gain = celt_exp2(MULT16_16_P15(QCONST16(6.48814081e-4f, 25), st->decode_gain));
-      for (i=0;i<frame_size*st->channels;i++)
-      {
-         opus_val32 x;
-         x = MULT16_32_P16(pcm[i],gain);
-         pcm[i] = SATURATE(x, 32767);
-      }
-   }
+      apply_decode_gain(st, pcm, frame_size);
 
    if (len <= 1)
       st->rangeFinal = 0;
@@ -623,7 +655,7 @@ static int opus_decode_frame(OpusDecoder *st, const unsigned char *data,
 
 }
 
-int opus_decode_native(OpusDecoder *st, const unsigned char *data,
+static int opus_decode_packet_native(OpusDecoder *st, const unsigned char *data,
       opus_int32 len, opus_val16 *pcm, int frame_size, int decode_fec,
       int self_delimited, opus_int32 *packet_offset, int soft_clip)
 {
@@ -675,12 +707,12 @@ int opus_decode_native(OpusDecoder *st, const unsigned char *data,
       int ret;
       /* If no FEC can be present, run the PLC (recursive call) */
       if (frame_size < packet_frame_size || packet_mode == MODE_CELT_ONLY || st->mode == MODE_CELT_ONLY)
-         return opus_decode_native(st, NULL, 0, pcm, frame_size, 0, 0, NULL, soft_clip);
+         return opus_decode_packet_native(st, NULL, 0, pcm, frame_size, 0, 0, NULL, soft_clip);
       /* Otherwise, run the PLC on everything except the size for which we might have FEC */
       duration_copy = st->last_packet_duration;
       if (frame_size-packet_frame_size!=0)
       {
-         ret = opus_decode_native(st, NULL, 0, pcm, frame_size-packet_frame_size, 0, 0, NULL, soft_clip);
+         ret = opus_decode_packet_native(st, NULL, 0, pcm, frame_size-packet_frame_size, 0, 0, NULL, soft_clip);
          if (ret<0)
          {
             st->last_packet_duration = duration_copy;
@@ -737,9 +769,371 @@ int opus_decode_native(OpusDecoder *st, const unsigned char *data,
    return nb_samples;
 }
 
+/* Decodes at 48 kHz and converts the result to 44.1 kHz. The number of
+   output samples is the one resample_44k1_down_size() gives for the 48 kHz
+   duration, which for frames that are not a multiple of 10 ms depends on
+   the phase left by the previous calls. frame_size is checked against it
+   exactly, so that a buffer sized with opus_decoder_get_nb_samples() is
+   always large enough. For PLC and FEC, the missing duration has to be a
+   multiple of 10 ms, and exactly frame_size samples are returned. */
+static int opus_decode_44k1(OpusDecoder *st, const unsigned char *data,
+      opus_int32 len, opus_val16 *pcm, int frame_size, int decode_fec,
+      int self_delimited, opus_int32 *packet_offset, int soft_clip)
+{
+   int N;
+   int ret;
+   VARDECL(opus_val16, out);
+   ALLOC_STACK;
+
+   if (decode_fec || len==0 || data==NULL)
+   {
+      if (frame_size%441 != 0)
+      {
+         RESTORE_STACK;
+         return OPUS_BAD_ARG;
+      }
+      N = frame_size/147*160;
+   } else {
+      N = opus_packet_get_nb_samples(data, len, st->Fs);
+      if (N<0)
+      {
+         RESTORE_STACK;
+         return N;
+      }
+      if (resample_44k1_down_size(&st->resampler, N) > frame_size)
+      {
+         RESTORE_STACK;
+         return OPUS_BUFFER_TOO_SMALL;
+      }
+   }
+   ALLOC(out, N*st->channels, opus_val16);
+   ret = opus_decode_packet_native(st, data, len, out, N, decode_fec,
+         self_delimited, packet_offset, soft_clip);
+   if (ret > 0)
+   {
+      PROFILE_START(&st->profile, OPUS_PROFILE_RESAMPLE);
+      ret = resample_44k1_down(&st->resampler, out, ret, pcm, st->channels, st->arch);
+      PROFILE_END(&st->profile, OPUS_PROFILE_RESAMPLE);
+      st->last_packet_duration = ret;
+   }
+   RESTORE_STACK;
+   return ret;
+}
+
+int opus_decode_native(OpusDecoder *st, const unsigned char *data,
+      opus_int32 len, opus_val16 *pcm, int frame_size, int decode_fec,
+      int self_delimited, opus_int32 *packet_offset, int soft_clip)
+{
+   int ret;
+#ifdef ENABLE_PROFILE_STATS
+   /* Pointers are not kept across calls, since the state may be moved. */
+   celt_decoder_ctl((CELTDecoder*)(void*)((char*)st+st->celt_dec_offset),
+         CELT_SET_PROFILE(&st->profile));
+#endif
+   PROFILE_START(&st->profile, OPUS_PROFILE_DECODE);
+   if (st->api_Fs != st->Fs)
+      ret = opus_decode_44k1(st, data, len, pcm, frame_size, decode_fec,
+            self_delimited, packet_offset, soft_clip);
+   else
+      ret = opus_decode_packet_native(st, data, len, pcm, frame_size, decode_fec,
+            self_delimited, packet_offset, soft_clip);
+   PROFILE_END(&st->profile, OPUS_PROFILE_DECODE);
+   return ret;
+}
+
+/* Orders the streams of a batch by the TOC configuration of their packet
+   (mode, bandwidth and frame size), with lost packets last, so that frames
+   with the same MDCT size and band layout end up in the same chunk of the
+   batched CELT synthesis. */
+static void batch_decode_order(const unsigned char * const *data,
+      const opus_int32 *len, int count, int *order)
+{
+   int hist[33];
+   int i, c, n;
+   OPUS_CLEAR(hist, 33);
+   for (i=0;i<count;i++)
+   {
+      c = (data[i] != NULL && len[i] > 0) ? data[i][0]>>3 : 32;
+      hist[c]++;
+   }
+   n = 0;
+   for (c=0;c<33;c++)
+   {
+      int tmp = hist[c];
+      hist[c] = n;
+      n += tmp;
+   }
+   for (i=0;i<count;i++)
+   {
+      c = (data[i] != NULL && len[i] > 0) ? data[i][0]>>3 : 32;
+      order[hist[c]++] = i;
+   }
+}
+
+/* The CELT frames of a batch are decoded in chunks: the spectra of all the
+   frames of a chunk are kept until their synthesis runs together. A chunk
+   holds at most BATCH_FREQ_SIZE spectrum values (eight 20 ms channels) and
+   BATCH_MAX_STREAMS frames. */
+#define BATCH_FREQ_SIZE (8*960)
+#define BATCH_MAX_STREAMS 16
+
+/* Streams are ordered and decoded this many at a time, so that the memory
+   a batch call needs does not depend on the size of the batch. */
+#define BATCH_WINDOW 64
+
+/* Returns the size of the spectrum needed to decode the packet through the
+   split CELT path, or 0 if it has to go through the general one. The split
+   path takes a single CELT-only frame at the native rate that follows
+   another CELT-only frame (or nothing), which is where no transition,
+   redundancy, SILK or resampling step has to run around the CELT decoder.
+   Lost packets, FEC and everything else are decoded on their own. */
+static int batch_celt_size(const OpusDecoder *st, const unsigned char *data,
+      opus_int32 len, int frame_size, int decode_fec)
+{
+   unsigned char toc;
+   opus_int16 size[48];
+   int offset;
+   int count;
+   int N;
+   if (decode_fec || data == NULL || len <= 0 || st->api_Fs != st->Fs)
+      return 0;
+   if (opus_packet_get_mode(data) != MODE_CELT_ONLY
+         || (st->prev_mode != 0 && st->prev_mode != MODE_CELT_ONLY))
+      return 0;
+   count = opus_packet_parse_impl(data, len, 0, &toc, NULL, size, &offset, NULL);
+   if (count != 1 || size[0] <= 1)
+      return 0;
+   N = opus_packet_get_samples_per_frame(data, st->Fs);
+   if (N > frame_size)
+      return 0;
+   return IMAX(st->channels, opus_packet_get_nb_channels(data))*N*(48000/st->Fs);
+}
+
+/* The part of opus_decode_native() before the CELT synthesis, for a packet
+   accepted by batch_celt_size(). */
+static int batch_celt_begin(OpusDecoder *st, const unsigned char *data,
+      opus_int32 len, celt_sig *freq, CELTSynthesis *syn, opus_uint32 *rng)
+{
+   CELTDecoder *celt_dec;
+   unsigned char toc;
+   opus_int16 size[48];
+   int offset;
+   int ret;
+   ec_dec dec;
+   VALIDATE_OPUS_DECODER(st);
+   celt_dec = (CELTDecoder*)((char*)st+st->celt_dec_offset);
+#ifdef ENABLE_PROFILE_STATS
+   celt_decoder_ctl(celt_dec, CELT_SET_PROFILE(&st->profile));
+#endif
+   PROFILE_START(&st->profile, OPUS_PROFILE_DECODE);
+   opus_packet_parse_impl(data, len, 0, &toc, NULL, size, &offset, NULL);
+   st->mode = MODE_CELT_ONLY;
+   st->bandwidth = opus_packet_get_bandwidth(data);
+   st->frame_size = opus_packet_get_samples_per_frame(data, st->Fs);
+   st->stream_channels = opus_packet_get_nb_channels(data);
+   data += offset;
+   ec_dec_init(&dec, (unsigned char*)data, size[0]);
+   MUST_SUCCEED(celt_decoder_ctl(celt_dec, CELT_SET_END_BAND(celt_end_band(st->bandwidth))));
+   MUST_SUCCEED(celt_decoder_ctl(celt_dec, CELT_SET_CHANNELS(st->stream_channels)));
+   MUST_SUCCEED(celt_decoder_ctl(celt_dec, CELT_SET_START_BAND(0)));
+   ret = celt_decode_spectrum(celt_dec, data, size[0], st->frame_size, &dec,
+         freq, syn);
+   *rng = dec.rng;
+   PROFILE_PAUSE(&st->profile, OPUS_PROFILE_DECODE);
+   return ret;
+}
+
+/* The part of opus_decode_native() after the CELT synthesis. */
+static int batch_celt_end(OpusDecoder *st, const CELTSynthesis *syn,
+      opus_uint32 rng, opus_val16 *pcm, int soft_clip)
+{
+   PROFILE_START(&st->profile, OPUS_PROFILE_DECODE);
+   if(st->decode_gain)
+      apply_decode_gain(st, pcm, st->frame_size);
+   st->rangeFinal = rng;
+   st->prev_mode = MODE_CELT_ONLY;
+   st->prev_redundancy = 0;
+   PROFILE_END(&st->profile, OPUS_PROFILE_DECODE);
+   if (syn->ret < 0)
+      return syn->ret;
+   st->last_packet_duration = syn->ret;
+#ifndef FIXED_POINT
+   if (soft_clip)
+      opus_pcm_soft_clip(pcm, syn->ret, st->channels, st->softclip_mem);
+   else
+      st->softclip_mem[0]=st->softclip_mem[1]=0;
+#else
+   (void)soft_clip;
+#endif
+   return syn->ret;
+}
+
+/* Decodes up to BATCH_WINDOW streams of a batch into int16 (float_api=0) or
+   float (float_api=1) buffers. The streams that batch_celt_size() rejects
+   go through opus_decode() or opus_decode_float() first, before any chunk
+   buffer is allocated. The other CELT frames are then decoded up to their
+   spectrum one after the other, and the synthesis of a whole chunk runs in
+   a single celt_decode_synthesis() call, with the IMDCTs and the
+   de-emphasis spread across streams. */
+static void opus_decode_batch_window(OpusDecoder * const *st,
+      const unsigned char * const *data, const opus_int32 *len,
+      void * const *pcm, int frame_size, int decode_fec, int *ret, int count,
+      int float_api)
+{
+   int i, j, k;
+   int n, used;
+   int nb_split;
+   int native_out;
+   int order[BATCH_WINDOW];
+   int need[BATCH_WINDOW];
+   VARDECL(celt_sig, freq);
+   VARDECL(CELTSynthesis, syn);
+   VARDECL(CELTDecoder *, celt_st);
+   VARDECL(opus_val16 *, out);
+   VARDECL(opus_uint32, rng);
+   VARDECL(int, idx);
+#ifdef ENABLE_PROFILE_STATS
+   opus_uint64 celt_ticks[BATCH_MAX_STREAMS];
+#endif
+   ALLOC_STACK;
+
+#ifdef FIXED_POINT
+   native_out = !float_api;
+#else
+   native_out = float_api;
+#endif
+   batch_decode_order(data, len, count, order);
+   nb_split = 0;
+   for (j=0;j<count;j++)
+   {
+      i = order[j];
+      need[nb_split] = batch_celt_size(st[i], data[i], len[i], frame_size, decode_fec);
+      if (need[nb_split])
+      {
+         order[nb_split++] = i;
+         continue;
+      }
+#ifndef DISABLE_FLOAT_API
+      if (float_api)
+         ret[i] = opus_decode_float(st[i], data[i], len[i],
+               (float*)pcm[i], frame_size, decode_fec);
+      else
+#endif
+         ret[i] = opus_decode(st[i], data[i], len[i],
+               (opus_int16*)pcm[i], frame_size, decode_fec);
+   }
+   if (nb_split == 0)
+   {
+      RESTORE_STACK;
+      return;
+   }
+   ALLOC(freq, BATCH_FREQ_SIZE, celt_sig);
+   ALLOC(syn, BATCH_MAX_STREAMS, CELTSynthesis);
+   ALLOC(celt_st, BATCH_MAX_STREAMS, CELTDecoder *);
+   ALLOC(out, BATCH_MAX_STREAMS, opus_val16 *);
+   ALLOC(rng, BATCH_MAX_STREAMS, opus_uint32);
+   ALLOC(idx, BATCH_MAX_STREAMS, int);
+   n = used = 0;
+   for (j=0;j<=nb_split;j++)
+   {
+      /* Run the synthesis of the chunk once it is full, and at the end. */
+      if (n > 0 && (j == nb_split || n == BATCH_MAX_STREAMS || used+need[j] > BATCH_FREQ_SIZE))
+      {
+#ifdef ENABLE_PROFILE_STATS
+         for (k=0;k<n;k++)
+            celt_ticks[k] = st[idx[k]]->profile.stats.ticks[OPUS_PROFILE_CELT_DECODE];
+#endif
+         celt_decode_synthesis(celt_st, syn, out, n, 0);
+#ifdef ENABLE_PROFILE_STATS
+         /* The synthesis is all CELT work, so each stream is charged the
+            part of it that the CELT decoder charged the stream. */
+         for (k=0;k<n;k++)
+         {
+            OpusProfile *p = &st[idx[k]]->profile;
+            opus_profile_add(p, OPUS_PROFILE_DECODE,
+                  p->stats.ticks[OPUS_PROFILE_CELT_DECODE] - celt_ticks[k], 0);
+         }
+#endif
+         for (k=0;k<n;k++)
+         {
+            OpusDecoder *s = st[idx[k]];
+            int r;
+            r = batch_celt_end(s, &syn[k], rng[k], out[k], !native_out);
+            ret[idx[k]] = r;
+            if (!native_out && r > 0)
+            {
+               int m;
+#ifdef FIXED_POINT
+               float *dst = (float*)pcm[idx[k]];
+               for (m=0;m<r*s->channels;m++)
+                  dst[m] = (1.f/32768.f)*out[k][m];
+#else
+               opus_int16 *dst = (opus_int16*)pcm[idx[k]];
+               for (m=0;m<r*s->channels;m++)
+                  dst[m] = FLOAT2INT16(out[k][m]);
+#endif
+            }
+         }
+         n = used = 0;
+      }
+      if (j == nb_split)
+         break;
+      i = order[j];
+      celt_st[n] = (CELTDecoder*)((char*)st[i]+st[i]->celt_dec_offset);
+      ret[i] = batch_celt_begin(st[i], data[i], len[i], freq+used, &syn[n], &rng[n]);
+      if (ret[i] < 0)
+         continue;
+      /* The spectrum is dead by the time the de-emphasis writes its output,
+         so a conversion buffer can go in the same place. */
+      out[n] = native_out ? (opus_val16*)pcm[i] : (opus_val16*)(void*)(freq+used);
+      idx[n] = i;
+      n++;
+      used += need[j];
+   }
+   RESTORE_STACK;
+}
+
+static void opus_decode_batch_native(OpusDecoder * const *st,
+      const unsigned char * const *data, const opus_int32 *len,
+      void * const *pcm, int frame_size, int decode_fec, int *ret, int count,
+      int float_api)
+{
+   int base;
+   for (base=0;base<count;base+=BATCH_WINDOW)
+      opus_decode_batch_window(st+base, data+base, len+base, pcm+base,
+            frame_size, decode_fec, ret+base, IMIN(count-base, BATCH_WINDOW),
+            float_api);
+}
+
+int opus_decode_batch(OpusDecoder * const *st, const unsigned char * const *data,
+      const opus_int32 *len, opus_int16 * const *pcm, int frame_size,
+      int decode_fec, int *ret, int count)
+{
+   int err = OPUS_OK;
+   if (count < 0)
+      return OPUS_BAD_ARG;
+   SCRATCH_GUARD(err, opus_decode_batch_native(st, data, len,
+         (void * const *)pcm, frame_size, decode_fec, ret, count, 0));
+   return err;
+}
+
+#ifndef DISABLE_FLOAT_API
+int opus_decode_batch_float(OpusDecoder * const *st, const unsigned char * const *data,
+      const opus_int32 *len, float * const *pcm, int frame_size,
+      int decode_fec, int *ret, int count)
+{
+   int err = OPUS_OK;
+   if (count < 0)
+      return OPUS_BAD_ARG;
+   SCRATCH_GUARD(err, opus_decode_batch_native(st, data, len,
+         (void * const *)pcm, frame_size, decode_fec, ret, count, 1));
+   return err;
+}
+#endif
+
 #ifdef FIXED_POINT
 
-int opus_decode(OpusDecoder *st, const unsigned char *data,
+static int opus_decode_impl(OpusDecoder *st, const unsigned char *data,
       opus_int32 len, opus_val16 *pcm, int frame_size, int decode_fec)
 {
    if(frame_size<=0)
@@ -748,7 +1142,7 @@ int opus_decode(OpusDecoder *st, const unsigned char *data,
 }
 
 #ifndef DISABLE_FLOAT_API
-int opus_decode_float(OpusDecoder *st, const unsigned char *data,
+static int opus_decode_float_impl(OpusDecoder *st, const unsigned char *data,
       opus_int32 len, float *pcm, int frame_size, int decode_fec)
 {
    VARDECL(opus_int16, out);
@@ -785,7 +1179,7 @@ int opus_decode_float(OpusDecoder *st, const unsigned char *data,
 
 
 #else
-int opus_decode(OpusDecoder *st, const unsigned char *data,
+static int opus_decode_impl(OpusDecoder *st, const unsigned char *data,
       opus_int32 len, opus_int16 *pcm, int frame_size, int decode_fec)
 {
    VARDECL(float, out);
@@ -820,7 +1214,7 @@ int opus_decode(OpusDecoder *st, const unsigned char *data,
    return ret;
 }
 
-int opus_decode_float(OpusDecoder *st, const unsigned char *data,
+static int opus_decode_float_impl(OpusDecoder *st, const unsigned char *data,
       opus_int32 len, opus_val16 *pcm, int frame_size, int decode_fec)
 {
    if(frame_size<=0)
@@ -830,6 +1224,139 @@ int opus_decode_float(OpusDecoder *st, const unsigned char *data,
 
 #endif
 
+/* A mono plane is already an interleaved signal. For stereo, the frame is
+   decoded into an interleaved buffer (the stereo synthesis, the SILK/CELT
+   transitions and the soft clipping all work on interleaved frames) and
+   scattered to the planes in the same pass that the interleaved API uses
+   to convert it to the output format. */
+static int opus_decode_planar_impl(OpusDecoder *st, const unsigned char *data,
+      opus_int32 len, opus_int16 * const *pcm, int frame_size, int decode_fec)
+{
+   VARDECL(opus_val16, out);
+   int ret, i, c;
+   int nb_samples;
+   ALLOC_STACK;
+
+   if (st->channels == 1)
+   {
+      RESTORE_STACK;
+      return opus_decode(st, data, len, pcm[0], frame_size, decode_fec);
+   }
+   if(frame_size<=0)
+   {
+      RESTORE_STACK;
+      return OPUS_BAD_ARG;
+   }
+   if (data != NULL && len > 0 && !decode_fec)
+   {
+      nb_samples = opus_decoder_get_nb_samples(st, data, len);
+      if (nb_samples>0)
+         frame_size = IMIN(frame_size, nb_samples);
+      else
+      {
+         RESTORE_STACK;
+         return OPUS_INVALID_PACKET;
+      }
+   }
+   ALLOC(out, frame_size*st->channels, opus_val16);
+
+#ifdef FIXED_POINT
+   ret = opus_decode_native(st, data, len, out, frame_size, decode_fec, 0, NULL, 0);
+#else
+   ret = opus_decode_native(st, data, len, out, frame_size, decode_fec, 0, NULL, 1);
+#endif
+   for (c=0;c<st->channels;c++)
+      for (i=0;i<ret;i++)
+#ifdef FIXED_POINT
+         pcm[c][i] = out[i*st->channels+c];
+#else
+         pcm[c][i] = FLOAT2INT16(out[i*st->channels+c]);
+#endif
+   RESTORE_STACK;
+   return ret;
+}
+
+#ifndef DISABLE_FLOAT_API
+static int opus_decode_planar_float_impl(OpusDecoder *st, const unsigned char *data,
+      opus_int32 len, float * const *pcm, int frame_size, int decode_fec)
+{
+   VARDECL(opus_val16, out);
+   int ret, i, c;
+   int nb_samples;
+   ALLOC_STACK;
+
+   if (st->channels == 1)
+   {
+      RESTORE_STACK;
+      return opus_decode_float(st, data, len, pcm[0], frame_size, decode_fec);
+   }
+   if(frame_size<=0)
+   {
+      RESTORE_STACK;
+      return OPUS_BAD_ARG;
+   }
+   if (data != NULL && len > 0 && !decode_fec)
+   {
+      nb_samples = opus_decoder_get_nb_samples(st, data, len);
+      if (nb_samples>0)
+         frame_size = IMIN(frame_size, nb_samples);
+      else
+      {
+         RESTORE_STACK;
+         return OPUS_INVALID_PACKET;
+      }
+   }
+   ALLOC(out, frame_size*st->channels, opus_val16);
+
+   ret = opus_decode_native(st, data, len, out, frame_size, decode_fec, 0, NULL, 0);
+   for (c=0;c<st->channels;c++)
+      for (i=0;i<ret;i++)
+#ifdef FIXED_POINT
+         pcm[c][i] = (1.f/32768.f)*out[i*st->channels+c];
+#else
+         pcm[c][i] = out[i*st->channels+c];
+#endif
+   RESTORE_STACK;
+   return ret;
+}
+#endif
+
+/* The public entry points return OPUS_ALLOC_FAIL when the scratch arena
+   overflows, instead of aborting. */
+int opus_decode(OpusDecoder *st, const unsigned char *data,
+      opus_int32 len, opus_int16 *pcm, int frame_size, int decode_fec)
+{
+   int ret;
+   SCRATCH_GUARD(ret, ret = opus_decode_impl(st, data, len, pcm, frame_size, decode_fec));
+   return ret;
+}
+
+int opus_decode_planar(OpusDecoder *st, const unsigned char *data,
+      opus_int32 len, opus_int16 * const *pcm, int frame_size, int decode_fec)
+{
+   int ret;
+   SCRATCH_GUARD(ret, ret = opus_decode_planar_impl(st, data, len, pcm, frame_size, decode_fec));
+   return ret;
+}
+
+#ifndef DISABLE_FLOAT_API
+int opus_decode_float(OpusDecoder *st, const unsigned char *data,
+      opus_int32 len, float *pcm, int frame_size, int decode_fec)
+{
+   int ret;
+   SCRATCH_GUARD(ret, ret = opus_decode_float_impl(st, data, len, pcm, frame_size, decode_fec));
+   return ret;
+}
+
+int opus_decode_planar_float(OpusDecoder *st, const unsigned char *data,
+      opus_int32 len, float * const *pcm, int frame_size, int decode_fec)
+{
+   int ret;
+   SCRATCH_GUARD(ret, ret = opus_decode_planar_float_impl(st, data, len, pcm, frame_size, decode_fec));
+   return ret;
+}
+#endif
+
 int opus_decoder_ctl(OpusDecoder *st, int request, ...)
 {
    int ret = OPUS_OK;
@@ -884,7 +1411,7 @@ int opus_decoder_ctl(OpusDecoder *st, int request, ...)
       {
          goto bad_arg;
       }
-      *value = st->Fs;
+      *value = st->api_Fs;
    }
    break;
    case OPUS_GET_PITCH_REQUEST:
@@ -950,6 +1477,49 @@ int opus_decoder_ctl(OpusDecoder *st, int request, ...)
        ret = celt_decoder_ctl(celt_dec, OPUS_GET_PHASE_INVERSION_DISABLED(value));
    }
    break;
+   case OPUS_SET_REDUCED_SYNTHESIS_REQUEST:
+   {
+       opus_int32 value = va_arg(ap, opus_int32);
+       if(value<0 || value>1)
+       {
+          goto bad_arg;
+       }
+       ret = celt_decoder_ctl(celt_dec, OPUS_SET_REDUCED_SYNTHESIS(value));
+   }
+   break;
+   case OPUS_GET_REDUCED_SYNTHESIS_REQUEST:
+   {
+       opus_int32 *value = va_arg(ap, opus_int32*);
+       if (!value)
+       {
+          goto bad_arg;
+       }
+       ret = celt_decoder_ctl(celt_dec, OPUS_GET_REDUCED_SYNTHESIS(value));
+   }
+   break;
+   case OPUS_GET_PROFILE_STATS_REQUEST:
+   {
+      OpusProfileStats *value = va_arg(ap, OpusProfileStats*);
+      if (!value)
+      {
+         goto bad_arg;
+      }
+#ifdef ENABLE_PROFILE_STATS
+      *value = st->profile.stats;
+#else
+      ret = OPUS_UNIMPLEMENTED;
+#endif
+   }
+   break;
+   case OPUS_RESET_PROFILE_STATS:
+   {
+#ifdef ENABLE_PROFILE_STATS
+      OPUS_CLEAR(&st->profile.stats, 1);
+#else
+      ret = OPUS_UNIMPLEMENTED;
+#endif
+   }
+   break;
    default:
       /*fprintf(stderr, "unknown opus_decoder_ctl() request: %d", request);*/
       ret = OPUS_UNIMPLEMENTED;
@@ -1028,5 +1598,9 @@ int opus_packet_get_nb_samples(const unsigned char packet[], opus_int32 len,
 int opus_decoder_get_nb_samples(const OpusDecoder *dec,
       const unsigned char packet[], opus_int32 len)
 {
-   return opus_packet_get_nb_samples(packet, len, dec->Fs);
+   int samples;
+   samples = opus_packet_get_nb_samples(packet, len, dec->Fs);
+   if (samples > 0 && dec->api_Fs != dec->Fs)
+      samples = resample_44k1_down_size(&dec->resampler, samples);
+   return samples;
 }
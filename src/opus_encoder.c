@@ -43,6 +43,7 @@
 #include "os_support.h"
 #include "cpu_support.h"
 #include "analysis.h"
+#include "resample_44k1.h"
 #include "mathops.h"
 #include "tuning_parameters.h"
 #ifdef FIXED_POINT
@@ -52,6 +53,13 @@
 #endif
 
 #define MAX_ENCODER_BUFFER 480
+/* The delay buffer window slides forward through this many extra samples
+   before the samples it keeps have to be moved back to the start. */
+#define DELAY_BUFFER_SIZE (MAX_ENCODER_BUFFER*2*3)
+
+/* Calls the complexity governor waits, with the encode time at least a
+   quarter under budget, before raising the complexity by one step. */
+#define GOVERNOR_HOLD 8
 
 #ifndef DISABLE_FLOAT_API
 #define PSEUDO_SNR_THRESHOLD 316.23f    /* 10^(25/10) */
@@ -76,7 +84,8 @@ struct OpusEncoder {
     int          max_bandwidth;
     int          user_forced_mode;
     int          voice_ratio;
-    opus_int32   Fs;
+    opus_int32   Fs;                      /* Rate the codec runs at */
+    opus_int32   api_Fs;                  /* Rate of the caller's signal, 44100 or Fs */
     int          use_vbr;
     int          vbr_constraint;
     int          variable_duration;
@@ -87,8 +96,17 @@ struct OpusEncoder {
     int          lfe;
     int          arch;
     int          use_dtx;                 /* general DTX for both SILK and CELT */
+    int          user_complexity;         /* silk_mode.complexity is the one in use */
+    opus_int32   complexity_budget;       /* CPU time per call in us, 0 when not governed */
+    opus_int32   governor_avg;            /* Smoothed encode time at the current complexity */
+    int          governor_calls;          /* Calls since the complexity last changed */
+    int          governor_active;         /* Set while a governed call is running */
 #ifndef DISABLE_FLOAT_API
     TonalityAnalysisState analysis;
+    TonalityAnalysisShare *analysis_share; /* Set by OpusGroupEncoder while it encodes */
+#endif
+#ifdef ENABLE_PROFILE_STATS
+    OpusProfile  profile;
 #endif
 
 #define OPUS_ENCODER_RESET_START stream_channels
@@ -109,7 +127,8 @@ struct OpusEncoder {
     int          first;
     opus_val16 * energy_masking;
     StereoWidthState width_mem;
-    opus_val16   delay_buffer[MAX_ENCODER_BUFFER*2];
+    opus_val16   delay_buffer[DELAY_BUFFER_SIZE];
+    int          delay_buffer_pos;        /* Start of the window in delay_buffer */
 #ifndef DISABLE_FLOAT_API
     int          detected_bandwidth;
     int          nb_no_activity_frames;
@@ -117,6 +136,7 @@ struct OpusEncoder {
 #endif
     int          nonfinal_frame; /* current frame is not the final in a packet */
     opus_uint32  rangeFinal;
+    Resample44k1State resampler;          /* 44.1 -> 48 kHz, when api_Fs is 44100 */
 };
 
 /* Transition tables for the voice and music. First column is the
@@ -179,6 +199,23 @@ int opus_encoder_get_size(int channels)
     return align(sizeof(OpusEncoder))+silkEncSizeBytes+celtEncSizeBytes;
 }
 
+int opus_encoder_get_scratch_size(int channels)
+{
+    if (channels<1 || channels > 2)
+        return 0;
+    /* Measured peak pseudostack usage over all rates, applications, forced
+       modes, frame durations, bitrates and complexities: 54768/84752 bytes
+       in fixed point and 86000/147136 in floating point, for 120 ms frames
+       at 44.1 kHz, where the converted input is also on the stack. The peak
+       depends on the coding decisions the signal leads to, so 4 kB are
+       added on top of it before rounding up to 1 kB. */
+#ifdef FIXED_POINT
+    return channels == 1 ? 59392 : 89088;
+#else
+    return channels == 1 ? 90112 : 151552;
+#endif
+}
+
 int opus_encoder_init(OpusEncoder* st, opus_int32 Fs, int channels, int application)
 {
     void *silk_enc;
@@ -186,7 +223,7 @@ int opus_encoder_init(OpusEncoder* st, opus_int32 Fs, int channels, int applicat
     int err;
     int ret, silkEncSizeBytes;
 
-   if((Fs!=48000&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)||(channels!=1&&channels!=2)||
+   if((Fs!=48000&&Fs!=44100&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)||(channels!=1&&channels!=2)||
         (application != OPUS_APPLICATION_VOIP && application != OPUS_APPLICATION_AUDIO
         && application != OPUS_APPLICATION_RESTRICTED_LOWDELAY))
         return OPUS_BAD_ARG;
@@ -204,6 +241,11 @@ int opus_encoder_init(OpusEncoder* st, opus_int32 Fs, int channels, int applicat
 
     st->stream_channels = st->channels = channels;
 
+    /* A 44.1 kHz input is converted to 48 kHz before anything else sees it,
+       so the rest of the encoder runs as if it had been given 48 kHz. */
+    st->api_Fs = Fs;
+    if (Fs == 44100)
+       Fs = 48000;
     st->Fs = Fs;
 
     st->arch = opus_select_arch();
@@ -234,6 +276,7 @@ int opus_encoder_init(OpusEncoder* st, opus_int32 Fs, int channels, int applicat
 
     celt_encoder_ctl(celt_enc, CELT_SET_SIGNALLING(0));
     celt_encoder_ctl(celt_enc, OPUS_SET_COMPLEXITY(st->silk_mode.complexity));
+    st->user_complexity = st->silk_mode.complexity;
 
     st->use_vbr = 1;
     /* Makes constrained VBR the default (safer for real-time use) */
@@ -517,7 +560,7 @@ OpusEncoder *opus_encoder_create(opus_int32 Fs, int channels, int application, i
 {
    int ret;
    OpusEncoder *st;
-   if((Fs!=48000&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)||(channels!=1&&channels!=2)||
+   if((Fs!=48000&&Fs!=44100&&Fs!=24000&&Fs!=16000&&Fs!=12000&&Fs!=8000)||(channels!=1&&channels!=2)||
        (application != OPUS_APPLICATION_VOIP && application != OPUS_APPLICATION_AUDIO
        && application != OPUS_APPLICATION_RESTRICTED_LOWDELAY))
    {
@@ -543,7 +586,7 @@ OpusEncoder *opus_encoder_create(opus_int32 Fs, int channels, int application, i
    return st;
 }
 
-static opus_int32 user_bitrate_to_bitrate(OpusEncoder *st, int frame_size, int max_data_bytes)
+static opus_int32 user_bitrate_to_bitrate(const OpusEncoder *st, int frame_size, int max_data_bytes)
 {
   if(!frame_size)frame_size=st->Fs/400;
   if (st->user_bitrate_bps==OPUS_AUTO)
@@ -608,6 +651,54 @@ void downmix_int(const void *_x, opus_val32 *y, int subframe, int offset, int c1
    }
 }
 
+#ifndef DISABLE_FLOAT_API
+void downmix_planar_float(const void *_x, opus_val32 *y, int subframe, int offset, int c1, int c2, int C)
+{
+   const float * const *x;
+   int j;
+
+   x = (const float * const *)_x;
+   for (j=0;j<subframe;j++)
+      y[j] = PCM2VAL(x[c1][j+offset]);
+   if (c2>-1)
+   {
+      for (j=0;j<subframe;j++)
+         y[j] += PCM2VAL(x[c2][j+offset]);
+   } else if (c2==-2)
+   {
+      int c;
+      for (c=1;c<C;c++)
+      {
+         for (j=0;j<subframe;j++)
+            y[j] += PCM2VAL(x[c][j+offset]);
+      }
+   }
+}
+#endif
+
+void downmix_planar_int(const void *_x, opus_val32 *y, int subframe, int offset, int c1, int c2, int C)
+{
+   const opus_int16 * const *x;
+   int j;
+
+   x = (const opus_int16 * const *)_x;
+   for (j=0;j<subframe;j++)
+      y[j] = x[c1][j+offset];
+   if (c2>-1)
+   {
+      for (j=0;j<subframe;j++)
+         y[j] += x[c2][j+offset];
+   } else if (c2==-2)
+   {
+      int c;
+      for (c=1;c<C;c++)
+      {
+         for (j=0;j<subframe;j++)
+            y[j] += x[c][j+offset];
+      }
+   }
+}
+
 opus_int32 frame_size_select(opus_int32 frame_size, int variable_duration, opus_int32 Fs)
 {
    int new_size;
@@ -618,7 +709,7 @@ opus_int32 frame_size_select(opus_int32 frame_size, int variable_duration, opus_
    else if (variable_duration >= OPUS_FRAMESIZE_2_5_MS && variable_duration <= OPUS_FRAMESIZE_120_MS)
    {
       if (variable_duration <= OPUS_FRAMESIZE_40_MS)
-         new_size = (Fs/400)<<(variable_duration-OPUS_FRAMESIZE_2_5_MS);
+         new_size = (Fs<<(variable_duration-OPUS_FRAMESIZE_2_5_MS))/400;
       else
          new_size = (variable_duration-OPUS_FRAMESIZE_2_5_MS-2)*Fs/50;
    }
@@ -917,6 +1008,11 @@ static int decide_dtx_mode(opus_int activity,            /* indicates if this fr
 
 #endif
 
+static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_val16 *pcm, int frame_size,
+                unsigned char *data, opus_int32 out_data_bytes, int lsb_depth,
+                const void *analysis_pcm, opus_int32 analysis_size, int c1, int c2,
+                int analysis_channels, downmix_func downmix, int float_api);
+
 static opus_int32 encode_multiframe_packet(OpusEncoder *st,
                                            const opus_val16 *pcm,
                                            int nb_frames,
@@ -979,7 +1075,7 @@ static opus_int32 encode_multiframe_packet(OpusEncoder *st,
       if (to_celt && i==nb_frames-1)
          st->user_forced_mode = MODE_CELT_ONLY;
 
-      tmp_len = opus_encode_native(st, pcm+i*(st->channels*frame_size), frame_size,
+      tmp_len = opus_encode_frame_native(st, pcm+i*(st->channels*frame_size), frame_size,
          tmp_data+i*bytes_per_frame, bytes_per_frame, lsb_depth, NULL, 0, 0, 0, 0,
          NULL, float_api);
 
@@ -1044,7 +1140,7 @@ static int compute_redundancy_bytes(opus_int32 max_data_bytes, opus_int32 bitrat
    return redundancy_bytes;
 }
 
-opus_int32 opus_encode_native(OpusEncoder *st, const opus_val16 *pcm, int frame_size,
+static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_val16 *pcm, int frame_size,
                 unsigned char *data, opus_int32 out_data_bytes, int lsb_depth,
                 const void *analysis_pcm, opus_int32 analysis_size, int c1, int c2,
                 int analysis_channels, downmix_func downmix, int float_api)
@@ -1075,6 +1171,7 @@ opus_int32 opus_encode_native(OpusEncoder *st, const opus_val16 *pcm, int frame_
     opus_val16 HB_gain;
     opus_int32 max_data_bytes; /* Max number of bytes we're allowed to use */
     int total_buffer;
+    opus_val16 *delay_buffer;
     opus_val16 stereo_width;
     const CELTMode *celt_mode;
 #ifndef DISABLE_FLOAT_API
@@ -1126,9 +1223,16 @@ opus_int32 opus_encode_native(OpusEncoder *st, const opus_val16 *pcm, int frame_
        is_silence = is_digital_silence(pcm, frame_size, st->channels, lsb_depth);
        analysis_read_pos_bak = st->analysis.read_pos;
        analysis_read_subframe_bak = st->analysis.read_subframe;
-       run_analysis(&st->analysis, celt_mode, analysis_pcm, analysis_size, frame_size,
-             c1, c2, analysis_channels, st->Fs,
-             lsb_depth, downmix, &analysis_info);
+       PROFILE_START(&st->profile, OPUS_PROFILE_ANALYSIS);
+       if (st->analysis_share)
+          run_shared_analysis(&st->analysis, st->analysis_share, celt_mode, analysis_pcm,
+                analysis_size, frame_size, c1, c2, analysis_channels, st->Fs,
+                lsb_depth, downmix, &analysis_info);
+       else
+          run_analysis(&st->analysis, celt_mode, analysis_pcm, analysis_size, frame_size,
+                c1, c2, analysis_channels, st->Fs,
+                lsb_depth, downmix, &analysis_info);
+       PROFILE_END(&st->profile, OPUS_PROFILE_ANALYSIS);
 
        /* Track the peak signal energy */
        if (!is_silence && analysis_info.activity_probability > DTX_ACTIVITY_THRESHOLD)
@@ -1624,8 +1728,9 @@ opus_int32 opus_encode_native(OpusEncoder *st, const opus_val16 *pcm, int frame_
 
     ec_enc_init(&enc, data, max_data_bytes-1);
 
+    delay_buffer = st->delay_buffer+st->delay_buffer_pos;
     ALLOC(pcm_buf, (total_buffer+frame_size)*st->channels, opus_val16);
-    OPUS_COPY(pcm_buf, &st->delay_buffer[(st->encoder_buffer-total_buffer)*st->channels], total_buffer*st->channels);
+    OPUS_COPY(pcm_buf, &delay_buffer[(st->encoder_buffer-total_buffer)*st->channels], total_buffer*st->channels);
 
     if (st->mode == MODE_CELT_ONLY)
        hp_freq_smth1 = silk_LSHIFT( silk_lin2log( VARIABLE_HP_MIN_CUTOFF_HZ ), 8 );
@@ -1810,16 +1915,18 @@ opus_int32 opus_encode_native(OpusEncoder *st, const opus_val16 *pcm, int frame_
                rewritten is tmp_prefill[] and even then only the part after the ramp really
                gets used (rather than sent to the encoder and discarded) */
             prefill_offset = st->channels*(st->encoder_buffer-st->delay_compensation-st->Fs/400);
-            gain_fade(st->delay_buffer+prefill_offset, st->delay_buffer+prefill_offset,
+            gain_fade(delay_buffer+prefill_offset, delay_buffer+prefill_offset,
                   0, Q15ONE, celt_mode->overlap, st->Fs/400, st->channels, celt_mode->window, st->Fs);
-            OPUS_CLEAR(st->delay_buffer, prefill_offset);
+            OPUS_CLEAR(delay_buffer, prefill_offset);
 #ifdef FIXED_POINT
-            pcm_silk = st->delay_buffer;
+            pcm_silk = delay_buffer;
 #else
             for (i=0;i<st->encoder_buffer*st->channels;i++)
-                pcm_silk[i] = FLOAT2INT16(st->delay_buffer[i]);
+                pcm_silk[i] = FLOAT2INT16(delay_buffer[i]);
 #endif
+            PROFILE_START(&st->profile, OPUS_PROFILE_SILK_ENCODE);
             silk_Encode( silk_enc, &st->silk_mode, pcm_silk, st->encoder_buffer, NULL, &zero, prefill, activity );
+            PROFILE_END(&st->profile, OPUS_PROFILE_SILK_ENCODE);
             /* Prevent a second switch in the real encode call. */
             st->silk_mode.opusCanSwitch = 0;
         }
@@ -1830,7 +1937,9 @@ opus_int32 opus_encode_native(OpusEncoder *st, const opus_val16 *pcm, int frame_
         for (i=0;i<frame_size*st->channels;i++)
             pcm_silk[i] = FLOAT2INT16(pcm_buf[total_buffer*st->channels + i]);
 #endif
+        PROFILE_START(&st->profile, OPUS_PROFILE_SILK_ENCODE);
         ret = silk_Encode( silk_enc, &st->silk_mode, pcm_silk, frame_size, &enc, &nBytes, 0, activity );
+        PROFILE_END(&st->profile, OPUS_PROFILE_SILK_ENCODE);
         if( ret ) {
             /*fprintf (stderr, "SILK encode error: %d\n", ret);*/
             /* Handle error */
@@ -1923,17 +2032,26 @@ opus_int32 opus_encode_native(OpusEncoder *st, const opus_val16 *pcm, int frame_
     ALLOC(tmp_prefill, st->channels*st->Fs/400, opus_val16);
     if (st->mode != MODE_SILK_ONLY && st->mode != st->prev_mode && st->prev_mode > 0)
     {
-       OPUS_COPY(tmp_prefill, &st->delay_buffer[(st->encoder_buffer-total_buffer-st->Fs/400)*st->channels], st->channels*st->Fs/400);
+       OPUS_COPY(tmp_prefill, &delay_buffer[(st->encoder_buffer-total_buffer-st->Fs/400)*st->channels], st->channels*st->Fs/400);
     }
 
     if (st->channels*(st->encoder_buffer-(frame_size+total_buffer)) > 0)
     {
-       OPUS_MOVE(st->delay_buffer, &st->delay_buffer[st->channels*frame_size], st->channels*(st->encoder_buffer-frame_size-total_buffer));
-       OPUS_COPY(&st->delay_buffer[st->channels*(st->encoder_buffer-frame_size-total_buffer)],
+       /* Slide the window forward when there's room left after it, so only
+          the new samples get written. */
+       if (st->delay_buffer_pos+st->channels*(frame_size+st->encoder_buffer) <= DELAY_BUFFER_SIZE)
+       {
+          st->delay_buffer_pos += st->channels*frame_size;
+       } else {
+          OPUS_MOVE(st->delay_buffer, &delay_buffer[st->channels*frame_size], st->channels*(st->encoder_buffer-frame_size-total_buffer));
+          st->delay_buffer_pos = 0;
+       }
+       delay_buffer = st->delay_buffer+st->delay_buffer_pos;
+       OPUS_COPY(&delay_buffer[st->channels*(st->encoder_buffer-frame_size-total_buffer)],
              &pcm_buf[0],
              (frame_size+total_buffer)*st->channels);
     } else {
-       OPUS_COPY(st->delay_buffer, &pcm_buf[(frame_size+total_buffer-st->encoder_buffer)*st->channels], st->encoder_buffer*st->channels);
+       OPUS_COPY(delay_buffer, &pcm_buf[(frame_size+total_buffer-st->encoder_buffer)*st->channels], st->encoder_buffer*st->channels);
     }
     /* gain_fade() and stereo_fade() need to be after the buffer copying
        because we don't want any of this to affect the SILK part */
@@ -2181,10 +2299,152 @@ opus_int32 opus_encode_native(OpusEncoder *st, const opus_val16 *pcm, int frame_
     return ret;
 }
 
+static void set_effective_complexity(OpusEncoder *st, int complexity)
+{
+    CELTEncoder *celt_enc = (CELTEncoder*)(void*)((char*)st+st->celt_enc_offset);
+    st->silk_mode.complexity = complexity;
+    celt_encoder_ctl(celt_enc, OPUS_SET_COMPLEXITY(complexity));
+    st->governor_calls = 0;
+}
+
+/* Picks the complexity of the next call from the time taken by this one.
+   A call that takes more than twice the budget drops two steps at once;
+   otherwise the smoothed time decides, so that a single slow call does
+   not throw away quality. */
+static void update_complexity_governor(OpusEncoder *st, opus_int32 elapsed)
+{
+    opus_int32 budget = st->complexity_budget;
+    int complexity = st->silk_mode.complexity;
+    if (st->governor_calls == 0)
+       st->governor_avg = elapsed;
+    else
+       st->governor_avg += (elapsed - st->governor_avg)/4;
+    st->governor_calls++;
+    if (elapsed/2 > budget)
+       complexity -= 2;
+    else if (st->governor_avg > budget)
+       complexity--;
+    else if (st->governor_calls >= GOVERNOR_HOLD && st->governor_avg < budget - budget/4)
+       complexity++;
+    complexity = IMAX(0, IMIN(st->user_complexity, complexity));
+    if (complexity != st->silk_mode.complexity)
+       set_effective_complexity(st, complexity);
+}
+
+/* Converts a frame of 44.1 kHz input to 48 kHz and encodes it. The frame
+   sizes allowed at 44.1 kHz are the multiples of 10 ms, which convert to
+   whole 48 kHz frames, so the converter always starts a frame on the same
+   phase. The analysis reads the converted signal, since it only knows how to
+   downsample from the codec rates. */
+static opus_int32 opus_encode_44k1(OpusEncoder *st, const opus_val16 *pcm, int frame_size,
+                unsigned char *data, opus_int32 out_data_bytes, int lsb_depth,
+                int float_api)
+{
+    int N;
+    opus_int32 ret;
+    downmix_func downmix;
+    VARDECL(opus_val16, in);
+    ALLOC_STACK;
+
+    if (frame_size <= 0 || frame_size%441 != 0)
+    {
+       RESTORE_STACK;
+       return OPUS_BAD_ARG;
+    }
+    N = frame_size/147*160;
+    ALLOC(in, N*st->channels, opus_val16);
+    PROFILE_START(&st->profile, OPUS_PROFILE_RESAMPLE);
+    resample_44k1_up(&st->resampler, pcm, frame_size, in, st->channels, st->arch);
+    PROFILE_END(&st->profile, OPUS_PROFILE_RESAMPLE);
+#if defined(FIXED_POINT)
+    downmix = downmix_int;
+#elif !defined(DISABLE_FLOAT_API)
+    downmix = downmix_float;
+#else
+    downmix = NULL;
+#endif
+    ret = opus_encode_frame_native(st, in, N, data, out_data_bytes, lsb_depth,
+          in, N, 0, -2, st->channels, downmix, float_api);
+    RESTORE_STACK;
+    return ret;
+}
+
+opus_int32 opus_encode_native(OpusEncoder *st, const opus_val16 *pcm, int frame_size,
+                unsigned char *data, opus_int32 out_data_bytes, int lsb_depth,
+                const void *analysis_pcm, opus_int32 analysis_size, int c1, int c2,
+                int analysis_channels, downmix_func downmix, int float_api)
+{
+    opus_int32 ret;
+    opus_int64 start = 0;
+    int governed;
+#ifdef ENABLE_PROFILE_STATS
+    /* Pointers are not kept across calls, since the state may be moved. */
+    st->silk_mode.profile = &st->profile;
+    celt_encoder_ctl((CELTEncoder*)(void*)((char*)st+st->celt_enc_offset),
+          CELT_SET_PROFILE(&st->profile));
+#endif
+    /* Multi-frame packets call back into this function for each frame; only
+       the outer call is timed. */
+    governed = st->complexity_budget > 0 && !st->governor_active;
+    if (governed)
+    {
+       st->governor_active = 1;
+       start = opus_cpu_time_us();
+    }
+    PROFILE_START(&st->profile, OPUS_PROFILE_ENCODE);
+    if (st->api_Fs != st->Fs)
+       ret = opus_encode_44k1(st, pcm, frame_size, data, out_data_bytes, lsb_depth,
+             float_api);
+    else
+       ret = opus_encode_frame_native(st, pcm, frame_size, data, out_data_bytes, lsb_depth,
+             analysis_pcm, analysis_size, c1, c2, analysis_channels, downmix, float_api);
+    PROFILE_END(&st->profile, OPUS_PROFILE_ENCODE);
+    if (governed)
+    {
+       opus_int64 elapsed = opus_cpu_time_us() - start;
+       st->governor_active = 0;
+       update_complexity_governor(st, (opus_int32)IMIN(elapsed, 1000000000));
+    }
+    return ret;
+}
+
+opus_int32 opus_encoder_packet_bound(const OpusEncoder *st, int frame_size)
+{
+    int nb_frames;
+    opus_int32 bound;
+    if (st->api_Fs != st->Fs)
+       frame_size = frame_size/147*160;
+    /* A multi-frame packet has at most one 20 ms frame per 20 ms, each of up
+       to 1275 bytes, behind a code 2 or code 3 header. Past that size,
+       encode_multiframe_packet() no longer looks at out_data_bytes, and
+       neither does the single-frame path past 1276 bytes. */
+    nb_frames = IMAX(1, frame_size/(st->Fs/50));
+    if (nb_frames == 1)
+       bound = 1276;
+    else
+       bound = 1275*nb_frames + (nb_frames == 2 ? 3 : 2+(nb_frames-1)*2);
+    if (!st->use_vbr && st->user_bitrate_bps != OPUS_BITRATE_MAX)
+    {
+       opus_int32 bitrate;
+       opus_int32 cbr_bytes;
+       opus_int32 multi_bytes;
+       int frame_rate12;
+       /* Same computations as opus_encode_frame_native() and
+          encode_multiframe_packet(); the 'PLC' frames are at most 2 bytes. */
+       bitrate = user_bitrate_to_bitrate(st, frame_size, 0);
+       frame_rate12 = 12*st->Fs/frame_size;
+       cbr_bytes = IMIN((12*bitrate/8 + frame_rate12/2)/frame_rate12, 1276);
+       bitrate = cbr_bytes*(opus_int32)frame_rate12*8/12;
+       multi_bytes = 3*bitrate/(3*8*st->Fs/frame_size);
+       bound = IMIN(bound, IMAX(2, IMAX(cbr_bytes, multi_bytes)));
+    }
+    return bound;
+}
+
 #ifdef FIXED_POINT
 
 #ifndef DISABLE_FLOAT_API
-opus_int32 opus_encode_float(OpusEncoder *st, const float *pcm, int analysis_frame_size,
+static opus_int32 opus_encode_float_impl(OpusEncoder *st, const float *pcm, int analysis_frame_size,
       unsigned char *data, opus_int32 max_data_bytes)
 {
    int i, ret;
@@ -2192,7 +2452,7 @@ opus_int32 opus_encode_float(OpusEncoder *st, const float *pcm, int analysis_fra
    VARDECL(opus_int16, in);
    ALLOC_STACK;
 
-   frame_size = frame_size_select(analysis_frame_size, st->variable_duration, st->Fs);
+   frame_size = frame_size_select(analysis_frame_size, st->variable_duration, st->api_Fs);
    if (frame_size <= 0)
    {
       RESTORE_STACK;
@@ -2209,17 +2469,17 @@ opus_int32 opus_encode_float(OpusEncoder *st, const float *pcm, int analysis_fra
 }
 #endif
 
-opus_int32 opus_encode(OpusEncoder *st, const opus_int16 *pcm, int analysis_frame_size,
+static opus_int32 opus_encode_impl(OpusEncoder *st, const opus_int16 *pcm, int analysis_frame_size,
                 unsigned char *data, opus_int32 out_data_bytes)
 {
    int frame_size;
-   frame_size = frame_size_select(analysis_frame_size, st->variable_duration, st->Fs);
+   frame_size = frame_size_select(analysis_frame_size, st->variable_duration, st->api_Fs);
    return opus_encode_native(st, pcm, frame_size, data, out_data_bytes, 16,
                              pcm, analysis_frame_size, 0, -2, st->channels, downmix_int, 0);
 }
 
 #else
-opus_int32 opus_encode(OpusEncoder *st, const opus_int16 *pcm, int analysis_frame_size,
+static opus_int32 opus_encode_impl(OpusEncoder *st, const opus_int16 *pcm, int analysis_frame_size,
       unsigned char *data, opus_int32 max_data_bytes)
 {
    int i, ret;
@@ -2227,7 +2487,7 @@ opus_int32 opus_encode(OpusEncoder *st, const opus_int16 *pcm, int analysis_fram
    VARDECL(float, in);
    ALLOC_STACK;
 
-   frame_size = frame_size_select(analysis_frame_size, st->variable_duration, st->Fs);
+   frame_size = frame_size_select(analysis_frame_size, st->variable_duration, st->api_Fs);
    if (frame_size <= 0)
    {
       RESTORE_STACK;
@@ -2242,16 +2502,132 @@ opus_int32 opus_encode(OpusEncoder *st, const opus_int16 *pcm, int analysis_fram
    RESTORE_STACK;
    return ret;
 }
-opus_int32 opus_encode_float(OpusEncoder *st, const float *pcm, int analysis_frame_size,
+static opus_int32 opus_encode_float_impl(OpusEncoder *st, const float *pcm, int analysis_frame_size,
                       unsigned char *data, opus_int32 out_data_bytes)
 {
    int frame_size;
-   frame_size = frame_size_select(analysis_frame_size, st->variable_duration, st->Fs);
+   frame_size = frame_size_select(analysis_frame_size, st->variable_duration, st->api_Fs);
    return opus_encode_native(st, pcm, frame_size, data, out_data_bytes, 24,
                              pcm, analysis_frame_size, 0, -2, st->channels, downmix_float, 1);
 }
 #endif
 
+/* A mono plane is already an interleaved signal, so it goes straight to the
+   interleaved entry points. Stereo is interleaved once into the buffer the
+   encoder works on (which the interleaved API fills with a copy or a
+   format conversion anyway), while the analysis reads the planes
+   directly. */
+static opus_int32 opus_encode_planar_impl(OpusEncoder *st, const opus_int16 * const *pcm,
+      int analysis_frame_size, unsigned char *data, opus_int32 max_data_bytes)
+{
+   int i, c, ret;
+   int frame_size;
+   VARDECL(opus_val16, in);
+   ALLOC_STACK;
+
+   if (st->channels == 1)
+   {
+      RESTORE_STACK;
+      return opus_encode(st, pcm[0], analysis_frame_size, data, max_data_bytes);
+   }
+   frame_size = frame_size_select(analysis_frame_size, st->variable_duration, st->api_Fs);
+   if (frame_size <= 0)
+   {
+      RESTORE_STACK;
+      return OPUS_BAD_ARG;
+   }
+   ALLOC(in, frame_size*st->channels, opus_val16);
+
+   for (c=0;c<st->channels;c++)
+      for (i=0;i<frame_size;i++)
+#ifdef FIXED_POINT
+         in[i*st->channels+c] = pcm[c][i];
+#else
+         in[i*st->channels+c] = (1.0f/32768)*pcm[c][i];
+#endif
+   ret = opus_encode_native(st, in, frame_size, data, max_data_bytes, 16,
+                            pcm, analysis_frame_size, 0, -2, st->channels, downmix_planar_int, 0);
+   RESTORE_STACK;
+   return ret;
+}
+
+#ifndef DISABLE_FLOAT_API
+static opus_int32 opus_encode_planar_float_impl(OpusEncoder *st, const float * const *pcm,
+      int analysis_frame_size, unsigned char *data, opus_int32 max_data_bytes)
+{
+   int i, c, ret;
+   int frame_size;
+   VARDECL(opus_val16, in);
+   ALLOC_STACK;
+
+   if (st->channels == 1)
+   {
+      RESTORE_STACK;
+      return opus_encode_float(st, pcm[0], analysis_frame_size, data, max_data_bytes);
+   }
+   frame_size = frame_size_select(analysis_frame_size, st->variable_duration, st->api_Fs);
+   if (frame_size <= 0)
+   {
+      RESTORE_STACK;
+      return OPUS_BAD_ARG;
+   }
+   ALLOC(in, frame_size*st->channels, opus_val16);
+
+   for (c=0;c<st->channels;c++)
+      for (i=0;i<frame_size;i++)
+#ifdef FIXED_POINT
+         in[i*st->channels+c] = FLOAT2INT16(pcm[c][i]);
+#else
+         in[i*st->channels+c] = pcm[c][i];
+#endif
+#ifdef FIXED_POINT
+   ret = opus_encode_native(st, in, frame_size, data, max_data_bytes, 16,
+                            pcm, analysis_frame_size, 0, -2, st->channels, downmix_planar_float, 1);
+#else
+   ret = opus_encode_native(st, in, frame_size, data, max_data_bytes, 24,
+                            pcm, analysis_frame_size, 0, -2, st->channels, downmix_planar_float, 1);
+#endif
+   RESTORE_STACK;
+   return ret;
+}
+#endif
+
+
+/* The public entry points return OPUS_ALLOC_FAIL when the scratch arena
+   overflows, instead of aborting. */
+opus_int32 opus_encode(OpusEncoder *st, const opus_int16 *pcm, int analysis_frame_size,
+      unsigned char *data, opus_int32 max_data_bytes)
+{
+   opus_int32 ret;
+   SCRATCH_GUARD(ret, ret = opus_encode_impl(st, pcm, analysis_frame_size, data, max_data_bytes));
+   return ret;
+}
+
+opus_int32 opus_encode_planar(OpusEncoder *st, const opus_int16 * const *pcm,
+      int analysis_frame_size, unsigned char *data, opus_int32 max_data_bytes)
+{
+   opus_int32 ret;
+   SCRATCH_GUARD(ret, ret = opus_encode_planar_impl(st, pcm, analysis_frame_size, data, max_data_bytes));
+   return ret;
+}
+
+#ifndef DISABLE_FLOAT_API
+opus_int32 opus_encode_float(OpusEncoder *st, const float *pcm, int analysis_frame_size,
+      unsigned char *data, opus_int32 max_data_bytes)
+{
+   opus_int32 ret;
+   SCRATCH_GUARD(ret, ret = opus_encode_float_impl(st, pcm, analysis_frame_size, data, max_data_bytes));
+   return ret;
+}
+
+opus_int32 opus_encode_planar_float(OpusEncoder *st, const float * const *pcm,
+      int analysis_frame_size, unsigned char *data, opus_int32 max_data_bytes)
+{
+   opus_int32 ret;
+   SCRATCH_GUARD(ret, ret = opus_encode_planar_float_impl(st, pcm, analysis_frame_size, data, max_data_bytes));
+   return ret;
+}
+#endif
 
 int opus_encoder_ctl(OpusEncoder *st, int request, ...)
 {
@@ -2418,11 +2794,42 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
             {
                goto bad_arg;
             }
-            st->silk_mode.complexity = value;
-            celt_encoder_ctl(celt_enc, OPUS_SET_COMPLEXITY(value));
+            st->user_complexity = value;
+            set_effective_complexity(st, value);
         }
         break;
         case OPUS_GET_COMPLEXITY_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = st->user_complexity;
+        }
+        break;
+        case OPUS_SET_COMPLEXITY_BUDGET_REQUEST:
+        {
+            opus_int32 value = va_arg(ap, opus_int32);
+            if (value<0)
+            {
+               goto bad_arg;
+            }
+            st->complexity_budget = value;
+            set_effective_complexity(st, st->user_complexity);
+        }
+        break;
+        case OPUS_GET_COMPLEXITY_BUDGET_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+               goto bad_arg;
+            }
+            *value = st->complexity_budget;
+        }
+        break;
+        case OPUS_GET_EFFECTIVE_COMPLEXITY_REQUEST:
         {
             opus_int32 *value = va_arg(ap, opus_int32*);
             if (!value)
@@ -2564,6 +2971,9 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
             *value = st->Fs/400;
             if (st->application != OPUS_APPLICATION_RESTRICTED_LOWDELAY)
                 *value += st->delay_compensation;
+            /* Convert to 44.1 kHz samples, rounded, adding the converter. */
+            if (st->api_Fs != st->Fs)
+                *value = (*value*147 + RESAMPLE_44K1_UP_DELAY + 80)/160;
         }
         break;
         case OPUS_GET_SAMPLE_RATE_REQUEST:
@@ -2573,7 +2983,7 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
             {
                goto bad_arg;
             }
-            *value = st->Fs;
+            *value = st->api_Fs;
         }
         break;
         case OPUS_GET_FINAL_RANGE_REQUEST:
@@ -2688,6 +3098,9 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
            st->mode = MODE_HYBRID;
            st->bandwidth = OPUS_BANDWIDTH_FULLBAND;
            st->variable_HP_smth2_Q15 = silk_LSHIFT( silk_lin2log( VARIABLE_HP_MIN_CUTOFF_HZ ), 8 );
+           /* A call that ran out of scratch space may have stopped while
+              governed. */
+           st->governor_active = 0;
         }
         break;
         case OPUS_SET_FORCE_MODE_REQUEST:
@@ -2714,6 +3127,20 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
             ret = celt_encoder_ctl(celt_enc, OPUS_SET_ENERGY_MASK(value));
         }
         break;
+#ifndef DISABLE_FLOAT_API
+        case OPUS_SET_ANALYSIS_SHARE_REQUEST:
+        {
+            TonalityAnalysisShare *value = va_arg(ap, TonalityAnalysisShare*);
+            st->analysis_share = value;
+        }
+        break;
+#endif
+        case OPUS_SET_PITCH_SHARE_REQUEST:
+        {
+            CELTPitchShare *value = va_arg(ap, CELTPitchShare*);
+            ret = celt_encoder_ctl(celt_enc, CELT_SET_PITCH_SHARE(value));
+        }
+        break;
         case OPUS_GET_IN_DTX_REQUEST:
         {
             opus_int32 *value = va_arg(ap, opus_int32*);
@@ -2741,6 +3168,29 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
             }
         }
         break;
+        case OPUS_GET_PROFILE_STATS_REQUEST:
+        {
+            OpusProfileStats *value = va_arg(ap, OpusProfileStats*);
+            if (!value)
+            {
+                goto bad_arg;
+            }
+#ifdef ENABLE_PROFILE_STATS
+            *value = st->profile.stats;
+#else
+            ret = OPUS_UNIMPLEMENTED;
+#endif
+        }
+        break;
+        case OPUS_RESET_PROFILE_STATS:
+        {
+#ifdef ENABLE_PROFILE_STATS
+            OPUS_CLEAR(&st->profile.stats, 1);
+#else
+            ret = OPUS_UNIMPLEMENTED;
+#endif
+        }
+        break;
         case CELT_GET_MODE_REQUEST:
         {
            const CELTMode ** value = va_arg(ap, const CELTMode**);
@@ -0,0 +1,321 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdarg.h>
+#include "opus_group.h"
+#include "opus_private.h"
+#include "os_support.h"
+#include "arch.h"
+#ifndef DISABLE_FLOAT_API
+#include "analysis.h"
+#endif
+
+struct OpusGroupEncoder {
+   int renditions;
+   int channels;
+#ifndef DISABLE_FLOAT_API
+   /* Only valid during opus_group_encode*(). */
+   TonalityAnalysisShare analysis_share;
+#endif
+   CELTPitchShare pitch_share;
+   /* Encoder states go here */
+};
+
+static OpusEncoder *get_rendition(OpusGroupEncoder *st, int r)
+{
+   return (OpusEncoder*)((char*)st + align(sizeof(OpusGroupEncoder))
+         + r*align(opus_encoder_get_size(st->channels)));
+}
+
+opus_int32 opus_group_encoder_get_size(int channels, int renditions)
+{
+   int enc_size;
+   if (channels<1 || channels>2 || renditions<1 || renditions>255)
+      return 0;
+   enc_size = opus_encoder_get_size(channels);
+   if (!enc_size)
+      return 0;
+   return align(sizeof(OpusGroupEncoder)) + renditions*align(enc_size);
+}
+
+int opus_group_encoder_init(OpusGroupEncoder *st, opus_int32 Fs, int channels,
+      int renditions, const opus_int32 *bitrates, int application)
+{
+   int r;
+   if (channels<1 || channels>2 || renditions<1 || renditions>255)
+      return OPUS_BAD_ARG;
+   OPUS_CLEAR((char*)st, align(sizeof(OpusGroupEncoder)));
+   st->renditions = renditions;
+   st->channels = channels;
+   for (r=0;r<renditions;r++)
+   {
+      int ret;
+      OpusEncoder *enc = get_rendition(st, r);
+      ret = opus_encoder_init(enc, Fs, channels, application);
+      if (ret != OPUS_OK)
+         return ret;
+      if (bitrates)
+      {
+         ret = opus_encoder_ctl(enc, OPUS_SET_BITRATE(bitrates[r]));
+         if (ret != OPUS_OK)
+            return ret;
+      }
+   }
+   return OPUS_OK;
+}
+
+OpusGroupEncoder *opus_group_encoder_create(opus_int32 Fs, int channels,
+      int renditions, const opus_int32 *bitrates, int application, int *error)
+{
+   int ret;
+   opus_int32 size;
+   OpusGroupEncoder *st;
+   size = opus_group_encoder_get_size(channels, renditions);
+   if (!size)
+   {
+      if (error)
+         *error = OPUS_BAD_ARG;
+      return NULL;
+   }
+   st = (OpusGroupEncoder *)opus_alloc(size);
+   if (st == NULL)
+   {
+      if (error)
+         *error = OPUS_ALLOC_FAIL;
+      return NULL;
+   }
+   ret = opus_group_encoder_init(st, Fs, channels, renditions, bitrates, application);
+   if (error)
+      *error = ret;
+   if (ret != OPUS_OK)
+   {
+      opus_free(st);
+      st = NULL;
+   }
+   return st;
+}
+
+/* Encodes the renditions in order. The first one that runs the tonality
+   analysis on this frame publishes its state through analysis_share, and
+   the following ones copy it instead of analysing the same input again.
+   The coarse pitch search of the CELT prefilter is shared the same way
+   through pitch_share, whenever two renditions hold the same prefilter
+   history. */
+static int opus_group_encode_impl(OpusGroupEncoder *st, const void *pcm,
+      int frame_size, unsigned char *data, opus_int32 max_data_bytes,
+      opus_int32 *len, int float_api)
+{
+   int r;
+   int ret = OPUS_OK;
+   if (max_data_bytes <= 0)
+      return OPUS_BAD_ARG;
+#ifndef DISABLE_FLOAT_API
+   st->analysis_share.source = NULL;
+#endif
+   st->pitch_share.count = 0;
+   for (r=0;r<st->renditions;r++)
+   {
+      opus_int32 nb_bytes;
+      OpusEncoder *enc = get_rendition(st, r);
+      opus_encoder_ctl(enc, OPUS_SET_PITCH_SHARE(&st->pitch_share));
+#ifndef DISABLE_FLOAT_API
+      opus_encoder_ctl(enc, OPUS_SET_ANALYSIS_SHARE(&st->analysis_share));
+      if (float_api)
+         nb_bytes = opus_encode_float(enc, (const float*)pcm, frame_size,
+               data + r*max_data_bytes, max_data_bytes);
+      else
+#endif
+         nb_bytes = opus_encode(enc, (const opus_int16*)pcm, frame_size,
+               data + r*max_data_bytes, max_data_bytes);
+#ifndef DISABLE_FLOAT_API
+      opus_encoder_ctl(enc, OPUS_SET_ANALYSIS_SHARE((TonalityAnalysisShare*)NULL));
+#endif
+      opus_encoder_ctl(enc, OPUS_SET_PITCH_SHARE((CELTPitchShare*)NULL));
+      if (nb_bytes < 0)
+      {
+         ret = nb_bytes;
+         break;
+      }
+      len[r] = nb_bytes;
+   }
+#ifndef DISABLE_FLOAT_API
+   st->analysis_share.source = NULL;
+#else
+   (void)float_api;
+#endif
+   return ret;
+}
+
+int opus_group_encode(OpusGroupEncoder *st, const opus_int16 *pcm,
+      int frame_size, unsigned char *data, opus_int32 max_data_bytes,
+      opus_int32 *len)
+{
+   return opus_group_encode_impl(st, pcm, frame_size, data, max_data_bytes, len, 0);
+}
+
+#ifndef DISABLE_FLOAT_API
+int opus_group_encode_float(OpusGroupEncoder *st, const float *pcm,
+      int frame_size, unsigned char *data, opus_int32 max_data_bytes,
+      opus_int32 *len)
+{
+   return opus_group_encode_impl(st, pcm, frame_size, data, max_data_bytes, len, 1);
+}
+#endif
+
+int opus_group_encoder_ctl(OpusGroupEncoder *st, int request, ...)
+{
+   va_list ap;
+   int ret = OPUS_OK;
+   int r;
+   va_start(ap, request);
+   switch (request)
+   {
+   case OPUS_GROUP_GET_ENCODER_STATE_REQUEST:
+   {
+      opus_int32 rendition;
+      OpusEncoder **value;
+      rendition = va_arg(ap, opus_int32);
+      if (rendition<0 || rendition >= st->renditions)
+         goto bad_arg;
+      value = va_arg(ap, OpusEncoder**);
+      if (!value)
+         goto bad_arg;
+      *value = get_rendition(st, rendition);
+   }
+   break;
+   case OPUS_GET_BITRATE_REQUEST:
+   {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      if (!value)
+         goto bad_arg;
+      *value = 0;
+      for (r=0;r<st->renditions;r++)
+      {
+         opus_int32 rate;
+         ret = opus_encoder_ctl(get_rendition(st, r), request, &rate);
+         if (ret != OPUS_OK)
+            break;
+         *value += rate;
+      }
+   }
+   break;
+   case OPUS_GET_LSB_DEPTH_REQUEST:
+   case OPUS_GET_VBR_REQUEST:
+   case OPUS_GET_APPLICATION_REQUEST:
+   case OPUS_GET_BANDWIDTH_REQUEST:
+   case OPUS_GET_COMPLEXITY_REQUEST:
+   case OPUS_GET_COMPLEXITY_BUDGET_REQUEST:
+   case OPUS_GET_EFFECTIVE_COMPLEXITY_REQUEST:
+   case OPUS_GET_PACKET_LOSS_PERC_REQUEST:
+   case OPUS_GET_DTX_REQUEST:
+   case OPUS_GET_VBR_CONSTRAINT_REQUEST:
+   case OPUS_GET_SIGNAL_REQUEST:
+   case OPUS_GET_LOOKAHEAD_REQUEST:
+   case OPUS_GET_SAMPLE_RATE_REQUEST:
+   case OPUS_GET_INBAND_FEC_REQUEST:
+   case OPUS_GET_FORCE_CHANNELS_REQUEST:
+   case OPUS_GET_MAX_BANDWIDTH_REQUEST:
+   case OPUS_GET_EXPERT_FRAME_DURATION_REQUEST:
+   case OPUS_GET_PREDICTION_DISABLED_REQUEST:
+   case OPUS_GET_PHASE_INVERSION_DISABLED_REQUEST:
+   {
+      /* For int32* GET params, just query the first rendition */
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      ret = opus_encoder_ctl(get_rendition(st, 0), request, value);
+   }
+   break;
+   case OPUS_GET_FINAL_RANGE_REQUEST:
+   {
+      opus_uint32 *value = va_arg(ap, opus_uint32*);
+      opus_uint32 tmp;
+      if (!value)
+         goto bad_arg;
+      *value = 0;
+      for (r=0;r<st->renditions;r++)
+      {
+         ret = opus_encoder_ctl(get_rendition(st, r), request, &tmp);
+         if (ret != OPUS_OK)
+            break;
+         *value ^= tmp;
+      }
+   }
+   break;
+   case OPUS_SET_LSB_DEPTH_REQUEST:
+   case OPUS_SET_COMPLEXITY_REQUEST:
+   case OPUS_SET_COMPLEXITY_BUDGET_REQUEST:
+   case OPUS_SET_VBR_REQUEST:
+   case OPUS_SET_VBR_CONSTRAINT_REQUEST:
+   case OPUS_SET_MAX_BANDWIDTH_REQUEST:
+   case OPUS_SET_BANDWIDTH_REQUEST:
+   case OPUS_SET_SIGNAL_REQUEST:
+   case OPUS_SET_APPLICATION_REQUEST:
+   case OPUS_SET_INBAND_FEC_REQUEST:
+   case OPUS_SET_PACKET_LOSS_PERC_REQUEST:
+   case OPUS_SET_DTX_REQUEST:
+   case OPUS_SET_FORCE_CHANNELS_REQUEST:
+   case OPUS_SET_EXPERT_FRAME_DURATION_REQUEST:
+   case OPUS_SET_PREDICTION_DISABLED_REQUEST:
+   case OPUS_SET_PHASE_INVERSION_DISABLED_REQUEST:
+   {
+      /* This works for int32 params */
+      opus_int32 value = va_arg(ap, opus_int32);
+      for (r=0;r<st->renditions;r++)
+      {
+         ret = opus_encoder_ctl(get_rendition(st, r), request, value);
+         if (ret != OPUS_OK)
+            break;
+      }
+   }
+   break;
+   case OPUS_RESET_STATE:
+   {
+      for (r=0;r<st->renditions;r++)
+      {
+         ret = opus_encoder_ctl(get_rendition(st, r), OPUS_RESET_STATE);
+         if (ret != OPUS_OK)
+            break;
+      }
+   }
+   break;
+   default:
+      ret = OPUS_UNIMPLEMENTED;
+      break;
+   }
+   va_end(ap);
+   return ret;
+bad_arg:
+   va_end(ap);
+   return OPUS_BAD_ARG;
+}
+
+void opus_group_encoder_destroy(OpusGroupEncoder *st)
+{
+   opus_free(st);
+}
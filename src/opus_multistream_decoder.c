@@ -80,10 +80,15 @@ int opus_multistream_decoder_init(
    if ((channels>255) || (channels<1) || (coupled_streams>streams) ||
        (streams<1) || (coupled_streams<0) || (streams>255-coupled_streams))
       return OPUS_BAD_ARG;
+   /* The 44.1 kHz conversion is only done by the single-stream API. */
+   if (Fs==44100)
+      return OPUS_BAD_ARG;
 
    st->layout.nb_channels = channels;
    st->layout.nb_streams = streams;
    st->layout.nb_coupled_streams = coupled_streams;
+   st->executor = NULL;
+   st->executor_data = NULL;
 
    for (i=0;i<st->layout.nb_channels;i++)
       st->layout.mapping[i] = mapping[i];
@@ -146,8 +151,10 @@ OpusMSDecoder *opus_multistream_decoder_create(
    return st;
 }
 
+/* Checks that the packet holds nb_streams packets of the same duration, and
+   stores where each of them starts in offset[]. */
 static int opus_multistream_packet_validate(const unsigned char *data,
-      opus_int32 len, int nb_streams, opus_int32 Fs)
+      opus_int32 len, int nb_streams, opus_int32 Fs, opus_int32 *offset)
 {
    int s;
    int count;
@@ -155,10 +162,12 @@ static int opus_multistream_packet_validate(const unsigned char *data,
    opus_int16 size[48];
    int samples=0;
    opus_int32 packet_offset;
+   opus_int32 tot_offset=0;
 
    for (s=0;s<nb_streams;s++)
    {
       int tmp_samples;
+      offset[s] = tot_offset;
       if (len<=0)
          return OPUS_INVALID_PACKET;
       count = opus_packet_parse_impl(data, len, s!=nb_streams-1, &toc, NULL,
@@ -171,11 +180,240 @@ static int opus_multistream_packet_validate(const unsigned char *data,
       samples = tmp_samples;
       data += packet_offset;
       len -= packet_offset;
+      tot_offset += packet_offset;
    }
    return samples;
 }
 
-int opus_multistream_decode_native(
+#if !defined(DISABLE_FLOAT_API)
+static void opus_copy_channel_out_float(
+  void *dst,
+  int dst_stride,
+  int dst_channel,
+  const opus_val16 *src,
+  int src_stride,
+  int frame_size,
+  void *user_data
+)
+{
+   float *float_dst;
+   opus_int32 i;
+   (void)user_data;
+   float_dst = (float*)dst;
+   if (src != NULL)
+   {
+      for (i=0;i<frame_size;i++)
+#if defined(FIXED_POINT)
+         float_dst[i*dst_stride+dst_channel] = (1/32768.f)*src[i*src_stride];
+#else
+         float_dst[i*dst_stride+dst_channel] = src[i*src_stride];
+#endif
+   }
+   else
+   {
+      for (i=0;i<frame_size;i++)
+         float_dst[i*dst_stride+dst_channel] = 0;
+   }
+}
+#endif
+
+static void opus_copy_channel_out_short(
+  void *dst,
+  int dst_stride,
+  int dst_channel,
+  const opus_val16 *src,
+  int src_stride,
+  int frame_size,
+  void *user_data
+)
+{
+   opus_int16 *short_dst;
+   opus_int32 i;
+   (void)user_data;
+   short_dst = (opus_int16*)dst;
+   if (src != NULL)
+   {
+      for (i=0;i<frame_size;i++)
+#if defined(FIXED_POINT)
+         short_dst[i*dst_stride+dst_channel] = src[i*src_stride];
+#else
+         short_dst[i*dst_stride+dst_channel] = FLOAT2INT16(src[i*src_stride]);
+#endif
+   }
+   else
+   {
+      for (i=0;i<frame_size;i++)
+         short_dst[i*dst_stride+dst_channel] = 0;
+   }
+}
+
+
+#if !defined(DISABLE_FLOAT_API)
+static void opus_copy_channel_out_planar_float(
+  void *dst,
+  int dst_stride,
+  int dst_channel,
+  const opus_val16 *src,
+  int src_stride,
+  int frame_size,
+  void *user_data
+)
+{
+   float *float_dst;
+   opus_int32 i;
+   (void)dst_stride;
+   (void)user_data;
+   float_dst = ((float * const *)dst)[dst_channel];
+   if (src != NULL)
+   {
+      for (i=0;i<frame_size;i++)
+#if defined(FIXED_POINT)
+         float_dst[i] = (1/32768.f)*src[i*src_stride];
+#else
+         float_dst[i] = src[i*src_stride];
+#endif
+   }
+   else
+   {
+      for (i=0;i<frame_size;i++)
+         float_dst[i] = 0;
+   }
+}
+#endif
+
+static void opus_copy_channel_out_planar_short(
+  void *dst,
+  int dst_stride,
+  int dst_channel,
+  const opus_val16 *src,
+  int src_stride,
+  int frame_size,
+  void *user_data
+)
+{
+   opus_int16 *short_dst;
+   opus_int32 i;
+   (void)dst_stride;
+   (void)user_data;
+   short_dst = ((opus_int16 * const *)dst)[dst_channel];
+   if (src != NULL)
+   {
+      for (i=0;i<frame_size;i++)
+#if defined(FIXED_POINT)
+         short_dst[i] = src[i*src_stride];
+#else
+         short_dst[i] = FLOAT2INT16(src[i*src_stride]);
+#endif
+   }
+   else
+   {
+      for (i=0;i<frame_size;i++)
+         short_dst[i] = 0;
+   }
+}
+
+/* Decodes stream s from the packet at data and copies its channels to
+   where they belong in the interleaved output. Returns the number of
+   samples decoded, or a negative error code. */
+static int ms_decode_stream(
+      OpusMSDecoder *st,
+      OpusDecoder *dec,
+      int s,
+      const unsigned char *data,
+      opus_int32 len,
+      void *pcm,
+      opus_copy_channel_out_func copy_channel_out,
+      int frame_size,
+      int decode_fec,
+      int soft_clip,
+      void *user_data,
+      opus_int32 *packet_offset
+)
+{
+   int ret;
+   VARDECL(opus_val16, buf);
+   ALLOC_STACK;
+
+   ALLOC(buf, 2*frame_size, opus_val16);
+   *packet_offset = 0;
+   ret = opus_decode_native(dec, data, len, buf, frame_size, decode_fec,
+         s!=st->layout.nb_streams-1, packet_offset, soft_clip);
+   if (ret <= 0)
+   {
+      RESTORE_STACK;
+      return ret;
+   }
+   frame_size = ret;
+   if (s < st->layout.nb_coupled_streams)
+   {
+      int chan, prev;
+      prev = -1;
+      /* Copy "left" audio to the channel(s) where it belongs */
+      while ( (chan = get_left_channel(&st->layout, s, prev)) != -1)
+      {
+         (*copy_channel_out)(pcm, st->layout.nb_channels, chan,
+            buf, 2, frame_size, user_data);
+         prev = chan;
+      }
+      prev = -1;
+      /* Copy "right" audio to the channel(s) where it belongs */
+      while ( (chan = get_right_channel(&st->layout, s, prev)) != -1)
+      {
+         (*copy_channel_out)(pcm, st->layout.nb_channels, chan,
+            buf+1, 2, frame_size, user_data);
+         prev = chan;
+      }
+   } else {
+      int chan, prev;
+      prev = -1;
+      /* Copy audio to the channel(s) where it belongs */
+      while ( (chan = get_mono_channel(&st->layout, s, prev)) != -1)
+      {
+         (*copy_channel_out)(pcm, st->layout.nb_channels, chan,
+            buf, 1, frame_size, user_data);
+         prev = chan;
+      }
+   }
+   RESTORE_STACK;
+   return ret;
+}
+
+typedef struct {
+   OpusMSDecoder *st;
+   OpusDecoder **dec;
+   const unsigned char *data;
+   opus_int32 len;
+   const opus_int32 *offset;
+   void *pcm;
+   opus_copy_channel_out_func copy_channel_out;
+   int frame_size;
+   int decode_fec;
+   int soft_clip;
+   void *user_data;
+   int *ret;
+} MSDecodeJob;
+
+/* Executor job: decodes stream s straight into its channels of the
+   interleaved output. */
+static void ms_decode_job(void *arg, int s)
+{
+   MSDecodeJob *job = (MSDecodeJob*)arg;
+   opus_int32 packet_offset;
+   int ret;
+   /* The job may run on another thread, with its own arena. */
+   if (job->len == 0)
+      SCRATCH_GUARD(ret, ret = ms_decode_stream(job->st, job->dec[s], s, job->data, 0,
+            job->pcm, job->copy_channel_out, job->frame_size, job->decode_fec,
+            job->soft_clip, job->user_data, &packet_offset));
+   else
+      SCRATCH_GUARD(ret, ret = ms_decode_stream(job->st, job->dec[s], s,
+            job->data + job->offset[s], job->len - job->offset[s],
+            job->pcm, job->copy_channel_out, job->frame_size, job->decode_fec,
+            job->soft_clip, job->user_data, &packet_offset));
+   job->ret[s] = ret;
+}
+
+static int multistream_decode_impl(
       OpusMSDecoder *st,
       const unsigned char *data,
       opus_int32 len,
@@ -193,7 +431,8 @@ int opus_multistream_decode_native(
    int s, c;
    char *ptr;
    int do_plc=0;
-   VARDECL(opus_val16, buf);
+   int parallel;
+   VARDECL(opus_int32, offset);
    ALLOC_STACK;
 
    VALIDATE_MS_DECODER(st);
@@ -205,7 +444,7 @@ int opus_multistream_decode_native(
    /* Limit frame_size to avoid excessive stack allocations. */
    MUST_SUCCEED(opus_multistream_decoder_ctl(st, OPUS_GET_SAMPLE_RATE(&Fs)));
    frame_size = IMIN(frame_size, Fs/25*3);
-   ALLOC(buf, 2*frame_size, opus_val16);
+   ALLOC(offset, st->layout.nb_streams, opus_int32);
    ptr = (char*)st + align(sizeof(OpusMSDecoder));
    coupled_size = opus_decoder_get_size(2);
    mono_size = opus_decoder_get_size(1);
@@ -224,7 +463,7 @@ int opus_multistream_decode_native(
    }
    if (!do_plc)
    {
-      int ret = opus_multistream_packet_validate(data, len, st->layout.nb_streams, Fs);
+      int ret = opus_multistream_packet_validate(data, len, st->layout.nb_streams, Fs, offset);
       if (ret < 0)
       {
          RESTORE_STACK;
@@ -235,62 +474,87 @@ int opus_multistream_decode_native(
          return OPUS_BUFFER_TOO_SMALL;
       }
    }
-   for (s=0;s<st->layout.nb_streams;s++)
+   /* The streams can be decoded independently once the validation above has
+      located each of them in the packet. This is only done when the output
+      copy writes to nothing but the channel it is given, so that the jobs
+      can write concurrently into the interleaved output. */
+   parallel = st->executor != NULL && st->layout.nb_streams > 1
+         && (copy_channel_out == opus_copy_channel_out_short
+         || copy_channel_out == opus_copy_channel_out_planar_short
+#if !defined(DISABLE_FLOAT_API)
+         || copy_channel_out == opus_copy_channel_out_float
+         || copy_channel_out == opus_copy_channel_out_planar_float
+#endif
+         );
+   if (parallel)
    {
-      OpusDecoder *dec;
-      opus_int32 packet_offset;
-      int ret;
-
-      dec = (OpusDecoder*)ptr;
-      ptr += (s < st->layout.nb_coupled_streams) ? align(coupled_size) : align(mono_size);
-
-      if (!do_plc && len<=0)
+      MSDecodeJob job;
+      VARDECL(OpusDecoder*, dec);
+      VARDECL(int, ret);
+      ALLOC(dec, st->layout.nb_streams, OpusDecoder*);
+      ALLOC(ret, st->layout.nb_streams, int);
+      for (s=0;s<st->layout.nb_streams;s++)
       {
-         RESTORE_STACK;
-         return OPUS_INTERNAL_ERROR;
+         dec[s] = (OpusDecoder*)ptr;
+         ptr += (s < st->layout.nb_coupled_streams) ? align(coupled_size) : align(mono_size);
       }
-      packet_offset = 0;
-      ret = opus_decode_native(dec, data, len, buf, frame_size, decode_fec, s!=st->layout.nb_streams-1, &packet_offset, soft_clip);
-      if (!do_plc)
+      job.st = st;
+      job.dec = dec;
+      job.data = data;
+      job.len = do_plc ? 0 : len;
+      job.offset = offset;
+      job.pcm = pcm;
+      job.copy_channel_out = copy_channel_out;
+      job.frame_size = frame_size;
+      job.decode_fec = decode_fec;
+      job.soft_clip = soft_clip;
+      job.user_data = user_data;
+      job.ret = ret;
+      (*st->executor)(st->executor_data, ms_decode_job, &job, st->layout.nb_streams);
+      /* Report the first failure in stream order, as the serial path would
+         (although the later streams have been decoded regardless). */
+      for (s=0;s<st->layout.nb_streams;s++)
       {
-        data += packet_offset;
-        len -= packet_offset;
-      }
-      if (ret <= 0)
-      {
-         RESTORE_STACK;
-         return ret;
+         if (ret[s] <= 0)
+         {
+            RESTORE_STACK;
+            return ret[s];
+         }
+         if (ret[s] != ret[0])
+         {
+            RESTORE_STACK;
+            return OPUS_INTERNAL_ERROR;
+         }
       }
-      frame_size = ret;
-      if (s < st->layout.nb_coupled_streams)
+      frame_size = ret[0];
+   } else {
+      for (s=0;s<st->layout.nb_streams;s++)
       {
-         int chan, prev;
-         prev = -1;
-         /* Copy "left" audio to the channel(s) where it belongs */
-         while ( (chan = get_left_channel(&st->layout, s, prev)) != -1)
+         OpusDecoder *dec;
+         opus_int32 packet_offset;
+         int ret;
+
+         dec = (OpusDecoder*)ptr;
+         ptr += (s < st->layout.nb_coupled_streams) ? align(coupled_size) : align(mono_size);
+
+         if (!do_plc && len<=0)
          {
-            (*copy_channel_out)(pcm, st->layout.nb_channels, chan,
-               buf, 2, frame_size, user_data);
-            prev = chan;
+            RESTORE_STACK;
+            return OPUS_INTERNAL_ERROR;
          }
-         prev = -1;
-         /* Copy "right" audio to the channel(s) where it belongs */
-         while ( (chan = get_right_channel(&st->layout, s, prev)) != -1)
+         ret = ms_decode_stream(st, dec, s, data, len, pcm, copy_channel_out,
+               frame_size, decode_fec, soft_clip, user_data, &packet_offset);
+         if (!do_plc)
          {
-            (*copy_channel_out)(pcm, st->layout.nb_channels, chan,
-               buf+1, 2, frame_size, user_data);
-            prev = chan;
+           data += packet_offset;
+           len -= packet_offset;
          }
-      } else {
-         int chan, prev;
-         prev = -1;
-         /* Copy audio to the channel(s) where it belongs */
-         while ( (chan = get_mono_channel(&st->layout, s, prev)) != -1)
+         if (ret <= 0)
          {
-            (*copy_channel_out)(pcm, st->layout.nb_channels, chan,
-               buf, 1, frame_size, user_data);
-            prev = chan;
+            RESTORE_STACK;
+            return ret;
          }
+         frame_size = ret;
       }
    }
    /* Handle muted channels */
@@ -306,70 +570,26 @@ int opus_multistream_decode_native(
    return frame_size;
 }
 
-#if !defined(DISABLE_FLOAT_API)
-static void opus_copy_channel_out_float(
-  void *dst,
-  int dst_stride,
-  int dst_channel,
-  const opus_val16 *src,
-  int src_stride,
-  int frame_size,
-  void *user_data
-)
-{
-   float *float_dst;
-   opus_int32 i;
-   (void)user_data;
-   float_dst = (float*)dst;
-   if (src != NULL)
-   {
-      for (i=0;i<frame_size;i++)
-#if defined(FIXED_POINT)
-         float_dst[i*dst_stride+dst_channel] = (1/32768.f)*src[i*src_stride];
-#else
-         float_dst[i*dst_stride+dst_channel] = src[i*src_stride];
-#endif
-   }
-   else
-   {
-      for (i=0;i<frame_size;i++)
-         float_dst[i*dst_stride+dst_channel] = 0;
-   }
-}
-#endif
-
-static void opus_copy_channel_out_short(
-  void *dst,
-  int dst_stride,
-  int dst_channel,
-  const opus_val16 *src,
-  int src_stride,
-  int frame_size,
-  void *user_data
+/* Returns OPUS_ALLOC_FAIL when the scratch arena overflows, instead of
+   aborting. */
+int opus_multistream_decode_native(
+      OpusMSDecoder *st,
+      const unsigned char *data,
+      opus_int32 len,
+      void *pcm,
+      opus_copy_channel_out_func copy_channel_out,
+      int frame_size,
+      int decode_fec,
+      int soft_clip,
+      void *user_data
 )
 {
-   opus_int16 *short_dst;
-   opus_int32 i;
-   (void)user_data;
-   short_dst = (opus_int16*)dst;
-   if (src != NULL)
-   {
-      for (i=0;i<frame_size;i++)
-#if defined(FIXED_POINT)
-         short_dst[i*dst_stride+dst_channel] = src[i*src_stride];
-#else
-         short_dst[i*dst_stride+dst_channel] = FLOAT2INT16(src[i*src_stride]);
-#endif
-   }
-   else
-   {
-      for (i=0;i<frame_size;i++)
-         short_dst[i*dst_stride+dst_channel] = 0;
-   }
+   int ret;
+   SCRATCH_GUARD(ret, ret = multistream_decode_impl(st, data, len, pcm,
+         copy_channel_out, frame_size, decode_fec, soft_clip, user_data));
+   return ret;
 }
 
-
-
 #ifdef FIXED_POINT
 int opus_multistream_decode(
       OpusMSDecoder *st,
@@ -416,6 +636,39 @@ int opus_multistream_decode_float(
 }
 #endif
 
+int opus_multistream_decode_planar(
+      OpusMSDecoder *st,
+      const unsigned char *data,
+      opus_int32 len,
+      opus_int16 * const *pcm,
+      int frame_size,
+      int decode_fec
+)
+{
+#ifdef FIXED_POINT
+   return opus_multistream_decode_native(st, data, len,
+       (void*)pcm, opus_copy_channel_out_planar_short, frame_size, decode_fec, 0, NULL);
+#else
+   return opus_multistream_decode_native(st, data, len,
+       (void*)pcm, opus_copy_channel_out_planar_short, frame_size, decode_fec, 1, NULL);
+#endif
+}
+
+#ifndef DISABLE_FLOAT_API
+int opus_multistream_decode_planar_float(
+      OpusMSDecoder *st,
+      const unsigned char *data,
+      opus_int32 len,
+      float * const *pcm,
+      int frame_size,
+      int decode_fec
+)
+{
+   return opus_multistream_decode_native(st, data, len,
+       (void*)pcm, opus_copy_channel_out_planar_float, frame_size, decode_fec, 0, NULL);
+}
+#endif
+
 int opus_multistream_decoder_ctl_va_list(OpusMSDecoder *st, int request,
                                          va_list ap)
 {
@@ -433,6 +686,7 @@ int opus_multistream_decoder_ctl_va_list(OpusMSDecoder *st, int request,
        case OPUS_GET_GAIN_REQUEST:
        case OPUS_GET_LAST_PACKET_DURATION_REQUEST:
        case OPUS_GET_PHASE_INVERSION_DISABLED_REQUEST:
+       case OPUS_GET_REDUCED_SYNTHESIS_REQUEST:
        {
           OpusDecoder *dec;
           /* For int32* GET params, just query the first stream */
@@ -483,6 +737,54 @@ int opus_multistream_decoder_ctl_va_list(OpusMSDecoder *st, int request,
           }
        }
        break;
+       case OPUS_GET_PROFILE_STATS_REQUEST:
+       {
+          int s, i;
+          OpusProfileStats *value = va_arg(ap, OpusProfileStats*);
+          OpusProfileStats tmp;
+          if (!value)
+          {
+             goto bad_arg;
+          }
+          OPUS_CLEAR(value, 1);
+          for (s=0;s<st->layout.nb_streams;s++)
+          {
+             OpusDecoder *dec;
+
+             dec = (OpusDecoder*)ptr;
+             if (s < st->layout.nb_coupled_streams)
+                ptr += align(coupled_size);
+             else
+                ptr += align(mono_size);
+             ret = opus_decoder_ctl(dec, OPUS_GET_PROFILE_STATS(&tmp));
+             if (ret != OPUS_OK)
+                break;
+             for (i=0;i<OPUS_PROFILE_NB_STAGES;i++)
+             {
+                value->ticks[i] += tmp.ticks[i];
+                value->calls[i] += tmp.calls[i];
+             }
+          }
+       }
+       break;
+       case OPUS_RESET_PROFILE_STATS:
+       {
+          int s;
+          for (s=0;s<st->layout.nb_streams;s++)
+          {
+             OpusDecoder *dec;
+
+             dec = (OpusDecoder*)ptr;
+             if (s < st->layout.nb_coupled_streams)
+                ptr += align(coupled_size);
+             else
+                ptr += align(mono_size);
+             ret = opus_decoder_ctl(dec, OPUS_RESET_PROFILE_STATS);
+             if (ret != OPUS_OK)
+                break;
+          }
+       }
+       break;
        case OPUS_MULTISTREAM_GET_DECODER_STATE_REQUEST:
        {
           int s;
@@ -508,6 +810,7 @@ int opus_multistream_decoder_ctl_va_list(OpusMSDecoder *st, int request,
        break;
        case OPUS_SET_GAIN_REQUEST:
        case OPUS_SET_PHASE_INVERSION_DISABLED_REQUEST:
+       case OPUS_SET_REDUCED_SYNTHESIS_REQUEST:
        {
           int s;
           /* This works for int32 params */
@@ -527,6 +830,12 @@ int opus_multistream_decoder_ctl_va_list(OpusMSDecoder *st, int request,
           }
        }
        break;
+       case OPUS_MULTISTREAM_SET_EXECUTOR_REQUEST:
+       {
+          st->executor = va_arg(ap, opus_executor_func);
+          st->executor_data = va_arg(ap, void*);
+       }
+       break;
        default:
           ret = OPUS_UNIMPLEMENTED;
        break;
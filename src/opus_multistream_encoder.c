@@ -445,6 +445,9 @@ static int opus_multistream_encoder_init_impl(
    if ((channels>255) || (channels<1) || (coupled_streams>streams) ||
        (streams<1) || (coupled_streams<0) || (streams>255-coupled_streams))
       return OPUS_BAD_ARG;
+   /* The 44.1 kHz conversion is only done by the single-stream API. */
+   if (Fs==44100)
+      return OPUS_BAD_ARG;
 
    st->arch = opus_select_arch();
    st->layout.nb_channels = channels;
@@ -453,6 +456,9 @@ static int opus_multistream_encoder_init_impl(
    if (mapping_type != MAPPING_TYPE_SURROUND)
       st->lfe_stream = -1;
    st->bitrate_bps = OPUS_AUTO;
+   st->executor = NULL;
+   st->executor_data = NULL;
+   st->executor_buf = NULL;
    st->application = application;
    st->variable_duration = OPUS_FRAMESIZE_ARG;
    for (i=0;i<st->layout.nb_channels;i++)
@@ -798,7 +804,123 @@ static opus_int32 rate_allocation(
 
 /* Max size in case the encoder decides to return six frames (6 x 20 ms = 120 ms) */
 #define MS_FRAME_TMP (6*1275+12)
-int opus_multistream_encode_native
+
+/* Number of bytes stream s may use, given the tot_size bytes already taken
+   by the streams before it. */
+static opus_int32 ms_stream_budget(const OpusMSEncoder *st, int s,
+      opus_int32 max_data_bytes, opus_int32 tot_size, opus_int32 Fs, int frame_size)
+{
+   opus_int32 curr_max;
+   /* number of bytes left (+Toc) */
+   curr_max = max_data_bytes - tot_size;
+   /* Reserve one byte for the last stream and two for the others */
+   curr_max -= IMAX(0,2*(st->layout.nb_streams-s-1)-1);
+   /* For 100 ms, reserve an extra byte per stream for the ToC */
+   if (Fs/frame_size == 10)
+     curr_max -= st->layout.nb_streams-s-1;
+   curr_max = IMIN(curr_max,MS_FRAME_TMP);
+   /* Repacketizer will add one or two bytes for self-delimited frames */
+   if (s != st->layout.nb_streams-1) curr_max -=  curr_max>253 ? 2 : 1;
+   return curr_max;
+}
+
+/* Gathers the input channels of one stream and encodes them. */
+static int ms_encode_stream(
+    OpusMSEncoder *st,
+    OpusEncoder *enc,
+    int s,
+    opus_copy_channel_in_func copy_channel_in,
+    const void *pcm,
+    int analysis_frame_size,
+    int frame_size,
+    unsigned char *data,
+    opus_int32 max_data_bytes,
+    int lsb_depth,
+    downmix_func downmix,
+    int float_api,
+    void *user_data,
+    const opus_val16 *bandSMR
+)
+{
+   int c1, c2;
+   int ret;
+   VARDECL(opus_val16, buf);
+   opus_val16 bandLogE[42];
+   ALLOC_STACK;
+
+   ALLOC(buf, 2*frame_size, opus_val16);
+   if (s < st->layout.nb_coupled_streams)
+   {
+      int i;
+      int left, right;
+      left = get_left_channel(&st->layout, s, -1);
+      right = get_right_channel(&st->layout, s, -1);
+      (*copy_channel_in)(buf, 2,
+         pcm, st->layout.nb_channels, left, frame_size, user_data);
+      (*copy_channel_in)(buf+1, 2,
+         pcm, st->layout.nb_channels, right, frame_size, user_data);
+      if (st->mapping_type == MAPPING_TYPE_SURROUND)
+      {
+         for (i=0;i<21;i++)
+         {
+            bandLogE[i] = bandSMR[21*left+i];
+            bandLogE[21+i] = bandSMR[21*right+i];
+         }
+      }
+      c1 = left;
+      c2 = right;
+   } else {
+      int i;
+      int chan = get_mono_channel(&st->layout, s, -1);
+      (*copy_channel_in)(buf, 1,
+         pcm, st->layout.nb_channels, chan, frame_size, user_data);
+      if (st->mapping_type == MAPPING_TYPE_SURROUND)
+      {
+         for (i=0;i<21;i++)
+            bandLogE[i] = bandSMR[21*chan+i];
+      }
+      c1 = chan;
+      c2 = -1;
+   }
+   if (st->mapping_type == MAPPING_TYPE_SURROUND)
+      opus_encoder_ctl(enc, OPUS_SET_ENERGY_MASK(bandLogE));
+   ret = opus_encode_native(enc, buf, frame_size, data, max_data_bytes, lsb_depth,
+         pcm, analysis_frame_size, c1, c2, st->layout.nb_channels, downmix, float_api);
+   RESTORE_STACK;
+   return ret;
+}
+
+typedef struct {
+   OpusMSEncoder *st;
+   OpusEncoder **enc;
+   opus_copy_channel_in_func copy_channel_in;
+   const void *pcm;
+   int analysis_frame_size;
+   int frame_size;
+   const opus_int32 *curr_max;
+   int lsb_depth;
+   downmix_func downmix;
+   int float_api;
+   void *user_data;
+   const opus_val16 *bandSMR;
+   int *len;
+} MSEncodeJob;
+
+/* Executor job: encodes stream s into its own MS_FRAME_TMP slot of the
+   encoder's executor buffer. */
+static void ms_encode_job(void *arg, int s)
+{
+   MSEncodeJob *job = (MSEncodeJob*)arg;
+   int ret;
+   /* The job may run on another thread, with its own arena. */
+   SCRATCH_GUARD(ret, ret = ms_encode_stream(job->st, job->enc[s], s, job->copy_channel_in,
+         job->pcm, job->analysis_frame_size, job->frame_size,
+         job->st->executor_buf + s*MS_FRAME_TMP, job->curr_max[s], job->lsb_depth,
+         job->downmix, job->float_api, job->user_data, job->bandSMR));
+   job->len[s] = ret;
+}
+
+static int multistream_encode_impl
 (
     OpusMSEncoder *st,
     opus_copy_channel_in_func copy_channel_in,
@@ -818,19 +940,23 @@ int opus_multistream_encode_native
    int s;
    char *ptr;
    int tot_size;
-   VARDECL(opus_val16, buf);
    VARDECL(opus_val16, bandSMR);
+   VARDECL(OpusEncoder*, enc);
+   VARDECL(opus_int32, curr_max);
+   VARDECL(int, len);
    unsigned char tmp_data[MS_FRAME_TMP];
+   unsigned char *out;
    OpusRepacketizer rp;
    opus_int32 vbr;
    const CELTMode *celt_mode;
    opus_int32 bitrates[256];
-   opus_val16 bandLogE[42];
    opus_val32 *mem = NULL;
    opus_val32 *preemph_mem=NULL;
    int frame_size;
    opus_int32 rate_sum;
    opus_int32 smallest_packet;
+   int parallel;
+   opus_int32 worst_size;
    ALLOC_STACK;
 
    if (st->mapping_type == MAPPING_TYPE_SURROUND)
@@ -861,7 +987,6 @@ int opus_multistream_encode_native
       RESTORE_STACK;
       return OPUS_BUFFER_TOO_SMALL;
    }
-   ALLOC(buf, 2*frame_size, opus_val16);
    coupled_size = opus_encoder_get_size(2);
    mono_size = opus_encoder_get_size(1);
 
@@ -885,16 +1010,16 @@ int opus_multistream_encode_native
                           3*st->bitrate_bps/(3*8*Fs/frame_size)));
       }
    }
+   ALLOC(enc, st->layout.nb_streams, OpusEncoder*);
    ptr = (char*)st + align(sizeof(OpusMSEncoder));
    for (s=0;s<st->layout.nb_streams;s++)
    {
-      OpusEncoder *enc;
-      enc = (OpusEncoder*)ptr;
+      enc[s] = (OpusEncoder*)ptr;
       if (s < st->layout.nb_coupled_streams)
          ptr += align(coupled_size);
       else
          ptr += align(mono_size);
-      opus_encoder_ctl(enc, OPUS_SET_BITRATE(bitrates[s]));
+      opus_encoder_ctl(enc[s], OPUS_SET_BITRATE(bitrates[s]));
       if (st->mapping_type == MAPPING_TYPE_SURROUND)
       {
          opus_int32 equiv_rate;
@@ -902,98 +1027,102 @@ int opus_multistream_encode_native
          if (frame_size*50 < Fs)
             equiv_rate -= 60*(Fs/frame_size - 50)*st->layout.nb_channels;
          if (equiv_rate > 10000*st->layout.nb_channels)
-            opus_encoder_ctl(enc, OPUS_SET_BANDWIDTH(OPUS_BANDWIDTH_FULLBAND));
+            opus_encoder_ctl(enc[s], OPUS_SET_BANDWIDTH(OPUS_BANDWIDTH_FULLBAND));
          else if (equiv_rate > 7000*st->layout.nb_channels)
-            opus_encoder_ctl(enc, OPUS_SET_BANDWIDTH(OPUS_BANDWIDTH_SUPERWIDEBAND));
+            opus_encoder_ctl(enc[s], OPUS_SET_BANDWIDTH(OPUS_BANDWIDTH_SUPERWIDEBAND));
          else if (equiv_rate > 5000*st->layout.nb_channels)
-            opus_encoder_ctl(enc, OPUS_SET_BANDWIDTH(OPUS_BANDWIDTH_WIDEBAND));
+            opus_encoder_ctl(enc[s], OPUS_SET_BANDWIDTH(OPUS_BANDWIDTH_WIDEBAND));
          else
-            opus_encoder_ctl(enc, OPUS_SET_BANDWIDTH(OPUS_BANDWIDTH_NARROWBAND));
+            opus_encoder_ctl(enc[s], OPUS_SET_BANDWIDTH(OPUS_BANDWIDTH_NARROWBAND));
          if (s < st->layout.nb_coupled_streams)
          {
             /* To preserve the spatial image, force stereo CELT on coupled streams */
-            opus_encoder_ctl(enc, OPUS_SET_FORCE_MODE(MODE_CELT_ONLY));
-            opus_encoder_ctl(enc, OPUS_SET_FORCE_CHANNELS(2));
+            opus_encoder_ctl(enc[s], OPUS_SET_FORCE_MODE(MODE_CELT_ONLY));
+            opus_encoder_ctl(enc[s], OPUS_SET_FORCE_CHANNELS(2));
          }
       }
       else if (st->mapping_type == MAPPING_TYPE_AMBISONICS) {
-        opus_encoder_ctl(enc, OPUS_SET_FORCE_MODE(MODE_CELT_ONLY));
+        opus_encoder_ctl(enc[s], OPUS_SET_FORCE_MODE(MODE_CELT_ONLY));
       }
    }
 
-   ptr = (char*)st + align(sizeof(OpusMSEncoder));
+   /* The streams can be encoded independently when none of them would
+      encode differently depending on the size of the streams before it.
+      A stream's packet does not change once its byte budget reaches
+      opus_encoder_packet_bound(), so that holds if its budget stays at least
+      that large (or does not change) even when every earlier stream takes
+      its largest packet plus the self-delimiting length. In CBR the last
+      stream is sized to fill what the others left, so it is always encoded
+      below, after the others. Each stream is encoded into its own slot of
+      executor_buf, and the packets are assembled in order below. */
+   ALLOC(curr_max, st->layout.nb_streams, opus_int32);
+   ALLOC(len, st->layout.nb_streams, int);
+   parallel = st->executor != NULL ? st->layout.nb_streams - !vbr : 0;
+   worst_size = 0;
+   for (s=0;s<parallel;s++)
+   {
+      curr_max[s] = IMIN(ms_stream_budget(st, s, max_data_bytes, 0, Fs, frame_size),
+            opus_encoder_packet_bound(enc[s], frame_size));
+      if (curr_max[s] > ms_stream_budget(st, s, max_data_bytes, worst_size, Fs, frame_size))
+         parallel = 0;
+      worst_size += opus_encoder_packet_bound(enc[s], frame_size) + 2;
+   }
+   if (parallel < 2)
+      parallel = 0;
+   if (parallel)
+   {
+      MSEncodeJob job;
+      job.st = st;
+      job.enc = enc;
+      job.copy_channel_in = copy_channel_in;
+      job.pcm = pcm;
+      job.analysis_frame_size = analysis_frame_size;
+      job.frame_size = frame_size;
+      job.curr_max = curr_max;
+      job.lsb_depth = lsb_depth;
+      job.downmix = downmix;
+      job.float_api = float_api;
+      job.user_data = user_data;
+      job.bandSMR = bandSMR;
+      job.len = len;
+      (*st->executor)(st->executor_data, ms_encode_job, &job, parallel);
+   }
+
+   out = data;
    /* Counting ToC */
    tot_size = 0;
    for (s=0;s<st->layout.nb_streams;s++)
    {
-      OpusEncoder *enc;
-      int len;
-      int curr_max;
-      int c1, c2;
       int ret;
 
       opus_repacketizer_init(&rp);
-      enc = (OpusEncoder*)ptr;
-      if (s < st->layout.nb_coupled_streams)
+      if (s < parallel)
       {
-         int i;
-         int left, right;
-         left = get_left_channel(&st->layout, s, -1);
-         right = get_right_channel(&st->layout, s, -1);
-         (*copy_channel_in)(buf, 2,
-            pcm, st->layout.nb_channels, left, frame_size, user_data);
-         (*copy_channel_in)(buf+1, 2,
-            pcm, st->layout.nb_channels, right, frame_size, user_data);
-         ptr += align(coupled_size);
-         if (st->mapping_type == MAPPING_TYPE_SURROUND)
+         celt_assert(curr_max[s] <= ms_stream_budget(st, s, max_data_bytes,
+               tot_size, Fs, frame_size));
+         if (len[s]<0)
          {
-            for (i=0;i<21;i++)
-            {
-               bandLogE[i] = bandSMR[21*left+i];
-               bandLogE[21+i] = bandSMR[21*right+i];
-            }
+            RESTORE_STACK;
+            return len[s];
          }
-         c1 = left;
-         c2 = right;
+         OPUS_COPY(tmp_data, st->executor_buf + s*MS_FRAME_TMP, len[s]);
       } else {
-         int i;
-         int chan = get_mono_channel(&st->layout, s, -1);
-         (*copy_channel_in)(buf, 1,
-            pcm, st->layout.nb_channels, chan, frame_size, user_data);
-         ptr += align(mono_size);
-         if (st->mapping_type == MAPPING_TYPE_SURROUND)
+         curr_max[s] = ms_stream_budget(st, s, max_data_bytes, tot_size, Fs, frame_size);
+         if (!vbr && s == st->layout.nb_streams-1)
+            opus_encoder_ctl(enc[s], OPUS_SET_BITRATE(curr_max[s]*(8*Fs/frame_size)));
+         len[s] = ms_encode_stream(st, enc[s], s, copy_channel_in, pcm,
+               analysis_frame_size, frame_size, tmp_data, curr_max[s], lsb_depth,
+               downmix, float_api, user_data, bandSMR);
+         if (len[s]<0)
          {
-            for (i=0;i<21;i++)
-               bandLogE[i] = bandSMR[21*chan+i];
+            RESTORE_STACK;
+            return len[s];
          }
-         c1 = chan;
-         c2 = -1;
-      }
-      if (st->mapping_type == MAPPING_TYPE_SURROUND)
-         opus_encoder_ctl(enc, OPUS_SET_ENERGY_MASK(bandLogE));
-      /* number of bytes left (+Toc) */
-      curr_max = max_data_bytes - tot_size;
-      /* Reserve one byte for the last stream and two for the others */
-      curr_max -= IMAX(0,2*(st->layout.nb_streams-s-1)-1);
-      /* For 100 ms, reserve an extra byte per stream for the ToC */
-      if (Fs/frame_size == 10)
-        curr_max -= st->layout.nb_streams-s-1;
-      curr_max = IMIN(curr_max,MS_FRAME_TMP);
-      /* Repacketizer will add one or two bytes for self-delimited frames */
-      if (s != st->layout.nb_streams-1) curr_max -=  curr_max>253 ? 2 : 1;
-      if (!vbr && s == st->layout.nb_streams-1)
-         opus_encoder_ctl(enc, OPUS_SET_BITRATE(curr_max*(8*Fs/frame_size)));
-      len = opus_encode_native(enc, buf, frame_size, tmp_data, curr_max, lsb_depth,
-            pcm, analysis_frame_size, c1, c2, st->layout.nb_channels, downmix, float_api);
-      if (len<0)
-      {
-         RESTORE_STACK;
-         return len;
       }
       /* We need to use the repacketizer to add the self-delimiting lengths
          while taking into account the fact that the encoder can now return
          more than one frame at a time (e.g. 60 ms CELT-only) */
-      ret = opus_repacketizer_cat(&rp, tmp_data, len);
+      ret = opus_repacketizer_cat(&rp, tmp_data, len[s]);
       /* If the opus_repacketizer_cat() fails, then something's seriously wrong
          with the encoder. */
       if (ret != OPUS_OK)
@@ -1001,16 +1130,39 @@ int opus_multistream_encode_native
          RESTORE_STACK;
          return OPUS_INTERNAL_ERROR;
       }
-      len = opus_repacketizer_out_range_impl(&rp, 0, opus_repacketizer_get_nb_frames(&rp),
-            data, max_data_bytes-tot_size, s != st->layout.nb_streams-1, !vbr && s == st->layout.nb_streams-1);
-      data += len;
-      tot_size += len;
+      ret = opus_repacketizer_out_range_impl(&rp, 0, opus_repacketizer_get_nb_frames(&rp),
+            out, max_data_bytes-tot_size, s != st->layout.nb_streams-1, !vbr && s == st->layout.nb_streams-1);
+      out += ret;
+      tot_size += ret;
    }
    /*printf("\n");*/
    RESTORE_STACK;
    return tot_size;
 }
 
+/* Returns OPUS_ALLOC_FAIL when the scratch arena overflows, instead of
+   aborting. */
+int opus_multistream_encode_native
+(
+    OpusMSEncoder *st,
+    opus_copy_channel_in_func copy_channel_in,
+    const void *pcm,
+    int analysis_frame_size,
+    unsigned char *data,
+    opus_int32 max_data_bytes,
+    int lsb_depth,
+    downmix_func downmix,
+    int float_api,
+    void *user_data
+)
+{
+   int ret;
+   SCRATCH_GUARD(ret, ret = multistream_encode_impl(st, copy_channel_in, pcm,
+         analysis_frame_size, data, max_data_bytes, lsb_depth, downmix, float_api,
+         user_data));
+   return ret;
+}
+
 #if !defined(DISABLE_FLOAT_API)
 static void opus_copy_channel_in_float(
   opus_val16 *dst,
@@ -1058,6 +1210,55 @@ static void opus_copy_channel_in_short(
 }
 
 
+#if !defined(DISABLE_FLOAT_API)
+static void opus_copy_channel_in_planar_float(
+  opus_val16 *dst,
+  int dst_stride,
+  const void *src,
+  int src_stride,
+  int src_channel,
+  int frame_size,
+  void *user_data
+)
+{
+   const float *float_src;
+   opus_int32 i;
+   (void)src_stride;
+   (void)user_data;
+   float_src = ((const float * const *)src)[src_channel];
+   for (i=0;i<frame_size;i++)
+#if defined(FIXED_POINT)
+      dst[i*dst_stride] = FLOAT2INT16(float_src[i]);
+#else
+      dst[i*dst_stride] = float_src[i];
+#endif
+}
+#endif
+
+static void opus_copy_channel_in_planar_short(
+  opus_val16 *dst,
+  int dst_stride,
+  const void *src,
+  int src_stride,
+  int src_channel,
+  int frame_size,
+  void *user_data
+)
+{
+   const opus_int16 *short_src;
+   opus_int32 i;
+   (void)src_stride;
+   (void)user_data;
+   short_src = ((const opus_int16 * const *)src)[src_channel];
+   for (i=0;i<frame_size;i++)
+#if defined(FIXED_POINT)
+      dst[i*dst_stride] = short_src[i];
+#else
+      dst[i*dst_stride] = (1/32768.f)*short_src[i];
+#endif
+}
+
+
 #ifdef FIXED_POINT
 int opus_multistream_encode(
     OpusMSEncoder *st,
@@ -1113,6 +1314,37 @@ int opus_multistream_encode(
 }
 #endif
 
+int opus_multistream_encode_planar(
+    OpusMSEncoder *st,
+    const opus_int16 * const *pcm,
+    int frame_size,
+    unsigned char *data,
+    opus_int32 max_data_bytes
+)
+{
+   return opus_multistream_encode_native(st, opus_copy_channel_in_planar_short,
+      pcm, frame_size, data, max_data_bytes, 16, downmix_planar_int, 0, NULL);
+}
+
+#ifndef DISABLE_FLOAT_API
+int opus_multistream_encode_planar_float(
+    OpusMSEncoder *st,
+    const float * const *pcm,
+    int frame_size,
+    unsigned char *data,
+    opus_int32 max_data_bytes
+)
+{
+#ifdef FIXED_POINT
+   return opus_multistream_encode_native(st, opus_copy_channel_in_planar_float,
+      pcm, frame_size, data, max_data_bytes, 16, downmix_planar_float, 1, NULL);
+#else
+   return opus_multistream_encode_native(st, opus_copy_channel_in_planar_float,
+      pcm, frame_size, data, max_data_bytes, 24, downmix_planar_float, 1, NULL);
+#endif
+}
+#endif
+
 int opus_multistream_encoder_ctl_va_list(OpusMSEncoder *st, int request,
                                          va_list ap)
 {
@@ -1165,6 +1397,8 @@ int opus_multistream_encoder_ctl_va_list(OpusMSEncoder *st, int request,
    case OPUS_GET_APPLICATION_REQUEST:
    case OPUS_GET_BANDWIDTH_REQUEST:
    case OPUS_GET_COMPLEXITY_REQUEST:
+   case OPUS_GET_COMPLEXITY_BUDGET_REQUEST:
+   case OPUS_GET_EFFECTIVE_COMPLEXITY_REQUEST:
    case OPUS_GET_PACKET_LOSS_PERC_REQUEST:
    case OPUS_GET_DTX_REQUEST:
    case OPUS_GET_VOICE_RATIO_REQUEST:
@@ -1210,6 +1444,7 @@ int opus_multistream_encoder_ctl_va_list(OpusMSEncoder *st, int request,
    break;
    case OPUS_SET_LSB_DEPTH_REQUEST:
    case OPUS_SET_COMPLEXITY_REQUEST:
+   case OPUS_SET_COMPLEXITY_BUDGET_REQUEST:
    case OPUS_SET_VBR_REQUEST:
    case OPUS_SET_VBR_CONSTRAINT_REQUEST:
    case OPUS_SET_MAX_BANDWIDTH_REQUEST:
@@ -1265,6 +1500,28 @@ int opus_multistream_encoder_ctl_va_list(OpusMSEncoder *st, int request,
       *value = (OpusEncoder*)ptr;
    }
    break;
+   case OPUS_MULTISTREAM_SET_EXECUTOR_REQUEST:
+   {
+      opus_executor_func executor = va_arg(ap, opus_executor_func);
+      void *executor_data = va_arg(ap, void*);
+      if (executor != NULL && st->executor_buf == NULL)
+      {
+         st->executor_buf = (unsigned char *)opus_alloc(
+               st->layout.nb_streams*MS_FRAME_TMP);
+         if (st->executor_buf == NULL)
+         {
+            ret = OPUS_ALLOC_FAIL;
+            break;
+         }
+      } else if (executor == NULL && st->executor_buf != NULL)
+      {
+         opus_free(st->executor_buf);
+         st->executor_buf = NULL;
+      }
+      st->executor = executor;
+      st->executor_data = executor_data;
+   }
+   break;
    case OPUS_SET_EXPERT_FRAME_DURATION_REQUEST:
    {
        opus_int32 value = va_arg(ap, opus_int32);
@@ -1303,6 +1560,52 @@ int opus_multistream_encoder_ctl_va_list(OpusMSEncoder *st, int request,
       }
    }
    break;
+   case OPUS_GET_PROFILE_STATS_REQUEST:
+   {
+      int s, i;
+      OpusProfileStats *value = va_arg(ap, OpusProfileStats*);
+      OpusProfileStats tmp;
+      if (!value)
+      {
+         goto bad_arg;
+      }
+      OPUS_CLEAR(value, 1);
+      for (s=0;s<st->layout.nb_streams;s++)
+      {
+         OpusEncoder *enc;
+         enc = (OpusEncoder*)ptr;
+         if (s < st->layout.nb_coupled_streams)
+            ptr += align(coupled_size);
+         else
+            ptr += align(mono_size);
+         ret = opus_encoder_ctl(enc, OPUS_GET_PROFILE_STATS(&tmp));
+         if (ret != OPUS_OK)
+            break;
+         for (i=0;i<OPUS_PROFILE_NB_STAGES;i++)
+         {
+            value->ticks[i] += tmp.ticks[i];
+            value->calls[i] += tmp.calls[i];
+         }
+      }
+   }
+   break;
+   case OPUS_RESET_PROFILE_STATS:
+   {
+      int s;
+      for (s=0;s<st->layout.nb_streams;s++)
+      {
+         OpusEncoder *enc;
+         enc = (OpusEncoder*)ptr;
+         if (s < st->layout.nb_coupled_streams)
+            ptr += align(coupled_size);
+         else
+            ptr += align(mono_size);
+         ret = opus_encoder_ctl(enc, OPUS_RESET_PROFILE_STATS);
+         if (ret != OPUS_OK)
+            break;
+      }
+   }
+   break;
    default:
       ret = OPUS_UNIMPLEMENTED;
       break;
@@ -1324,5 +1627,6 @@ int opus_multistream_encoder_ctl(OpusMSEncoder *st, int request, ...)
 
 void opus_multistream_encoder_destroy(OpusMSEncoder *st)
 {
+    opus_free(st->executor_buf);
     opus_free(st);
 }
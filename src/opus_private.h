@@ -31,6 +31,7 @@
 
 #include "arch.h"
 #include "opus.h"
+#include "opus_multistream.h"
 #include "celt.h"
 
 #include <stdarg.h> /* va_list */
@@ -65,6 +66,11 @@ struct OpusMSEncoder {
    int variable_duration;
    MappingType mapping_type;
    opus_int32 bitrate_bps;
+   opus_executor_func executor;
+   void *executor_data;
+   /* One MS_FRAME_TMP output slot per stream for the executor's jobs,
+      allocated when the executor is set. */
+   unsigned char *executor_buf;
    /* Encoder states go here */
    /* then opus_val32 window_mem[channels*120]; */
    /* then opus_val32 preemph_mem[channels]; */
@@ -72,6 +78,8 @@ struct OpusMSEncoder {
 
 struct OpusMSDecoder {
    ChannelLayout layout;
+   opus_executor_func executor;
+   void *executor_data;
    /* Decoder states go here */
 };
 
@@ -132,9 +140,22 @@ typedef void (*opus_copy_channel_out_func)(
 #define OPUS_SET_FORCE_MODE_REQUEST    11002
 #define OPUS_SET_FORCE_MODE(x) OPUS_SET_FORCE_MODE_REQUEST, __opus_check_int(x)
 
+/* Shares the tonality analysis with the other encoders of an
+   OpusGroupEncoder, see TonalityAnalysisShare. */
+#define OPUS_SET_ANALYSIS_SHARE_REQUEST    11020
+#define __opus_check_analysis_share_ptr(ptr) ((ptr) + ((ptr) - (TonalityAnalysisShare*)(ptr)))
+#define OPUS_SET_ANALYSIS_SHARE(x) OPUS_SET_ANALYSIS_SHARE_REQUEST, __opus_check_analysis_share_ptr(x)
+
+/* Shares the coarse pitch search of the CELT prefilter with the other
+   encoders of an OpusGroupEncoder, see CELTPitchShare. */
+#define OPUS_SET_PITCH_SHARE_REQUEST    11022
+#define OPUS_SET_PITCH_SHARE(x) OPUS_SET_PITCH_SHARE_REQUEST, __celt_check_pitch_share_ptr(x)
+
 typedef void (*downmix_func)(const void *, opus_val32 *, int, int, int, int, int);
 void downmix_float(const void *_x, opus_val32 *sub, int subframe, int offset, int c1, int c2, int C);
 void downmix_int(const void *_x, opus_val32 *sub, int subframe, int offset, int c1, int c2, int C);
+void downmix_planar_float(const void *_x, opus_val32 *sub, int subframe, int offset, int c1, int c2, int C);
+void downmix_planar_int(const void *_x, opus_val32 *sub, int subframe, int offset, int c1, int c2, int C);
 int is_digital_silence(const opus_val16* pcm, int frame_size, int channels, int lsb_depth);
 
 int encode_size(int size, unsigned char *data);
@@ -146,6 +167,11 @@ opus_int32 opus_encode_native(OpusEncoder *st, const opus_val16 *pcm, int frame_
       const void *analysis_pcm, opus_int32 analysis_size, int c1, int c2,
       int analysis_channels, downmix_func downmix, int float_api);
 
+/* Size of the largest packet opus_encode_native() can return for a frame of
+   frame_size samples with the current settings. Any out_data_bytes at least
+   this large gives the same packet. */
+opus_int32 opus_encoder_packet_bound(const OpusEncoder *st, int frame_size);
+
 int opus_decode_native(OpusDecoder *st, const unsigned char *data, opus_int32 len,
       opus_val16 *pcm, int frame_size, int decode_fec, int self_delimited,
       opus_int32 *packet_offset, int soft_clip);
@@ -0,0 +1,258 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "opus_probe.h"
+#include "opus_private.h"
+#include "celt.h"
+#include "modes.h"
+#include "quant_bands.h"
+#include "entdec.h"
+#include "mathops.h"
+#include "API.h"
+#include "structs.h"
+#include "os_support.h"
+#include "stack_alloc.h"
+#include "cpu_support.h"
+
+#define PROBE_MAX_BANDS 21
+
+/* Calibration of the CELT levels against the decoded output, in Q8 dB. */
+#define PROBE_CELT_OFFSET (-93*256)
+
+/* log2 of the gain of the de-emphasis filter at the centre of each band,
+   since the band energies are those of the pre-emphasised signal. */
+static const opus_val16 probe_deemph[PROBE_MAX_BANDS] = {
+   QCONST16(2.73f, DB_SHIFT), QCONST16(2.70f, DB_SHIFT), QCONST16(2.63f, DB_SHIFT), QCONST16(2.54f, DB_SHIFT),
+   QCONST16(2.43f, DB_SHIFT), QCONST16(2.32f, DB_SHIFT), QCONST16(2.20f, DB_SHIFT), QCONST16(2.09f, DB_SHIFT),
+   QCONST16(1.92f, DB_SHIFT), QCONST16(1.72f, DB_SHIFT), QCONST16(1.53f, DB_SHIFT), QCONST16(1.36f, DB_SHIFT),
+   QCONST16(1.13f, DB_SHIFT), QCONST16(0.88f, DB_SHIFT), QCONST16(0.66f, DB_SHIFT), QCONST16(0.43f, DB_SHIFT),
+   QCONST16(0.20f, DB_SHIFT), QCONST16(-0.02f, DB_SHIFT), QCONST16(-0.27f, DB_SHIFT), QCONST16(-0.54f, DB_SHIFT),
+   QCONST16(-0.77f, DB_SHIFT)
+};
+
+struct OpusProbe {
+   const CELTMode *mode;
+   int arch;
+   int prev_mode;
+   silk_probe_state silk;
+   opus_val16 oldBandE[2*PROBE_MAX_BANDS];
+};
+
+int opus_probe_get_size(void)
+{
+   return align(sizeof(OpusProbe));
+}
+
+int opus_probe_init(OpusProbe *st)
+{
+   OPUS_CLEAR((char*)st, opus_probe_get_size());
+   st->mode = opus_custom_mode_create(48000, 960, NULL);
+   celt_assert(st->mode->nbEBands == PROBE_MAX_BANDS);
+   st->arch = opus_select_arch();
+   return OPUS_OK;
+}
+
+OpusProbe *opus_probe_create(int *error)
+{
+   int ret;
+   OpusProbe *st;
+   st = (OpusProbe *)opus_alloc(opus_probe_get_size());
+   if (st == NULL)
+   {
+      if (error)
+         *error = OPUS_ALLOC_FAIL;
+      return NULL;
+   }
+   ret = opus_probe_init(st);
+   if (error)
+      *error = ret;
+   if (ret != OPUS_OK)
+   {
+      opus_free(st);
+      st = NULL;
+   }
+   return st;
+}
+
+static int probe_clamp_level(opus_int32 level)
+{
+   return IMAX(OPUS_PROBE_MIN_LEVEL, IMIN(0, level));
+}
+
+/* The squared band amplitudes add up to the power of the (pre-emphasised)
+   signal, summed over the channels and, for transient frames, over the
+   short blocks. */
+static int probe_celt_level(const CELTMode *m, const opus_val16 *bandLogE,
+      int end, int C, int blocks_log2)
+{
+   int c, i;
+   opus_val32 lg;
+   opus_val32 maxE;
+   opus_val32 sum;
+   maxE = -QCONST32(64.f, DB_SHIFT);
+   c=0; do {
+      for (i=0;i<end;i++)
+      {
+         lg = ADD32(bandLogE[i+c*m->nbEBands],
+               ADD32(SHL32((opus_val32)eMeans[i],6), probe_deemph[i]));
+         maxE = MAX32(maxE, lg);
+      }
+   } while (++c<C);
+   sum = 0;
+   c=0; do {
+      for (i=0;i<end;i++)
+      {
+         lg = ADD32(bandLogE[i+c*m->nbEBands],
+               ADD32(SHL32((opus_val32)eMeans[i],6), probe_deemph[i]));
+         sum += celt_exp2(EXTRACT16(MAX32(-QCONST32(15.f, DB_SHIFT),
+               2*(lg-maxE))));
+      }
+   } while (++c<C);
+#ifdef FIXED_POINT
+   /* celt_exp2() is Q16 and celt_log2() takes Q14. */
+   lg = SHL32(maxE, 1) + celt_log2(sum) - QCONST16(2.f, DB_SHIFT) - SHL32(C-1+blocks_log2, DB_SHIFT);
+   /* log2 to dB, Q10 to Q8 */
+   return probe_clamp_level(((lg*771+512)>>10) + PROBE_CELT_OFFSET);
+#else
+   lg = 2*maxE + celt_log2(sum) - (C-1+blocks_log2);
+   return probe_clamp_level((int)floor(.5f + 770.6f*lg) + PROBE_CELT_OFFSET);
+#endif
+}
+
+static int opus_probe_packet_impl(OpusProbe *st, const unsigned char *data,
+      opus_int32 len, opus_int16 *level, unsigned char *active)
+{
+   int i;
+   int ret;
+   int count;
+   int mode;
+   int LM=0;
+   int transient;
+   int C;
+   int end;
+   int payloadSize_ms;
+   opus_int32 silk_rate;
+   unsigned char toc;
+   const unsigned char *frames[48];
+   opus_int16 size[48];
+
+   if (len <= 0)
+      return OPUS_BAD_ARG;
+   count = opus_packet_parse(data, len, &toc, frames, size, NULL);
+   if (count < 0)
+      return count;
+   C = opus_packet_get_nb_channels(data);
+   payloadSize_ms = opus_packet_get_samples_per_frame(data, 1000);
+   if (toc&0x80)
+   {
+      mode = MODE_CELT_ONLY;
+      LM = (toc>>3)&0x3;
+   } else if ((toc&0x60) == 0x60)
+      mode = MODE_HYBRID;
+   else
+      mode = MODE_SILK_ONLY;
+   switch (opus_packet_get_bandwidth(data))
+   {
+   case OPUS_BANDWIDTH_NARROWBAND:
+      end = 13;
+      silk_rate = 8000;
+      break;
+   case OPUS_BANDWIDTH_MEDIUMBAND:
+      end = 17;
+      silk_rate = 12000;
+      break;
+   case OPUS_BANDWIDTH_WIDEBAND:
+      end = 17;
+      silk_rate = 16000;
+      break;
+   case OPUS_BANDWIDTH_SUPERWIDEBAND:
+      end = 19;
+      silk_rate = 16000;
+      break;
+   default:
+      end = 21;
+      silk_rate = 16000;
+      break;
+   }
+   /* Same resets as the decoder on a mode or rate change. */
+   if (mode == MODE_CELT_ONLY && st->prev_mode != MODE_CELT_ONLY)
+      OPUS_CLEAR(st->oldBandE, 2*PROBE_MAX_BANDS);
+   if (mode != MODE_CELT_ONLY && st->prev_mode == MODE_CELT_ONLY)
+      OPUS_CLEAR((char*)&st->silk, sizeof(st->silk));
+   for (i=0;i<count;i++)
+   {
+      level[i] = OPUS_PROBE_MIN_LEVEL;
+      active[i] = 0;
+      if (size[i] <= 1)
+         continue;
+      if (mode == MODE_CELT_ONLY)
+      {
+         ret = celt_decode_energies(st->mode, frames[i], size[i], LM, C, end,
+               st->oldBandE, &transient);
+         if (ret < 0)
+            return OPUS_INVALID_PACKET;
+         if (!ret)
+         {
+            level[i] = probe_celt_level(st->mode, st->oldBandE, end, C,
+                  transient ? LM : 0);
+            active[i] = level[i] > -60*256;
+         }
+      } else {
+         ec_dec dec;
+         opus_int VAD;
+         opus_int32 level_Q7;
+         ec_dec_init(&dec, (unsigned char*)frames[i], size[i]);
+         ret = silk_Probe(&st->silk, &dec, C, payloadSize_ms, silk_rate,
+               &VAD, &level_Q7, st->arch);
+         if (ret != 0)
+            return OPUS_INVALID_PACKET;
+         /* log2 of the mean square to dB (Q7 to Q8), relative to 2^30. */
+         level[i] = probe_clamp_level(
+               ((level_Q7 - (30<<7))*1541 + 128)>>8);
+         active[i] = VAD;
+      }
+   }
+   st->prev_mode = mode;
+   return count;
+}
+
+int opus_probe_packet(OpusProbe *st, const unsigned char *data,
+      opus_int32 len, opus_int16 *level, unsigned char *active)
+{
+   int ret;
+   SCRATCH_GUARD(ret, ret = opus_probe_packet_impl(st, data, len, level,
+         active));
+   return ret;
+}
+
+void opus_probe_destroy(OpusProbe *st)
+{
+   opus_free(st);
+}
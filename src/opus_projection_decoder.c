@@ -89,6 +89,59 @@ static void opus_projection_copy_channel_out_short(
       src_stride, short_dst, dst_stride, frame_size);
 }
 
+#if !defined(DISABLE_FLOAT_API)
+static void opus_projection_copy_channel_out_planar_float(
+  void *dst,
+  int dst_stride,
+  int dst_channel,
+  const opus_val16 *src,
+  int src_stride,
+  int frame_size,
+  void *user_data)
+{
+  float * const *float_dst;
+  const MappingMatrix *matrix;
+  float_dst = (float * const *)dst;
+  matrix = (const MappingMatrix *)user_data;
+
+  if (dst_channel == 0)
+  {
+    int c;
+    for (c = 0; c < dst_stride; c++)
+      OPUS_CLEAR(float_dst[c], frame_size);
+  }
+
+  if (src != NULL)
+    mapping_matrix_multiply_channel_out_planar_float(matrix, src, dst_channel,
+      src_stride, float_dst, dst_stride, frame_size);
+}
+#endif
+
+static void opus_projection_copy_channel_out_planar_short(
+  void *dst,
+  int dst_stride,
+  int dst_channel,
+  const opus_val16 *src,
+  int src_stride,
+  int frame_size,
+  void *user_data)
+{
+  opus_int16 * const *short_dst;
+  const MappingMatrix *matrix;
+  short_dst = (opus_int16 * const *)dst;
+  matrix = (const MappingMatrix *)user_data;
+  if (dst_channel == 0)
+  {
+    int c;
+    for (c = 0; c < dst_stride; c++)
+      OPUS_CLEAR(short_dst[c], frame_size);
+  }
+
+  if (src != NULL)
+    mapping_matrix_multiply_channel_out_planar_short(matrix, src, dst_channel,
+      src_stride, short_dst, dst_stride, frame_size);
+}
+
 static MappingMatrix *get_dec_demixing_matrix(OpusProjectionDecoder *st)
 {
   /* void* cast avoids clang -Wcast-align warning */
@@ -122,8 +175,8 @@ opus_int32 opus_projection_decoder_get_size(int channels, int streams,
   return align(sizeof(OpusProjectionDecoder)) + matrix_size + decoder_size;
 }
 
-int opus_projection_decoder_init(OpusProjectionDecoder *st, opus_int32 Fs,
-  int channels, int streams, int coupled_streams,
+static int projection_decoder_init_impl(OpusProjectionDecoder *st,
+  opus_int32 Fs, int channels, int streams, int coupled_streams,
   unsigned char *demixing_matrix, opus_int32 demixing_matrix_size)
 {
   int nb_input_streams;
@@ -173,6 +226,16 @@ int opus_projection_decoder_init(OpusProjectionDecoder *st, opus_int32 Fs,
   return ret;
 }
 
+int opus_projection_decoder_init(OpusProjectionDecoder *st, opus_int32 Fs,
+  int channels, int streams, int coupled_streams,
+  unsigned char *demixing_matrix, opus_int32 demixing_matrix_size)
+{
+  int ret;
+  SCRATCH_GUARD(ret, ret = projection_decoder_init_impl(st, Fs, channels,
+    streams, coupled_streams, demixing_matrix, demixing_matrix_size));
+  return ret;
+}
+
 OpusProjectionDecoder *opus_projection_decoder_create(
   opus_int32 Fs, int channels, int streams, int coupled_streams,
   unsigned char *demixing_matrix, opus_int32 demixing_matrix_size, int *error)
@@ -239,6 +302,34 @@ int opus_projection_decode_float(OpusProjectionDecoder *st, const unsigned char
 }
 #endif
 
+int opus_projection_decode_planar(OpusProjectionDecoder *st,
+                                  const unsigned char *data, opus_int32 len,
+                                  opus_int16 * const *pcm, int frame_size,
+                                  int decode_fec)
+{
+#ifdef FIXED_POINT
+  return opus_multistream_decode_native(get_multistream_decoder(st), data, len,
+    (void*)pcm, opus_projection_copy_channel_out_planar_short, frame_size,
+    decode_fec, 0, get_dec_demixing_matrix(st));
+#else
+  return opus_multistream_decode_native(get_multistream_decoder(st), data, len,
+    (void*)pcm, opus_projection_copy_channel_out_planar_short, frame_size,
+    decode_fec, 1, get_dec_demixing_matrix(st));
+#endif
+}
+
+#ifndef DISABLE_FLOAT_API
+int opus_projection_decode_planar_float(OpusProjectionDecoder *st,
+                                        const unsigned char *data,
+                                        opus_int32 len, float * const *pcm,
+                                        int frame_size, int decode_fec)
+{
+  return opus_multistream_decode_native(get_multistream_decoder(st), data, len,
+    (void*)pcm, opus_projection_copy_channel_out_planar_float, frame_size,
+    decode_fec, 0, get_dec_demixing_matrix(st));
+}
+#endif
+
 int opus_projection_decoder_ctl(OpusProjectionDecoder *st, int request, ...)
 {
   va_list ap;
@@ -75,6 +75,36 @@ static void opus_projection_copy_channel_in_short(
     (const opus_int16*)src, src_stride, dst, src_channel, dst_stride, frame_size);
 }
 
+#if !defined(DISABLE_FLOAT_API)
+static void opus_projection_copy_channel_in_planar_float(
+  opus_val16 *dst,
+  int dst_stride,
+  const void *src,
+  int src_stride,
+  int src_channel,
+  int frame_size,
+  void *user_data
+)
+{
+  mapping_matrix_multiply_channel_in_planar_float((const MappingMatrix*)user_data,
+    (const float * const *)src, src_stride, dst, src_channel, dst_stride, frame_size);
+}
+#endif
+
+static void opus_projection_copy_channel_in_planar_short(
+  opus_val16 *dst,
+  int dst_stride,
+  const void *src,
+  int src_stride,
+  int src_channel,
+  int frame_size,
+  void *user_data
+)
+{
+  mapping_matrix_multiply_channel_in_planar_short((const MappingMatrix*)user_data,
+    (const opus_int16 * const *)src, src_stride, dst, src_channel, dst_stride, frame_size);
+}
+
 static int get_order_plus_one_from_channels(int channels, int *order_plus_one)
 {
   int order_plus_one_;
@@ -372,8 +402,39 @@ int opus_projection_encode_float(OpusProjectionEncoder *st, const float *pcm,
 #endif
 #endif
 
+int opus_projection_encode_planar(OpusProjectionEncoder *st,
+                                  const opus_int16 * const *pcm,
+                                  int frame_size, unsigned char *data,
+                                  opus_int32 max_data_bytes)
+{
+  return opus_multistream_encode_native(get_multistream_encoder(st),
+    opus_projection_copy_channel_in_planar_short, pcm, frame_size, data,
+    max_data_bytes, 16, downmix_planar_int, 0, get_mixing_matrix(st));
+}
+
+#ifndef DISABLE_FLOAT_API
+int opus_projection_encode_planar_float(OpusProjectionEncoder *st,
+                                        const float * const *pcm,
+                                        int frame_size, unsigned char *data,
+                                        opus_int32 max_data_bytes)
+{
+#ifdef FIXED_POINT
+  return opus_multistream_encode_native(get_multistream_encoder(st),
+    opus_projection_copy_channel_in_planar_float, pcm, frame_size, data,
+    max_data_bytes, 16, downmix_planar_float, 1, get_mixing_matrix(st));
+#else
+  return opus_multistream_encode_native(get_multistream_encoder(st),
+    opus_projection_copy_channel_in_planar_float, pcm, frame_size, data,
+    max_data_bytes, 24, downmix_planar_float, 1, get_mixing_matrix(st));
+#endif
+}
+#endif
+
 void opus_projection_encoder_destroy(OpusProjectionEncoder *st)
 {
+  /* Releases the multistream encoder's executor buffer. */
+  opus_multistream_encoder_ctl(get_multistream_encoder(st),
+    OPUS_MULTISTREAM_SET_EXECUTOR(NULL, NULL));
   opus_free(st);
 }
 
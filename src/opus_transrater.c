@@ -0,0 +1,586 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdarg.h>
+#include "opus_transrater.h"
+#include "opus_private.h"
+#include "celt.h"
+#include "modes.h"
+#include "bands.h"
+#include "quant_bands.h"
+#include "rate.h"
+#include "entenc.h"
+#include "entdec.h"
+#include "mathops.h"
+#include "stack_alloc.h"
+#include "os_support.h"
+#include "cpu_support.h"
+
+#define TRANSRATER_MAX_BANDS 21
+
+struct OpusTransrater {
+   const CELTMode *mode;
+   int arch;
+   opus_int32 bitrate_bps;
+   int complexity;
+
+#define TRANSRATER_RESET_START synced
+   /* Non-zero as long as every frame so far was passed through, so that
+      the output decoder state is still the input one. */
+   int synced;
+   /* Decoder state of the input stream */
+   opus_uint32 in_rng;
+   opus_val16 in_oldBandE[2*TRANSRATER_MAX_BANDS];
+   /* Decoder state of the output stream, plus the encoder decisions that
+      have hysteresis. */
+   opus_uint32 out_rng;
+   opus_val16 out_oldBandE[2*TRANSRATER_MAX_BANDS];
+   opus_val32 delayedIntra;
+   int consec_transient;
+   int intensity;
+   int lastCodedBands;
+};
+
+/* The stereo decisions in quant_all_bands() only look at the ratio between
+   the amplitudes of the two channels in a band, so they are computed
+   relative to the louder channel, which keeps them in range in fixed
+   point. */
+static void transrate_band_amplitudes(const CELTMode *m, int end,
+      const opus_val16 *bandLogE, celt_ener *bandE)
+{
+   int i;
+   for (i=0;i<end;i++)
+   {
+      opus_val32 ref, l, r;
+      ref = MAX32(bandLogE[i], bandLogE[i+m->nbEBands]);
+      l = MAX32(-QCONST32(14.f, DB_SHIFT), SUB32(bandLogE[i], ref));
+      r = MAX32(-QCONST32(14.f, DB_SHIFT), SUB32(bandLogE[i+m->nbEBands], ref));
+      bandE[i] = EPSILON+celt_exp2((opus_val16)l);
+      bandE[i+m->nbEBands] = EPSILON+celt_exp2((opus_val16)r);
+   }
+}
+
+/* Parses one CELT frame the way celt_decode_with_ec() does, stopping
+   before the synthesis, then codes the same frame again in
+   nbCompressedBytes bytes the way celt_encode_with_ec() does, starting
+   from the decoded energies and shapes instead of an MDCT. Returns the
+   number of bytes written to out, or a negative error code. */
+static int transrate_frame(OpusTransrater *st, const unsigned char *data,
+      int len, unsigned char *out, int nbCompressedBytes, int LM, int C,
+      int end)
+{
+   const CELTMode *mode = st->mode;
+   const opus_int16 *eBands = mode->eBands;
+   int nbEBands = mode->nbEBands;
+   int start = 0;
+   int M = 1<<LM;
+   int N = M*mode->shortMdctSize;
+   int c, i;
+   ec_dec dec;
+   ec_enc enc;
+   opus_int32 total_bits;
+   opus_int32 tell;
+   opus_int32 bits;
+   opus_int32 balance;
+   opus_int32 equiv_rate;
+   int silence;
+   int isTransient;
+   int shortBlocks;
+   int spread_decision;
+   int dynalloc_logp;
+   int total_boost;
+   int max_boost;
+   int alloc_trim;
+   int intensity=0;
+   int dual_stereo=0;
+   int anti_collapse_rsv;
+   int anti_collapse_on=0;
+   int codedBands;
+   CELTSideInfo info;
+   VARDECL(celt_norm, X);
+   VARDECL(celt_ener, bandE);
+   VARDECL(opus_val16, bandLogE);
+   VARDECL(opus_val16, error);
+   VARDECL(int, tf_raw);
+   VARDECL(int, tf_res);
+   VARDECL(int, cap);
+   VARDECL(int, offsets);
+   VARDECL(int, fine_quant);
+   VARDECL(int, pulses);
+   VARDECL(int, fine_priority);
+   VARDECL(unsigned char, collapse_masks);
+   ALLOC_STACK;
+
+   ALLOC(X, C*N, celt_norm);
+   ALLOC(bandE, 2*nbEBands, celt_ener);
+   ALLOC(bandLogE, 2*nbEBands, opus_val16);
+   ALLOC(error, 2*nbEBands, opus_val16);
+   ALLOC(tf_raw, nbEBands, int);
+   ALLOC(tf_res, nbEBands, int);
+   ALLOC(cap, nbEBands, int);
+   ALLOC(offsets, nbEBands, int);
+   ALLOC(fine_quant, nbEBands, int);
+   ALLOC(pulses, nbEBands, int);
+   ALLOC(fine_priority, nbEBands, int);
+   ALLOC(collapse_masks, C*nbEBands, unsigned char);
+
+   /* Input: everything celt_decode_with_ec() reads from the bitstream. */
+   ec_dec_init(&dec, (unsigned char*)data, len);
+   celt_decode_side_info(mode, start, end, len, LM, C, &dec, st->in_oldBandE,
+         &info, tf_raw, tf_res, cap, offsets, fine_quant, pulses, fine_priority);
+   silence = info.silence;
+   isTransient = info.isTransient;
+   shortBlocks = isTransient ? M : 0;
+   quant_all_bands(0, mode, start, end, X, C==2 ? X+N : NULL, collapse_masks,
+         NULL, pulses, shortBlocks, info.spread_decision, info.dual_stereo,
+         info.intensity, tf_res, len*(8<<BITRES)-info.anti_collapse_rsv,
+         info.balance, &dec, LM, info.codedBands, &st->in_rng, 0, st->arch, 0);
+   if (info.anti_collapse_rsv > 0)
+      anti_collapse_on = ec_dec_bits(&dec, 1);
+   unquant_energy_finalise(mode, start, end, st->in_oldBandE,
+         fine_quant, fine_priority, len*8-ec_tell(&dec), &dec, C);
+   if (silence)
+   {
+      for (i=0;i<C*nbEBands;i++)
+         st->in_oldBandE[i] = -QCONST16(28.f,DB_SHIFT);
+   }
+   if (C==1)
+      OPUS_COPY(&st->in_oldBandE[nbEBands], st->in_oldBandE, nbEBands);
+   for (c=0;c<2;c++)
+   {
+      for (i=end;i<nbEBands;i++)
+         st->in_oldBandE[c*nbEBands+i]=0;
+   }
+   st->in_rng = dec.rng;
+   if (ec_tell(&dec) > 8*len || ec_get_error(&dec))
+   {
+      RESTORE_STACK;
+      return OPUS_INVALID_PACKET;
+   }
+
+   if (st->synced && len <= nbCompressedBytes)
+   {
+      /* The output decoder is in the same state as the input one, so the
+         frame can be kept as is. */
+      OPUS_COPY(out, data, len);
+      OPUS_COPY(st->out_oldBandE, st->in_oldBandE, 2*nbEBands);
+      st->out_rng = st->in_rng;
+      st->consec_transient = isTransient ? st->consec_transient+1 : 0;
+      RESTORE_STACK;
+      return len;
+   }
+   st->synced = 0;
+   OPUS_COPY(bandLogE, st->in_oldBandE, 2*nbEBands);
+
+   /* Output: the same steps as celt_encode_with_ec(), with the decisions
+      of the input frame wherever the encoder would analyse the signal. */
+   ec_enc_init(&enc, out, nbCompressedBytes);
+   if (C==1)
+   {
+      for (i=0;i<nbEBands;i++)
+         st->out_oldBandE[i]=MAX16(st->out_oldBandE[i],st->out_oldBandE[nbEBands+i]);
+   }
+   total_bits = nbCompressedBytes*8;
+   ec_enc_bit_logp(&enc, silence, 15);
+   if (silence)
+   {
+      nbCompressedBytes = IMIN(nbCompressedBytes, 2);
+      total_bits = nbCompressedBytes*8;
+      ec_enc_shrink(&enc, nbCompressedBytes);
+      tell = nbCompressedBytes*8;
+      enc.nbits_total+=tell-ec_tell(&enc);
+   }
+   tell = ec_tell(&enc);
+   /* The encoder does not enable the pre-filter below this size. */
+   if (info.postfilter_on && nbCompressedBytes>12*C)
+   {
+      int octave;
+      int pitch_index;
+      ec_enc_bit_logp(&enc, 1, 1);
+      pitch_index = info.postfilter_pitch+1;
+      octave = EC_ILOG(pitch_index)-5;
+      ec_enc_uint(&enc, octave, 6);
+      ec_enc_bits(&enc, pitch_index-(16<<octave), 4+octave);
+      ec_enc_bits(&enc, info.postfilter_qg, 3);
+      ec_enc_icdf(&enc, info.postfilter_tapset, tapset_icdf, 2);
+   } else if (start==0 && tell+16<=total_bits)
+      ec_enc_bit_logp(&enc, 0, 1);
+   if (LM>0 && ec_tell(&enc)+3<=total_bits)
+      ec_enc_bit_logp(&enc, isTransient, 3);
+   else
+      isTransient = 0;
+   shortBlocks = isTransient ? M : 0;
+
+   quant_coarse_energy(mode, start, end, end, bandLogE,
+         st->out_oldBandE, total_bits, error, &enc,
+         C, LM, nbCompressedBytes, info.intra_ener,
+         &st->delayedIntra, st->complexity >= 4, 0, 0);
+
+   OPUS_COPY(tf_res, tf_raw, nbEBands);
+   tf_encode(start, end, isTransient, tf_res, LM, info.tf_select, &enc);
+
+   spread_decision = info.spread_decision;
+   if (ec_tell(&enc)+4<=total_bits)
+      ec_enc_icdf(&enc, spread_decision, spread_icdf, 5);
+   else
+      spread_decision = SPREAD_NORMAL;
+
+   /* Keep the boosts of the input, but limit them to 2/3 of the budget
+      like dynalloc_analysis() does for CBR. */
+   max_boost = (2*nbCompressedBytes/3)<<(BITRES+3);
+   dynalloc_logp = 6;
+   total_bits<<=BITRES;
+   total_boost = 0;
+   tell = ec_tell_frac(&enc);
+   for (i=start;i<end;i++)
+   {
+      int width, quanta;
+      int dynalloc_loop_logp;
+      int boost;
+      int j;
+      width = C*(eBands[i+1]-eBands[i])<<LM;
+      quanta = IMIN(width<<BITRES, IMAX(6<<BITRES, width));
+      offsets[i] = IMIN(offsets[i], IMAX(0, max_boost-total_boost))/quanta;
+      dynalloc_loop_logp = dynalloc_logp;
+      boost = 0;
+      for (j = 0; tell+(dynalloc_loop_logp<<BITRES) < total_bits-total_boost
+            && boost < cap[i]; j++)
+      {
+         int flag;
+         flag = j<offsets[i];
+         ec_enc_bit_logp(&enc, flag, dynalloc_loop_logp);
+         tell = ec_tell_frac(&enc);
+         if (!flag)
+            break;
+         boost += quanta;
+         total_boost += quanta;
+         dynalloc_loop_logp = 1;
+      }
+      if (j)
+         dynalloc_logp = IMAX(2, dynalloc_logp-1);
+      offsets[i] = boost;
+   }
+
+   equiv_rate = ((opus_int32)nbCompressedBytes*8*50 << (3-LM)) - (40*C+20)*((400>>LM) - 50);
+   if (C==2)
+   {
+      static const opus_val16 intensity_thresholds[21]=
+      /* 0  1  2  3  4  5  6  7  8  9 10 11 12 13 14 15 16 17 18 19  20  off*/
+        {  1, 2, 3, 4, 5, 6, 7, 8,16,24,36,44,50,56,62,67,72,79,88,106,134};
+      static const opus_val16 intensity_histeresis[21]=
+        {  1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 4, 5, 6,  8, 8};
+
+      st->intensity = hysteresis_decision((opus_val16)(equiv_rate/1000),
+            intensity_thresholds, intensity_histeresis, 21, st->intensity);
+      st->intensity = IMIN(end,IMAX(start, st->intensity));
+   }
+   intensity = st->intensity;
+
+   alloc_trim = info.alloc_trim;
+   if (tell+(6<<BITRES) <= total_bits - total_boost)
+   {
+      ec_enc_icdf(&enc, alloc_trim, trim_icdf, 7);
+      tell = ec_tell_frac(&enc);
+   } else
+      alloc_trim = 5;
+
+   bits = (((opus_int32)nbCompressedBytes*8)<<BITRES) - ec_tell_frac(&enc) - 1;
+   anti_collapse_rsv = isTransient&&LM>=2&&bits>=((LM+2)<<BITRES) ? (1<<BITRES) : 0;
+   bits -= anti_collapse_rsv;
+   codedBands = clt_compute_allocation(mode, start, end, offsets, cap,
+         alloc_trim, &intensity, &dual_stereo, bits, &balance, pulses,
+         fine_quant, fine_priority, C, LM, &enc, 1, st->lastCodedBands, end-1);
+   if (st->lastCodedBands)
+      st->lastCodedBands = IMIN(st->lastCodedBands+1,IMAX(st->lastCodedBands-1,codedBands));
+   else
+      st->lastCodedBands = codedBands;
+
+   quant_fine_energy(mode, start, end, st->out_oldBandE, error, fine_quant, &enc, C);
+
+   if (C==2)
+      transrate_band_amplitudes(mode, end, bandLogE, bandE);
+   quant_all_bands(1, mode, start, end, X, C==2 ? X+N : NULL, collapse_masks,
+         bandE, pulses, shortBlocks, spread_decision,
+         dual_stereo, intensity, tf_res, nbCompressedBytes*(8<<BITRES)-anti_collapse_rsv,
+         balance, &enc, LM, codedBands, &st->out_rng, st->complexity, st->arch, 0);
+
+   if (anti_collapse_rsv > 0)
+   {
+      anti_collapse_on = st->consec_transient<2;
+      ec_enc_bits(&enc, anti_collapse_on, 1);
+   }
+   quant_energy_finalise(mode, start, end, st->out_oldBandE, error, fine_quant,
+         fine_priority, nbCompressedBytes*8-ec_tell(&enc), &enc, C);
+
+   if (silence)
+   {
+      for (i=0;i<C*nbEBands;i++)
+         st->out_oldBandE[i] = -QCONST16(28.f,DB_SHIFT);
+   }
+   if (C==1)
+      OPUS_COPY(&st->out_oldBandE[nbEBands], st->out_oldBandE, nbEBands);
+   for (c=0;c<2;c++)
+   {
+      for (i=end;i<nbEBands;i++)
+         st->out_oldBandE[c*nbEBands+i]=0;
+   }
+   st->consec_transient = isTransient ? st->consec_transient+1 : 0;
+   st->out_rng = enc.rng;
+   ec_enc_done(&enc);
+   RESTORE_STACK;
+   if (ec_get_error(&enc))
+      return OPUS_INTERNAL_ERROR;
+   return nbCompressedBytes;
+}
+
+int opus_transrater_get_size(void)
+{
+   return align(sizeof(OpusTransrater));
+}
+
+int opus_transrater_init(OpusTransrater *st, opus_int32 bitrate)
+{
+   if (bitrate <= 0)
+      return OPUS_BAD_ARG;
+   OPUS_CLEAR((char*)st, opus_transrater_get_size());
+   st->mode = opus_custom_mode_create(48000, 960, NULL);
+   celt_assert(st->mode->nbEBands == TRANSRATER_MAX_BANDS);
+   st->arch = opus_select_arch();
+   st->bitrate_bps = IMIN(512000, IMAX(500, bitrate));
+   st->complexity = 9;
+   opus_transrater_ctl(st, OPUS_RESET_STATE);
+   return OPUS_OK;
+}
+
+OpusTransrater *opus_transrater_create(opus_int32 bitrate, int *error)
+{
+   int ret;
+   OpusTransrater *st;
+   st = (OpusTransrater *)opus_alloc(opus_transrater_get_size());
+   if (st == NULL)
+   {
+      if (error)
+         *error = OPUS_ALLOC_FAIL;
+      return NULL;
+   }
+   ret = opus_transrater_init(st, bitrate);
+   if (error)
+      *error = ret;
+   if (ret != OPUS_OK)
+   {
+      opus_free(st);
+      st = NULL;
+   }
+   return st;
+}
+
+static opus_int32 opus_transrate_impl(OpusTransrater *st,
+      const unsigned char *data, opus_int32 len, unsigned char *out,
+      opus_int32 max_out_bytes)
+{
+   int i;
+   int ret;
+   int count;
+   int LM;
+   int C;
+   int end;
+   int frame_size;
+   int frame_bytes;
+   opus_int32 packet_bytes;
+   opus_int32 tot_len;
+   unsigned char toc;
+   const unsigned char *frames[48];
+   opus_int16 size[48];
+   OpusRepacketizer rp;
+   VARDECL(unsigned char, buf);
+   ALLOC_STACK;
+
+   if (len <= 0 || max_out_bytes <= 0)
+   {
+      RESTORE_STACK;
+      return OPUS_BAD_ARG;
+   }
+   count = opus_packet_parse(data, len, &toc, frames, size, NULL);
+   if (count < 0)
+   {
+      RESTORE_STACK;
+      return count;
+   }
+   if (!(toc&0x80))
+   {
+      RESTORE_STACK;
+      return OPUS_UNIMPLEMENTED;
+   }
+   for (i=0;i<count;i++)
+   {
+      if (size[i] <= 1)
+      {
+         RESTORE_STACK;
+         return OPUS_UNIMPLEMENTED;
+      }
+   }
+   LM = (toc>>3)&0x3;
+   C = opus_packet_get_nb_channels(data);
+   switch (opus_packet_get_bandwidth(data))
+   {
+   case OPUS_BANDWIDTH_NARROWBAND:
+      end = 13;
+      break;
+   case OPUS_BANDWIDTH_WIDEBAND:
+      end = 17;
+      break;
+   case OPUS_BANDWIDTH_SUPERWIDEBAND:
+      end = 19;
+      break;
+   default:
+      end = 21;
+      break;
+   }
+
+   /* Split the target packet size evenly between the frames, after the
+      TOC byte and, for code 3 packets, the frame count and frame sizes. */
+   frame_size = st->mode->shortMdctSize<<LM;
+   packet_bytes = st->bitrate_bps*frame_size/(8*48000)*count;
+   packet_bytes -= count > 1 ? 2+count : 1;
+   frame_bytes = IMAX(2, packet_bytes/count);
+
+   tot_len = 0;
+   for (i=0;i<count;i++)
+      tot_len += 1+size[i];
+   ALLOC(buf, tot_len, unsigned char);
+   opus_repacketizer_init(&rp);
+   tot_len = 0;
+   for (i=0;i<count;i++)
+   {
+      buf[tot_len] = toc&0xFC;
+      ret = transrate_frame(st, frames[i], size[i], buf+tot_len+1,
+            IMIN(frame_bytes, size[i]), LM, C, end);
+      if (ret < 0)
+         break;
+      ret = opus_repacketizer_cat(&rp, buf+tot_len, ret+1);
+      if (ret != OPUS_OK)
+      {
+         ret = OPUS_INTERNAL_ERROR;
+         break;
+      }
+      tot_len += 1+size[i];
+   }
+   if (ret >= 0)
+      ret = opus_repacketizer_out(&rp, out, max_out_bytes);
+   RESTORE_STACK;
+   return ret;
+}
+
+opus_int32 opus_transrate(OpusTransrater *st, const unsigned char *data,
+      opus_int32 len, unsigned char *out, opus_int32 max_out_bytes)
+{
+   opus_int32 ret;
+   OpusTransrater saved;
+   /* Leave the state untouched if the packet cannot be transrated, which
+      includes running out of scratch space. */
+   OPUS_COPY(&saved, st, 1);
+   SCRATCH_GUARD(ret, ret = opus_transrate_impl(st, data, len, out,
+         max_out_bytes));
+   if (ret < 0)
+      OPUS_COPY(st, &saved, 1);
+   return ret;
+}
+
+int opus_transrater_ctl(OpusTransrater *st, int request, ...)
+{
+   va_list ap;
+   int ret = OPUS_OK;
+   va_start(ap, request);
+   switch (request)
+   {
+   case OPUS_SET_BITRATE_REQUEST:
+   {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value <= 0)
+         goto bad_arg;
+      st->bitrate_bps = IMIN(512000, IMAX(500, value));
+   }
+   break;
+   case OPUS_GET_BITRATE_REQUEST:
+   {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      if (!value)
+         goto bad_arg;
+      *value = st->bitrate_bps;
+   }
+   break;
+   case OPUS_SET_COMPLEXITY_REQUEST:
+   {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value<0 || value>10)
+         goto bad_arg;
+      st->complexity = value;
+   }
+   break;
+   case OPUS_GET_COMPLEXITY_REQUEST:
+   {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      if (!value)
+         goto bad_arg;
+      *value = st->complexity;
+   }
+   break;
+   case OPUS_GET_FINAL_RANGE_REQUEST:
+   {
+      opus_uint32 *value = va_arg(ap, opus_uint32*);
+      if (!value)
+         goto bad_arg;
+      *value = st->out_rng;
+   }
+   break;
+   case OPUS_RESET_STATE:
+   {
+      OPUS_CLEAR((char*)&st->TRANSRATER_RESET_START,
+            sizeof(OpusTransrater)-
+            ((char*)&st->TRANSRATER_RESET_START - (char*)st));
+      st->synced = 1;
+      st->delayedIntra = 1;
+   }
+   break;
+   default:
+      ret = OPUS_UNIMPLEMENTED;
+      break;
+   }
+   va_end(ap);
+   return ret;
+bad_arg:
+   va_end(ap);
+   return OPUS_BAD_ARG;
+}
+
+void opus_transrater_destroy(OpusTransrater *st)
+{
+   opus_free(st);
+}
@@ -0,0 +1,145 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "resample_44k1.h"
+#include "pitch.h"
+#include "stack_alloc.h"
+#include "os_support.h"
+#include "resample_44k1_tables.h"
+
+/* Input samples de-interleaved per block. */
+#define RESAMPLE_44K1_BLOCK 480
+
+/* Runs the polyphase filter coef of taps taps over len input samples of
+   step_in ticks each, producing one output every step_out ticks.
+
+   Each channel of a block is copied after the end of the previous one, and
+   also in reverse order. A stored phase is applied to the forward copy, and
+   the mirror of a stored phase is the same row applied to the reverse copy,
+   so every output is a single inner product over contiguous data. Stereo
+   outputs share the coefficient loads through dual_inner_prod(). */
+static int resample_44k1(Resample44k1State *st, const opus_val16 *in, int len,
+      opus_val16 *out, int C, const opus_val16 *coef, int taps, int step_in,
+      int step_out, int arch)
+{
+   int c, i, n;
+   int half;
+   int stride;
+   opus_int32 t;
+   opus_val16 *x[2], *xr[2];
+   VARDECL(opus_val16, buf);
+   SAVE_STACK;
+
+   celt_assert(C == 1 || C == 2);
+   half = (step_in+1)/2;
+   stride = taps-1+RESAMPLE_44K1_BLOCK;
+   ALLOC(buf, 2*C*stride, opus_val16);
+   x[1] = xr[1] = NULL;
+   for (c=0;c<C;c++)
+   {
+      x[c] = buf+2*c*stride;
+      xr[c] = x[c]+stride;
+   }
+   t = st->pos;
+   n = 0;
+   while (len > 0)
+   {
+      int N, T;
+      N = IMIN(len, RESAMPLE_44K1_BLOCK);
+      T = taps-1+N;
+      for (c=0;c<C;c++)
+      {
+         OPUS_COPY(x[c], st->mem[c], taps-1);
+         for (i=0;i<N;i++)
+            x[c][taps-1+i] = in[i*C+c];
+         for (i=0;i<T;i++)
+            xr[c][i] = x[c][T-1-i];
+         OPUS_COPY(st->mem[c], x[c]+N, taps-1);
+      }
+      /* The output at t uses input m of the block, which sits at x[taps-1+m],
+         and the taps-1 samples before it. */
+      for (;t<(opus_int32)N*step_in;t+=step_out)
+      {
+         int m, p, off;
+         const opus_val16 *h;
+         opus_val16 *const *src;
+         opus_val32 y0, y1;
+         m = t/step_in;
+         p = t-m*step_in;
+         if (p < half)
+         {
+            h = coef+p*taps;
+            src = x;
+            off = m;
+         } else {
+            h = coef+(step_in-1-p)*taps;
+            src = xr;
+            off = T-taps-m;
+         }
+         if (C == 2)
+         {
+            dual_inner_prod(h, src[0]+off, src[1]+off, taps, &y0, &y1, arch);
+            out[2*n] = SATURATE16(PSHR32(y0, 14));
+            out[2*n+1] = SATURATE16(PSHR32(y1, 14));
+         } else {
+            y0 = celt_inner_prod(src[0]+off, h, taps, arch);
+            out[n] = SATURATE16(PSHR32(y0, 14));
+         }
+         n++;
+      }
+      t -= (opus_int32)N*step_in;
+      in += N*C;
+      len -= N;
+   }
+   st->pos = t;
+   RESTORE_STACK;
+   return n;
+}
+
+int resample_44k1_up(Resample44k1State *st, const opus_val16 *in, int len,
+      opus_val16 *out, int C, int arch)
+{
+   celt_assert(len%147 == 0 && st->pos == 0);
+   return resample_44k1(st, in, len, out, C, resample_44k1_up_coef[0],
+         RESAMPLE_44K1_UP_TAPS, 160, 147, arch);
+}
+
+int resample_44k1_down(Resample44k1State *st, const opus_val16 *in, int len,
+      opus_val16 *out, int C, int arch)
+{
+   return resample_44k1(st, in, len, out, C, resample_44k1_down_coef[0],
+         RESAMPLE_44K1_DOWN_TAPS, 147, 160, arch);
+}
+
+int resample_44k1_down_size(const Resample44k1State *st, int len)
+{
+   opus_int32 end = (opus_int32)len*147;
+   return end > st->pos ? (int)((end-st->pos+159)/160) : 0;
+}
@@ -0,0 +1,66 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef RESAMPLE_44K1_H
+#define RESAMPLE_44K1_H
+
+#include "arch.h"
+
+/* Polyphase converters between 44.1 kHz at the API and the 48 kHz the codec
+   runs at. Times are counted at 7.056 MHz, where a 44.1 kHz sample lasts 160
+   ticks and a 48 kHz sample 147. */
+
+#define RESAMPLE_44K1_UP_TAPS   32
+#define RESAMPLE_44K1_DOWN_TAPS 36
+
+/* Group delays in 7.056 MHz ticks, about 0.36 and 0.37 ms. */
+#define RESAMPLE_44K1_UP_DELAY   2560
+#define RESAMPLE_44K1_DOWN_DELAY 2646
+
+typedef struct {
+   /* The last DOWN_TAPS-1 input samples of each channel, oldest first. */
+   opus_val16 mem[2][RESAMPLE_44K1_DOWN_TAPS-1];
+   /* Time of the next output after the first sample of the next input,
+      in ticks. */
+   opus_int32 pos;
+} Resample44k1State;
+
+/* Converts len samples per channel at 44.1 kHz to 48 kHz. len must be a
+   multiple of 147, and the len*160/147 output samples are returned. */
+int resample_44k1_up(Resample44k1State *st, const opus_val16 *in, int len,
+      opus_val16 *out, int C, int arch);
+
+/* Converts len samples per channel at 48 kHz to 44.1 kHz and returns the
+   number of output samples, see resample_44k1_down_size(). */
+int resample_44k1_down(Resample44k1State *st, const opus_val16 *in, int len,
+      opus_val16 *out, int C, int arch);
+
+/* Number of samples the next call to resample_44k1_down() produces from len
+   input samples. It is len*147/160 rounded either way, depending on the
+   accumulated phase. */
+int resample_44k1_down_size(const Resample44k1State *st, int len);
+
+#endif /* RESAMPLE_44K1_H */
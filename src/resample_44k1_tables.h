@@ -0,0 +1,1639 @@
+/* This file is auto-generated. It holds the polyphase filters of the 44.1 kHz
+   converters in resample_44k1.c.
+
+   Both are Kaiser-windowed sincs (beta = 9.1) designed at 7.056 MHz, the
+   lowest rate on which 44.1 and 48 kHz samples both fall, with a cutoff of
+   24 kHz. The response is flat within 0.001 dB up to 20 kHz, -6 dB at
+   24 kHz and below -92 dB from 28 kHz. Aliases and images of anything up to
+   20 kHz therefore stay above 20 kHz, which is all Opus codes.
+
+   Row p holds the taps applied to the taps most recent input samples,
+   oldest first, for an output that falls p/7.056 MHz after the most recent
+   one. The filters are symmetric, so row L-1-p (where L is the number of
+   phases) is row p reversed and only the first (L+1)/2 rows are stored. */
+
+#define Q14(x) QCONST16(x, 14)
+
+/* 44.1 -> 48 kHz: 160 phases of 32 taps. */
+static const opus_val16 resample_44k1_up_coef[80][32] = {
+   {
+      Q14(8.43153e-05), Q14(-0.000208252), Q14(0.000336009), Q14(-0.000303436),
+      Q14(-0.000210696), Q14(0.00169353), Q14(-0.00474694), Q14(0.00996672),
+      Q14(-0.0177675), Q14(0.0281948), Q14(-0.0407849), Q14(0.0545327),
+      Q14(-0.0680125), Q14(0.0796912), Q14(-0.0887726), Q14(1.08841),
+      Q14(-0.0828943), Q14(0.0772682), Q14(-0.066887), Q14(0.0540902),
+      Q14(-0.0407207), Q14(0.0283206), Q14(-0.0179622), Q14(0.010158),
+      Q14(-0.00489926), Q14(0.00179734), Q14(-0.000271725), Q14(-0.000273014),
+      Q14(0.000323766), Q14(-0.000204753), Q14(8.39233e-05), Q14(-1.59229e-05)
+   },
+   {
+      Q14(8.46551e-05), Q14(-0.000211605), Q14(0.00034797), Q14(-0.00033346),
+      Q14(-0.000150014), Q14(0.00158961), Q14(-0.00459329), Q14(0.00977186),
+      Q14(-0.0175655), Q14(0.0280565), Q14(-0.04083), Q14(0.054948),
+      Q14(-0.0691007), Q14(0.0820605), Q14(-0.094535), Q14(1.08824),
+      Q14(-0.076901), Q14(0.0747922), Q14(-0.0657244), Q14(0.0536205),
+      Q14(-0.0406373), Q14(0.0284339), Q14(-0.0181496), Q14(0.0103455),
+      Q14(-0.0050502), Q14(0.00190099), Q14(-0.000333074), Q14(-0.000242203),
+      Q14(0.000311242), Q14(-0.000201107), Q14(8.34785e-05), Q14(-1.60854e-05)
+   },
+   {
+      Q14(8.49434e-05), Q14(-0.000214811), Q14(0.000359644), Q14(-0.000363073),
+      Q14(-8.97057e-05), Q14(0.00148561), Q14(-0.00443841), Q14(0.00957351),
+      Q14(-0.0173563), Q14(0.0279059), Q14(-0.0408561), Q14(0.055336),
+      Q14(-0.0701511), Q14(0.0843754), Q14(-0.100181), Q14(1.0879),
+      Q14(-0.0707933), Q14(0.0722639), Q14(-0.064525), Q14(0.0531236),
+      Q14(-0.0405347), Q14(0.0285346), Q14(-0.0183295), Q14(0.0105293),
+      Q14(-0.00519966), Q14(0.00200441), Q14(-0.000394717), Q14(-0.000211017),
+      Q14(0.000298441), Q14(-0.000197315), Q14(8.29804e-05), Q14(-1.62393e-05)
+   },
+   {
+      Q14(8.51807e-05), Q14(-0.00021787), Q14(0.000371029), Q14(-0.000392265),
+      Q14(-2.97967e-05), Q14(0.0013816), Q14(-0.00428238), Q14(0.00937179),
+      Q14(-0.0171402), Q14(0.0277432), Q14(-0.0408632), Q14(0.0556966),
+      Q14(-0.0711636), Q14(0.0866352), Q14(-0.105709), Q14(1.0874),
+      Q14(-0.0645721), Q14(0.0696841), Q14(-0.0632893), Q14(0.0525998),
+      Q14(-0.0404128), Q14(0.0286225), Q14(-0.0185017), Q14(0.0107091),
+      Q14(-0.00534756), Q14(0.00210757), Q14(-0.000456625), Q14(-0.000179466),
+      Q14(0.000285369), Q14(-0.000193377), Q14(8.24284e-05), Q14(-1.63842e-05)
+   },
+   {
+      Q14(8.53678e-05), Q14(-0.000220784), Q14(0.000382122), Q14(-0.000421025),
+      Q14(2.96872e-05), Q14(0.00127762), Q14(-0.00412527), Q14(0.0091668),
+      Q14(-0.0169173), Q14(0.0275684), Q14(-0.0408514), Q14(0.0560298),
+      Q14(-0.0721379), Q14(0.0888395), Q14(-0.11112), Q14(1.08673),
+      Q14(-0.0582385), Q14(0.0670535), Q14(-0.0620175), Q14(0.0520491),
+      Q14(-0.0402717), Q14(0.0286975), Q14(-0.0186663), Q14(0.0108849),
+      Q14(-0.00549383), Q14(0.00221041), Q14(-0.000518771), Q14(-0.000147564),
+      Q14(0.000272027), Q14(-0.000189293), Q14(8.18219e-05), Q14(-1.65198e-05)
+   },
+   {
+      Q14(8.55053e-05), Q14(-0.000223551), Q14(0.000392919), Q14(-0.000449343),
+      Q14(8.87206e-05), Q14(0.00117372), Q14(-0.00396716), Q14(0.00895867),
+      Q14(-0.0166876), Q14(0.0273817), Q14(-0.0408209), Q14(0.0563357),
+      Q14(-0.0730738), Q14(0.0909875), Q14(-0.116412), Q14(1.0859),
+      Q14(-0.0517932), Q14(0.064373), Q14(-0.06071), Q14(0.0514716),
+      Q14(-0.0401112), Q14(0.0287596), Q14(-0.0188229), Q14(0.0110566),
+      Q14(-0.00563839), Q14(0.00231288), Q14(-0.000581127), Q14(-0.000115324),
+      Q14(0.00025842), Q14(-0.000185064), Q14(8.11605e-05), Q14(-1.66457e-05)
+   },
+   {
+      Q14(8.5594e-05), Q14(-0.000226173), Q14(0.00040342), Q14(-0.000477208),
+      Q14(0.000147279), Q14(0.00106995), Q14(-0.00380814), Q14(0.00874751),
+      Q14(-0.0164514), Q14(0.0271833), Q14(-0.0407716), Q14(0.0566141),
+      Q14(-0.073971), Q14(0.0930788), Q14(-0.121585), Q14(1.0849),
+      Q14(-0.0452372), Q14(0.0616434), Q14(-0.0593673), Q14(0.0508675),
+      Q14(-0.0399314), Q14(0.0288087), Q14(-0.0189716), Q14(0.011224),
+      Q14(-0.00578116), Q14(0.00241493), Q14(-0.000643664), Q14(-8.27568e-05),
+      Q14(0.000244553), Q14(-0.00018069), Q14(8.04437e-05), Q14(-1.67616e-05)
+   },
+   {
+      Q14(8.56345e-05), Q14(-0.000228649), Q14(0.00041362), Q14(-0.000504612),
+      Q14(0.000205337), Q14(0.000966351), Q14(-0.00364828), Q14(0.00853342),
+      Q14(-0.0162087), Q14(0.0269732), Q14(-0.0407038), Q14(0.056865),
+      Q14(-0.0748293), Q14(0.0951127), Q14(-0.126638), Q14(1.08373),
+      Q14(-0.0385717), Q14(0.0588655), Q14(-0.0579897), Q14(0.0502369),
+      Q14(-0.0397322), Q14(0.0288446), Q14(-0.0191122), Q14(0.0113872),
+      Q14(-0.00592207), Q14(0.0025165), Q14(-0.000706355), Q14(-4.9877e-05),
+      Q14(0.000230429), Q14(-0.000176171), Q14(7.9671e-05), Q14(-1.68671e-05)
+   },
+   {
+      Q14(8.56276e-05), Q14(-0.00023098), Q14(0.000423519), Q14(-0.000531544),
+      Q14(0.000262872), Q14(0.000862982), Q14(-0.00348766), Q14(0.00831653),
+      Q14(-0.0159598), Q14(0.0267517), Q14(-0.0406176), Q14(0.0570886),
+      Q14(-0.0756486), Q14(0.0970888), Q14(-0.131571), Q14(1.0824),
+      Q14(-0.0317975), Q14(0.0560402), Q14(-0.0565778), Q14(0.04958),
+      Q14(-0.0395137), Q14(0.0288672), Q14(-0.0192447), Q14(0.0115458),
+      Q14(-0.00606102), Q14(0.00261756), Q14(-0.000769169), Q14(-1.66977e-05),
+      Q14(0.000216054), Q14(-0.000171509), Q14(7.8842e-05), Q14(-1.69619e-05)
+   },
+   {
+      Q14(8.5574e-05), Q14(-0.000233167), Q14(0.000433115), Q14(-0.000557995),
+      Q14(0.000319859), Q14(0.000759885), Q14(-0.00332637), Q14(0.00809695),
+      Q14(-0.0157047), Q14(0.0265189), Q14(-0.040513), Q14(0.0572848),
+      Q14(-0.0764287), Q14(0.0990066), Q14(-0.136383), Q14(1.0809),
+      Q14(-0.0249158), Q14(0.0531685), Q14(-0.0551319), Q14(0.0488969),
+      Q14(-0.0392759), Q14(0.0288766), Q14(-0.0193688), Q14(0.0117),
+      Q14(-0.00619796), Q14(0.00271803), Q14(-0.000832077), Q14(1.67674e-05),
+      Q14(0.000201431), Q14(-0.000166704), Q14(7.79564e-05), Q14(-1.70456e-05)
+   },
+   {
+      Q14(8.54746e-05), Q14(-0.00023521), Q14(0.000442404), Q14(-0.000583958),
+      Q14(0.000376276), Q14(0.000657107), Q14(-0.00316448), Q14(0.00787481),
+      Q14(-0.0154437), Q14(0.026275), Q14(-0.0403902), Q14(0.0574537),
+      Q14(-0.0771694), Q14(0.100866), Q14(-0.141075), Q14(1.07924),
+      Q14(-0.0179278), Q14(0.0502513), Q14(-0.0536525), Q14(0.0481878),
+      Q14(-0.0390187), Q14(0.0288727), Q14(-0.0194846), Q14(0.0118495),
+      Q14(-0.0063328), Q14(0.00281789), Q14(-0.00089505), Q14(5.05044e-05),
+      Q14(0.000186567), Q14(-0.000161757), Q14(7.70136e-05), Q14(-1.7118e-05)
+   },
+   {
+      Q14(8.53301e-05), Q14(-0.000237111), Q14(0.000451387), Q14(-0.000609422),
+      Q14(0.000432099), Q14(0.000554695), Q14(-0.00300208), Q14(0.00765021),
+      Q14(-0.0151768), Q14(0.0260201), Q14(-0.0402494), Q14(0.0575953),
+      Q14(-0.0778707), Q14(0.102666), Q14(-0.145645), Q14(1.07741),
+      Q14(-0.0108345), Q14(0.0472895), Q14(-0.0521401), Q14(0.0474531),
+      Q14(-0.0387423), Q14(0.0288553), Q14(-0.0195919), Q14(0.0119943),
+      Q14(-0.00646546), Q14(0.00291706), Q14(-0.000958059), Q14(8.44992e-05),
+      Q14(0.000171465), Q14(-0.000156668), Q14(7.60134e-05), Q14(-1.71787e-05)
+   },
+   {
+      Q14(8.51412e-05), Q14(-0.000238868), Q14(0.000460061), Q14(-0.000634381),
+      Q14(0.000487307), Q14(0.000452695), Q14(-0.00283923), Q14(0.00742327),
+      Q14(-0.0149042), Q14(0.0257544), Q14(-0.0400907), Q14(0.0577097),
+      Q14(-0.0785323), Q14(0.104406), Q14(-0.150093), Q14(1.07542),
+      Q14(-0.00363725), Q14(0.0442842), Q14(-0.0505953), Q14(0.0466927),
+      Q14(-0.0384466), Q14(0.0288245), Q14(-0.0196906), Q14(0.0121343),
+      Q14(-0.00659588), Q14(0.0030155), Q14(-0.00102107), Q14(0.000118737),
+      Q14(0.000156132), Q14(-0.000151439), Q14(7.49555e-05), Q14(-1.72273e-05)
+   },
+   {
+      Q14(8.49089e-05), Q14(-0.000240484), Q14(0.000468426), Q14(-0.000658826),
+      Q14(0.000541877), Q14(0.000351153), Q14(-0.00267603), Q14(0.00719412),
+      Q14(-0.0146261), Q14(0.0254781), Q14(-0.0399142), Q14(0.057797),
+      Q14(-0.0791544), Q14(0.106087), Q14(-0.154419), Q14(1.07326),
+      Q14(0.00366278), Q14(0.0412362), Q14(-0.0490185), Q14(0.045907),
+      Q14(-0.0381317), Q14(0.0287801), Q14(-0.0197807), Q14(0.0122694),
+      Q14(-0.00672397), Q14(0.00311317), Q14(-0.00108406), Q14(0.000153204),
+      Q14(0.000140572), Q14(-0.000146071), Q14(7.38396e-05), Q14(-1.72636e-05)
+   },
+   {
+      Q14(8.4634e-05), Q14(-0.00024196), Q14(0.00047648), Q14(-0.00068275),
+      Q14(0.000595788), Q14(0.000250112), Q14(-0.00251255), Q14(0.00696287),
+      Q14(-0.0143426), Q14(0.0251913), Q14(-0.0397201), Q14(0.0578572),
+      Q14(-0.0797366), Q14(0.107707), Q14(-0.158623), Q14(1.07094),
+      Q14(0.0110643), Q14(0.0381468), Q14(-0.0474103), Q14(0.0450963),
+      Q14(-0.0377976), Q14(0.0287222), Q14(-0.019862), Q14(0.0123994),
+      Q14(-0.00684966), Q14(0.00321), Q14(-0.001147), Q14(0.000187885),
+      Q14(0.000124792), Q14(-0.000140565), Q14(7.26655e-05), Q14(-1.72871e-05)
+   },
+   {
+      Q14(8.43172e-05), Q14(-0.000243295), Q14(0.000484221), Q14(-0.000706146),
+      Q14(0.00064902), Q14(0.000149619), Q14(-0.00234887), Q14(0.00672964),
+      Q14(-0.0140539), Q14(0.0248943), Q14(-0.0395087), Q14(0.0578906),
+      Q14(-0.0802791), Q14(0.109266), Q14(-0.162705), Q14(1.06846),
+      Q14(0.018566), Q14(0.035017), Q14(-0.0457712), Q14(0.0442607),
+      Q14(-0.0374445), Q14(0.0286506), Q14(-0.0199345), Q14(0.0125244),
+      Q14(-0.00697288), Q14(0.00330595), Q14(-0.00120984), Q14(0.000222764),
+      Q14(0.000108796), Q14(-0.000134922), Q14(7.14328e-05), Q14(-1.72977e-05)
+   },
+   {
+      Q14(8.39595e-05), Q14(-0.000244492), Q14(0.000491651), Q14(-0.000729006),
+      Q14(0.000701552), Q14(4.97163e-05), Q14(-0.00218506), Q14(0.00649455),
+      Q14(-0.0137602), Q14(0.0245871), Q14(-0.03928), Q14(0.057897),
+      Q14(-0.0807818), Q14(0.110765), Q14(-0.166664), Q14(1.06582),
+      Q14(0.0261665), Q14(0.0318478), Q14(-0.0441019), Q14(0.0434005),
+      Q14(-0.0370724), Q14(0.0285655), Q14(-0.019998), Q14(0.0126442),
+      Q14(-0.00709356), Q14(0.00340096), Q14(-0.00127258), Q14(0.000257826),
+      Q14(9.25906e-05), Q14(-0.000129143), Q14(7.01414e-05), Q14(-1.72949e-05)
+   },
+   {
+      Q14(8.35617e-05), Q14(-0.000245552), Q14(0.000498767), Q14(-0.000751324),
+      Q14(0.000753363), Q14(-4.95524e-05), Q14(-0.0020212), Q14(0.00625773),
+      Q14(-0.0134616), Q14(0.0242701), Q14(-0.0390343), Q14(0.0578768),
+      Q14(-0.0812446), Q14(0.112203), Q14(-0.1705), Q14(1.06302),
+      Q14(0.0338645), Q14(0.0286403), Q14(-0.0424029), Q14(0.0425161),
+      Q14(-0.0366813), Q14(0.0284666), Q14(-0.0200526), Q14(0.0127588),
+      Q14(-0.00721162), Q14(0.00349499), Q14(-0.00133516), Q14(0.000293057),
+      Q14(7.61823e-05), Q14(-0.00012323), Q14(6.87912e-05), Q14(-1.72785e-05)
+   },
+   {
+      Q14(8.31247e-05), Q14(-0.000246474), Q14(0.000505569), Q14(-0.000773095),
+      Q14(0.000804436), Q14(-0.000148144), Q14(-0.00185738), Q14(0.00601929),
+      Q14(-0.0131582), Q14(0.0239434), Q14(-0.0387717), Q14(0.0578301),
+      Q14(-0.0816676), Q14(0.113579), Q14(-0.174213), Q14(1.06005),
+      Q14(0.0416585), Q14(0.0253958), Q14(-0.0406748), Q14(0.0416076),
+      Q14(-0.0362714), Q14(0.0283541), Q14(-0.0200981), Q14(0.012868),
+      Q14(-0.007327), Q14(0.00358798), Q14(-0.00139756), Q14(0.000328439),
+      Q14(5.95769e-05), Q14(-0.000117185), Q14(6.73819e-05), Q14(-1.72482e-05)
+   },
+   {
+      Q14(8.26494e-05), Q14(-0.000247261), Q14(0.000512058), Q14(-0.000794311),
+      Q14(0.000854749), Q14(-0.000246017), Q14(-0.00169367), Q14(0.00577934),
+      Q14(-0.0128503), Q14(0.0236073), Q14(-0.0384925), Q14(0.0577569),
+      Q14(-0.0820507), Q14(0.114894), Q14(-0.177804), Q14(1.05693),
+      Q14(0.049547), Q14(0.0221153), Q14(-0.0389182), Q14(0.0406754),
+      Q14(-0.0358428), Q14(0.0282279), Q14(-0.0201346), Q14(0.0129719),
+      Q14(-0.00743962), Q14(0.00367988), Q14(-0.00145976), Q14(0.000363958),
+      Q14(4.27809e-05), Q14(-0.000111009), Q14(6.59136e-05), Q14(-1.72035e-05)
+   },
+   {
+      Q14(8.21367e-05), Q14(-0.000247914), Q14(0.000518233), Q14(-0.000814967),
+      Q14(0.000904286), Q14(-0.000343129), Q14(-0.00153014), Q14(0.00553802),
+      Q14(-0.012538), Q14(0.0232618), Q14(-0.0381968), Q14(0.0576574),
+      Q14(-0.0823941), Q14(0.116148), Q14(-0.181271), Q14(1.05365),
+      Q14(0.0575286), Q14(0.0188), Q14(-0.0371339), Q14(0.0397198),
+      Q14(-0.0353955), Q14(0.028088), Q14(-0.0201618), Q14(0.0130702),
+      Q14(-0.00754941), Q14(0.00377064), Q14(-0.00152171), Q14(0.000399596),
+      Q14(2.58008e-05), Q14(-0.000104703), Q14(6.43862e-05), Q14(-1.71444e-05)
+   },
+   {
+      Q14(8.15875e-05), Q14(-0.000248434), Q14(0.000524094), Q14(-0.000835059),
+      Q14(0.000953028), Q14(-0.00043944), Q14(-0.00136687), Q14(0.00529544),
+      Q14(-0.0122215), Q14(0.0229072), Q14(-0.0378849), Q14(0.0575319),
+      Q14(-0.0826977), Q14(0.117339), Q14(-0.184616), Q14(1.05021),
+      Q14(0.0656017), Q14(0.0154512), Q14(-0.0353224), Q14(0.0387412),
+      Q14(-0.0349298), Q14(0.0279344), Q14(-0.0201798), Q14(0.0131629),
+      Q14(-0.00765631), Q14(0.00386022), Q14(-0.0015834), Q14(0.000435338),
+      Q14(8.64321e-06), Q14(-9.82695e-05), Q14(6.27996e-05), Q14(-1.70704e-05)
+   },
+   {
+      Q14(8.10027e-05), Q14(-0.000248823), Q14(0.000529641), Q14(-0.00085458),
+      Q14(0.00100096), Q14(-0.000534909), Q14(-0.00120393), Q14(0.00505173),
+      Q14(-0.0119009), Q14(0.0225437), Q14(-0.037557), Q14(0.0573805),
+      Q14(-0.0829617), Q14(0.118469), Q14(-0.187838), Q14(1.04662),
+      Q14(0.0737647), Q14(0.0120701), Q14(-0.0334845), Q14(0.0377398),
+      Q14(-0.0344456), Q14(0.0277671), Q14(-0.0201885), Q14(0.01325),
+      Q14(-0.00776025), Q14(0.00394855), Q14(-0.00164477), Q14(0.000471168),
+      Q14(-8.685e-06), Q14(-9.17104e-05), Q14(6.11538e-05), Q14(-1.69813e-05)
+   },
+   {
+      Q14(8.03832e-05), Q14(-0.000249081), Q14(0.000534874), Q14(-0.000873527),
+      Q14(0.00104806), Q14(-0.000629496), Q14(-0.00104141), Q14(0.00480699),
+      Q14(-0.0115764), Q14(0.0221716), Q14(-0.0372133), Q14(0.0572034),
+      Q14(-0.0831862), Q14(0.119536), Q14(-0.190937), Q14(1.04287),
+      Q14(0.0820162), Q14(0.00865791), Q14(-0.0316207), Q14(0.0367161),
+      Q14(-0.0339433), Q14(0.0275861), Q14(-0.0201879), Q14(0.0133314),
+      Q14(-0.00786116), Q14(0.0040356), Q14(-0.00170582), Q14(0.000507067),
+      Q14(-2.61769e-05), Q14(-8.50274e-05), Q14(5.94488e-05), Q14(-1.68767e-05)
+   },
+   {
+      Q14(7.973e-05), Q14(-0.000249211), Q14(0.000539795), Q14(-0.000891896),
+      Q14(0.00109432), Q14(-0.000723164), Q14(-0.000879363), Q14(0.00456135),
+      Q14(-0.0112483), Q14(0.021791), Q14(-0.036854), Q14(0.0570009),
+      Q14(-0.0833711), Q14(0.120542), Q14(-0.193913), Q14(1.03896),
+      Q14(0.0903543), Q14(0.00521595), Q14(-0.0297319), Q14(0.0356703),
+      Q14(-0.0334228), Q14(0.0273915), Q14(-0.0201778), Q14(0.013407),
+      Q14(-0.00795898), Q14(0.00412131), Q14(-0.00176649), Q14(0.00054302),
+      Q14(-4.38252e-05), Q14(-7.82227e-05), Q14(5.76848e-05), Q14(-1.67565e-05)
+   },
+   {
+      Q14(7.9044e-05), Q14(-0.000249213), Q14(0.000544404), Q14(-0.000909681),
+      Q14(0.00113971), Q14(-0.000815872), Q14(-0.000717876), Q14(0.00431494),
+      Q14(-0.0109165), Q14(0.0214022), Q14(-0.0364795), Q14(0.056773),
+      Q14(-0.0835168), Q14(0.121485), Q14(-0.196768), Q14(1.0349),
+      Q14(0.0987775), Q14(0.0017455), Q14(-0.0278187), Q14(0.0346029),
+      Q14(-0.0328844), Q14(0.0271832), Q14(-0.0201584), Q14(0.0134768),
+      Q14(-0.00805365), Q14(0.00420563), Q14(-0.00182676), Q14(0.00057901),
+      Q14(-6.16229e-05), Q14(-7.12982e-05), Q14(5.58618e-05), Q14(-1.66204e-05)
+   },
+   {
+      Q14(7.83261e-05), Q14(-0.00024909), Q14(0.000548701), Q14(-0.00092688),
+      Q14(0.00118423), Q14(-0.000907585), Q14(-0.000557019), Q14(0.00406787),
+      Q14(-0.0105814), Q14(0.0210054), Q14(-0.0360898), Q14(0.05652),
+      Q14(-0.0836232), Q14(0.122366), Q14(-0.1995), Q14(1.03069),
+      Q14(0.107284), Q14(-0.00175212), Q14(-0.0258819), Q14(0.0335142),
+      Q14(-0.0323282), Q14(0.0269613), Q14(-0.0201294), Q14(0.0135407),
+      Q14(-0.00814509), Q14(0.00428851), Q14(-0.00188661), Q14(0.000615018),
+      Q14(-7.95623e-05), Q14(-6.42562e-05), Q14(5.398e-05), Q14(-1.6468e-05)
+   },
+   {
+      Q14(7.75773e-05), Q14(-0.000248843), Q14(0.000552688), Q14(-0.000943489),
+      Q14(0.00122785), Q14(-0.000998264), Q14(-0.000396862), Q14(0.00382026),
+      Q14(-0.0102431), Q14(0.0206007), Q14(-0.0356854), Q14(0.0562423),
+      Q14(-0.0836907), Q14(0.123185), Q14(-0.20211), Q14(1.02633),
+      Q14(0.115872), Q14(-0.00527558), Q14(-0.0239222), Q14(0.0324046),
+      Q14(-0.0317545), Q14(0.0267259), Q14(-0.020091), Q14(0.0135985),
+      Q14(-0.00823325), Q14(0.00436991), Q14(-0.00194599), Q14(0.000651029),
+      Q14(-9.76361e-05), Q14(-5.7099e-05), Q14(5.20395e-05), Q14(-1.62992e-05)
+   },
+   {
+      Q14(7.67985e-05), Q14(-0.000248473), Q14(0.000556366), Q14(-0.000959505),
+      Q14(0.00127057), Q14(-0.00108788), Q14(-0.000237477), Q14(0.00357222),
+      Q14(-0.00990177), Q14(0.0201885), Q14(-0.0352664), Q14(0.05594),
+      Q14(-0.0837192), Q14(0.123942), Q14(-0.204599), Q14(1.02182),
+      Q14(0.12454), Q14(-0.00882351), Q14(-0.0219404), Q14(0.0312746),
+      Q14(-0.0311633), Q14(0.0264769), Q14(-0.020043), Q14(0.0136504),
+      Q14(-0.00831807), Q14(0.00444977), Q14(-0.00200488), Q14(0.000687024),
+      Q14(-0.000115836), Q14(-4.98289e-05), Q14(5.00407e-05), Q14(-1.61136e-05)
+   },
+   {
+      Q14(7.59907e-05), Q14(-0.000247983), Q14(0.000559736), Q14(-0.000974925),
+      Q14(0.00131238), Q14(-0.00117638), Q14(-7.89339e-05), Q14(0.00332388),
+      Q14(-0.00955758), Q14(0.0197689), Q14(-0.0348331), Q14(0.0556133),
+      Q14(-0.0837091), Q14(0.124638), Q14(-0.206966), Q14(1.01716),
+      Q14(0.133286), Q14(-0.0123945), Q14(-0.0199373), Q14(0.0301245),
+      Q14(-0.0305549), Q14(0.0262144), Q14(-0.0199855), Q14(0.0136961),
+      Q14(-0.00839949), Q14(0.00452806), Q14(-0.00206324), Q14(0.000722986),
+      Q14(-0.000134155), Q14(-4.24484e-05), Q14(4.79836e-05), Q14(-1.59112e-05)
+   },
+   {
+      Q14(7.51549e-05), Q14(-0.000247374), Q14(0.000562799), Q14(-0.000989748),
+      Q14(0.00135325), Q14(-0.00126375), Q14(7.86974e-05), Q14(0.00307535),
+      Q14(-0.00921071), Q14(0.0193423), Q14(-0.0343857), Q14(0.0552626),
+      Q14(-0.0836606), Q14(0.125271), Q14(-0.209213), Q14(1.01236),
+      Q14(0.142109), Q14(-0.0159872), Q14(-0.0179136), Q14(0.0289549),
+      Q14(-0.0299295), Q14(0.0259386), Q14(-0.0199184), Q14(0.0137358),
+      Q14(-0.00847745), Q14(0.00460471), Q14(-0.00212104), Q14(0.000758897),
+      Q14(-0.000152585), Q14(-3.49601e-05), Q14(4.58687e-05), Q14(-1.56916e-05)
+   },
+   {
+      Q14(7.4292e-05), Q14(-0.000246648), Q14(0.000565557), Q14(-0.00100397),
+      Q14(0.00139317), Q14(-0.00134994), Q14(0.000235349), Q14(0.00282676),
+      Q14(-0.00886133), Q14(0.0189087), Q14(-0.0339246), Q14(0.0548882),
+      Q14(-0.0835738), Q14(0.125842), Q14(-0.211339), Q14(1.0074),
+      Q14(0.151005), Q14(-0.0196002), Q14(-0.0158702), Q14(0.027766),
+      Q14(-0.0292872), Q14(0.0256494), Q14(-0.0198417), Q14(0.0137692),
+      Q14(-0.0085519), Q14(0.0046797), Q14(-0.00217825), Q14(0.00079474),
+      Q14(-0.000171118), Q14(-2.73665e-05), Q14(4.36962e-05), Q14(-1.54545e-05)
+   },
+   {
+      Q14(7.3403e-05), Q14(-0.000245806), Q14(0.000568012), Q14(-0.00101759),
+      Q14(0.00143214), Q14(-0.00143493), Q14(0.000390952), Q14(0.00257821),
+      Q14(-0.00850963), Q14(0.0184685), Q14(-0.03345), Q14(0.0544902),
+      Q14(-0.083449), Q14(0.126352), Q14(-0.213345), Q14(1.0023),
+      Q14(0.159974), Q14(-0.023232), Q14(-0.0138078), Q14(0.0265585),
+      Q14(-0.0286284), Q14(0.0253469), Q14(-0.0197554), Q14(0.0137964),
+      Q14(-0.00862277), Q14(0.00475295), Q14(-0.00223485), Q14(0.000830496),
+      Q14(-0.000189745), Q14(-1.96704e-05), Q14(4.14666e-05), Q14(-1.51999e-05)
+   },
+   {
+      Q14(7.24888e-05), Q14(-0.000244851), Q14(0.000570166), Q14(-0.00103061),
+      Q14(0.00147014), Q14(-0.00151868), Q14(0.000545441), Q14(0.00232983),
+      Q14(-0.00815577), Q14(0.0180218), Q14(-0.0329622), Q14(0.0540691),
+      Q14(-0.0832865), Q14(0.126801), Q14(-0.215232), Q14(0.997064),
+      Q14(0.169014), Q14(-0.0268812), Q14(-0.0117274), Q14(0.0253327),
+      Q14(-0.0279532), Q14(0.0250312), Q14(-0.0196594), Q14(0.0138173),
+      Q14(-0.00869002), Q14(0.00482445), Q14(-0.00229079), Q14(0.000866146),
+      Q14(-0.000208458), Q14(-1.18745e-05), Q14(3.91801e-05), Q14(-1.49275e-05)
+   },
+   {
+      Q14(7.15503e-05), Q14(-0.000243784), Q14(0.00057202), Q14(-0.00104302),
+      Q14(0.00150716), Q14(-0.00160117), Q14(0.000698749), Q14(0.00208172),
+      Q14(-0.00779993), Q14(0.017569), Q14(-0.0324615), Q14(0.053625),
+      Q14(-0.0830866), Q14(0.127188), Q14(-0.217), Q14(0.991682),
+      Q14(0.178122), Q14(-0.0305463), Q14(-0.0096297), Q14(0.0240891),
+      Q14(-0.0272619), Q14(0.0247024), Q14(-0.0195539), Q14(0.0138318),
+      Q14(-0.00875359), Q14(0.00489413), Q14(-0.00234604), Q14(0.000901674),
+      Q14(-0.000227249), Q14(-3.98177e-06), Q14(3.68373e-05), Q14(-1.46371e-05)
+   },
+   {
+      Q14(7.05887e-05), Q14(-0.000242608), Q14(0.000573576), Q14(-0.00105483),
+      Q14(0.00154319), Q14(-0.00168235), Q14(0.000850811), Q14(0.00183401),
+      Q14(-0.00744229), Q14(0.0171103), Q14(-0.0319482), Q14(0.0531584),
+      Q14(-0.0828494), Q14(0.127515), Q14(-0.218649), Q14(0.986159),
+      Q14(0.187297), Q14(-0.0342258), Q14(-0.00751564), Q14(0.0228282),
+      Q14(-0.0265546), Q14(0.0243606), Q14(-0.0194387), Q14(0.01384),
+      Q14(-0.00881343), Q14(0.00496195), Q14(-0.00240058), Q14(0.000937061),
+      Q14(-0.000246108), Q14(4.00487e-06), Q14(3.44387e-05), Q14(-1.43285e-05)
+   },
+   {
+      Q14(6.96047e-05), Q14(-0.000241324), Q14(0.000574837), Q14(-0.00106603),
+      Q14(0.00157822), Q14(-0.0017622), Q14(0.00100156), Q14(0.0015868),
+      Q14(-0.00708303), Q14(0.0166458), Q14(-0.0314225), Q14(0.0526695),
+      Q14(-0.0825754), Q14(0.12778), Q14(-0.22018), Q14(0.980498),
+      Q14(0.196537), Q14(-0.0379183), Q14(-0.00538605), Q14(0.0215505),
+      Q14(-0.0258318), Q14(0.0240059), Q14(-0.019314), Q14(0.0138418),
+      Q14(-0.00886949), Q14(0.00502787), Q14(-0.00245437), Q14(0.000972288),
+      Q14(-0.000265029), Q14(1.20824e-05), Q14(3.19847e-05), Q14(-1.40016e-05)
+   },
+   {
+      Q14(6.85995e-05), Q14(-0.000239935), Q14(0.000575805), Q14(-0.00107662),
+      Q14(0.00161224), Q14(-0.00184069), Q14(0.00115094), Q14(0.00134022),
+      Q14(-0.00672231), Q14(0.0161759), Q14(-0.0308848), Q14(0.0521587),
+      Q14(-0.0822649), Q14(0.127986), Q14(-0.221595), Q14(0.9747),
+      Q14(0.205839), Q14(-0.0416221), Q14(-0.00324183), Q14(0.0202566),
+      Q14(-0.0250935), Q14(0.0236383), Q14(-0.0191796), Q14(0.0138371),
+      Q14(-0.00892173), Q14(0.00509185), Q14(-0.00250739), Q14(0.00100734),
+      Q14(-0.000284), Q14(2.02476e-05), Q14(2.94759e-05), Q14(-1.36561e-05)
+   },
+   {
+      Q14(6.75739e-05), Q14(-0.000238442), Q14(0.000576483), Q14(-0.00108661),
+      Q14(0.00164524), Q14(-0.0019178), Q14(0.00129889), Q14(0.00109436),
+      Q14(-0.00636031), Q14(0.0157008), Q14(-0.0303354), Q14(0.0516264),
+      Q14(-0.0819181), Q14(0.128131), Q14(-0.222892), Q14(0.968766),
+      Q14(0.215202), Q14(-0.0453357), Q14(-0.00108386), Q14(0.0189468),
+      Q14(-0.0243402), Q14(0.023258), Q14(-0.0190356), Q14(0.013826),
+      Q14(-0.00897009), Q14(0.00515384), Q14(-0.0025596), Q14(0.00104219),
+      Q14(-0.000303015), Q14(2.84974e-05), Q14(2.69129e-05), Q14(-1.3292e-05)
+   },
+   {
+      Q14(6.65289e-05), Q14(-0.000236847), Q14(0.000576873), Q14(-0.00109599),
+      Q14(0.00167722), Q14(-0.00199349), Q14(0.00144534), Q14(0.000849346),
+      Q14(-0.00599721), Q14(0.0152207), Q14(-0.0297746), Q14(0.0510727),
+      Q14(-0.0815354), Q14(0.128216), Q14(-0.224074), Q14(0.962698),
+      Q14(0.224623), Q14(-0.0490576), Q14(0.00108696), Q14(0.0176218),
+      Q14(-0.023572), Q14(0.0228651), Q14(-0.0188821), Q14(0.0138083),
+      Q14(-0.00901454), Q14(0.0052138), Q14(-0.00261096), Q14(0.00107683),
+      Q14(-0.000322063), Q14(3.68284e-05), Q14(2.42964e-05), Q14(-1.29091e-05)
+   },
+   {
+      Q14(6.54654e-05), Q14(-0.000235154), Q14(0.000576979), Q14(-0.00110477),
+      Q14(0.00170816), Q14(-0.00206774), Q14(0.00159024), Q14(0.000605283),
+      Q14(-0.00563318), Q14(0.0147359), Q14(-0.0292027), Q14(0.0504982),
+      Q14(-0.0811173), Q14(0.128242), Q14(-0.225141), Q14(0.956497),
+      Q14(0.234101), Q14(-0.0527862), Q14(0.0032697), Q14(0.0162821),
+      Q14(-0.0227893), Q14(0.0224598), Q14(-0.0187191), Q14(0.0137842),
+      Q14(-0.00905502), Q14(0.0052717), Q14(-0.00266146), Q14(0.00111123),
+      Q14(-0.000341135), Q14(4.52373e-05), Q14(2.1627e-05), Q14(-1.25072e-05)
+   },
+   {
+      Q14(6.43844e-05), Q14(-0.000233362), Q14(0.000576801), Q14(-0.00111294),
+      Q14(0.00173806), Q14(-0.00214053), Q14(0.00173352), Q14(0.00036228),
+      Q14(-0.00526841), Q14(0.0142467), Q14(-0.0286199), Q14(0.0499032),
+      Q14(-0.080664), Q14(0.128209), Q14(-0.226094), Q14(0.950167),
+      Q14(0.243632), Q14(-0.05652), Q14(0.00546346), Q14(0.0149281),
+      Q14(-0.0219924), Q14(0.0220421), Q14(-0.0185465), Q14(0.0137534),
+      Q14(-0.0090915), Q14(0.00532748), Q14(-0.00271106), Q14(0.00114539),
+      Q14(-0.000360223), Q14(5.37207e-05), Q14(1.89055e-05), Q14(-1.20863e-05)
+   },
+   {
+      Q14(6.32869e-05), Q14(-0.000231476), Q14(0.000576345), Q14(-0.00112051),
+      Q14(0.00176692), Q14(-0.00221182), Q14(0.00187513), Q14(0.000120446),
+      Q14(-0.00490305), Q14(0.0137532), Q14(-0.0280268), Q14(0.0492881),
+      Q14(-0.0801759), Q14(0.128117), Q14(-0.226933), Q14(0.943707),
+      Q14(0.253216), Q14(-0.0602572), Q14(0.00766728), Q14(0.0135606),
+      Q14(-0.0211814), Q14(0.0216121), Q14(-0.0183644), Q14(0.0137161),
+      Q14(-0.00912393), Q14(0.00538111), Q14(-0.00275972), Q14(0.00117927),
+      Q14(-0.000379317), Q14(6.2275e-05), Q14(1.61325e-05), Q14(-1.16462e-05)
+   },
+   {
+      Q14(6.21738e-05), Q14(-0.000229497), Q14(0.000575612), Q14(-0.00112748),
+      Q14(0.00179472), Q14(-0.0022816), Q14(0.00201501), Q14(-0.000120114),
+      Q14(-0.00453728), Q14(0.0132557), Q14(-0.0274234), Q14(0.0486531),
+      Q14(-0.0796535), Q14(0.127966), Q14(-0.227659), Q14(0.937121),
+      Q14(0.26285), Q14(-0.0639964), Q14(0.00988023), Q14(0.01218),
+      Q14(-0.0203569), Q14(0.0211702), Q14(-0.018173), Q14(0.0136722),
+      Q14(-0.00915228), Q14(0.00543255), Q14(-0.00280743), Q14(0.00121286),
+      Q14(-0.000398407), Q14(7.08966e-05), Q14(1.33089e-05), Q14(-1.11869e-05)
+   },
+   {
+      Q14(6.1046e-05), Q14(-0.000227427), Q14(0.000574606), Q14(-0.00113385),
+      Q14(0.00182147), Q14(-0.00234985), Q14(0.00215311), Q14(-0.000359293),
+      Q14(-0.00417128), Q14(0.0127545), Q14(-0.0268103), Q14(0.0479988),
+      Q14(-0.0790972), Q14(0.127758), Q14(-0.228273), Q14(0.930409),
+      Q14(0.272531), Q14(-0.0677359), Q14(0.0121014), Q14(0.0107869),
+      Q14(-0.019519), Q14(0.0207162), Q14(-0.0179721), Q14(0.0136217),
+      Q14(-0.00917651), Q14(0.00548176), Q14(-0.00285414), Q14(0.00124615),
+      Q14(-0.000417485), Q14(7.95819e-05), Q14(1.04356e-05), Q14(-1.07082e-05)
+   },
+   {
+      Q14(5.99045e-05), Q14(-0.000225269), Q14(0.000573331), Q14(-0.00113962),
+      Q14(0.00184715), Q14(-0.00241653), Q14(0.00228937), Q14(-0.000596988),
+      Q14(-0.00380521), Q14(0.0122498), Q14(-0.0261876), Q14(0.0473255),
+      Q14(-0.0785074), Q14(0.127493), Q14(-0.228777), Q14(0.923574),
+      Q14(0.282258), Q14(-0.071474), Q14(0.0143297), Q14(0.00938187),
+      Q14(-0.0186681), Q14(0.0202506), Q14(-0.0177618), Q14(0.0135646),
+      Q14(-0.00919659), Q14(0.00552871), Q14(-0.00289984), Q14(0.00127911),
+      Q14(-0.00043654), Q14(8.83272e-05), Q14(7.51338e-06), Q14(-1.02101e-05)
+   },
+   {
+      Q14(5.87501e-05), Q14(-0.000223024), Q14(0.000571789), Q14(-0.0011448),
+      Q14(0.00187177), Q14(-0.00248163), Q14(0.00242373), Q14(-0.000833095),
+      Q14(-0.00343925), Q14(0.0117419), Q14(-0.0255558), Q14(0.0466336),
+      Q14(-0.0778845), Q14(0.127171), Q14(-0.22917), Q14(0.916617),
+      Q14(0.292028), Q14(-0.0752091), Q14(0.0165643), Q14(0.00796551),
+      Q14(-0.0178046), Q14(0.0197733), Q14(-0.0175423), Q14(0.0135008),
+      Q14(-0.00921248), Q14(0.00557335), Q14(-0.00294449), Q14(0.00131172),
+      Q14(-0.000455562), Q14(9.71285e-05), Q14(4.54317e-06), Q14(-9.69253e-06)
+   },
+   {
+      Q14(5.75839e-05), Q14(-0.000220696), Q14(0.000569984), Q14(-0.00114938),
+      Q14(0.00189531), Q14(-0.00254513), Q14(0.00255616), Q14(-0.00106751),
+      Q14(-0.00307357), Q14(0.0112311), Q14(-0.0249152), Q14(0.0459235),
+      Q14(-0.077229), Q14(0.126792), Q14(-0.229454), Q14(0.909541),
+      Q14(0.301839), Q14(-0.0789395), Q14(0.0188041), Q14(0.00653843),
+      Q14(-0.0169287), Q14(0.0192846), Q14(-0.0173135), Q14(0.0134305),
+      Q14(-0.00922415), Q14(0.00561566), Q14(-0.00298806), Q14(0.00134397),
+      Q14(-0.000474543), Q14(0.000105982), Q14(1.52594e-06), Q14(-9.15544e-06)
+   },
+   {
+      Q14(5.64066e-05), Q14(-0.000218285), Q14(0.00056792), Q14(-0.00115337),
+      Q14(0.00191778), Q14(-0.00260701), Q14(0.00268659), Q14(-0.00130014),
+      Q14(-0.00270834), Q14(0.0107175), Q14(-0.0242661), Q14(0.0451956),
+      Q14(-0.0765414), Q14(0.126357), Q14(-0.229631), Q14(0.902347),
+      Q14(0.311688), Q14(-0.0826636), Q14(0.0210482), Q14(0.0051012),
+      Q14(-0.0160409), Q14(0.0187846), Q14(-0.0170756), Q14(0.0133534),
+      Q14(-0.00923157), Q14(0.0056556), Q14(-0.00303052), Q14(0.00137584),
+      Q14(-0.000493473), Q14(0.000114884), Q14(-1.53732e-06), Q14(-8.59881e-06)
+   },
+   {
+      Q14(5.52193e-05), Q14(-0.000215796), Q14(0.000565601), Q14(-0.00115678),
+      Q14(0.00193917), Q14(-0.00266725), Q14(0.00281499), Q14(-0.00153088),
+      Q14(-0.00234372), Q14(0.0102014), Q14(-0.0236088), Q14(0.0444504),
+      Q14(-0.0758222), Q14(0.125868), Q14(-0.2297), Q14(0.895037),
+      Q14(0.321574), Q14(-0.0863796), Q14(0.0232956), Q14(0.00365446),
+      Q14(-0.0151414), Q14(0.0182735), Q14(-0.0168285), Q14(0.0132698),
+      Q14(-0.00923471), Q14(0.00569312), Q14(-0.00307185), Q14(0.00140731),
+      Q14(-0.000512341), Q14(0.00012383), Q14(-4.64558e-06), Q14(-8.0226e-06)
+   },
+   {
+      Q14(5.40228e-05), Q14(-0.000213229), Q14(0.000563029), Q14(-0.0011596),
+      Q14(0.00195948), Q14(-0.00272584), Q14(0.00294129), Q14(-0.00175964),
+      Q14(-0.00197987), Q14(0.00968312), Q14(-0.0229438), Q14(0.0436883),
+      Q14(-0.0750718), Q14(0.125323), Q14(-0.229663), Q14(0.887614),
+      Q14(0.331493), Q14(-0.0900859), Q14(0.0255453), Q14(0.00219881),
+      Q14(-0.0142307), Q14(0.0177515), Q14(-0.0165724), Q14(0.0131795),
+      Q14(-0.00923355), Q14(0.00572821), Q14(-0.00311202), Q14(0.00143835),
+      Q14(-0.000531137), Q14(0.000132816), Q14(-7.79775e-06), Q14(-7.42682e-06)
+   },
+   {
+      Q14(5.2818e-05), Q14(-0.000210588), Q14(0.00056021), Q14(-0.00116185),
+      Q14(0.00197871), Q14(-0.00278275), Q14(0.00306545), Q14(-0.00198631),
+      Q14(-0.00161698), Q14(0.00916287), Q14(-0.0222712), Q14(0.0429097),
+      Q14(-0.0742907), Q14(0.124725), Q14(-0.229522), Q14(0.880079),
+      Q14(0.341445), Q14(-0.0937808), Q14(0.0277962), Q14(0.000734874),
+      Q14(-0.013309), Q14(0.0172188), Q14(-0.0163073), Q14(0.0130826),
+      Q14(-0.00922807), Q14(0.00576083), Q14(-0.003151), Q14(0.00146896),
+      Q14(-0.000549852), Q14(0.000141839), Q14(-1.09927e-05), Q14(-6.81148e-06)
+   },
+   {
+      Q14(5.16058e-05), Q14(-0.000207874), Q14(0.000557146), Q14(-0.00116352),
+      Q14(0.00199686), Q14(-0.00283797), Q14(0.00318743), Q14(-0.00221081),
+      Q14(-0.00125519), Q14(0.00864089), Q14(-0.0215916), Q14(0.042115),
+      Q14(-0.0734795), Q14(0.124072), Q14(-0.229276), Q14(0.872434),
+      Q14(0.351425), Q14(-0.0974626), Q14(0.0300474), Q14(-0.000736707),
+      Q14(-0.0123769), Q14(0.0166756), Q14(-0.0160333), Q14(0.0129791),
+      Q14(-0.00921823), Q14(0.00579095), Q14(-0.00318877), Q14(0.00149912),
+      Q14(-0.000568476), Q14(0.000150893), Q14(-1.42294e-05), Q14(-6.17659e-06)
+   },
+   {
+      Q14(5.0387e-05), Q14(-0.000205091), Q14(0.000553843), Q14(-0.00116462),
+      Q14(0.00201393), Q14(-0.00289149), Q14(0.00330719), Q14(-0.00243304),
+      Q14(-0.000894672), Q14(0.00811745), Q14(-0.0209052), Q14(0.0413046),
+      Q14(-0.0726387), Q14(0.123367), Q14(-0.228928), Q14(0.864682),
+      Q14(0.361433), Q14(-0.10113), Q14(0.0322978), Q14(-0.0022153),
+      Q14(-0.0114346), Q14(0.0161221), Q14(-0.0157505), Q14(0.012869),
+      Q14(-0.00920403), Q14(0.00581853), Q14(-0.00322529), Q14(0.0015288),
+      Q14(-0.000586999), Q14(0.000159974), Q14(-1.75065e-05), Q14(-5.5222e-06)
+   },
+   {
+      Q14(4.91625e-05), Q14(-0.000202239), Q14(0.000550303), Q14(-0.00116515),
+      Q14(0.00202992), Q14(-0.00294329), Q14(0.00342467), Q14(-0.00265291),
+      Q14(-0.000535588), Q14(0.00759279), Q14(-0.0202124), Q14(0.0404791),
+      Q14(-0.0717688), Q14(0.12261), Q14(-0.228478), Q14(0.856824),
+      Q14(0.371464), Q14(-0.10478), Q14(0.0345465), Q14(-0.00370026),
+      Q14(-0.0104826), Q14(0.0155585), Q14(-0.015459), Q14(0.0127524),
+      Q14(-0.00918544), Q14(0.00584355), Q14(-0.00326054), Q14(0.00155799),
+      Q14(-0.00060541), Q14(0.000169079), Q14(-2.08228e-05), Q14(-4.84835e-06)
+   },
+   {
+      Q14(4.79332e-05), Q14(-0.000199322), Q14(0.000546532), Q14(-0.00116512),
+      Q14(0.00204482), Q14(-0.00299337), Q14(0.00353984), Q14(-0.00287033),
+      Q14(-0.000178098), Q14(0.00706716), Q14(-0.0195134), Q14(0.0396389),
+      Q14(-0.0708703), Q14(0.121801), Q14(-0.227928), Q14(0.848863),
+      Q14(0.381518), Q14(-0.108412), Q14(0.0367923), Q14(-0.00519093),
+      Q14(-0.00952115), Q14(0.014985), Q14(-0.0151589), Q14(0.0126291),
+      Q14(-0.00916245), Q14(0.00586598), Q14(-0.0032945), Q14(0.00158667),
+      Q14(-0.000623699), Q14(0.000178203), Q14(-2.4177e-05), Q14(-4.1551e-06)
+   },
+   {
+      Q14(4.66998e-05), Q14(-0.000196343), Q14(0.000542534), Q14(-0.00116453),
+      Q14(0.00205864), Q14(-0.00304169), Q14(0.00365267), Q14(-0.00308521),
+      Q14(0.000177641), Q14(0.0065408), Q14(-0.0188088), Q14(0.0387844),
+      Q14(-0.0699439), Q14(0.120942), Q14(-0.227279), Q14(0.840801),
+      Q14(0.391592), Q14(-0.112024), Q14(0.0390342), Q14(-0.00668667),
+      Q14(-0.00855079), Q14(0.0144018), Q14(-0.0148503), Q14(0.0124993),
+      Q14(-0.00913503), Q14(0.0058858), Q14(-0.00332714), Q14(0.00161482),
+      Q14(-0.000641857), Q14(0.000187341), Q14(-2.7568e-05), Q14(-3.44255e-06)
+   },
+   {
+      Q14(4.54633e-05), Q14(-0.000193303), Q14(0.000538312), Q14(-0.00116339),
+      Q14(0.00207139), Q14(-0.00308827), Q14(0.0037631), Q14(-0.00329746),
+      Q14(0.000531472), Q14(0.00601398), Q14(-0.0180988), Q14(0.0379161),
+      Q14(-0.0689901), Q14(0.120032), Q14(-0.226532), Q14(0.83264),
+      Q14(0.401682), Q14(-0.115614), Q14(0.0412712), Q14(-0.0081868),
+      Q14(-0.00757188), Q14(0.0138092), Q14(-0.0145332), Q14(0.0123631),
+      Q14(-0.00910319), Q14(0.00590297), Q14(-0.00335844), Q14(0.00164242),
+      Q14(-0.000659873), Q14(0.000196488), Q14(-3.09942e-05), Q14(-2.71078e-06)
+   },
+   {
+      Q14(4.42244e-05), Q14(-0.000190204), Q14(0.000533872), Q14(-0.0011617),
+      Q14(0.00208305), Q14(-0.00313308), Q14(0.0038711), Q14(-0.00350701),
+      Q14(0.000883241), Q14(0.00548692), Q14(-0.0173838), Q14(0.0370345),
+      Q14(-0.0680094), Q14(0.119073), Q14(-0.225689), Q14(0.824382),
+      Q14(0.411788), Q14(-0.119181), Q14(0.0435023), Q14(-0.00969066),
+      Q14(-0.00658483), Q14(0.0132073), Q14(-0.0142078), Q14(0.0122203),
+      Q14(-0.00906691), Q14(0.00591748), Q14(-0.00338836), Q14(0.00166946),
+      Q14(-0.000677736), Q14(0.000205641), Q14(-3.44543e-05), Q14(-1.95991e-06)
+   },
+   {
+      Q14(4.2984e-05), Q14(-0.00018705), Q14(0.000529218), Q14(-0.00115947),
+      Q14(0.00209364), Q14(-0.00317612), Q14(0.00397664), Q14(-0.00371376),
+      Q14(0.00123279), Q14(0.00495988), Q14(-0.0166641), Q14(0.03614),
+      Q14(-0.0670025), Q14(0.118065), Q14(-0.22475), Q14(0.816029),
+      Q14(0.421905), Q14(-0.122722), Q14(0.0457264), Q14(-0.0111976),
+      Q14(-0.00559006), Q14(0.0125965), Q14(-0.0138742), Q14(0.0120711),
+      Q14(-0.00902618), Q14(0.0059293), Q14(-0.00341689), Q14(0.00169592),
+      Q14(-0.000695437), Q14(0.000214794), Q14(-3.79469e-05), Q14(-1.19005e-06)
+   },
+   {
+      Q14(4.17428e-05), Q14(-0.000183843), Q14(0.000524354), Q14(-0.00115671),
+      Q14(0.00210317), Q14(-0.00321737), Q14(0.00407969), Q14(-0.00391764),
+      Q14(0.00157998), Q14(0.00443311), Q14(-0.0159402), Q14(0.0352331),
+      Q14(-0.06597), Q14(0.117009), Q14(-0.223717), Q14(0.807585),
+      Q14(0.432033), Q14(-0.126236), Q14(0.0479425), Q14(-0.0127069),
+      Q14(-0.00458799), Q14(0.0119769), Q14(-0.0135325), Q14(0.0119155),
+      Q14(-0.00898099), Q14(0.0059384), Q14(-0.00344401), Q14(0.00172178),
+      Q14(-0.000712966), Q14(0.000223944), Q14(-4.14706e-05), Q14(-4.01362e-07)
+   },
+   {
+      Q14(4.05016e-05), Q14(-0.000180585), Q14(0.000519285), Q14(-0.00115341),
+      Q14(0.00211162), Q14(-0.00325684), Q14(0.0041802), Q14(-0.00411857),
+      Q14(0.00192465), Q14(0.00390683), Q14(-0.0152122), Q14(0.0343142),
+      Q14(-0.0649123), Q14(0.115905), Q14(-0.222591), Q14(0.79905),
+      Q14(0.442167), Q14(-0.129722), Q14(0.0501494), Q14(-0.0142179),
+      Q14(-0.00357906), Q14(0.0113489), Q14(-0.0131828), Q14(0.0117535),
+      Q14(-0.00893135), Q14(0.00594477), Q14(-0.00346969), Q14(0.00174702),
+      Q14(-0.000730311), Q14(0.000233084), Q14(-4.50237e-05), Q14(4.06012e-07)
+   },
+   {
+      Q14(3.92612e-05), Q14(-0.000177278), Q14(0.000514016), Q14(-0.0011496),
+      Q14(0.00211901), Q14(-0.00329451), Q14(0.00427814), Q14(-0.00431646),
+      Q14(0.00226665), Q14(0.00338131), Q14(-0.0144807), Q14(0.033384),
+      Q14(-0.0638303), Q14(0.114756), Q14(-0.221375), Q14(0.790427),
+      Q14(0.452307), Q14(-0.133177), Q14(0.0523462), Q14(-0.0157299),
+      Q14(-0.00256369), Q14(0.0107126), Q14(-0.0128253), Q14(0.0115852),
+      Q14(-0.00887725), Q14(0.00594839), Q14(-0.0034939), Q14(0.00177163),
+      Q14(-0.000747464), Q14(0.000242211), Q14(-4.86049e-05), Q14(1.2319e-06)
+   },
+   {
+      Q14(3.80223e-05), Q14(-0.000173924), Q14(0.000508552), Q14(-0.00114526),
+      Q14(0.00212534), Q14(-0.00333037), Q14(0.0043735), Q14(-0.00451125),
+      Q14(0.00260585), Q14(0.00285677), Q14(-0.0137459), Q14(0.0324427),
+      Q14(-0.0627244), Q14(0.113561), Q14(-0.220068), Q14(0.781719),
+      Q14(0.462448), Q14(-0.1366), Q14(0.0545318), Q14(-0.0172422),
+      Q14(-0.00154232), Q14(0.0100683), Q14(-0.01246), Q14(0.0114106),
+      Q14(-0.00881868), Q14(0.00594923), Q14(-0.00351663), Q14(0.00179559),
+      Q14(-0.000764413), Q14(0.00025132), Q14(-5.22125e-05), Q14(2.0761e-06)
+   },
+   {
+      Q14(3.67857e-05), Q14(-0.000170527), Q14(0.000502896), Q14(-0.00114042),
+      Q14(0.00213062), Q14(-0.00336444), Q14(0.00446623), Q14(-0.00470286),
+      Q14(0.00294209), Q14(0.00233346), Q14(-0.0130083), Q14(0.031491),
+      Q14(-0.0615953), Q14(0.112321), Q14(-0.218672), Q14(0.772928),
+      Q14(0.47259), Q14(-0.139988), Q14(0.0567052), Q14(-0.0187542),
+      Q14(-0.000515401), Q14(0.00941627), Q14(-0.0120872), Q14(0.0112298),
+      Q14(-0.00875566), Q14(0.00594728), Q14(-0.00353786), Q14(0.00181889),
+      Q14(-0.000781149), Q14(0.000260406), Q14(-5.58449e-05), Q14(2.93843e-06)
+   },
+   {
+      Q14(3.5552e-05), Q14(-0.000167089), Q14(0.000497054), Q14(-0.00113507),
+      Q14(0.00213484), Q14(-0.00339669), Q14(0.00455631), Q14(-0.00489122),
+      Q14(0.00327524), Q14(0.0018116), Q14(-0.0122681), Q14(0.0305293),
+      Q14(-0.0604437), Q14(0.111037), Q14(-0.21719), Q14(0.764057),
+      Q14(0.482728), Q14(-0.143341), Q14(0.0588652), Q14(-0.0202651),
+      Q14(0.000516621), Q14(0.00875681), Q14(-0.0117069), Q14(0.0110427),
+      Q14(-0.00868818), Q14(0.00594252), Q14(-0.00355756), Q14(0.0018415),
+      Q14(-0.000797661), Q14(0.000269463), Q14(-5.95005e-05), Q14(3.81865e-06)
+   },
+   {
+      Q14(3.43222e-05), Q14(-0.000163611), Q14(0.000491032), Q14(-0.00112923),
+      Q14(0.00213803), Q14(-0.00342712), Q14(0.00464371), Q14(-0.00507625),
+      Q14(0.00360516), Q14(0.00129145), Q14(-0.0115257), Q14(0.029558),
+      Q14(-0.0592701), Q14(0.10971), Q14(-0.215622), Q14(0.755107),
+      Q14(0.492861), Q14(-0.146656), Q14(0.0610108), Q14(-0.0217743),
+      Q14(0.00155329), Q14(0.00809016), Q14(-0.0113193), Q14(0.0108496),
+      Q14(-0.00861625), Q14(0.00593495), Q14(-0.00357572), Q14(0.00186341),
+      Q14(-0.000813938), Q14(0.000278487), Q14(-6.31776e-05), Q14(4.71653e-06)
+   },
+   {
+      Q14(3.30967e-05), Q14(-0.000160097), Q14(0.000484833), Q14(-0.0011229),
+      Q14(0.00214018), Q14(-0.00345575), Q14(0.00472841), Q14(-0.00525789),
+      Q14(0.0039317), Q14(0.000773219), Q14(-0.0107815), Q14(0.0285778),
+      Q14(-0.0580752), Q14(0.108341), Q14(-0.21397), Q14(0.746081),
+      Q14(0.502986), Q14(-0.149932), Q14(0.0631409), Q14(-0.0232809),
+      Q14(0.00259416), Q14(0.0074166), Q14(-0.0109245), Q14(0.0106504),
+      Q14(-0.00853989), Q14(0.00592453), Q14(-0.00359231), Q14(0.0018846),
+      Q14(-0.000829972), Q14(0.000287474), Q14(-6.68744e-05), Q14(5.63182e-06)
+   },
+   {
+      Q14(3.18763e-05), Q14(-0.000156548), Q14(0.000478462), Q14(-0.00111609),
+      Q14(0.0021413), Q14(-0.00348255), Q14(0.00481039), Q14(-0.00543608),
+      Q14(0.00425474), Q14(0.000257152), Q14(-0.0100358), Q14(0.027589),
+      Q14(-0.0568598), Q14(0.106931), Q14(-0.212235), Q14(0.736981),
+      Q14(0.513101), Q14(-0.153166), Q14(0.0652546), Q14(-0.0247844),
+      Q14(0.00363876), Q14(0.00673641), Q14(-0.0105227), Q14(0.0104452),
+      Q14(-0.0084591), Q14(0.00591127), Q14(-0.00360732), Q14(0.00190507),
+      Q14(-0.000845751), Q14(0.000296417), Q14(-7.05893e-05), Q14(6.56425e-06)
+   },
+   {
+      Q14(3.06617e-05), Q14(-0.000152967), Q14(0.000471926), Q14(-0.0011088),
+      Q14(0.0021414), Q14(-0.00350754), Q14(0.00488961), Q14(-0.00561075),
+      Q14(0.00457414), Q14(-0.000256526), Q14(-0.00928901), Q14(0.0265922),
+      Q14(-0.0556243), Q14(0.10548), Q14(-0.210419), Q14(0.72781),
+      Q14(0.523203), Q14(-0.156358), Q14(0.0673507), Q14(-0.0262841),
+      Q14(0.00468662), Q14(0.00604988), Q14(-0.0101141), Q14(0.010234),
+      Q14(-0.00837389), Q14(0.00589514), Q14(-0.00362073), Q14(0.00192478),
+      Q14(-0.000861266), Q14(0.000305312), Q14(-7.43205e-05), Q14(7.51354e-06)
+   },
+   {
+      Q14(2.94535e-05), Q14(-0.000149356), Q14(0.000465228), Q14(-0.00110105),
+      Q14(0.00214048), Q14(-0.00353071), Q14(0.00496607), Q14(-0.00578183),
+      Q14(0.00488977), Q14(-0.000767589), Q14(-0.00854144), Q14(0.0255879),
+      Q14(-0.0543696), Q14(0.10399), Q14(-0.208523), Q14(0.718571),
+      Q14(0.533289), Q14(-0.159505), Q14(0.0694282), Q14(-0.0277791),
+      Q14(0.00573729), Q14(0.00535729), Q14(-0.0096987), Q14(0.010017),
+      Q14(-0.00828429), Q14(0.00587615), Q14(-0.00363252), Q14(0.00194373),
+      Q14(-0.000876507), Q14(0.000314155), Q14(-7.80661e-05), Q14(8.47938e-06)
+   },
+   {
+      Q14(2.82524e-05), Q14(-0.000145718), Q14(0.000458374), Q14(-0.00109284),
+      Q14(0.00213856), Q14(-0.00355206), Q14(0.00503975), Q14(-0.00594927),
+      Q14(0.00520151), Q14(-0.00127581), Q14(-0.00779343), Q14(0.0245766),
+      Q14(-0.0530963), Q14(0.102461), Q14(-0.206549), Q14(0.709265),
+      Q14(0.543358), Q14(-0.162605), Q14(0.0714861), Q14(-0.0292688),
+      Q14(0.00679028), Q14(0.00465893), Q14(-0.00927679), Q14(0.00979415),
+      Q14(-0.0081903), Q14(0.00585427), Q14(-0.00364267), Q14(0.00196191),
+      Q14(-0.000891463), Q14(0.000322939), Q14(-8.18243e-05), Q14(9.46146e-06)
+   },
+   {
+      Q14(2.7059e-05), Q14(-0.000142055), Q14(0.000451369), Q14(-0.00108418),
+      Q14(0.00213564), Q14(-0.0035716), Q14(0.00511062), Q14(-0.00611301),
+      Q14(0.00550923), Q14(-0.00178097), Q14(-0.00704535), Q14(0.0235587),
+      Q14(-0.051805), Q14(0.100894), Q14(-0.204499), Q14(0.699896),
+      Q14(0.553405), Q14(-0.165658), Q14(0.0735232), Q14(-0.0307526),
+      Q14(0.00784512), Q14(0.00395511), Q14(-0.00884849), Q14(0.00956559),
+      Q14(-0.00809195), Q14(0.00582951), Q14(-0.00365117), Q14(0.00197929),
+      Q14(-0.000906125), Q14(0.00033166), Q14(-8.55933e-05), Q14(1.04594e-05)
+   },
+   {
+      Q14(2.58739e-05), Q14(-0.000138368), Q14(0.000444217), Q14(-0.00107507),
+      Q14(0.00213174), Q14(-0.00358933), Q14(0.00517867), Q14(-0.00627299),
+      Q14(0.00581281), Q14(-0.00228285), Q14(-0.00629753), Q14(0.0225347),
+      Q14(-0.0504964), Q14(0.0992902), Q14(-0.202373), Q14(0.690465),
+      Q14(0.563429), Q14(-0.168661), Q14(0.0755386), Q14(-0.0322296),
+      Q14(0.00890133), Q14(0.00324612), Q14(-0.00841398), Q14(0.00933137),
+      Q14(-0.00798926), Q14(0.00580185), Q14(-0.003658), Q14(0.00199586),
+      Q14(-0.000920482), Q14(0.000340312), Q14(-8.93711e-05), Q14(1.1473e-05)
+   },
+   {
+      Q14(2.46977e-05), Q14(-0.000134662), Q14(0.000436925), Q14(-0.00106553),
+      Q14(0.00212685), Q14(-0.00360526), Q14(0.00524388), Q14(-0.00642917),
+      Q14(0.00611212), Q14(-0.00278124), Q14(-0.00555033), Q14(0.0215053),
+      Q14(-0.0491712), Q14(0.0976507), Q14(-0.200175), Q14(0.680975),
+      Q14(0.573428), Q14(-0.171611), Q14(0.0775312), Q14(-0.0336992),
+      Q14(0.00995843), Q14(0.00253227), Q14(-0.00797342), Q14(0.00909158),
+      Q14(-0.00788225), Q14(0.00577129), Q14(-0.00366315), Q14(0.00201162),
+      Q14(-0.000934525), Q14(0.000348891), Q14(-9.31558e-05), Q14(1.25017e-05)
+   },
+   {
+      Q14(2.3531e-05), Q14(-0.000130937), Q14(0.000429497), Q14(-0.00105557),
+      Q14(0.002121), Q14(-0.00361938), Q14(0.00530624), Q14(-0.00658148),
+      Q14(0.00640705), Q14(-0.00327591), Q14(-0.00480408), Q14(0.0204708),
+      Q14(-0.0478302), Q14(0.0959764), Q14(-0.197904), Q14(0.671429),
+      Q14(0.583398), Q14(-0.174509), Q14(0.0794999), Q14(-0.0351607),
+      Q14(0.0110159), Q14(0.00181387), Q14(-0.007527), Q14(0.00884631),
+      Q14(-0.00777094), Q14(0.00573784), Q14(-0.0036666), Q14(0.00202653),
+      Q14(-0.000948245), Q14(0.000357392), Q14(-9.69454e-05), Q14(1.35452e-05)
+   },
+   {
+      Q14(2.23744e-05), Q14(-0.000127195), Q14(0.000421939), Q14(-0.00104519),
+      Q14(0.00211418), Q14(-0.00363171), Q14(0.00536575), Q14(-0.00672987),
+      Q14(0.00669749), Q14(-0.00376665), Q14(-0.00405913), Q14(0.0194318),
+      Q14(-0.0464739), Q14(0.0942682), Q14(-0.195563), Q14(0.66183),
+      Q14(0.593337), Q14(-0.177351), Q14(0.0814437), Q14(-0.0366133),
+      Q14(0.0120734), Q14(0.00109123), Q14(-0.00707489), Q14(0.00859563),
+      Q14(-0.00765538), Q14(0.00570148), Q14(-0.00366835), Q14(0.0020406),
+      Q14(-0.00096163), Q14(0.000365808), Q14(-0.000100738), Q14(1.46031e-05)
+   },
+   {
+      Q14(2.12283e-05), Q14(-0.00012344), Q14(0.000414255), Q14(-0.00103441),
+      Q14(0.00210642), Q14(-0.00364225), Q14(0.00542238), Q14(-0.00687431),
+      Q14(0.00698332), Q14(-0.00425327), Q14(-0.0033158), Q14(0.0183887),
+      Q14(-0.0451031), Q14(0.092527), Q14(-0.193154), Q14(0.652179),
+      Q14(0.603242), Q14(-0.180137), Q14(0.0833617), Q14(-0.0380563),
+      Q14(0.0131302), Q14(0.000364657), Q14(-0.00661728), Q14(0.00833964),
+      Q14(-0.00753558), Q14(0.00566221), Q14(-0.00366837), Q14(0.0020538),
+      Q14(-0.000974673), Q14(0.000374135), Q14(-0.000104531), Q14(1.5675e-05)
+   },
+   {
+      Q14(2.00934e-05), Q14(-0.000119673), Q14(0.000406451), Q14(-0.00102322),
+      Q14(0.00209773), Q14(-0.003651), Q14(0.00547613), Q14(-0.00701474),
+      Q14(0.00726443), Q14(-0.00473555), Q14(-0.00257445), Q14(0.0173421),
+      Q14(-0.0437186), Q14(0.0907539), Q14(-0.190678), Q14(0.642479),
+      Q14(0.613112), Q14(-0.182864), Q14(0.0852527), Q14(-0.039489),
+      Q14(0.014186), Q14(-0.000365518), Q14(-0.00615435), Q14(0.00807843),
+      Q14(-0.00741158), Q14(0.00562004), Q14(-0.00366666), Q14(0.00206613),
+      Q14(-0.000987363), Q14(0.000382369), Q14(-0.000108324), Q14(1.67604e-05)
+   },
+   {
+      Q14(1.89701e-05), Q14(-0.000115897), Q14(0.000398531), Q14(-0.00101165),
+      Q14(0.0020881), Q14(-0.00365798), Q14(0.005527), Q14(-0.00715113),
+      Q14(0.00754072), Q14(-0.00521329), Q14(-0.0018354), Q14(0.0162924),
+      Q14(-0.0423209), Q14(0.0889498), Q14(-0.188136), Q14(0.632733),
+      Q14(0.622943), Q14(-0.185531), Q14(0.0871157), Q14(-0.0409108),
+      Q14(0.0152403), Q14(-0.00109898), Q14(-0.00568628), Q14(0.00781209),
+      Q14(-0.00728342), Q14(0.00557497), Q14(-0.0036632), Q14(0.00207757),
+      Q14(-0.00099969), Q14(0.000390502), Q14(-0.000112113), Q14(1.78589e-05)
+   }
+};
+
+/* 48 -> 44.1 kHz: 147 phases of 36 taps. */
+static const opus_val16 resample_44k1_down_coef[74][36] = {
+   {
+      Q14(-8.00228e-07), Q14(2.30131e-06), Q14(-5.25696e-06), Q14(1.04934e-05),
+      Q14(-1.90969e-05), Q14(3.24442e-05), Q14(-5.22407e-05), Q14(8.0582e-05),
+      Q14(-0.000120075), Q14(0.000174091), Q14(-0.0002473), Q14(0.000346814),
+      Q14(-0.000484826), Q14(0.000685294), Q14(-0.00100409), Q14(0.00160958),
+      Q14(-0.00334483), Q14(0.999988), Q14(0.00336827), Q14(-0.00161565),
+      Q14(0.00100692), Q14(-0.000686968), Q14(0.000485941), Q14(-0.000347604),
+      Q14(0.000247878), Q14(-0.000174518), Q14(0.000120389), Q14(-8.08096e-05),
+      Q14(5.2402e-05), Q14(-3.25549e-05), Q14(1.91699e-05), Q14(-1.05392e-05),
+      Q14(5.2838e-06), Q14(-2.3157e-06), Q14(8.06986e-07), Q14(-1.57271e-07)
+   },
+   {
+      Q14(-2.38016e-06), Q14(6.8599e-06), Q14(-1.56883e-05), Q14(3.13387e-05),
+      Q14(-5.70634e-05), Q14(9.69864e-05), Q14(-0.000156216), Q14(0.000241028),
+      Q14(-0.00035923), Q14(0.000520917), Q14(-0.000740056), Q14(0.00103792),
+      Q14(-0.00145092), Q14(0.00205056), Q14(-0.00300336), Q14(0.0048099),
+      Q14(-0.00996358), Q14(0.999834), Q14(0.0101745), Q14(-0.00486453),
+      Q14(0.00302884), Q14(-0.00206563), Q14(0.00146095), Q14(-0.00104503),
+      Q14(0.000745257), Q14(-0.000524758), Q14(0.000362056), Q14(-0.000243076),
+      Q14(0.000157667), Q14(-9.79829e-05), Q14(5.77206e-05), Q14(-3.17505e-05),
+      Q14(1.59298e-05), Q14(-6.98941e-06), Q14(2.44098e-06), Q14(-4.79333e-07)
+   },
+   {
+      Q14(-3.93234e-06), Q14(1.13584e-05), Q14(-2.60061e-05), Q14(5.19882e-05),
+      Q14(-9.47139e-05), Q14(0.000161044), Q14(-0.000259478), Q14(0.000400458),
+      Q14(-0.000596972), Q14(0.000865806), Q14(-0.00123017), Q14(0.0017254),
+      Q14(-0.00241192), Q14(0.00340825), Q14(-0.00499004), Q14(0.00798412),
+      Q14(-0.0164869), Q14(0.999527), Q14(0.0170727), Q14(-0.00813581),
+      Q14(0.00506079), Q14(-0.00345008), Q14(0.00243978), Q14(-0.00174516),
+      Q14(0.00124462), Q14(-0.000876473), Q14(0.000604819), Q14(-0.000406147),
+      Q14(0.000263509), Q14(-0.000163812), Q14(9.65389e-05), Q14(-5.31317e-05),
+      Q14(2.66768e-05), Q14(-1.17181e-05), Q14(4.10123e-06), Q14(-8.11396e-07)
+   },
+   {
+      Q14(-5.45631e-06), Q14(1.57953e-05), Q14(-3.62064e-05), Q14(7.24334e-05),
+      Q14(-0.000132033), Q14(0.000224591), Q14(-0.000361983), Q14(0.000558803),
+      Q14(-0.000833197), Q14(0.00120861), Q14(-0.00171744), Q14(0.00240897),
+      Q14(-0.00336741), Q14(0.00475778), Q14(-0.00696331), Q14(0.011131),
+      Q14(-0.0229135), Q14(0.999067), Q14(0.0240617), Q14(-0.0114282),
+      Q14(0.00710192), Q14(-0.00483972), Q14(0.00342199), Q14(-0.00244767),
+      Q14(0.00174574), Q14(-0.00122951), Q14(0.00084857), Q14(-0.000569949),
+      Q14(0.00036988), Q14(-0.000230012), Q14(0.000135608), Q14(-7.46737e-05),
+      Q14(3.75203e-05), Q14(-1.64999e-05), Q14(5.78719e-06), Q14(-1.15342e-06)
+   },
+   {
+      Q14(-6.95163e-06), Q14(2.01689e-05), Q14(-4.62852e-05), Q14(9.26662e-05),
+      Q14(-0.000169004), Q14(0.000287599), Q14(-0.000463688), Q14(0.000715996),
+      Q14(-0.0010678), Q14(0.00154917), Q14(-0.00220164), Q14(0.00308831),
+      Q14(-0.00431698), Q14(0.00609856), Q14(-0.00892236), Q14(0.0142494),
+      Q14(-0.0292425), Q14(0.998454), Q14(0.03114), Q14(-0.0147405),
+      Q14(0.00915136), Q14(-0.00623393), Q14(0.00440714), Q14(-0.00315225),
+      Q14(0.00224839), Q14(-0.0015837), Q14(0.0010932), Q14(-0.00073441),
+      Q14(0.000476734), Q14(-0.000296556), Q14(0.000174911), Q14(-9.63674e-05),
+      Q14(4.8456e-05), Q14(-2.13329e-05), Q14(7.49828e-06), Q14(-1.50536e-06)
+   },
+   {
+      Q14(-8.41791e-06), Q14(2.44778e-05), Q14(-5.62389e-05), Q14(0.000112679),
+      Q14(-0.000205614), Q14(0.000350043), Q14(-0.00056455), Q14(0.000871969),
+      Q14(-0.00130069), Q14(0.00188736), Q14(-0.00268257), Q14(0.00376315),
+      Q14(-0.0052602), Q14(0.00743004), Q14(-0.0108664), Q14(0.0173382),
+      Q14(-0.0354729), Q14(0.997687), Q14(0.0383065), Q14(-0.0180713),
+      Q14(0.0112082), Q14(-0.0076321), Q14(0.00539479), Q14(-0.00385859),
+      Q14(0.00275235), Q14(-0.00193889), Q14(0.0013386), Q14(-0.000899456),
+      Q14(0.000584023), Q14(-0.000363413), Q14(0.000214431), Q14(-0.000118204),
+      Q14(5.94793e-05), Q14(-2.62153e-05), Q14(9.23392e-06), Q14(-1.86717e-06)
+   },
+   {
+      Q14(-9.85476e-06), Q14(2.87204e-05), Q14(-6.60637e-05), Q14(0.000132463),
+      Q14(-0.000241847), Q14(0.000411897), Q14(-0.000664526), Q14(0.00102666),
+      Q14(-0.00153176), Q14(0.00222301), Q14(-0.00316001), Q14(0.00443318),
+      Q14(-0.00619669), Q14(0.00875163), Q14(-0.0127945), Q14(0.0203962),
+      Q14(-0.0416035), Q14(0.996768), Q14(0.0455597), Q14(-0.0214192),
+      Q14(0.0132716), Q14(-0.0090336), Q14(0.00638449), Q14(-0.00456637),
+      Q14(0.00325738), Q14(-0.00229492), Q14(0.00158465), Q14(-0.00106501),
+      Q14(0.0006917), Q14(-0.000430554), Q14(0.000254151), Q14(-0.000140173),
+      Q14(7.05855e-05), Q14(-3.11452e-05), Q14(1.09935e-05), Q14(-2.23876e-06)
+   },
+   {
+      Q14(-1.12618e-05), Q14(3.28955e-05), Q14(-7.5756e-05), Q14(0.000152011),
+      Q14(-0.000277688), Q14(0.000473135), Q14(-0.000763574), Q14(0.00117999),
+      Q14(-0.00176091), Q14(0.00255599), Q14(-0.00363377), Q14(0.00509813),
+      Q14(-0.00712604), Q14(0.0100628), Q14(-0.0147061), Q14(0.0234223),
+      Q14(-0.0476334), Q14(0.995696), Q14(0.0528984), Q14(-0.0247831),
+      Q14(0.0153406), Q14(-0.0104378), Q14(0.00737581), Q14(-0.00527526),
+      Q14(0.00376327), Q14(-0.00265163), Q14(0.00183126), Q14(-0.001231),
+      Q14(0.000799714), Q14(-0.000497948), Q14(0.000294052), Q14(-0.000162265),
+      Q14(8.17698e-05), Q14(-3.61204e-05), Q14(1.27763e-05), Q14(-2.62008e-06)
+   },
+   {
+      Q14(-1.26387e-05), Q14(3.70017e-05), Q14(-8.53123e-05), Q14(0.000171316),
+      Q14(-0.000313124), Q14(0.000533734), Q14(-0.000861654), Q14(0.00133191),
+      Q14(-0.00198804), Q14(0.00288616), Q14(-0.00410364), Q14(0.0057577),
+      Q14(-0.00804785), Q14(0.011363), Q14(-0.0166003), Q14(0.0264154),
+      Q14(-0.0535617), Q14(0.994472), Q14(0.060321), Q14(-0.0281614),
+      Q14(0.0174143), Q14(-0.0118441), Q14(0.00836829), Q14(-0.00598494),
+      Q14(0.00426978), Q14(-0.00300885), Q14(0.00207829), Q14(-0.00139736),
+      Q14(0.000908018), Q14(-0.000565566), Q14(0.000334117), Q14(-0.000184471),
+      Q14(9.30275e-05), Q14(-4.1139e-05), Q14(1.45818e-05), Q14(-3.01104e-06)
+   },
+   {
+      Q14(-1.39852e-05), Q14(4.10376e-05), Q14(-9.47292e-05), Q14(0.000190371),
+      Q14(-0.00034814), Q14(0.000593667), Q14(-0.000958726), Q14(0.00148236),
+      Q14(-0.00221306), Q14(0.00321337), Q14(-0.00456942), Q14(0.00641161),
+      Q14(-0.00896175), Q14(0.0126517), Q14(-0.0184763), Q14(0.0293745),
+      Q14(-0.0593876), Q14(0.993096), Q14(0.0678262), Q14(-0.0315529),
+      Q14(0.0194918), Q14(-0.0132518), Q14(0.00936147), Q14(-0.00669509),
+      Q14(0.00477666), Q14(-0.00336642), Q14(0.00232565), Q14(-0.00156399),
+      Q14(0.00101656), Q14(-0.000633377), Q14(0.000374328), Q14(-0.00020678),
+      Q14(0.000104354), Q14(-4.61988e-05), Q14(1.64092e-05), Q14(-3.41155e-06)
+   },
+   {
+      Q14(-1.5301e-05), Q14(4.50021e-05), Q14(-0.000104004), Q14(0.000209168),
+      Q14(-0.000382724), Q14(0.000652912), Q14(-0.00105475), Q14(0.00163126),
+      Q14(-0.00243588), Q14(0.00353749), Q14(-0.00503091), Q14(0.0070596),
+      Q14(-0.00986733), Q14(0.0139283), Q14(-0.0203335), Q14(0.0322984),
+      Q14(-0.0651101), Q14(0.991568), Q14(0.0754124), Q14(-0.0349561),
+      Q14(0.0215722), Q14(-0.0146604), Q14(0.0103549), Q14(-0.00740537),
+      Q14(0.0052837), Q14(-0.00372418), Q14(0.00257321), Q14(-0.00173083),
+      Q14(0.0011253), Q14(-0.000701348), Q14(0.000414666), Q14(-0.000229184),
+      Q14(0.000115743), Q14(-5.12977e-05), Q14(1.82578e-05), Q14(-3.8215e-06)
+   },
+   {
+      Q14(-1.65857e-05), Q14(4.88939e-05), Q14(-0.000113132), Q14(0.0002277),
+      Q14(-0.00041686), Q14(0.000711445), Q14(-0.00114969), Q14(0.00177856),
+      Q14(-0.00265641), Q14(0.00385839), Q14(-0.00548793), Q14(0.00770139),
+      Q14(-0.0107642), Q14(0.0151923), Q14(-0.022171), Q14(0.0351862),
+      Q14(-0.0707284), Q14(0.98989), Q14(0.0830782), Q14(-0.0383697),
+      Q14(0.0236546), Q14(-0.0160691), Q14(0.0113481), Q14(-0.00811547),
+      Q14(0.00579066), Q14(-0.00408196), Q14(0.00282087), Q14(-0.0018978),
+      Q14(0.00123417), Q14(-0.00076945), Q14(0.000455114), Q14(-0.00025167),
+      Q14(0.000127191), Q14(-5.64335e-05), Q14(2.01269e-05), Q14(-4.24079e-06)
+   },
+   {
+      Q14(-1.78392e-05), Q14(5.27119e-05), Q14(-0.000122112), Q14(0.000245961),
+      Q14(-0.000450538), Q14(0.000769244), Q14(-0.0012435), Q14(0.0019242),
+      Q14(-0.00287455), Q14(0.00417592), Q14(-0.00594027), Q14(0.00833671),
+      Q14(-0.0116521), Q14(0.0164432), Q14(-0.0239882), Q14(0.0380368),
+      Q14(-0.0762417), Q14(0.98806), Q14(0.0908221), Q14(-0.0417921),
+      Q14(0.025738), Q14(-0.0174773), Q14(0.0123407), Q14(-0.00882505),
+      Q14(0.0062973), Q14(-0.00443958), Q14(0.00306849), Q14(-0.00206483),
+      Q14(0.00134313), Q14(-0.000837651), Q14(0.000495652), Q14(-0.00027423),
+      Q14(0.000138693), Q14(-6.1604e-05), Q14(2.20158e-05), Q14(-4.6693e-06)
+   },
+   {
+      Q14(-1.90612e-05), Q14(5.6455e-05), Q14(-0.000130939), Q14(0.000263944),
+      Q14(-0.000483744), Q14(0.000826285), Q14(-0.00133615), Q14(0.00206812),
+      Q14(-0.00309021), Q14(0.00448997), Q14(-0.00638776), Q14(0.00896529),
+      Q14(-0.0125305), Q14(0.0176806), Q14(-0.0257843), Q14(0.0408493),
+      Q14(-0.0816493), Q14(0.986081), Q14(0.0986424), Q14(-0.045222),
+      Q14(0.0278215), Q14(-0.0188844), Q14(0.0133321), Q14(-0.00953377),
+      Q14(0.00680338), Q14(-0.0047969), Q14(0.00331598), Q14(-0.00223182),
+      Q14(0.00145213), Q14(-0.000905918), Q14(0.000536262), Q14(-0.000296853),
+      Q14(0.000150242), Q14(-6.68069e-05), Q14(2.39236e-05), Q14(-5.1069e-06)
+   },
+   {
+      Q14(-2.02515e-05), Q14(6.01222e-05), Q14(-0.000139612), Q14(0.000281643),
+      Q14(-0.000516466), Q14(0.000882546), Q14(-0.0014276), Q14(0.00221026),
+      Q14(-0.0033033), Q14(0.00480039), Q14(-0.00683021), Q14(0.00958688),
+      Q14(-0.0133991), Q14(0.0189038), Q14(-0.0275586), Q14(0.0436227),
+      Q14(-0.0869505), Q14(0.983952), Q14(0.106538), Q14(-0.048658),
+      Q14(0.0299041), Q14(-0.0202896), Q14(0.014322), Q14(-0.0102413),
+      Q14(0.00730866), Q14(-0.00515372), Q14(0.00356321), Q14(-0.00239871),
+      Q14(0.00156112), Q14(-0.00097422), Q14(0.000576924), Q14(-0.000319528),
+      Q14(0.000161834), Q14(-7.20398e-05), Q14(2.58495e-05), Q14(-5.55344e-06)
+   },
+   {
+      Q14(-2.141e-05), Q14(6.37125e-05), Q14(-0.000148128), Q14(0.000299052),
+      Q14(-0.000548691), Q14(0.000938008), Q14(-0.00151782), Q14(0.00235057),
+      Q14(-0.00351375), Q14(0.00510707), Q14(-0.00726744), Q14(0.0102012),
+      Q14(-0.0142576), Q14(0.0201124), Q14(-0.0293106), Q14(0.046356),
+      Q14(-0.0921446), Q14(0.981674), Q14(0.114506), Q14(-0.0520985),
+      Q14(0.0319849), Q14(-0.0216925), Q14(0.0153098), Q14(-0.0109473),
+      Q14(0.00781291), Q14(-0.0055099), Q14(0.00381007), Q14(-0.00256542),
+      Q14(0.00167004), Q14(-0.00104252), Q14(0.00061762), Q14(-0.000342245),
+      Q14(0.000173463), Q14(-7.73003e-05), Q14(2.77928e-05), Q14(-6.00879e-06)
+   },
+   {
+      Q14(-2.25365e-05), Q14(6.7225e-05), Q14(-0.000156483), Q14(0.000316164),
+      Q14(-0.000580409), Q14(0.000992648), Q14(-0.00160677), Q14(0.00248898),
+      Q14(-0.00372146), Q14(0.00540988), Q14(-0.00769926), Q14(0.0108081),
+      Q14(-0.0151056), Q14(0.021306), Q14(-0.0310394), Q14(0.0490484),
+      Q14(-0.097231), Q14(0.979247), Q14(0.122546), Q14(-0.0555421),
+      Q14(0.0340629), Q14(-0.0230923), Q14(0.0162951), Q14(-0.0116515),
+      Q14(0.00831589), Q14(-0.00586525), Q14(0.00405643), Q14(-0.00273186),
+      Q14(0.00177885), Q14(-0.0011108), Q14(0.00065833), Q14(-0.000364993),
+      Q14(0.000185125), Q14(-8.25862e-05), Q14(2.97526e-05), Q14(-6.47279e-06)
+   },
+   {
+      Q14(-2.36308e-05), Q14(7.06589e-05), Q14(-0.000164676), Q14(0.000332975),
+      Q14(-0.000611607), Q14(0.00104645), Q14(-0.00169441), Q14(0.00262546),
+      Q14(-0.00392636), Q14(0.0057087), Q14(-0.00812551), Q14(0.0114072),
+      Q14(-0.0159428), Q14(0.022484), Q14(-0.0327444), Q14(0.051699),
+      Q14(-0.102209), Q14(0.976673), Q14(0.130656), Q14(-0.0589873),
+      Q14(0.0361372), Q14(-0.0244883), Q14(0.0172774), Q14(-0.0123535),
+      Q14(0.00881736), Q14(-0.00621962), Q14(0.00430219), Q14(-0.00289796),
+      Q14(0.00188748), Q14(-0.00117901), Q14(0.000699034), Q14(-0.000387761),
+      Q14(0.000196812), Q14(-8.78948e-05), Q14(3.1728e-05), Q14(-6.94527e-06)
+   },
+   {
+      Q14(-2.46928e-05), Q14(7.40132e-05), Q14(-0.000172704), Q14(0.000349478),
+      Q14(-0.000642276), Q14(0.00109938), Q14(-0.00178072), Q14(0.00275993),
+      Q14(-0.00412836), Q14(0.00600341), Q14(-0.00854601), Q14(0.0119983),
+      Q14(-0.0167688), Q14(0.023646), Q14(-0.034425), Q14(0.0543068),
+      Q14(-0.107078), Q14(0.973952), Q14(0.138834), Q14(-0.0624326),
+      Q14(0.0382068), Q14(-0.0258799), Q14(0.0182562), Q14(-0.013053),
+      Q14(0.00931707), Q14(-0.00657282), Q14(0.00454722), Q14(-0.00306364),
+      Q14(0.0019959), Q14(-0.00124712), Q14(0.000739713), Q14(-0.000410538),
+      Q14(0.000208521), Q14(-9.32238e-05), Q14(3.37181e-05), Q14(-7.42605e-06)
+   },
+   {
+      Q14(-2.57225e-05), Q14(7.72873e-05), Q14(-0.000180564), Q14(0.000365668),
+      Q14(-0.000672403), Q14(0.00115144), Q14(-0.00186567), Q14(0.00289236),
+      Q14(-0.00432738), Q14(0.00629388), Q14(-0.0089606), Q14(0.0125812),
+      Q14(-0.0175833), Q14(0.0247915), Q14(-0.0360807), Q14(0.0568711),
+      Q14(-0.111838), Q14(0.971085), Q14(0.147079), Q14(-0.0658765),
+      Q14(0.0402708), Q14(-0.0272664), Q14(0.0192312), Q14(-0.0137496),
+      Q14(0.00981479), Q14(-0.00692469), Q14(0.0047914), Q14(-0.00322881),
+      Q14(0.00210404), Q14(-0.00131511), Q14(0.000780348), Q14(-0.000433313),
+      Q14(0.000220244), Q14(-9.85706e-05), Q14(3.5722e-05), Q14(-7.91495e-06)
+   },
+   {
+      Q14(-2.67198e-05), Q14(8.04803e-05), Q14(-0.000188255), Q14(0.00038154),
+      Q14(-0.00070198), Q14(0.0012026), Q14(-0.00194921), Q14(0.00302269),
+      Q14(-0.00452335), Q14(0.00658002), Q14(-0.00936911), Q14(0.0131556),
+      Q14(-0.018386), Q14(0.0259201), Q14(-0.0377106), Q14(0.059391),
+      Q14(-0.116487), Q14(0.968072), Q14(0.155388), Q14(-0.0693174),
+      Q14(0.0423282), Q14(-0.0286472), Q14(0.0202017), Q14(-0.014443),
+      Q14(0.0103103), Q14(-0.00727505), Q14(0.00503461), Q14(-0.0033934),
+      Q14(0.00221185), Q14(-0.00138293), Q14(0.000820918), Q14(-0.000456075),
+      Q14(0.000231977), Q14(-0.000103933), Q14(3.77388e-05), Q14(-8.41176e-06)
+   },
+   {
+      Q14(-2.76845e-05), Q14(8.35918e-05), Q14(-0.000195773), Q14(0.000397089),
+      Q14(-0.000730996), Q14(0.00125284), Q14(-0.00203132), Q14(0.00315087),
+      Q14(-0.00471619), Q14(0.0068617), Q14(-0.00977138), Q14(0.0137214),
+      Q14(-0.0191766), Q14(0.0270313), Q14(-0.0393143), Q14(0.0618657),
+      Q14(-0.121027), Q14(0.964915), Q14(0.163761), Q14(-0.072754),
+      Q14(0.0443779), Q14(-0.0300216), Q14(0.0211674), Q14(-0.015133),
+      Q14(0.0108033), Q14(-0.00762374), Q14(0.00527674), Q14(-0.00355732),
+      Q14(0.00231929), Q14(-0.00145056), Q14(0.000861403), Q14(-0.000478813),
+      Q14(0.000243714), Q14(-0.000109307), Q14(3.97675e-05), Q14(-8.9163e-06)
+   },
+   {
+      Q14(-2.86168e-05), Q14(8.6621e-05), Q14(-0.000203119), Q14(0.00041231),
+      Q14(-0.000759441), Q14(0.00130214), Q14(-0.00211197), Q14(0.00327685),
+      Q14(-0.00490583), Q14(0.00713882), Q14(-0.0101672), Q14(0.0142782),
+      Q14(-0.0199547), Q14(0.0281248), Q14(-0.0408912), Q14(0.0642945),
+      Q14(-0.125455), Q14(0.961614), Q14(0.172194), Q14(-0.0761845),
+      Q14(0.0464191), Q14(-0.031389), Q14(0.0221278), Q14(-0.015819),
+      Q14(0.0112936), Q14(-0.00797059), Q14(0.00551767), Q14(-0.00372049),
+      Q14(0.00242629), Q14(-0.00151796), Q14(0.000901783), Q14(-0.000501515),
+      Q14(0.000255449), Q14(-0.000114692), Q14(4.18072e-05), Q14(-9.42834e-06)
+   },
+   {
+      Q14(-2.95165e-05), Q14(8.95673e-05), Q14(-0.000210288), Q14(0.000427199),
+      Q14(-0.000787306), Q14(0.00135049), Q14(-0.00219113), Q14(0.0034006),
+      Q14(-0.00509219), Q14(0.00741127), Q14(-0.0105566), Q14(0.014826),
+      Q14(-0.0207201), Q14(0.0292001), Q14(-0.0424407), Q14(0.0666765),
+      Q14(-0.129773), Q14(0.95817), Q14(0.180687), Q14(-0.0796074),
+      Q14(0.0484508), Q14(-0.0327486), Q14(0.0230823), Q14(-0.0165008),
+      Q14(0.0117809), Q14(-0.00831542), Q14(0.00575728), Q14(-0.00388284),
+      Q14(0.0025328), Q14(-0.0015851), Q14(0.000942038), Q14(-0.00052417),
+      Q14(0.000267175), Q14(-0.000120083), Q14(4.38569e-05), Q14(-9.94765e-06)
+   },
+   {
+      Q14(-3.03837e-05), Q14(9.24304e-05), Q14(-0.00021728), Q14(0.000441752),
+      Q14(-0.000814582), Q14(0.00139788), Q14(-0.00226877), Q14(0.00352205),
+      Q14(-0.00527521), Q14(0.00767895), Q14(-0.0109392), Q14(0.0153644),
+      Q14(-0.0214724), Q14(0.0302568), Q14(-0.0439623), Q14(0.0690112),
+      Q14(-0.133978), Q14(0.954585), Q14(0.189237), Q14(-0.0830213),
+      Q14(0.0504719), Q14(-0.0340999), Q14(0.0240307), Q14(-0.0171782),
+      Q14(0.0122651), Q14(-0.00865807), Q14(0.00599544), Q14(-0.00404428),
+      Q14(0.00263878), Q14(-0.00165194), Q14(0.000982148), Q14(-0.000546767),
+      Q14(0.000278888), Q14(-0.00012548), Q14(4.59155e-05), Q14(-1.0474e-05)
+   },
+   {
+      Q14(-3.12184e-05), Q14(9.52096e-05), Q14(-0.000224094), Q14(0.000455964),
+      Q14(-0.000841261), Q14(0.00144428), Q14(-0.00234487), Q14(0.00364117),
+      Q14(-0.00545482), Q14(0.00794175), Q14(-0.011315), Q14(0.0158932),
+      Q14(-0.0222114), Q14(0.0312945), Q14(-0.0454554), Q14(0.0712977),
+      Q14(-0.138072), Q14(0.950858), Q14(0.197842), Q14(-0.0864245),
+      Q14(0.0524816), Q14(-0.0354421), Q14(0.0249722), Q14(-0.0178506),
+      Q14(0.0127458), Q14(-0.00899836), Q14(0.00623205), Q14(-0.00420473),
+      Q14(0.00274416), Q14(-0.00171845), Q14(0.00102209), Q14(-0.000569293),
+      Q14(0.00029058), Q14(-0.000130878), Q14(4.7982e-05), Q14(-1.10072e-05)
+   },
+   {
+      Q14(-3.20206e-05), Q14(9.79047e-05), Q14(-0.000230726), Q14(0.000469831),
+      Q14(-0.000867335), Q14(0.00148968), Q14(-0.0024194), Q14(0.00375792),
+      Q14(-0.00563095), Q14(0.00819959), Q14(-0.0116837), Q14(0.0164124),
+      Q14(-0.0229368), Q14(0.0323129), Q14(-0.0469195), Q14(0.0735355),
+      Q14(-0.142054), Q14(0.946992), Q14(0.206501), Q14(-0.0898154),
+      Q14(0.0544787), Q14(-0.0367746), Q14(0.0259067), Q14(-0.0185178),
+      Q14(0.0132228), Q14(-0.00933613), Q14(0.00646698), Q14(-0.00436412),
+      Q14(0.0028489), Q14(-0.00178459), Q14(0.00106185), Q14(-0.000591739),
+      Q14(0.000302247), Q14(-0.000136275), Q14(5.00554e-05), Q14(-1.15469e-05)
+   },
+   {
+      Q14(-3.27905e-05), Q14(0.000100515), Q14(-0.000237176), Q14(0.00048335),
+      Q14(-0.000892796), Q14(0.00153406), Q14(-0.00249233), Q14(0.00387226),
+      Q14(-0.00580354), Q14(0.00845235), Q14(-0.0120454), Q14(0.0169216),
+      Q14(-0.0236484), Q14(0.0333115), Q14(-0.048354), Q14(0.0757238),
+      Q14(-0.145924), Q14(0.942987), Q14(0.215212), Q14(-0.0931925),
+      Q14(0.0564625), Q14(-0.0380968), Q14(0.0268334), Q14(-0.0191796),
+      Q14(0.013696), Q14(-0.0096712), Q14(0.00670011), Q14(-0.00452235),
+      Q14(0.00295293), Q14(-0.00185034), Q14(0.0011014), Q14(-0.000614091),
+      Q14(0.000313881), Q14(-0.000141668), Q14(5.21346e-05), Q14(-1.20929e-05)
+   },
+   {
+      Q14(-3.35281e-05), Q14(0.000103041), Q14(-0.000243443), Q14(0.000496517),
+      Q14(-0.000917635), Q14(0.00157742), Q14(-0.00256364), Q14(0.00398414),
+      Q14(-0.00597253), Q14(0.00869996), Q14(-0.0123998), Q14(0.0174206),
+      Q14(-0.0243458), Q14(0.03429), Q14(-0.0497586), Q14(0.0778621),
+      Q14(-0.149681), Q14(0.938845), Q14(0.223973), Q14(-0.0965542),
+      Q14(0.0584318), Q14(-0.0394079), Q14(0.0277521), Q14(-0.0198354),
+      Q14(0.0141649), Q14(-0.0100034), Q14(0.00693132), Q14(-0.00467935),
+      Q14(0.00305621), Q14(-0.00191565), Q14(0.00114072), Q14(-0.000636338),
+      Q14(0.000325478), Q14(-0.000147055), Q14(5.42184e-05), Q14(-1.26449e-05)
+   },
+   {
+      Q14(-3.42335e-05), Q14(0.000105481), Q14(-0.000249526), Q14(0.000509329),
+      Q14(-0.000941847), Q14(0.00161974), Q14(-0.00263331), Q14(0.00409352),
+      Q14(-0.00613785), Q14(0.00894232), Q14(-0.0127468), Q14(0.0179094),
+      Q14(-0.0250288), Q14(0.035248), Q14(-0.0511327), Q14(0.0799497),
+      Q14(-0.153325), Q14(0.934566), Q14(0.232781), Q14(-0.0998988),
+      Q14(0.0603856), Q14(-0.0407074), Q14(0.0286621), Q14(-0.0204851),
+      Q14(0.0146295), Q14(-0.0103326), Q14(0.0071605), Q14(-0.00483504),
+      Q14(0.00315869), Q14(-0.0019805), Q14(0.0011798), Q14(-0.000658468),
+      Q14(0.00033703), Q14(-0.000152432), Q14(5.63059e-05), Q14(-1.32026e-05)
+   },
+   {
+      Q14(-3.49068e-05), Q14(0.000107837), Q14(-0.000255422), Q14(0.000521782),
+      Q14(-0.000965424), Q14(0.001661), Q14(-0.00270131), Q14(0.00420038),
+      Q14(-0.00629945), Q14(0.00917934), Q14(-0.0130863), Q14(0.0183877),
+      Q14(-0.0256972), Q14(0.0361852), Q14(-0.0524758), Q14(0.0819862),
+      Q14(-0.156856), Q14(0.930152), Q14(0.241634), Q14(-0.103225),
+      Q14(0.0623232), Q14(-0.0419946), Q14(0.0295632), Q14(-0.0211282),
+      Q14(0.0150895), Q14(-0.0106585), Q14(0.00738753), Q14(-0.00498933),
+      Q14(0.00326031), Q14(-0.00204485), Q14(0.00121861), Q14(-0.000680471),
+      Q14(0.000348531), Q14(-0.000157797), Q14(5.83959e-05), Q14(-1.37658e-05)
+   },
+   {
+      Q14(-3.55482e-05), Q14(0.000110107), Q14(-0.000261132), Q14(0.000533874),
+      Q14(-0.00098836), Q14(0.0017012), Q14(-0.00276762), Q14(0.00430466),
+      Q14(-0.00645728), Q14(0.00941094), Q14(-0.0134182), Q14(0.0188553),
+      Q14(-0.0263507), Q14(0.0371013), Q14(-0.0537876), Q14(0.0839708),
+      Q14(-0.160275), Q14(0.925603), Q14(0.250532), Q14(-0.106531),
+      Q14(0.0642433), Q14(-0.0432688), Q14(0.0304547), Q14(-0.0217645),
+      Q14(0.0155446), Q14(-0.0109811), Q14(0.00761229), Q14(-0.00514215),
+      Q14(0.00336101), Q14(-0.00210866), Q14(0.00125713), Q14(-0.000702333),
+      Q14(0.000359976), Q14(-0.000163147), Q14(6.04871e-05), Q14(-1.43341e-05)
+   },
+   {
+      Q14(-3.61578e-05), Q14(0.000112291), Q14(-0.000266654), Q14(0.000545603),
+      Q14(-0.00101065), Q14(0.00174031), Q14(-0.00283222), Q14(0.00440635),
+      Q14(-0.00661127), Q14(0.00963704), Q14(-0.0137423), Q14(0.0193121),
+      Q14(-0.0269891), Q14(0.037996), Q14(-0.0550676), Q14(0.0859031),
+      Q14(-0.163581), Q14(0.920922), Q14(0.259471), Q14(-0.109815),
+      Q14(0.0661452), Q14(-0.0445293), Q14(0.0313363), Q14(-0.0223936),
+      Q14(0.0159946), Q14(-0.0113002), Q14(0.00783466), Q14(-0.00529342),
+      Q14(0.00346075), Q14(-0.00217191), Q14(0.00129534), Q14(-0.000724043),
+      Q14(0.000371358), Q14(-0.000168478), Q14(6.25785e-05), Q14(-1.49072e-05)
+   },
+   {
+      Q14(-3.67358e-05), Q14(0.000114389), Q14(-0.000271987), Q14(0.000556964),
+      Q14(-0.00103228), Q14(0.00177834), Q14(-0.00289509), Q14(0.00450541),
+      Q14(-0.00676139), Q14(0.00985756), Q14(-0.0140585), Q14(0.0197579),
+      Q14(-0.0276121), Q14(0.0388689), Q14(-0.0563154), Q14(0.0877827),
+      Q14(-0.166773), Q14(0.91611), Q14(0.26845), Q14(-0.113075),
+      Q14(0.0680277), Q14(-0.0457756), Q14(0.0322075), Q14(-0.0230152),
+      Q14(0.0164393), Q14(-0.0116156), Q14(0.00805453), Q14(-0.00544306),
+      Q14(0.00355946), Q14(-0.00223455), Q14(0.00133321), Q14(-0.000745589),
+      Q14(0.00038267), Q14(-0.000173788), Q14(6.46689e-05), Q14(-1.54849e-05)
+   },
+   {
+      Q14(-3.72824e-05), Q14(0.000116402), Q14(-0.000277131), Q14(0.000567958),
+      Q14(-0.00105326), Q14(0.00181526), Q14(-0.00295622), Q14(0.0046018),
+      Q14(-0.00690757), Q14(0.0100724), Q14(-0.0143667), Q14(0.0201926),
+      Q14(-0.0282196), Q14(0.0397198), Q14(-0.0575306), Q14(0.089609),
+      Q14(-0.169853), Q14(0.911167), Q14(0.277466), Q14(-0.116311),
+      Q14(0.06989), Q14(-0.047007), Q14(0.0330678), Q14(-0.023629),
+      Q14(0.0168784), Q14(-0.0119271), Q14(0.00827179), Q14(-0.00559099),
+      Q14(0.00365711), Q14(-0.00229656), Q14(0.00137074), Q14(-0.000766959),
+      Q14(0.000393907), Q14(-0.000179073), Q14(6.67571e-05), Q14(-1.60667e-05)
+   },
+   {
+      Q14(-3.77978e-05), Q14(0.000118329), Q14(-0.000282085), Q14(0.00057858),
+      Q14(-0.00107358), Q14(0.00185108), Q14(-0.00301558), Q14(0.00469549),
+      Q14(-0.00704977), Q14(0.0102816), Q14(-0.0146669), Q14(0.020616),
+      Q14(-0.0288113), Q14(0.0405483), Q14(-0.0587128), Q14(0.0913817),
+      Q14(-0.17282), Q14(0.906095), Q14(0.286517), Q14(-0.11952),
+      Q14(0.0717311), Q14(-0.0482228), Q14(0.0339168), Q14(-0.0242346),
+      Q14(0.0173117), Q14(-0.0122345), Q14(0.00848631), Q14(-0.00573712),
+      Q14(0.00375363), Q14(-0.0023579), Q14(0.00140789), Q14(-0.000788142),
+      Q14(0.000405062), Q14(-0.000184331), Q14(6.88419e-05), Q14(-1.66524e-05)
+   },
+   {
+      Q14(-3.82823e-05), Q14(0.000120171), Q14(-0.000286849), Q14(0.00058883),
+      Q14(-0.00109322), Q14(0.00188578), Q14(-0.00307316), Q14(0.00478646),
+      Q14(-0.00718795), Q14(0.0104849), Q14(-0.0149589), Q14(0.0210279),
+      Q14(-0.0293871), Q14(0.0413542), Q14(-0.0598617), Q14(0.0931002),
+      Q14(-0.175674), Q14(0.900896), Q14(0.295602), Q14(-0.1227),
+      Q14(0.07355), Q14(-0.0494224), Q14(0.0347541), Q14(-0.0248318),
+      Q14(0.0177391), Q14(-0.0125378), Q14(0.00869798), Q14(-0.00588139),
+      Q14(0.00384897), Q14(-0.00241853), Q14(0.00144466), Q14(-0.000809125),
+      Q14(0.000416128), Q14(-0.000189559), Q14(7.09221e-05), Q14(-1.72416e-05)
+   },
+   {
+      Q14(-3.87359e-05), Q14(0.000121927), Q14(-0.000291422), Q14(0.000598705),
+      Q14(-0.0011122), Q14(0.00191935), Q14(-0.00312894), Q14(0.00487469),
+      Q14(-0.00732206), Q14(0.0106824), Q14(-0.0152426), Q14(0.0214283),
+      Q14(-0.0299467), Q14(0.0421373), Q14(-0.0609769), Q14(0.0947642),
+      Q14(-0.178416), Q14(0.895571), Q14(0.304717), Q14(-0.125851),
+      Q14(0.0753457), Q14(-0.0506052), Q14(0.0355793), Q14(-0.0254202),
+      Q14(0.0181601), Q14(-0.0128367), Q14(0.00890669), Q14(-0.0060237),
+      Q14(0.00394309), Q14(-0.00247843), Q14(0.00148101), Q14(-0.000829896),
+      Q14(0.0004271), Q14(-0.000194754), Q14(7.29963e-05), Q14(-1.78339e-05)
+   },
+   {
+      Q14(-3.91591e-05), Q14(0.000123598), Q14(-0.000295803), Q14(0.000608204),
+      Q14(-0.0011305), Q14(0.00195178), Q14(-0.0031829), Q14(0.00496013),
+      Q14(-0.00745207), Q14(0.010874), Q14(-0.0155179), Q14(0.0218169),
+      Q14(-0.03049), Q14(0.0428972), Q14(-0.0620581), Q14(0.0963734),
+      Q14(-0.181045), Q14(0.890122), Q14(0.313862), Q14(-0.12897),
+      Q14(0.0771174), Q14(-0.0517706), Q14(0.0363918), Q14(-0.0259995),
+      Q14(0.0185747), Q14(-0.0131311), Q14(0.00911233), Q14(-0.006164),
+      Q14(0.00403592), Q14(-0.00253756), Q14(0.00151692), Q14(-0.000850445),
+      Q14(0.000437971), Q14(-0.000199912), Q14(7.50635e-05), Q14(-1.84291e-05)
+   },
+   {
+      Q14(-3.95521e-05), Q14(0.000125184), Q14(-0.000299994), Q14(0.000617326),
+      Q14(-0.00114812), Q14(0.00198307), Q14(-0.00323504), Q14(0.00504278),
+      Q14(-0.00757792), Q14(0.0110596), Q14(-0.0157847), Q14(0.0221938),
+      Q14(-0.0310167), Q14(0.0436338), Q14(-0.063105), Q14(0.0979274),
+      Q14(-0.183561), Q14(0.88455), Q14(0.323033), Q14(-0.132056),
+      Q14(0.078864), Q14(-0.0529179), Q14(0.0371912), Q14(-0.0265694),
+      Q14(0.0189827), Q14(-0.0134208), Q14(0.00931478), Q14(-0.00630219),
+      Q14(0.00412742), Q14(-0.00259588), Q14(0.00155239), Q14(-0.000870758),
+      Q14(0.000448735), Q14(-0.000205031), Q14(7.71222e-05), Q14(-1.90266e-05)
+   },
+   {
+      Q14(-3.99152e-05), Q14(0.000126685), Q14(-0.000303993), Q14(0.00062607),
+      Q14(-0.00116506), Q14(0.0020132), Q14(-0.00328534), Q14(0.0051226),
+      Q14(-0.00769959), Q14(0.0112391), Q14(-0.0160431), Q14(0.0225586),
+      Q14(-0.0315268), Q14(0.0443468), Q14(-0.0641173), Q14(0.0994258),
+      Q14(-0.185966), Q14(0.878856), Q14(0.332229), Q14(-0.135107),
+      Q14(0.0805847), Q14(-0.0540465), Q14(0.0379772), Q14(-0.0271297),
+      Q14(0.0193837), Q14(-0.0137057), Q14(0.00951394), Q14(-0.0064382),
+      Q14(0.00421753), Q14(-0.00265337), Q14(0.00158737), Q14(-0.000890824),
+      Q14(0.000459384), Q14(-0.000210107), Q14(7.91713e-05), Q14(-1.96261e-05)
+   },
+   {
+      Q14(-4.02486e-05), Q14(0.000128102), Q14(-0.000307801), Q14(0.000634435),
+      Q14(-0.00118131), Q14(0.00204218), Q14(-0.00333378), Q14(0.00519958),
+      Q14(-0.00781704), Q14(0.0114126), Q14(-0.0162927), Q14(0.0229114),
+      Q14(-0.03202), Q14(0.045036), Q14(-0.0650947), Q14(0.100868),
+      Q14(-0.188259), Q14(0.873042), Q14(0.341447), Q14(-0.138122),
+      Q14(0.0822785), Q14(-0.0551558), Q14(0.0387492), Q14(-0.0276799),
+      Q14(0.0197776), Q14(-0.0139856), Q14(0.00970969), Q14(-0.00657195),
+      Q14(0.00430622), Q14(-0.00270999), Q14(0.00162187), Q14(-0.000910631),
+      Q14(0.000469913), Q14(-0.000215137), Q14(8.12094e-05), Q14(-2.02273e-05)
+   },
+   {
+      Q14(-4.05527e-05), Q14(0.000129434), Q14(-0.000311417), Q14(0.00064242),
+      Q14(-0.00119687), Q14(0.00207), Q14(-0.00338036), Q14(0.0052737),
+      Q14(-0.00793025), Q14(0.0115799), Q14(-0.0165337), Q14(0.023252),
+      Q14(-0.0324962), Q14(0.0457012), Q14(-0.066037), Q14(0.102255),
+      Q14(-0.19044), Q14(0.86711), Q14(0.350686), Q14(-0.141099),
+      Q14(0.0839444), Q14(-0.0562452), Q14(0.039507), Q14(-0.0282198),
+      Q14(0.0201641), Q14(-0.0142604), Q14(0.00990192), Q14(-0.00670338),
+      Q14(0.00439341), Q14(-0.00276571), Q14(0.00165585), Q14(-0.000930167),
+      Q14(0.000480316), Q14(-0.000220118), Q14(8.32353e-05), Q14(-2.08298e-05)
+   },
+   {
+      Q14(-4.08278e-05), Q14(0.000130683), Q14(-0.000314842), Q14(0.000650024),
+      Q14(-0.00121175), Q14(0.00209665), Q14(-0.00342507), Q14(0.00534493),
+      Q14(-0.00803917), Q14(0.011741), Q14(-0.0167659), Q14(0.0235804),
+      Q14(-0.0329553), Q14(0.0463423), Q14(-0.0669439), Q14(0.103585),
+      Q14(-0.192511), Q14(0.861061), Q14(0.359942), Q14(-0.144036),
+      Q14(0.0855816), Q14(-0.0573141), Q14(0.0402499), Q14(-0.0287491),
+      Q14(0.0205431), Q14(-0.0145298), Q14(0.0100905), Q14(-0.0068324),
+      Q14(0.00447907), Q14(-0.00282049), Q14(0.00168929), Q14(-0.000949421),
+      Q14(0.000490586), Q14(-0.000225048), Q14(8.52476e-05), Q14(-2.14331e-05)
+   },
+   {
+      Q14(-4.10742e-05), Q14(0.000131848), Q14(-0.000318076), Q14(0.000657248),
+      Q14(-0.00122593), Q14(0.00212213), Q14(-0.00346789), Q14(0.00541327),
+      Q14(-0.00814378), Q14(0.0118959), Q14(-0.0169893), Q14(0.0238964),
+      Q14(-0.0333971), Q14(0.0469589), Q14(-0.0678152), Q14(0.104859),
+      Q14(-0.19447), Q14(0.854897), Q14(0.369214), Q14(-0.146932),
+      Q14(0.0871891), Q14(-0.058362), Q14(0.0409778), Q14(-0.0292675),
+      Q14(0.0209143), Q14(-0.0147938), Q14(0.0102754), Q14(-0.00695894),
+      Q14(0.00456315), Q14(-0.00287431), Q14(0.00172218), Q14(-0.00096838),
+      Q14(0.000500716), Q14(-0.000229922), Q14(8.7245e-05), Q14(-2.20368e-05)
+   },
+   {
+      Q14(-4.12923e-05), Q14(0.00013293), Q14(-0.00032112), Q14(0.000664091),
+      Q14(-0.00123942), Q14(0.00214643), Q14(-0.00350882), Q14(0.00547869),
+      Q14(-0.00824405), Q14(0.0120445), Q14(-0.0172037), Q14(0.0241999),
+      Q14(-0.0338215), Q14(0.0475511), Q14(-0.0686507), Q14(0.106076),
+      Q14(-0.196319), Q14(0.84862), Q14(0.378499), Q14(-0.149785),
+      Q14(0.088766), Q14(-0.0593881), Q14(0.04169), Q14(-0.0297747),
+      Q14(0.0212775), Q14(-0.0150523), Q14(0.0104564), Q14(-0.00708293),
+      Q14(0.00464559), Q14(-0.00292713), Q14(0.00175449), Q14(-0.000987034),
+      Q14(0.000510701), Q14(-0.000234738), Q14(8.92262e-05), Q14(-2.26405e-05)
+   },
+   {
+      Q14(-4.14825e-05), Q14(0.00013393), Q14(-0.000323974), Q14(0.000670553),
+      Q14(-0.00125222), Q14(0.00216955), Q14(-0.00354786), Q14(0.00554118),
+      Q14(-0.00833997), Q14(0.0121868), Q14(-0.0174093), Q14(0.0244908),
+      Q14(-0.0342284), Q14(0.0481185), Q14(-0.0694503), Q14(0.107236),
+      Q14(-0.198059), Q14(0.842231), Q14(0.387796), Q14(-0.152593),
+      Q14(0.0903115), Q14(-0.060392), Q14(0.0423864), Q14(-0.0302704),
+      Q14(0.0216326), Q14(-0.0153049), Q14(0.0106335), Q14(-0.0072043),
+      Q14(0.00472635), Q14(-0.00297892), Q14(0.00178621), Q14(-0.00100537),
+      Q14(0.000520533), Q14(-0.000239492), Q14(9.11898e-05), Q14(-2.32438e-05)
+   },
+   {
+      Q14(-4.16451e-05), Q14(0.000134848), Q14(-0.000326638), Q14(0.000676635),
+      Q14(-0.00126432), Q14(0.00219149), Q14(-0.00358498), Q14(0.00560074),
+      Q14(-0.0084315), Q14(0.0123227), Q14(-0.0176057), Q14(0.0247692),
+      Q14(-0.0346177), Q14(0.0486611), Q14(-0.0702136), Q14(0.108339),
+      Q14(-0.199689), Q14(0.835732), Q14(0.397101), Q14(-0.155356),
+      Q14(0.0918246), Q14(-0.0613731), Q14(0.0430663), Q14(-0.0307544),
+      Q14(0.0219793), Q14(-0.0155517), Q14(0.0108066), Q14(-0.00732297),
+      Q14(0.00480537), Q14(-0.00302964), Q14(0.00181732), Q14(-0.00102338),
+      Q14(0.000530207), Q14(-0.000244182), Q14(9.31346e-05), Q14(-2.38462e-05)
+   },
+   {
+      Q14(-4.17805e-05), Q14(0.000135685), Q14(-0.000329114), Q14(0.000682337),
+      Q14(-0.00127572), Q14(0.00221224), Q14(-0.0036202), Q14(0.00565734),
+      Q14(-0.00851863), Q14(0.0124523), Q14(-0.0177932), Q14(0.0250348),
+      Q14(-0.0349893), Q14(0.0491788), Q14(-0.0709407), Q14(0.109386),
+      Q14(-0.20121), Q14(0.829125), Q14(0.406413), Q14(-0.158071),
+      Q14(0.0933044), Q14(-0.0623308), Q14(0.0437295), Q14(-0.0312264),
+      Q14(0.0223174), Q14(-0.0157925), Q14(0.0109755), Q14(-0.00743888),
+      Q14(0.00488262), Q14(-0.00307928), Q14(0.00184779), Q14(-0.00104104),
+      Q14(0.000539717), Q14(-0.000248804), Q14(9.5059e-05), Q14(-2.44474e-05)
+   },
+   {
+      Q14(-4.18891e-05), Q14(0.000136441), Q14(-0.000331401), Q14(0.000687659),
+      Q14(-0.00128643), Q14(0.00223181), Q14(-0.0036535), Q14(0.00571098),
+      Q14(-0.00860135), Q14(0.0125754), Q14(-0.0179715), Q14(0.0252877),
+      Q14(-0.035343), Q14(0.0496713), Q14(-0.0716313), Q14(0.110374),
+      Q14(-0.202622), Q14(0.822412), Q14(0.415729), Q14(-0.160736),
+      Q14(0.0947502), Q14(-0.0632645), Q14(0.0443756), Q14(-0.031686),
+      Q14(0.0226467), Q14(-0.0160271), Q14(0.0111402), Q14(-0.00755195),
+      Q14(0.00495804), Q14(-0.00312778), Q14(0.00187761), Q14(-0.00105836),
+      Q14(0.000549055), Q14(-0.000253355), Q14(9.69618e-05), Q14(-2.50468e-05)
+   },
+   {
+      Q14(-4.19713e-05), Q14(0.000137117), Q14(-0.000333502), Q14(0.000692603),
+      Q14(-0.00129645), Q14(0.00225019), Q14(-0.00368488), Q14(0.00576165),
+      Q14(-0.00867963), Q14(0.0126921), Q14(-0.0181407), Q14(0.0255277),
+      Q14(-0.0356789), Q14(0.0501387), Q14(-0.0722853), Q14(0.111306),
+      Q14(-0.203927), Q14(0.815595), Q14(0.425047), Q14(-0.163351),
+      Q14(0.096161), Q14(-0.0641737), Q14(0.0450042), Q14(-0.0321331),
+      Q14(0.022967), Q14(-0.0162553), Q14(0.0113005), Q14(-0.00766211),
+      Q14(0.00503159), Q14(-0.00317514), Q14(0.00190675), Q14(-0.00107531),
+      Q14(0.000558215), Q14(-0.000257832), Q14(9.88416e-05), Q14(-2.5644e-05)
+   },
+   {
+      Q14(-4.20275e-05), Q14(0.000137713), Q14(-0.000335416), Q14(0.000697169),
+      Q14(-0.00130577), Q14(0.00226738), Q14(-0.00371433), Q14(0.00580935),
+      Q14(-0.00875347), Q14(0.0128024), Q14(-0.0183007), Q14(0.0257549),
+      Q14(-0.0359968), Q14(0.0505808), Q14(-0.0729026), Q14(0.11218),
+      Q14(-0.205125), Q14(0.808674), Q14(0.434364), Q14(-0.165914),
+      Q14(0.097536), Q14(-0.0650579), Q14(0.0456149), Q14(-0.0325674),
+      Q14(0.0232782), Q14(-0.0164771), Q14(0.0114564), Q14(-0.00776931),
+      Q14(0.00510322), Q14(-0.00322131), Q14(0.00193521), Q14(-0.00109189),
+      Q14(0.000567192), Q14(-0.000262232), Q14(0.000100697), Q14(-2.62385e-05)
+   },
+   {
+      Q14(-4.20582e-05), Q14(0.000138231), Q14(-0.000337145), Q14(0.000701359),
+      Q14(-0.0013144), Q14(0.00228339), Q14(-0.00374187), Q14(0.00585406),
+      Q14(-0.00882285), Q14(0.0129062), Q14(-0.0184515), Q14(0.0259692),
+      Q14(-0.0362967), Q14(0.0509975), Q14(-0.0734832), Q14(0.112998),
+      Q14(-0.206216), Q14(0.801653), Q14(0.443679), Q14(-0.168422),
+      Q14(0.0988743), Q14(-0.0659165), Q14(0.0462073), Q14(-0.0329885),
+      Q14(0.02358), Q14(-0.0166924), Q14(0.0116077), Q14(-0.00787346),
+      Q14(0.00517289), Q14(-0.00326627), Q14(0.00196295), Q14(-0.00110808),
+      Q14(0.00057598), Q14(-0.000266551), Q14(0.000102527), Q14(-2.68299e-05)
+   },
+   {
+      Q14(-4.20638e-05), Q14(0.000138672), Q14(-0.00033869), Q14(0.000705173),
+      Q14(-0.00132234), Q14(0.0022982), Q14(-0.00376748), Q14(0.00589579),
+      Q14(-0.00888777), Q14(0.0130035), Q14(-0.018593), Q14(0.0261705),
+      Q14(-0.0365785), Q14(0.0513888), Q14(-0.0740269), Q14(0.113757),
+      Q14(-0.207201), Q14(0.794534), Q14(0.452989), Q14(-0.170875),
+      Q14(0.100175), Q14(-0.066749), Q14(0.0467812), Q14(-0.0333963),
+      Q14(0.0238722), Q14(-0.0169009), Q14(0.0117544), Q14(-0.00797451),
+      Q14(0.00524055), Q14(-0.00330998), Q14(0.00198997), Q14(-0.00112387),
+      Q14(0.000584571), Q14(-0.000270787), Q14(0.000104329), Q14(-2.74176e-05)
+   },
+   {
+      Q14(-4.20448e-05), Q14(0.000139035), Q14(-0.000340052), Q14(0.000708614),
+      Q14(-0.00132958), Q14(0.00231184), Q14(-0.00379116), Q14(0.00593454),
+      Q14(-0.00894821), Q14(0.0130943), Q14(-0.0187253), Q14(0.0263589),
+      Q14(-0.0368422), Q14(0.0517546), Q14(-0.0745337), Q14(0.11446),
+      Q14(-0.208081), Q14(0.787317), Q14(0.462292), Q14(-0.17327),
+      Q14(0.101438), Q14(-0.067555), Q14(0.0473361), Q14(-0.0337905),
+      Q14(0.0241548), Q14(-0.0171026), Q14(0.0118964), Q14(-0.00807239),
+      Q14(0.00530615), Q14(-0.00335242), Q14(0.00201625), Q14(-0.00113926),
+      Q14(0.00059296), Q14(-0.000274936), Q14(0.000106103), Q14(-2.80013e-05)
+   },
+   {
+      Q14(-4.20015e-05), Q14(0.000139321), Q14(-0.000341232), Q14(0.000711683),
+      Q14(-0.00133614), Q14(0.00232429), Q14(-0.00381292), Q14(0.00597029),
+      Q14(-0.00900418), Q14(0.0131785), Q14(-0.0188484), Q14(0.0265342),
+      Q14(-0.0370877), Q14(0.0520949), Q14(-0.0750036), Q14(0.115105),
+      Q14(-0.208857), Q14(0.780005), Q14(0.471584), Q14(-0.175608),
+      Q14(0.102661), Q14(-0.0683338), Q14(0.0478717), Q14(-0.0341708),
+      Q14(0.0244275), Q14(-0.0172973), Q14(0.0120336), Q14(-0.00816704),
+      Q14(0.00536966), Q14(-0.00339357), Q14(0.00204175), Q14(-0.00115423),
+      Q14(0.000601141), Q14(-0.000278996), Q14(0.000107847), Q14(-2.85804e-05)
+   },
+   {
+      Q14(-4.19345e-05), Q14(0.000139533), Q14(-0.000342232), Q14(0.000714382),
+      Q14(-0.00134201), Q14(0.00233555), Q14(-0.00383276), Q14(0.00600306),
+      Q14(-0.00905567), Q14(0.0132563), Q14(-0.0189621), Q14(0.0266964),
+      Q14(-0.037315), Q14(0.0524096), Q14(-0.0754366), Q14(0.115694),
+      Q14(-0.209529), Q14(0.772601), Q14(0.480865), Q14(-0.177885),
+      Q14(0.103845), Q14(-0.0690849), Q14(0.0483877), Q14(-0.0345371),
+      Q14(0.0246901), Q14(-0.0174849), Q14(0.0121659), Q14(-0.0082584),
+      Q14(0.00543104), Q14(-0.00343338), Q14(0.00206648), Q14(-0.00116877),
+      Q14(0.000609108), Q14(-0.000282962), Q14(0.00010956), Q14(-2.91545e-05)
+   },
+   {
+      Q14(-4.18442e-05), Q14(0.00013967), Q14(-0.000343052), Q14(0.000716713),
+      Q14(-0.0013472), Q14(0.00234564), Q14(-0.00385068), Q14(0.00603284),
+      Q14(-0.00910268), Q14(0.0133275), Q14(-0.0190665), Q14(0.0268456),
+      Q14(-0.0375241), Q14(0.0526987), Q14(-0.0758326), Q14(0.116225),
+      Q14(-0.210098), Q14(0.765105), Q14(0.490132), Q14(-0.1801),
+      Q14(0.104987), Q14(-0.069808), Q14(0.0488837), Q14(-0.0348891),
+      Q14(0.0249425), Q14(-0.0176652), Q14(0.0122932), Q14(-0.0083464),
+      Q14(0.00549023), Q14(-0.00347183), Q14(0.0020904), Q14(-0.00118286),
+      Q14(0.000616854), Q14(-0.000286833), Q14(0.00011124), Q14(-2.97229e-05)
+   },
+   {
+      Q14(-4.17311e-05), Q14(0.000139733), Q14(-0.000343696), Q14(0.000718678),
+      Q14(-0.00135171), Q14(0.00235456), Q14(-0.00386669), Q14(0.00605964),
+      Q14(-0.00914522), Q14(0.0133922), Q14(-0.0191617), Q14(0.0269818),
+      Q14(-0.0377149), Q14(0.0529621), Q14(-0.0761917), Q14(0.116699),
+      Q14(-0.210565), Q14(0.757521), Q14(0.499381), Q14(-0.182252),
+      Q14(0.106089), Q14(-0.0705026), Q14(0.0493594), Q14(-0.0352265),
+      Q14(0.0251844), Q14(-0.0178383), Q14(0.0124154), Q14(-0.00843099),
+      Q14(0.0055472), Q14(-0.00350891), Q14(0.00211351), Q14(-0.00119651),
+      Q14(0.000624375), Q14(-0.000290605), Q14(0.000112886), Q14(-3.02853e-05)
+   },
+   {
+      Q14(-4.15957e-05), Q14(0.000139723), Q14(-0.000344163), Q14(0.00072028),
+      Q14(-0.00135554), Q14(0.0023623), Q14(-0.00388078), Q14(0.00608347),
+      Q14(-0.00918328), Q14(0.0134504), Q14(-0.0192475), Q14(0.0271049),
+      Q14(-0.0378875), Q14(0.0532), Q14(-0.0765139), Q14(0.117117),
+      Q14(-0.210931), Q14(0.74985), Q14(0.508612), Q14(-0.184339),
+      Q14(0.107148), Q14(-0.0711681), Q14(0.0498146), Q14(-0.0355491),
+      Q14(0.0254159), Q14(-0.0180039), Q14(0.0125324), Q14(-0.0085121),
+      Q14(0.00560191), Q14(-0.00354457), Q14(0.00213579), Q14(-0.0012097),
+      Q14(0.000631663), Q14(-0.000294275), Q14(0.000114497), Q14(-3.08412e-05)
+   },
+   {
+      Q14(-4.14385e-05), Q14(0.000139642), Q14(-0.000344456), Q14(0.000721521),
+      Q14(-0.0013587), Q14(0.00236888), Q14(-0.00389297), Q14(0.00610432),
+      Q14(-0.00921687), Q14(0.0135021), Q14(-0.019324), Q14(0.0272149),
+      Q14(-0.0380419), Q14(0.0534122), Q14(-0.0767992), Q14(0.117479),
+      Q14(-0.211196), Q14(0.742093), Q14(0.517821), Q14(-0.18636),
+      Q14(0.108164), Q14(-0.0718041), Q14(0.0502488), Q14(-0.0358568),
+      Q14(0.0256366), Q14(-0.0181619), Q14(0.0126443), Q14(-0.00858968),
+      Q14(0.00565432), Q14(-0.00357879), Q14(0.00215721), Q14(-0.00122242),
+      Q14(0.000638714), Q14(-0.000297839), Q14(0.00011607), Q14(-3.13899e-05)
+   },
+   {
+      Q14(-4.12599e-05), Q14(0.00013949), Q14(-0.000344577), Q14(0.000722403),
+      Q14(-0.00136119), Q14(0.00237429), Q14(-0.00390326), Q14(0.00612221),
+      Q14(-0.00924601), Q14(0.0135472), Q14(-0.0193913), Q14(0.0273118),
+      Q14(-0.038178), Q14(0.0535989), Q14(-0.0770477), Q14(0.117784),
+      Q14(-0.211362), Q14(0.734255), Q14(0.527006), Q14(-0.188314),
+      Q14(0.109137), Q14(-0.0724102), Q14(0.0506618), Q14(-0.0361492),
+      Q14(0.0258464), Q14(-0.0183123), Q14(0.0127508), Q14(-0.00866368),
+      Q14(0.0057044), Q14(-0.00361156), Q14(0.00217777), Q14(-0.00123465),
+      Q14(0.000645521), Q14(-0.000301296), Q14(0.000117606), Q14(-3.1931e-05)
+   },
+   {
+      Q14(-4.10605e-05), Q14(0.000139269), Q14(-0.000344527), Q14(0.00072293),
+      Q14(-0.00136301), Q14(0.00237855), Q14(-0.00391167), Q14(0.00613714),
+      Q14(-0.0092707), Q14(0.0135859), Q14(-0.0194492), Q14(0.0273957),
+      Q14(-0.038296), Q14(0.05376), Q14(-0.0772595), Q14(0.118033),
+      Q14(-0.21143), Q14(0.726335), Q14(0.536165), Q14(-0.190198),
+      Q14(0.110065), Q14(-0.0729859), Q14(0.0510533), Q14(-0.0364263),
+      Q14(0.0260453), Q14(-0.0184549), Q14(0.0128519), Q14(-0.00873404),
+      Q14(0.0057521), Q14(-0.00364283), Q14(0.00219744), Q14(-0.0012464),
+      Q14(0.000652078), Q14(-0.000304641), Q14(0.000119102), Q14(-3.24641e-05)
+   },
+   {
+      Q14(-4.08408e-05), Q14(0.000138978), Q14(-0.000344308), Q14(0.000723105),
+      Q14(-0.00136417), Q14(0.00238166), Q14(-0.00391818), Q14(0.00614913),
+      Q14(-0.00929096), Q14(0.013618), Q14(-0.0194979), Q14(0.0274666),
+      Q14(-0.0383957), Q14(0.0538957), Q14(-0.0774347), Q14(0.118226),
+      Q14(-0.2114), Q14(0.718337), Q14(0.545296), Q14(-0.192012),
+      Q14(0.110948), Q14(-0.0735309), Q14(0.0514231), Q14(-0.0366877),
+      Q14(0.0262329), Q14(-0.0185895), Q14(0.0129475), Q14(-0.0088007),
+      Q14(0.00579738), Q14(-0.0036726), Q14(0.00221621), Q14(-0.00125764),
+      Q14(0.000658381), Q14(-0.000307873), Q14(0.000120556), Q14(-3.29884e-05)
+   },
+   {
+      Q14(-4.06013e-05), Q14(0.000138621), Q14(-0.000343923), Q14(0.00072293),
+      Q14(-0.00136467), Q14(0.00238363), Q14(-0.00392282), Q14(0.00615818),
+      Q14(-0.00930679), Q14(0.0136437), Q14(-0.0195374), Q14(0.0275245),
+      Q14(-0.0384773), Q14(0.0540059), Q14(-0.0775734), Q14(0.118363),
+      Q14(-0.211273), Q14(0.710263), Q14(0.554395), Q14(-0.193754),
+      Q14(0.111785), Q14(-0.0740447), Q14(0.0517708), Q14(-0.0369334),
+      Q14(0.0264093), Q14(-0.0187162), Q14(0.0130376), Q14(-0.00886362),
+      Q14(0.00584022), Q14(-0.00370083), Q14(0.00223407), Q14(-0.00126838),
+      Q14(0.000664424), Q14(-0.000310988), Q14(0.000121969), Q14(-3.35037e-05)
+   },
+   {
+      Q14(-4.03425e-05), Q14(0.000138196), Q14(-0.000343372), Q14(0.000722409),
+      Q14(-0.00136452), Q14(0.00238447), Q14(-0.0039256), Q14(0.00616432),
+      Q14(-0.00931822), Q14(0.013663), Q14(-0.0195676), Q14(0.0275695),
+      Q14(-0.0385409), Q14(0.0540907), Q14(-0.0776757), Q14(0.118446),
+      Q14(-0.211051), Q14(0.702114), Q14(0.563462), Q14(-0.195422),
+      Q14(0.112576), Q14(-0.0745269), Q14(0.0520962), Q14(-0.0371631),
+      Q14(0.0265743), Q14(-0.0188349), Q14(0.0131221), Q14(-0.00892274),
+      Q14(0.00588057), Q14(-0.0037275), Q14(0.002251), Q14(-0.00127859),
+      Q14(0.000670201), Q14(-0.000313982), Q14(0.000123337), Q14(-3.40092e-05)
+   },
+   {
+      Q14(-4.00649e-05), Q14(0.000137707), Q14(-0.000342658), Q14(0.000721546),
+      Q14(-0.00136373), Q14(0.00238417), Q14(-0.00392653), Q14(0.00616754),
+      Q14(-0.00932526), Q14(0.0136758), Q14(-0.0195887), Q14(0.0276015),
+      Q14(-0.0385863), Q14(0.0541502), Q14(-0.0777417), Q14(0.118473),
+      Q14(-0.210734), Q14(0.693893), Q14(0.572493), Q14(-0.197016),
+      Q14(0.11332), Q14(-0.0749772), Q14(0.0523991), Q14(-0.0373766),
+      Q14(0.0267277), Q14(-0.0189453), Q14(0.0132009), Q14(-0.00897803),
+      Q14(0.00591841), Q14(-0.00375259), Q14(0.00226699), Q14(-0.00128828),
+      Q14(0.000675706), Q14(-0.000316854), Q14(0.00012466), Q14(-3.45045e-05)
+   },
+   {
+      Q14(-3.9769e-05), Q14(0.000137153), Q14(-0.000341784), Q14(0.000720343),
+      Q14(-0.00136229), Q14(0.00238275), Q14(-0.00392561), Q14(0.00616788),
+      Q14(-0.00932794), Q14(0.0136823), Q14(-0.0196006), Q14(0.0276206),
+      Q14(-0.0386138), Q14(0.0541846), Q14(-0.0777717), Q14(0.118446),
+      Q14(-0.210324), Q14(0.685603), Q14(0.581486), Q14(-0.198534),
+      Q14(0.114017), Q14(-0.0753951), Q14(0.0526791), Q14(-0.0375738),
+      Q14(0.0268694), Q14(-0.0190475), Q14(0.013274), Q14(-0.00902942),
+      Q14(0.0059537), Q14(-0.00377608), Q14(0.00228201), Q14(-0.00129743),
+      Q14(0.000680936), Q14(-0.000319601), Q14(0.000125937), Q14(-3.4989e-05)
+   },
+   {
+      Q14(-3.94554e-05), Q14(0.000136536), Q14(-0.000340751), Q14(0.000718806),
+      Q14(-0.00136022), Q14(0.00238023), Q14(-0.00392286), Q14(0.00616534),
+      Q14(-0.00932627), Q14(0.0136823), Q14(-0.0196034), Q14(0.0276269),
+      Q14(-0.0386234), Q14(0.0541938), Q14(-0.0777658), Q14(0.118365),
+      Q14(-0.209822), Q14(0.677245), Q14(0.590439), Q14(-0.199974),
+      Q14(0.114665), Q14(-0.0757803), Q14(0.0529361), Q14(-0.0377546),
+      Q14(0.0269994), Q14(-0.0191413), Q14(0.0133413), Q14(-0.00907688),
+      Q14(0.00598641), Q14(-0.00379793), Q14(0.00229607), Q14(-0.00130603),
+      Q14(0.000685883), Q14(-0.000322219), Q14(0.000127166), Q14(-3.54623e-05)
+   },
+   {
+      Q14(-3.91247e-05), Q14(0.000135857), Q14(-0.000339562), Q14(0.000716936),
+      Q14(-0.00135752), Q14(0.0023766), Q14(-0.00391829), Q14(0.00615995),
+      Q14(-0.00932028), Q14(0.0136761), Q14(-0.0195971), Q14(0.0276204),
+      Q14(-0.0386151), Q14(0.0541781), Q14(-0.0777241), Q14(0.11823),
+      Q14(-0.209228), Q14(0.668821), Q14(0.599349), Q14(-0.201335),
+      Q14(0.115264), Q14(-0.0761325), Q14(0.0531699), Q14(-0.0379186),
+      Q14(0.0271174), Q14(-0.0192267), Q14(0.0134026), Q14(-0.00912035),
+      Q14(0.00601651), Q14(-0.00381815), Q14(0.00230913), Q14(-0.00131408),
+      Q14(0.000690544), Q14(-0.000324706), Q14(0.000128346), Q14(-3.59237e-05)
+   },
+   {
+      Q14(-3.87772e-05), Q14(0.000135118), Q14(-0.000338219), Q14(0.000714739),
+      Q14(-0.0013542), Q14(0.00237188), Q14(-0.00391192), Q14(0.00615171),
+      Q14(-0.00931), Q14(0.0136635), Q14(-0.0195818), Q14(0.0276013),
+      Q14(-0.0385891), Q14(0.0541374), Q14(-0.077647), Q14(0.118041),
+      Q14(-0.208544), Q14(0.660335), Q14(0.608214), Q14(-0.202615),
+      Q14(0.115813), Q14(-0.0764514), Q14(0.0533801), Q14(-0.0380659),
+      Q14(0.0272233), Q14(-0.0193035), Q14(0.0134581), Q14(-0.00915981),
+      Q14(0.00604396), Q14(-0.00383669), Q14(0.0023212), Q14(-0.00132157),
+      Q14(0.000694914), Q14(-0.000327059), Q14(0.000129475), Q14(-3.63727e-05)
+   },
+   {
+      Q14(-3.84137e-05), Q14(0.000134319), Q14(-0.000336723), Q14(0.000712218),
+      Q14(-0.00135026), Q14(0.00236607), Q14(-0.00390376), Q14(0.00614066),
+      Q14(-0.00929545), Q14(0.0136447), Q14(-0.0195575), Q14(0.0275694),
+      Q14(-0.0385454), Q14(0.0540721), Q14(-0.0775345), Q14(0.1178),
+      Q14(-0.207771), Q14(0.651787), Q14(0.617033), Q14(-0.203815),
+      Q14(0.116313), Q14(-0.0767365), Q14(0.0535666), Q14(-0.0381962),
+      Q14(0.0273172), Q14(-0.0193718), Q14(0.0135076), Q14(-0.00919521),
+      Q14(0.00606875), Q14(-0.00385355), Q14(0.00233225), Q14(-0.00132848),
+      Q14(0.000698986), Q14(-0.000329275), Q14(0.000130553), Q14(-3.68089e-05)
+   },
+   {
+      Q14(-3.80345e-05), Q14(0.000133461), Q14(-0.000335079), Q14(0.000709378),
+      Q14(-0.00134571), Q14(0.0023592), Q14(-0.00389383), Q14(0.00612682),
+      Q14(-0.00927666), Q14(0.0136196), Q14(-0.0195243), Q14(0.027525),
+      Q14(-0.0384842), Q14(0.0539822), Q14(-0.077387), Q14(0.117506),
+      Q14(-0.206911), Q14(0.643181), Q14(0.625801), Q14(-0.204931),
+      Q14(0.116762), Q14(-0.0769877), Q14(0.0537293), Q14(-0.0383095),
+      Q14(0.0273988), Q14(-0.0194314), Q14(0.0135511), Q14(-0.00922651),
+      Q14(0.00609084), Q14(-0.00386871), Q14(0.00234227), Q14(-0.00133481),
+      Q14(0.000702758), Q14(-0.000331352), Q14(0.000131577), Q14(-3.72316e-05)
+   },
+   {
+      Q14(-3.76403e-05), Q14(0.000132547), Q14(-0.000333288), Q14(0.000706223),
+      Q14(-0.00134056), Q14(0.00235126), Q14(-0.00388214), Q14(0.0061102),
+      Q14(-0.00925367), Q14(0.0135884), Q14(-0.0194823), Q14(0.0274681),
+      Q14(-0.0384055), Q14(0.0538679), Q14(-0.0772046), Q14(0.117159),
+      Q14(-0.205964), Q14(0.634518), Q14(0.634518), Q14(-0.205964),
+      Q14(0.117159), Q14(-0.0772046), Q14(0.0538679), Q14(-0.0384055),
+      Q14(0.0274681), Q14(-0.0194823), Q14(0.0135884), Q14(-0.00925367),
+      Q14(0.0061102), Q14(-0.00388214), Q14(0.00235126), Q14(-0.00134056),
+      Q14(0.000706223), Q14(-0.000333288), Q14(0.000132547), Q14(-3.76403e-05)
+   }
+};
+
+#undef Q14
@@ -0,0 +1,119 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+#include "x86/x86cpu.h"
+#include "../mlp.h"
+#include "../tansig_table.h"
+#include "mlp_sse.h"
+
+/* Uses FMA, so the output can differ from gemm_accum_c() in the last bit. */
+void gemm_accum_avx2(float *out, const opus_int8 *weights, int rows, int cols, int col_stride, const float *x)
+{
+   int i, j;
+   for (i=0;i<rows-15;i+=16)
+   {
+      __m256 y0, y1;
+      y0 = _mm256_loadu_ps(&out[i]);
+      y1 = _mm256_loadu_ps(&out[i+8]);
+      for (j=0;j<cols;j++)
+      {
+         __m128i w;
+         __m256 xj;
+         xj = _mm256_set1_ps(x[j]);
+         w = _mm_loadu_si128((const __m128i *)&weights[j*col_stride + i]);
+         y0 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(w)), xj, y0);
+         y1 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(w, 8))), xj, y1);
+      }
+      _mm256_storeu_ps(&out[i], y0);
+      _mm256_storeu_ps(&out[i+8], y1);
+   }
+   for (;i<rows-7;i+=8)
+   {
+      __m256 y0;
+      y0 = _mm256_loadu_ps(&out[i]);
+      for (j=0;j<cols;j++)
+      {
+         __m128i w;
+         w = _mm_loadl_epi64((const __m128i *)&weights[j*col_stride + i]);
+         y0 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(w)), _mm256_set1_ps(x[j]), y0);
+      }
+      _mm256_storeu_ps(&out[i], y0);
+   }
+   if (i<rows)
+      gemm_accum_c(&out[i], &weights[i], rows-i, cols, col_stride, x);
+}
+
+/* Same approximation as tansig_approx(), with the table lookup done by a
+   gather. */
+static OPUS_INLINE __m256 tansig8_avx2(__m256 x)
+{
+   __m256 sign, ax, inrange, xr, y, dy, one;
+   __m256i idx;
+   one = _mm256_set1_ps(1.f);
+   sign = _mm256_and_ps(_mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_set1_ps(-0.f));
+   ax = _mm256_xor_ps(x, sign);
+   inrange = _mm256_and_ps(_mm256_cmp_ps(x, _mm256_set1_ps(8.f), _CMP_LT_OQ),
+         _mm256_cmp_ps(x, _mm256_set1_ps(-8.f), _CMP_GT_OQ));
+   ax = _mm256_and_ps(ax, inrange);
+   idx = _mm256_cvttps_epi32(_mm256_fmadd_ps(_mm256_set1_ps(25.f), ax, _mm256_set1_ps(.5f)));
+   xr = _mm256_fnmadd_ps(_mm256_set1_ps(.04f), _mm256_cvtepi32_ps(idx), ax);
+   y = _mm256_i32gather_ps(tansig_table, idx, 4);
+   dy = _mm256_fnmadd_ps(y, y, one);
+   y = _mm256_fmadd_ps(_mm256_mul_ps(xr, dy), _mm256_fnmadd_ps(y, xr, one), y);
+   y = _mm256_xor_ps(y, sign);
+   /* Out of range: x <= -8 gives -1, anything else (x >= 8 or NaN) gives 1. */
+   return _mm256_blendv_ps(_mm256_blendv_ps(one, _mm256_set1_ps(-1.f),
+         _mm256_cmp_ps(x, _mm256_set1_ps(-8.f), _CMP_LE_OQ)), y, inrange);
+}
+
+void vec_tansig_avx2(float *y, const float *x, int N)
+{
+   int i;
+   for (i=0;i<N-7;i+=8)
+      _mm256_storeu_ps(&y[i], tansig8_avx2(_mm256_loadu_ps(&x[i])));
+   if (i<N)
+      vec_tansig_c(&y[i], &x[i], N-i);
+}
+
+void vec_sigmoid_avx2(float *y, const float *x, int N)
+{
+   int i;
+   __m256 half;
+   half = _mm256_set1_ps(.5f);
+   for (i=0;i<N-7;i+=8)
+   {
+      __m256 t;
+      t = tansig8_avx2(_mm256_mul_ps(half, _mm256_loadu_ps(&x[i])));
+      _mm256_storeu_ps(&y[i], _mm256_fmadd_ps(half, t, half));
+   }
+   if (i<N)
+      vec_sigmoid_c(&y[i], &x[i], N-i);
+}
@@ -0,0 +1,80 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef MLP_SSE_H
+#define MLP_SSE_H
+
+#include "cpu_support.h"
+#include "x86/x86cpu.h"
+
+#if defined(OPUS_X86_MAY_HAVE_SSE4_1) || defined(OPUS_X86_MAY_HAVE_AVX2)
+#define OVERRIDE_GEMM_ACCUM
+#define OVERRIDE_VEC_TANSIG
+
+#if defined(OPUS_X86_MAY_HAVE_SSE4_1)
+void gemm_accum_sse4_1(float *out, const opus_int8 *weights, int rows, int cols, int col_stride, const float *x);
+void vec_tansig_sse4_1(float *y, const float *x, int N);
+void vec_sigmoid_sse4_1(float *y, const float *x, int N);
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_AVX2)
+void gemm_accum_avx2(float *out, const opus_int8 *weights, int rows, int cols, int col_stride, const float *x);
+void vec_tansig_avx2(float *y, const float *x, int N);
+void vec_sigmoid_avx2(float *y, const float *x, int N);
+#endif
+
+#if defined(OPUS_X86_PRESUME_AVX2)
+
+#define gemm_accum(out, weights, rows, cols, col_stride, x, arch) \
+    ((void)(arch), gemm_accum_avx2(out, weights, rows, cols, col_stride, x))
+#define vec_tansig(y, x, N, arch) ((void)(arch), vec_tansig_avx2(y, x, N))
+#define vec_sigmoid(y, x, N, arch) ((void)(arch), vec_sigmoid_avx2(y, x, N))
+
+#elif defined(OPUS_X86_PRESUME_SSE4_1) && !defined(OPUS_X86_MAY_HAVE_AVX2)
+
+#define gemm_accum(out, weights, rows, cols, col_stride, x, arch) \
+    ((void)(arch), gemm_accum_sse4_1(out, weights, rows, cols, col_stride, x))
+#define vec_tansig(y, x, N, arch) ((void)(arch), vec_tansig_sse4_1(y, x, N))
+#define vec_sigmoid(y, x, N, arch) ((void)(arch), vec_sigmoid_sse4_1(y, x, N))
+
+#else
+
+extern void (*const GEMM_ACCUM_IMPL[OPUS_ARCHMASK + 1])(float *out,
+      const opus_int8 *weights, int rows, int cols, int col_stride, const float *x);
+extern void (*const VEC_TANSIG_IMPL[OPUS_ARCHMASK + 1])(float *y, const float *x, int N);
+extern void (*const VEC_SIGMOID_IMPL[OPUS_ARCHMASK + 1])(float *y, const float *x, int N);
+
+#define gemm_accum(out, weights, rows, cols, col_stride, x, arch) \
+    ((*GEMM_ACCUM_IMPL[(arch) & OPUS_ARCHMASK])(out, weights, rows, cols, col_stride, x))
+#define vec_tansig(y, x, N, arch) \
+    ((*VEC_TANSIG_IMPL[(arch) & OPUS_ARCHMASK])(y, x, N))
+#define vec_sigmoid(y, x, N, arch) \
+    ((*VEC_SIGMOID_IMPL[(arch) & OPUS_ARCHMASK])(y, x, N))
+
+#endif
+#endif
+
+#endif
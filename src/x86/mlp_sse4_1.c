@@ -0,0 +1,131 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <smmintrin.h>
+#include "x86/x86cpu.h"
+#include "../mlp.h"
+#include "../tansig_table.h"
+#include "mlp_sse.h"
+
+/* Same operation order as gemm_accum_c(), without FMA, so the result is
+   bit-exact with the C code. The weights are stored column-major, so each
+   input contributes a contiguous run of int8 weights to the rows. */
+void gemm_accum_sse4_1(float *out, const opus_int8 *weights, int rows, int cols, int col_stride, const float *x)
+{
+   int i, j;
+   for (i=0;i<rows-15;i+=16)
+   {
+      __m128 y0, y1, y2, y3;
+      y0 = _mm_loadu_ps(&out[i]);
+      y1 = _mm_loadu_ps(&out[i+4]);
+      y2 = _mm_loadu_ps(&out[i+8]);
+      y3 = _mm_loadu_ps(&out[i+12]);
+      for (j=0;j<cols;j++)
+      {
+         __m128i w;
+         __m128 xj;
+         const opus_int8 *wj = &weights[j*col_stride + i];
+         xj = _mm_set1_ps(x[j]);
+         w = _mm_loadu_si128((const __m128i *)wj);
+         y0 = _mm_add_ps(y0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(w)), xj));
+         y1 = _mm_add_ps(y1, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(w, 4))), xj));
+         y2 = _mm_add_ps(y2, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(w, 8))), xj));
+         y3 = _mm_add_ps(y3, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(w, 12))), xj));
+      }
+      _mm_storeu_ps(&out[i], y0);
+      _mm_storeu_ps(&out[i+4], y1);
+      _mm_storeu_ps(&out[i+8], y2);
+      _mm_storeu_ps(&out[i+12], y3);
+   }
+   for (;i<rows-3;i+=4)
+   {
+      __m128 y0;
+      y0 = _mm_loadu_ps(&out[i]);
+      for (j=0;j<cols;j++)
+      {
+         __m128i w;
+         w = OP_CVTEPI8_EPI32_M32(&weights[j*col_stride + i]);
+         y0 = _mm_add_ps(y0, _mm_mul_ps(_mm_cvtepi32_ps(w), _mm_set1_ps(x[j])));
+      }
+      _mm_storeu_ps(&out[i], y0);
+   }
+   if (i<rows)
+      gemm_accum_c(&out[i], &weights[i], rows-i, cols, col_stride, x);
+}
+
+/* Vector version of tansig_approx(), including its handling of the
+   saturated range and of NaNs (which map to 1). */
+static OPUS_INLINE __m128 tansig4_sse4_1(__m128 x)
+{
+   __m128 sign, ax, inrange, xr, y, dy, one;
+   __m128i idx;
+   opus_int32 ibuf[4];
+   one = _mm_set1_ps(1.f);
+   sign = _mm_and_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_set1_ps(-0.f));
+   ax = _mm_xor_ps(x, sign);
+   inrange = _mm_and_ps(_mm_cmplt_ps(x, _mm_set1_ps(8.f)),
+         _mm_cmpgt_ps(x, _mm_set1_ps(-8.f)));
+   ax = _mm_and_ps(ax, inrange);
+   idx = _mm_cvttps_epi32(_mm_add_ps(_mm_set1_ps(.5f), _mm_mul_ps(_mm_set1_ps(25.f), ax)));
+   xr = _mm_sub_ps(ax, _mm_mul_ps(_mm_set1_ps(.04f), _mm_cvtepi32_ps(idx)));
+   _mm_storeu_si128((__m128i *)ibuf, idx);
+   y = _mm_setr_ps(tansig_table[ibuf[0]], tansig_table[ibuf[1]],
+         tansig_table[ibuf[2]], tansig_table[ibuf[3]]);
+   dy = _mm_sub_ps(one, _mm_mul_ps(y, y));
+   y = _mm_add_ps(y, _mm_mul_ps(_mm_mul_ps(xr, dy), _mm_sub_ps(one, _mm_mul_ps(y, xr))));
+   y = _mm_xor_ps(y, sign);
+   /* Out of range: x <= -8 gives -1, anything else (x >= 8 or NaN) gives 1. */
+   return _mm_blendv_ps(_mm_blendv_ps(one, _mm_set1_ps(-1.f),
+         _mm_cmple_ps(x, _mm_set1_ps(-8.f))), y, inrange);
+}
+
+void vec_tansig_sse4_1(float *y, const float *x, int N)
+{
+   int i;
+   for (i=0;i<N-3;i+=4)
+      _mm_storeu_ps(&y[i], tansig4_sse4_1(_mm_loadu_ps(&x[i])));
+   if (i<N)
+      vec_tansig_c(&y[i], &x[i], N-i);
+}
+
+void vec_sigmoid_sse4_1(float *y, const float *x, int N)
+{
+   int i;
+   __m128 half;
+   half = _mm_set1_ps(.5f);
+   for (i=0;i<N-3;i+=4)
+   {
+      __m128 t;
+      t = tansig4_sse4_1(_mm_mul_ps(half, _mm_loadu_ps(&x[i])));
+      _mm_storeu_ps(&y[i], _mm_add_ps(half, _mm_mul_ps(half, t)));
+   }
+   if (i<N)
+      vec_sigmoid_c(&y[i], &x[i], N-i);
+}
@@ -0,0 +1,1438 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Throughput benchmarks for the full codec and for its hot DSP stages.
+   Results are written to stdout as a single JSON document so that runs can
+   be compared across releases, build configurations and arch levels. This
+   program uses private symbols, so it must be linked against the library
+   objects rather than the shared library. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "opus.h"
+#include "opus_custom.h"
+#include "opus_group.h"
+#include "opus_transrater.h"
+#include "opus_probe.h"
+#include "../src/opus_private.h"
+#include "arch.h"
+#include "os_support.h"
+#include "cpu_support.h"
+#include "modes.h"
+#include "mdct.h"
+#include "kiss_fft.h"
+#include "vq.h"
+#include "pitch.h"
+#include "main.h"
+#ifndef FIXED_POINT
+#include "float/main_FLP.h"
+#endif
+#ifndef DISABLE_FLOAT_API
+#include "../src/mlp.h"
+#endif
+
+#define BENCH_REPS 5
+#define MAX_PACKET 1500
+#define SIGNAL_SECONDS 2
+
+static double min_time_ns = 2e8;
+static const char *filter = NULL;
+static int arch = 0;
+static int nb_results = 0;
+
+static double bench_now_ns(void)
+{
+#if defined(_WIN32)
+   LARGE_INTEGER freq, count;
+   QueryPerformanceFrequency(&freq);
+   QueryPerformanceCounter(&count);
+   return (double)count.QuadPart*1e9/(double)freq.QuadPart;
+#else
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (double)ts.tv_sec*1e9 + (double)ts.tv_nsec;
+#endif
+}
+
+static opus_uint32 bench_seed = 0x6b8b4567;
+static int bench_rand(void)
+{
+   bench_seed = bench_seed*1664525 + 1013904223;
+   return (int)(bench_seed>>16);
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+   double x = *(const double*)a;
+   double y = *(const double*)b;
+   return (x > y) - (x < y);
+}
+
+typedef void (*bench_func)(void *ctx);
+
+/* Times f(ctx), scaling the iteration count until one repetition takes
+   min_time_ns/BENCH_REPS, and reports the fastest and the median
+   repetition. params is a JSON object body. frame_ns, when non-zero, is the
+   duration of audio processed per call, used to report a real-time factor. */
+static void run_bench(const char *group, const char *name, const char *params,
+      bench_func f, void *ctx, double frame_ns)
+{
+   double samples[BENCH_REPS];
+   double elapsed;
+   long iters, i;
+   int r;
+   char full[256];
+
+   snprintf(full, sizeof(full), "%s/%s", group, name);
+   if (filter && !strstr(full, filter))
+      return;
+   f(ctx);
+   iters = 1;
+   for (;;)
+   {
+      double t0 = bench_now_ns();
+      for (i=0;i<iters;i++)
+         f(ctx);
+      elapsed = bench_now_ns() - t0;
+      if (elapsed >= min_time_ns/BENCH_REPS || iters >= (1L<<30))
+         break;
+      if (elapsed < 1e3)
+         iters *= 16;
+      else
+         iters = (long)(iters*1.2*(min_time_ns/BENCH_REPS)/elapsed) + 1;
+   }
+   for (r=0;r<BENCH_REPS;r++)
+   {
+      double t0 = bench_now_ns();
+      for (i=0;i<iters;i++)
+         f(ctx);
+      samples[r] = (bench_now_ns() - t0)/iters;
+   }
+   qsort(samples, BENCH_REPS, sizeof(samples[0]), cmp_double);
+   printf("%s\n    {\"group\": \"%s\", \"name\": \"%s\", \"params\": {%s}, "
+          "\"iterations\": %ld, \"ns_per_op\": %.1f, \"ns_median\": %.1f",
+          nb_results ? "," : "", group, name, params, iters,
+          samples[0], samples[BENCH_REPS/2]);
+   if (frame_ns > 0)
+      printf(", \"realtime_x\": %.2f", frame_ns/samples[0]);
+   printf("}");
+   fflush(stdout);
+   nb_results++;
+}
+
+/* Full encoder and decoder */
+
+typedef struct {
+   OpusEncoder *enc;
+   OpusDecoder *dec;
+   const opus_int16 *pcm;
+   int channels;
+   int frame_size;
+   int pos;
+   int total;
+   unsigned char packet[MAX_PACKET];
+   unsigned char *packets;
+   opus_int32 *len;
+   int nb_packets;
+   int pkt;
+   int loss_period;
+   opus_int16 *out;
+} CodecBench;
+
+static void bench_encode(void *ctx)
+{
+   CodecBench *b = (CodecBench*)ctx;
+   if (b->pos + b->frame_size > b->total)
+      b->pos = 0;
+   if (opus_encode(b->enc, b->pcm + b->pos*b->channels, b->frame_size,
+         b->packet, MAX_PACKET) < 0)
+   {
+      fprintf(stderr, "opus_encode() failed\n");
+      exit(EXIT_FAILURE);
+   }
+   b->pos += b->frame_size;
+}
+
+static void bench_decode(void *ctx)
+{
+   CodecBench *b = (CodecBench*)ctx;
+   const unsigned char *data;
+   if (b->pkt == b->nb_packets)
+      b->pkt = 0;
+   data = b->packets + b->pkt*MAX_PACKET;
+   /* Drop one packet out of every loss_period to run the concealment. */
+   if (b->loss_period && b->pkt%b->loss_period == b->loss_period-1)
+      data = NULL;
+   if (opus_decode(b->dec, data, b->len[b->pkt],
+         b->out, b->frame_size, 0) != b->frame_size)
+   {
+      fprintf(stderr, "opus_decode() failed\n");
+      exit(EXIT_FAILURE);
+   }
+   b->pkt++;
+}
+
+static opus_int16 *generate_signal(int channels, int total)
+{
+   opus_int16 *pcm;
+   int i, c;
+   double phase[2] = {0, 0};
+   pcm = (opus_int16*)malloc(sizeof(*pcm)*total*channels);
+   if (!pcm)
+      return NULL;
+   for (i=0;i<total;i++)
+   {
+      /* A slowly sweeping tone with harmonics and a little noise, so that
+         the encoder exercises its usual transient and tonal decisions. */
+      double f0 = 110 + 330*(0.5 + 0.5*sin(2*M_PI*i/(48000.*1.3)));
+      for (c=0;c<channels;c++)
+      {
+         double v;
+         phase[c] += 2*M_PI*f0*(1 + 0.01*c)/48000.;
+         v = 6000*sin(phase[c]) + 3000*sin(2*phase[c]) + 1500*sin(3*phase[c]);
+         if ((i/4800)%3 == 2)
+            v *= (i%4800) < 480 ? 1.5 : 0.3;
+         v += (bench_rand()&1023) - 512;
+         pcm[i*channels+c] = (opus_int16)v;
+      }
+   }
+   return pcm;
+}
+
+static void bench_codec(void)
+{
+   static const struct {
+      const char *name;
+      int mode;
+      int channels;
+      int bandwidth;
+      int bitrates[2];
+      int frame_ms10[4];
+   } modes[3] = {
+      {"silk", MODE_SILK_ONLY, 1, OPUS_BANDWIDTH_WIDEBAND, {12000, 24000}, {100, 200, 600, 0}},
+      {"hybrid", MODE_HYBRID, 2, OPUS_BANDWIDTH_FULLBAND, {32000, 64000}, {100, 200, 0, 0}},
+      {"celt", MODE_CELT_ONLY, 2, OPUS_BANDWIDTH_FULLBAND, {64000, 128000}, {25, 50, 100, 200}}
+   };
+   static const int complexities[3] = {0, 5, 10};
+   opus_int16 *pcm[2];
+   int total = 48000*SIGNAL_SECONDS;
+   int m, r, f, k;
+
+   pcm[0] = generate_signal(1, total);
+   pcm[1] = generate_signal(2, total);
+   if (!pcm[0] || !pcm[1])
+   {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+   }
+   for (m=0;m<3;m++)
+   {
+      for (r=0;r<2;r++)
+      {
+         for (f=0;f<4 && modes[m].frame_ms10[f];f++)
+         {
+            CodecBench b;
+            char params[256];
+            int err;
+            int channels = modes[m].channels;
+            int frame_size = 48*modes[m].frame_ms10[f]/10;
+            double frame_ns = modes[m].frame_ms10[f]*1e5;
+
+            memset(&b, 0, sizeof(b));
+            b.pcm = pcm[channels-1];
+            b.channels = channels;
+            b.frame_size = frame_size;
+            b.total = total;
+            b.enc = opus_encoder_create(48000, channels, OPUS_APPLICATION_AUDIO, &err);
+            b.dec = opus_decoder_create(48000, channels, &err);
+            b.nb_packets = total/frame_size;
+            b.packets = (unsigned char*)malloc(MAX_PACKET*b.nb_packets);
+            b.len = (opus_int32*)malloc(sizeof(*b.len)*b.nb_packets);
+            b.out = (opus_int16*)malloc(sizeof(*b.out)*frame_size*channels);
+            if (!b.enc || !b.dec || !b.packets || !b.len || !b.out)
+            {
+               fprintf(stderr, "Out of memory\n");
+               exit(EXIT_FAILURE);
+            }
+            opus_encoder_ctl(b.enc, OPUS_SET_FORCE_MODE(modes[m].mode));
+            opus_encoder_ctl(b.enc, OPUS_SET_BANDWIDTH(modes[m].bandwidth));
+            opus_encoder_ctl(b.enc, OPUS_SET_BITRATE(modes[m].bitrates[r]));
+            for (k=0;k<3;k++)
+            {
+               opus_encoder_ctl(b.enc, OPUS_RESET_STATE);
+               opus_encoder_ctl(b.enc, OPUS_SET_COMPLEXITY(complexities[k]));
+               b.pos = 0;
+               snprintf(params, sizeof(params),
+                     "\"mode\": \"%s\", \"channels\": %d, \"bitrate\": %d, "
+                     "\"complexity\": %d, \"frame_ms\": %.1f",
+                     modes[m].name, channels, modes[m].bitrates[r],
+                     complexities[k], modes[m].frame_ms10[f]/10.);
+               run_bench("codec", "encode", params, bench_encode, &b, frame_ns);
+            }
+            /* Decode the packets of the highest complexity. */
+            opus_encoder_ctl(b.enc, OPUS_RESET_STATE);
+            for (k=0;k<b.nb_packets;k++)
+            {
+               b.len[k] = opus_encode(b.enc, b.pcm + k*frame_size*channels,
+                     frame_size, b.packets + k*MAX_PACKET, MAX_PACKET);
+               if (b.len[k] < 0)
+               {
+                  fprintf(stderr, "opus_encode() failed: %s\n", opus_strerror(b.len[k]));
+                  exit(EXIT_FAILURE);
+               }
+            }
+            snprintf(params, sizeof(params),
+                  "\"mode\": \"%s\", \"channels\": %d, \"bitrate\": %d, "
+                  "\"frame_ms\": %.1f",
+                  modes[m].name, channels, modes[m].bitrates[r],
+                  modes[m].frame_ms10[f]/10.);
+            run_bench("codec", "decode", params, bench_decode, &b, frame_ns);
+            if (modes[m].mode == MODE_CELT_ONLY)
+            {
+               opus_decoder_ctl(b.dec, OPUS_RESET_STATE);
+               b.pkt = 0;
+               b.loss_period = 2;
+               run_bench("codec", "decode_plc", params, bench_decode, &b, frame_ns);
+            }
+            opus_encoder_destroy(b.enc);
+            opus_decoder_destroy(b.dec);
+            free(b.packets);
+            free(b.len);
+            free(b.out);
+         }
+      }
+   }
+   free(pcm[0]);
+   free(pcm[1]);
+}
+
+/* Bitrate ladder: the same input encoded at several bitrates, either with
+   independent encoders or with a group encoder sharing the analysis. */
+
+#define LADDER_SIZE 3
+
+typedef struct {
+   OpusGroupEncoder *group;
+   OpusEncoder *enc[LADDER_SIZE];
+   const opus_int16 *pcm;
+   int frame_size;
+   int pos;
+   int total;
+   unsigned char packets[LADDER_SIZE*MAX_PACKET];
+   opus_int32 len[LADDER_SIZE];
+} LadderBench;
+
+static void bench_ladder_encode(void *ctx)
+{
+   LadderBench *b = (LadderBench*)ctx;
+   int r;
+   if (b->pos + b->frame_size > b->total)
+      b->pos = 0;
+   for (r=0;r<LADDER_SIZE;r++)
+   {
+      if (opus_encode(b->enc[r], b->pcm + 2*b->pos, b->frame_size,
+            b->packets + r*MAX_PACKET, MAX_PACKET) < 0)
+      {
+         fprintf(stderr, "opus_encode() failed\n");
+         exit(EXIT_FAILURE);
+      }
+   }
+   b->pos += b->frame_size;
+}
+
+static void bench_group_encode(void *ctx)
+{
+   LadderBench *b = (LadderBench*)ctx;
+   if (b->pos + b->frame_size > b->total)
+      b->pos = 0;
+   if (opus_group_encode(b->group, b->pcm + 2*b->pos, b->frame_size,
+         b->packets, MAX_PACKET, b->len) != OPUS_OK)
+   {
+      fprintf(stderr, "opus_group_encode() failed\n");
+      exit(EXIT_FAILURE);
+   }
+   b->pos += b->frame_size;
+}
+
+static void bench_ladder(void)
+{
+   static const opus_int32 rates[LADDER_SIZE] = {32000, 64000, 128000};
+   LadderBench *b;
+   opus_int16 *pcm;
+   const char *params = "\"channels\": 2, \"bitrates\": [32000, 64000, 128000], "
+         "\"complexity\": 10, \"frame_ms\": 20.0";
+   int total = 48000*SIGNAL_SECONDS;
+   int err, r;
+
+   b = (LadderBench*)calloc(1, sizeof(*b));
+   pcm = generate_signal(2, total);
+   if (!b || !pcm)
+   {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+   }
+   b->pcm = pcm;
+   b->total = total;
+   b->frame_size = 960;
+   b->group = opus_group_encoder_create(48000, 2, LADDER_SIZE, rates,
+         OPUS_APPLICATION_AUDIO, &err);
+   if (!b->group)
+   {
+      fprintf(stderr, "opus_group_encoder_create() failed: %s\n", opus_strerror(err));
+      exit(EXIT_FAILURE);
+   }
+   opus_group_encoder_ctl(b->group, OPUS_SET_COMPLEXITY(10));
+   for (r=0;r<LADDER_SIZE;r++)
+   {
+      b->enc[r] = opus_encoder_create(48000, 2, OPUS_APPLICATION_AUDIO, &err);
+      if (!b->enc[r])
+      {
+         fprintf(stderr, "opus_encoder_create() failed: %s\n", opus_strerror(err));
+         exit(EXIT_FAILURE);
+      }
+      opus_encoder_ctl(b->enc[r], OPUS_SET_BITRATE(rates[r]));
+      opus_encoder_ctl(b->enc[r], OPUS_SET_COMPLEXITY(10));
+   }
+   run_bench("codec", "ladder_encode", params, bench_ladder_encode, b, 2e7);
+   b->pos = 0;
+   run_bench("codec", "group_encode", params, bench_group_encode, b, 2e7);
+   for (r=0;r<LADDER_SIZE;r++)
+      opus_encoder_destroy(b->enc[r]);
+   opus_group_encoder_destroy(b->group);
+   free(pcm);
+   free(b);
+}
+
+/* Many independent streams, as on a conferencing server: one frame of each
+   encoded with a loop over opus_encode(). The configurations alternate
+   between SILK, hybrid and CELT, so the encoder switches mode on every
+   call. The real-time factor is reported for all the streams together, so
+   it reads as streams per core. */
+
+#define BATCH_SIZE 24
+
+typedef struct {
+   OpusEncoder *enc[BATCH_SIZE];
+   const opus_int16 *pcm[BATCH_SIZE];
+   opus_int16 *signal[2];
+   int channels[BATCH_SIZE];
+   int frame_size;
+   int pos;
+   int total;
+   unsigned char *data[BATCH_SIZE];
+   opus_int32 max_data_bytes[BATCH_SIZE];
+} BatchBench;
+
+static void batch_bench_advance(BatchBench *b)
+{
+   int i;
+   if (b->pos + b->frame_size > b->total)
+      b->pos = 0;
+   for (i=0;i<BATCH_SIZE;i++)
+      b->pcm[i] = b->signal[b->channels[i]-1] + b->pos*b->channels[i];
+   b->pos += b->frame_size;
+}
+
+static void bench_encode_loop(void *ctx)
+{
+   BatchBench *b = (BatchBench*)ctx;
+   int i;
+   batch_bench_advance(b);
+   for (i=0;i<BATCH_SIZE;i++)
+   {
+      if (opus_encode(b->enc[i], b->pcm[i], b->frame_size, b->data[i],
+            b->max_data_bytes[i]) < 0)
+      {
+         fprintf(stderr, "opus_encode() failed\n");
+         exit(EXIT_FAILURE);
+      }
+   }
+}
+
+static void bench_encode_streams(void)
+{
+   static const struct {
+      int mode;
+      int channels;
+      int bandwidth;
+      opus_int32 bitrate;
+   } configs[3] = {
+      {MODE_SILK_ONLY, 1, OPUS_BANDWIDTH_WIDEBAND, 16000},
+      {MODE_HYBRID, 1, OPUS_BANDWIDTH_FULLBAND, 32000},
+      {MODE_CELT_ONLY, 2, OPUS_BANDWIDTH_FULLBAND, 96000}
+   };
+   static const int complexities[2] = {5, 10};
+   BatchBench *b;
+   unsigned char *packets;
+   int total = 48000*SIGNAL_SECONDS;
+   int err, i, k;
+
+   b = (BatchBench*)calloc(1, sizeof(*b));
+   packets = (unsigned char*)malloc(BATCH_SIZE*MAX_PACKET);
+   if (!b || !packets)
+   {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+   }
+   b->signal[0] = generate_signal(1, total);
+   b->signal[1] = generate_signal(2, total);
+   if (!b->signal[0] || !b->signal[1])
+   {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+   }
+   b->total = total;
+   b->frame_size = 960;
+   for (i=0;i<BATCH_SIZE;i++)
+   {
+      int c = i%3;
+      b->channels[i] = configs[c].channels;
+      b->data[i] = packets + i*MAX_PACKET;
+      b->max_data_bytes[i] = MAX_PACKET;
+      b->enc[i] = opus_encoder_create(48000, configs[c].channels,
+            OPUS_APPLICATION_AUDIO, &err);
+      if (!b->enc[i])
+      {
+         fprintf(stderr, "opus_encoder_create() failed: %s\n", opus_strerror(err));
+         exit(EXIT_FAILURE);
+      }
+      opus_encoder_ctl(b->enc[i], OPUS_SET_FORCE_MODE(configs[c].mode));
+      opus_encoder_ctl(b->enc[i], OPUS_SET_BANDWIDTH(configs[c].bandwidth));
+      opus_encoder_ctl(b->enc[i], OPUS_SET_BITRATE(configs[c].bitrate));
+   }
+   for (k=0;k<2;k++)
+   {
+      char params[256];
+      snprintf(params, sizeof(params),
+            "\"streams\": %d, \"modes\": [\"silk\", \"hybrid\", \"celt\"], "
+            "\"complexity\": %d, \"frame_ms\": 20.0", BATCH_SIZE, complexities[k]);
+      for (i=0;i<BATCH_SIZE;i++)
+      {
+         opus_encoder_ctl(b->enc[i], OPUS_RESET_STATE);
+         opus_encoder_ctl(b->enc[i], OPUS_SET_COMPLEXITY(complexities[k]));
+      }
+      b->pos = 0;
+      run_bench("codec", "encode_loop", params, bench_encode_loop, b,
+            BATCH_SIZE*2e7);
+   }
+   for (i=0;i<BATCH_SIZE;i++)
+      opus_encoder_destroy(b->enc[i]);
+   free(b->signal[0]);
+   free(b->signal[1]);
+   free(packets);
+   free(b);
+}
+
+/* The decoding side of a conferencing server: one CELT frame of each of
+   BATCH_SIZE streams, alternately mono at 64 kb/s and stereo at 96 kb/s,
+   decoded with a plain loop over opus_decode() or with opus_decode_batch(),
+   which synthesizes the streams together. */
+
+typedef struct {
+   OpusDecoder *dec[BATCH_SIZE];
+   const unsigned char *data[BATCH_SIZE];
+   opus_int32 len[BATCH_SIZE];
+   opus_int16 *pcm[BATCH_SIZE];
+   int ret[BATCH_SIZE];
+   unsigned char *packets;
+   opus_int32 *lens;
+   int nb_packets;
+   int pkt;
+} DecodeBatchBench;
+
+static void decode_batch_advance(DecodeBatchBench *b)
+{
+   int i;
+   if (b->pkt == b->nb_packets)
+      b->pkt = 0;
+   for (i=0;i<BATCH_SIZE;i++)
+   {
+      b->data[i] = b->packets + (b->pkt*BATCH_SIZE + i)*MAX_PACKET;
+      b->len[i] = b->lens[b->pkt*BATCH_SIZE + i];
+   }
+   b->pkt++;
+}
+
+static void bench_decode_loop(void *ctx)
+{
+   DecodeBatchBench *b = (DecodeBatchBench*)ctx;
+   int i;
+   decode_batch_advance(b);
+   for (i=0;i<BATCH_SIZE;i++)
+   {
+      if (opus_decode(b->dec[i], b->data[i], b->len[i], b->pcm[i], 960, 0) != 960)
+      {
+         fprintf(stderr, "opus_decode() failed\n");
+         exit(EXIT_FAILURE);
+      }
+   }
+}
+
+static void bench_decode_batch(void *ctx)
+{
+   DecodeBatchBench *b = (DecodeBatchBench*)ctx;
+   int i;
+   decode_batch_advance(b);
+   if (opus_decode_batch(b->dec, b->data, b->len, b->pcm, 960, 0, b->ret,
+         BATCH_SIZE) != OPUS_OK)
+   {
+      fprintf(stderr, "opus_decode_batch() failed\n");
+      exit(EXIT_FAILURE);
+   }
+   for (i=0;i<BATCH_SIZE;i++)
+   {
+      if (b->ret[i] != 960)
+      {
+         fprintf(stderr, "opus_decode_batch() failed\n");
+         exit(EXIT_FAILURE);
+      }
+   }
+}
+
+static void bench_decode_batch_streams(void)
+{
+   const char *params = "\"streams\": 24, \"modes\": [\"celt\"], "
+         "\"channels\": [1, 2], \"frame_ms\": 20.0";
+   DecodeBatchBench *b;
+   opus_int16 *signal[2];
+   opus_int16 *out;
+   int total = 48000*SIGNAL_SECONDS;
+   int err, i, p;
+
+   b = (DecodeBatchBench*)calloc(1, sizeof(*b));
+   if (!b)
+   {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+   }
+   b->nb_packets = total/960;
+   b->packets = (unsigned char*)malloc(b->nb_packets*BATCH_SIZE*MAX_PACKET);
+   b->lens = (opus_int32*)malloc(sizeof(*b->lens)*b->nb_packets*BATCH_SIZE);
+   out = (opus_int16*)malloc(sizeof(*out)*BATCH_SIZE*960*2);
+   signal[0] = generate_signal(1, total);
+   signal[1] = generate_signal(2, total);
+   if (!b->packets || !b->lens || !out || !signal[0] || !signal[1])
+   {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+   }
+   for (i=0;i<BATCH_SIZE;i++)
+   {
+      int channels = 1 + (i&1);
+      OpusEncoder *enc;
+      enc = opus_encoder_create(48000, channels, OPUS_APPLICATION_AUDIO, &err);
+      if (!enc)
+      {
+         fprintf(stderr, "opus_encoder_create() failed: %s\n", opus_strerror(err));
+         exit(EXIT_FAILURE);
+      }
+      b->dec[i] = opus_decoder_create(48000, channels, &err);
+      if (!b->dec[i])
+      {
+         fprintf(stderr, "opus_decoder_create() failed: %s\n", opus_strerror(err));
+         exit(EXIT_FAILURE);
+      }
+      opus_encoder_ctl(enc, OPUS_SET_FORCE_MODE(MODE_CELT_ONLY));
+      opus_encoder_ctl(enc, OPUS_SET_BITRATE(channels == 2 ? 96000 : 64000));
+      for (p=0;p<b->nb_packets;p++)
+      {
+         opus_int32 len;
+         /* Offset the signal so that the streams are not all alike. */
+         int pos = (p*960 + i*4801)%(total - 960);
+         len = opus_encode(enc, signal[channels-1] + pos*channels, 960,
+               b->packets + (p*BATCH_SIZE + i)*MAX_PACKET, MAX_PACKET);
+         if (len < 0)
+         {
+            fprintf(stderr, "opus_encode() failed\n");
+            exit(EXIT_FAILURE);
+         }
+         b->lens[p*BATCH_SIZE + i] = len;
+      }
+      opus_encoder_destroy(enc);
+      b->pcm[i] = out + i*960*2;
+   }
+   run_bench("codec", "decode_loop", params, bench_decode_loop, b,
+         BATCH_SIZE*2e7);
+   for (i=0;i<BATCH_SIZE;i++)
+      opus_decoder_ctl(b->dec[i], OPUS_RESET_STATE);
+   b->pkt = 0;
+   run_bench("codec", "decode_batch", params, bench_decode_batch, b,
+         BATCH_SIZE*2e7);
+   for (i=0;i<BATCH_SIZE;i++)
+      opus_decoder_destroy(b->dec[i]);
+   free(signal[0]);
+   free(signal[1]);
+   free(out);
+   free(b->packets);
+   free(b->lens);
+   free(b);
+}
+
+/* Bitrate reduction of a CELT-only stream: decoding and encoding again,
+   or transrating the packets directly. */
+
+typedef struct {
+   OpusDecoder *dec;
+   OpusEncoder *enc;
+   OpusTransrater *tr;
+   unsigned char *packets;
+   opus_int32 *len;
+   int nb_packets;
+   int pkt;
+   opus_int16 pcm[2*960];
+   unsigned char out[MAX_PACKET];
+} TransrateBench;
+
+static void bench_transcode(void *ctx)
+{
+   TransrateBench *b = (TransrateBench*)ctx;
+   if (b->pkt == b->nb_packets)
+      b->pkt = 0;
+   if (opus_decode(b->dec, b->packets + b->pkt*MAX_PACKET, b->len[b->pkt],
+         b->pcm, 960, 0) != 960
+         || opus_encode(b->enc, b->pcm, 960, b->out, MAX_PACKET) < 0)
+   {
+      fprintf(stderr, "transcoding failed\n");
+      exit(EXIT_FAILURE);
+   }
+   b->pkt++;
+}
+
+static void bench_transrate_packet(void *ctx)
+{
+   TransrateBench *b = (TransrateBench*)ctx;
+   if (b->pkt == b->nb_packets)
+   {
+      b->pkt = 0;
+      opus_transrater_ctl(b->tr, OPUS_RESET_STATE);
+   }
+   if (opus_transrate(b->tr, b->packets + b->pkt*MAX_PACKET, b->len[b->pkt],
+         b->out, MAX_PACKET) < 0)
+   {
+      fprintf(stderr, "opus_transrate() failed\n");
+      exit(EXIT_FAILURE);
+   }
+   b->pkt++;
+}
+
+static void bench_transrate(void)
+{
+   TransrateBench *b;
+   OpusEncoder *src;
+   opus_int16 *pcm;
+   const char *params = "\"channels\": 2, \"bitrate_in\": 128000, "
+         "\"bitrate_out\": 48000, \"complexity\": 10, \"frame_ms\": 20.0";
+   int total = 48000*SIGNAL_SECONDS;
+   int err, i;
+
+   b = (TransrateBench*)calloc(1, sizeof(*b));
+   pcm = generate_signal(2, total);
+   if (!b || !pcm)
+   {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+   }
+   b->nb_packets = total/960;
+   b->packets = (unsigned char*)malloc(b->nb_packets*MAX_PACKET);
+   b->len = (opus_int32*)malloc(b->nb_packets*sizeof(*b->len));
+   src = opus_encoder_create(48000, 2, OPUS_APPLICATION_AUDIO, &err);
+   b->dec = opus_decoder_create(48000, 2, &err);
+   b->enc = opus_encoder_create(48000, 2, OPUS_APPLICATION_AUDIO, &err);
+   b->tr = opus_transrater_create(48000, &err);
+   if (!b->packets || !b->len || !src || !b->dec || !b->enc || !b->tr)
+   {
+      fprintf(stderr, "Transrate benchmark setup failed\n");
+      exit(EXIT_FAILURE);
+   }
+   opus_encoder_ctl(src, OPUS_SET_BITRATE(128000));
+   opus_encoder_ctl(src, OPUS_SET_FORCE_MODE(MODE_CELT_ONLY));
+   for (i=0;i<b->nb_packets;i++)
+   {
+      b->len[i] = opus_encode(src, pcm + 2*960*i, 960,
+            b->packets + i*MAX_PACKET, MAX_PACKET);
+      if (b->len[i] < 0)
+      {
+         fprintf(stderr, "opus_encode() failed\n");
+         exit(EXIT_FAILURE);
+      }
+   }
+   opus_encoder_ctl(b->enc, OPUS_SET_BITRATE(48000));
+   opus_encoder_ctl(b->enc, OPUS_SET_FORCE_MODE(MODE_CELT_ONLY));
+   opus_encoder_ctl(b->enc, OPUS_SET_COMPLEXITY(10));
+   opus_transrater_ctl(b->tr, OPUS_SET_COMPLEXITY(10));
+   run_bench("codec", "transcode", params, bench_transcode, b, 2e7);
+   b->pkt = 0;
+   run_bench("codec", "transrate", params, bench_transrate_packet, b, 2e7);
+   opus_encoder_destroy(src);
+   opus_decoder_destroy(b->dec);
+   opus_encoder_destroy(b->enc);
+   opus_transrater_destroy(b->tr);
+   free(b->packets);
+   free(b->len);
+   free(pcm);
+   free(b);
+}
+
+typedef struct {
+   OpusDecoder *dec;
+   OpusProbe *probe;
+   unsigned char *packets;
+   opus_int32 *len;
+   int nb_packets;
+   int pkt;
+   opus_int16 pcm[2*960];
+   opus_int16 level[48];
+   unsigned char active[48];
+} ProbeBench;
+
+static void bench_probe_decode(void *ctx)
+{
+   ProbeBench *b = (ProbeBench*)ctx;
+   if (b->pkt == b->nb_packets)
+      b->pkt = 0;
+   if (opus_decode(b->dec, b->packets + b->pkt*MAX_PACKET, b->len[b->pkt],
+         b->pcm, 960, 0) != 960)
+   {
+      fprintf(stderr, "opus_decode() failed\n");
+      exit(EXIT_FAILURE);
+   }
+   b->pkt++;
+}
+
+static void bench_probe_packet(void *ctx)
+{
+   ProbeBench *b = (ProbeBench*)ctx;
+   if (b->pkt == b->nb_packets)
+   {
+      b->pkt = 0;
+      opus_probe_init(b->probe);
+   }
+   if (opus_probe_packet(b->probe, b->packets + b->pkt*MAX_PACKET,
+         b->len[b->pkt], b->level, b->active) < 0)
+   {
+      fprintf(stderr, "opus_probe_packet() failed\n");
+      exit(EXIT_FAILURE);
+   }
+   b->pkt++;
+}
+
+static void bench_probe(void)
+{
+   static const int modes[3] = {MODE_SILK_ONLY, MODE_HYBRID, MODE_CELT_ONLY};
+   static const char *mode_names[3] = {"silk", "hybrid", "celt"};
+   ProbeBench *b;
+   OpusEncoder *src;
+   opus_int16 *pcm;
+   int total = 48000*SIGNAL_SECONDS;
+   int err, i, m;
+   char params[256];
+
+   b = (ProbeBench*)calloc(1, sizeof(*b));
+   pcm = generate_signal(2, total);
+   if (!b || !pcm)
+   {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+   }
+   b->nb_packets = total/960;
+   b->packets = (unsigned char*)malloc(b->nb_packets*MAX_PACKET);
+   b->len = (opus_int32*)malloc(b->nb_packets*sizeof(*b->len));
+   b->probe = opus_probe_create(&err);
+   if (!b->packets || !b->len || !b->probe)
+   {
+      fprintf(stderr, "Probe benchmark setup failed\n");
+      exit(EXIT_FAILURE);
+   }
+   for (m=0;m<3;m++)
+   {
+      src = opus_encoder_create(48000, 2, OPUS_APPLICATION_AUDIO, &err);
+      b->dec = opus_decoder_create(48000, 2, &err);
+      if (!src || !b->dec)
+      {
+         fprintf(stderr, "Probe benchmark setup failed\n");
+         exit(EXIT_FAILURE);
+      }
+      opus_encoder_ctl(src, OPUS_SET_BITRATE(48000));
+      opus_encoder_ctl(src, OPUS_SET_FORCE_MODE(modes[m]));
+      for (i=0;i<b->nb_packets;i++)
+      {
+         b->len[i] = opus_encode(src, pcm + 2*960*i, 960,
+               b->packets + i*MAX_PACKET, MAX_PACKET);
+         if (b->len[i] < 0)
+         {
+            fprintf(stderr, "opus_encode() failed\n");
+            exit(EXIT_FAILURE);
+         }
+      }
+      snprintf(params, sizeof(params), "\"mode\": \"%s\", \"channels\": 2, "
+            "\"bitrate\": 48000, \"frame_ms\": 20.0", mode_names[m]);
+      b->pkt = 0;
+      run_bench("codec", "probe_decode", params, bench_probe_decode, b, 2e7);
+      b->pkt = 0;
+      opus_probe_init(b->probe);
+      run_bench("codec", "probe", params, bench_probe_packet, b, 2e7);
+      opus_encoder_destroy(src);
+      opus_decoder_destroy(b->dec);
+   }
+   opus_probe_destroy(b->probe);
+   free(b->packets);
+   free(b->len);
+   free(pcm);
+   free(b);
+}
+
+/* Decoding CELT packets below 48 kHz, with the synthesis either at 48 kHz or
+   at the output rate. */
+
+static void bench_low_rate_decode(void)
+{
+   static const opus_int32 rates[3] = {8000, 16000, 24000};
+   CodecBench b;
+   OpusEncoder *src;
+   opus_int16 *pcm;
+   int total = 48000*SIGNAL_SECONDS;
+   int err, i, r, k;
+   char params[256];
+
+   memset(&b, 0, sizeof(b));
+   pcm = generate_signal(2, total);
+   b.nb_packets = total/960;
+   b.packets = (unsigned char*)malloc(b.nb_packets*MAX_PACKET);
+   b.len = (opus_int32*)malloc(b.nb_packets*sizeof(*b.len));
+   b.out = (opus_int16*)malloc(2*480*sizeof(*b.out));
+   src = opus_encoder_create(48000, 2, OPUS_APPLICATION_AUDIO, &err);
+   if (!pcm || !b.packets || !b.len || !b.out || !src)
+   {
+      fprintf(stderr, "Low-rate decode benchmark setup failed\n");
+      exit(EXIT_FAILURE);
+   }
+   opus_encoder_ctl(src, OPUS_SET_BITRATE(64000));
+   opus_encoder_ctl(src, OPUS_SET_FORCE_MODE(MODE_CELT_ONLY));
+   for (i=0;i<b.nb_packets;i++)
+   {
+      b.len[i] = opus_encode(src, pcm + 2*960*i, 960,
+            b.packets + i*MAX_PACKET, MAX_PACKET);
+      if (b.len[i] < 0)
+      {
+         fprintf(stderr, "opus_encode() failed\n");
+         exit(EXIT_FAILURE);
+      }
+   }
+   for (r=0;r<3;r++)
+   {
+      for (k=0;k<2;k++)
+      {
+         b.dec = opus_decoder_create(rates[r], 2, &err);
+         if (!b.dec)
+         {
+            fprintf(stderr, "Low-rate decode benchmark setup failed\n");
+            exit(EXIT_FAILURE);
+         }
+         /* Skip configurations the build does not support. */
+         if (opus_decoder_ctl(b.dec, OPUS_SET_REDUCED_SYNTHESIS(k)) == OPUS_OK)
+         {
+            b.frame_size = 960*rates[r]/48000;
+            b.pkt = 0;
+            snprintf(params, sizeof(params), "\"mode\": \"celt\", \"channels\": 2, "
+                  "\"bitrate\": 64000, \"frame_ms\": 20.0, \"rate\": %d, "
+                  "\"reduced_synthesis\": %d", (int)rates[r], k);
+            run_bench("codec", "decode_low_rate", params, bench_decode, &b, 2e7);
+         }
+         opus_decoder_destroy(b.dec);
+      }
+   }
+   opus_encoder_destroy(src);
+   free(b.packets);
+   free(b.len);
+   free(b.out);
+   free(pcm);
+}
+
+/* CELT stages */
+
+typedef struct {
+   const CELTMode *mode;
+   int shift;
+   kiss_fft_scalar in[2*(960+120)];
+   kiss_fft_scalar out[2*(960+120)];
+   kiss_fft_cpx fin[480];
+   kiss_fft_cpx fout[480];
+} MdctBench;
+
+static void bench_mdct_forward(void *ctx)
+{
+   MdctBench *b = (MdctBench*)ctx;
+   clt_mdct_forward(&b->mode->mdct, b->in, b->out, b->mode->window,
+         b->mode->overlap, b->shift, 1, arch);
+}
+
+static void bench_mdct_backward(void *ctx)
+{
+   MdctBench *b = (MdctBench*)ctx;
+   clt_mdct_backward(&b->mode->mdct, b->in, b->out, b->mode->window,
+         b->mode->overlap, b->shift, 1, arch);
+}
+
+/* All the short blocks of a stereo transient frame, as the encoder and
+   decoder lay them out. */
+static void bench_mdct_forward_multi(void *ctx)
+{
+   MdctBench *b = (MdctBench*)ctx;
+   kiss_fft_scalar *x[2], *y[2];
+   int B = 1<<b->mode->maxLM;
+   int N = B*b->mode->shortMdctSize;
+   x[0] = b->in;
+   x[1] = b->in+N+b->mode->overlap;
+   y[0] = b->out;
+   y[1] = b->out+N;
+   clt_mdct_forward_multi(&b->mode->mdct, x, y, 2, B, b->mode->window,
+         b->mode->overlap, b->mode->maxLM, arch);
+}
+
+static void bench_mdct_backward_multi(void *ctx)
+{
+   MdctBench *b = (MdctBench*)ctx;
+   kiss_fft_scalar *x[2], *y[2];
+   int B = 1<<b->mode->maxLM;
+   int N = B*b->mode->shortMdctSize;
+   x[0] = b->in;
+   x[1] = b->in+N;
+   y[0] = b->out;
+   y[1] = b->out+N+b->mode->overlap;
+   clt_mdct_backward_multi(&b->mode->mdct, x, y, 2, B, b->mode->window,
+         b->mode->overlap, b->mode->maxLM, arch);
+}
+
+static void bench_fft(void *ctx)
+{
+   MdctBench *b = (MdctBench*)ctx;
+   opus_fft(b->mode->mdct.kfft[b->shift], b->fin, b->fout, arch);
+}
+
+typedef struct {
+   celt_norm X0[176];
+   celt_norm X[176];
+   int iy[176];
+   int K;
+   int N;
+} PvqBench;
+
+static void bench_pvq_search(void *ctx)
+{
+   PvqBench *b = (PvqBench*)ctx;
+   /* The search overwrites X with its magnitudes. */
+   OPUS_COPY(b->X, b->X0, b->N);
+   op_pvq_search(b->X, b->iy, b->K, b->N, arch);
+}
+
+typedef struct {
+   opus_val16 x[1024];
+   opus_val16 y[2048];
+   opus_val32 xcorr[1024];
+   int len;
+   int max_pitch;
+} XcorrBench;
+
+static void bench_pitch_xcorr(void *ctx)
+{
+   XcorrBench *b = (XcorrBench*)ctx;
+   celt_pitch_xcorr(b->x, b->y, b->xcorr, b->len, b->max_pitch, arch);
+}
+
+static void bench_celt(void)
+{
+   static const int pvq_nk[3][2] = {{8, 4}, {16, 10}, {96, 32}};
+   const CELTMode *mode;
+   MdctBench *mb;
+   PvqBench pb;
+   XcorrBench *xb;
+   char params[128];
+   int i, s;
+
+   mode = opus_custom_mode_create(48000, 960, NULL);
+   mb = (MdctBench*)calloc(1, sizeof(*mb));
+   xb = (XcorrBench*)calloc(1, sizeof(*xb));
+   if (!mode || !mb || !xb)
+   {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+   }
+   mb->mode = mode;
+   for (i=0;i<2*(960+120);i++)
+      mb->in[i] = (kiss_fft_scalar)((bench_rand()&65535) - 32768);
+   for (i=0;i<480;i++)
+   {
+      mb->fin[i].r = (kiss_fft_scalar)((bench_rand()&65535) - 32768);
+      mb->fin[i].i = (kiss_fft_scalar)((bench_rand()&65535) - 32768);
+   }
+   /* shift 0 is the 20 ms long block, shift 3 the 2.5 ms short block. */
+   for (s=0;s<=mode->maxLM;s+=mode->maxLM)
+   {
+      int n = mode->mdct.n>>s;
+      mb->shift = s;
+      snprintf(params, sizeof(params), "\"n\": %d", n);
+      run_bench("celt", "mdct_forward", params, bench_mdct_forward, mb, 0);
+      run_bench("celt", "mdct_backward", params, bench_mdct_backward, mb, 0);
+      snprintf(params, sizeof(params), "\"nfft\": %d", mode->mdct.kfft[s]->nfft);
+      run_bench("celt", "fft", params, bench_fft, mb, 0);
+   }
+   snprintf(params, sizeof(params), "\"n\": %d, \"channels\": 2, \"blocks\": %d",
+         mode->mdct.n>>mode->maxLM, 1<<mode->maxLM);
+   run_bench("celt", "mdct_forward_multi", params, bench_mdct_forward_multi, mb, 0);
+   run_bench("celt", "mdct_backward_multi", params, bench_mdct_backward_multi, mb, 0);
+
+   for (s=0;s<3;s++)
+   {
+      pb.N = pvq_nk[s][0];
+      pb.K = pvq_nk[s][1];
+      for (i=0;i<pb.N;i++)
+#ifdef FIXED_POINT
+         pb.X0[i] = (celt_norm)((bench_rand()&8191) - 4096);
+#else
+         pb.X0[i] = (celt_norm)((bench_rand()&8191) - 4096)*(1.f/4096);
+#endif
+      snprintf(params, sizeof(params), "\"n\": %d, \"k\": %d", pb.N, pb.K);
+      run_bench("celt", "pvq_search", params, bench_pvq_search, &pb, 0);
+   }
+
+   for (i=0;i<1024;i++)
+      xb->x[i] = (opus_val16)((bench_rand()&8191) - 4096);
+   for (i=0;i<2048;i++)
+      xb->y[i] = (opus_val16)((bench_rand()&8191) - 4096);
+   /* The decimated open-loop search of pitch_search() for a 20 ms frame. */
+   xb->len = 240;
+   xb->max_pitch = 244;
+   snprintf(params, sizeof(params), "\"len\": %d, \"max_pitch\": %d", xb->len, xb->max_pitch);
+   run_bench("celt", "pitch_xcorr", params, bench_pitch_xcorr, xb, 0);
+   free(mb);
+   free(xb);
+}
+
+/* SILK stages */
+
+typedef struct {
+   silk_encoder_state enc;
+   silk_nsq_state NSQ;
+   SideInfoIndices indices;
+   opus_int16 x16[MAX_FRAME_LENGTH];
+   opus_int8 pulses[MAX_FRAME_LENGTH];
+   opus_int16 PredCoef_Q12[2*MAX_LPC_ORDER];
+   opus_int16 LTPCoef_Q14[LTP_ORDER*MAX_NB_SUBFR];
+   opus_int16 AR_Q13[MAX_NB_SUBFR*MAX_SHAPE_LPC_ORDER];
+   opus_int HarmShapeGain_Q14[MAX_NB_SUBFR];
+   opus_int Tilt_Q14[MAX_NB_SUBFR];
+   opus_int32 LF_shp_Q14[MAX_NB_SUBFR];
+   opus_int32 Gains_Q16[MAX_NB_SUBFR];
+   opus_int pitchL[MAX_NB_SUBFR];
+} NsqBench;
+
+static void bench_nsq_del_dec(void *ctx)
+{
+   NsqBench *b = (NsqBench*)ctx;
+   silk_NSQ_del_dec(&b->enc, &b->NSQ, &b->indices, b->x16, b->pulses,
+         b->PredCoef_Q12, b->LTPCoef_Q14, b->AR_Q13, b->HarmShapeGain_Q14,
+         b->Tilt_Q14, b->LF_shp_Q14, b->Gains_Q16, b->pitchL, 1024, 15565,
+         b->enc.arch);
+}
+
+typedef struct {
+   silk_resampler_state_struct S;
+   opus_int16 in[960];
+   opus_int16 out[2880];
+   opus_int32 in_len;
+} ResamplerBench;
+
+static void bench_resampler(void *ctx)
+{
+   ResamplerBench *b = (ResamplerBench*)ctx;
+   silk_resampler(&b->S, b->out, b->in, b->in_len, arch);
+}
+
+static void bench_silk(void)
+{
+   static const int rates[4][3] = {
+      {48000, 16000, 1}, {48000, 8000, 1}, {16000, 48000, 0}, {12000, 48000, 0}
+   };
+   NsqBench *nb;
+   ResamplerBench *rb;
+   char params[128];
+   int i, k;
+
+   nb = (NsqBench*)calloc(1, sizeof(*nb));
+   rb = (ResamplerBench*)calloc(1, sizeof(*rb));
+   if (!nb || !rb)
+   {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+   }
+   /* A voiced 20 ms wideband frame, as set up by silk_control_encoder(). */
+   nb->enc.fs_kHz = 16;
+   nb->enc.nb_subfr = MAX_NB_SUBFR;
+   nb->enc.subfr_length = SUB_FRAME_LENGTH_MS*16;
+   nb->enc.frame_length = nb->enc.subfr_length*MAX_NB_SUBFR;
+   nb->enc.ltp_mem_length = LTP_MEM_LENGTH_MS*16;
+   nb->enc.predictLPCOrder = MAX_LPC_ORDER;
+   nb->enc.shapingLPCOrder = 24;
+   nb->enc.arch = arch;
+   nb->indices.signalType = TYPE_VOICED;
+   nb->indices.quantOffsetType = 0;
+   nb->indices.NLSFInterpCoef_Q2 = 4;
+   nb->NSQ.prev_gain_Q16 = 65536;
+   nb->NSQ.lagPrev = 100;
+   for (i=0;i<nb->enc.frame_length;i++)
+      nb->x16[i] = (opus_int16)(3000*sin(2*M_PI*i/100.) + (bench_rand()&511) - 256);
+   for (i=0;i<2*MAX_LPC_ORDER;i++)
+      nb->PredCoef_Q12[i] = (opus_int16)(i%MAX_LPC_ORDER == 0 ? 3000 : (i%MAX_LPC_ORDER == 1 ? -1000 : 100));
+   for (k=0;k<MAX_NB_SUBFR;k++)
+   {
+      nb->LTPCoef_Q14[k*LTP_ORDER + 2] = 8000;
+      nb->LTPCoef_Q14[k*LTP_ORDER + 1] = 2000;
+      nb->LTPCoef_Q14[k*LTP_ORDER + 3] = 2000;
+      for (i=0;i<nb->enc.shapingLPCOrder;i++)
+         nb->AR_Q13[k*MAX_SHAPE_LPC_ORDER + i] = (opus_int16)(i < 4 ? 2000>>i : 50);
+      nb->HarmShapeGain_Q14[k] = 4000;
+      nb->Tilt_Q14[k] = -2000;
+      nb->LF_shp_Q14[k] = (opus_int32)(((opus_uint32)(-4000 & 0xFFFF) << 16) | 12000);
+      nb->Gains_Q16[k] = 60<<16;
+      nb->pitchL[k] = 100;
+   }
+   for (k=2;k<=MAX_DEL_DEC_STATES;k+=2)
+   {
+      nb->enc.nStatesDelayedDecision = k;
+      snprintf(params, sizeof(params), "\"fs_khz\": 16, \"frame_ms\": 20, \"states\": %d", k);
+      run_bench("silk", "nsq_del_dec", params, bench_nsq_del_dec, nb, 0);
+   }
+
+   for (i=0;i<960;i++)
+      rb->in[i] = (opus_int16)(8000*sin(2*M_PI*i/37.) + (bench_rand()&1023) - 512);
+   for (k=0;k<4;k++)
+   {
+      silk_resampler_init(&rb->S, rates[k][0], rates[k][1], rates[k][2]);
+      rb->in_len = rates[k][0]/50;
+      snprintf(params, sizeof(params), "\"fs_in\": %d, \"fs_out\": %d, \"frame_ms\": 20",
+            rates[k][0], rates[k][1]);
+      run_bench("silk", "resampler", params, bench_resampler, rb, 0);
+   }
+   free(nb);
+   free(rb);
+}
+
+#ifndef FIXED_POINT
+
+/* SILK float analysis kernels */
+
+typedef struct {
+   silk_float x[2*SHAPE_LPC_WIN_MAX];
+   silk_float res[2*SHAPE_LPC_WIN_MAX];
+   silk_float A[SILK_MAX_ORDER_LPC];
+   silk_float corr[MAX_SHAPE_LPC_ORDER + 1];
+   silk_float XX[LTP_ORDER*LTP_ORDER];
+   silk_float frame[PE_MAX_FRAME_LENGTH];
+   double acc;
+} FlpBench;
+
+static void bench_inner_product_flp(void *ctx)
+{
+   FlpBench *b = (FlpBench*)ctx;
+   b->acc += silk_inner_product_FLP(b->x, b->x + 2, SUB_FRAME_LENGTH_MS*16, arch);
+}
+
+static void bench_lpc_analysis_filter_flp(void *ctx)
+{
+   FlpBench *b = (FlpBench*)ctx;
+   silk_LPC_analysis_filter_FLP(b->res, b->A, b->x, 2*(SUB_FRAME_LENGTH_MS*16 + MAX_LPC_ORDER),
+         MAX_LPC_ORDER, arch);
+}
+
+static void bench_warped_autocorrelation_flp(void *ctx)
+{
+   FlpBench *b = (FlpBench*)ctx;
+   silk_warped_autocorrelation_FLP(b->corr, b->x, 0.35f, SHAPE_LPC_WIN_MAX, MAX_SHAPE_LPC_ORDER, arch);
+}
+
+static void bench_burg_modified_flp(void *ctx)
+{
+   FlpBench *b = (FlpBench*)ctx;
+   b->acc += silk_burg_modified_FLP(b->A, b->x, 1e-4f, SUB_FRAME_LENGTH_MS*16 + MAX_LPC_ORDER,
+         MAX_NB_SUBFR, MAX_LPC_ORDER, arch);
+}
+
+static void bench_corr_matrix_flp(void *ctx)
+{
+   FlpBench *b = (FlpBench*)ctx;
+   silk_corrMatrix_FLP(b->x, SUB_FRAME_LENGTH_MS*16, LTP_ORDER, b->XX, arch);
+}
+
+static void bench_pitch_analysis_flp(void *ctx)
+{
+   FlpBench *b = (FlpBench*)ctx;
+   opus_int pitch[MAX_NB_SUBFR];
+   opus_int16 lagIndex;
+   opus_int8 contourIndex;
+   silk_float LTPCorr = 0.5f;
+   b->acc += silk_pitch_analysis_core_FLP(b->frame, pitch, &lagIndex, &contourIndex, &LTPCorr,
+         100, 0.7f, 0.4f, 16, SILK_PE_MAX_COMPLEX, MAX_NB_SUBFR, arch);
+}
+
+/* The kernels of silk_encode_frame_FLP() at 16 kHz, 20 ms, complexity 10. */
+static void bench_silk_float(void)
+{
+   FlpBench *fb;
+   int i;
+   fb = (FlpBench*)calloc(1, sizeof(*fb));
+   if (!fb)
+   {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+   }
+   for (i=0;i<2*SHAPE_LPC_WIN_MAX;i++)
+      fb->x[i] = (silk_float)(3000*sin(2*M_PI*i/100.) + (bench_rand()&511) - 256);
+   for (i=0;i<PE_MAX_FRAME_LENGTH;i++)
+      fb->frame[i] = (silk_float)(3000*sin(2*M_PI*i/97.) + 1500*sin(2*M_PI*i/48.5)
+            + (bench_rand()&511) - 256);
+   for (i=0;i<MAX_LPC_ORDER;i++)
+      fb->A[i] = (silk_float)(i == 0 ? 0.7 : (i == 1 ? -0.25 : 0.02));
+   run_bench("silk", "inner_product_flp", "\"len\": 80", bench_inner_product_flp, fb, 0);
+   run_bench("silk", "lpc_analysis_filter_flp", "\"order\": 16, \"len\": 192",
+         bench_lpc_analysis_filter_flp, fb, 0);
+   run_bench("silk", "warped_autocorrelation_flp", "\"order\": 24, \"len\": 240",
+         bench_warped_autocorrelation_flp, fb, 0);
+   run_bench("silk", "corr_matrix_flp", "\"order\": 5, \"len\": 80", bench_corr_matrix_flp, fb, 0);
+   run_bench("silk", "pitch_analysis_flp", "\"fs_khz\": 16, \"complexity\": 2",
+         bench_pitch_analysis_flp, fb, 0);
+   /* Runs last, as it overwrites the LPC coefficients. */
+   run_bench("silk", "burg_modified_flp", "\"order\": 16, \"subfr\": 4, \"len\": 96",
+         bench_burg_modified_flp, fb, 0);
+   free(fb);
+}
+
+#endif
+
+#ifndef DISABLE_FLOAT_API
+
+/* Tonality analysis */
+
+typedef struct {
+   float features[25];
+   float layer_out[MAX_NEURONS];
+   float rnn_state[MAX_NEURONS];
+   float frame_probs[2];
+} MlpBench;
+
+/* One frame of the music/speech classifier, as run by tonality_analysis(). */
+static void bench_mlp(void *ctx)
+{
+   MlpBench *b = (MlpBench*)ctx;
+   compute_dense(&layer0, b->layer_out, b->features, arch);
+   compute_gru(&layer1, b->rnn_state, b->layer_out, arch);
+   compute_dense(&layer2, b->frame_probs, b->rnn_state, arch);
+}
+
+static void bench_analysis(void)
+{
+   MlpBench mb;
+   int i;
+   OPUS_CLEAR(&mb, 1);
+   for (i=0;i<25;i++)
+      mb.features[i] = ((bench_rand()&65535) - 32768)/16384.f;
+   run_bench("analysis", "mlp", "\"layers\": \"25x32 dense, 32x24 gru, 24x2 dense\"",
+         bench_mlp, &mb, 0);
+}
+
+#endif
+
+static void print_usage(char *argv0)
+{
+   fprintf(stderr, "Usage: %s [--quick] [--min-time <ms>] [--filter <group/name>] [--arch <level>]\n", argv0);
+   fprintf(stderr, "  --quick          Time each benchmark for 20 ms instead of 200 ms\n");
+   fprintf(stderr, "  --min-time <ms>  Time each benchmark for at least <ms> milliseconds\n");
+   fprintf(stderr, "  --filter <s>     Only run benchmarks whose group/name contains <s>\n");
+   fprintf(stderr, "  --arch <level>   Cap the arch level used by the DSP benchmarks\n");
+}
+
+int main(int argc, char **argv)
+{
+   int i;
+   int max_arch = -1;
+
+   for (i=1;i<argc;i++)
+   {
+      if (strcmp(argv[i], "--quick") == 0)
+         min_time_ns = 2e7;
+      else if (strcmp(argv[i], "--min-time") == 0 && i+1 < argc)
+         min_time_ns = 1e6*atof(argv[++i]);
+      else if (strcmp(argv[i], "--filter") == 0 && i+1 < argc)
+         filter = argv[++i];
+      else if (strcmp(argv[i], "--arch") == 0 && i+1 < argc)
+         max_arch = atoi(argv[++i]);
+      else
+      {
+         print_usage(argv[0]);
+         return EXIT_FAILURE;
+      }
+   }
+   arch = opus_select_arch();
+   if (max_arch >= 0 && max_arch < arch)
+      arch = max_arch;
+
+   printf("{\n  \"version\": \"%s\",\n", opus_get_version_string());
+#ifdef FIXED_POINT
+   printf("  \"fixed_point\": true,\n");
+#else
+   printf("  \"fixed_point\": false,\n");
+#endif
+   printf("  \"arch\": %d,\n  \"min_time_ms\": %.0f,\n  \"results\": [", arch, min_time_ns/1e6);
+   bench_celt();
+   bench_silk();
+#ifndef FIXED_POINT
+   bench_silk_float();
+#endif
+#ifndef DISABLE_FLOAT_API
+   bench_analysis();
+#endif
+   bench_codec();
+   bench_ladder();
+   bench_encode_streams();
+   bench_decode_batch_streams();
+   bench_transrate();
+   bench_probe();
+   bench_low_rate_decode();
+   printf("\n  ]\n}\n");
+   return EXIT_SUCCESS;
+}
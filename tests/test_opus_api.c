@@ -114,7 +114,7 @@ opus_int32 test_dec_api(void)
       for(i=-7;i<=96000;i++)
       {
          int fs;
-         if((i==8000||i==12000||i==16000||i==24000||i==48000)&&(c==1||c==2))continue;
+         if((i==8000||i==12000||i==16000||i==24000||i==44100||i==48000)&&(c==1||c==2))continue;
          switch(i)
          {
            case(-5):fs=-8000;break;
@@ -236,6 +236,35 @@ opus_int32 test_dec_api(void)
    fprintf(stdout,"    OPUS_SET_GAIN ................................ OK.\n");
    fprintf(stdout,"    OPUS_GET_GAIN ................................ OK.\n");
 
+   VG_UNDEF(&i,sizeof(i));
+   err=opus_decoder_ctl(dec, OPUS_GET_REDUCED_SYNTHESIS(&i));
+   VG_CHECK(&i,sizeof(i));
+   if(err != OPUS_OK || i!=0)test_failed();
+   cfgs++;
+   err=opus_decoder_ctl(dec, OPUS_GET_REDUCED_SYNTHESIS(null_int_ptr));
+   if(err != OPUS_BAD_ARG)test_failed();
+   cfgs++;
+   err=opus_decoder_ctl(dec, OPUS_SET_REDUCED_SYNTHESIS(-1));
+   if(err != OPUS_BAD_ARG)test_failed();
+   cfgs++;
+   err=opus_decoder_ctl(dec, OPUS_SET_REDUCED_SYNTHESIS(2));
+   if(err != OPUS_BAD_ARG)test_failed();
+   cfgs++;
+   /*Always accepted at 48 kHz, where it has no effect.*/
+   err=opus_decoder_ctl(dec, OPUS_SET_REDUCED_SYNTHESIS(1));
+   if(err != OPUS_OK)test_failed();
+   cfgs++;
+   VG_UNDEF(&i,sizeof(i));
+   err=opus_decoder_ctl(dec, OPUS_GET_REDUCED_SYNTHESIS(&i));
+   VG_CHECK(&i,sizeof(i));
+   if(err != OPUS_OK || i!=1)test_failed();
+   cfgs++;
+   err=opus_decoder_ctl(dec, OPUS_SET_REDUCED_SYNTHESIS(0));
+   if(err != OPUS_OK)test_failed();
+   cfgs++;
+   fprintf(stdout,"    OPUS_SET_REDUCED_SYNTHESIS ................... OK.\n");
+   fprintf(stdout,"    OPUS_GET_REDUCED_SYNTHESIS ................... OK.\n");
+
    /*Reset the decoder*/
    dec2=malloc(opus_decoder_get_size(2));
    memcpy(dec2,dec,opus_decoder_get_size(2));
@@ -322,6 +351,211 @@ opus_int32 test_dec_api(void)
    fprintf(stdout,"    opus_decode_float() .......................... OK.\n");
 #endif
 
+   /*At 44.1 kHz, the output of each packet is converted from 48 kHz.*/
+   dec2 = opus_decoder_create(44100, 2, &err);
+   if(err!=OPUS_OK || dec2==NULL)test_failed();
+   VG_UNDEF(&i,sizeof(i));
+   err=opus_decoder_ctl(dec2, OPUS_GET_SAMPLE_RATE(&i));
+   if(err != OPUS_OK || i!=44100)test_failed();
+   cfgs++;
+   if(opus_decode(dec2, packet, 3, sbuf, 881, 0)!=OPUS_BUFFER_TOO_SMALL)test_failed();
+   cfgs++;
+   if(opus_decoder_get_nb_samples(dec2, packet, 3)!=882)test_failed();
+   if(opus_decode(dec2, packet, 3, sbuf, 882, 0)!=882)test_failed();
+   cfgs++;
+   /*PLC has to cover a multiple of 10 ms.*/
+   if(opus_decode(dec2, NULL, 0, sbuf, 440, 0)!=OPUS_BAD_ARG)test_failed();
+   cfgs++;
+   if(opus_decode(dec2, NULL, 0, sbuf, 441, 0)!=441)test_failed();
+   cfgs++;
+   /*2.5 ms frames alternate between 110 and 111 samples, adding up exactly.*/
+   packet[0]=16<<3;
+   for(j=0,c=0;c<32;c++)
+   {
+      i=opus_decoder_get_nb_samples(dec2, packet, 3);
+      if(i<110 || i>111)test_failed();
+      if(opus_decode(dec2, packet, 3, sbuf, 960, 0)!=i)test_failed();
+      j+=i;
+   }
+   if(j!=32*441/4)test_failed();
+   VG_UNDEF(&i,sizeof(i));
+   err=opus_decoder_ctl(dec2, OPUS_GET_LAST_PACKET_DURATION(&i));
+   if(err != OPUS_OK || i<110 || i>111)test_failed();
+   cfgs++;
+   opus_decoder_destroy(dec2);
+   fprintf(stdout,"    opus_decode() at 44.1 kHz .................... OK.\n");
+
+   /*The batch API must be bit-exact with decoding each stream on its own.*/
+   {
+      static const unsigned char tocs[4]={63<<2,0,15<<3,(63<<2)+3};
+      static const opus_int32 blens[4]={3,40,40,51};
+      OpusDecoder *bdec[4];
+      OpusDecoder *ref[4];
+      unsigned char bpackets[4][51];
+      const unsigned char *bdata[4];
+      short bout[4][960*2];
+      opus_int16 *bpcm[4];
+      int bret[4];
+      int sz,f,k;
+      sz=opus_decoder_get_size(2);
+      for(k=0;k<4;k++)
+      {
+         bdec[k]=opus_decoder_create(48000,2,&err);
+         if(err!=OPUS_OK || bdec[k]==NULL)test_failed();
+         ref[k]=malloc(sz);
+         if(ref[k]==NULL)test_failed();
+         for(j=0;j<51;j++)bpackets[k][j]=(unsigned char)(j*37+k*11);
+         bpackets[k][0]=tocs[k];
+         bpcm[k]=bout[k];
+      }
+      /*Code 3 packet with an invalid frame count.*/
+      bpackets[3][1]=49;
+      if(opus_decode_batch(bdec,bdata,blens,bpcm,960,0,bret,-1)!=OPUS_BAD_ARG)test_failed();
+      cfgs++;
+      for(f=0;f<3;f++)
+      {
+         for(k=0;k<4;k++)
+         {
+            memcpy(ref[k],bdec[k],sz);
+            /*Lose the CELT packet on the second frame.*/
+            bdata[k]=(f==1&&k==0)?NULL:bpackets[k];
+         }
+         if(opus_decode_batch(bdec,bdata,blens,bpcm,960,0,bret,4)!=OPUS_OK)test_failed();
+         for(k=0;k<4;k++)
+         {
+            i=opus_decode(ref[k],bdata[k],blens[k],sbuf,960,0);
+            if(bret[k]!=i)test_failed();
+            if(i>0&&memcmp(sbuf,bout[k],i*2*sizeof(short))!=0)test_failed();
+         }
+         if(bret[3]!=OPUS_INVALID_PACKET)test_failed();
+         cfgs++;
+      }
+      fprintf(stdout,"    opus_decode_batch() .......................... OK.\n");
+#ifndef DISABLE_FLOAT_API
+      {
+         float fout[4][960*2];
+         float *bfpcm[4];
+         for(k=0;k<4;k++)
+         {
+            bfpcm[k]=fout[k];
+            memcpy(ref[k],bdec[k],sz);
+            bdata[k]=bpackets[k];
+         }
+         if(opus_decode_batch_float(bdec,bdata,blens,bfpcm,960,0,bret,4)!=OPUS_OK)test_failed();
+         for(k=0;k<4;k++)
+         {
+            i=opus_decode_float(ref[k],bdata[k],blens[k],fbuf,960,0);
+            if(bret[k]!=i)test_failed();
+            if(i>0&&memcmp(fbuf,fout[k],i*2*sizeof(float))!=0)test_failed();
+         }
+         cfgs++;
+      }
+      fprintf(stdout,"    opus_decode_batch_float() .................... OK.\n");
+#endif
+      for(k=0;k<4;k++)
+      {
+         opus_decoder_destroy(bdec[k]);
+         free(ref[k]);
+      }
+   }
+
+   /*Many CELT streams, with mixed channel counts, rates and frame sizes, are
+     synthesized together. That matches decoding each stream on its own up to
+     the rounding of the SIMD transforms. However many streams there are, the
+     batch fits in an arena of the two-channel decoder size.*/
+   {
+#define NB_BATCH 80
+      static const opus_int32 bfs[5]={48000,24000,16000,12000,8000};
+      OpusDecoder *bdec[NB_BATCH];
+      OpusDecoder *ref[NB_BATCH];
+      unsigned char bpackets[NB_BATCH][100];
+      const unsigned char *bdata[NB_BATCH];
+      opus_int32 blens[NB_BATCH];
+      short bout[NB_BATCH][960*2];
+      opus_int16 *bpcm[NB_BATCH];
+      int bret[NB_BATCH];
+      int sz[NB_BATCH];
+      int f,k;
+      unsigned char *bscratch;
+      bscratch=malloc(opus_decoder_get_scratch_size(2));
+      if(bscratch==NULL)test_failed();
+      err=opus_set_scratch_buffer(bscratch,opus_decoder_get_scratch_size(2));
+      if(err!=OPUS_OK&&err!=OPUS_UNIMPLEMENTED)test_failed();
+      for(k=0;k<NB_BATCH;k++)
+      {
+         int channels=1+(k&1);
+         bdec[k]=opus_decoder_create(bfs[k%5],channels,&err);
+         if(err!=OPUS_OK || bdec[k]==NULL)test_failed();
+         sz[k]=opus_decoder_get_size(channels);
+         ref[k]=malloc(sz[k]);
+         if(ref[k]==NULL)test_failed();
+         bpcm[k]=bout[k];
+      }
+      for(f=0;f<6;f++)
+      {
+         for(k=0;k<NB_BATCH;k++)
+         {
+            /*CELT configurations 16 to 31, with a stereo flag that does not
+              always match the decoder.*/
+            int config=16+(k*7+f*3)%16;
+            memcpy(ref[k],bdec[k],sz[k]);
+            blens[k]=20+(k*13+f*29)%80;
+            for(j=1;j<blens[k];j++)bpackets[k][j]=(unsigned char)(j*37+k*11+f*101);
+            bpackets[k][0]=(unsigned char)(config<<3|((k/3+f)&1)<<2);
+            bdata[k]=bpackets[k];
+            /*A few packets are lost, or go through SILK, so that the streams
+              around them take the general path.*/
+            if(f==2&&k%7==0)bdata[k]=NULL;
+            if(f==3&&k%5==1)bpackets[k][0]=(unsigned char)(1<<3);
+         }
+         if(opus_decode_batch(bdec,bdata,blens,bpcm,960,0,bret,NB_BATCH)!=OPUS_OK)test_failed();
+         for(k=0;k<NB_BATCH;k++)
+         {
+            i=opus_decode(ref[k],bdata[k],blens[k],sbuf,960,0);
+            if(bret[k]!=i)test_failed();
+            for(j=0;j<i*(1+(k&1));j++)
+               if(abs(sbuf[j]-bout[k][j])>1)test_failed();
+         }
+         cfgs++;
+      }
+      fprintf(stdout,"    opus_decode_batch() across CELT streams ...... OK.\n");
+#ifndef DISABLE_FLOAT_API
+      {
+         float fout[NB_BATCH][960*2];
+         float *bfpcm[NB_BATCH];
+         for(k=0;k<NB_BATCH;k++)
+         {
+            bfpcm[k]=fout[k];
+            memcpy(ref[k],bdec[k],sz[k]);
+         }
+         if(opus_decode_batch_float(bdec,bdata,blens,bfpcm,960,0,bret,NB_BATCH)!=OPUS_OK)test_failed();
+         for(k=0;k<NB_BATCH;k++)
+         {
+            i=opus_decode_float(ref[k],bdata[k],blens[k],fbuf,960,0);
+            if(bret[k]!=i)test_failed();
+            for(j=0;j<i*(1+(k&1));j++)
+            {
+               /*Random packets can decode far above full scale.*/
+               float d=fbuf[j]-fout[k][j];
+               float tol=1e-5f*(1+(fbuf[j]<0?-fbuf[j]:fbuf[j]));
+               if(d>tol||d<-tol)test_failed();
+            }
+         }
+         cfgs++;
+      }
+      fprintf(stdout,"    opus_decode_batch_float() across CELT streams  OK.\n");
+#endif
+      for(k=0;k<NB_BATCH;k++)
+      {
+         opus_decoder_destroy(bdec[k]);
+         free(ref[k]);
+      }
+      err=opus_set_scratch_buffer(NULL,0);
+      if(err!=OPUS_OK&&err!=OPUS_UNIMPLEMENTED)test_failed();
+      free(bscratch);
+#undef NB_BATCH
+   }
+
 #if 0
    /*These tests are disabled because the library crashes with null states*/
    if(opus_decoder_ctl(0,OPUS_RESET_STATE)         !=OPUS_INVALID_STATE)test_failed();
@@ -1092,7 +1326,7 @@ opus_int32 test_enc_api(void)
       for(i=-7;i<=96000;i++)
       {
          int fs;
-         if((i==8000||i==12000||i==16000||i==24000||i==48000)&&(c==1||c==2))continue;
+         if((i==8000||i==12000||i==16000||i==24000||i==44100||i==48000)&&(c==1||c==2))continue;
          switch(i)
          {
            case(-5):fs=-8000;break;
@@ -1295,6 +1529,20 @@ opus_int32 test_enc_api(void)
      "    OPUS_SET_COMPLEXITY .......................... OK.\n",
      "    OPUS_GET_COMPLEXITY .......................... OK.\n")
 
+   err=opus_encoder_ctl(enc,OPUS_GET_COMPLEXITY_BUDGET(null_int_ptr));
+   if(err!=OPUS_BAD_ARG)test_failed();
+   cfgs++;
+   CHECK_SETGET(OPUS_SET_COMPLEXITY_BUDGET(i),OPUS_GET_COMPLEXITY_BUDGET(&i),-1,-20000,
+     20000,0,
+     "    OPUS_SET_COMPLEXITY_BUDGET ................... OK.\n",
+     "    OPUS_GET_COMPLEXITY_BUDGET ................... OK.\n")
+
+   err=opus_encoder_ctl(enc,OPUS_GET_EFFECTIVE_COMPLEXITY(null_int_ptr));
+   if(err!=OPUS_BAD_ARG)test_failed();
+   if(opus_encoder_ctl(enc,OPUS_GET_EFFECTIVE_COMPLEXITY(&i))!=OPUS_OK||i!=10)test_failed();
+   cfgs+=2;
+   fprintf(stdout,"    OPUS_GET_EFFECTIVE_COMPLEXITY ................ OK.\n");
+
    err=opus_encoder_ctl(enc,OPUS_GET_INBAND_FEC(null_int_ptr));
    if(err!=OPUS_BAD_ARG)test_failed();
    cfgs++;
@@ -1426,6 +1674,279 @@ opus_int32 test_enc_api(void)
    fprintf(stdout,"    opus_encode_float() .......................... OK.\n");
 #endif
 
+   /*At 44.1 kHz, frames are multiples of 10 ms and a 1 kHz tone has to come
+     back at about the same level.*/
+   {
+      OpusEncoder *enc2;
+      OpusDecoder *dec2;
+      double s0, s1, s2, ein, eout;
+      int k;
+      enc2 = opus_encoder_create(44100, 2, OPUS_APPLICATION_AUDIO, &err);
+      if(err!=OPUS_OK || enc2==NULL)test_failed();
+      dec2 = opus_decoder_create(44100, 2, &err);
+      if(err!=OPUS_OK || dec2==NULL)test_failed();
+      cfgs++;
+      err=opus_encoder_ctl(enc2,OPUS_GET_SAMPLE_RATE(&i));
+      if(err!=OPUS_OK || i!=44100)test_failed();
+      cfgs++;
+      err=opus_encoder_ctl(enc2,OPUS_GET_LOOKAHEAD(&i));
+      if(err!=OPUS_OK || i<=0 || i>=312)test_failed();
+      cfgs++;
+      memset(sbuf,0,sizeof(short)*2*960);
+      if(opus_encode(enc2, sbuf, 110, packet, sizeof(packet))!=OPUS_BAD_ARG)test_failed();
+      cfgs++;
+      if(opus_encode(enc2, sbuf, 440, packet, sizeof(packet))!=OPUS_BAD_ARG)test_failed();
+      cfgs++;
+      if(OPUS_OK!=opus_encoder_ctl(enc2,OPUS_SET_BITRATE(64000)))test_failed();
+      s1=0;
+      s2=-0.14199431795762676;
+      ein=eout=0;
+      for(k=0;k<25;k++)
+      {
+         for(j=0;j<882;j++)
+         {
+            s0=1.9797349455598832*s1-s2;
+            s2=s1;
+            s1=s0;
+            sbuf[2*j]=sbuf[2*j+1]=(short)(s0*10000);
+            if(k>=5)ein+=(double)sbuf[2*j]*sbuf[2*j];
+         }
+         i=opus_encode(enc2, sbuf, 882, packet, sizeof(packet));
+         if(i<1 || (i>(opus_int32)sizeof(packet)))test_failed();
+         if(opus_packet_get_nb_samples(packet, i, 48000)!=960)test_failed();
+         if(opus_decode(dec2, packet, i, sbuf, 882, 0)!=882)test_failed();
+         for(j=0;j<882&&k>=5;j++)eout+=(double)sbuf[2*j]*sbuf[2*j];
+      }
+      if(eout<ein*0.7 || eout>ein*1.4)test_failed();
+      cfgs++;
+      opus_encoder_destroy(enc2);
+      opus_decoder_destroy(dec2);
+      fprintf(stdout,"    opus_encode() at 44.1 kHz .................... OK.\n");
+   }
+
+   /*Caller-supplied scratch arena.*/
+   {
+      unsigned char *scratch;
+      int ssz,k;
+      if(opus_encoder_get_scratch_size(0)!=0||opus_encoder_get_scratch_size(3)!=0)test_failed();
+      ssz=opus_encoder_get_scratch_size(1);
+      if(ssz<=0||opus_encoder_get_scratch_size(2)<ssz)test_failed();
+      ssz=opus_decoder_get_scratch_size(1);
+      if(ssz<=0||opus_decoder_get_scratch_size(2)<ssz)test_failed();
+      if(opus_decoder_get_scratch_size(0)!=0)test_failed();
+      cfgs+=6;
+      ssz=opus_encoder_get_scratch_size(2);
+      scratch=malloc(ssz);
+      if(scratch==NULL)test_failed();
+      memset(scratch,0xA5,ssz);
+      err=opus_set_scratch_buffer(scratch,ssz);
+      if(err==OPUS_OK)
+      {
+         if(opus_set_scratch_buffer(scratch,0)!=OPUS_BAD_ARG)test_failed();
+         if(opus_set_scratch_buffer(scratch,ssz)!=OPUS_OK)test_failed();
+         i=opus_encode(enc, sbuf, 960, packet, sizeof(packet));
+         if(i<1 || (i>(opus_int32)sizeof(packet)))test_failed();
+         /*The encoder must have drawn its temporaries from the arena.*/
+         for(k=0;k<ssz&&scratch[k]==0xA5;k++);
+         if(k==ssz)test_failed();
+         if(opus_set_scratch_buffer(NULL,0)!=OPUS_OK)test_failed();
+         cfgs+=4;
+         /*120 ms stereo frames at 44.1 kHz are the largest users of the
+           arena, with CELT and with VOIP at low rates. They must fit in
+           arenas of exactly the advertised sizes, since running past the end
+           fails the call.*/
+         {
+            static const opus_int32 srates[3]={48000,44100,44100};
+            OpusEncoder *senc;
+            OpusDecoder *sdec;
+            unsigned char *dscratch;
+            unsigned char *spkt;
+            short *spcm;
+            float *fpcm;
+            int dsz,r,f,fs;
+            dsz=opus_decoder_get_scratch_size(2);
+            dscratch=malloc(dsz);
+            spcm=malloc(sizeof(*spcm)*5760*2);
+            fpcm=malloc(sizeof(*fpcm)*5760*2);
+            /*Room for six full frames, so that the encoder buffers as much
+              as it can.*/
+            spkt=malloc(1276*6+12);
+            if(dscratch==NULL||spcm==NULL||fpcm==NULL||spkt==NULL)test_failed();
+            for(r=0;r<3;r++)
+            {
+               fs=srates[r]/25*3;
+               /*Restricted low delay always codes CELT.*/
+               senc=opus_encoder_create(srates[r],2,r<2?OPUS_APPLICATION_RESTRICTED_LOWDELAY:OPUS_APPLICATION_VOIP,&err);
+               if(err!=OPUS_OK||senc==NULL)test_failed();
+               if(r==2&&opus_encoder_ctl(senc,OPUS_SET_BITRATE(24000))!=OPUS_OK)test_failed();
+               sdec=opus_decoder_create(srates[r],2,&err);
+               if(err!=OPUS_OK||sdec==NULL)test_failed();
+               if(opus_encoder_ctl(senc,OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_120_MS))!=OPUS_OK)test_failed();
+               if(opus_encoder_ctl(senc,OPUS_SET_COMPLEXITY(10))!=OPUS_OK)test_failed();
+               for(f=0;f<4;f++)
+               {
+                  for(j=0;j<fs*2;j++)
+                  {
+                     spcm[j]=(short)((j*(f+3)*37)%20000-10000);
+                     fpcm[j]=spcm[j]*(1.f/32768);
+                  }
+                  if(opus_set_scratch_buffer(scratch,ssz)!=OPUS_OK)test_failed();
+                  if(f&1)i=opus_encode_float(senc,fpcm,fs,spkt,1276*6+12);
+                  else i=opus_encode(senc,spcm,fs,spkt,1276*6+12);
+                  if(i<1||i>1276*6+12)test_failed();
+                  if(opus_set_scratch_buffer(dscratch,dsz)!=OPUS_OK)test_failed();
+                  if(f&1)k=opus_decode_float(sdec,spkt,i,fpcm,fs,0);
+                  else k=opus_decode(sdec,spkt,i,spcm,fs,0);
+                  if(k!=fs)test_failed();
+                  if(opus_decode(sdec,NULL,0,spcm,fs,0)!=fs)test_failed();
+                  cfgs++;
+               }
+               opus_encoder_destroy(senc);
+               opus_decoder_destroy(sdec);
+            }
+            /*Running out of an arena that is too small fails the call
+              instead of aborting, and the state is usable again after a
+              reset.*/
+            senc=opus_encoder_create(48000,2,OPUS_APPLICATION_AUDIO,&err);
+            if(err!=OPUS_OK||senc==NULL)test_failed();
+            sdec=opus_decoder_create(48000,2,&err);
+            if(err!=OPUS_OK||sdec==NULL)test_failed();
+            for(j=0;j<960*2;j++)spcm[j]=(short)((j*41)%20000-10000);
+            if(opus_set_scratch_buffer(scratch,256)!=OPUS_OK)test_failed();
+            if(opus_encode(senc,spcm,960,spkt,1276)!=OPUS_ALLOC_FAIL)test_failed();
+            if(opus_set_scratch_buffer(scratch,ssz)!=OPUS_OK)test_failed();
+            if(opus_encoder_ctl(senc,OPUS_RESET_STATE)!=OPUS_OK)test_failed();
+            i=opus_encode(senc,spcm,960,spkt,1276);
+            if(i<1||i>1276)test_failed();
+            if(opus_set_scratch_buffer(dscratch,256)!=OPUS_OK)test_failed();
+            if(opus_decode(sdec,spkt,i,spcm,960,0)!=OPUS_ALLOC_FAIL)test_failed();
+            if(opus_set_scratch_buffer(dscratch,dsz)!=OPUS_OK)test_failed();
+            if(opus_decoder_ctl(sdec,OPUS_RESET_STATE)!=OPUS_OK)test_failed();
+            if(opus_decode(sdec,spkt,i,spcm,960,0)!=960)test_failed();
+            opus_encoder_destroy(senc);
+            opus_decoder_destroy(sdec);
+            cfgs+=6;
+            if(opus_set_scratch_buffer(NULL,0)!=OPUS_OK)test_failed();
+            free(dscratch);
+            free(spcm);
+            free(fpcm);
+            free(spkt);
+         }
+      }
+      else if(err!=OPUS_UNIMPLEMENTED)test_failed();
+      cfgs++;
+      free(scratch);
+      fprintf(stdout,"    opus_set_scratch_buffer() .................... OK.\n");
+   }
+
+   /*Per-stage profiling counters.*/
+   {
+      OpusProfileStats stats;
+      OpusDecoder *pdec;
+      opus_int32 len;
+      int k;
+      if(opus_encoder_ctl(enc,OPUS_GET_PROFILE_STATS((OpusProfileStats *)NULL))!=OPUS_BAD_ARG)test_failed();
+      cfgs++;
+      err=opus_encoder_ctl(enc,OPUS_RESET_PROFILE_STATS);
+      if(err==OPUS_OK)
+      {
+         for(k=0;k<960*2;k++)sbuf[k]=(short)((k*733)%4001-2000);
+         len=opus_encode(enc, sbuf, 960, packet, sizeof(packet));
+         if(len<1 || (len>(opus_int32)sizeof(packet)))test_failed();
+         if(opus_encoder_ctl(enc,OPUS_GET_PROFILE_STATS(&stats))!=OPUS_OK)test_failed();
+         if(stats.calls[OPUS_PROFILE_ENCODE]!=1)test_failed();
+         if(stats.calls[OPUS_PROFILE_SILK_ENCODE]+stats.calls[OPUS_PROFILE_CELT_ENCODE]<1)test_failed();
+         if(stats.calls[OPUS_PROFILE_DECODE]!=0)test_failed();
+         /*Stages are nested inside the whole encoder call.*/
+         if(stats.ticks[OPUS_PROFILE_CELT_ENCODE]>stats.ticks[OPUS_PROFILE_ENCODE])test_failed();
+         if(stats.ticks[OPUS_PROFILE_SILK_ENCODE]>stats.ticks[OPUS_PROFILE_ENCODE])test_failed();
+         /*OPUS_RESET_STATE keeps the counters.*/
+         if(opus_encoder_ctl(enc,OPUS_RESET_STATE)!=OPUS_OK)test_failed();
+         if(opus_encoder_ctl(enc,OPUS_GET_PROFILE_STATS(&stats))!=OPUS_OK)test_failed();
+         if(stats.calls[OPUS_PROFILE_ENCODE]!=1)test_failed();
+         if(opus_encoder_ctl(enc,OPUS_RESET_PROFILE_STATS)!=OPUS_OK)test_failed();
+         if(opus_encoder_ctl(enc,OPUS_GET_PROFILE_STATS(&stats))!=OPUS_OK)test_failed();
+         for(k=0;k<OPUS_PROFILE_NB_STAGES;k++)
+            if(stats.calls[k]!=0||stats.ticks[k]!=0)test_failed();
+         pdec=opus_decoder_create(48000,2,&err);
+         if(err!=OPUS_OK || pdec==NULL)test_failed();
+         if(opus_decode(pdec, packet, len, sbuf, 960, 0)!=960)test_failed();
+         if(opus_decode(pdec, NULL, 0, sbuf, 960, 0)!=960)test_failed();
+         if(opus_decoder_ctl(pdec,OPUS_GET_PROFILE_STATS(&stats))!=OPUS_OK)test_failed();
+         if(stats.calls[OPUS_PROFILE_DECODE]!=2)test_failed();
+         if(stats.calls[OPUS_PROFILE_ENCODE]!=0)test_failed();
+         if(opus_decoder_ctl(pdec,OPUS_RESET_PROFILE_STATS)!=OPUS_OK)test_failed();
+         if(opus_decoder_ctl(pdec,OPUS_GET_PROFILE_STATS(&stats))!=OPUS_OK)test_failed();
+         if(stats.calls[OPUS_PROFILE_DECODE]!=0)test_failed();
+         opus_decoder_destroy(pdec);
+         /*Each stream of a batch is charged once per stage, and the shared
+           synthesis keeps the stages nested.*/
+         {
+            static const opus_int32 pfs[3]={48000,48000,16000};
+            OpusDecoder *pbdec[3];
+            unsigned char pbpackets[3][60];
+            const unsigned char *pbdata[3];
+            opus_int32 pblens[3];
+            short pbout[3][960*2];
+            opus_int16 *pbpcm[3];
+            int pbret[3];
+            for(k=0;k<3;k++)
+            {
+               pbdec[k]=opus_decoder_create(pfs[k],2-(k>0),&err);
+               if(err!=OPUS_OK || pbdec[k]==NULL)test_failed();
+               for(j=1;j<60;j++)pbpackets[k][j]=(unsigned char)(j*37+k*11);
+               pbpackets[k][0]=(unsigned char)(31<<3|(k==0)<<2);
+               pbdata[k]=pbpackets[k];
+               pblens[k]=60;
+               pbpcm[k]=pbout[k];
+            }
+            if(opus_decode_batch(pbdec,pbdata,pblens,pbpcm,960,0,pbret,3)!=OPUS_OK)test_failed();
+            for(k=0;k<3;k++)
+            {
+               if(pbret[k]!=pfs[k]/50)test_failed();
+               if(opus_decoder_ctl(pbdec[k],OPUS_GET_PROFILE_STATS(&stats))!=OPUS_OK)test_failed();
+               if(stats.calls[OPUS_PROFILE_DECODE]!=1)test_failed();
+               if(stats.calls[OPUS_PROFILE_CELT_DECODE]!=1)test_failed();
+               if(stats.calls[OPUS_PROFILE_CELT_MDCT]!=1)test_failed();
+               if(stats.ticks[OPUS_PROFILE_CELT_MDCT]>stats.ticks[OPUS_PROFILE_CELT_DECODE])test_failed();
+               if(stats.ticks[OPUS_PROFILE_CELT_DECODE]>stats.ticks[OPUS_PROFILE_DECODE])test_failed();
+               opus_decoder_destroy(pbdec[k]);
+            }
+         }
+         cfgs+=10;
+      }
+      else if(err!=OPUS_UNIMPLEMENTED||opus_encoder_ctl(enc,OPUS_GET_PROFILE_STATS(&stats))!=OPUS_UNIMPLEMENTED)test_failed();
+      cfgs++;
+      fprintf(stdout,"    OPUS_GET_PROFILE_STATS ....................... OK.\n");
+   }
+
+   /*CPU time budget: an impossible budget must bring the complexity down to
+     0 without touching the configured value, and a generous one must keep
+     or restore it.*/
+   {
+      int k;
+      if(opus_encoder_ctl(enc,OPUS_SET_COMPLEXITY(10))!=OPUS_OK)test_failed();
+      if(opus_encoder_ctl(enc,OPUS_SET_COMPLEXITY_BUDGET(1))!=OPUS_OK)test_failed();
+      for(k=0;k<8;k++)
+      {
+         i=opus_encode(enc, sbuf, 960, packet, sizeof(packet));
+         if(i<1 || (i>(opus_int32)sizeof(packet)))test_failed();
+      }
+      if(opus_encoder_ctl(enc,OPUS_GET_EFFECTIVE_COMPLEXITY(&i))!=OPUS_OK||i!=0)test_failed();
+      if(opus_encoder_ctl(enc,OPUS_GET_COMPLEXITY(&i))!=OPUS_OK||i!=10)test_failed();
+      if(opus_encoder_ctl(enc,OPUS_SET_COMPLEXITY_BUDGET(1000000))!=OPUS_OK)test_failed();
+      if(opus_encoder_ctl(enc,OPUS_GET_EFFECTIVE_COMPLEXITY(&i))!=OPUS_OK||i!=10)test_failed();
+      for(k=0;k<8;k++)
+      {
+         i=opus_encode(enc, sbuf, 960, packet, sizeof(packet));
+         if(i<1 || (i>(opus_int32)sizeof(packet)))test_failed();
+      }
+      if(opus_encoder_ctl(enc,OPUS_GET_EFFECTIVE_COMPLEXITY(&i))!=OPUS_OK||i!=10)test_failed();
+      if(opus_encoder_ctl(enc,OPUS_SET_COMPLEXITY_BUDGET(0))!=OPUS_OK)test_failed();
+      cfgs+=9;
+      fprintf(stdout,"    OPUS_SET_COMPLEXITY_BUDGET governor .......... OK.\n");
+   }
+
 #if 0
    /*These tests are disabled because the library crashes with null states*/
    if(opus_encoder_ctl(0,OPUS_RESET_STATE)               !=OPUS_INVALID_STATE)test_failed();
@@ -380,6 +380,124 @@ int test_decoder_code0(int no_fuzz)
    return 0;
 }
 
+/* Decodes the same CELT and hybrid packets with and without
+   OPUS_SET_REDUCED_SYNTHESIS and checks that the levels of the received
+   frames match. The reduced-rate output is not bit-exact, so the
+   comparison allows for the approximated de-emphasis and post-filter. */
+void test_reduced_synthesis(void)
+{
+   static const opus_int32 rates[4]={8000,12000,16000,24000};
+   static const int apps[2]={OPUS_APPLICATION_RESTRICTED_LOWDELAY,OPUS_APPLICATION_AUDIO};
+   static const opus_int32 bitrates[2]={48000,20000};
+   const int frame_size=960;
+   const int nb_frames=100;
+   unsigned char *packets;
+   opus_int32 *lens;
+   short *pcm;
+   short *out[2];
+   int a;
+   fprintf(stdout,"  Testing OPUS_SET_REDUCED_SYNTHESIS...\n");
+   packets=malloc(nb_frames*MAX_PACKET);
+   lens=malloc(nb_frames*sizeof(*lens));
+   pcm=malloc(frame_size*nb_frames*2*sizeof(*pcm));
+   out[0]=malloc(frame_size*nb_frames*2*sizeof(*out[0]));
+   out[1]=malloc(frame_size*nb_frames*2*sizeof(*out[1]));
+   if(!packets||!lens||!pcm||!out[0]||!out[1])test_failed();
+   for(a=0;a<4;a++)
+   {
+      OpusEncoder *enc;
+      int channels;
+      int err;
+      int i;
+      channels=1+(a&1);
+      enc=opus_encoder_create(48000,channels,apps[a>>1],&err);
+      if(err!=OPUS_OK||!enc)test_failed();
+      if(opus_encoder_ctl(enc,OPUS_SET_BITRATE(bitrates[a>>1]))!=OPUS_OK)test_failed();
+      for(i=0;i<frame_size*nb_frames;i++)
+      {
+         int c;
+         for(c=0;c<channels;c++)
+         {
+            double t=i/48000.;
+            double v=6000*sin(2*M_PI*(220+3*c)*t)+2000*sin(2*M_PI*1375*t+c)+800*sin(2*M_PI*3100*t);
+            v+=((int)(fast_rand()&65535)-32768)/40.;
+            pcm[i*channels+c]=(short)v;
+         }
+      }
+      for(i=0;i<nb_frames;i++)
+      {
+         lens[i]=opus_encode(enc,pcm+i*frame_size*channels,frame_size,packets+i*MAX_PACKET,MAX_PACKET);
+         if(lens[i]<=0)test_failed();
+      }
+      opus_encoder_destroy(enc);
+      for(i=0;i<4;i++)
+      {
+         int n;
+         int dec_channels;
+         int k;
+         int j;
+         double max_diff;
+         double sum_diff;
+         int count;
+         n=frame_size*rates[i]/48000;
+         /* Decode stereo as mono and mono as stereo on every other rate. */
+         dec_channels=(i&1)?3-channels:channels;
+         for(k=0;k<2;k++)
+         {
+            OpusDecoder *dec;
+            opus_int32 value;
+            dec=opus_decoder_create(rates[i],dec_channels,&err);
+            if(err!=OPUS_OK||!dec)test_failed();
+            err=opus_decoder_ctl(dec,OPUS_SET_REDUCED_SYNTHESIS(k));
+            if(err==OPUS_UNIMPLEMENTED)
+            {
+               opus_decoder_destroy(dec);
+               break;
+            }
+            if(err!=OPUS_OK)test_failed();
+            if(opus_decoder_ctl(dec,OPUS_GET_REDUCED_SYNTHESIS(&value))!=OPUS_OK||value!=k)test_failed();
+            for(j=0;j<nb_frames;j++)
+            {
+               /* Exercise the concealment, but only compare received frames. */
+               int lost=(j%10==7);
+               if(opus_decode(dec,lost?NULL:packets+j*MAX_PACKET,lost?0:lens[j],
+                     out[k]+j*n*dec_channels,n,0)!=n)test_failed();
+            }
+            opus_decoder_destroy(dec);
+         }
+         if(k<2)continue;
+         max_diff=sum_diff=0;
+         count=0;
+         for(j=2;j<nb_frames;j++)
+         {
+            double e0;
+            double e1;
+            double diff;
+            int l;
+            if(j%10==7||j%10==8)continue;
+            e0=e1=1;
+            for(l=0;l<n*dec_channels;l++)
+            {
+               e0+=(double)out[0][j*n*dec_channels+l]*out[0][j*n*dec_channels+l];
+               e1+=(double)out[1][j*n*dec_channels+l]*out[1][j*n*dec_channels+l];
+            }
+            diff=fabs(10*log10(e1/e0));
+            if(diff>max_diff)max_diff=diff;
+            sum_diff+=diff;
+            count++;
+         }
+         if(max_diff>3||sum_diff>count)test_failed();
+         fprintf(stdout,"    %s %d->%d channels at %5d Hz: max %.2f dB, mean %.2f dB level difference OK.\n",
+               a>>1?"hybrid":"CELT",channels,dec_channels,rates[i],max_diff,sum_diff/count);
+      }
+   }
+   free(out[1]);
+   free(out[0]);
+   free(pcm);
+   free(lens);
+   free(packets);
+}
+
 #ifndef DISABLE_FLOAT_API
 void test_soft_clip(void)
 {
@@ -455,6 +573,7 @@ int main(int _argc, char **_argv)
      into the decoders. This is helpful because garbage data
      may cause the decoders to clip, which angers CLANG IOC.*/
    test_decoder_code0(getenv("TEST_OPUS_NOFUZZ")!=NULL);
+   test_reduced_synthesis();
 #ifndef DISABLE_FLOAT_API
    test_soft_clip();
 #endif
@@ -43,6 +43,9 @@
 #define getpid _getpid
 #endif
 #include "opus_multistream.h"
+#include "opus_group.h"
+#include "opus_transrater.h"
+#include "opus_probe.h"
 #include "opus.h"
 #include "../src/opus_private.h"
 #include "test_opus_common.h"
@@ -629,6 +632,463 @@ int run_test1(int no_fuzz)
    return 0;
 }
 
+/*Runs the jobs in reverse order, so that any dependency between streams
+  shows up as a mismatch against the serial encoder.*/
+static void reverse_executor(void *data, opus_job_func job, void *arg, int count)
+{
+   int i;
+   (*(int*)data)++;
+   for(i=count-1;i>=0;i--)job(arg,i);
+}
+
+int run_test_ms_executor(void)
+{
+   static const int families[3]={1,1,2};
+   static const int channels[3]={6,8,9};
+   static const int fsizes[4]={120,480,960,2880};
+   unsigned char mapping[256];
+   unsigned char *packet;
+   unsigned char *packet2;
+   short *inbuf;
+   short *outbuf;
+   short *outbuf2;
+   int t;
+
+   fprintf(stdout,"  Multistream executor tests.\n");
+   inbuf=(short *)malloc(sizeof(*inbuf)*9*48000);
+   outbuf=(short *)malloc(sizeof(*outbuf)*9*2880);
+   outbuf2=(short *)malloc(sizeof(*outbuf2)*9*2880);
+   packet=(unsigned char *)malloc(16*(6*1275+12));
+   packet2=(unsigned char *)malloc(16*(6*1275+12));
+   if(inbuf==NULL||outbuf==NULL||outbuf2==NULL||packet==NULL||packet2==NULL)test_failed();
+   for(t=0;t<(int)(9*48000);t++)inbuf[t]=(short)((fast_rand()&0x3FFF)-0x2000);
+   generate_music(inbuf,9*48000/2);
+   for(t=0;t<3;t++)
+   {
+      OpusMSEncoder *ref;
+      OpusMSEncoder *par;
+      OpusMSDecoder *dref;
+      OpusMSDecoder *dpar;
+      int streams,coupled,err,calls,dcalls,cbr_calls,i,f;
+      ref=opus_multistream_surround_encoder_create(48000,channels[t],families[t],&streams,&coupled,mapping,OPUS_APPLICATION_AUDIO,&err);
+      if(err!=OPUS_OK||ref==NULL)test_failed();
+      par=opus_multistream_surround_encoder_create(48000,channels[t],families[t],&streams,&coupled,mapping,OPUS_APPLICATION_AUDIO,&err);
+      if(err!=OPUS_OK||par==NULL)test_failed();
+      calls=0;
+      cbr_calls=0;
+      if(opus_multistream_encoder_ctl(par,OPUS_MULTISTREAM_SET_EXECUTOR(reverse_executor,&calls))!=OPUS_OK)test_failed();
+      dref=opus_multistream_decoder_create(48000,channels[t],streams,coupled,mapping,&err);
+      if(err!=OPUS_OK||dref==NULL)test_failed();
+      dpar=opus_multistream_decoder_create(48000,channels[t],streams,coupled,mapping,&err);
+      if(err!=OPUS_OK||dpar==NULL)test_failed();
+      dcalls=0;
+      if(opus_multistream_decoder_ctl(dpar,OPUS_MULTISTREAM_SET_EXECUTOR(reverse_executor,&dcalls))!=OPUS_OK)test_failed();
+      for(f=0,i=0;f<40;f++)
+      {
+         int len,len2,fs,out,out2,before,expect;
+         opus_int32 max_bytes;
+         fs=fsizes[f&3];
+         /*A 1400 byte per stream buffer is enough for the executor up to
+           20 ms in VBR; smaller buffers must fall back to the serial path.*/
+         if((f&7)==7)max_bytes=MAX_PACKET;
+         else if((f&7)==3||(f&7)==6)max_bytes=streams*1400;
+         else max_bytes=streams*(6*1275+12);
+         expect=(f&7)!=7&&(max_bytes!=streams*1400||fs<=960);
+         if((f&15)==0)
+         {
+            opus_int32 rate=channels[t]*(16000+fast_rand()%64000);
+            if(opus_multistream_encoder_ctl(ref,OPUS_SET_BITRATE(rate))!=OPUS_OK)test_failed();
+            if(opus_multistream_encoder_ctl(par,OPUS_SET_BITRATE(rate))!=OPUS_OK)test_failed();
+         }
+         /*In CBR all but the last stream go through the executor.*/
+         if(f==24)
+         {
+            if(opus_multistream_encoder_ctl(ref,OPUS_SET_VBR(0))!=OPUS_OK)test_failed();
+            if(opus_multistream_encoder_ctl(par,OPUS_SET_VBR(0))!=OPUS_OK)test_failed();
+            cbr_calls=calls;
+         }
+         if(i+fs*channels[t]>9*48000)i=0;
+         before=calls;
+         len=opus_multistream_encode(ref,&inbuf[i],fs,packet,max_bytes);
+         len2=opus_multistream_encode(par,&inbuf[i],fs,packet2,max_bytes);
+         if(len<=0||len!=len2||memcmp(packet,packet2,len)!=0)test_failed();
+         /*In CBR, whether a stream is guaranteed its full size whatever the
+           others take depends on the bitrate split, so only check that the
+           executor was used at all.*/
+         if(f<24&&(calls!=before)!=expect)test_failed();
+         /*Every fifth frame is lost and concealed.*/
+         if(f%5==4)len=0;
+         out=opus_multistream_decode(dref,len?packet:NULL,len,outbuf,fs,0);
+         out2=opus_multistream_decode(dpar,len?packet:NULL,len,outbuf2,fs,0);
+         if(out!=fs||out2!=fs||memcmp(outbuf,outbuf2,sizeof(*outbuf)*fs*channels[t])!=0)test_failed();
+         i+=fs*channels[t];
+      }
+      if(calls==cbr_calls||dcalls!=40)test_failed();
+      opus_multistream_encoder_destroy(ref);
+      opus_multistream_encoder_destroy(par);
+      opus_multistream_decoder_destroy(dref);
+      opus_multistream_decoder_destroy(dpar);
+      fprintf(stdout,"    %d channel%s parallel encode and decode match serial, %d frames OK.\n",channels[t],families[t]==2?" ambisonic":"",f);
+   }
+   free(inbuf);
+   free(outbuf);
+   free(outbuf2);
+   free(packet);
+   free(packet2);
+   return 0;
+}
+
+int run_test_planar(void)
+{
+   static const int fsizes[4]={120,480,960,2880};
+   unsigned char mapping[256];
+   unsigned char *packet;
+   unsigned char *packet2;
+   short *inbuf;
+   short *outbuf;
+   short *planar;
+   short *planes[6];
+   int t;
+
+   fprintf(stdout,"  Planar API tests.\n");
+   inbuf=(short *)malloc(sizeof(*inbuf)*6*48000);
+   outbuf=(short *)malloc(sizeof(*outbuf)*6*2880);
+   planar=(short *)malloc(sizeof(*planar)*6*2880);
+   packet=(unsigned char *)malloc(6*1275+12);
+   packet2=(unsigned char *)malloc(6*1275+12);
+   if(inbuf==NULL||outbuf==NULL||planar==NULL||packet==NULL||packet2==NULL)test_failed();
+   generate_music(inbuf,6*48000/2);
+   for(t=0;t<6;t++)planes[t]=planar+t*2880;
+   /*Stereo single-stream and 5.1 multistream, each interleaved versus planar.*/
+   for(t=0;t<2;t++)
+   {
+      OpusEncoder *enc=NULL,*enc2=NULL;
+      OpusDecoder *dec=NULL,*dec2=NULL;
+      OpusMSEncoder *msenc=NULL,*msenc2=NULL;
+      OpusMSDecoder *msdec=NULL,*msdec2=NULL;
+      int channels,streams,coupled,err,i,f,c,k;
+      channels=t?6:2;
+      if(t==0)
+      {
+         enc=opus_encoder_create(48000,2,OPUS_APPLICATION_AUDIO,&err);
+         if(err!=OPUS_OK||enc==NULL)test_failed();
+         enc2=opus_encoder_create(48000,2,OPUS_APPLICATION_AUDIO,&err);
+         if(err!=OPUS_OK||enc2==NULL)test_failed();
+         dec=opus_decoder_create(48000,2,&err);
+         if(err!=OPUS_OK||dec==NULL)test_failed();
+         dec2=opus_decoder_create(48000,2,&err);
+         if(err!=OPUS_OK||dec2==NULL)test_failed();
+      } else {
+         msenc=opus_multistream_surround_encoder_create(48000,6,1,&streams,&coupled,mapping,OPUS_APPLICATION_AUDIO,&err);
+         if(err!=OPUS_OK||msenc==NULL)test_failed();
+         msenc2=opus_multistream_surround_encoder_create(48000,6,1,&streams,&coupled,mapping,OPUS_APPLICATION_AUDIO,&err);
+         if(err!=OPUS_OK||msenc2==NULL)test_failed();
+         msdec=opus_multistream_decoder_create(48000,6,streams,coupled,mapping,&err);
+         if(err!=OPUS_OK||msdec==NULL)test_failed();
+         msdec2=opus_multistream_decoder_create(48000,6,streams,coupled,mapping,&err);
+         if(err!=OPUS_OK||msdec2==NULL)test_failed();
+      }
+      for(f=0,i=0;f<40;f++)
+      {
+         int len,len2,out,out2,fs;
+         fs=fsizes[f&3];
+         if(i+fs*channels>6*48000)i=0;
+         for(c=0;c<channels;c++)
+            for(k=0;k<fs;k++)planes[c][k]=inbuf[i+k*channels+c];
+         if(t==0)
+         {
+            len=opus_encode(enc,&inbuf[i],fs,packet,6*1275+12);
+            len2=opus_encode_planar(enc2,(const opus_int16 * const *)planes,fs,packet2,6*1275+12);
+         } else {
+            len=opus_multistream_encode(msenc,&inbuf[i],fs,packet,6*1275+12);
+            len2=opus_multistream_encode_planar(msenc2,(const opus_int16 * const *)planes,fs,packet2,6*1275+12);
+         }
+         if(len<=0||len!=len2||memcmp(packet,packet2,len)!=0)test_failed();
+         /*Every fifth frame is lost and concealed.*/
+         if(f%5==4)len=0;
+         if(t==0)
+         {
+            out=opus_decode(dec,len?packet:NULL,len,outbuf,fs,0);
+            out2=opus_decode_planar(dec2,len?packet:NULL,len,planes,fs,0);
+         } else {
+            out=opus_multistream_decode(msdec,len?packet:NULL,len,outbuf,fs,0);
+            out2=opus_multistream_decode_planar(msdec2,len?packet:NULL,len,planes,fs,0);
+         }
+         if(out!=fs||out2!=fs)test_failed();
+         for(c=0;c<channels;c++)
+            for(k=0;k<fs;k++)
+               if(planes[c][k]!=outbuf[k*channels+c])test_failed();
+         i+=fs*channels;
+      }
+      if(t==0)
+      {
+         opus_encoder_destroy(enc);
+         opus_encoder_destroy(enc2);
+         opus_decoder_destroy(dec);
+         opus_decoder_destroy(dec2);
+      } else {
+         opus_multistream_encoder_destroy(msenc);
+         opus_multistream_encoder_destroy(msenc2);
+         opus_multistream_decoder_destroy(msdec);
+         opus_multistream_decoder_destroy(msdec2);
+      }
+      fprintf(stdout,"    %s planar encode and decode match interleaved, %d frames OK.\n",t?"5.1 multistream":"Stereo",f);
+   }
+   free(inbuf);
+   free(outbuf);
+   free(planar);
+   free(packet);
+   free(packet2);
+   return 0;
+}
+
+int run_test_group(void)
+{
+   static const int fsizes[5]={120,480,960,2880,5760};
+   static const opus_int32 rates[4]={16000,48000,96000,128000};
+   unsigned char *packet;
+   unsigned char *packet2;
+   opus_int32 len[4];
+   short *inbuf;
+   OpusGroupEncoder *group;
+   OpusEncoder *ref[4];
+   OpusEncoder *enc;
+   opus_int32 val;
+   int err,i,f,r;
+
+   fprintf(stdout,"  Group encoder tests.\n");
+   inbuf=(short *)malloc(sizeof(*inbuf)*2*48000*4);
+   packet=(unsigned char *)malloc(4*MAX_PACKET);
+   packet2=(unsigned char *)malloc(MAX_PACKET);
+   if(inbuf==NULL||packet==NULL||packet2==NULL)test_failed();
+   generate_music(inbuf,48000*4);
+   if(opus_group_encoder_get_size(3,2)!=0)test_failed();
+   if(opus_group_encoder_get_size(2,0)!=0)test_failed();
+   if(opus_group_encoder_create(48000,2,256,NULL,OPUS_APPLICATION_AUDIO,&err)!=NULL||err!=OPUS_BAD_ARG)test_failed();
+   group=opus_group_encoder_create(48000,2,4,rates,OPUS_APPLICATION_AUDIO,&err);
+   if(err!=OPUS_OK||group==NULL)test_failed();
+   if(opus_group_encoder_ctl(group,OPUS_GROUP_GET_ENCODER_STATE(4,&enc))!=OPUS_BAD_ARG)test_failed();
+   if(opus_group_encoder_ctl(group,OPUS_SET_BITRATE(64000))!=OPUS_UNIMPLEMENTED)test_failed();
+   if(opus_group_encoder_ctl(group,OPUS_SET_COMPLEXITY(10))!=OPUS_OK)test_failed();
+   if(opus_group_encoder_ctl(group,OPUS_GET_BITRATE(&val))!=OPUS_OK||val!=rates[0]+rates[1]+rates[2]+rates[3])test_failed();
+   /*The first rendition does not run the analysis, so the second one
+     shares it with the others. The last two are coded in CELT-only mode
+     and share the coarse pitch search.*/
+   if(opus_group_encoder_ctl(group,OPUS_GROUP_GET_ENCODER_STATE(0,&enc))!=OPUS_OK)test_failed();
+   if(opus_encoder_ctl(enc,OPUS_SET_COMPLEXITY(5))!=OPUS_OK)test_failed();
+   for(r=0;r<4;r++)
+   {
+      ref[r]=opus_encoder_create(48000,2,OPUS_APPLICATION_AUDIO,&err);
+      if(err!=OPUS_OK||ref[r]==NULL)test_failed();
+      if(opus_encoder_ctl(ref[r],OPUS_SET_BITRATE(rates[r]))!=OPUS_OK)test_failed();
+      if(opus_encoder_ctl(ref[r],OPUS_SET_COMPLEXITY(r==0?5:10))!=OPUS_OK)test_failed();
+   }
+   for(f=0,i=0;f<60;f++)
+   {
+      int fs=fsizes[f%5];
+      if(i+fs*2>2*48000*4)i=0;
+      if(opus_group_encode(group,&inbuf[i],fs,packet,MAX_PACKET,len)!=OPUS_OK)test_failed();
+      for(r=0;r<4;r++)
+      {
+         int len2=opus_encode(ref[r],&inbuf[i],fs,packet2,MAX_PACKET);
+         if(len[r]<=0||len[r]!=len2||memcmp(packet+r*MAX_PACKET,packet2,len2)!=0)test_failed();
+      }
+      i+=fs*2;
+   }
+   if(opus_group_encoder_ctl(group,OPUS_RESET_STATE)!=OPUS_OK)test_failed();
+   for(r=0;r<4;r++)opus_encoder_destroy(ref[r]);
+   opus_group_encoder_destroy(group);
+   fprintf(stdout,"    Group renditions match independent encoders, %d frames OK.\n",f);
+   free(inbuf);
+   free(packet);
+   free(packet2);
+   return 0;
+}
+
+int run_test_transrater(void)
+{
+   static const int fsizes[6]={120,240,480,960,1920,2880};
+   unsigned char *packet;
+   unsigned char *packet2;
+   short *inbuf;
+   short *outbuf;
+   short *outbuf2;
+   OpusEncoder *enc;
+   OpusDecoder *dec;
+   OpusDecoder *dref;
+   OpusTransrater *tr;
+   opus_int32 val;
+   opus_int32 in_bytes, out_bytes;
+   opus_uint32 dec_final_range, tr_final_range;
+   double e_ref,e_err;
+   int err,i,j,f,len,len2;
+
+   fprintf(stdout,"  Transrater tests.\n");
+   inbuf=(short *)malloc(sizeof(*inbuf)*2*48000*4);
+   outbuf=(short *)malloc(sizeof(*outbuf)*2*5760);
+   outbuf2=(short *)malloc(sizeof(*outbuf2)*2*5760);
+   packet=(unsigned char *)malloc(MAX_PACKET);
+   packet2=(unsigned char *)malloc(MAX_PACKET);
+   if(inbuf==NULL||outbuf==NULL||outbuf2==NULL||packet==NULL||packet2==NULL)test_failed();
+   generate_music(inbuf,48000*4);
+   if(opus_transrater_create(0,&err)!=NULL||err!=OPUS_BAD_ARG)test_failed();
+   tr=opus_transrater_create(32000,&err);
+   if(err!=OPUS_OK||tr==NULL)test_failed();
+   if(opus_transrater_ctl(tr,OPUS_GET_BITRATE(&val))!=OPUS_OK||val!=32000)test_failed();
+   if(opus_transrater_ctl(tr,OPUS_SET_COMPLEXITY(11))!=OPUS_BAD_ARG)test_failed();
+   if(opus_transrater_ctl(tr,OPUS_SET_COMPLEXITY(10))!=OPUS_OK)test_failed();
+   if(opus_transrater_ctl(tr,OPUS_SET_VBR(0))!=OPUS_UNIMPLEMENTED)test_failed();
+   enc=opus_encoder_create(48000,2,OPUS_APPLICATION_AUDIO,&err);
+   if(err!=OPUS_OK||enc==NULL)test_failed();
+   dec=opus_decoder_create(48000,2,&err);
+   if(err!=OPUS_OK||dec==NULL)test_failed();
+   dref=opus_decoder_create(48000,2,&err);
+   if(err!=OPUS_OK||dref==NULL)test_failed();
+   if(opus_encoder_ctl(enc,OPUS_SET_BITRATE(128000))!=OPUS_OK)test_failed();
+   if(opus_encoder_ctl(enc,OPUS_SET_FORCE_MODE(MODE_CELT_ONLY))!=OPUS_OK)test_failed();
+   in_bytes=out_bytes=0;
+   e_ref=e_err=0;
+   for(f=0,i=0;f<120;f++)
+   {
+      int fs=fsizes[f%6];
+      if(i+fs*2>2*48000*4)i=0;
+      /*Switch to a mono stream in the middle to exercise the energy
+        prediction across channel changes.*/
+      if(f==60&&opus_encoder_ctl(enc,OPUS_SET_FORCE_CHANNELS(1))!=OPUS_OK)test_failed();
+      len=opus_encode(enc,&inbuf[i],fs,packet,MAX_PACKET);
+      if(len<=0)test_failed();
+      if(opus_transrate(tr,packet,len,packet2,1)!=OPUS_BUFFER_TOO_SMALL)test_failed();
+      len2=opus_transrate(tr,packet,len,packet2,MAX_PACKET);
+      if(len2<=0||len2>len)test_failed();
+      if(opus_packet_get_nb_samples(packet2,len2,48000)!=fs)test_failed();
+      if(opus_decode(dec,packet2,len2,outbuf,fs,0)!=fs)test_failed();
+      /*The output must be in sync with what a decoder sees.*/
+      if(opus_decoder_ctl(dec,OPUS_GET_FINAL_RANGE(&dec_final_range))!=OPUS_OK)test_failed();
+      if(opus_transrater_ctl(tr,OPUS_GET_FINAL_RANGE(&tr_final_range))!=OPUS_OK)test_failed();
+      if(dec_final_range!=tr_final_range)test_failed();
+      /*Compare with the decode of the original packet.*/
+      if(opus_decode(dref,packet,len,outbuf2,fs,0)!=fs)test_failed();
+      for(j=0;j<fs*2;j++)
+      {
+         e_ref+=(double)outbuf2[j]*outbuf2[j];
+         e_err+=(double)(outbuf2[j]-outbuf[j])*(outbuf2[j]-outbuf[j]);
+      }
+      in_bytes+=len;
+      out_bytes+=len2;
+      i+=fs*2;
+   }
+   if(out_bytes>=in_bytes/2)test_failed();
+   /*At a quarter of the rate, the output must stay within 12 dB SNR of
+     the decoded input (about 15 dB in practice).*/
+   if(10*log10(e_ref/e_err)<12)test_failed();
+   /*SILK packets are not supported.*/
+   if(opus_encoder_ctl(enc,OPUS_SET_FORCE_MODE(MODE_SILK_ONLY))!=OPUS_OK)test_failed();
+   len=opus_encode(enc,inbuf,960,packet,MAX_PACKET);
+   if(len<=0)test_failed();
+   if(opus_transrate(tr,packet,len,packet2,MAX_PACKET)!=OPUS_UNIMPLEMENTED)test_failed();
+   if(opus_transrater_ctl(tr,OPUS_RESET_STATE)!=OPUS_OK)test_failed();
+   opus_encoder_destroy(enc);
+   opus_decoder_destroy(dec);
+   opus_decoder_destroy(dref);
+   opus_transrater_destroy(tr);
+   fprintf(stdout,"    Transrated %d packets from %d to %d bytes, %.1f dB SNR OK.\n",f,(int)in_bytes,(int)out_bytes,10*log10(e_ref/e_err));
+   free(inbuf);
+   free(outbuf);
+   free(outbuf2);
+   free(packet);
+   free(packet2);
+   return 0;
+}
+
+
+int run_test_probe(void)
+{
+   static const int modes[3]={MODE_CELT_ONLY,MODE_SILK_ONLY,MODE_HYBRID};
+   static const int fsizes[3]={960,1920,480};
+   unsigned char *packet;
+   short *inbuf;
+   short *outbuf;
+   OpusEncoder *enc;
+   OpusDecoder *dec;
+   OpusProbe *probe;
+   opus_int16 level[48];
+   unsigned char active[48];
+   double e,p,e_sum,p_sum;
+   int err,i,j,k,m,f,n,len,count,fs,nb_blocks,nb_off;
+
+   fprintf(stdout,"  Probe tests.\n");
+   inbuf=(short *)malloc(sizeof(*inbuf)*2*48000*4);
+   outbuf=(short *)malloc(sizeof(*outbuf)*2*5760);
+   packet=(unsigned char *)malloc(MAX_PACKET);
+   if(inbuf==NULL||outbuf==NULL||packet==NULL)test_failed();
+   probe=opus_probe_create(&err);
+   if(err!=OPUS_OK||probe==NULL)test_failed();
+   packet[0]=0x03;
+   packet[1]=0;
+   if(opus_probe_packet(probe,packet,0,level,active)!=OPUS_BAD_ARG)test_failed();
+   if(opus_probe_packet(probe,packet,2,level,active)!=OPUS_INVALID_PACKET)test_failed();
+   nb_blocks=0;
+   nb_off=0;
+   for(m=0;m<3;m++)
+   {
+      generate_music(inbuf,48000*4);
+      enc=opus_encoder_create(48000,2,OPUS_APPLICATION_AUDIO,&err);
+      if(err!=OPUS_OK||enc==NULL)test_failed();
+      dec=opus_decoder_create(48000,2,&err);
+      if(err!=OPUS_OK||dec==NULL)test_failed();
+      if(opus_encoder_ctl(enc,OPUS_SET_FORCE_MODE(modes[m]))!=OPUS_OK)test_failed();
+      if(opus_encoder_ctl(enc,OPUS_SET_BITRATE(48000))!=OPUS_OK)test_failed();
+      if(opus_probe_init(probe)!=OPUS_OK)test_failed();
+      fs=fsizes[m];
+      e_sum=p_sum=0;
+      for(f=0,i=0;f<80;f++)
+      {
+         /*Digital silence for the last 20 frames.*/
+         if(f>=60)memset(&inbuf[i],0,sizeof(*inbuf)*fs*2);
+         len=opus_encode(enc,&inbuf[i],fs,packet,MAX_PACKET);
+         if(len<=0)test_failed();
+         count=opus_probe_packet(probe,packet,len,level,active);
+         if(count!=opus_packet_get_nb_frames(packet,len))test_failed();
+         if(opus_decode(dec,packet,len,outbuf,fs,0)!=fs)test_failed();
+         n=fs/count;
+         for(j=0;j<count;j++)
+         {
+            if(level[j]<OPUS_PROBE_MIN_LEVEL||level[j]>0||active[j]>1)test_failed();
+            e=0;
+            for(k=j*n*2;k<(j+1)*n*2;k++)e+=(double)outbuf[k]*outbuf[k];
+            e/=n*2*32768.*32768.;
+            p=pow(10,level[j]/2560.);
+            if(f>=5&&f<60)
+            {
+               if(e>1e-3&&!active[j])test_failed();
+               e_sum+=e*n;
+               p_sum+=p*n;
+            }
+            else if(f>=70&&active[j])test_failed();
+         }
+         /*Compare the mean levels over 100 ms blocks, so that the decoder
+           delay does not matter.*/
+         if(f>=5&&f<60&&(f+1)*fs%4800==0)
+         {
+            if(fabs(10*log10(p_sum/e_sum))>6)nb_off++;
+            nb_blocks++;
+            e_sum=p_sum=0;
+         }
+         i+=fs*2;
+      }
+      opus_encoder_destroy(enc);
+      opus_decoder_destroy(dec);
+   }
+   /*The level should be within a few dB of the decoded one.*/
+   if(nb_off*5>nb_blocks)test_failed();
+   opus_probe_destroy(probe);
+   fprintf(stdout,"    Probed %d blocks, %d off by more than 6 dB OK.\n",nb_blocks,nb_off);
+   free(inbuf);
+   free(outbuf);
+   free(packet);
+   return 0;
+}
+
 void print_usage(char* _argv[])
 {
    fprintf(stderr,"Usage: %s [<seed>] [-fuzz <num_encoders> <num_settings_per_encoder>]\n",_argv[0]);
@@ -690,6 +1150,12 @@ int main(int _argc, char **_argv)
      may cause the decoders to clip, which angers CLANG IOC.*/
    run_test1(getenv("TEST_OPUS_NOFUZZ")!=NULL);
 
+   run_test_ms_executor();
+   run_test_planar();
+   run_test_group();
+   run_test_transrater();
+   run_test_probe();
+
    /* Fuzz encoder settings online */
    if(getenv("TEST_OPUS_NOFUZZ")==NULL) {
       fprintf(stderr,"Running fuzz_encoder_settings with %d encoder(s) and %d setting change(s) each.\n",
@@ -290,19 +290,29 @@ void test_encode_decode(opus_int32 bitrate, opus_int32 channels,
 
   OpusProjectionEncoder *st_enc;
   OpusProjectionDecoder *st_dec;
+  OpusProjectionEncoder *st_enc_planar;
+  OpusProjectionDecoder *st_dec_planar;
   int streams;
   int coupled;
   int error;
   short *buffer_in;
   short *buffer_out;
+  short *buffer_planar;
+  short **planes;
   unsigned char data[MAX_DATA_BYTES] = { 0 };
+  unsigned char data_planar[MAX_DATA_BYTES] = { 0 };
   int len;
   int out_samples;
+  int i, c;
   opus_int32 matrix_size = 0;
   unsigned char *matrix = NULL;
 
   buffer_in = (short *)malloc(sizeof(short) * BUFFER_SIZE * channels);
   buffer_out = (short *)malloc(sizeof(short) * BUFFER_SIZE * channels);
+  buffer_planar = (short *)malloc(sizeof(short) * BUFFER_SIZE * channels);
+  planes = (short **)malloc(sizeof(short *) * channels);
+  for (c = 0; c < channels; c++)
+    planes[c] = buffer_planar + c * BUFFER_SIZE;
 
   st_enc = opus_projection_ambisonics_encoder_create(Fs, channels,
     mapping_family, &streams, &coupled, application, &error);
@@ -312,15 +322,30 @@ void test_encode_decode(opus_int32 bitrate, opus_int32 channels,
       channels, mapping_family);
     free(buffer_in);
     free(buffer_out);
+    free(buffer_planar);
+    free(planes);
     test_failed();
   }
 
+  st_enc_planar = opus_projection_ambisonics_encoder_create(Fs, channels,
+    mapping_family, &streams, &coupled, application, &error);
+  if (error != OPUS_OK)
+  {
+    goto bad_cleanup;
+  }
+
   error = opus_projection_encoder_ctl(st_enc,
     OPUS_SET_BITRATE(bitrate * 1000 * (streams + coupled)));
   if (error != OPUS_OK)
   {
     goto bad_cleanup;
   }
+  error = opus_projection_encoder_ctl(st_enc_planar,
+    OPUS_SET_BITRATE(bitrate * 1000 * (streams + coupled)));
+  if (error != OPUS_OK)
+  {
+    goto bad_cleanup;
+  }
 
   error = opus_projection_encoder_ctl(st_enc,
     OPUS_PROJECTION_GET_DEMIXING_MATRIX_SIZE_REQUEST, &matrix_size);
@@ -335,6 +360,9 @@ void test_encode_decode(opus_int32 bitrate, opus_int32 channels,
 
   st_dec = opus_projection_decoder_create(Fs, channels, streams, coupled,
     matrix, matrix_size, &error);
+  if (error == OPUS_OK)
+    st_dec_planar = opus_projection_decoder_create(Fs, channels, streams,
+      coupled, matrix, matrix_size, &error);
   opus_free(matrix);
 
   if (error != OPUS_OK) {
@@ -360,14 +388,45 @@ void test_encode_decode(opus_int32 bitrate, opus_int32 channels,
     goto bad_cleanup;
   }
 
+  /* The planar API must match the interleaved one bit for bit. */
+  for (c = 0; c < channels; c++)
+    for (i = 0; i < BUFFER_SIZE; i++)
+      planes[c][i] = buffer_in[i * channels + c];
+  if (opus_projection_encode_planar(st_enc_planar,
+      (const opus_int16 * const *)planes, BUFFER_SIZE, data_planar,
+      MAX_DATA_BYTES) != len || memcmp(data, data_planar, len) != 0)
+  {
+    fprintf(stderr,"opus_projection_encode_planar() mismatch\n");
+    goto bad_cleanup;
+  }
+  if (opus_projection_decode_planar(st_dec_planar, data, len, planes,
+      MAX_FRAME_SAMPLES, 0) != BUFFER_SIZE)
+  {
+    fprintf(stderr,"opus_projection_decode_planar() failed\n");
+    goto bad_cleanup;
+  }
+  for (c = 0; c < channels; c++)
+    for (i = 0; i < BUFFER_SIZE; i++)
+      if (planes[c][i] != buffer_out[i * channels + c])
+      {
+        fprintf(stderr,"opus_projection_decode_planar() mismatch\n");
+        goto bad_cleanup;
+      }
+
   opus_projection_decoder_destroy(st_dec);
   opus_projection_encoder_destroy(st_enc);
+  opus_projection_decoder_destroy(st_dec_planar);
+  opus_projection_encoder_destroy(st_enc_planar);
   free(buffer_in);
   free(buffer_out);
+  free(buffer_planar);
+  free(planes);
   return;
 bad_cleanup:
   free(buffer_in);
   free(buffer_out);
+  free(buffer_planar);
+  free(planes);
   test_failed();
 }
 
@@ -0,0 +1,213 @@
+/* Copyright (c) 2026 Xiph.Org Foundation */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef DISABLE_FLOAT_API
+
+#include "cpu_support.h"
+#include "../src/mlp.h"
+
+#if defined(OPUS_X86_MAY_HAVE_SSE4_1) || defined(OPUS_X86_MAY_HAVE_AVX2)
+#include "../src/x86/mlp_sse.h"
+#endif
+
+#if defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+#include "../src/arm/mlp_arm.h"
+#endif
+
+#ifndef OVERRIDE_GEMM_ACCUM
+#define gemm_accum(out, weights, rows, cols, col_stride, x, arch) \
+   ((void)(arch), gemm_accum_c(out, weights, rows, cols, col_stride, x))
+#endif
+
+#ifndef OVERRIDE_VEC_TANSIG
+#define vec_tansig(y, x, N, arch) ((void)(arch), vec_tansig_c(y, x, N))
+#define vec_sigmoid(y, x, N, arch) ((void)(arch), vec_sigmoid_c(y, x, N))
+#endif
+
+#define MAX_ROWS 100
+#define MAX_COLS 100
+#define NB_SHAPES 2000
+#define NB_VALUES 4000
+
+static opus_uint32 seed = 1;
+
+static opus_int32 fast_rand(void)
+{
+   seed = 1664525*seed + 1013904223;
+   return (opus_int32)(seed>>8);
+}
+
+/* Uniform in [-a, a]. */
+static float rand_float(float a)
+{
+   return a*((fast_rand()&0xFFFF)*(2.f/65535) - 1);
+}
+
+static float fabs_float(float x)
+{
+   return x < 0 ? -x : x;
+}
+
+/* The kernels add the same products as gemm_accum_c(), but FMA (AVX2, and
+   the C code itself on some compilers) rounds each step differently, so the
+   outputs only match up to one rounding error per step. */
+static int test_gemm_accum(int arch)
+{
+   static opus_int8 weights[MAX_COLS*(MAX_ROWS+4)];
+   float x[MAX_COLS];
+   float out_ref[MAX_ROWS+1];
+   float out_opt[MAX_ROWS+1];
+   float mag[MAX_ROWS];
+   int i, j, k;
+   for (k=0;k<NB_SHAPES;k++)
+   {
+      int rows, cols, col_stride;
+      rows = 1 + fast_rand()%MAX_ROWS;
+      cols = 1 + fast_rand()%MAX_COLS;
+      col_stride = rows + fast_rand()%4;
+      for (i=0;i<cols*col_stride;i++)
+         weights[i] = (opus_int8)(fast_rand()&0xFF);
+      for (j=0;j<cols;j++)
+         x[j] = rand_float(k&1 ? 1.f : 100.f);
+      for (i=0;i<rows;i++)
+      {
+         out_ref[i] = out_opt[i] = rand_float(1000.f);
+         mag[i] = fabs_float(out_ref[i]);
+         for (j=0;j<cols;j++)
+            mag[i] += fabs_float(weights[j*col_stride + i]*x[j]);
+      }
+      /* The row after the last one must not be written. */
+      out_ref[rows] = out_opt[rows] = 12345.f;
+      gemm_accum_c(out_ref, weights, rows, cols, col_stride, x);
+      gemm_accum(out_opt, weights, rows, cols, col_stride, x, arch);
+      if (out_opt[rows] != 12345.f)
+      {
+         fprintf(stderr, "**gemm_accum() wrote past %d rows at arch %d**\n",
+               rows, arch);
+         return 1;
+      }
+      for (i=0;i<rows;i++)
+      {
+         if (!(fabs_float(out_opt[i] - out_ref[i]) <= 1.2e-7f*(cols+1)*mag[i]))
+         {
+            fprintf(stderr, "**gemm_accum() differs at arch %d (%dx%d, stride %d, row %d): %.9g instead of %.9g**\n",
+                  arch, rows, cols, col_stride, i, out_opt[i], out_ref[i]);
+            return 1;
+         }
+      }
+   }
+   return 0;
+}
+
+/* Saturation and NaN handling must be exact. Elsewhere the vector versions
+   follow tansig_approx() step by step, up to FMA rounding. */
+static int test_activations(int arch)
+{
+   static const float edges[] = {
+      8.f, -8.f, 7.9999995f, -7.9999995f, 8.0000005f, -8.0000005f,
+      0.f, -0.f, 1e-30f, -1e-30f, .02f, -.02f, .06f, 1e10f, -1e10f
+   };
+   float x[NB_VALUES];
+   float y_ref[NB_VALUES];
+   float y_opt[NB_VALUES];
+   float inf, nan;
+   int i, n, sigmoid;
+   inf = 1e30f;
+   inf *= inf;
+   nan = inf - inf;
+   n = 0;
+   for (i=0;i<(int)(sizeof(edges)/sizeof(edges[0]));i++)
+      x[n++] = edges[i];
+   x[n++] = inf;
+   x[n++] = -inf;
+   x[n++] = nan;
+   for (;n<NB_VALUES;n++)
+      x[n] = rand_float(n&1 ? 10.f : 20.f);
+   for (sigmoid=0;sigmoid<=1;sigmoid++)
+   {
+      /* Every length up to 8 covers the vector loops and the C tails. */
+      for (n=1;n<=NB_VALUES;n+=(n<8 ? 1 : NB_VALUES/3))
+      {
+         memset(y_ref, 0, sizeof(y_ref));
+         memset(y_opt, 0, sizeof(y_opt));
+         if (sigmoid)
+         {
+            vec_sigmoid_c(y_ref, x, n);
+            vec_sigmoid(y_opt, x, n, arch);
+         }
+         else
+         {
+            vec_tansig_c(y_ref, x, n);
+            vec_tansig(y_opt, x, n, arch);
+         }
+         for (i=0;i<NB_VALUES;i++)
+         {
+            float xs, tol;
+            xs = sigmoid ? .5f*x[i] : x[i];
+            tol = (i >= n || !(xs < 8) || !(xs > -8)) ? 0 : 1e-6f;
+            if (!(fabs_float(y_opt[i] - y_ref[i]) <= tol))
+            {
+               fprintf(stderr, "**vec_%s() differs at arch %d (length %d, x=%.9g): %.9g instead of %.9g**\n",
+                     sigmoid ? "sigmoid" : "tansig", arch, n, x[i], y_opt[i], y_ref[i]);
+               return 1;
+            }
+         }
+      }
+   }
+   return 0;
+}
+
+int main(void)
+{
+   int arch;
+   int max_arch = opus_select_arch();
+   printf("Testing the MLP kernels up to arch %d ...\n", max_arch);
+   for (arch=0;arch<=max_arch;arch++)
+   {
+      if (test_gemm_accum(arch) || test_activations(arch))
+         return 1;
+   }
+   printf("MLP kernels passed at %d archs\n", max_arch+1);
+   return 0;
+}
+
+#else
+
+int main(void)
+{
+   printf("The MLP is not built without the float API.\n");
+   return 0;
+}
+
+#endif